@@ -182,6 +182,18 @@ extern "C" {
 #define NET_TASK_HISTORY_SIZE   0U
 #endif /* NET_PERF_MAXTHREAD  */
 
+/* Please uncomment to run the network library in a host (Linux) process, without RTOS, together with */
+/* the loopback network interface (loopback_net_driver) to test or benchmark it off-target            */
+/* #define NET_USE_POSIX_OS */
+
+/* Please uncomment to serve the network library and mbedTLS allocations from fixed-size block pools, */
+/* see NET_MEM_POOL_CLASSES in net_mem.h to size the pools                                            */
+/* #define NET_USE_MEM_POOL */
+
+/* Please uncomment to collect per socket / per network interface traffic counters and latency histograms */
+/* of send, recv, connect and TLS handshake, see net_perf.h for the query API                            */
+/* #define NET_PERF_SOCKET_STATS */
+
 
 /* The random provider to implement on the application side. */
 int mbedtls_rng_raw(void *data, uchar_t *output, size_t len);
@@ -319,6 +319,19 @@ int32_t service_sdhcp_delete(void);
 
 #else
 
+/* Datagram descriptor for the batched net_sendmmsg / net_recvmmsg APIs. */
+typedef struct
+{
+  uint8_t        *buf;       /**< datagram payload */
+  uint32_t        len;       /**< payload length to send, or buffer size to receive into */
+  net_sockaddr_t *addr;      /**< destination address to send to, or storage for the source address, may be NULL */
+  uint32_t        addrlen;   /**< length of the addr storage */
+  int32_t         result;    /**< out: number of byte transferred or error code, per datagram */
+} net_mmsg_t;
+
+/* Completion callback of net_connect_async, status is NET_OK or the error which aborted the connection. */
+typedef void (*net_connect_cb_t)(int32_t sock, int32_t status, void *context);
+
 int32_t net_socket(int32_t domain, int32_t type, int32_t protocol);
 int32_t net_bind(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen);
 int32_t net_accept(int32_t sock, net_sockaddr_t *addr, uint32_t *addrlen);
@@ -327,6 +340,9 @@ int32_t net_shutdown(int32_t sock, int32_t mode);
 int32_t net_setsockopt(int32_t sock, int32_t level, net_socketoption_t optname, const void *optvalue, uint32_t optlen);
 int32_t net_getsockopt(int32_t sock, int32_t level, net_socketoption_t optname, void *optvalue, uint32_t *optlen);
 int32_t net_connect(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen);
+int32_t net_connect_async(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen, net_connect_cb_t callback,
+                          void *context);
+int32_t net_connect_poll(int32_t sock);
 int32_t net_listen(int32_t sock, int32_t backlog);
 int32_t net_send(int32_t sock, const uint8_t *buf, uint32_t len, int32_t flags);
 int32_t net_recv(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in);
@@ -335,6 +351,8 @@ int32_t net_recvfrom(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in,
                      uint32_t *fromlen);
 int32_t net_getsockname(int32_t sock, net_sockaddr_t *name, uint32_t *namelen);
 int32_t net_getpeername(int32_t sock, net_sockaddr_t *name, uint32_t *namelen);
+int32_t net_sendmmsg(int32_t sock, net_mmsg_t *msgs, uint32_t count, int32_t flags);
+int32_t net_recvmmsg(int32_t sock, net_mmsg_t *msgs, uint32_t count, int32_t flags_in);
 #endif /* NET_BYPASS_NET_SOCKET */
 
 extern const int32_t net_tls_sizeof_suite_structure;
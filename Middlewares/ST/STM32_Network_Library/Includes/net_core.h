@@ -31,6 +31,14 @@ extern "C" {
 #include "net_wifi.h"
 #include "net_class_extension.h"
 
+#if defined(NET_USE_POSIX_OS)
+#if defined(NET_USE_RTOS)
+#error "NET_USE_POSIX_OS runs the network library in a single host thread, NET_USE_RTOS is not supported"
+#endif /* NET_USE_RTOS */
+/* Millisecond tick provided by the host port in net_os.c. */
+uint32_t HAL_GetTick(void);
+#endif /* NET_USE_POSIX_OS */
+
 #ifdef NET_USE_RTOS
 void net_init_locks(void);
 void net_destroy_locks(void);
@@ -142,6 +150,7 @@ typedef enum
 {
   SOCKET_NOT_ALIVE = 0,
   SOCKET_ALLOCATED,
+  SOCKET_CONNECTING,
   SOCKET_CONNECTED
 } socket_state_t;
 
@@ -164,6 +173,8 @@ typedef struct net_socket_s
   int32_t          write_timeout;
   bool             blocking;
   int32_t          idx;
+  net_connect_cb_t connect_cb;
+  void             *connect_cb_context;
 } net_socket_t;
 
 #ifdef  NET_MBEDTLS_HOST_SUPPORT
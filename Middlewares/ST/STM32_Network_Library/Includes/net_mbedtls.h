@@ -50,12 +50,16 @@ struct net_tls_data
   mbedtls_x509_crt clicert;
   mbedtls_pk_context pkey;
   const mbedtls_x509_crt_profile *tls_cert_prof;  /**< Socket option. */
+  uint32_t handshake_tick;      /**< tick of the first handshake step, for NET_MBEDTLS_CONNECT_TIMEOUT */
+  uint32_t handshake_perf;      /**< start stamp of the handshake, for the performance histograms */
 } ;
 
 void net_tls_init(void);
 void net_tls_destroy(void);
 
 int32_t net_mbedtls_start(net_socket_t *sockhnd);
+int32_t net_mbedtls_start_async(net_socket_t *sockhnd);
+int32_t net_mbedtls_handshake_step(net_socket_t *sockhnd);
 int32_t net_mbedtls_stop(net_socket_t *sockhnd);
 int32_t net_mbedtls_sock_recv(net_socket_t *sockhnd, uint8_t *buf, size_t len);
 int32_t net_mbedtls_sock_send(net_socket_t *sockhnd, const uint8_t *buf, size_t len);
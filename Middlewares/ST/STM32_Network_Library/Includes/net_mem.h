@@ -85,7 +85,53 @@ void  net_free_debug(void *p);
 void net_alloc_report(void);
 
 
-#else /* !NET_ALLOC_DEBUG */
+#elif defined(NET_USE_MEM_POOL)
+
+/* Size classes of the fixed-size block pools, as X(block size in bytes, number of blocks).      */
+/* Block sizes must be sorted in increasing order and be multiple of 8 bytes. Default classes     */
+/* follow the power of 2 buckets of NET_ALLOC_HISTOGRAM: run once with NET_ALLOC_DEBUG_TREE and   */
+/* NET_ALLOC_HISTOGRAM to get the allocation profile of the application, then tune the counts.    */
+/* Requests larger than the biggest class, or made when all suitable pools are exhausted, are     */
+/* served by the general heap. Add a class of MBEDTLS_SSL_IN_BUFFER_LEN bytes to also keep the    */
+/* TLS record buffers out of the general heap.                                                    */
+#ifndef NET_MEM_POOL_CLASSES
+#define NET_MEM_POOL_CLASSES(X)  \
+  X(32U,    32U)                 \
+  X(64U,    32U)                 \
+  X(128U,   16U)                 \
+  X(256U,   16U)                 \
+  X(512U,    8U)                 \
+  X(1024U,   4U)                 \
+  X(2048U,   4U)
+#endif /* NET_MEM_POOL_CLASSES */
+
+#define NET_CALLOC(NUM, SIZE)  net_calloc(NUM, SIZE)
+#define NET_REALLOC(P, SIZE)   net_realloc(P, SIZE)
+#define NET_MALLOC(SIZE)       net_malloc(SIZE)
+#define NET_FREE(P)            net_free(P)
+
+/* Occupancy of one size class. */
+typedef struct
+{
+  uint32_t block_size;          /**< size of a block of the class in bytes */
+  uint32_t block_count;         /**< number of blocks of the class */
+  uint32_t in_use;              /**< number of blocks currently allocated */
+  uint32_t high_water;          /**< maximum number of blocks allocated at the same time */
+  uint32_t alloc_count;         /**< number of allocations served by the class */
+  uint32_t exhausted;           /**< number of requests fitting the class while it was empty */
+} net_mem_pool_stats_t;
+
+void *net_malloc(size_t size);
+void *net_calloc(size_t num, size_t size);
+void *net_realloc(void *p, size_t size);
+void  net_free(void *p);
+
+uint32_t net_mem_pool_class_number(void);
+int32_t  net_mem_pool_get_stats(uint32_t class_idx, net_mem_pool_stats_t *stats);
+uint32_t net_mem_pool_heap_fallback(void);
+void     net_mem_pool_report(void);
+
+#else /* !NET_ALLOC_DEBUG && !NET_USE_MEM_POOL */
 
 #ifdef NET_USE_RTOS
 #define NET_CALLOC(NUM, SIZE)  net_calloc(NUM, SIZE)
@@ -76,6 +76,83 @@ void net_perf_task_tag(uint32_t msg_id);
 #endif /* NET_PERF_TASK_TAG */
 
 
+#if defined(NET_PERF_SOCKET_STATS)
+#include "net_address.h"
+
+/* Number of network interfaces that can be tracked by the statistics. */
+#ifndef NET_PERF_MAX_NETIF
+#define NET_PERF_MAX_NETIF           2U
+#endif /* NET_PERF_MAX_NETIF */
+
+/* Latency histogram, bucket i counts durations in [2 exp(i) .. 2 exp(i+1)[ us, */
+/* bucket 0 also counts durations below 1 us, last bucket is saturating.        */
+#ifndef NET_PERF_HISTOGRAM_SIZE
+#define NET_PERF_HISTOGRAM_SIZE      24U
+#endif /* NET_PERF_HISTOGRAM_SIZE */
+
+/* Operations whose latency is recorded. */
+typedef enum
+{
+  NET_PERF_OP_SEND = 0,         /**< net_send / net_sendto */
+  NET_PERF_OP_RECV,             /**< net_recv / net_recvfrom */
+  NET_PERF_OP_CONNECT,          /**< net_connect, TLS handshake excluded */
+  NET_PERF_OP_TLS_HANDSHAKE,    /**< mbedtls handshake of a secure socket */
+  NET_PERF_OP_NUMBER
+} net_perf_op_t;
+
+/* Traffic counters, maintained per socket and per network interface. */
+typedef struct
+{
+  uint32_t bytes_sent;          /**< bytes accepted by the lower layer */
+  uint32_t bytes_received;      /**< bytes returned to the application */
+  uint32_t send_calls;          /**< number of send / sendto calls */
+  uint32_t recv_calls;          /**< number of recv / recvfrom calls */
+  uint32_t would_block;         /**< calls that returned without data (EAGAIN like) */
+  uint32_t timeouts;            /**< calls that returned NET_TIMEOUT */
+  uint32_t errors;              /**< calls that returned any other error */
+  uint32_t retransmits;         /**< TCP retransmissions reported by the driver, interface counters only */
+} net_perf_counters_t;
+
+/* Log2 latency histogram of one operation. */
+typedef struct
+{
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint32_t total_us;
+  uint32_t bucket[NET_PERF_HISTOGRAM_SIZE];
+} net_perf_histogram_t;
+
+void     net_perf_stats_reset(void);
+void     net_perf_stats_report(void);
+int32_t  net_perf_get_socket_stats(int32_t sock, net_perf_counters_t *counters);
+int32_t  net_perf_get_netif_stats(const net_if_handle_t *pnetif, net_perf_counters_t *counters);
+int32_t  net_perf_get_histogram(net_perf_op_t op, net_perf_histogram_t *histogram);
+
+/* Internal hooks used by the socket layer. */
+uint32_t net_perf_op_start(void);
+void     net_perf_op_end(net_perf_op_t op, int32_t sock, const net_if_handle_t *pnetif, int32_t ret, uint32_t start);
+void     net_perf_socket_reset(int32_t sock);
+void     net_perf_would_block(int32_t sock, const net_if_handle_t *pnetif);
+
+/* Hook for the network interface drivers able to report TCP retransmissions. */
+void     net_perf_retransmit(const net_if_handle_t *pnetif, uint32_t count);
+
+#define NET_PERF_OP_START()                         net_perf_op_start()
+#define NET_PERF_OP_END(OP, SOCK, NETIF, RET, T0)   net_perf_op_end((OP), (SOCK), (NETIF), (RET), (T0))
+#define NET_PERF_SOCKET_RESET(SOCK)                 net_perf_socket_reset(SOCK)
+#define NET_PERF_WOULD_BLOCK(SOCK, NETIF)           net_perf_would_block((SOCK), (NETIF))
+#define NET_PERF_RETRANSMIT(NETIF, COUNT)           net_perf_retransmit((NETIF), (COUNT))
+
+#else
+#define NET_PERF_OP_START()                         0U
+#define NET_PERF_OP_END(OP, SOCK, NETIF, RET, T0)   (void)(T0)
+#define NET_PERF_SOCKET_RESET(...)
+#define NET_PERF_WOULD_BLOCK(...)
+#define NET_PERF_RETRANSMIT(...)
+#endif /* NET_PERF_SOCKET_STATS */
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -135,7 +135,7 @@ void net_unlock_nochk(int32_t sock)
 }
 
 
-#if !defined(NET_ALLOC_DEBUG)
+#if !defined(NET_ALLOC_DEBUG) && !defined(NET_USE_MEM_POOL)
 #define MAX_ALLOC_VALUE 0x4000U
 
 void *net_calloc(size_t num, size_t size)
@@ -198,7 +198,7 @@ void *net_realloc(void *ptr, size_t size)
   }
   return ret;
 }
-#endif /* !NET_ALLOC_DEBUG */
+#endif /* !NET_ALLOC_DEBUG && !NET_USE_MEM_POOL */
 
 
 /* Below functions are not supposed to be used, all malloc /free should be mapped to NET_MALLOC/NET_FREE macros */
@@ -233,6 +233,309 @@ void free(void *p)
 #endif /* NET_USE_RTOS */
 
 
+#if defined(NET_USE_MEM_POOL) && !defined(NET_ALLOC_DEBUG)
+
+#ifdef NET_USE_RTOS
+#define NET_POOL_HEAP_ALLOC(SIZE)     pvPortMalloc(SIZE)
+#define NET_POOL_HEAP_FREE(P)         vPortFree(P)
+#else
+#define NET_POOL_HEAP_ALLOC(SIZE)     malloc(SIZE)
+#define NET_POOL_HEAP_FREE(P)         free(P)
+#endif /* NET_USE_RTOS */
+
+#define NET_POOL_CLASS_COUNT(SIZE, COUNT)     + 1U
+#define NET_POOL_CLASS_BYTES(SIZE, COUNT)     + ((SIZE) * (COUNT))
+#define NET_POOL_CLASS_INIT(SIZE, COUNT)      { (SIZE), (COUNT) },
+
+#define NET_POOL_CLASS_NUMBER         (0U NET_MEM_POOL_CLASSES(NET_POOL_CLASS_COUNT))
+#define NET_POOL_TOTAL_SIZE           (0U NET_MEM_POOL_CLASSES(NET_POOL_CLASS_BYTES))
+
+typedef struct net_pool_block_s
+{
+  struct net_pool_block_s *next;
+} net_pool_block_t;
+
+typedef struct
+{
+  uint32_t          block_size;
+  uint32_t          block_count;
+  uint8_t          *start;
+  uint8_t          *end;
+  net_pool_block_t *free_list;
+  uint32_t          in_use;
+  uint32_t          high_water;
+  uint32_t          alloc_count;
+  uint32_t          exhausted;
+} net_pool_class_t;
+
+static const uint32_t PoolClassConf[NET_POOL_CLASS_NUMBER][2] =
+{
+  NET_MEM_POOL_CLASSES(NET_POOL_CLASS_INIT)
+};
+
+/* 8 bytes alignment as required by mbedTLS contexts. */
+static uint64_t PoolMemory[NET_POOL_TOTAL_SIZE / sizeof(uint64_t)];
+static net_pool_class_t PoolClasses[NET_POOL_CLASS_NUMBER];
+static uint32_t PoolHeapFallback;
+static bool PoolInitialized;
+
+
+static void net_pool_init(void)
+{
+  uint8_t *p = (uint8_t *) PoolMemory;
+
+  for (uint32_t i = 0U; i < NET_POOL_CLASS_NUMBER; i++)
+  {
+    net_pool_class_t *const pool = &PoolClasses[i];
+
+    NET_ASSERT((PoolClassConf[i][0] % sizeof(uint64_t)) == 0U, "Pool block size must be a multiple of 8\n");
+    NET_ASSERT((i == 0U) || (PoolClassConf[i][0] > PoolClassConf[i - 1U][0]), "Pool classes must be sorted\n");
+
+    pool->block_size = PoolClassConf[i][0];
+    pool->block_count = PoolClassConf[i][1];
+    pool->start = p;
+    pool->free_list = NULL;
+
+    /* Chain the blocks so that the lowest addresses are served first. */
+    for (uint32_t n = pool->block_count; n > 0U; n--)
+    {
+      net_pool_block_t *const block = (net_pool_block_t *)(void *)&p[(n - 1U) * pool->block_size];
+      block->next = pool->free_list;
+      pool->free_list = block;
+    }
+    p = &p[pool->block_count * pool->block_size];
+    pool->end = p;
+  }
+  PoolInitialized = true;
+}
+
+
+static net_pool_class_t *net_pool_owner(const void *ptr)
+{
+  net_pool_class_t *owner = NULL;
+  const uint8_t *const p = (const uint8_t *) ptr;
+
+  if ((p >= (const uint8_t *) PoolMemory) && (p < &((const uint8_t *) PoolMemory)[NET_POOL_TOTAL_SIZE]))
+  {
+    for (uint32_t i = 0U; i < NET_POOL_CLASS_NUMBER; i++)
+    {
+      if (p < PoolClasses[i].end)
+      {
+        owner = &PoolClasses[i];
+        break;
+      }
+    }
+  }
+  return owner;
+}
+
+
+/**
+  * @brief  Allocate a block from the smallest pool that fits, fallback to the heap
+  * @param  size [in] number of bytes
+  * @retval pointer to the allocated memory, NULL in case of failure
+  */
+void *net_malloc(size_t size)
+{
+  void *p = NULL;
+
+  if (size != (size_t) 0)
+  {
+    NET_RTOS_SUSPEND;
+    if (!PoolInitialized)
+    {
+      net_pool_init();
+    }
+
+    for (uint32_t i = 0U; i < NET_POOL_CLASS_NUMBER; i++)
+    {
+      net_pool_class_t *const pool = &PoolClasses[i];
+
+      if (size <= pool->block_size)
+      {
+        if (pool->free_list != NULL)
+        {
+          p = pool->free_list;
+          pool->free_list = pool->free_list->next;
+          pool->in_use++;
+          pool->alloc_count++;
+          if (pool->in_use > pool->high_water)
+          {
+            pool->high_water = pool->in_use;
+          }
+          break;
+        }
+        pool->exhausted++;
+      }
+    }
+
+    if (p == NULL)
+    {
+      PoolHeapFallback++;
+    }
+    NET_RTOS_RESUME;
+
+    if (p == NULL)
+    {
+      p = NET_POOL_HEAP_ALLOC(size);
+    }
+  }
+  return p;
+}
+
+
+/**
+  * @brief  Release a block to its pool or to the heap
+  * @param  p [in] pointer returned by net_malloc, net_calloc or net_realloc
+  * @retval None
+  */
+void net_free(void *p)
+{
+  if (p != NULL)
+  {
+    net_pool_class_t *const pool = net_pool_owner(p);
+
+    if (pool != NULL)
+    {
+      net_pool_block_t *const block = (net_pool_block_t *) p;
+
+      NET_RTOS_SUSPEND;
+      block->next = pool->free_list;
+      pool->free_list = block;
+      pool->in_use--;
+      NET_RTOS_RESUME;
+    }
+    else
+    {
+      NET_POOL_HEAP_FREE(p);
+    }
+  }
+}
+
+
+void *net_calloc(size_t num, size_t size)
+{
+  void *p = NULL;
+
+  if ((size == (size_t) 0) || (num <= (SIZE_MAX / size)))
+  {
+    p = net_malloc(num * size);
+  }
+  if (p != NULL)
+  {
+    (void) memset(p, 0, num * size);
+  }
+  return p;
+}
+
+
+void *net_realloc(void *ptr, size_t size)
+{
+  void *ret = NULL;
+
+  if (size == (size_t) 0)
+  {
+    net_free(ptr);
+  }
+  else if (ptr == NULL)
+  {
+    ret = net_malloc(size);
+  }
+  else
+  {
+    const net_pool_class_t *const pool = net_pool_owner(ptr);
+
+    if ((pool != NULL) && (size <= pool->block_size))
+    {
+      /* Block is large enough. */
+      ret = ptr;
+    }
+    else
+    {
+      ret = net_malloc(size);
+      if (ret != NULL)
+      {
+        /* Size of heap blocks is unknown, copy the requested size as the heap based version does. */
+        const size_t copy_size = ((pool != NULL) && (pool->block_size < size)) ? pool->block_size : size;
+        (void) memcpy(ret, ptr, copy_size);
+        net_free(ptr);
+      }
+    }
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  Get the number of pool size classes
+  * @retval number of classes
+  */
+uint32_t net_mem_pool_class_number(void)
+{
+  return NET_POOL_CLASS_NUMBER;
+}
+
+
+/**
+  * @brief  Get occupancy statistics of a pool size class
+  * @param  class_idx [in] class index, from 0 to net_mem_pool_class_number() - 1
+  * @param  stats [out] pointer to the structure to fill
+  * @retval zero in case of success, error code otherwise
+  */
+int32_t net_mem_pool_get_stats(uint32_t class_idx, net_mem_pool_stats_t *stats)
+{
+  int32_t ret = NET_ERROR_PARAMETER;
+
+  if ((class_idx < NET_POOL_CLASS_NUMBER) && (stats != NULL))
+  {
+    const net_pool_class_t *const pool = &PoolClasses[class_idx];
+
+    NET_RTOS_SUSPEND;
+    stats->block_size = PoolClassConf[class_idx][0];
+    stats->block_count = PoolClassConf[class_idx][1];
+    stats->in_use = pool->in_use;
+    stats->high_water = pool->high_water;
+    stats->alloc_count = pool->alloc_count;
+    stats->exhausted = pool->exhausted;
+    NET_RTOS_RESUME;
+    ret = NET_OK;
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  Get the number of allocations that were served by the general heap
+  * @retval number of allocations
+  */
+uint32_t net_mem_pool_heap_fallback(void)
+{
+  return PoolHeapFallback;
+}
+
+
+void net_mem_pool_report(void)
+{
+  (void) printf("\n### Net Memory pool report, %" PRIu32 " bytes in %" PRIu32 " classes\n\n",
+                (uint32_t)NET_POOL_TOTAL_SIZE, (uint32_t)NET_POOL_CLASS_NUMBER);
+
+  for (uint32_t i = 0U; i < NET_POOL_CLASS_NUMBER; i++)
+  {
+    net_mem_pool_stats_t stats;
+
+    (void) net_mem_pool_get_stats(i, &stats);
+    (void) printf("\tblock %5" PRIu32 " bytes: in use %3" PRIu32 " / %3" PRIu32 ", high water %3" PRIu32
+                  ", allocations %" PRIu32 ", exhausted %" PRIu32 "\n",
+                  stats.block_size, stats.in_use, stats.block_count, stats.high_water,
+                  stats.alloc_count, stats.exhausted);
+  }
+  (void) printf("\n\theap fallback: %" PRIu32 " allocations\n", PoolHeapFallback);
+  (void) printf("\n### Net Memory pool end report\n\n");
+}
+
+#endif /* NET_USE_MEM_POOL && !NET_ALLOC_DEBUG */
+
+
 #ifdef NET_ALLOC_DEBUG
 
 #ifdef NET_ALLOC_DEBUG_TREE
@@ -795,8 +1098,32 @@ void net_alloc_report(void)
 
 #endif  /* NET_DEBUG_ALLOC */
 
+#if defined(NET_USE_POSIX_OS)
+/* Host port: the cycle counter is emulated with the monotonic clock, one "cycle" per nanosecond. */
+#include <time.h>
+
+uint32_t SystemCoreClock = 1000000000U;
+
+static uint32_t PosixDwtControl;
+static uint32_t PosixDwtCycleOffset;
+
+static uint64_t net_posix_ns(void)
+{
+  struct timespec ts;
+  (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)(net_posix_ns() / 1000000ULL);
+}
+
+#else
 /* Forward declaration of the system clock, previously set by the platform. */
 extern uint32_t SystemCoreClock;
+#endif /* NET_USE_POSIX_OS */
 
 
 static struct net_perf
@@ -813,7 +1140,10 @@ static struct net_perf
 #endif /* NET_USE_RTOS && NET_PERF_TASK */
 } Perfs;
 
-#if defined(__CORTEX_M)
+#if defined(NET_USE_POSIX_OS)
+#define NET_DWT_CONTROL              PosixDwtControl
+
+#elif defined(__CORTEX_M)
 #define NET_DWT_CONTROL              DWT->CTRL
 #define NET_DWT_CYCCNT               DWT->CYCCNT
 #define NET_DEMCR                    CoreDebug->DEMCR
@@ -839,7 +1169,11 @@ static struct net_perf
 
 static uint32_t net_get_cycle(void)
 {
+#if defined(NET_USE_POSIX_OS)
+  return (uint32_t)net_posix_ns() - PosixDwtCycleOffset;
+#else
   return NET_DWT_CYCCNT;
+#endif /* NET_USE_POSIX_OS */
 }
 
 
@@ -1007,7 +1341,11 @@ static const float TO_MICRO_SECOND = 1000000.0;
 void net_perf_start(void)
 {
   NET_DWT_CONTROL |= NET_DWT_CYCCNTENA_BIT;
+#if defined(NET_USE_POSIX_OS)
+  PosixDwtCycleOffset = (uint32_t)net_posix_ns();
+#else
   NET_DWT_CYCCNT = 0U;
+#endif /* NET_USE_POSIX_OS */
   (void)memset(&Perfs, 0, sizeof(Perfs));
 
 #if defined(NET_PERF_TASK)
@@ -1079,3 +1417,361 @@ void net_perf_report(void)
 
   (void) printf("\n### Net Performance end report\n\n");
 }
+
+
+#if defined(NET_PERF_SOCKET_STATS)
+
+static struct net_perf_stats
+{
+  net_perf_counters_t   sockets[NET_MAX_SOCKETS_NBR];
+  const net_if_handle_t *netif_handle[NET_PERF_MAX_NETIF];
+  net_perf_counters_t   netifs[NET_PERF_MAX_NETIF];
+  net_perf_histogram_t  histograms[NET_PERF_OP_NUMBER];
+} PerfStats;
+
+static const char_t *const PerfOpNames[NET_PERF_OP_NUMBER] =
+{
+  "send", "recv", "connect", "tls handshake"
+};
+
+
+static net_perf_counters_t *net_perf_find_netif(const net_if_handle_t *pnetif)
+{
+  net_perf_counters_t *counters = NULL;
+
+  if (pnetif != NULL)
+  {
+    for (uint32_t i = 0U; i < NET_PERF_MAX_NETIF; i++)
+    {
+      if (PerfStats.netif_handle[i] == NULL)
+      {
+        /* New network interface */
+        PerfStats.netif_handle[i] = pnetif;
+      }
+      if (PerfStats.netif_handle[i] == pnetif)
+      {
+        counters = &PerfStats.netifs[i];
+        break;
+      }
+    }
+  }
+  return counters;
+}
+
+
+static void net_perf_count(net_perf_counters_t *counters, net_perf_op_t op, int32_t ret)
+{
+  if (op == NET_PERF_OP_SEND)
+  {
+    counters->send_calls++;
+  }
+  else
+  {
+    counters->recv_calls++;
+  }
+
+  if (ret > 0)
+  {
+    if (op == NET_PERF_OP_SEND)
+    {
+      counters->bytes_sent += (uint32_t)ret;
+    }
+    else
+    {
+      counters->bytes_received += (uint32_t)ret;
+    }
+  }
+  else if ((ret == 0) || (ret == NET_ERROR_WOULD_BLOCK))
+  {
+    counters->would_block++;
+  }
+  else if (ret == NET_TIMEOUT)
+  {
+    counters->timeouts++;
+  }
+  else
+  {
+    counters->errors++;
+  }
+}
+
+
+static void net_perf_histogram_add(net_perf_histogram_t *histogram, uint32_t duration_us)
+{
+  uint32_t nn = duration_us;
+  uint32_t ln2 = 0U;
+
+  while (nn > 1U)
+  {
+    nn >>= 1;
+    ln2++;
+  }
+  if (ln2 > (NET_PERF_HISTOGRAM_SIZE - 1U))
+  {
+    ln2 = NET_PERF_HISTOGRAM_SIZE - 1U;
+  }
+  histogram->bucket[ln2]++;
+
+  if ((histogram->count == 0U) || (duration_us < histogram->min_us))
+  {
+    histogram->min_us = duration_us;
+  }
+  if (duration_us > histogram->max_us)
+  {
+    histogram->max_us = duration_us;
+  }
+  histogram->total_us += duration_us;
+  histogram->count++;
+}
+
+
+/**
+  * @brief  Clear all the socket statistics and start the cycle counter used for latency measurement
+  * @param  None
+  * @retval None
+  */
+void net_perf_stats_reset(void)
+{
+  NET_RTOS_SUSPEND;
+  (void) memset(&PerfStats, 0, sizeof(PerfStats));
+  NET_RTOS_RESUME;
+  net_start_cycle();
+}
+
+
+/**
+  * @brief  Clear the counters of a socket, called when the socket is allocated
+  * @param  sock [in] internal socket index
+  * @retval None
+  */
+void net_perf_socket_reset(int32_t sock)
+{
+  if ((sock >= 0) && (sock < (int32_t)NET_MAX_SOCKETS_NBR))
+  {
+    (void) memset(&PerfStats.sockets[sock], 0, sizeof(PerfStats.sockets[sock]));
+  }
+}
+
+
+/**
+  * @brief  Get a time stamp to be passed later to net_perf_op_end()
+  * @param  None
+  * @retval current cycle count
+  */
+uint32_t net_perf_op_start(void)
+{
+  return net_get_cycle();
+}
+
+
+/**
+  * @brief  Account an operation in the counters and in the latency histogram
+  * @param  op [in] operation type
+  * @param  sock [in] internal socket index
+  * @param  pnetif [in] network interface used by the socket
+  * @param  ret [in] value returned by the operation
+  * @param  start [in] value returned by net_perf_op_start() before the operation
+  * @retval None
+  */
+void net_perf_op_end(net_perf_op_t op, int32_t sock, const net_if_handle_t *pnetif, int32_t ret, uint32_t start)
+{
+  const uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+  const uint32_t duration_us = (net_get_cycle() - start) / ((cycles_per_us != 0U) ? cycles_per_us : 1U);
+
+  NET_RTOS_SUSPEND;
+  if ((op == NET_PERF_OP_SEND) || (op == NET_PERF_OP_RECV))
+  {
+    net_perf_counters_t *const netif_counters = net_perf_find_netif(pnetif);
+
+    if ((sock >= 0) && (sock < (int32_t)NET_MAX_SOCKETS_NBR))
+    {
+      net_perf_count(&PerfStats.sockets[sock], op, ret);
+    }
+    if (netif_counters != NULL)
+    {
+      net_perf_count(netif_counters, op, ret);
+    }
+  }
+  if (op < NET_PERF_OP_NUMBER)
+  {
+    net_perf_histogram_add(&PerfStats.histograms[op], duration_us);
+  }
+  NET_RTOS_RESUME;
+}
+
+
+/**
+  * @brief  Account a send that the lower layer refused without error (EAGAIN like), the record being
+  *         kept by mbedtls and sent again by the next call
+  * @param  sock [in] internal socket index
+  * @param  pnetif [in] network interface used by the socket
+  * @retval None
+  */
+void net_perf_would_block(int32_t sock, const net_if_handle_t *pnetif)
+{
+  NET_RTOS_SUSPEND;
+  {
+    net_perf_counters_t *const netif_counters = net_perf_find_netif(pnetif);
+
+    if ((sock >= 0) && (sock < (int32_t)NET_MAX_SOCKETS_NBR))
+    {
+      PerfStats.sockets[sock].would_block++;
+    }
+    if (netif_counters != NULL)
+    {
+      netif_counters->would_block++;
+    }
+  }
+  NET_RTOS_RESUME;
+}
+
+
+/**
+  * @brief  Account TCP retransmissions, for the drivers whose network stack reports them
+  * @param  pnetif [in] network interface
+  * @param  count [in] number of segments retransmitted since the previous call
+  * @retval None
+  */
+void net_perf_retransmit(const net_if_handle_t *pnetif, uint32_t count)
+{
+  NET_RTOS_SUSPEND;
+  {
+    net_perf_counters_t *const netif_counters = net_perf_find_netif(pnetif);
+
+    if (netif_counters != NULL)
+    {
+      netif_counters->retransmits += count;
+    }
+  }
+  NET_RTOS_RESUME;
+}
+
+
+/**
+  * @brief  Get the counters of a socket
+  * @param  sock [in] integer socket number
+  * @param  counters [out] pointer to the structure to fill
+  * @retval zero in case of success, error code otherwise
+  */
+int32_t net_perf_get_socket_stats(int32_t sock, net_perf_counters_t *counters)
+{
+  int32_t ret = NET_ERROR_PARAMETER;
+
+  if ((sock >= 0) && (sock < (int32_t)NET_MAX_SOCKETS_NBR) && (counters != NULL))
+  {
+    NET_RTOS_SUSPEND;
+    *counters = PerfStats.sockets[sock];
+    NET_RTOS_RESUME;
+    ret = NET_OK;
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  Get the counters of a network interface, cumulated over all its sockets
+  * @param  pnetif [in] pointer to the network interface handle
+  * @param  counters [out] pointer to the structure to fill
+  * @retval zero in case of success, error code otherwise
+  */
+int32_t net_perf_get_netif_stats(const net_if_handle_t *pnetif, net_perf_counters_t *counters)
+{
+  int32_t ret = NET_ERROR_PARAMETER;
+
+  if ((pnetif != NULL) && (counters != NULL))
+  {
+    (void) memset(counters, 0, sizeof(*counters));
+    NET_RTOS_SUSPEND;
+    for (uint32_t i = 0U; i < NET_PERF_MAX_NETIF; i++)
+    {
+      if (PerfStats.netif_handle[i] == pnetif)
+      {
+        *counters = PerfStats.netifs[i];
+        break;
+      }
+    }
+    NET_RTOS_RESUME;
+    ret = NET_OK;
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  Get the latency histogram of an operation
+  * @param  op [in] operation type
+  * @param  histogram [out] pointer to the structure to fill
+  * @retval zero in case of success, error code otherwise
+  */
+int32_t net_perf_get_histogram(net_perf_op_t op, net_perf_histogram_t *histogram)
+{
+  int32_t ret = NET_ERROR_PARAMETER;
+
+  if ((op < NET_PERF_OP_NUMBER) && (histogram != NULL))
+  {
+    NET_RTOS_SUSPEND;
+    *histogram = PerfStats.histograms[op];
+    NET_RTOS_RESUME;
+    ret = NET_OK;
+  }
+  return ret;
+}
+
+
+static void net_perf_counters_print(const char_t *name, int32_t idx, const net_perf_counters_t *c)
+{
+  (void) printf("\t%s #%" PRId32 " sent %" PRIu32 " bytes / %" PRIu32 " calls, received %" PRIu32 " bytes / %" PRIu32
+                " calls, would block %" PRIu32 ", timeouts %" PRIu32 ", errors %" PRIu32 ", retransmits %" PRIu32 "\n",
+                name, idx, c->bytes_sent, c->send_calls, c->bytes_received, c->recv_calls,
+                c->would_block, c->timeouts, c->errors, c->retransmits);
+}
+
+
+/**
+  * @brief  Print the socket and network interface counters and the latency histograms
+  * @param  None
+  * @retval None
+  */
+void net_perf_stats_report(void)
+{
+  (void) printf("\n### Net Socket statistics report\n\n");
+
+  for (int32_t i = 0; i < (int32_t)NET_MAX_SOCKETS_NBR; i++)
+  {
+    const net_perf_counters_t *const c = &PerfStats.sockets[i];
+    if ((c->send_calls != 0U) || (c->recv_calls != 0U))
+    {
+      net_perf_counters_print("socket", i, c);
+    }
+  }
+
+  for (uint32_t i = 0U; i < NET_PERF_MAX_NETIF; i++)
+  {
+    if (PerfStats.netif_handle[i] != NULL)
+    {
+      net_perf_counters_print("netif ", (int32_t)i, &PerfStats.netifs[i]);
+    }
+  }
+
+  for (uint32_t op = 0U; op < (uint32_t)NET_PERF_OP_NUMBER; op++)
+  {
+    const net_perf_histogram_t *const h = &PerfStats.histograms[op];
+    if (h->count != 0U)
+    {
+      (void) printf("\n\t%s: %" PRIu32 " calls, min %" PRIu32 " us, max %" PRIu32 " us, average %" PRIu32 " us\n",
+                    PerfOpNames[op], h->count, h->min_us, h->max_us, h->total_us / h->count);
+      for (uint32_t i = 0U; i < NET_PERF_HISTOGRAM_SIZE; i++)
+      {
+        if (h->bucket[i] != 0U)
+        {
+          (void) printf("\t    histogram [ %8" PRIu32 "..%8" PRIu32 " us ] = %" PRIu32 "\n",
+                        (i > 0U) ? (uint32_t)(1UL << i) : 0U, (uint32_t)(1UL << (i + 1U)), h->bucket[i]);
+        }
+      }
+    }
+  }
+
+  (void) printf("\n### Net Socket statistics end report\n\n");
+}
+
+#endif /* NET_PERF_SOCKET_STATS */
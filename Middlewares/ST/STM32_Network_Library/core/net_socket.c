@@ -21,6 +21,7 @@
 #include "net_internals.h"
 #include "net_errors.h"
 #include "net_core.h"
+#include "net_perf.h"
 
 #include <inttypes.h>
 
@@ -36,6 +37,7 @@ static int32_t create_low_level_socket(int32_t sock);
 static int32_t check_low_level_socket(int32_t sock);
 static int32_t find_free_socket(void);
 static int32_t clone_socket(int32_t sock);
+static int32_t connect_socket(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen, bool async);
 
 static net_socket_t Sockets[NET_MAX_SOCKETS_NBR] = {0};
 
@@ -141,6 +143,9 @@ static int32_t find_free_socket(void)
       Sockets[sidx].blocking = true;
       Sockets[sidx].ulsocket = -1;
       Sockets[sidx].pnetif   = net_if_find(NULL);
+      Sockets[sidx].connect_cb = NULL;
+      Sockets[sidx].connect_cb_context = NULL;
+      NET_PERF_SOCKET_RESET(sidx);
 
       LOCK_SOCK(sidx);
       ret = sidx;
@@ -347,17 +352,23 @@ int32_t net_listen(int32_t sock, int32_t backlog)
 
 
 /**
-  * @brief  connect socket to a server
+  * @brief  connect socket to a server, common part of net_connect and net_connect_async
   * @param  sock [in] integer socket number
   * @param  addr [in] pointer to net_sockaddr_t structure of server
   * @param  addrlen [in] length of the server net_sockaddr_t
-  * @retval zero in case of success, non zero value in case of error
+  * @param  async [in] when true, the TLS handshake of a secure socket is left to net_connect_poll
+  * @retval zero in case of success, NET_ERROR_IN_PROGRESS if the handshake is pending, other negative value
+  *         in case of error
   */
-
-int32_t net_connect(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen)
+static int32_t connect_socket(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen, bool async)
 {
   int32_t ret = NET_ERROR_FRAMEWORK;
 
+#ifndef NET_MBEDTLS_HOST_SUPPORT
+  /* Without TLS the connection completes in the driver. */
+  (void) async;
+#endif /* NET_MBEDTLS_HOST_SUPPORT */
+
   if (!is_valid_socket(sock))
   {
     NET_DBG_ERROR("Invalid socket.\n");
@@ -367,84 +378,230 @@ int32_t net_connect(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen)
   {
     net_socket_t *const p_socket = net_socket_get_and_lock(sock);
 
-#if (NET_USE_DEFAULT_INTERFACE == 1)
-    if (p_socket->pnetif == NULL)
-    {
-      p_socket->pnetif = net_if_find(NULL);
-    }
-#endif /* NET_USE_DEFAULT_INTERFACE */
-
-    if (p_socket->pnetif == NULL)
+    if (p_socket->status == SOCKET_CONNECTING)
     {
-      ret = NET_ERROR_INTERFACE_FAILURE;
-      NET_DBG_ERROR("No physical interface can be bound.\n");
+      ret = NET_ERROR_ALREADY;
     }
     else
     {
-      if (create_low_level_socket(sock) < 0)
+#if (NET_USE_DEFAULT_INTERFACE == 1)
+      if (p_socket->pnetif == NULL)
       {
-        NET_DBG_ERROR("low level socket creation failed.\n");
-        if (create_low_level_socket(sock) < 0)
-        {
-          ret = NET_ERROR_SOCKET_FAILURE;
-        }
-        else
-        {
-          NET_DBG_ERROR("2nd try ok level socket creation success.\n");
+        p_socket->pnetif = net_if_find(NULL);
+      }
+#endif /* NET_USE_DEFAULT_INTERFACE */
 
-        }
+      if (p_socket->pnetif == NULL)
+      {
+        ret = NET_ERROR_INTERFACE_FAILURE;
+        NET_DBG_ERROR("No physical interface can be bound.\n");
       }
       else
       {
-        if (net_access_control(p_socket->pnetif, NET_ACCESS_CONNECT, &ret))
+        if (create_low_level_socket(sock) < 0)
         {
-          UNLOCK_SOCK(sock);
-          ret = p_socket->pnetif->pdrv->pconnect(p_socket->ulsocket, addr, addrlen);
-          LOCK_SOCK(sock);
-
-          if (ret != NET_OK)
+          NET_DBG_ERROR("low level socket creation failed.\n");
+          if (create_low_level_socket(sock) < 0)
           {
-            /* clear flag to avoid issue on clean up, mbedtls not started */
-#ifdef NET_MBEDTLS_HOST_SUPPORT
-            if ((p_socket->is_secure == true) && (p_socket->tlsData != NULL))
-            {
-              NET_FREE(p_socket->tlsData);
-            }
-            p_socket->is_secure = false;
-#endif /* NET_MBEDTLS_HOST_SUPPORT */
-            NET_DBG_ERROR("Connection cannot be established.\n");
+            ret = NET_ERROR_SOCKET_FAILURE;
+          }
+          else
+          {
+            NET_DBG_ERROR("2nd try ok level socket creation success.\n");
+
           }
         }
-      }
-      if (ret == NET_OK)
-      {
-#ifdef NET_MBEDTLS_HOST_SUPPORT
-        if (p_socket->is_secure)
+        else
         {
-          if (net_mbedtls_start(p_socket) != NET_OK)
+          if (net_access_control(p_socket->pnetif, NET_ACCESS_CONNECT, &ret))
           {
-            /* to avoid useless cleanup */
-            p_socket->is_secure = false;
+            const uint32_t t0 = NET_PERF_OP_START();
             UNLOCK_SOCK(sock);
-            (void) net_closesocket(sock);
+            ret = p_socket->pnetif->pdrv->pconnect(p_socket->ulsocket, addr, addrlen);
             LOCK_SOCK(sock);
-            ret = NET_ERROR_SOCKET_FAILURE;
-          }
-          else
-          {
-            p_socket->tls_started = true;
+            NET_PERF_OP_END(NET_PERF_OP_CONNECT, sock, p_socket->pnetif, ret, t0);
+
+            if (ret != NET_OK)
+            {
+              /* clear flag to avoid issue on clean up, mbedtls not started */
+#ifdef NET_MBEDTLS_HOST_SUPPORT
+              if ((p_socket->is_secure == true) && (p_socket->tlsData != NULL))
+              {
+                NET_FREE(p_socket->tlsData);
+              }
+              p_socket->is_secure = false;
+#endif /* NET_MBEDTLS_HOST_SUPPORT */
+              NET_DBG_ERROR("Connection cannot be established.\n");
+            }
           }
         }
-        if (NET_OK == ret)
+        if (ret == NET_OK)
         {
+#ifdef NET_MBEDTLS_HOST_SUPPORT
+          if (p_socket->is_secure)
+          {
+            if (async)
+            {
+              /* The BIO callbacks do not block while the socket is in the connecting state. */
+              p_socket->status = SOCKET_CONNECTING;
+              ret = net_mbedtls_start_async(p_socket);
+              p_socket->status = SOCKET_ALLOCATED;
+            }
+            else
+            {
+              ret = net_mbedtls_start(p_socket);
+            }
+
+            if (ret == NET_ERROR_IN_PROGRESS)
+            {
+              /* net_connect_poll steps the handshake, TLS resources are released on close */
+              p_socket->tls_started = true;
+              p_socket->status = SOCKET_CONNECTING;
+            }
+            else if (ret != NET_OK)
+            {
+              /* to avoid useless cleanup */
+              p_socket->is_secure = false;
+              UNLOCK_SOCK(sock);
+              (void) net_closesocket(sock);
+              LOCK_SOCK(sock);
+              ret = NET_ERROR_SOCKET_FAILURE;
+            }
+            else
+            {
+              p_socket->tls_started = true;
+            }
+          }
+          if (NET_OK == ret)
+          {
 #endif /* NET_MBEDTLS_HOST_SUPPORT */
-          p_socket->status = SOCKET_CONNECTED;
+            p_socket->status = SOCKET_CONNECTED;
 #ifdef NET_MBEDTLS_HOST_SUPPORT
-        }
+          }
 #endif /* NET_MBEDTLS_HOST_SUPPORT */
+        }
+      }
+    }
+    UNLOCK_SOCK(sock);
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  connect socket to a server
+  * @param  sock [in] integer socket number
+  * @param  addr [in] pointer to net_sockaddr_t structure of server
+  * @param  addrlen [in] length of the server net_sockaddr_t
+  * @retval zero in case of success, non zero value in case of error
+  */
+
+int32_t net_connect(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen)
+{
+  return connect_socket(sock, addr, addrlen, false);
+}
+
+
+/**
+  * @brief  connect socket to a server without waiting for the TLS handshake of a secure socket
+  *         The transport connection is performed by the driver, then the handshake is stepped by
+  *         net_connect_poll until it completes, each step returns as soon as no more data is available.
+  * @param  sock [in] integer socket number
+  * @param  addr [in] pointer to net_sockaddr_t structure of server
+  * @param  addrlen [in] length of the server net_sockaddr_t
+  * @param  callback [in] optional function called once by net_connect_poll when the connection completes or fails
+  * @param  context [in] user pointer passed to the callback
+  * @retval zero if the socket is already connected, NET_ERROR_IN_PROGRESS if net_connect_poll has to be called,
+  *         other negative value in case of error
+  */
+int32_t net_connect_async(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen, net_connect_cb_t callback,
+                          void *context)
+{
+  int32_t ret;
+
+  if (!is_valid_socket(sock))
+  {
+    NET_DBG_ERROR("Invalid socket.\n");
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    LOCK_SOCK(sock);
+    if (Sockets[sock].status != SOCKET_CONNECTING)
+    {
+      Sockets[sock].connect_cb = callback;
+      Sockets[sock].connect_cb_context = context;
+    }
+    UNLOCK_SOCK(sock);
+
+    ret = connect_socket(sock, addr, addrlen, true);
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  progress a connection started by net_connect_async, never blocks on the network
+  * @param  sock [in] integer socket number
+  * @retval zero when connected, NET_ERROR_IN_PROGRESS if it has to be called again, negative value in case
+  *         of error, the socket is then closed as with net_connect
+  */
+int32_t net_connect_poll(int32_t sock)
+{
+  int32_t ret;
+
+  if (!is_valid_socket(sock))
+  {
+    NET_DBG_ERROR("Invalid socket.\n");
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+    net_connect_cb_t callback = NULL;
+    void *context = p_socket->connect_cb_context;
+
+    if (p_socket->status == SOCKET_CONNECTED)
+    {
+      ret = NET_OK;
+    }
+#ifdef NET_MBEDTLS_HOST_SUPPORT
+    else if (p_socket->status == SOCKET_CONNECTING)
+    {
+      ret = net_mbedtls_handshake_step(p_socket);
+      if (ret == NET_OK)
+      {
+        p_socket->status = SOCKET_CONNECTED;
+        callback = p_socket->connect_cb;
+      }
+      else if (ret != NET_ERROR_IN_PROGRESS)
+      {
+        /* TLS resources already released by the failed step */
+        callback = p_socket->connect_cb;
+        p_socket->tls_started = false;
+        p_socket->is_secure = false;
+        p_socket->status = SOCKET_ALLOCATED;
+        UNLOCK_SOCK(sock);
+        (void) net_closesocket(sock);
+        LOCK_SOCK(sock);
+        ret = NET_ERROR_SOCKET_FAILURE;
+      }
+      else
+      {
+        /* Handshake still in progress. */
       }
     }
+#endif /* NET_MBEDTLS_HOST_SUPPORT */
+    else
+    {
+      ret = NET_ERROR_NO_CONNECTION;
+    }
     UNLOCK_SOCK(sock);
+
+    if (callback != NULL)
+    {
+      callback(sock, ret, context);
+    }
   }
   return ret;
 }
@@ -482,9 +639,15 @@ int32_t net_send(int32_t sock, const uint8_t *buf, uint32_t len, int32_t flags)
       else
       {
         net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+        const uint32_t t0 = NET_PERF_OP_START();
 
 #ifdef NET_MBEDTLS_HOST_SUPPORT
-        if (p_socket->is_secure)
+        if (p_socket->status == SOCKET_CONNECTING)
+        {
+          /* handshake started by net_connect_async not yet complete */
+          ret = NET_ERROR_IN_PROGRESS;
+        }
+        else if (p_socket->is_secure)
         {
           ret = (int32_t) net_mbedtls_sock_send(p_socket, buf, len);
         }
@@ -503,6 +666,7 @@ int32_t net_send(int32_t sock, const uint8_t *buf, uint32_t len, int32_t flags)
             }
           }
         }
+        NET_PERF_OP_END(NET_PERF_OP_SEND, sock, p_socket->pnetif, ret, t0);
         UNLOCK_SOCK(sock);
       }
     }
@@ -546,9 +710,15 @@ int32_t net_recv(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in)
       else
       {
         net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+        const uint32_t t0 = NET_PERF_OP_START();
 
 #ifdef NET_MBEDTLS_HOST_SUPPORT
-        if (p_socket->is_secure)
+        if (p_socket->status == SOCKET_CONNECTING)
+        {
+          /* handshake started by net_connect_async not yet complete */
+          ret = NET_ERROR_IN_PROGRESS;
+        }
+        else if (p_socket->is_secure)
         {
           ret = net_mbedtls_sock_recv(p_socket, buf, len);
         }
@@ -570,6 +740,7 @@ int32_t net_recv(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in)
             }
           }
         }
+        NET_PERF_OP_END(NET_PERF_OP_RECV, sock, p_socket->pnetif, ret, t0);
         UNLOCK_SOCK(sock);
       }
     }
@@ -613,6 +784,8 @@ int32_t net_sendto(int32_t sock, const uint8_t *buf, uint32_t len, int32_t flags
       else
       {
         net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+        const uint32_t t0 = NET_PERF_OP_START();
+
         if (net_access_control(p_socket->pnetif, NET_ACCESS_SENDTO, &ret))
         {
           UNLOCK_SOCK(sock);
@@ -623,6 +796,7 @@ int32_t net_sendto(int32_t sock, const uint8_t *buf, uint32_t len, int32_t flags
             NET_DBG_ERROR("Error during sending data.\n");
           }
         }
+        NET_PERF_OP_END(NET_PERF_OP_SEND, sock, p_socket->pnetif, ret, t0);
         UNLOCK_SOCK(sock);
       }
     }
@@ -667,6 +841,7 @@ int32_t net_recvfrom(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in,
       else
       {
         net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+        const uint32_t t0 = NET_PERF_OP_START();
         int32_t flags = flags_in;
 
         if (net_access_control(p_socket->pnetif, NET_ACCESS_RECVFROM, &ret))
@@ -683,6 +858,171 @@ int32_t net_recvfrom(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in,
             /* Common Error during receiving data. */
           }
         }
+        NET_PERF_OP_END(NET_PERF_OP_RECV, sock, p_socket->pnetif, ret, t0);
+        UNLOCK_SOCK(sock);
+      }
+    }
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  send a batch of datagrams, the socket is checked and locked once for the whole batch
+  * @param  sock [in] integer source socket number
+  * @param  msgs [in,out] array of datagram descriptors, result field is updated for each sent datagram
+  * @param  count [in] number of datagrams in the array
+  * @param  flags [in] specify blocking or non blocking, 0 is blocking mode, NET_MSG_DONTWAIT is non blocking
+  * @retval number of datagrams sent, negative value in case of error on the first datagram
+  */
+int32_t net_sendmmsg(int32_t sock, net_mmsg_t *msgs, uint32_t count, int32_t flags)
+{
+  int32_t ret = NET_ERROR_FRAMEWORK;
+
+  if (!is_valid_socket(sock))
+  {
+    NET_DBG_ERROR("Invalid socket.\n");
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    if ((msgs == NULL) || (count == 0U))
+    {
+      ret = NET_ERROR_PARAMETER;
+    }
+    else
+    {
+      if (create_low_level_socket(sock) < 0)
+      {
+        NET_DBG_ERROR("low level socket creation failed.\n");
+        ret = NET_ERROR_SOCKET_FAILURE;
+      }
+      else
+      {
+        net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+
+        if (net_access_control(p_socket->pnetif, NET_ACCESS_SENDTO, &ret))
+        {
+          uint32_t sent = 0U;
+
+          UNLOCK_SOCK(sock);
+          while (sent < count)
+          {
+            net_mmsg_t *const msg = &msgs[sent];
+            const uint32_t t0 = NET_PERF_OP_START();
+
+            if (msg->buf == NULL)
+            {
+              msg->result = NET_ERROR_PARAMETER;
+            }
+            else
+            {
+              msg->result = p_socket->pnetif->pdrv->psendto(p_socket->ulsocket, msg->buf, (int32_t)msg->len, flags,
+                                                            msg->addr, msg->addrlen);
+            }
+            NET_PERF_OP_END(NET_PERF_OP_SEND, sock, p_socket->pnetif, msg->result, t0);
+            if (msg->result <= 0)
+            {
+              break;
+            }
+            sent++;
+          }
+          LOCK_SOCK(sock);
+
+          if (sent > 0U)
+          {
+            ret = (int32_t)sent;
+          }
+          else
+          {
+            ret = msgs[0].result;
+            if ((ret < 0) && (ret != NET_ERROR_DISCONNECTED))
+            {
+              NET_DBG_ERROR("Error during sending data.\n");
+            }
+          }
+        }
+        UNLOCK_SOCK(sock);
+      }
+    }
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  receive a batch of datagrams, the socket is checked and locked once for the whole batch
+  * @param  sock [in] integer source socket number
+  * @param  msgs [in,out] array of datagram descriptors, result field is updated for each received datagram
+  * @param  count [in] number of datagrams in the array
+  * @param  flags_in [in] specify blocking or non blocking for the first datagram, 0 is blocking mode,
+  *         NET_MSG_DONTWAIT is non blocking, next datagrams are only read if already available
+  * @retval number of datagrams received, negative value in case of error or timeout on the first datagram
+  */
+int32_t net_recvmmsg(int32_t sock, net_mmsg_t *msgs, uint32_t count, int32_t flags_in)
+{
+  int32_t ret = NET_ERROR_FRAMEWORK;
+
+  if (!is_valid_socket(sock))
+  {
+    NET_DBG_ERROR("Invalid socket.\n");
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    if ((msgs == NULL) || (count == 0U))
+    {
+      ret = NET_ERROR_PARAMETER;
+    }
+    else
+    {
+      if (create_low_level_socket(sock) < 0)
+      {
+        NET_DBG_ERROR("low level socket creation failed.\n");
+        ret = NET_ERROR_SOCKET_FAILURE;
+      }
+      else
+      {
+        net_socket_t *const p_socket = net_socket_get_and_lock(sock);
+        int32_t flags = flags_in;
+
+        if (net_access_control(p_socket->pnetif, NET_ACCESS_RECVFROM, &ret))
+        {
+          uint32_t received = 0U;
+
+          UNLOCK_SOCK(sock);
+          if (p_socket->read_timeout == 0)
+          {
+            flags = (int8_t) NET_MSG_DONTWAIT;
+          }
+          while (received < count)
+          {
+            net_mmsg_t *const msg = &msgs[received];
+            const uint32_t t0 = NET_PERF_OP_START();
+
+            if (msg->buf == NULL)
+            {
+              msg->result = NET_ERROR_PARAMETER;
+            }
+            else
+            {
+              msg->result = p_socket->pnetif->pdrv->precvfrom(p_socket->ulsocket, msg->buf, (int32_t)msg->len, flags,
+                                                              msg->addr, &msg->addrlen);
+            }
+            NET_PERF_OP_END(NET_PERF_OP_RECV, sock, p_socket->pnetif, msg->result, t0);
+            if (msg->result <= 0)
+            {
+              break;
+            }
+            received++;
+
+            /* Only wait for the first datagram. */
+            flags = (int8_t) NET_MSG_DONTWAIT;
+          }
+          LOCK_SOCK(sock);
+
+          ret = (received > 0U) ? (int32_t)received : msgs[0].result;
+        }
         UNLOCK_SOCK(sock);
       }
     }
@@ -716,6 +1056,8 @@ int32_t net_shutdown(int32_t sock, int32_t mode)
       if (p_socket->tls_started)
       {
         p_socket->tls_started = false;
+        /* a pending asynchronous handshake is given up */
+        p_socket->status = (p_socket->status == SOCKET_CONNECTING) ? SOCKET_ALLOCATED : p_socket->status;
         (void) net_mbedtls_stop(p_socket);
       }
       p_socket->is_secure = false;
@@ -773,6 +1115,8 @@ int32_t net_closesocket(int32_t sock)
       if (p_socket->tls_started)
       {
         p_socket->tls_started = false;
+        /* a pending asynchronous handshake is given up */
+        p_socket->status = (p_socket->status == SOCKET_CONNECTING) ? SOCKET_ALLOCATED : p_socket->status;
         (void) net_mbedtls_stop(p_socket);
       }
       p_socket->is_secure = false;
@@ -0,0 +1,952 @@
+/**
+  ******************************************************************************
+  * @file    net_loopback_driver.c
+  * @author  MCD Application Team
+  * @brief   Loopback network interface, sockets are connected through memory pipes
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "net_connect.h"
+#include "net_internals.h"
+#include "net_perf.h"
+
+/*
+ * The loopback interface does not need any hardware: every address resolves to the interface
+ * itself and a connected socket is a pair of memory pipes. It allows to run the network library,
+ * and what is built on top of it, off-target (see NET_USE_POSIX_OS) to measure the socket layer
+ * throughput and latency, or to test the application protocols.
+ */
+
+#ifndef NET_LOOPBACK_MAX_SOCKETS
+#define NET_LOOPBACK_MAX_SOCKETS        (2U * NET_MAX_SOCKETS_NBR)
+#endif /* NET_LOOPBACK_MAX_SOCKETS */
+
+/* Size of the receive pipe of each socket. */
+#ifndef NET_LOOPBACK_BUFFER_SIZE
+#define NET_LOOPBACK_BUFFER_SIZE        4096U
+#endif /* NET_LOOPBACK_BUFFER_SIZE */
+
+#ifndef NET_LOOPBACK_BACKLOG
+#define NET_LOOPBACK_BACKLOG            4U
+#endif /* NET_LOOPBACK_BACKLOG */
+
+#define NET_LOOPBACK_FIRST_EPHEMERAL_PORT  49152U
+
+/* Each datagram is stored in the pipe with a header: length (2 bytes) and source port (2 bytes). */
+#define NET_LOOPBACK_DGRAM_HEADER_SIZE     4U
+
+typedef enum
+{
+  LOOPBACK_SOCK_FREE = 0,
+  LOOPBACK_SOCK_CREATED,
+  LOOPBACK_SOCK_LISTENING,
+  LOOPBACK_SOCK_CONNECTED,
+  LOOPBACK_SOCK_PEER_CLOSED
+} loopback_sock_state_t;
+
+typedef struct
+{
+  uint32_t rd;
+  uint32_t wr;
+  uint8_t  data[NET_LOOPBACK_BUFFER_SIZE];
+} loopback_pipe_t;
+
+typedef struct
+{
+  loopback_sock_state_t state;
+  int32_t               type;
+  uint16_t              port;
+  uint16_t              peer_port;
+  int32_t               peer;
+  int32_t               recv_timeout;
+  int32_t               send_timeout;
+  bool                  blocking;
+  bool                  shut_rd;
+  bool                  shut_wr;
+  uint32_t              backlog_max;
+  uint32_t              backlog_count;
+  int32_t               backlog[NET_LOOPBACK_BACKLOG];
+  loopback_pipe_t       rx;
+} loopback_socket_t;
+
+static loopback_socket_t LoopbackSockets[NET_LOOPBACK_MAX_SOCKETS];
+static uint16_t LoopbackNextPort = (uint16_t)NET_LOOPBACK_FIRST_EPHEMERAL_PORT;
+
+/* global constructor of the loopback network interface */
+int32_t loopback_net_driver(net_if_handle_t *pnetif);
+
+static int32_t loopback_if_init(net_if_handle_t *pnetif);
+static int32_t loopback_if_deinit(net_if_handle_t *pnetif);
+static int32_t loopback_if_start(net_if_handle_t *pnetif);
+static int32_t loopback_if_stop(net_if_handle_t *pnetif);
+static int32_t loopback_if_yield(net_if_handle_t *pnetif, uint32_t timeout);
+static int32_t loopback_if_connect(net_if_handle_t *pnetif);
+static int32_t loopback_if_disconnect(net_if_handle_t *pnetif);
+
+static int32_t loopback_socket(int32_t domain, int32_t type, int32_t protocol);
+static int32_t loopback_bind(int32_t sock, const net_sockaddr_t *addr, uint32_t addrlen);
+static int32_t loopback_listen(int32_t sock, int32_t backlog);
+static int32_t loopback_accept(int32_t sock, net_sockaddr_t *addr, uint32_t *addrlen);
+static int32_t loopback_connect(int32_t sock, const net_sockaddr_t *addr, uint32_t addrlen);
+static int32_t loopback_send(int32_t sock, const uint8_t *buf, int32_t len, int32_t flags);
+static int32_t loopback_recv(int32_t sock, uint8_t *buf, int32_t len, int32_t flags);
+static int32_t loopback_sendto(int32_t sock, const uint8_t *buf, int32_t len, int32_t flags,
+                               net_sockaddr_t *to, uint32_t tolen);
+static int32_t loopback_recvfrom(int32_t sock, uint8_t *buf, int32_t len, int32_t flags,
+                                 net_sockaddr_t *from, uint32_t *fromlen);
+static int32_t loopback_setsockopt(int32_t sock, int32_t level, int32_t optname, const void *optvalue,
+                                   uint32_t optlen);
+static int32_t loopback_getsockopt(int32_t sock, int32_t level, int32_t optname, void *optvalue, uint32_t *optlen);
+static int32_t loopback_getsockname(int32_t sock, net_sockaddr_t *name, uint32_t *namelen);
+static int32_t loopback_getpeername(int32_t sock, net_sockaddr_t *name, uint32_t *namelen);
+static int32_t loopback_close(int32_t sock, bool isaclone);
+static int32_t loopback_shutdown(int32_t sock, int32_t mode);
+static int32_t loopback_gethostbyname(net_if_handle_t *pnetif, net_sockaddr_t *addr, char_t *name);
+static int32_t loopback_ping(net_if_handle_t *pnetif, net_sockaddr_t *addr, int32_t count, int32_t delay,
+                             int32_t response[]);
+
+
+static bool is_valid_loopback_socket(int32_t sock)
+{
+  return (sock >= 0) && (sock < (int32_t)NET_LOOPBACK_MAX_SOCKETS)
+         && (LoopbackSockets[sock].state != LOOPBACK_SOCK_FREE);
+}
+
+
+static uint32_t pipe_used(const loopback_pipe_t *pipe)
+{
+  return pipe->wr - pipe->rd;
+}
+
+
+static uint32_t pipe_free(const loopback_pipe_t *pipe)
+{
+  return NET_LOOPBACK_BUFFER_SIZE - pipe_used(pipe);
+}
+
+
+static void pipe_write(loopback_pipe_t *pipe, const uint8_t *buf, uint32_t len)
+{
+  const uint32_t offset = pipe->wr % NET_LOOPBACK_BUFFER_SIZE;
+  const uint32_t first = ((NET_LOOPBACK_BUFFER_SIZE - offset) < len) ? (NET_LOOPBACK_BUFFER_SIZE - offset) : len;
+
+  (void) memcpy(&pipe->data[offset], buf, first);
+  (void) memcpy(&pipe->data[0], &buf[first], len - first);
+  pipe->wr += len;
+}
+
+
+static void pipe_read(loopback_pipe_t *pipe, uint8_t *buf, uint32_t len)
+{
+  const uint32_t offset = pipe->rd % NET_LOOPBACK_BUFFER_SIZE;
+  const uint32_t first = ((NET_LOOPBACK_BUFFER_SIZE - offset) < len) ? (NET_LOOPBACK_BUFFER_SIZE - offset) : len;
+
+  if (buf != NULL)
+  {
+    (void) memcpy(buf, &pipe->data[offset], first);
+    (void) memcpy(&buf[first], &pipe->data[0], len - first);
+  }
+  pipe->rd += len;
+}
+
+
+static int32_t find_free_loopback_socket(void)
+{
+  int32_t ret = NET_ERROR_OUT_OF_SOCKET;
+
+  for (int32_t i = 0; i < (int32_t)NET_LOOPBACK_MAX_SOCKETS; i++)
+  {
+    if (LoopbackSockets[i].state == LOOPBACK_SOCK_FREE)
+    {
+      (void) memset(&LoopbackSockets[i], 0, sizeof(LoopbackSockets[i]));
+      LoopbackSockets[i].state = LOOPBACK_SOCK_CREATED;
+      LoopbackSockets[i].peer = -1;
+      LoopbackSockets[i].recv_timeout = NET_SOCK_DEFAULT_RECEIVE_TO;
+      LoopbackSockets[i].send_timeout = NET_SOCK_DEFAULT_SEND_TO;
+      LoopbackSockets[i].blocking = true;
+      ret = i;
+      break;
+    }
+  }
+  return ret;
+}
+
+
+static int32_t find_bound_socket(int32_t type, uint16_t port, loopback_sock_state_t state)
+{
+  int32_t ret = -1;
+
+  for (int32_t i = 0; i < (int32_t)NET_LOOPBACK_MAX_SOCKETS; i++)
+  {
+    if ((LoopbackSockets[i].state == state) && (LoopbackSockets[i].type == type) && (LoopbackSockets[i].port == port))
+    {
+      ret = i;
+      break;
+    }
+  }
+  return ret;
+}
+
+
+static uint16_t get_ephemeral_port(void)
+{
+  const uint16_t port = LoopbackNextPort;
+
+  LoopbackNextPort = (LoopbackNextPort == 0xFFFFU) ? (uint16_t)NET_LOOPBACK_FIRST_EPHEMERAL_PORT :
+                     (uint16_t)(LoopbackNextPort + 1U);
+  return port;
+}
+
+
+static void set_loopback_sockaddr(net_sockaddr_t *addr, uint32_t *addrlen, uint16_t port)
+{
+  if ((addr != NULL) && (addrlen != NULL) && (*addrlen >= sizeof(net_sockaddr_in_t)))
+  {
+    const net_ip_addr_t ipaddr = NET_IPADDR4_INIT(NET_PP_HTONL(NET_IPADDR_LOOPBACK));
+    NET_IPADDR_PORT_TO_SOCKADDR(addr, &ipaddr, port);
+    *addrlen = sizeof(net_sockaddr_in_t);
+  }
+}
+
+
+/* Wait for a condition to be reached, another task or the peer side of the pipe is expected to make progress. */
+/* Without RTOS, the caller is the only thread that could make progress: a blocking call then fails at once,   */
+/* as when its timeout expires, instead of spinning until the timeout.                                          */
+static bool loopback_wait(uint32_t start, int32_t timeout, bool dontwait)
+{
+  bool ret = false;
+
+#ifdef NET_USE_RTOS
+  if ((!dontwait) && (timeout != 0) && ((NET_TICK() - start) < (uint32_t)timeout))
+  {
+    (void) osDelay(1U);
+    ret = true;
+  }
+#else
+  (void) start;
+  (void) timeout;
+  (void) dontwait;
+#endif /* NET_USE_RTOS */
+  return ret;
+}
+
+
+/**
+  * @brief  Loopback network interface constructor, to be passed to net_if_init()
+  * @param  pnetif [in] pointer to the network interface handle
+  * @retval zero in case of success, error code otherwise
+  */
+int32_t loopback_net_driver(net_if_handle_t *pnetif)
+{
+  return loopback_if_init(pnetif);
+}
+
+
+static int32_t loopback_if_init(net_if_handle_t *pnetif)
+{
+  int32_t ret;
+  net_if_drv_t *const p = NET_MALLOC(sizeof(*p));
+
+  if (p != NULL)
+  {
+    (void) memset(p, 0, sizeof(*p));
+    p->if_class = NET_INTERFACE_CLASS_CUSTOM;
+    p->if_init = loopback_if_init;
+    p->if_deinit = loopback_if_deinit;
+    p->if_start = loopback_if_start;
+    p->if_stop = loopback_if_stop;
+    p->if_yield = loopback_if_yield;
+    p->if_connect = loopback_if_connect;
+    p->if_disconnect = loopback_if_disconnect;
+    p->psocket = loopback_socket;
+    p->pbind = loopback_bind;
+    p->plisten = loopback_listen;
+    p->paccept = loopback_accept;
+    p->pconnect = loopback_connect;
+    p->psend = loopback_send;
+    p->precv = loopback_recv;
+    p->psendto = loopback_sendto;
+    p->precvfrom = loopback_recvfrom;
+    p->psetsockopt = loopback_setsockopt;
+    p->pgetsockopt = loopback_getsockopt;
+    p->pgetsockname = loopback_getsockname;
+    p->pgetpeername = loopback_getpeername;
+    p->pclose = loopback_close;
+    p->pshutdown = loopback_shutdown;
+    p->pgethostbyname = loopback_gethostbyname;
+    p->pping = loopback_ping;
+    pnetif->pdrv = p;
+
+    (void) memset(LoopbackSockets, 0, sizeof(LoopbackSockets));
+    (void) strncpy(pnetif->DeviceName, "Loopback IF", sizeof(pnetif->DeviceName));
+    (void) strncpy(pnetif->DeviceID, "lo", sizeof(pnetif->DeviceID));
+    (void) strncpy(pnetif->DeviceVer, "1.0", sizeof(pnetif->DeviceVer));
+
+    (void) net_state_manage_event(pnetif, NET_EVENT_INTERFACE_INITIALIZED);
+    ret = NET_OK;
+  }
+  else
+  {
+    NET_DBG_ERROR("Can't allocate memory for loopback driver class\n");
+    ret = NET_ERROR_NO_MEMORY;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_if_deinit(net_if_handle_t *pnetif)
+{
+  NET_FREE(pnetif->pdrv);
+  pnetif->pdrv = NULL;
+  return NET_OK;
+}
+
+
+static int32_t loopback_if_start(net_if_handle_t *pnetif)
+{
+  (void) net_state_manage_event(pnetif, NET_EVENT_INTERFACE_READY);
+  return NET_OK;
+}
+
+
+static int32_t loopback_if_stop(net_if_handle_t *pnetif)
+{
+  (void) net_state_manage_event(pnetif, NET_EVENT_INTERFACE_INITIALIZED);
+  return NET_OK;
+}
+
+
+static int32_t loopback_if_yield(net_if_handle_t *pnetif, uint32_t timeout)
+{
+  (void) pnetif;
+  (void) timeout;
+  return NET_OK;
+}
+
+
+static int32_t loopback_if_connect(net_if_handle_t *pnetif)
+{
+  const net_ip_addr_t ipaddr = NET_IPADDR4_INIT(NET_PP_HTONL(NET_IPADDR_LOOPBACK));
+  const net_ip_addr_t netmask = NET_IPADDR4_INIT(NET_PP_HTONL(0xFF000000UL));
+
+  pnetif->ipaddr = ipaddr;
+  pnetif->gateway = ipaddr;
+  pnetif->netmask = netmask;
+  (void) net_state_manage_event(pnetif, NET_EVENT_IPADDR);
+  return NET_OK;
+}
+
+
+static int32_t loopback_if_disconnect(net_if_handle_t *pnetif)
+{
+  (void) net_state_manage_event(pnetif, NET_EVENT_INTERFACE_READY);
+  return NET_OK;
+}
+
+
+static int32_t loopback_socket(int32_t domain, int32_t type, int32_t protocol)
+{
+  int32_t ret;
+
+  (void) protocol;
+
+  if ((domain != NET_AF_INET) || ((type != NET_SOCK_STREAM) && (type != NET_SOCK_DGRAM)))
+  {
+    ret = NET_ERROR_UNSUPPORTED;
+  }
+  else
+  {
+    NET_RTOS_SUSPEND;
+    ret = find_free_loopback_socket();
+    if (ret >= 0)
+    {
+      LoopbackSockets[ret].type = type;
+    }
+    NET_RTOS_RESUME;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_bind(int32_t sock, const net_sockaddr_t *addr, uint32_t addrlen)
+{
+  int32_t ret = NET_OK;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if ((addr == NULL) || (addrlen < sizeof(net_sockaddr_in_t)))
+  {
+    ret = NET_ERROR_PARAMETER;
+  }
+  else
+  {
+    uint16_t port = net_get_port(addr);
+
+    NET_RTOS_SUSPEND;
+    if (port == 0U)
+    {
+      port = get_ephemeral_port();
+    }
+    if ((find_bound_socket(LoopbackSockets[sock].type, port, LOOPBACK_SOCK_CREATED) >= 0)
+        || (find_bound_socket(LoopbackSockets[sock].type, port, LOOPBACK_SOCK_LISTENING) >= 0))
+    {
+      ret = NET_ERROR_SOCKET_FAILURE;
+    }
+    else
+    {
+      LoopbackSockets[sock].port = port;
+    }
+    NET_RTOS_RESUME;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_listen(int32_t sock, int32_t backlog)
+{
+  int32_t ret = NET_OK;
+
+  if (!is_valid_loopback_socket(sock) || (LoopbackSockets[sock].type != NET_SOCK_STREAM))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+
+    p->backlog_max = ((backlog <= 0) || ((uint32_t)backlog > NET_LOOPBACK_BACKLOG)) ?
+                     NET_LOOPBACK_BACKLOG : (uint32_t)backlog;
+    p->state = LOOPBACK_SOCK_LISTENING;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_accept(int32_t sock, net_sockaddr_t *addr, uint32_t *addrlen)
+{
+  int32_t ret = NET_TIMEOUT;
+
+  if (!is_valid_loopback_socket(sock) || (LoopbackSockets[sock].state != LOOPBACK_SOCK_LISTENING))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+    const uint32_t start = NET_TICK();
+
+    do
+    {
+      NET_RTOS_SUSPEND;
+      if (p->backlog_count > 0U)
+      {
+        ret = p->backlog[0];
+        p->backlog_count--;
+        (void) memmove(&p->backlog[0], &p->backlog[1], p->backlog_count * sizeof(p->backlog[0]));
+      }
+      NET_RTOS_RESUME;
+    } while ((ret < 0) && loopback_wait(start, p->recv_timeout, !p->blocking));
+
+    if (ret >= 0)
+    {
+      set_loopback_sockaddr(addr, addrlen, LoopbackSockets[ret].peer_port);
+    }
+  }
+  return ret;
+}
+
+
+static int32_t loopback_connect(int32_t sock, const net_sockaddr_t *addr, uint32_t addrlen)
+{
+  int32_t ret = NET_OK;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if ((addr == NULL) || (addrlen < sizeof(net_sockaddr_in_t)))
+  {
+    ret = NET_ERROR_PARAMETER;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+    const uint16_t port = net_get_port(addr);
+
+    NET_RTOS_SUSPEND;
+    if (p->port == 0U)
+    {
+      p->port = get_ephemeral_port();
+    }
+    p->peer_port = port;
+
+    if (p->type == NET_SOCK_STREAM)
+    {
+      const int32_t listener = find_bound_socket(NET_SOCK_STREAM, port, LOOPBACK_SOCK_LISTENING);
+
+      if ((listener < 0) || (LoopbackSockets[listener].backlog_count >= LoopbackSockets[listener].backlog_max))
+      {
+        /* Connection refused. */
+        ret = NET_ERROR_NO_CONNECTION;
+      }
+      else
+      {
+        const int32_t server = find_free_loopback_socket();
+
+        if (server < 0)
+        {
+          ret = server;
+        }
+        else
+        {
+          loopback_socket_t *const s = &LoopbackSockets[server];
+
+          s->type = NET_SOCK_STREAM;
+          s->port = port;
+          s->peer_port = p->port;
+          s->peer = sock;
+          s->state = LOOPBACK_SOCK_CONNECTED;
+          p->peer = server;
+          p->state = LOOPBACK_SOCK_CONNECTED;
+          LoopbackSockets[listener].backlog[LoopbackSockets[listener].backlog_count] = server;
+          LoopbackSockets[listener].backlog_count++;
+        }
+      }
+    }
+    NET_RTOS_RESUME;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_send(int32_t sock, const uint8_t *buf, int32_t len, int32_t flags)
+{
+  int32_t ret = 0;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if (LoopbackSockets[sock].type == NET_SOCK_DGRAM)
+  {
+    net_sockaddr_in_t to = {0};
+    const net_ip_addr_t ipaddr = NET_IPADDR4_INIT(NET_PP_HTONL(NET_IPADDR_LOOPBACK));
+
+    NET_IPADDR_PORT_TO_SOCKADDR(&to, &ipaddr, LoopbackSockets[sock].peer_port);
+    ret = loopback_sendto(sock, buf, len, flags, (net_sockaddr_t *)&to, sizeof(to));
+  }
+  else if ((LoopbackSockets[sock].state != LOOPBACK_SOCK_CONNECTED) || LoopbackSockets[sock].shut_wr)
+  {
+    ret = NET_ERROR_DISCONNECTED;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+    const bool dontwait = (flags == (int32_t)NET_MSG_DONTWAIT) || !p->blocking;
+    const uint32_t start = NET_TICK();
+
+    do
+    {
+      NET_RTOS_SUSPEND;
+      if ((p->state != LOOPBACK_SOCK_CONNECTED) || (p->peer < 0))
+      {
+        ret = NET_ERROR_DISCONNECTED;
+      }
+      else
+      {
+        loopback_pipe_t *const pipe = &LoopbackSockets[p->peer].rx;
+        const uint32_t room = pipe_free(pipe);
+        const uint32_t n = (room < (uint32_t)len) ? room : (uint32_t)len;
+
+        pipe_write(pipe, buf, n);
+        ret = (int32_t)n;
+      }
+      NET_RTOS_RESUME;
+    } while ((ret == 0) && (len > 0) && loopback_wait(start, p->send_timeout, dontwait));
+
+    if ((ret == 0) && (len > 0) && (!dontwait))
+    {
+      ret = NET_TIMEOUT;
+    }
+  }
+  return ret;
+}
+
+
+static int32_t loopback_recv(int32_t sock, uint8_t *buf, int32_t len, int32_t flags)
+{
+  int32_t ret = 0;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if (LoopbackSockets[sock].type == NET_SOCK_DGRAM)
+  {
+    ret = loopback_recvfrom(sock, buf, len, flags, NULL, NULL);
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+    const bool dontwait = (flags == (int32_t)NET_MSG_DONTWAIT) || !p->blocking;
+    const uint32_t start = NET_TICK();
+    bool closed = false;
+
+    do
+    {
+      NET_RTOS_SUSPEND;
+      {
+        const uint32_t used = pipe_used(&p->rx);
+        const uint32_t n = (used < (uint32_t)len) ? used : (uint32_t)len;
+
+        pipe_read(&p->rx, buf, n);
+        ret = (int32_t)n;
+        closed = (p->state != LOOPBACK_SOCK_CONNECTED) || p->shut_rd;
+      }
+      NET_RTOS_RESUME;
+    } while ((ret == 0) && (len > 0) && (!closed) && loopback_wait(start, p->recv_timeout, dontwait));
+
+    if ((ret == 0) && (len > 0))
+    {
+      if (closed)
+      {
+        ret = NET_ERROR_DISCONNECTED;
+      }
+      else if (!dontwait)
+      {
+        ret = NET_TIMEOUT;
+      }
+      else
+      {
+        /* Nothing available, MISRA checks */
+      }
+    }
+  }
+  return ret;
+}
+
+
+static int32_t loopback_sendto(int32_t sock, const uint8_t *buf, int32_t len, int32_t flags,
+                               net_sockaddr_t *to, uint32_t tolen)
+{
+  int32_t ret;
+
+  (void) flags;
+
+  if (!is_valid_loopback_socket(sock) || (LoopbackSockets[sock].type != NET_SOCK_DGRAM))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if ((to == NULL) || (tolen < sizeof(net_sockaddr_in_t)) || (len < 0) || (len > 0xFFFF))
+  {
+    ret = NET_ERROR_PARAMETER;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+
+    NET_RTOS_SUSPEND;
+    {
+      const int32_t dest = find_bound_socket(NET_SOCK_DGRAM, net_get_port(to), LOOPBACK_SOCK_CREATED);
+
+      if (p->port == 0U)
+      {
+        p->port = get_ephemeral_port();
+      }
+
+      /* As on a real network, a datagram without receiver or room is silently dropped. */
+      if ((dest >= 0)
+          && (pipe_free(&LoopbackSockets[dest].rx) >= ((uint32_t)len + NET_LOOPBACK_DGRAM_HEADER_SIZE)))
+      {
+        const uint8_t header[NET_LOOPBACK_DGRAM_HEADER_SIZE] =
+        {
+          (uint8_t)((uint32_t)len >> 8), (uint8_t)len, (uint8_t)(p->port >> 8), (uint8_t)p->port
+        };
+        pipe_write(&LoopbackSockets[dest].rx, header, sizeof(header));
+        pipe_write(&LoopbackSockets[dest].rx, buf, (uint32_t)len);
+      }
+      ret = len;
+    }
+    NET_RTOS_RESUME;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_recvfrom(int32_t sock, uint8_t *buf, int32_t len, int32_t flags,
+                                 net_sockaddr_t *from, uint32_t *fromlen)
+{
+  int32_t ret = 0;
+
+  if (!is_valid_loopback_socket(sock) || (LoopbackSockets[sock].type != NET_SOCK_DGRAM))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+    const bool dontwait = (flags == (int32_t)NET_MSG_DONTWAIT) || !p->blocking;
+    const uint32_t start = NET_TICK();
+    bool received = false;
+
+    do
+    {
+      NET_RTOS_SUSPEND;
+      if (pipe_used(&p->rx) >= NET_LOOPBACK_DGRAM_HEADER_SIZE)
+      {
+        uint8_t header[NET_LOOPBACK_DGRAM_HEADER_SIZE];
+        uint32_t dgram_len;
+        uint32_t n;
+
+        pipe_read(&p->rx, header, sizeof(header));
+        dgram_len = ((uint32_t)header[0] << 8) | header[1];
+        n = (dgram_len < (uint32_t)len) ? dgram_len : (uint32_t)len;
+        pipe_read(&p->rx, buf, n);
+        /* Datagram is truncated to the size of the user buffer. */
+        pipe_read(&p->rx, NULL, dgram_len - n);
+        set_loopback_sockaddr(from, fromlen, (uint16_t)(((uint32_t)header[2] << 8) | header[3]));
+        ret = (int32_t)n;
+        received = true;
+      }
+      NET_RTOS_RESUME;
+    } while ((!received) && loopback_wait(start, p->recv_timeout, dontwait));
+
+    if ((!received) && (!dontwait))
+    {
+      ret = NET_TIMEOUT;
+    }
+  }
+  return ret;
+}
+
+
+static int32_t loopback_setsockopt(int32_t sock, int32_t level, int32_t optname, const void *optvalue,
+                                   uint32_t optlen)
+{
+  int32_t ret = NET_OK;
+
+  (void) level;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    switch (optname)
+    {
+      case (int32_t)NET_SO_RCVTIMEO:
+        if (optlen < sizeof(int32_t))
+        {
+          ret = NET_ERROR_PARAMETER;
+        }
+        else
+        {
+          LoopbackSockets[sock].recv_timeout = *(const int32_t *)optvalue;
+        }
+        break;
+
+      case (int32_t)NET_SO_SNDTIMEO:
+        if (optlen < sizeof(int32_t))
+        {
+          ret = NET_ERROR_PARAMETER;
+        }
+        else
+        {
+          LoopbackSockets[sock].send_timeout = *(const int32_t *)optvalue;
+        }
+        break;
+
+      case (int32_t)NET_SO_BLOCKING:
+        if (optlen < sizeof(bool))
+        {
+          ret = NET_ERROR_PARAMETER;
+        }
+        else
+        {
+          LoopbackSockets[sock].blocking = *(const bool *)optvalue;
+        }
+        break;
+
+      default:
+        /* Other options have no meaning on a loopback interface. */
+        break;
+    }
+  }
+  return ret;
+}
+
+
+static int32_t loopback_getsockopt(int32_t sock, int32_t level, int32_t optname, void *optvalue, uint32_t *optlen)
+{
+  (void) sock;
+  (void) level;
+  (void) optname;
+  (void) optvalue;
+  (void) optlen;
+
+  return NET_ERROR_UNSUPPORTED;
+}
+
+
+static int32_t loopback_getsockname(int32_t sock, net_sockaddr_t *name, uint32_t *namelen)
+{
+  int32_t ret = NET_OK;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if ((namelen == NULL) || (*namelen < sizeof(net_sockaddr_in_t)))
+  {
+    ret = NET_ERROR_PARAMETER;
+  }
+  else
+  {
+    set_loopback_sockaddr(name, namelen, LoopbackSockets[sock].port);
+  }
+  return ret;
+}
+
+
+static int32_t loopback_getpeername(int32_t sock, net_sockaddr_t *name, uint32_t *namelen)
+{
+  int32_t ret = NET_OK;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else if ((namelen == NULL) || (*namelen < sizeof(net_sockaddr_in_t)))
+  {
+    ret = NET_ERROR_PARAMETER;
+  }
+  else if (LoopbackSockets[sock].peer_port == 0U)
+  {
+    ret = NET_ERROR_NO_CONNECTION;
+  }
+  else
+  {
+    set_loopback_sockaddr(name, namelen, LoopbackSockets[sock].peer_port);
+  }
+  return ret;
+}
+
+
+static int32_t loopback_close(int32_t sock, bool isaclone)
+{
+  int32_t ret = NET_OK;
+
+  (void) isaclone;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+
+    NET_RTOS_SUSPEND;
+    if (p->peer >= 0)
+    {
+      LoopbackSockets[p->peer].state = LOOPBACK_SOCK_PEER_CLOSED;
+      LoopbackSockets[p->peer].peer = -1;
+    }
+    /* Pending connections that were never accepted are closed as well. */
+    for (uint32_t i = 0U; i < p->backlog_count; i++)
+    {
+      const int32_t pending = p->backlog[i];
+      const int32_t client = LoopbackSockets[pending].peer;
+
+      if (client >= 0)
+      {
+        LoopbackSockets[client].state = LOOPBACK_SOCK_PEER_CLOSED;
+        LoopbackSockets[client].peer = -1;
+      }
+      LoopbackSockets[pending].state = LOOPBACK_SOCK_FREE;
+    }
+    p->state = LOOPBACK_SOCK_FREE;
+    NET_RTOS_RESUME;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_shutdown(int32_t sock, int32_t mode)
+{
+  int32_t ret = NET_OK;
+
+  if (!is_valid_loopback_socket(sock))
+  {
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    loopback_socket_t *const p = &LoopbackSockets[sock];
+
+    NET_RTOS_SUSPEND;
+    if ((mode == NET_SHUTDOWN_R) || (mode == NET_SHUTDOWN_RW))
+    {
+      p->shut_rd = true;
+    }
+    if ((mode == NET_SHUTDOWN_W) || (mode == NET_SHUTDOWN_RW))
+    {
+      p->shut_wr = true;
+      if (p->peer >= 0)
+      {
+        /* The peer reads the end of the stream. */
+        LoopbackSockets[p->peer].shut_rd = true;
+      }
+    }
+    NET_RTOS_RESUME;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_gethostbyname(net_if_handle_t *pnetif, net_sockaddr_t *addr, char_t *name)
+{
+  int32_t ret = NET_ERROR_PARAMETER;
+
+  (void) pnetif;
+  (void) name;
+
+  if ((addr != NULL) && (sizeof(net_sockaddr_in_t) <= addr->sa_len))
+  {
+    /* Every host name resolves to the loopback interface. */
+    net_sockaddr_in_t *const s_addr_in = (net_sockaddr_in_t *)(void *)addr;
+    s_addr_in->sin_family = NET_AF_INET;
+    s_addr_in->sin_addr.s_addr = NET_PP_HTONL(NET_IPADDR_LOOPBACK);
+    ret = NET_OK;
+  }
+  return ret;
+}
+
+
+static int32_t loopback_ping(net_if_handle_t *pnetif, net_sockaddr_t *addr, int32_t count, int32_t delay,
+                             int32_t response[])
+{
+  (void) pnetif;
+  (void) addr;
+  (void) delay;
+
+  for (int32_t i = 0; i < count; i++)
+  {
+    response[i] = 0;
+  }
+  return NET_OK;
+}
@@ -42,6 +42,7 @@ extern struct __RNG_HandleTypeDef hrng;
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static int32_t mbedtls_setup(net_socket_t *sock);
 static void mbedtls_free_resource(net_socket_t *sock);
 static int32_t mbedtls_net_recv(void *ctx, uchar_t *buf, size_t len, uint32_t timeout);
 static int32_t mbedtls_net_send(void *ctx, const uchar_t *buf, size_t len);
@@ -190,11 +191,10 @@ static void net_wrapper_free(void *p)
 }
 
 
-int32_t net_mbedtls_start(net_socket_t *sock)
+static int32_t mbedtls_setup(net_socket_t *sock)
 {
   int32_t ret = NET_OK;
   net_tls_data_t *const tls_data = sock->tlsData;
-  uint32_t start_tick;
 
   (void)mbedtls_platform_set_calloc_free(net_wrapper_calloc, net_wrapper_free);
   mbedtls_ssl_init(&tls_data->ssl);
@@ -338,92 +338,148 @@ int32_t net_mbedtls_start(net_socket_t *sock)
     mbedtls_ssl_set_bio(&tls_data->ssl, sock, (mbedtls_ssl_send_t *) mbedtls_net_send, NULL,
                         (mbedtls_ssl_recv_timeout_t *) mbedtls_net_recv);
     mbedtls_ssl_conf_read_timeout(&tls_data->conf, (uint32_t)sock->read_timeout);
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  Set up the TLS context of a connected socket and run the handshake to completion
+  * @param  sock [in] pointer to the socket
+  * @retval NET_OK on success, negative value in case of error (TLS resources are then released)
+  */
+int32_t net_mbedtls_start(net_socket_t *sock)
+{
+  int32_t ret = net_mbedtls_start_async(sock);
+
+  while (ret == NET_ERROR_IN_PROGRESS)
+  {
+    ret = net_mbedtls_handshake_step(sock);
+  }
+  return ret;
+}
+
+
+/**
+  * @brief  Set up the TLS context of a connected socket and perform the first handshake step
+  * @param  sock [in] pointer to the socket
+  * @retval NET_OK when the handshake is complete, NET_ERROR_IN_PROGRESS when net_mbedtls_handshake_step
+  *         has to be called again, negative value in case of error (TLS resources are then released)
+  */
+int32_t net_mbedtls_start_async(net_socket_t *sock)
+{
+  int32_t ret = mbedtls_setup(sock);
 
+  if (ret == NET_OK)
+  {
     NET_DBG_INFO("\n\nSSL state connect: %d", sock->tls_data->ssl.state);
     NET_DBG_INFO(" . Performing the SSL/TLS handshake...");
 
-    ret = mbedtls_ssl_handshake(&tls_data->ssl);
-    start_tick = NET_TICK();
-    while (ret != 0)
-    {
-      uint32_t elapsed_tick = NET_TICK() - start_tick;
+    sock->tlsData->handshake_perf = NET_PERF_OP_START();
+    sock->tlsData->handshake_tick = NET_TICK();
+    ret = net_mbedtls_handshake_step(sock);
+  }
+  return ret;
+}
 
-      if (elapsed_tick > NET_MBEDTLS_CONNECT_TIMEOUT)
-      {
-        mbedtls_free_resource(sock);
-        ret = NET_ERROR_MBEDTLS_CONNECT;
-        break;
-      }
 
-      if ((ret != MBEDTLS_ERR_SSL_WANT_READ) && (ret != MBEDTLS_ERR_SSL_WANT_WRITE))
-      {
-        tls_data->flags = mbedtls_ssl_get_verify_result(&tls_data->ssl);
-        if (tls_data->flags != 0U)
-        {
-          char_t verify_buf[512];
-          (void) mbedtls_x509_crt_verify_info(verify_buf, sizeof(verify_buf), "  ! ", tls_data->flags);
-          if (tls_data->tls_srv_verification == true)
-          {
-            NET_DBG_ERROR("Server verification:\n%s\n", verify_buf);
-          }
-          else
-          {
-            NET_DBG_INFO("Server verification:\n%s\n", verify_buf);
-          }
-        }
-        NET_DBG_ERROR("Failed!\n mbedtls_ssl_handshake returned -0x%" PRIx32 "\n", (uint32_t)(-ret));
+/**
+  * @brief  Resume the TLS handshake, returns as soon as the transport has no more data to progress
+  * @param  sock [in] pointer to the socket
+  * @retval NET_OK when the handshake is complete, NET_ERROR_IN_PROGRESS when it has to be called again,
+  *         negative value in case of error or NET_MBEDTLS_CONNECT_TIMEOUT expiry (TLS resources are then released)
+  */
+int32_t net_mbedtls_handshake_step(net_socket_t *sock)
+{
+  net_tls_data_t *const tls_data = sock->tlsData;
+  const uint32_t handshake_start = tls_data->handshake_perf;
+  int32_t ret = mbedtls_ssl_handshake(&tls_data->ssl);
 
-        mbedtls_free_resource(sock);
-        ret = (ret == MBEDTLS_ERR_X509_CERT_VERIFY_FAILED) ? NET_ERROR_MBEDTLS_REMOTE_AUTH : NET_ERROR_MBEDTLS_CONNECT;
-        break;
-      }
-      ret = mbedtls_ssl_handshake(&tls_data->ssl);
+  if ((ret == MBEDTLS_ERR_SSL_WANT_READ) || (ret == MBEDTLS_ERR_SSL_WANT_WRITE))
+  {
+    if ((NET_TICK() - tls_data->handshake_tick) > NET_MBEDTLS_CONNECT_TIMEOUT)
+    {
+      mbedtls_free_resource(sock);
+      ret = NET_ERROR_MBEDTLS_CONNECT;
     }
-
-    if (ret == NET_OK)
+    else
     {
-      int32_t exp;
-      NET_DBG_INFO(" OK\n [Protocol is %s]\n [Ciphersuite is %s]\n",
-                   mbedtls_ssl_get_version(&sock->tls_data->ssl),
-                   mbedtls_ssl_get_ciphersuite(&sock->tls_data->ssl));
-
-      exp = mbedtls_ssl_get_record_expansion(&tls_data->ssl);
-      if (exp >= 0)
+      ret = NET_ERROR_IN_PROGRESS;
+    }
+  }
+  else if (ret != 0)
+  {
+    tls_data->flags = mbedtls_ssl_get_verify_result(&tls_data->ssl);
+    if (tls_data->flags != 0U)
+    {
+      char_t verify_buf[512];
+      (void) mbedtls_x509_crt_verify_info(verify_buf, sizeof(verify_buf), "  ! ", tls_data->flags);
+      if (tls_data->tls_srv_verification == true)
       {
-        NET_DBG_INFO("    [Record expansion is %d]\n", exp);
+        NET_DBG_ERROR("Server verification:\n%s\n", verify_buf);
       }
       else
       {
-        NET_DBG_INFO("    [Record expansion is unknown (compression)]\n");
+        NET_DBG_INFO("Server verification:\n%s\n", verify_buf);
       }
+    }
+    NET_DBG_ERROR("Failed!\n mbedtls_ssl_handshake returned -0x%" PRIx32 "\n", (uint32_t)(-ret));
 
-      NET_DBG_INFO("  . Verifying peer X.509 certificate...");
+    mbedtls_free_resource(sock);
+    ret = (ret == MBEDTLS_ERR_X509_CERT_VERIFY_FAILED) ? NET_ERROR_MBEDTLS_REMOTE_AUTH : NET_ERROR_MBEDTLS_CONNECT;
+  }
+  else
+  {
+    /* Handshake complete. */
+  }
+
+  if (ret != NET_ERROR_IN_PROGRESS)
+  {
+    NET_PERF_OP_END(NET_PERF_OP_TLS_HANDSHAKE, sock->idx, sock->pnetif, ret, handshake_start);
+  }
+
+  if (ret == NET_OK)
+  {
+    int32_t exp;
+    NET_DBG_INFO(" OK\n [Protocol is %s]\n [Ciphersuite is %s]\n",
+                 mbedtls_ssl_get_version(&sock->tls_data->ssl),
+                 mbedtls_ssl_get_ciphersuite(&sock->tls_data->ssl));
+
+    exp = mbedtls_ssl_get_record_expansion(&tls_data->ssl);
+    if (exp >= 0)
+    {
+      NET_DBG_INFO("    [Record expansion is %d]\n", exp);
+    }
+    else
+    {
+      NET_DBG_INFO("    [Record expansion is unknown (compression)]\n");
+    }
+
+    NET_DBG_INFO("  . Verifying peer X.509 certificate...");
 
 
 #ifdef NET_DBG_INFO
 #define NET_CERTIFICATE_DISPLAY_LEN     2048U
-      if (mbedtls_ssl_get_peer_cert(&sock->tlsData->ssl) != NULL)
+    if (mbedtls_ssl_get_peer_cert(&sock->tlsData->ssl) != NULL)
+    {
+      char_t *buf = NET_MALLOC(sizeof(char_t) * NET_CERTIFICATE_DISPLAY_LEN);
+
+      if (buf != NULL)
       {
-        char_t *buf = NET_MALLOC(sizeof(char_t) * NET_CERTIFICATE_DISPLAY_LEN);
-
-        if (buf != NULL)
-        {
-          NET_DBG_INFO("  . Peer certificate information ...\n");
-          (void) mbedtls_x509_crt_info(buf, NET_CERTIFICATE_DISPLAY_LEN - 1U, "      ",
-                                       mbedtls_ssl_get_peer_cert(&sock->tlsData->ssl));
-          NET_DBG_INFO("%s\n", buf);
-          NET_FREE(buf);
-        }
-        else
-        {
-          NET_DBG_INFO(" . Cannot allocate memory to display certificate information ...\n");
-        }
+        NET_DBG_INFO("  . Peer certificate information ...\n");
+        (void) mbedtls_x509_crt_info(buf, NET_CERTIFICATE_DISPLAY_LEN - 1U, "      ",
+                                     mbedtls_ssl_get_peer_cert(&sock->tlsData->ssl));
+        NET_DBG_INFO("%s\n", buf);
+        NET_FREE(buf);
+      }
+      else
+      {
+        NET_DBG_INFO(" . Cannot allocate memory to display certificate information ...\n");
       }
-#endif /* NET_DBG_INFO */
     }
+#endif /* NET_DBG_INFO */
   }
   return ret;
-
 }
 
 
@@ -545,7 +601,8 @@ static int32_t mbedtls_net_recv(void *ctx, uchar_t *buf, size_t len, uint32_t ti
 
   if (ret == NET_OK)
   {
-    if (p_socket->read_timeout == 0)
+    /* Never block while an asynchronous handshake is stepped by net_connect_poll. */
+    if ((p_socket->read_timeout == 0) || (p_socket->status == SOCKET_CONNECTING))
     {
       flags = (int8_t) NET_MSG_DONTWAIT;
     }
@@ -586,7 +643,7 @@ static int32_t mbedtls_net_send(void *ctx, const uchar_t *buf, size_t len)
   int32_t ret;
   int32_t flags = 0;
 
-  if (p_socket->write_timeout == 0)
+  if ((p_socket->write_timeout == 0) || (p_socket->status == SOCKET_CONNECTING))
   {
     flags = (int8_t) NET_MSG_DONTWAIT;
   }
@@ -599,6 +656,7 @@ static int32_t mbedtls_net_send(void *ctx, const uchar_t *buf, size_t len)
   {
     if (ret == 0)
     {
+      NET_PERF_WOULD_BLOCK(p_socket->idx, p_socket->pnetif);
       ret = MBEDTLS_ERR_SSL_WANT_WRITE;
     }
   }
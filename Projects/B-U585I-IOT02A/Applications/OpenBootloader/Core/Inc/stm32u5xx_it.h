@@ -38,6 +38,7 @@ void UsageFault_Handler(void);
 void DebugMon_Handler(void);
 
 void SPI1_IRQHandler(void);
+void FLASH_IRQHandler(void);
 void TIM6_IRQHandler(void);
 void OTG_FS_IRQHandler(void);
 
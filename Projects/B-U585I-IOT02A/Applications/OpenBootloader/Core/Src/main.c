@@ -167,6 +167,16 @@ void System_DeInit(void)
   (void)I2Cx_DEINIT();
   (void)SPIx_DEINIT();
 
+#if (USARTx_RX_DMA == 1U)
+  /* Stop the USARTx reception GPDMA channel */
+  USARTx_DMA_DEINIT();
+#endif /* (USARTx_RX_DMA == 1U) */
+
+#if (SPIx_RX_DMA == 1U)
+  /* Stop the SPIx reception GPDMA channel */
+  SPIx_DMA_DEINIT();
+#endif /* (SPIx_RX_DMA == 1U) */
+
   (void)HAL_RCC_DeInit();
 
   /* Disable timer */
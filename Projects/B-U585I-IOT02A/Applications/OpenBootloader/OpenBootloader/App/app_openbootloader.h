@@ -26,12 +26,18 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "openbl_mem.h"
+#include "openbootloader_conf.h"
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+#define SPECIAL_CMD_MAX_NUMBER            0x02U    /* Special command command max length array */
+#else
 #define SPECIAL_CMD_MAX_NUMBER            0x01U    /* Special command command max length array */
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
 #define EXTENDED_SPECIAL_CMD_MAX_NUMBER   0x01U    /* Extended special command max length array */
 #define SPECIAL_CMD_DEFAULT               0x0102U  /* Default special command */
+#define SPECIAL_CMD_DOWNLOAD_STATS        0x0103U  /* Download statistics special command */
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
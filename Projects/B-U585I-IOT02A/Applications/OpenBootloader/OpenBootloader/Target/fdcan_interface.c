@@ -27,6 +27,7 @@
 #include "app_openbootloader.h"
 #include "fdcan_interface.h"
 #include "iwdg_interface.h"
+#include "flash_interface.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -164,6 +165,9 @@ uint8_t OPENBL_FDCAN_ProtocolDetection(void)
   if (HAL_FDCAN_GetRxFifoFillLevel(&hfdcan, FDCAN_RX_FIFO0) > 0U)
   {
     FdcanDetected = 1U;
+
+    /* The 3 elements of the RX FIFO cannot hold a write packet while the CPU is stalled by a FLASH operation */
+    OPENBL_FLASH_SetSynchronousWrite();
   }
   else
   {
@@ -308,6 +312,10 @@ void OPENBL_FDCAN_SendBytes(uint8_t *pBuffer, uint32_t BufferSize)
   */
 void OPENBL_FDCAN_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 {
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint32_t length;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
   switch (pSpecialCmd->OpCode)
   {
     case SPECIAL_CMD_DEFAULT:
@@ -344,6 +352,24 @@ void OPENBL_FDCAN_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 
       break;
 
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    case SPECIAL_CMD_DOWNLOAD_STATS:
+      if (pSpecialCmd->CmdType == OPENBL_SPECIAL_CMD)
+      {
+        length = OPENBL_FLASH_GetStatistics(&TxData[2]);
+
+        /* Send data size, the download statistics and NULL status size in one frame */
+        TxData[0]           = (uint8_t)(length >> 8U);
+        TxData[1]           = (uint8_t)length;
+        TxData[length + 2U] = 0x0U;
+        TxData[length + 3U] = 0x0U;
+
+        OPENBL_FDCAN_SendBytes(TxData, FDCAN_DLC_BYTES_32);
+      }
+
+      break;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
     default:
       break;
   }
@@ -26,10 +26,43 @@
 #include "app_openbootloader.h"
 #include "flash_interface.h"
 #include "i2c_interface.h"
+#include "iwdg_interface.h"
 #include "optionbytes_interface.h"
 
 /* Private typedef -----------------------------------------------------------*/
+#if (OPENBL_FLASH_PIPELINE == 1U)
+typedef struct
+{
+  uint32_t Address;                                      /* FLASH address of the packet */
+  uint32_t Length;                                       /* Packet length padded to a quad-word */
+  uint32_t Offset;                                       /* Offset of the next quad-word to program */
+  uint32_t ErasePage;                                    /* First page to erase before programming */
+  uint32_t EraseCount;                                   /* Number of pages to erase before programming */
+  uint32_t Data[OPENBL_FLASH_PIPELINE_BUFFER_SIZE / 4U]; /* Packet data */
+} OPENBL_FLASH_JobTypeDef;
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+typedef struct
+{
+  uint32_t StartTick;                                    /* Tick of the first write packet */
+  uint32_t EndTick;                                      /* Tick of the end of the last programming */
+  uint32_t Bytes;                                        /* Number of bytes written */
+  uint32_t Packets;                                      /* Number of write packets */
+  uint32_t ErasedPages;                                  /* Number of pages erased by the lazy erase */
+  uint32_t WaitTime;                                     /* Time the command processing waited for the FLASH */
+  uint32_t Errors;                                       /* Number of failed FLASH operations */
+} OPENBL_FLASH_StatisticsTypeDef;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
 /* Private define ------------------------------------------------------------*/
+#if (OPENBL_FLASH_PIPELINE == 1U)
+#define FLASH_PIPELINE_JOBS            2U     /* Packet being programmed and packet waiting for the FLASH */
+#define FLASH_BURST_SIZE               128U   /* Burst of 8 quad-words */
+#define FLASH_PAGES_NUMBER             (FLASH_MEM_SIZE / FLASH_PAGE_SIZE)
+#define FLASH_BANK_PAGES_NUMBER        (FLASH_PAGES_NUMBER / 2U)
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static uint32_t Flash_BusyState = FLASH_BUSY_STATE_DISABLED;
@@ -42,8 +75,33 @@ static FLASH_ProcessTypeDef FlashProcess = {.Lock = HAL_UNLOCKED, \
                                             .NbPagesToErase = 0U
                                            };
 
+#if (OPENBL_FLASH_PIPELINE == 1U)
+static OPENBL_FLASH_JobTypeDef Flash_Jobs[FLASH_PIPELINE_JOBS];
+static __IO uint32_t Flash_JobCount   = 0U;
+static __IO uint32_t Flash_JobCurrent = 0U;
+static uint32_t Flash_JobNext         = 0U;
+static uint32_t Flash_PipelineActive  = 0U;
+static uint32_t Flash_SynchronousWrite = 0U;
+#if (OPENBL_FLASH_LAZY_ERASE == 1U)
+static uint32_t Flash_ErasedPages[(FLASH_PAGES_NUMBER + 31U) / 32U];
+#endif /* (OPENBL_FLASH_LAZY_ERASE == 1U) */
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+static OPENBL_FLASH_StatisticsTypeDef Flash_Statistics;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
 /* Private function prototypes -----------------------------------------------*/
 static void OPENBL_FLASH_Program(uint32_t Address, uint32_t Data);
+static void OPENBL_FLASH_ProgramPacket(uint32_t Address, uint8_t *pData, uint32_t DataLength);
+#if (OPENBL_FLASH_PIPELINE == 1U)
+static void OPENBL_FLASH_PipelineWrite(uint32_t Address, uint8_t *pData, uint32_t DataLength);
+static void OPENBL_FLASH_PipelineNextOperation(void);
+#if (OPENBL_FLASH_LAZY_ERASE == 1U)
+static void OPENBL_FLASH_PipelineLazyErase(OPENBL_FLASH_JobTypeDef *pJob);
+static void OPENBL_FLASH_SetErasedPages(uint32_t Page, uint32_t NbPages);
+#endif /* (OPENBL_FLASH_LAZY_ERASE == 1U) */
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
 static ErrorStatus OPENBL_FLASH_EnableWriteProtection(uint8_t *ListOfPages, uint32_t Length);
 static ErrorStatus OPENBL_FLASH_DisableWriteProtection(void);
 #if defined (__ICCARM__)
@@ -123,11 +181,18 @@ void OPENBL_FLASH_OB_Unlock(void)
   */
 uint8_t OPENBL_FLASH_Read(uint32_t Address)
 {
+  /* Read back the data of the packets still being programmed */
+  OPENBL_FLASH_Flush();
+
   return (*(uint8_t *)(Address));
 }
 
 /**
   * @brief  This function is used to write data in FLASH memory.
+  * @note   When OPENBL_FLASH_PIPELINE is enabled, the packet is copied in a pipeline buffer and programmed under
+  *         FLASH interrupt, so that the host can send the next packet meanwhile. Any other FLASH access waits
+  *         for the end of the programming through OPENBL_FLASH_Flush(). After OPENBL_FLASH_SetSynchronousWrite(),
+  *         the packet is programmed before returning.
   * @param  Address The address where that data will be written.
   * @param  pData The data to be written.
   * @param  DataLength The length of the data to be written.
@@ -135,48 +200,178 @@ uint8_t OPENBL_FLASH_Read(uint32_t Address)
   */
 void OPENBL_FLASH_Write(uint32_t Address, uint8_t *pData, uint32_t DataLength)
 {
-  uint32_t index;
-  uint32_t length;
-  uint32_t remainder;
-  uint8_t remainder_data[16] = {0x0U};
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  if (Flash_Statistics.Packets == 0U)
+  {
+    Flash_Statistics.StartTick = HAL_GetTick();
+  }
 
-  /* Check the remaining of quad-word */
-  length = DataLength;
-  remainder = length & 0xFU;
+  Flash_Statistics.Packets++;
+  Flash_Statistics.Bytes += DataLength;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
 
-  if (remainder != 0U)
+#if (OPENBL_FLASH_PIPELINE == 1U)
+  if ((Address >= FLASH_START_ADDRESS) && (Address < FLASH_END_ADDRESS)
+      && (DataLength <= OPENBL_FLASH_PIPELINE_BUFFER_SIZE))
   {
-    length = (length & 0xFFFFFFF0U);
+    OPENBL_FLASH_PipelineWrite(Address, pData, DataLength);
 
-    /* Copy the remaining bytes */
-    for (index = 0U; index < remainder; index++)
+    /* The interface cannot receive the next packet while the FLASH is busy */
+    if (Flash_SynchronousWrite != 0U)
     {
-      remainder_data[index] = pData[length + index];
+      OPENBL_FLASH_Flush();
     }
+  }
+  else
+  {
+    /* OTP area or oversized packet, program it once the pending packets are programmed */
+    OPENBL_FLASH_Flush();
+    OPENBL_FLASH_ProgramPacket(Address, pData, DataLength);
+  }
+#else
+  OPENBL_FLASH_ProgramPacket(Address, pData, DataLength);
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+}
 
-    /* Fill the upper bytes with 0xFF */
-    for (index = remainder; index < 16U; index++)
+/**
+  * @brief  This function is used to wait for the end of the pipelined FLASH programming.
+  * @note   It must be called before any other FLASH access: read, erase, option bytes programming or jump.
+  *         It has no effect when OPENBL_FLASH_PIPELINE is disabled.
+  * @retval None.
+  */
+void OPENBL_FLASH_Flush(void)
+{
+#if (OPENBL_FLASH_PIPELINE == 1U)
+  __IO uint32_t *reg_cr;
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint32_t tick;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+  if (Flash_PipelineActive != 0U)
+  {
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    tick = HAL_GetTick();
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+    while (Flash_JobCount != 0U)
     {
-      remainder_data[index] = 0xFFU;
+      OPENBL_IWDG_Refresh();
     }
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    Flash_Statistics.WaitTime += HAL_GetTick() - tick;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+    /* Access to SECCR or NSCR registers depends on operation type */
+    reg_cr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECCR) : &(FLASH_NS->NSCR);
+
+    /* Disable the end of operation and error interrupts */
+    HAL_NVIC_DisableIRQ(FLASH_IRQn);
+    CLEAR_BIT((*reg_cr), (FLASH_NSCR_EOPIE | FLASH_NSCR_ERRIE));
+
+    /* Lock the Flash to disable the flash control register access */
+    OPENBL_FLASH_Lock();
+
+    Flash_PipelineActive = 0U;
   }
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+}
 
-  /* Unlock the flash memory for write operation */
-  OPENBL_FLASH_Unlock();
+/**
+  * @brief  This function is used to program each write packet before acknowledging it.
+  * @note   It is called by the interfaces that cannot buffer a whole packet while the CPU is stalled by a FLASH
+  *         operation: the host then sends the next packet once the previous one is programmed. The lazy erase is
+  *         kept. It has no effect when OPENBL_FLASH_PIPELINE is disabled.
+  * @retval None.
+  */
+void OPENBL_FLASH_SetSynchronousWrite(void)
+{
+#if (OPENBL_FLASH_PIPELINE == 1U)
+  Flash_SynchronousWrite = 1U;
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+}
 
-  for (index = 0U; index < length; (index += 16U))
+#if (OPENBL_FLASH_PIPELINE == 1U)
+/**
+  * @brief  This function handles the FLASH end of operation and error interrupts of the write pipeline.
+  * @retval None.
+  */
+void OPENBL_FLASH_IRQHandler(void)
+{
+  uint32_t error;
+  __IO uint32_t *reg_sr;
+  __IO uint32_t *reg_cr;
+
+  /* Access to SECSR/SECCR or NSSR/NSCR registers depends on operation type */
+  reg_sr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECSR) : &(FLASH_NS->NSSR);
+  reg_cr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECCR) : &(FLASH_NS->NSCR);
+
+  error = ((*reg_sr) & FLASH_FLAG_SR_ERRORS);
+
+  if (error != 0U)
   {
-    OPENBL_FLASH_Program((Address + index), (uint32_t)(&pData[index]));
+    /* Clear error programming flags */
+    (*reg_sr) = error;
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    Flash_Statistics.Errors++;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
   }
 
-  if (remainder != 0U)
+  if ((((*reg_sr) & FLASH_FLAG_EOP) != 0U) || (error != 0U))
   {
-    OPENBL_FLASH_Program((Address + length), (uint32_t)(remainder_data));
+    /* Clear FLASH End of Operation pending bit */
+    (*reg_sr) = FLASH_FLAG_EOP;
+
+    /* The operation is completed, disable the associated bits */
+    CLEAR_BIT((*reg_cr), (FLASH_NSCR_PG | FLASH_NSCR_BWR | FLASH_NSCR_PER));
+
+    OPENBL_FLASH_PipelineNextOperation();
   }
+}
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
 
-  /* Lock the Flash to disable the flash control register access */
-  OPENBL_FLASH_Lock();
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+/**
+  * @brief  This function is used to get the download statistics and to reset them for the next download.
+  * @param  pData Buffer of FLASH_STATISTICS_SIZE bytes receiving the report, in little endian 32-bit words:
+  *         download time in ms (first write packet to end of the last programming), written bytes,
+  *         write packets, lazily erased pages, time the command processing waited for the FLASH in ms
+  *         and number of failed FLASH operations.
+  * @retval Returns the size of the report.
+  */
+uint32_t OPENBL_FLASH_GetStatistics(uint8_t *pData)
+{
+  uint32_t index;
+  uint32_t report[FLASH_STATISTICS_SIZE / 4U];
+
+  /* Wait for the end of the download */
+  OPENBL_FLASH_Flush();
+
+  report[0] = (Flash_Statistics.Packets != 0U) ? (Flash_Statistics.EndTick - Flash_Statistics.StartTick) : 0U;
+  report[1] = Flash_Statistics.Bytes;
+  report[2] = Flash_Statistics.Packets;
+  report[3] = Flash_Statistics.ErasedPages;
+  report[4] = Flash_Statistics.WaitTime;
+  report[5] = Flash_Statistics.Errors;
+
+  for (index = 0U; index < FLASH_STATISTICS_SIZE; index++)
+  {
+    pData[index] = (uint8_t)(report[index / 4U] >> (8U * (index % 4U)));
+  }
+
+  /* Reset the statistics for the next download */
+  Flash_Statistics.StartTick   = 0U;
+  Flash_Statistics.EndTick     = 0U;
+  Flash_Statistics.Bytes       = 0U;
+  Flash_Statistics.Packets     = 0U;
+  Flash_Statistics.ErasedPages = 0U;
+  Flash_Statistics.WaitTime    = 0U;
+  Flash_Statistics.Errors      = 0U;
+
+  return FLASH_STATISTICS_SIZE;
 }
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
 
 /**
   * @brief  This function is used to jump to a given address.
@@ -187,6 +382,9 @@ void OPENBL_FLASH_JumpToAddress(uint32_t Address)
 {
   Function_Pointer jump_to_address;
 
+  /* Wait for the end of the FLASH programming */
+  OPENBL_FLASH_Flush();
+
   /* De-initialize all HW resources used by the Open Bootloader to their reset values */
   OPENBL_DeInit();
 
@@ -230,6 +428,9 @@ void OPENBL_FLASH_SetReadOutProtectionLevel(uint32_t Level)
 {
   FLASH_OBProgramInitTypeDef flash_ob;
 
+  /* Wait for the end of the FLASH programming */
+  OPENBL_FLASH_Flush();
+
   if (Level != OB_RDP_LEVEL2)
   {
     flash_ob.OptionType = OPTIONBYTE_RDP;
@@ -262,6 +463,9 @@ ErrorStatus OPENBL_FLASH_SetWriteProtection(FunctionalState State, uint8_t *pLis
 {
   ErrorStatus status;
 
+  /* Wait for the end of the FLASH programming */
+  OPENBL_FLASH_Flush();
+
   if (State == ENABLE)
   {
     status = OPENBL_FLASH_EnableWriteProtection(pListOfPages, Length);
@@ -299,6 +503,9 @@ ErrorStatus OPENBL_FLASH_MassErase(uint8_t *pData, uint32_t DataLength)
   ErrorStatus status   = SUCCESS;
   FLASH_EraseInitTypeDef erase_init_struct;
 
+  /* Wait for the end of the FLASH programming */
+  OPENBL_FLASH_Flush();
+
   /* Unlock the flash memory for erase operation */
   OPENBL_FLASH_Unlock();
 
@@ -334,6 +541,18 @@ ErrorStatus OPENBL_FLASH_MassErase(uint8_t *pData, uint32_t DataLength)
       }
       else
       {
+#if (OPENBL_FLASH_PIPELINE == 1U) && (OPENBL_FLASH_LAZY_ERASE == 1U)
+        if (erase_init_struct.Banks != FLASH_BANK_2)
+        {
+          OPENBL_FLASH_SetErasedPages(0U, FLASH_BANK_PAGES_NUMBER);
+        }
+
+        if (erase_init_struct.Banks != FLASH_BANK_1)
+        {
+          OPENBL_FLASH_SetErasedPages(FLASH_BANK_PAGES_NUMBER, FLASH_BANK_PAGES_NUMBER);
+        }
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) && (OPENBL_FLASH_LAZY_ERASE == 1U) */
+
         status = SUCCESS;
       }
     }
@@ -367,6 +586,9 @@ ErrorStatus OPENBL_FLASH_Erase(uint8_t *pData, uint32_t DataLength)
   uint16_t bytes_number;
   uint16_t page_code;
 
+  /* Wait for the end of the FLASH programming */
+  OPENBL_FLASH_Flush();
+
   /* Unlock the flash memory for erase operation */
   OPENBL_FLASH_Unlock();
 
@@ -407,6 +629,12 @@ ErrorStatus OPENBL_FLASH_Erase(uint8_t *pData, uint32_t DataLength)
       {
         errors++;
       }
+#if (OPENBL_FLASH_PIPELINE == 1U) && (OPENBL_FLASH_LAZY_ERASE == 1U)
+      else
+      {
+        OPENBL_FLASH_SetErasedPages(erase_init_struct.Page, 1U);
+      }
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) && (OPENBL_FLASH_LAZY_ERASE == 1U) */
     }
     else
     {
@@ -461,8 +689,332 @@ void OPENBL_Disable_BusyState_Flag(void)
   */
 static void OPENBL_FLASH_Program(uint32_t Address, uint32_t Data)
 {
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_QUADWORD, Address, Data) != HAL_OK)
+  {
+    Flash_Statistics.Errors++;
+  }
+#else
   (void)HAL_FLASH_Program(FLASH_TYPEPROGRAM_QUADWORD, Address, Data);
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+}
+
+/**
+  * @brief  This function is used to program a packet in FLASH memory, quad-word by quad-word.
+  * @param  Address The address where that data will be written.
+  * @param  pData The data to be written.
+  * @param  DataLength The length of the data to be written.
+  * @retval None.
+  */
+static void OPENBL_FLASH_ProgramPacket(uint32_t Address, uint8_t *pData, uint32_t DataLength)
+{
+  uint32_t index;
+  uint32_t length;
+  uint32_t remainder;
+  uint8_t remainder_data[16] = {0x0U};
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint32_t tick = HAL_GetTick();
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+  /* Check the remaining of quad-word */
+  length = DataLength;
+  remainder = length & 0xFU;
+
+  if (remainder != 0U)
+  {
+    length = (length & 0xFFFFFFF0U);
+
+    /* Copy the remaining bytes */
+    for (index = 0U; index < remainder; index++)
+    {
+      remainder_data[index] = pData[length + index];
+    }
+
+    /* Fill the upper bytes with 0xFF */
+    for (index = remainder; index < 16U; index++)
+    {
+      remainder_data[index] = 0xFFU;
+    }
+  }
+
+  /* Unlock the flash memory for write operation */
+  OPENBL_FLASH_Unlock();
+
+  for (index = 0U; index < length; (index += 16U))
+  {
+    OPENBL_FLASH_Program((Address + index), (uint32_t)(&pData[index]));
+  }
+
+  if (remainder != 0U)
+  {
+    OPENBL_FLASH_Program((Address + length), (uint32_t)(remainder_data));
+  }
+
+  /* Lock the Flash to disable the flash control register access */
+  OPENBL_FLASH_Lock();
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  Flash_Statistics.EndTick   = HAL_GetTick();
+  Flash_Statistics.WaitTime += Flash_Statistics.EndTick - tick;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+}
+
+#if (OPENBL_FLASH_PIPELINE == 1U)
+/**
+  * @brief  This function is used to queue a packet in the FLASH write pipeline.
+  * @note   The call only waits when the two pipeline buffers are used: the packet being programmed and
+  *         the packet waiting for the FLASH.
+  * @param  Address The address where that data will be written.
+  * @param  pData The data to be written.
+  * @param  DataLength The length of the data to be written.
+  * @retval None.
+  */
+static void OPENBL_FLASH_PipelineWrite(uint32_t Address, uint8_t *pData, uint32_t DataLength)
+{
+  OPENBL_FLASH_JobTypeDef *p_job;
+  uint8_t *p_buffer;
+  uint32_t index;
+  uint32_t length;
+  __IO uint32_t *reg_cr;
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint32_t tick;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+  if (Flash_PipelineActive == 0U)
+  {
+    /* Unlock the flash memory for write operation, it stays unlocked until the next flush */
+    OPENBL_FLASH_Unlock();
+
+    /* Clear error programming flags */
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+
+    /* Access to SECCR or NSCR registers depends on operation type */
+    reg_cr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECCR) : &(FLASH_NS->NSCR);
+
+    /* Enable the end of operation and error interrupts */
+    SET_BIT((*reg_cr), (FLASH_NSCR_EOPIE | FLASH_NSCR_ERRIE));
+    HAL_NVIC_SetPriority(FLASH_IRQn, 0U, 0U);
+    HAL_NVIC_EnableIRQ(FLASH_IRQn);
+
+    Flash_PipelineActive = 1U;
+  }
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  tick = HAL_GetTick();
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+  /* Wait until a pipeline buffer is free */
+  while (Flash_JobCount >= FLASH_PIPELINE_JOBS)
+  {
+    OPENBL_IWDG_Refresh();
+  }
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  Flash_Statistics.WaitTime += HAL_GetTick() - tick;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+  /* Copy the packet and fill the upper bytes of the last quad-word with 0xFF */
+  p_job    = &Flash_Jobs[Flash_JobNext];
+  p_buffer = (uint8_t *)p_job->Data;
+  length   = (DataLength + 15U) & 0xFFFFFFF0U;
+
+  for (index = 0U; index < DataLength; index++)
+  {
+    p_buffer[index] = pData[index];
+  }
+
+  for (index = DataLength; index < length; index++)
+  {
+    p_buffer[index] = 0xFFU;
+  }
+
+  p_job->Address    = Address;
+  p_job->Length     = length;
+  p_job->Offset     = 0U;
+  p_job->EraseCount = 0U;
+
+#if (OPENBL_FLASH_LAZY_ERASE == 1U)
+  OPENBL_FLASH_PipelineLazyErase(p_job);
+#endif /* (OPENBL_FLASH_LAZY_ERASE == 1U) */
+
+  Flash_JobNext = (Flash_JobNext + 1U) % FLASH_PIPELINE_JOBS;
+
+  /* Hand the packet over to the FLASH interrupt */
+  HAL_NVIC_DisableIRQ(FLASH_IRQn);
+
+  Flash_JobCount++;
+
+  if (Flash_JobCount == 1U)
+  {
+    /* The FLASH is idle, start the first operation of the packet */
+    OPENBL_FLASH_PipelineNextOperation();
+  }
+
+  HAL_NVIC_EnableIRQ(FLASH_IRQn);
+}
+
+/**
+  * @brief  This function is used to start the next operation of the FLASH write pipeline: page erase,
+  *         burst of 8 quad-words when the address is aligned on a burst, or quad-word.
+  * @note   It is called from the FLASH interrupt or with the FLASH interrupt disabled.
+  * @retval None.
+  */
+static void OPENBL_FLASH_PipelineNextOperation(void)
+{
+  OPENBL_FLASH_JobTypeDef *p_job;
+  __IO uint32_t *reg_cr;
+  __IO uint32_t *p_dest;
+  uint32_t *p_src;
+  uint32_t page;
+  uint32_t words;
+  uint32_t index;
+  uint32_t primask_bit;
+  uint32_t started = 0U;
+
+  /* Access to SECCR or NSCR registers depends on operation type */
+  reg_cr = IS_FLASH_SECURE_OPERATION() ? &(FLASH->SECCR) : &(FLASH_NS->NSCR);
+
+  while ((Flash_JobCount != 0U) && (started == 0U))
+  {
+    p_job = &Flash_Jobs[Flash_JobCurrent];
+
+    if (p_job->EraseCount != 0U)
+    {
+      page = p_job->ErasePage;
+
+      p_job->ErasePage++;
+      p_job->EraseCount--;
+
+      if (page < FLASH_BANK_PAGES_NUMBER)
+      {
+        CLEAR_BIT((*reg_cr), FLASH_NSCR_BKER);
+      }
+      else
+      {
+        SET_BIT((*reg_cr), FLASH_NSCR_BKER);
+        page -= FLASH_BANK_PAGES_NUMBER;
+      }
+
+      /* Proceed to erase the page */
+      MODIFY_REG((*reg_cr), (FLASH_NSCR_PNB | FLASH_NSCR_PER | FLASH_NSCR_STRT),
+                 ((page << FLASH_NSCR_PNB_Pos) | FLASH_NSCR_PER | FLASH_NSCR_STRT));
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+      Flash_Statistics.ErasedPages++;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
+      started = 1U;
+    }
+    else if (p_job->Offset < p_job->Length)
+    {
+      p_dest = (__IO uint32_t *)(p_job->Address + p_job->Offset);
+      p_src  = &p_job->Data[p_job->Offset / 4U];
+
+      if ((((p_job->Address + p_job->Offset) % FLASH_BURST_SIZE) == 0U)
+          && ((p_job->Length - p_job->Offset) >= FLASH_BURST_SIZE))
+      {
+        words = FLASH_BURST_SIZE / 4U;
+        SET_BIT((*reg_cr), (FLASH_NSCR_PG | FLASH_NSCR_BWR));
+      }
+      else
+      {
+        words = 4U;
+        SET_BIT((*reg_cr), FLASH_NSCR_PG);
+      }
+
+      /* The words must be written without interruption, the programming starts with the last one */
+      primask_bit = __get_PRIMASK();
+      __disable_irq();
+
+      for (index = 0U; index < words; index++)
+      {
+        *p_dest = *p_src;
+        p_dest++;
+        p_src++;
+      }
+
+      __set_PRIMASK(primask_bit);
+
+      p_job->Offset += words * 4U;
+
+      started = 1U;
+    }
+    else
+    {
+      /* Packet programmed, release its buffer */
+      Flash_JobCurrent = (Flash_JobCurrent + 1U) % FLASH_PIPELINE_JOBS;
+      Flash_JobCount--;
+
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+      Flash_Statistics.EndTick = HAL_GetTick();
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+    }
+  }
+}
+
+#if (OPENBL_FLASH_LAZY_ERASE == 1U)
+/**
+  * @brief  This function is used to select the pages to erase before programming a packet: the pages written
+  *         for the first time since their last erase command that are not blank.
+  * @param  pJob The pipeline packet.
+  * @retval None.
+  */
+static void OPENBL_FLASH_PipelineLazyErase(OPENBL_FLASH_JobTypeDef *pJob)
+{
+  uint32_t page;
+  uint32_t last_page;
+  uint32_t index;
+  uint32_t blank;
+  uint32_t *p_page;
+
+  page      = (pJob->Address - FLASH_START_ADDRESS) / FLASH_PAGE_SIZE;
+  last_page = (pJob->Address + pJob->Length - 1U - FLASH_START_ADDRESS) / FLASH_PAGE_SIZE;
+
+  for (; (page <= last_page) && (page < FLASH_PAGES_NUMBER); page++)
+  {
+    if ((Flash_ErasedPages[page / 32U] & (1UL << (page % 32U))) == 0U)
+    {
+      OPENBL_FLASH_SetErasedPages(page, 1U);
+
+      /* Skip the erase of a blank page */
+      p_page = (uint32_t *)(FLASH_START_ADDRESS + (page * FLASH_PAGE_SIZE));
+      blank  = 1U;
+
+      for (index = 0U; (index < (FLASH_PAGE_SIZE / 4U)) && (blank != 0U); index++)
+      {
+        blank = (p_page[index] == 0xFFFFFFFFU) ? 1U : 0U;
+      }
+
+      if (blank == 0U)
+      {
+        if (pJob->EraseCount == 0U)
+        {
+          pJob->ErasePage = page;
+        }
+
+        pJob->EraseCount++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  This function is used to record erased pages, they are not erased again by the lazy erase.
+  * @param  Page The first erased page.
+  * @param  NbPages The number of erased pages.
+  * @retval None.
+  */
+static void OPENBL_FLASH_SetErasedPages(uint32_t Page, uint32_t NbPages)
+{
+  uint32_t page;
+
+  for (page = Page; (page < (Page + NbPages)) && (page < FLASH_PAGES_NUMBER); page++)
+  {
+    Flash_ErasedPages[page / 32U] |= (1UL << (page % 32U));
+  }
 }
+#endif /* (OPENBL_FLASH_LAZY_ERASE == 1U) */
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
 
 /**
   * @brief  This function is used to enable write protection of the specified FLASH areas.
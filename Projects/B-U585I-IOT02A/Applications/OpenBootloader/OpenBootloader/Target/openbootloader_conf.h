@@ -81,6 +81,13 @@ extern "C" {
 
 #define INTERFACES_SUPPORTED              6U
 
+/* ------------------------ Definitions for FLASH write ----------------------*/
+#define OPENBL_FLASH_PIPELINE             0U    /* 1: program a write packet while the next one is received */
+#define OPENBL_FLASH_PIPELINE_BUFFER_SIZE 256U  /* Size of each pipeline buffer, largest write memory packet */
+#define OPENBL_FLASH_LAZY_ERASE           0U    /* 1: erase a non-blank page on its first write (pipeline only),
+                                                   pages erased by an erase command are not erased again */
+#define OPENBL_DOWNLOAD_STATISTICS        0U    /* 1: download statistics reported by a special command */
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 
@@ -28,6 +28,7 @@
 #include "app_openbootloader.h"
 #include "usart_interface.h"
 #include "iwdg_interface.h"
+#include "flash_interface.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -37,9 +38,21 @@
 /* Private variables ---------------------------------------------------------*/
 static uint8_t UsartDetected = 0U;
 
+#if (USARTx_RX_DMA == 1U)
+static DMA_HandleTypeDef UsartDmaHandle;
+static DMA_NodeTypeDef UsartDmaNode;
+static DMA_QListTypeDef UsartDmaQueue;
+static uint8_t UsartRxBuffer[USARTx_RX_BUFFER_SIZE];
+static uint32_t UsartRxIndex = 0U;
+static uint8_t UsartDmaStarted = 0U;
+#endif /* (USARTx_RX_DMA == 1U) */
+
 /* Exported variables --------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static void OPENBL_USART_Init(void);
+#if (USARTx_RX_DMA == 1U)
+static void OPENBL_USART_DMA_Init(void);
+#endif /* (USARTx_RX_DMA == 1U) */
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -84,6 +97,83 @@ static void OPENBL_USART_Init(void)
   LL_USART_Enable(USARTx);
 }
 
+#if (USARTx_RX_DMA == 1U)
+/**
+  * @brief  This function is used to start the USARTx reception in a circular buffer through GPDMA.
+  *         The bytes received while the CPU is stalled by a FLASH operation are not lost.
+  * @retval None.
+  */
+static void OPENBL_USART_DMA_Init(void)
+{
+  DMA_NodeConfTypeDef node_config = {0U};
+
+  USARTx_DMA_CLK_ENABLE();
+
+  /* Single node looping on itself: USARTx RDR to the circular reception buffer */
+  node_config.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_config.Init.Request                        = USARTx_DMA_REQUEST;
+  node_config.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                      = DMA_PERIPH_TO_MEMORY;
+  node_config.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_config.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_config.Init.SrcDataWidth                   = DMA_SRC_DATAWIDTH_BYTE;
+  node_config.Init.DestDataWidth                  = DMA_DEST_DATAWIDTH_BYTE;
+  node_config.Init.SrcBurstLength                 = 1U;
+  node_config.Init.DestBurstLength                = 1U;
+  node_config.Init.Priority                       = DMA_HIGH_PRIORITY;
+  node_config.Init.TransferEventMode              = DMA_TCEM_BLOCK_TRANSFER;
+  node_config.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+  node_config.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_config.SrcAddress                          = (uint32_t)&(USARTx->RDR);
+  node_config.DstAddress                          = (uint32_t)UsartRxBuffer;
+  node_config.DataSize                            = USARTx_RX_BUFFER_SIZE;
+
+  if (HAL_DMAEx_List_BuildNode(&node_config, &UsartDmaNode) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_InsertNode_Tail(&UsartDmaQueue, &UsartDmaNode) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_SetCircularMode(&UsartDmaQueue) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  UsartDmaHandle.Instance                         = USARTx_DMA_CHANNEL;
+  UsartDmaHandle.InitLinkedList.Priority          = DMA_HIGH_PRIORITY;
+  UsartDmaHandle.InitLinkedList.LinkStepMode      = DMA_LSM_FULL_EXECUTION;
+  UsartDmaHandle.InitLinkedList.LinkAllocatedPort = DMA_LINK_ALLOCATED_PORT1;
+  UsartDmaHandle.InitLinkedList.TransferEventMode = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  UsartDmaHandle.InitLinkedList.LinkedListMode    = DMA_LINKEDLIST_CIRCULAR;
+
+  if (HAL_DMAEx_List_Init(&UsartDmaHandle) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_LinkQ(&UsartDmaHandle, &UsartDmaQueue) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_Start(&UsartDmaHandle) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  LL_USART_EnableDMAReq_RX(USARTx);
+
+  UsartRxIndex    = 0U;
+  UsartDmaStarted = 1U;
+}
+#endif /* (USARTx_RX_DMA == 1U) */
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -165,6 +255,14 @@ uint8_t OPENBL_USART_ProtocolDetection(void)
     /* Read byte in order to flush the 0x7F synchronization byte */
     (void)OPENBL_USART_ReadByte();
 
+#if (USARTx_RX_DMA == 1U)
+    /* The next bytes are received through GPDMA */
+    OPENBL_USART_DMA_Init();
+#else
+    /* The RDR register cannot hold a write packet while the CPU is stalled by a FLASH operation */
+    OPENBL_FLASH_SetSynchronousWrite();
+#endif /* (USARTx_RX_DMA == 1U) */
+
     /* Acknowledge the host */
     OPENBL_USART_SendByte(ACK_BYTE);
 
@@ -204,13 +302,34 @@ uint8_t OPENBL_USART_GetCommandOpcode(void)
   */
 uint8_t OPENBL_USART_ReadByte(void)
 {
-  /* Wait until the Read Data Register Not Empty Flag is set */
-  while (LL_USART_IsActiveFlag_RXNE_RXFNE(USARTx) == 0U)
+  uint8_t data;
+
+#if (USARTx_RX_DMA == 1U)
+  if (UsartDmaStarted != 0U)
+  {
+    /* Wait until the GPDMA has written beyond the read index */
+    while (((USARTx_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&UsartDmaHandle)) % USARTx_RX_BUFFER_SIZE)
+           == UsartRxIndex)
+    {
+      OPENBL_IWDG_Refresh();
+    }
+
+    data         = UsartRxBuffer[UsartRxIndex];
+    UsartRxIndex = (UsartRxIndex + 1U) % USARTx_RX_BUFFER_SIZE;
+  }
+  else
+#endif /* (USARTx_RX_DMA == 1U) */
   {
-    OPENBL_IWDG_Refresh();
+    /* Wait until the Read Data Register Not Empty Flag is set */
+    while (LL_USART_IsActiveFlag_RXNE_RXFNE(USARTx) == 0U)
+    {
+      OPENBL_IWDG_Refresh();
+    }
+
+    data = LL_USART_ReceiveData8(USARTx);
   }
 
-  return LL_USART_ReceiveData8(USARTx);
+  return data;
 }
 
 /**
@@ -236,6 +355,12 @@ void OPENBL_USART_SendByte(uint8_t Byte)
   */
 void OPENBL_USART_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 {
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint8_t statistics[FLASH_STATISTICS_SIZE];
+  uint32_t length;
+  uint32_t index;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
   switch (pSpecialCmd->OpCode)
   {
     case SPECIAL_CMD_DEFAULT:
@@ -270,6 +395,30 @@ void OPENBL_USART_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 
       break;
 
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    case SPECIAL_CMD_DOWNLOAD_STATS:
+      if (pSpecialCmd->CmdType == OPENBL_SPECIAL_CMD)
+      {
+        length = OPENBL_FLASH_GetStatistics(statistics);
+
+        /* Send data size */
+        OPENBL_USART_SendByte((uint8_t)(length >> 8U));
+        OPENBL_USART_SendByte((uint8_t)length);
+
+        /* Send the download statistics */
+        for (index = 0U; index < length; index++)
+        {
+          OPENBL_USART_SendByte(statistics[index]);
+        }
+
+        /* Send NULL status size */
+        OPENBL_USART_SendByte(0x00U);
+        OPENBL_USART_SendByte(0x00U);
+      }
+
+      break;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
     default:
       break;
   }
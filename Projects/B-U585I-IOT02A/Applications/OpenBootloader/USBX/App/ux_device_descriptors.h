@@ -241,7 +241,8 @@ uint8_t *USBD_Get_Language_Id_Framework(ULONG *Length);
 #define DFU_DESCRIPTOR_TYPE                           0x21U
 #define USBD_DFU_BM_ATTRIBUTES                        0x0BU
 #define USBD_DFU_DetachTimeout                        0xFFU
-#define USBD_DFU_XFER_SIZE                            1024U
+#define USBD_DFU_XFER_SIZE                            1024U  /* wTransferSize, up to UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH
+                                                                (ux_user.h), multiple of 16 bytes */
 
 #define USBD_DFU_STRING_FLASH_DESC_INDEX              0x06U
 #define USBD_DFU_STRING_FLASH_DESC                    "@Internal Flash   /0x08000000/256*8Kg"
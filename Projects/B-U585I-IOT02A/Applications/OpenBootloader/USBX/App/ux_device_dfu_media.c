@@ -26,13 +26,33 @@
 #include "openbl_usb_cmd.h"
 #include "app_openbootloader.h"
 #include "common_interface.h"
+#include "ux_device_descriptors.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#if (USBD_DFU_XFER_SIZE > UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH)
+#error "USBD_DFU_XFER_SIZE larger than UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH"
+#endif /* (USBD_DFU_XFER_SIZE > UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH) */
+
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+#if (DFU_MEDIA_BUFFER_NUMBER > APP_QUEUE_SIZE)
+#error "DFU_MEDIA_BUFFER_NUMBER larger than APP_QUEUE_SIZE"
+#endif /* (DFU_MEDIA_BUFFER_NUMBER > APP_QUEUE_SIZE) */
+
+/* Worst case FLASH timings used to compute bwPollTimeout, to be adjusted to the device datasheet */
+#define DFU_MEDIA_PAGE_ERASE_TIME_US      3400U   /* Page erase */
+#define DFU_MEDIA_QUADWORD_TIME_US        120U    /* Quad-word programming */
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
+
 /* Private macro -------------------------------------------------------------*/
 #define DFU_MEDIA_ERASE_TIME              (uint16_t)500U
 #define DFU_MEDIA_PROGRAM_TIME            (uint16_t)500U
 
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+/* Programming time of Len bytes, in us */
+#define DFU_MEDIA_PROGRAM_TIME_US(Len)    ((((Len) + 15U) / 16U) * DFU_MEDIA_QUADWORD_TIME_US)
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
+
 /* Private variables ---------------------------------------------------------*/
 extern TX_QUEUE ux_app_MsgQueue;
 extern ux_dfu_downloadInfotypeDef ux_dfu_download;
@@ -43,7 +63,18 @@ extern PCD_HandleTypeDef hpcd_USB_OTG_FS;
 
 ULONG dfu_status = 0U;
 ULONG Address_ptr;
-UCHAR RX_Data[1024];
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+UCHAR RX_Data[DFU_MEDIA_BUFFER_NUMBER][USBD_DFU_XFER_SIZE];
+
+static uint32_t DfuMediaHead = 0U;                      /* Next download buffer, written by DFU_Write */
+static __IO uint32_t DfuMediaPending = 0U;              /* Blocks and commands queued and not yet processed */
+static __IO uint32_t DfuMediaCommands = 0U;             /* Special commands queued and not yet processed */
+static __IO uint32_t DfuMediaErasePending = 0U;         /* Erase commands queued and not yet processed */
+static __IO ULONG DfuMediaError = UX_SLAVE_CLASS_DFU_STATUS_OK; /* First block error, kept until reported */
+static __IO uint32_t DfuMediaDrop = 0U;                 /* Blocks dropped after an error, until a special command */
+#else
+UCHAR RX_Data[USBD_DFU_XFER_SIZE];
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
 
 uint8_t JumpUsb = 0;
 
@@ -56,6 +87,10 @@ static UINT DFU_WriteUnprotect(void);
 static UINT DFU_ReadProtect(void);
 static UINT DFU_ReadUnprotect(void);
 static UINT DFU_Erase(uint32_t Address);
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+static ULONG DFU_MediaPollTimeout(ULONG Time);
+static void DFU_MediaRelease(ux_dfu_downloadInfotypeDef *pDownload);
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
 
 /* Private user code ---------------------------------------------------------*/
 
@@ -89,7 +124,42 @@ void DFU_DeInit(void *dfu)
   */
 UINT DFU_GetStatus(void *dfu, ULONG *media_status)
 {
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+  ULONG poll_time;
+
+  if (DfuMediaError != UX_SLAVE_CLASS_DFU_STATUS_OK)
+  {
+    /* A write-behind block failed : reported before any busy state, the host then clears the status and restarts
+       with a special command, the blocks still queued being dropped */
+    *media_status  = UX_SLAVE_CLASS_DFU_MEDIA_STATUS_ERROR;
+    *media_status += DfuMediaError << 4U;
+
+    DfuMediaError = UX_SLAVE_CLASS_DFU_STATUS_OK;
+  }
+  else if (DfuMediaCommands != 0U)
+  {
+    /* A special command is processed once the blocks received before it are programmed */
+    poll_time  = DfuMediaErasePending * DFU_MEDIA_PAGE_ERASE_TIME_US;
+    poll_time += (DfuMediaPending - DfuMediaCommands) * DFU_MEDIA_PROGRAM_TIME_US(USBD_DFU_XFER_SIZE);
+
+    *media_status  = UX_SLAVE_CLASS_DFU_MEDIA_STATUS_BUSY;
+    *media_status += UX_SLAVE_CLASS_DFU_STATUS_OK << 4U;
+    *media_status += DFU_MediaPollTimeout(poll_time) << 8U;
+  }
+  else if (DfuMediaPending >= DFU_MEDIA_BUFFER_NUMBER)
+  {
+    /* No free buffer for the next block until the oldest one is programmed */
+    *media_status  = UX_SLAVE_CLASS_DFU_MEDIA_STATUS_BUSY;
+    *media_status += UX_SLAVE_CLASS_DFU_STATUS_OK << 4U;
+    *media_status += DFU_MediaPollTimeout(DFU_MEDIA_PROGRAM_TIME_US(USBD_DFU_XFER_SIZE)) << 8U;
+  }
+  else
+  {
+    *media_status = dfu_status;
+  }
+#else
   *media_status = dfu_status;
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
 
   return (UX_SUCCESS);
 }
@@ -130,10 +200,18 @@ UINT DFU_Read(VOID *dfu, ULONG block_number, UCHAR *data_pointer,
     *(data_pointer + 2U) = DFU_CMD_ERASE ;
     *(data_pointer + 3U) = 0U;
   }
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+  else if (DfuMediaPending != 0U)
+  {
+    /* Never return the memory content before the pending blocks are programmed : the set address pointer command
+       sent by the host before an upload waits for them */
+    Status = UX_ERROR;
+  }
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
   else if (block_number > 0U)
   {
     /* Return the physical address from which the host requests to read data */
-    Address_src = ((block_number - 2U) * UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH) + Address_ptr;
+    Address_src = ((block_number - 2U) * USBD_DFU_XFER_SIZE) + Address_ptr;
 
     /* Read Memory */
     if (DFU_ReadMemory(Address_src, data_pointer, length) != UX_SUCCESS)
@@ -177,6 +255,46 @@ UINT DFU_Read(VOID *dfu, ULONG block_number, UCHAR *data_pointer,
 UINT DFU_Write(VOID *dfu, ULONG block_number, UCHAR *data_pointer,
                ULONG length, ULONG *media_status)
 {
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+  TX_INTERRUPT_SAVE_AREA
+  ux_dfu_downloadInfotypeDef download;
+
+  /* No free buffer : the host did not wait for the status request reporting dfuDNBUSY */
+  if ((length > USBD_DFU_XFER_SIZE) || (DfuMediaPending >= DFU_MEDIA_BUFFER_NUMBER))
+  {
+    return (UX_ERROR);
+  }
+
+  /* Copy the block in the next free buffer, the status request tells the host to wait when none is left */
+  download.wlength    = length;
+  download.data_ptr   = RX_Data[DfuMediaHead];
+  download.wblock_num = block_number;
+
+  ux_utility_memory_copy(download.data_ptr, data_pointer, length);
+
+  DfuMediaHead = (DfuMediaHead + 1U) % DFU_MEDIA_BUFFER_NUMBER;
+
+  TX_DISABLE
+  DfuMediaPending++;
+  if (block_number == 0U)
+  {
+    DfuMediaCommands++;
+
+    if (*data_pointer == DFU_CMD_ERASE)
+    {
+      DfuMediaErasePending++;
+    }
+  }
+  TX_RESTORE
+
+  /* Put a message queue to usbx_dfu_download_thread_entry */
+  if (tx_queue_send(&ux_app_MsgQueue, &download, TX_NO_WAIT))
+  {
+    Error_Handler();
+  }
+
+  return (UX_SUCCESS);
+#else
   UINT  status          = 0U;
   ULONG dfu_polltimeout = 0U;
 
@@ -215,6 +333,7 @@ UINT DFU_Write(VOID *dfu, ULONG block_number, UCHAR *data_pointer,
   }
 
   return (status);
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
 }
 
 /**
@@ -235,6 +354,14 @@ UINT DFU_Leave(VOID *dfu, UX_SLAVE_TRANSFER *transfer)
 
   setup  = transfer->ux_slave_transfer_request_setup;
 
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+  /* Never leave with a failed download : error not reported yet, or no special command since the error */
+  if ((DfuMediaError != UX_SLAVE_CLASS_DFU_STATUS_OK) || (DfuMediaDrop != 0U))
+  {
+    return (status);
+  }
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
+
   if ((dfu_state == UX_SYSTEM_DFU_STATE_DFU_IDLE) ||
       (dfu_state == UX_SYSTEM_DFU_STATE_DFU_DNLOAD_IDLE))
   {
@@ -280,6 +407,11 @@ void usbx_dfu_download_thread_entry(ULONG arg)
       {
         Command = *(ux_dfu_download.data_ptr);
 
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+        /* The host restarts with a special command after an error, the error itself is kept until reported */
+        DfuMediaDrop = 0U;
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
+
         /* Decode the Special Command */
         switch (Command)
         {
@@ -388,8 +520,19 @@ void usbx_dfu_download_thread_entry(ULONG arg)
       else
       {
         /* Decode the required address to which the host requests to write data */
-        Address_dest = ((ux_dfu_download.wblock_num - 2U) * UX_SLAVE_REQUEST_CONTROL_MAX_LENGTH) +  Address_ptr;
+        Address_dest = ((ux_dfu_download.wblock_num - 2U) * USBD_DFU_XFER_SIZE) +  Address_ptr;
 
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+        /* The blocks following an error are dropped until the next special command */
+        if (DfuMediaDrop == 0U)
+        {
+          if (DFU_WriteMemory(Address_dest, ux_dfu_download.data_ptr, ux_dfu_download.wlength) != UX_SUCCESS)
+          {
+            DfuMediaDrop  = 1U;
+            DfuMediaError = UX_SLAVE_CLASS_DFU_STATUS_ERROR_WRITE;
+          }
+        }
+#else
         /* Write Memory */
         if (DFU_WriteMemory(Address_dest, ux_dfu_download.data_ptr, ux_dfu_download.wlength) != UX_SUCCESS)
         {
@@ -406,7 +549,16 @@ void usbx_dfu_download_thread_entry(ULONG arg)
 
         /* Update USB DFU state machine */
         ux_device_class_dfu_state_sync(dfu);
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
       }
+
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+      /* Free the buffer then sync the state machine again, a status request may have reported dfuDNBUSY
+         while the block was processed */
+      DFU_MediaRelease(&ux_dfu_download);
+
+      ux_device_class_dfu_state_sync(dfu);
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
     }
     else
     {
@@ -470,6 +622,21 @@ static UINT DFU_WriteMemory(uint32_t Address, uint8_t *pDest, uint32_t Len)
   */
 void DFU_Jump(void)
 {
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+  /* Wait for the blocks still to be programmed */
+  while (DfuMediaPending != 0U)
+  {
+    tx_thread_sleep(1U);
+  }
+
+  /* A block failed : stay in the bootloader, the host restarts the download */
+  if ((DfuMediaError != UX_SLAVE_CLASS_DFU_STATUS_OK) || (DfuMediaDrop != 0U))
+  {
+    JumpUsb = 0U;
+    return;
+  }
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
+
   /* Disable the USB */
   HAL_PCD_Stop(&hpcd_USB_OTG_FS);
 
@@ -545,3 +712,49 @@ static UINT DFU_ReadUnprotect(void)
   OPENBL_USB_ReadUnprotect();
   return (UX_SUCCESS);
 }
+
+#if (DFU_MEDIA_WRITE_BEHIND == 1U)
+/**
+  * @brief  Convert a FLASH operation time in bwPollTimeout.
+  * @param  Time: Time in us.
+  * @retval Poll timeout in ms, at least 1 ms.
+  */
+static ULONG DFU_MediaPollTimeout(ULONG Time)
+{
+  ULONG timeout = (Time + 999U) / 1000U;
+
+  if (timeout == 0U)
+  {
+    timeout = 1U;
+  }
+  else if (timeout > 0xFFFFFFU)
+  {
+    timeout = 0xFFFFFFU;
+  }
+
+  return timeout;
+}
+
+/**
+  * @brief  Release a processed block or command, its buffer can receive a new block.
+  * @param  pDownload: Processed download block.
+  * @retval None.
+  */
+static void DFU_MediaRelease(ux_dfu_downloadInfotypeDef *pDownload)
+{
+  TX_INTERRUPT_SAVE_AREA
+
+  TX_DISABLE
+  if (pDownload->wblock_num == 0U)
+  {
+    if (*(pDownload->data_ptr) == DFU_CMD_ERASE)
+    {
+      DfuMediaErasePending--;
+    }
+
+    DfuMediaCommands--;
+  }
+  DfuMediaPending--;
+  TX_RESTORE
+}
+#endif /* (DFU_MEDIA_WRITE_BEHIND == 1U) */
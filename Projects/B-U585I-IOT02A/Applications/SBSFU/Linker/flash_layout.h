@@ -55,6 +55,16 @@
 /* Use image hash reference to reduce boot time (signature check bypass) */
 #define MCUBOOT_USE_HASH_REF
 
+/* Use image verified reference to reduce boot time (hash computation bypass of the images unchanged since their
+   last validation, record authenticated with the SAES hardware unique key).
+   The primary slots must not be writable outside of BL2 and of the local loader */
+/*
+#define MCUBOOT_USE_VERIFIED_REF
+*/
+#if defined(MCUBOOT_USE_VERIFIED_REF) && !defined(MCUBOOT_USE_HASH_REF)
+#error "Config not supported: MCUBOOT_USE_VERIFIED_REF requires MCUBOOT_USE_HASH_REF"
+#endif /* MCUBOOT_USE_VERIFIED_REF && !MCUBOOT_USE_HASH_REF */
+
 /* control configuration */
 #if (defined(MCUBOOT_PRIMARY_ONLY) || defined(MCUBOOT_OVERWRITE_ONLY)) && defined(TFM_PARTITION_FIRMWARE_UPDATE)
 #error "Config not supported: TFM_PARTITION_FIRMWARE_UPDATE is activated only in swap mode"
@@ -60,6 +60,14 @@ extern "C" {
 #define COM_UART_RX_GPIO_CLK_ENABLE()           __HAL_RCC_GPIOA_CLK_ENABLE()
 #define COM_UART_RX_GPIO_CLK_DISABLE()          __HAL_RCC_GPIOA_CLK_DISABLE()
 
+#if !defined  (COM_UART_RX_DMA)
+#define COM_UART_RX_DMA                         0U   /* 1: Ymodem reception through a circular GPDMA buffer */
+#endif /* COM_UART_RX_DMA */
+#define COM_UART_RX_BUFFER_SIZE                 2048U /* Circular buffer size, at least two 1K packets */
+#define COM_UART_DMA_CHANNEL                    GPDMA1_Channel0
+#define COM_UART_DMA_REQUEST                    GPDMA1_REQUEST_USART1_RX
+#define COM_UART_DMA_CLK_ENABLE()               __HAL_RCC_GPDMA1_CLK_ENABLE()
+
 /* Maximum Timeout values for flags waiting loops.
    You may modify these timeout values depending on CPU frequency and application
    conditions (interrupts routines ...). */
@@ -86,6 +94,9 @@ HAL_StatusTypeDef  COM_Receive(uint8_t *Data, uint16_t uDataLength, uint32_t uTi
 HAL_StatusTypeDef  COM_Flush(void);
 HAL_StatusTypeDef  COM_Transmit_Y(uint8_t *Data, uint16_t uDataLength, uint32_t uTimeout);
 HAL_StatusTypeDef  COM_Receive_Y(uint8_t *Data, uint16_t uDataLength, uint32_t uTimeout);
+#if (COM_UART_RX_DMA == 1U)
+HAL_StatusTypeDef  COM_Receive_Y_Partial(uint8_t *Data, uint16_t uMaxLength, uint16_t *puLength, uint32_t uTimeout);
+#endif /* (COM_UART_RX_DMA == 1U) */
 HAL_StatusTypeDef  COM_Y_On(uint8_t AbortChar);
 HAL_StatusTypeDef  COM_Y_Off(void);
 HAL_StatusTypeDef Ymodem_HeaderPktRxCpltCallback(uint32_t uFlashDestination, uint32_t uFileSize);
@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    delta_patch.h
+  * @author  MCD Application Team
+  * @brief   This file contains definitions for the delta patch functionalities.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef DELTA_PATCH_H
+#define DELTA_PATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup USER_APP User App Example
+  * @{
+  */
+
+/** @addtogroup  FW_UPDATE Firmware Update Example
+  * @{
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stdint.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  DELTA_OK             = 0x00U,  /*!< OK */
+  DELTA_ERROR_FORMAT   = 0x01U,  /*!< Malformed patch */
+  DELTA_ERROR_SIZE     = 0x02U,  /*!< Source or target image does not fit its slot */
+  DELTA_ERROR_SOURCE   = 0x03U,  /*!< Active slot content differs from the patch source image */
+  DELTA_ERROR_FLASH    = 0x04U,  /*!< Flash programming error */
+  DELTA_ERROR_TARGET   = 0x05U   /*!< Patch incomplete or target image CRC mismatch */
+} DELTA_StatusTypeDef;           /*!< Delta patch status structures definition */
+
+/* Exported constants --------------------------------------------------------*/
+/* Patch layout (all fields little endian) :
+ * | magic | source size | source crc32 | target size | target crc32 | record 0 | ... | record n |
+ * each record is bsdiff like, lengths are LEB128 varints, seek is zigzag encoded :
+ * | diff length | extra length | seek | diff tokens | extra bytes |
+ * the diff tokens rebuild diff length bytes from the source image :
+ * | copy length | add length | add bytes |
+ *   copy length bytes are copied from the source image,
+ *   add length bytes are the sum (modulo 256) of the source bytes and the add bytes,
+ * the extra bytes are copied to the target image, then the source position moves by seek. */
+#define DELTA_MAGIC             ((uint32_t)0x31544C44U)  /*!< "DLT1" */
+#define DELTA_HEADER_SIZE       ((uint32_t)20U)          /*!< Patch header size */
+#define DELTA_WRITE_BUFFER_SIZE ((uint32_t)512U)         /*!< Target write buffer size, multiple of the flash
+                                                              program unit */
+#define DELTA_SOURCE_CHUNK_SIZE ((uint32_t)256U)         /*!< Source image CRC check read size */
+
+/* Exported functions ------------------------------------------------------- */
+uint32_t DELTA_IsPatch(const uint8_t *pData, uint32_t uSize);
+void DELTA_Init(uint32_t uSourceAddr, uint32_t uSourceMaxSize, uint32_t uTargetAddr, uint32_t uTargetMaxSize,
+                uint32_t uMinWriteSize);
+DELTA_StatusTypeDef DELTA_Process(const uint8_t *pData, uint32_t uSize);
+DELTA_StatusTypeDef DELTA_Finalize(uint32_t *puTargetSize);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DELTA_PATCH_H */
@@ -36,6 +36,11 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "stdint.h"
 
+/* Exported constants --------------------------------------------------------*/
+#define FW_UPDATE_DELTA_PATCH      0U  /* 1: a delta patch downloaded for a non secure image is applied against the
+                                             image of its active slot (requires the secondary slots) */
+#define FW_UPDATE_NO_ACTIVE_SLOT   0xFFFFFFFFU /* Active slot not readable, delta patches are rejected */
+
 /** @addtogroup  FW_UPDATE_Exported_Functions
   * @{
   */
@@ -50,6 +55,8 @@ typedef struct
   uint32_t  MaxSizeInBytes;        /*!< The maximum allowed size for the FwImage in User Flash (in Bytes) */
   uint32_t  DownloadAddr;          /*!< The download address for the FwImage in UserFlash */
   uint32_t  ImageOffsetInBytes;    /*!< Image write starts at this offset */
+  uint32_t  ActiveAddr;            /*!< The active slot address of the FwImage, source of the delta patches */
+  uint32_t  ActiveMaxSizeInBytes;  /*!< The active slot size of the FwImage */
   uint32_t  ExecutionAddr;         /*!< The execution address for the FwImage in UserFlash */
 } SFU_FwImageFlashTypeDef;
 
@@ -21,6 +21,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "com.h"
 #include "stm32u5xx_hal.h"
+#include "string.h"
 
 
 
@@ -48,6 +49,24 @@ static UART_HandleTypeDef   UartHandle; /*!< Uart Handler*/
 
 static volatile int Ymodem = 0;              /*!< set to 1 when Ymodem uses UART> */
 static uint8_t Abort;
+#if (COM_UART_RX_DMA == 1U)
+static DMA_HandleTypeDef    DmaHandle;       /*!< Circular reception GPDMA channel handler */
+static DMA_NodeTypeDef      DmaNode;         /*!< Circular reception node, looping on itself */
+static DMA_QListTypeDef     DmaQueue;        /*!< Circular reception queue */
+static uint8_t RxBuffer[COM_UART_RX_BUFFER_SIZE]; /*!< Circular reception buffer */
+static uint32_t RxReadIndex;                 /*!< Next byte to read in RxBuffer */
+#endif /* (COM_UART_RX_DMA == 1U) */
+/**
+  * @}
+  */
+
+/** @defgroup  COM_Private_Functions Private Functions
+  * @{
+  */
+#if (COM_UART_RX_DMA == 1U)
+static HAL_StatusTypeDef COM_DMA_Init(void);
+static uint32_t COM_DMA_WriteIndex(void);
+#endif /* (COM_UART_RX_DMA == 1U) */
 /**
   * @}
   */
@@ -90,7 +109,15 @@ HAL_StatusTypeDef  COM_Init(void)
   UartHandle.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_RXOVERRUNDISABLE_INIT;
   UartHandle.AdvancedInit.OverrunDisable = UART_ADVFEATURE_OVERRUN_DISABLE;
   UartHandle.FifoMode = UART_FIFOMODE_ENABLE;
+#if (COM_UART_RX_DMA == 1U)
+  if (HAL_UART_Init(&UartHandle) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  return COM_DMA_Init();
+#else
   return HAL_UART_Init(&UartHandle);
+#endif /* (COM_UART_RX_DMA == 1U) */
 }
 
 /**
@@ -232,11 +259,68 @@ HAL_StatusTypeDef COM_Receive(uint8_t *Data, uint16_t uDataLength, uint32_t uTim
   */
 HAL_StatusTypeDef COM_Receive_Y(uint8_t *Data, uint16_t uDataLength, uint32_t uTimeout)
 {
+#if (COM_UART_RX_DMA == 1U)
+  HAL_StatusTypeDef status = HAL_OK;
+  uint16_t received = 0U;
+  uint16_t length;
+
+  while ((status == HAL_OK) && (received < uDataLength))
+  {
+    status = COM_Receive_Y_Partial(&Data[received], uDataLength - received, &length, uTimeout);
+    received += length;
+  }
+  return status;
+#else
   if (Ymodem)
     return HAL_UART_Receive(&UartHandle, (uint8_t *)Data, uDataLength, uTimeout);
   else
     return HAL_BUSY;
+#endif /* (COM_UART_RX_DMA == 1U) */
+}
+
+#if (COM_UART_RX_DMA == 1U)
+/**
+  * @brief Receive the Data already written by the GPDMA, function for Y modem.
+  *        Waits for the first byte, then returns without waiting for the other ones.
+  * @param uMaxLength: Maximum number of bytes to receive.
+  * @param puLength: Number of bytes received.
+  * @param uTimeout: Timeout duration for the first byte.
+  * @retval Status of the Receive operation.
+  */
+HAL_StatusTypeDef COM_Receive_Y_Partial(uint8_t *Data, uint16_t uMaxLength, uint16_t *puLength, uint32_t uTimeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t write_index;
+  uint32_t length;
+
+  *puLength = 0U;
+  if (!Ymodem)
+    return HAL_BUSY;
+
+  /* Wait until the GPDMA has written beyond the read index */
+  write_index = COM_DMA_WriteIndex();
+  while (write_index == RxReadIndex)
+  {
+    if ((HAL_GetTick() - tickstart) > uTimeout)
+    {
+      return HAL_TIMEOUT;
+    }
+    write_index = COM_DMA_WriteIndex();
+  }
+
+  /* Bytes available up to the write index or to the end of the buffer */
+  length = (write_index > RxReadIndex) ? (write_index - RxReadIndex) : (COM_UART_RX_BUFFER_SIZE - RxReadIndex);
+  if (length > uMaxLength)
+  {
+    length = uMaxLength;
+  }
+  memcpy(Data, &RxBuffer[RxReadIndex], length);
+  RxReadIndex = (RxReadIndex + length) % COM_UART_RX_BUFFER_SIZE;
+  *puLength = (uint16_t)length;
+
+  return HAL_OK;
 }
+#endif /* (COM_UART_RX_DMA == 1U) */
 
 /**
   * @brief  Flush COM Input.
@@ -247,6 +331,12 @@ HAL_StatusTypeDef COM_Flush(void)
 {
   /* Clean the input path */
   __HAL_UART_FLUSH_DRREGISTER(&UartHandle);
+#if (COM_UART_RX_DMA == 1U)
+  if (Ymodem)
+  {
+    RxReadIndex = COM_DMA_WriteIndex();
+  }
+#endif /* (COM_UART_RX_DMA == 1U) */
   return HAL_OK;
 }
 
@@ -256,6 +346,15 @@ HAL_StatusTypeDef  COM_Y_On(uint8_t AbortChar)
     HAL_StatusTypeDef status=HAL_ERROR;
     if (!Ymodem)
     {
+#if (COM_UART_RX_DMA == 1U)
+        /* The bytes received while the packets are processed are kept in RxBuffer */
+        RxReadIndex = 0U;
+        if (HAL_DMAEx_List_Start(&DmaHandle) != HAL_OK)
+        {
+            return HAL_ERROR;
+        }
+        SET_BIT(UartHandle.Instance->CR3, USART_CR3_DMAR);
+#endif /* (COM_UART_RX_DMA == 1U) */
         Ymodem = 1;
         Abort=AbortChar;
         status=HAL_OK;
@@ -267,6 +366,10 @@ HAL_StatusTypeDef  COM_Y_Off(void)
     HAL_StatusTypeDef status=HAL_ERROR;
     if (Ymodem)
     {
+#if (COM_UART_RX_DMA == 1U)
+        CLEAR_BIT(UartHandle.Instance->CR3, USART_CR3_DMAR);
+        (void)HAL_DMA_Abort(&DmaHandle);
+#endif /* (COM_UART_RX_DMA == 1U) */
         Ymodem = 0;
         status=HAL_OK;
     }
@@ -280,6 +383,72 @@ HAL_StatusTypeDef  COM_Y_Off(void)
   * @{
   */
 
+#if (COM_UART_RX_DMA == 1U)
+/**
+  * @brief  Build the GPDMA circular queue writing the UART received bytes in RxBuffer.
+  * @param  None.
+  * @retval HAL Status.
+  */
+static HAL_StatusTypeDef COM_DMA_Init(void)
+{
+  DMA_NodeConfTypeDef node_config = {0U};
+
+  COM_UART_DMA_CLK_ENABLE();
+
+  /* Single node looping on itself: UART RDR to the circular reception buffer */
+  node_config.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_config.Init.Request                        = COM_UART_DMA_REQUEST;
+  node_config.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                      = DMA_PERIPH_TO_MEMORY;
+  node_config.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_config.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_config.Init.SrcDataWidth                   = DMA_SRC_DATAWIDTH_BYTE;
+  node_config.Init.DestDataWidth                  = DMA_DEST_DATAWIDTH_BYTE;
+  node_config.Init.SrcBurstLength                 = 1U;
+  node_config.Init.DestBurstLength                = 1U;
+  node_config.Init.Priority                       = DMA_HIGH_PRIORITY;
+  node_config.Init.TransferEventMode              = DMA_TCEM_BLOCK_TRANSFER;
+  node_config.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+  node_config.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_config.SrcAddress                          = (uint32_t)&(COM_UART->RDR);
+  node_config.DstAddress                          = (uint32_t)RxBuffer;
+  node_config.DataSize                            = COM_UART_RX_BUFFER_SIZE;
+
+  if ((HAL_DMAEx_List_BuildNode(&node_config, &DmaNode) != HAL_OK)
+      || (HAL_DMAEx_List_InsertNode_Tail(&DmaQueue, &DmaNode) != HAL_OK)
+      || (HAL_DMAEx_List_SetCircularMode(&DmaQueue) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  DmaHandle.Instance                         = COM_UART_DMA_CHANNEL;
+  DmaHandle.InitLinkedList.Priority          = DMA_HIGH_PRIORITY;
+  DmaHandle.InitLinkedList.LinkStepMode      = DMA_LSM_FULL_EXECUTION;
+  DmaHandle.InitLinkedList.LinkAllocatedPort = DMA_LINK_ALLOCATED_PORT1;
+  DmaHandle.InitLinkedList.TransferEventMode = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  DmaHandle.InitLinkedList.LinkedListMode    = DMA_LINKEDLIST_CIRCULAR;
+
+  if (HAL_DMAEx_List_Init(&DmaHandle) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMAEx_List_LinkQ(&DmaHandle, &DmaQueue);
+}
+
+/**
+  * @brief  Position of the next byte written by the GPDMA in RxBuffer.
+  * @param  None.
+  * @retval Write index.
+  */
+static uint32_t COM_DMA_WriteIndex(void)
+{
+  return (COM_UART_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&DmaHandle)) % COM_UART_RX_BUFFER_SIZE;
+}
+#endif /* (COM_UART_RX_DMA == 1U) */
+
 /**
   * @}
   */
@@ -0,0 +1,491 @@
+/**
+  ******************************************************************************
+  * @file    delta_patch.c
+  * @author  MCD Application Team
+  * @brief   Delta patch module.
+  *          This file provides set of firmware functions to rebuild a new
+  *          image in the download slot from the image of the active slot and
+  *          a delta patch received by packets.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup USER_APP User App Example
+  * @{
+  */
+
+/** @addtogroup  FW_UPDATE Firmware Update Example
+  * @{
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32u5xx_hal.h"
+#include "fw_update_app.h"
+#include "delta_patch.h"
+#include "region_defs.h"
+#include "Driver_Flash.h"
+#include "string.h"
+
+#if (FW_UPDATE_DELTA_PATCH == 1)
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  DELTA_STATE_HEADER = 0U,   /*!< Receiving the patch header */
+  DELTA_STATE_DIFF_LEN,      /*!< Receiving the record diff length */
+  DELTA_STATE_EXTRA_LEN,     /*!< Receiving the record extra length */
+  DELTA_STATE_SEEK,          /*!< Receiving the record source seek */
+  DELTA_STATE_COPY_LEN,      /*!< Receiving a diff token copy length */
+  DELTA_STATE_COPY,          /*!< Copying source bytes, no patch byte consumed */
+  DELTA_STATE_ADD_LEN,       /*!< Receiving a diff token add length */
+  DELTA_STATE_ADD,           /*!< Adding patch bytes to source bytes */
+  DELTA_STATE_EXTRA,         /*!< Copying patch bytes */
+  DELTA_STATE_DONE           /*!< Target image complete */
+} DELTA_StateTypeDef;
+
+typedef struct
+{
+  uint32_t SourceAddr;                  /*!< Active slot offset in flash */
+  uint32_t SourceMaxSize;               /*!< Active slot size */
+  uint32_t TargetAddr;                  /*!< Download slot offset in flash */
+  uint32_t TargetMaxSize;               /*!< Download slot size available for the image */
+  uint32_t MinWriteSize;                /*!< Flash program unit */
+  uint32_t SourceSize;                  /*!< Source image size, from the patch header */
+  uint32_t TargetSize;                  /*!< Target image size, from the patch header */
+  uint32_t TargetCrc;                   /*!< Target image CRC32, from the patch header */
+  int32_t  SourcePos;                   /*!< Current source image position */
+  int32_t  Seek;                        /*!< Source position move at the end of the current record */
+  uint32_t TargetPos;                   /*!< Number of target bytes rebuilt */
+  uint32_t Written;                     /*!< Number of target bytes programmed */
+  uint32_t DiffLen;                     /*!< Diff bytes remaining in the current record */
+  uint32_t ExtraLen;                    /*!< Extra bytes remaining in the current record */
+  uint32_t Count;                       /*!< Bytes remaining in the current diff token */
+  uint32_t Varint;                      /*!< Varint being received */
+  uint32_t VarintShift;                 /*!< Bit position of the next varint byte */
+  uint32_t Crc;                         /*!< Running CRC32 of the programmed target bytes */
+  uint32_t BufferLen;                   /*!< Bytes waiting in the write buffer */
+  uint32_t HeaderLen;                   /*!< Header bytes received */
+  uint8_t  aHeader[DELTA_HEADER_SIZE];  /*!< Patch header */
+  DELTA_StateTypeDef State;             /*!< Patch decoding state */
+  DELTA_StatusTypeDef Status;           /*!< First error met, kept until the next DELTA_Init() */
+} DELTA_ContextTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define DELTA_VARINT_MAX_SHIFT  28U     /*!< Shift of the fifth and last byte of a 32-bit varint */
+
+/* Private macro -------------------------------------------------------------*/
+#define DELTA_GET_U32(p)        ((uint32_t)(p)[0] | ((uint32_t)(p)[1] << 8) | \
+                                 ((uint32_t)(p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+#define DELTA_MIN(a, b)         (((a) < (b)) ? (a) : (b))
+
+/* Private variables ---------------------------------------------------------*/
+extern ARM_DRIVER_FLASH LOADER_FLASH_DEV_NAME;
+static DELTA_ContextTypeDef m_Delta;
+/* @note ATTENTION - please keep this variable 32bit aligned */
+static uint32_t m_aDeltaBuffer[DELTA_WRITE_BUFFER_SIZE / sizeof(uint32_t)]; /*!< Target write buffer */
+static uint8_t *const m_pDeltaBuffer = (uint8_t *)m_aDeltaBuffer;
+
+/* CRC32 (IEEE 802.3, reflected) table, one entry per nibble */
+static const uint32_t m_aDeltaCrcTable[16] =
+{
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t DELTA_Crc(uint32_t uCrc, const uint8_t *pData, uint32_t uSize);
+static DELTA_StatusTypeDef DELTA_CheckHeader(void);
+static uint32_t DELTA_ParseVarint(uint8_t uByte);
+static DELTA_StatusTypeDef DELTA_ReadSource(uint8_t *pDest, uint32_t uSize);
+static DELTA_StatusTypeDef DELTA_Flush(void);
+static void DELTA_NextState(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Update a CRC32 with a buffer.
+  * @param  uCrc Running CRC, initialized to 0xFFFFFFFF and complemented at the end.
+  * @param  pData Pointer to the buffer.
+  * @param  uSize Buffer size (Bytes).
+  * @retval Updated CRC.
+  */
+static uint32_t DELTA_Crc(uint32_t uCrc, const uint8_t *pData, uint32_t uSize)
+{
+  uint32_t i;
+
+  for (i = 0U; i < uSize; i++)
+  {
+    uCrc ^= pData[i];
+    uCrc = (uCrc >> 4U) ^ m_aDeltaCrcTable[uCrc & 0x0FU];
+    uCrc = (uCrc >> 4U) ^ m_aDeltaCrcTable[uCrc & 0x0FU];
+  }
+
+  return uCrc;
+}
+
+/**
+  * @brief  Check the patch header against the slots and the active slot image.
+  * @param  None
+  * @retval Delta status.
+  */
+static DELTA_StatusTypeDef DELTA_CheckHeader(void)
+{
+  uint32_t source_crc = 0xFFFFFFFFU;
+  uint32_t offset;
+  uint32_t length;
+
+  if (DELTA_GET_U32(&m_Delta.aHeader[0]) != DELTA_MAGIC)
+  {
+    return DELTA_ERROR_FORMAT;
+  }
+  m_Delta.SourceSize = DELTA_GET_U32(&m_Delta.aHeader[4]);
+  m_Delta.TargetSize = DELTA_GET_U32(&m_Delta.aHeader[12]);
+  m_Delta.TargetCrc = DELTA_GET_U32(&m_Delta.aHeader[16]);
+
+  if ((m_Delta.SourceSize > m_Delta.SourceMaxSize) || (m_Delta.TargetSize > m_Delta.TargetMaxSize)
+      || (m_Delta.TargetSize == 0U))
+  {
+    return DELTA_ERROR_SIZE;
+  }
+
+  /* The patch only applies to the exact image it was generated from */
+  for (offset = 0U; offset < m_Delta.SourceSize; offset += length)
+  {
+    length = DELTA_MIN(DELTA_SOURCE_CHUNK_SIZE, m_Delta.SourceSize - offset);
+    (void)memcpy(m_pDeltaBuffer, (const void *)(FLASH_BASE_NS + m_Delta.SourceAddr + offset), length);
+    source_crc = DELTA_Crc(source_crc, m_pDeltaBuffer, length);
+  }
+  if (~source_crc != DELTA_GET_U32(&m_Delta.aHeader[8]))
+  {
+    return DELTA_ERROR_SOURCE;
+  }
+
+  m_Delta.State = DELTA_STATE_DIFF_LEN;
+  return DELTA_OK;
+}
+
+/**
+  * @brief  Receive one byte of a LEB128 varint.
+  * @param  uByte Patch byte.
+  * @retval 1 when the varint is complete in m_Delta.Varint, 0 otherwise.
+  */
+static uint32_t DELTA_ParseVarint(uint8_t uByte)
+{
+  if (m_Delta.VarintShift > DELTA_VARINT_MAX_SHIFT)
+  {
+    m_Delta.Status = DELTA_ERROR_FORMAT;
+    return 0U;
+  }
+  m_Delta.Varint |= ((uint32_t)uByte & 0x7FU) << m_Delta.VarintShift;
+  if ((uByte & 0x80U) != 0U)
+  {
+    m_Delta.VarintShift += 7U;
+    return 0U;
+  }
+  m_Delta.VarintShift = 0U;
+  return 1U;
+}
+
+/**
+  * @brief  Read source bytes at the current source position from the active slot.
+  * @param  pDest Pointer to the destination buffer.
+  * @param  uSize Number of bytes.
+  * @retval Delta status.
+  */
+static DELTA_StatusTypeDef DELTA_ReadSource(uint8_t *pDest, uint32_t uSize)
+{
+  if ((m_Delta.SourcePos < 0) || ((uint32_t)m_Delta.SourcePos > m_Delta.SourceSize)
+      || (uSize > (m_Delta.SourceSize - (uint32_t)m_Delta.SourcePos)))
+  {
+    return DELTA_ERROR_FORMAT;
+  }
+  (void)memcpy(pDest, (const void *)(FLASH_BASE_NS + m_Delta.SourceAddr + (uint32_t)m_Delta.SourcePos), uSize);
+  m_Delta.SourcePos += (int32_t)uSize;
+
+  return DELTA_OK;
+}
+
+/**
+  * @brief  Program the write buffer in the download slot.
+  *         The last buffer of the image is padded with 0xFF up to the flash program unit.
+  * @param  None
+  * @retval Delta status.
+  */
+static DELTA_StatusTypeDef DELTA_Flush(void)
+{
+  uint32_t length = m_Delta.BufferLen;
+
+  if (length == 0U)
+  {
+    return DELTA_OK;
+  }
+  m_Delta.Crc = DELTA_Crc(m_Delta.Crc, m_pDeltaBuffer, length);
+  if ((length % m_Delta.MinWriteSize) != 0U)
+  {
+    (void)memset(&m_pDeltaBuffer[length], 0xFF, m_Delta.MinWriteSize - (length % m_Delta.MinWriteSize));
+    length += m_Delta.MinWriteSize - (length % m_Delta.MinWriteSize);
+  }
+  if (LOADER_FLASH_DEV_NAME.ProgramData(m_Delta.TargetAddr + m_Delta.Written, m_pDeltaBuffer, length)
+      != ARM_DRIVER_OK)
+  {
+    return DELTA_ERROR_FLASH;
+  }
+  m_Delta.Written += length;
+  m_Delta.BufferLen = 0U;
+
+  return DELTA_OK;
+}
+
+/**
+  * @brief  Move to the next diff token, to the extra bytes or to the next record.
+  * @param  None
+  * @retval None
+  */
+static void DELTA_NextState(void)
+{
+  if (m_Delta.DiffLen != 0U)
+  {
+    m_Delta.State = DELTA_STATE_COPY_LEN;
+  }
+  else if (m_Delta.ExtraLen != 0U)
+  {
+    m_Delta.State = DELTA_STATE_EXTRA;
+  }
+  else
+  {
+    m_Delta.SourcePos += m_Delta.Seek;
+    m_Delta.State = (m_Delta.TargetPos == m_Delta.TargetSize) ? DELTA_STATE_DONE : DELTA_STATE_DIFF_LEN;
+  }
+}
+
+/* Exported functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Check if a downloaded file is a delta patch.
+  * @param  pData Pointer to the first packet of the file.
+  * @param  uSize Packet dimension (Bytes).
+  * @retval 1 when the file starts with the delta patch magic, 0 otherwise.
+  */
+uint32_t DELTA_IsPatch(const uint8_t *pData, uint32_t uSize)
+{
+  return ((uSize >= DELTA_HEADER_SIZE) && (DELTA_GET_U32(pData) == DELTA_MAGIC)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Start the rebuild of a new image from a delta patch.
+  * @param  uSourceAddr Active slot offset in flash, readable through its non secure alias.
+  * @param  uSourceMaxSize Active slot size (Bytes).
+  * @param  uTargetAddr Download slot offset in flash, erased.
+  * @param  uTargetMaxSize Download slot size available for the image (Bytes).
+  * @param  uMinWriteSize Flash program unit (Bytes), divisor of DELTA_WRITE_BUFFER_SIZE.
+  * @retval None
+  */
+void DELTA_Init(uint32_t uSourceAddr, uint32_t uSourceMaxSize, uint32_t uTargetAddr, uint32_t uTargetMaxSize,
+                uint32_t uMinWriteSize)
+{
+  (void)memset(&m_Delta, 0, sizeof(m_Delta));
+  m_Delta.SourceAddr = uSourceAddr;
+  m_Delta.SourceMaxSize = uSourceMaxSize;
+  m_Delta.TargetAddr = uTargetAddr;
+  m_Delta.TargetMaxSize = uTargetMaxSize;
+  m_Delta.MinWriteSize = uMinWriteSize;
+  m_Delta.Crc = 0xFFFFFFFFU;
+  m_Delta.State = DELTA_STATE_HEADER;
+  m_Delta.Status = DELTA_OK;
+}
+
+/**
+  * @brief  Apply the next part of the delta patch.
+  *         The target image is rebuilt in the write buffer and programmed each time the buffer is full.
+  * @param  pData Pointer to the patch bytes.
+  * @param  uSize Number of patch bytes.
+  * @retval Delta status.
+  */
+DELTA_StatusTypeDef DELTA_Process(const uint8_t *pData, uint32_t uSize)
+{
+  uint32_t index = 0U;
+  uint32_t length;
+  uint32_t i;
+
+  while ((m_Delta.Status == DELTA_OK) && ((index < uSize) || (m_Delta.State == DELTA_STATE_COPY)))
+  {
+    switch (m_Delta.State)
+    {
+      case DELTA_STATE_HEADER:
+        m_Delta.aHeader[m_Delta.HeaderLen] = pData[index];
+        m_Delta.HeaderLen++;
+        index++;
+        if (m_Delta.HeaderLen == DELTA_HEADER_SIZE)
+        {
+          m_Delta.Status = DELTA_CheckHeader();
+        }
+        break;
+
+      case DELTA_STATE_DIFF_LEN:
+        if (DELTA_ParseVarint(pData[index++]) != 0U)
+        {
+          m_Delta.DiffLen = m_Delta.Varint;
+          m_Delta.Varint = 0U;
+          m_Delta.State = DELTA_STATE_EXTRA_LEN;
+        }
+        break;
+
+      case DELTA_STATE_EXTRA_LEN:
+        if (DELTA_ParseVarint(pData[index++]) != 0U)
+        {
+          m_Delta.ExtraLen = m_Delta.Varint;
+          m_Delta.Varint = 0U;
+          m_Delta.State = DELTA_STATE_SEEK;
+        }
+        break;
+
+      case DELTA_STATE_SEEK:
+        if (DELTA_ParseVarint(pData[index++]) != 0U)
+        {
+          /* zigzag decoding */
+          m_Delta.Seek = (int32_t)(m_Delta.Varint >> 1U) ^ -(int32_t)(m_Delta.Varint & 1U);
+          m_Delta.Varint = 0U;
+          if ((m_Delta.DiffLen > (m_Delta.TargetSize - m_Delta.TargetPos))
+              || (m_Delta.ExtraLen > (m_Delta.TargetSize - m_Delta.TargetPos - m_Delta.DiffLen)))
+          {
+            m_Delta.Status = DELTA_ERROR_FORMAT;
+          }
+          else
+          {
+            DELTA_NextState();
+          }
+        }
+        break;
+
+      case DELTA_STATE_COPY_LEN:
+      case DELTA_STATE_ADD_LEN:
+        if (DELTA_ParseVarint(pData[index++]) != 0U)
+        {
+          if (m_Delta.Varint > m_Delta.DiffLen)
+          {
+            m_Delta.Status = DELTA_ERROR_FORMAT;
+          }
+          else
+          {
+            m_Delta.Count = m_Delta.Varint;
+            m_Delta.DiffLen -= m_Delta.Varint;
+            if (m_Delta.State == DELTA_STATE_COPY_LEN)
+            {
+              m_Delta.State = DELTA_STATE_COPY;
+            }
+            else if (m_Delta.Count != 0U)
+            {
+              m_Delta.State = DELTA_STATE_ADD;
+            }
+            else
+            {
+              DELTA_NextState();
+            }
+          }
+          m_Delta.Varint = 0U;
+        }
+        break;
+
+      case DELTA_STATE_COPY:
+        length = DELTA_MIN(m_Delta.Count, DELTA_WRITE_BUFFER_SIZE - m_Delta.BufferLen);
+        m_Delta.Status = DELTA_ReadSource(&m_pDeltaBuffer[m_Delta.BufferLen], length);
+        m_Delta.BufferLen += length;
+        m_Delta.TargetPos += length;
+        m_Delta.Count -= length;
+        if (m_Delta.Count == 0U)
+        {
+          m_Delta.State = DELTA_STATE_ADD_LEN;
+        }
+        break;
+
+      case DELTA_STATE_ADD:
+        length = DELTA_MIN(DELTA_MIN(m_Delta.Count, uSize - index), DELTA_WRITE_BUFFER_SIZE - m_Delta.BufferLen);
+        m_Delta.Status = DELTA_ReadSource(&m_pDeltaBuffer[m_Delta.BufferLen], length);
+        for (i = 0U; i < length; i++)
+        {
+          m_pDeltaBuffer[m_Delta.BufferLen + i] += pData[index + i];
+        }
+        index += length;
+        m_Delta.BufferLen += length;
+        m_Delta.TargetPos += length;
+        m_Delta.Count -= length;
+        if (m_Delta.Count == 0U)
+        {
+          DELTA_NextState();
+        }
+        break;
+
+      case DELTA_STATE_EXTRA:
+        length = DELTA_MIN(DELTA_MIN(m_Delta.ExtraLen, uSize - index), DELTA_WRITE_BUFFER_SIZE - m_Delta.BufferLen);
+        (void)memcpy(&m_pDeltaBuffer[m_Delta.BufferLen], &pData[index], length);
+        index += length;
+        m_Delta.BufferLen += length;
+        m_Delta.TargetPos += length;
+        m_Delta.ExtraLen -= length;
+        if (m_Delta.ExtraLen == 0U)
+        {
+          DELTA_NextState();
+        }
+        break;
+
+      default:
+        /* Patch bytes after the end of the target image */
+        m_Delta.Status = DELTA_ERROR_FORMAT;
+        break;
+    }
+
+    if ((m_Delta.Status == DELTA_OK) && (m_Delta.BufferLen == DELTA_WRITE_BUFFER_SIZE))
+    {
+      m_Delta.Status = DELTA_Flush();
+    }
+  }
+
+  return m_Delta.Status;
+}
+
+/**
+  * @brief  End the rebuild of the new image.
+  *         The remaining bytes are programmed and the target image CRC is checked.
+  * @param  puTargetSize Pointer to the rebuilt image size (Bytes).
+  * @retval Delta status.
+  */
+DELTA_StatusTypeDef DELTA_Finalize(uint32_t *puTargetSize)
+{
+  if (m_Delta.Status != DELTA_OK)
+  {
+    return m_Delta.Status;
+  }
+  if (m_Delta.State != DELTA_STATE_DONE)
+  {
+    return DELTA_ERROR_TARGET;
+  }
+  m_Delta.Status = DELTA_Flush();
+  if (m_Delta.Status != DELTA_OK)
+  {
+    return m_Delta.Status;
+  }
+  if (~m_Delta.Crc != m_Delta.TargetCrc)
+  {
+    return DELTA_ERROR_TARGET;
+  }
+  *puTargetSize = m_Delta.TargetSize;
+
+  return DELTA_OK;
+}
+#endif /* (FW_UPDATE_DELTA_PATCH == 1) */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
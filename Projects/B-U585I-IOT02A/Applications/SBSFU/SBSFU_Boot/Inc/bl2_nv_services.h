@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @file    bl2_nv_services.h
+  * @author  MCD Application Team
+  * @brief   Header for BL2 non volatile counters services in bl2_nv_services.c module
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef BL2_NV_SERVICES_H
+#define BL2_NV_SERVICES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "platform/include/plat_nv_counters.h"
+#include "stm32u5xx_hal.h"
+
+/* Max number of counters updated by one plat_set_nv_counters call */
+#define NVCNT_MAX_BATCH   ((uint32_t)PLAT_NV_COUNTER_MAX - (uint32_t)PLAT_NV_COUNTER_3)
+
+HAL_StatusTypeDef plat_set_nv_counters(const enum nv_counter_t *CounterId, const uint32_t *Data,
+                                       uint32_t Nb, uint32_t *Updated);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BL2_NV_SERVICES_H */
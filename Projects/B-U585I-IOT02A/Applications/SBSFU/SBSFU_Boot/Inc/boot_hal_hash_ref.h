@@ -34,6 +34,10 @@ int boot_hash_ref_store(void);
 int boot_hash_ref_load(void);
 int boot_hash_ref_set(uint8_t *hash_ref, uint8_t size, uint8_t image_index);
 int boot_hash_ref_get(uint8_t *hash_ref, uint8_t size, uint8_t image_index);
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+int boot_verified_ref_hash_get(uint8_t *hash, uint8_t size, uint8_t image_index);
+int boot_verified_ref_update(void);
+#endif /* MCUBOOT_USE_VERIFIED_REF */
 
 #ifdef __cplusplus
 }
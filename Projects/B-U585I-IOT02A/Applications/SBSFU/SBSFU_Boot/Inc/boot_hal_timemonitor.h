@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    boot_hal_timemonitor.h
+  * @author  MCD Application Team
+  * @brief   Header for boot time breakdown services in boot_hal.c module
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef BOOT_HAL_TIMEMONITOR_H
+#define BOOT_HAL_TIMEMONITOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Boot time breakdown printed before the jump to the application, in cycles of the DWT cycle counter
+   (TFM_DEV_MODE only : the cycle counter does not run in secure state once debug is closed) */
+/*
+#define BOOT_TIME_MONITOR
+*/
+
+#if defined(BOOT_TIME_MONITOR)
+#include "stm32u5xx.h"
+
+#define BOOT_TIME_FLASH_READ  (0U)  /*!< Flash_ReadData, CPU copy from flash */
+#define BOOT_TIME_HASH        (1U)  /*!< mbedtls_sha256_update and mbedtls_sha256_finish */
+#define BOOT_TIME_HASH_WAIT   (2U)  /*!< Part of BOOT_TIME_HASH waiting for the HASH DMA transfers */
+#define BOOT_TIME_ECDSA       (3U)  /*!< mbedtls_ecdsa_verify */
+#define BOOT_TIME_VERIFIED    (4U)  /*!< boot_verified_ref_hash_get (MCUBOOT_USE_VERIFIED_REF) */
+#define BOOT_TIME_NB          (5U)
+
+extern uint32_t BootTimeCycles[BOOT_TIME_NB];
+
+#define BOOT_TIME_START(start)      uint32_t start = DWT->CYCCNT
+#define BOOT_TIME_STOP(id, start)   BootTimeCycles[(id)] += DWT->CYCCNT - (start)
+#else
+#define BOOT_TIME_START(start)
+#define BOOT_TIME_STOP(id, start)
+#endif /* BOOT_TIME_MONITOR */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_HAL_TIMEMONITOR_H */
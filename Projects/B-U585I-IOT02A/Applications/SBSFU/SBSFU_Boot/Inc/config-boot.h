@@ -116,6 +116,15 @@
 
 #endif /* BL2_HW_ACCEL_ENABLE */
 
+/* Feed the HASH through the GPDMA (sha256_alt.c) : the hash of a data chunk runs while the next chunk is read
+   from flash */
+/* #define HW_CRYPTO_HASH_DMA */
+
+/* Keep the PKA initialized between the ECC operations of the boot (public key checks, signature verifications,
+   image key decryption) : the PKA RAM is reset after each operation, the PKA is de-initialized by
+   ST_PKA_SessionEnd before leaving the boot */
+/* #define HW_CRYPTO_PKA_SESSION */
+
 /* mbedtls >3.6 compatibility */
 #define MBEDTLS_ALLOW_PRIVATE_ACCESS
 #define MBEDTLS_DEPRECATED_REMOVED
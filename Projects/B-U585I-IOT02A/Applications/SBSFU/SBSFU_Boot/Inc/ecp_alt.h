@@ -174,6 +174,14 @@ mbedtls_ecp_group;
 
 /* \} name SECTION: Module settings */
 
+/* PKA operations shared by ecp_alt.c and ecdsa_alt.c */
+void ST_PKA_Enable(void);
+PKA_HandleTypeDef *ST_PKA_Open(void);
+void ST_PKA_Close(void);
+#if defined(HW_CRYPTO_PKA_SESSION)
+void ST_PKA_SessionEnd(void);
+#endif /* HW_CRYPTO_PKA_SESSION */
+
 #endif /* MBEDTLS_ECP_ALT */
 
 #ifdef __cplusplus
@@ -40,6 +40,9 @@
 #define ST_SHA256_EXTRA_BYTES ((size_t)  4)         /*!< One supplementary word on first block */
 #define ST_SHA256_NB_HASH_REG ((uint32_t)57)        /*!< Number of HASH HW context Registers:
                                                          CR + STR + IMR + CSR[54] */
+#if defined(HW_CRYPTO_HASH_DMA)
+#define ST_SHA256_DMA_BUFFER_SIZE ((size_t) 256)    /*!< DMA staging buffer, multiple of ST_SHA256_BLOCK_SIZE */
+#endif /* HW_CRYPTO_HASH_DMA */
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -63,6 +66,9 @@ typedef struct mbedtls_sha256_context
   uint8_t sbuf_len;                               /*!< Number of bytes stored in sbuf */
   uint8_t ctx_save_regs[ST_SHA256_NB_HASH_REG * 4];
   uint8_t first;                                  /*!< Extra-bytes on first computed block */
+#if defined(HW_CRYPTO_HASH_DMA)
+  uint8_t dma_pending;                            /*!< A DMA transfer to the HASH is in progress */
+#endif /* HW_CRYPTO_HASH_DMA */
 }
 mbedtls_sha256_context;
 
@@ -30,11 +30,25 @@
          header (32bits) is written in NV area.
 
       (#) NVCNT counter access functions:
-           (++) Write Monothonic counter using plat_set_nv_counter or plat_set_nv_counter functions
+           (++) Write Monothonic counter using plat_set_nv_counter or plat_set_nv_counters functions
                 A Clean Up request can be raised as return parameter in case
                 FLASH pages used by EEPROM emulation, are full.
+                plat_set_nv_counters writes several counters in one flash program operation.
            (++) Read monothonic counter using plat_read_nv_counter functions
 
+      (#) NV area organization:
+           (++) The NV area is a log : each counter update appends one element (one flash
+                quad-word, programmed at once), the area is never erased.
+           (++) The log is scanned once, at initialization, to build a RAM index of the
+                counter values : the counter reads do not access the flash.
+           (++) An element whose programming was interrupted by a power down, with a wrong
+                CRC, is skipped : the counter keeps its previous value. A batch interrupted by
+                a power down is applied up to the interrupted element.
+           (++) A zeroed element (also the read value of a double ECC error) is skipped as an
+                interrupted programming when no valid element follows it. The next write
+                appends first an acknowledge element holding its offset. A zeroed element
+                followed by another valid element is considered as a tampered NV area.
+
   @endverbatim
   ******************************************************************************
   */
@@ -43,6 +57,7 @@
 #include "boot_hal_cfg.h"
 #include "string.h"
 #include "platform/include/plat_nv_counters.h"
+#include "bl2_nv_services.h"
 #ifdef TFM_DEV_MODE
 #define BOOT_LOG_LEVEL BOOT_LOG_LEVEL_INFO
 #else
@@ -81,6 +96,8 @@
   */
 #define HEADER_SIZE                4U
 #define NVCNT_ID_HEADER            ((NVCNT_ID_TYPE)0x4855)
+/* Acknowledge of zeroed elements ending the log, its data is the offset of the first one */
+#define NVCNT_ID_TORN              ((NVCNT_ID_TYPE)0x544E)
 #define NVCNT_HEADER_VALUE         (uint32_t)(0xaaddeecc)
 /* Configuration of crc calculation for eeprom emulation in flash */
 #define NVCNT_ID_TYPE              uint16_t                      /*!< Type of Virtual Address */
@@ -97,12 +114,12 @@
 #define NVCNT_CRC_VALUE(__ELEMENT__) (NVCNT_CRC_TYPE)(((__ELEMENT__) & NVCNT_MASK_CRC) >> NVCNT_CRC_SHIFT)
 /*!< Get element value from id, data and crc values */
 #define NVCNT_ELEMENT_VALUE(__ID__,__DATA__,__CRC__) (((NVCNT_ELEMENT_TYPE)(__DATA__) << NVCNT_DATA_SHIFT)\
-                                                      | (__CRC__) << NVCNT_CRC_SHIFT | (__ID__))
+                                                      | ((NVCNT_ELEMENT_TYPE)(__CRC__) << NVCNT_CRC_SHIFT) | (__ID__))
 #define CRC_POLYNOMIAL_LENGTH   LL_CRC_POLYLENGTH_16B /* CRC polynomial length 16 bits */
 #define CRC_POLYNOMIAL_VALUE    0x8005U /* Polynomial to use for CRC calculation */
 #define NVCNT_ELEMENT_TYPE uint64_t
 /* only 64bits are used to store data , information is stored only in lsb other 64 bits area is useless */
-#define NVCNT_ELEMENT_SIZE 2*sizeof(NVCNT_ELEMENT_TYPE)
+#define NVCNT_ELEMENT_SIZE (2U * sizeof(NVCNT_ELEMENT_TYPE))
 #define PAGE_HEADER_SIZE  ((HEADER_SIZE/sizeof(NVCNT_DATA_TYPE))*NVCNT_ELEMENT_SIZE)
 /*!< Flash value after erase */
 #define NVCNT_PAGESTAT_ERASED (uint64_t)0xFFFFFFFFFFFFFFFFU /*!< Flash value after erase */
@@ -114,6 +131,11 @@
                                                          & NVCNT_MASK_DATA) >> NVCNT_DATA_SHIFT)
 
 #define NVCNT_INIT_VALUE 0U
+/*!< Number of counters managed and index of a counter in RAM index */
+#define NVCNT_NB_COUNTERS          NVCNT_MAX_BATCH
+#define NVCNT_INDEX(__ID__)        ((uint32_t)(__ID__) - (uint32_t)PLAT_NV_COUNTER_3)
+#define NVCNT_IS_VALID_ID(__ID__)  (((uint32_t)(__ID__) >= (uint32_t)PLAT_NV_COUNTER_3) \
+                                    && ((uint32_t)(__ID__) < (uint32_t)PLAT_NV_COUNTER_MAX))
 /* Private variables ---------------------------------------------------------*/
 /** @defgroup NVCNT_Private_Variables NVCNT Private Variables
   * @{
@@ -123,6 +145,12 @@ extern ARM_DRIVER_FLASH FLASH_DEV_NAME;
 /* Global variables used to store eeprom status */
 static uint32_t uhNbWrittenElements = 0U;                  /*!< Nb of elements written in valid and active pages */
 static uint32_t uwAddressNextWrite = PAGE_HEADER_SIZE;     /*!< Initialize write position just after page header */
+static uint32_t uwTornOffset = 0U;                         /*!< First zeroed element not acknowledged, 0 if none */
+
+/* RAM index of the counters, built from the NV area at initialization */
+static NVCNT_DATA_TYPE NvCntValue[NVCNT_NB_COUNTERS];        /*!< Last value of each counter */
+static uint32_t uwNvCntFound = 0U;                           /*!< Counters present in NV area (bit field) */
+static bool bNvCntIndexReady = false;                        /*!< RAM index built */
 
 /**
   * @}
@@ -138,6 +166,8 @@ static uint16_t CalculateCrc(NVCNT_DATA_TYPE Data, uint16_t CounterIc);
 static bool Check_Header(void);
 static bool Write_Header(void);
 static bool init_counter(void);
+static HAL_StatusTypeDef BuildIndex(void);
+static HAL_StatusTypeDef WriteElements(const NVCNT_ELEMENT_TYPE *Element, uint32_t NbElements);
 /**
   * @}
   */
@@ -157,10 +187,6 @@ static bool init_counter(void);
   */
 HAL_StatusTypeDef plat_init_nv_counter(void)
 {
-
-  int32_t  err;
-  uint32_t  varidx = 0U;
-  NVCNT_ELEMENT_TYPE addressvalue[2] = {0U, 0U};
   NVCNT_DATA_TYPE counter_value;
 
   /*********************************************************************/
@@ -208,6 +234,12 @@ HAL_StatusTypeDef plat_init_nv_counter(void)
     return HAL_ERROR;
   }
   BOOT_LOG_INF("Checking BL2 NV Counter consistency");
+  /* Build RAM index : one scan of the NV area, also checking the counters history */
+  if (BuildIndex() != HAL_OK)
+  {
+    BOOT_LOG_ERR("BL2 NV Counters history not consistent");
+    return HAL_ERROR;
+  }
   if (plat_read_nv_counter(PLAT_NV_COUNTER_3, sizeof(counter_value),
                                (uint8_t *)&counter_value) != HAL_OK)
   {
@@ -245,41 +277,7 @@ HAL_StatusTypeDef plat_init_nv_counter(void)
   BOOT_LOG_INF("Consistent BL2 NV Counter %d  = 0x%x", PLAT_NV_COUNTER_6, counter_value);
 #endif
 
-  /*********************************************************************/
-  /* Step 2: Initialize eeprom emulation global variables relative     */
-  /*                                                                   */
-  /*********************************************************************/
-  /* Initialize global variables, with elements detected in active page */
-  uhNbWrittenElements = 0U;
-  uwAddressNextWrite = PAGE_HEADER_SIZE;
-
-  for (varidx = PAGE_HEADER_SIZE; varidx < BL2_NV_COUNTERS_AREA_SIZE; varidx += NVCNT_ELEMENT_SIZE)
-  {
-    /* Check elements present in active page */
-    err = FLASH_DEV_NAME.ReadData(BL2_NV_COUNTERS_AREA_ADDR + varidx, &addressvalue[0],
-                                  sizeof(addressvalue));
-    if ((err == ARM_DRIVER_ERROR_SPECIFIC) || 
-        ((addressvalue[0] != NVCNT_MASK_FULL) 
-          &&(addressvalue[1] != NVCNT_MASK_FULL) )
-        )
-    {
-      /* Then increment uhNbWrittenElements and uwAddressNextWrite */
-      uhNbWrittenElements++;
-      uwAddressNextWrite += NVCNT_ELEMENT_SIZE;
-    }
-    else /* no more element in the page */
-    {
-      if (err != ARM_DRIVER_OK)
-      {
-        return HAL_ERROR;
-      }
-      break;
-    }
-  }
-
-  /*********************************************************************/
-  /* Step 2 : Check consistency of PLAT_NV_COUNTER_3 counter history   */
-  /*********************************************************************/
+  /* Global variables relative to write access are initialized by the RAM index build */
   return HAL_OK;
 }
 
@@ -288,140 +286,130 @@ HAL_StatusTypeDef plat_init_nv_counter(void)
   * @warning This function is not reentrant
   * @param  CounterId to be written
   * @param  Data 32bits data to be written
+  * @param  Updated reset to 0
   * @retval enum tfm_plat_err_t
   *           HAL_OK on write successfully done.
-              HAL_ERROR when max updateable value written
+  *           HAL_ERROR when max updateable value written
   */
 HAL_StatusTypeDef plat_set_nv_counter(enum nv_counter_t CounterId,
                                       uint32_t Data, uint32_t *Updated)
 {
-  int32_t err;
+  return plat_set_nv_counters(&CounterId, &Data, 1U, Updated);
+}
+
+/**
+  * @brief  Writes/updates several counters data in NV area, in one flash program operation.
+  * @note   The elements are written in the requested order, the counters with an unchanged
+  *         value being omitted. After a power down during the operation, the counters before
+  *         the interrupted element have their new value, the others their previous value :
+  *         the interrupted element is skipped at next initialization (wrong CRC, or zeroed
+  *         element acknowledged by the next write).
+  * @warning This function is not reentrant
+  * @param  CounterId table of counters to be written
+  * @param  Data table of 32bits data to be written
+  * @param  Nb number of counters to be written (NVCNT_MAX_BATCH max)
+  * @param  Updated reset to 0
+  * @retval enum tfm_plat_err_t
+  *           HAL_OK on write successfully done.
+  *           HAL_ERROR when a counter is present twice or decreases, when max updateable
+  *           value written or on flash error
+  */
+HAL_StatusTypeDef plat_set_nv_counters(const enum nv_counter_t *CounterId, const uint32_t *Data,
+                                       uint32_t Nb, uint32_t *Updated)
+{
   uint32_t crc = 0U;
-  NVCNT_ELEMENT_TYPE element[2];
+  NVCNT_ELEMENT_TYPE element[2U * NVCNT_NB_COUNTERS];
   NVCNT_DATA_TYPE current_value;
-  
+  uint32_t nb_elements = 0U;
+  uint32_t requested = 0U;
+  uint32_t i;
+
   /* reset Updated flag */
   *Updated = 0U;
 
-  /* check current value is not already in flash, and is consistent */
-  if ((plat_read_nv_counter(CounterId, sizeof(current_value), (uint8_t *)&current_value)
-       != HAL_OK) || (Data < current_value))
+  if (Nb > NVCNT_NB_COUNTERS)
   {
     return HAL_ERROR;
   }
-  /* check if same value is requested */
-  if (current_value == Data)
+
+  for (i = 0U; i < Nb; i++)
   {
-    /* nothing to do */
-    return HAL_OK;
+    /* check current value is not already in flash, and is consistent */
+    if ((plat_read_nv_counter(CounterId[i], sizeof(current_value), (uint8_t *)&current_value)
+         != HAL_OK) || (Data[i] < current_value))
+    {
+      return HAL_ERROR;
+    }
+    /* a counter written twice in one batch would break its history */
+    if ((requested & (1UL << NVCNT_INDEX(CounterId[i]))) != 0U)
+    {
+      return HAL_ERROR;
+    }
+    requested |= 1UL << NVCNT_INDEX(CounterId[i]);
+    /* check if same value is requested */
+    if (current_value == Data[i])
+    {
+      /* nothing to do */
+      continue;
+    }
+
+    /* Calculate crc of variable data and virtual address */
+    crc = CalculateCrc(Data[i], CounterId[i]);
+    /*  build element  */
+    element[2U * nb_elements] = NVCNT_ELEMENT_VALUE(CounterId[i], Data[i], crc);
+    element[(2U * nb_elements) + 1U] = element[2U * nb_elements];
+    nb_elements++;
   }
 
-  /* Check if pages are full, i.e. max number of written elements achieved */
-  if (uhNbWrittenElements >= NVCNT_MAX_WRITTEN_ELEMENTS)
+  if (nb_elements == 0U)
   {
-    return HAL_ERROR;
+    return HAL_OK;
   }
 
-  /* Calculate crc of variable data and virtual address */
-  crc = CalculateCrc(Data, CounterId);
-  /*  build element  */
-  element[0] = NVCNT_ELEMENT_VALUE(CounterId, Data, crc);
-  element[1] = element[0];
-  /* Program variable data + virtual address + crc */
-  err = FLASH_DEV_NAME.ProgramData(BL2_NV_COUNTERS_AREA_ADDR + uwAddressNextWrite,
-                                   &element[0],
-                                   NVCNT_ELEMENT_SIZE);
-
-  /* If program operation was failed, a Flash error code is returned */
-  if (err != ARM_DRIVER_OK)
+  /* Program variable data + virtual address + crc of all the counters */
+  if (WriteElements(element, nb_elements) != HAL_OK)
   {
     return HAL_ERROR;
   }
 
-  /* Increment global variables relative to write operation done*/
-  uwAddressNextWrite += NVCNT_ELEMENT_SIZE;
-  uhNbWrittenElements++;
-  BOOT_LOG_INF("Counter %d set to 0x%x", CounterId, Data);
+  for (i = 0U; i < nb_elements; i++)
+  {
+    BOOT_LOG_INF("Counter %d set to 0x%x", NVCNT_ID_VALUE(element[2U * i]), NVCNT_DATA_VALUE(element[2U * i]));
+  }
   return HAL_OK;
 }
 
+/**
+  * @brief  Reads counter data from RAM index.
+  * @note   The RAM index is built at first call if plat_init_nv_counter has not been called.
+  * @param  CounterId to be read
+  * @param  size size of val buffer
+  * @param  val 32bits data read
+  * @retval enum tfm_plat_err_t
+  *           HAL_OK on read successfully done.
+              HAL_ERROR when counter not found or NV area not consistent
+  */
 HAL_StatusTypeDef plat_read_nv_counter(enum nv_counter_t CounterId,
                                              uint32_t size, uint8_t *val)
 {
-  NVCNT_ELEMENT_TYPE addressvalue[2] = {0U, 0U};
-  uint32_t counter = 0U;
-  uint32_t crc = 0U;
-  uint32_t found = 0;
-  uint32_t previous_value = 0;
-  uint32_t current_value = 0;
-  int32_t err;
-
   if (size < sizeof(NVCNT_DATA_TYPE))
   {
     return HAL_ERROR;
   }
-  /* Search variable in active page and valid pages until erased page is found
-     or in erasing pages until erased page is found */
-
-  /* Set counter index to last element position in the page */
-  counter = BL2_NV_COUNTERS_AREA_SIZE - NVCNT_ELEMENT_SIZE;
-
-  /* Check each page address starting from end */
-  while (counter >= PAGE_HEADER_SIZE)
-  {
-    /* Get the current location content to be compared with virtual address */
-    err = FLASH_DEV_NAME.ReadData(BL2_NV_COUNTERS_AREA_ADDR + counter, &addressvalue[0],
-                                  sizeof(addressvalue));
-
-    if ((err == ARM_DRIVER_OK) && (addressvalue[0] != NVCNT_PAGESTAT_ERASED))
-    {
-      /* check a zero is not written , zero is forbidden, zero can be used to clean a value  */
-      if (addressvalue[0] == 0)
-      {
-        return HAL_ERROR;
-      }
-
-      /* Compare the read address with the virtual address */
-      if (NVCNT_ID_VALUE(addressvalue[0]) == CounterId)
-      {
-        /* Calculate crc of variable data and virtual address */
-        crc = CalculateCrc(NVCNT_DATA_VALUE(addressvalue[0]), NVCNT_ID_VALUE(addressvalue[0]));
-
-        /* if crc verification pass, data is correct and is returned.
-           if crc verification fails, data is corrupted and has to be skip */
-        if (crc == NVCNT_CRC_VALUE(addressvalue[0]))
-        {
-          if (found != 1)
-          {
-            *((uint32_t *)val) = NVCNT_DATA_VALUE(addressvalue[0]);
-            previous_value = NVCNT_DATA_VALUE(addressvalue[0]);
-            found = 1;
-          }
-          else
-          {
-            current_value = NVCNT_DATA_VALUE(addressvalue[0]);
-            if (current_value >= previous_value)
-            {
-              return HAL_ERROR;
-            }
-            else previous_value = current_value;
-          }
-        }
-      }
-    }
-    /* Next address location */
-    counter -= NVCNT_ELEMENT_SIZE;
 
-  }
-  if (found == 1)
+  if ((!bNvCntIndexReady) && (BuildIndex() != HAL_OK))
   {
-    return HAL_OK;
+    return HAL_ERROR;
   }
-  else
+
+  if ((!NVCNT_IS_VALID_ID(CounterId)) || ((uwNvCntFound & (1UL << NVCNT_INDEX(CounterId))) == 0U))
   {
     /* Variable is not found */
     return HAL_ERROR;
   }
+
+  *((uint32_t *)val) = NvCntValue[NVCNT_INDEX(CounterId)];
+  return HAL_OK;
 }
 /**
   * @}
@@ -448,8 +436,8 @@ static bool VerifyPageFullyErased(uint32_t Address, uint32_t PageSize)
   uint32_t counter = 0U;
   int32_t err;
   NVCNT_ELEMENT_TYPE addressvalue;
-  /* Check each element in the page */
-  while (counter < PageSize)
+  /* Check each element in the page, until a programmed element */
+  while ((counter < PageSize) && readstatus)
   {
     err = FLASH_DEV_NAME.ReadData(Address + counter, &addressvalue,
                                   sizeof(addressvalue));
@@ -524,7 +512,7 @@ static inline bool Write_Header(void)
   NVCNT_ID_TYPE header_id = NVCNT_ID_HEADER;
   int32_t err;
   uint32_t crc = 0U;
-  __IO NVCNT_ELEMENT_TYPE element;
+  __IO NVCNT_ELEMENT_TYPE element[2];
   int32_t loop = sizeof(header) / sizeof(NVCNT_DATA_TYPE) - 1;
   uint32_t address = BL2_NV_COUNTERS_AREA_ADDR;
   header[0] = NVCNT_HEADER_VALUE;
@@ -535,10 +523,11 @@ static inline bool Write_Header(void)
     /* compute crc */
     crc = CalculateCrc(header[loop], header_id);
     /*  build element  */
-    element = NVCNT_ELEMENT_VALUE(header_id, header[loop], crc);
+    element[0] = NVCNT_ELEMENT_VALUE(header_id, header[loop], crc);
+    element[1] = element[0];
     /* write element  */
     err = FLASH_DEV_NAME.ProgramData(address,
-                                     (const void *)&element,
+                                     (const void *)&element[0],
                                      NVCNT_ELEMENT_SIZE);
     if (err != ARM_DRIVER_OK)
     {
@@ -549,7 +538,8 @@ static inline bool Write_Header(void)
   }
 
   /* clean header footprint  */
-  element = 0;
+  element[0] = 0;
+  element[1] = 0;
   memset((void *)header, 0, sizeof(header));
   if (err == ARM_DRIVER_OK)
   {
@@ -608,41 +598,183 @@ static bool Check_Header(void)
   */
 static inline bool init_counter(void)
 {
-  int32_t err;
   uint32_t crc = 0U;
-  NVCNT_ELEMENT_TYPE element;
-  enum nv_counter_t counter_id;
+  NVCNT_ELEMENT_TYPE element[2U * NVCNT_NB_COUNTERS];
+  uint32_t counter_id;
+  uint32_t i = 0U;
   const uint32_t data = NVCNT_INIT_VALUE;
 
-  /* initialize only one counter */
+  /* empty log : write position just after the header */
+  if (BuildIndex() != HAL_OK)
+  {
+    return false;
+  }
+
+  /* initialize all counters, in one program operation */
   for (counter_id = PLAT_NV_COUNTER_3; counter_id < PLAT_NV_COUNTER_MAX; counter_id++)
   {
+    /* Calculate crc of variable data and virtual address */
+    crc = CalculateCrc(data, counter_id);
+    /*  build element  */
+    element[i] = NVCNT_ELEMENT_VALUE(counter_id, data, crc);
+    element[i + 1U] = element[i];
+    i += 2U;
+  }
 
-    /* Check if pages are full, i.e. max number of written elements achieved */
-    if (uhNbWrittenElements >= NVCNT_MAX_WRITTEN_ELEMENTS)
+  return (WriteElements(element, NVCNT_NB_COUNTERS) == HAL_OK);
+}
+
+/**
+  * @brief  Builds the RAM index of the counters from NV area.
+  *         Elements are read in write order, until the first erased element :
+  *         the last valid element of a counter gives its value.
+  *         An element with a wrong CRC (programming interrupted by a power down) is skipped.
+  *         Zeroed elements are skipped when the next valid element acknowledges them, or
+  *         when no valid element follows them (they are then acknowledged by the next write).
+  * @retval HAL_OK if success
+  *         HAL_ERROR if NV area not consistent (zeroed element followed by a valid element
+  *         not acknowledging it, counter history not strictly increasing, flash error)
+  */
+static HAL_StatusTypeDef BuildIndex(void)
+{
+  NVCNT_ELEMENT_TYPE addressvalue[2] = {0U, 0U};
+  NVCNT_ID_TYPE counter_id;
+  NVCNT_DATA_TYPE data;
+  uint32_t index;
+  uint32_t varidx;
+  int32_t err;
+
+  bNvCntIndexReady = false;
+  uwNvCntFound = 0U;
+  uhNbWrittenElements = 0U;
+  uwAddressNextWrite = PAGE_HEADER_SIZE;
+  uwTornOffset = 0U;
+
+  for (varidx = PAGE_HEADER_SIZE; varidx < BL2_NV_COUNTERS_AREA_SIZE; varidx += NVCNT_ELEMENT_SIZE)
+  {
+    err = FLASH_DEV_NAME.ReadData(BL2_NV_COUNTERS_AREA_ADDR + varidx, &addressvalue[0],
+                                  sizeof(addressvalue));
+    if ((err != ARM_DRIVER_OK) && (err != ARM_DRIVER_ERROR_SPECIFIC))
     {
-      return false;
+      return HAL_ERROR;
+    }
+    if ((err == ARM_DRIVER_OK) && (addressvalue[0] == NVCNT_PAGESTAT_ERASED)
+        && (addressvalue[1] == NVCNT_PAGESTAT_ERASED))
+    {
+      /* no more element in the page */
+      break;
     }
 
-    /* Calculate crc of variable data and virtual address */
-    crc = CalculateCrc(data, counter_id);
-    /*  build element  */
-    element = NVCNT_ELEMENT_VALUE(counter_id, data, crc);
-    /* Program variable data + virtual address + crc */
-    err = FLASH_DEV_NAME.ProgramData(BL2_NV_COUNTERS_AREA_ADDR + uwAddressNextWrite,
-                                     &element,
-                                     NVCNT_ELEMENT_SIZE);
-    /* If program operation was failed, a Flash error code is returned */
+    /* Then increment uhNbWrittenElements and uwAddressNextWrite */
+    uhNbWrittenElements++;
+    uwAddressNextWrite += NVCNT_ELEMENT_SIZE;
+
     if (err != ARM_DRIVER_OK)
     {
-      return false;
+      /* double ECC error : element skipped */
+      continue;
+    }
+    /* zero can be used to clean a value : a zeroed element is accepted only as the end of
+       the log (interrupted programming), checked by the next valid element */
+    if (addressvalue[0] == 0U)
+    {
+      if (uwTornOffset == 0U)
+      {
+        uwTornOffset = varidx;
+      }
+      continue;
+    }
+
+    counter_id = NVCNT_ID_VALUE(addressvalue[0]);
+    data = NVCNT_DATA_VALUE(addressvalue[0]);
+    /* if crc verification fails, data is corrupted and has to be skip */
+    if (((!NVCNT_IS_VALID_ID(counter_id)) && (counter_id != NVCNT_ID_TORN))
+        || (CalculateCrc(data, counter_id) != NVCNT_CRC_VALUE(addressvalue[0])))
+    {
+      continue;
     }
 
-    /* Increment global variables relative to write operation done*/
-    uwAddressNextWrite += NVCNT_ELEMENT_SIZE;
-    uhNbWrittenElements++;
+    /* the first valid element after zeroed elements must acknowledge them */
+    if ((uwTornOffset != 0U) || (counter_id == NVCNT_ID_TORN))
+    {
+      if ((counter_id != NVCNT_ID_TORN) || (uwTornOffset == 0U) || (data != uwTornOffset))
+      {
+        return HAL_ERROR;
+      }
+      uwTornOffset = 0U;
+      continue;
+    }
+
+    /* counter history must be strictly increasing */
+    index = NVCNT_INDEX(counter_id);
+    if (((uwNvCntFound & (1UL << index)) != 0U) && (data <= NvCntValue[index]))
+    {
+      return HAL_ERROR;
+    }
+    NvCntValue[index] = data;
+    uwNvCntFound |= 1UL << index;
   }
-  return true;
+
+  bNvCntIndexReady = true;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Appends elements to NV area in one flash program operation.
+  * @note   The elements are preceded by the acknowledge of the zeroed elements ending the log,
+  *         if any.
+  * @param  Element elements to be written (2 NVCNT_ELEMENT_TYPE each)
+  * @param  NbElements number of elements (NVCNT_NB_COUNTERS max)
+  * @retval HAL_OK if success
+  *         HAL_ERROR if NV area full or flash error
+  */
+static HAL_StatusTypeDef WriteElements(const NVCNT_ELEMENT_TYPE *Element, uint32_t NbElements)
+{
+  NVCNT_ELEMENT_TYPE torn_element[2U * (NVCNT_NB_COUNTERS + 1U)];
+  const NVCNT_ELEMENT_TYPE *program = Element;
+  uint32_t nb_program = NbElements;
+  uint32_t index;
+  uint32_t i;
+
+  if (NbElements > NVCNT_NB_COUNTERS)
+  {
+    return HAL_ERROR;
+  }
+
+  if (uwTornOffset != 0U)
+  {
+    torn_element[0] = NVCNT_ELEMENT_VALUE(NVCNT_ID_TORN, uwTornOffset, CalculateCrc(uwTornOffset, NVCNT_ID_TORN));
+    torn_element[1] = torn_element[0];
+    (void)memcpy(&torn_element[2], Element, NbElements * NVCNT_ELEMENT_SIZE);
+    program = torn_element;
+    nb_program++;
+  }
+
+  /* Check if pages are full, i.e. max number of written elements achieved */
+  if ((uhNbWrittenElements + nb_program) > NVCNT_MAX_WRITTEN_ELEMENTS)
+  {
+    return HAL_ERROR;
+  }
+
+  if (FLASH_DEV_NAME.ProgramData(BL2_NV_COUNTERS_AREA_ADDR + uwAddressNextWrite, program,
+                                 nb_program * NVCNT_ELEMENT_SIZE) != ARM_DRIVER_OK)
+  {
+    /* part of the elements may be programmed : rebuild RAM index and write position */
+    (void)BuildIndex();
+    return HAL_ERROR;
+  }
+
+  /* Increment global variables relative to write operation done, update RAM index */
+  uwAddressNextWrite += nb_program * NVCNT_ELEMENT_SIZE;
+  uhNbWrittenElements += nb_program;
+  uwTornOffset = 0U;
+  for (i = 0U; i < NbElements; i++)
+  {
+    index = NVCNT_INDEX(NVCNT_ID_VALUE(Element[2U * i]));
+    NvCntValue[index] = NVCNT_DATA_VALUE(Element[2U * i]);
+    uwNvCntFound |= 1UL << index;
+  }
+  return HAL_OK;
 }
 /**
   * @}
@@ -24,6 +24,7 @@
 #include "boot_hal_hash_ref.h"
 #include "boot_hal_imagevalid.h"
 #include "boot_hal_flowcontrol.h"
+#include "boot_hal_timemonitor.h"
 #include "mcuboot_config/mcuboot_config.h"
 #include "uart_stdout.h"
 #include "low_level_security.h"
@@ -33,9 +34,18 @@
 #include "Driver_Flash.h"
 #include "region_defs.h"
 #include "low_level_rng.h"
+#include "mbedtls/ecp.h"
 #if   defined(MCUBOOT_USE_HASH_REF)
 #include "bootutil_priv.h"
 #endif
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+#include "mbedtls/aes.h"
+#include "mbedtls/sha256.h"
+#include "platform/include/plat_nv_counters.h"
+#if !defined(HW_CRYPTO_DPA_AES)
+#error "MCUBOOT_USE_VERIFIED_REF requires HW_CRYPTO_DPA_AES (SAES hardware unique key)"
+#endif /* HW_CRYPTO_DPA_AES */
+#endif /* MCUBOOT_USE_VERIFIED_REF */
 #ifdef MCUBOOT_EXT_LOADER
 #include "bootutil/crypto/sha256.h"
 #define BUTTON_PORT                       GPIOC
@@ -70,6 +80,46 @@ uint8_t ImageValidHashUpdate = 0;
 uint8_t ImageValidHashRef[MCUBOOT_IMAGE_NUMBER * SHA256_LEN] = {0};
 #endif /* MCUBOOT_USE_HASH_REF */
 
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+/* Verified references are stored in the hash references sector, after the hash references */
+#define BL2_VERIFIED_REF_ADDR         (BL2_HASH_REF_ADDR + (SHA256_LEN * MCUBOOT_IMAGE_NUMBER))
+#define VERIFIED_REF_MAC_LEN          (16U)
+#define VERIFIED_REF_TLV_SIZE         (0x60U)  /* Unprotected TLV area part covered : TLV info and SHA256 TLV */
+#define VERIFIED_REF_TRAILER_SIZE     (0x80U)  /* Slot trailer part covered : magic and flags */
+#define VERIFIED_REF_CHUNK_SIZE       (0x20U)
+
+typedef struct
+{
+  uint8_t Key[SHA256_LEN];            /*!< Digest of image index, header, TLV, trailer and security counter */
+  uint8_t Mac[VERIFIED_REF_MAC_LEN];  /*!< CBC-MAC with the hardware unique key of Key and hash reference */
+} boot_verified_ref_t;
+
+#if (((SHA256_LEN + SHA256_LEN + VERIFIED_REF_MAC_LEN) * MCUBOOT_IMAGE_NUMBER) > FLASH_HASH_REF_AREA_SIZE)
+#error "Verified references do not fit in hash references area"
+#endif /* verified references size */
+
+/* Primary slot of each image, in image index order */
+static const struct
+{
+  uint32_t Offset;
+  uint32_t Size;
+} VerifiedRefSlot[MCUBOOT_IMAGE_NUMBER] =
+{
+  { FLASH_AREA_0_OFFSET, FLASH_AREA_0_SIZE },
+#if (MCUBOOT_APP_IMAGE_NUMBER == 2)
+  { FLASH_AREA_1_OFFSET, FLASH_AREA_1_SIZE },
+#endif /* MCUBOOT_APP_IMAGE_NUMBER == 2 */
+#if (MCUBOOT_S_DATA_IMAGE_NUMBER == 1)
+  { FLASH_AREA_4_OFFSET, FLASH_AREA_4_SIZE },
+#endif /* MCUBOOT_S_DATA_IMAGE_NUMBER == 1 */
+#if (MCUBOOT_NS_DATA_IMAGE_NUMBER == 1)
+  { FLASH_AREA_5_OFFSET, FLASH_AREA_5_SIZE },
+#endif /* MCUBOOT_NS_DATA_IMAGE_NUMBER == 1 */
+};
+
+boot_verified_ref_t ImageVerifiedRef[MCUBOOT_IMAGE_NUMBER];
+#endif /* MCUBOOT_USE_VERIFIED_REF */
+
 #if defined(FLOW_CONTROL)
 /* Global variable for Flow Control state */
 volatile uint32_t uFlowProtectValue = FLOW_CTRL_INIT_VALUE;
@@ -86,6 +136,32 @@ volatile uint32_t uFlowStage = FLOW_STAGE_CFG;
 #define ICACHE_MONITOR_PRINT()
 #endif /* ICACHE_MONITOR */
 
+#if defined(BOOT_TIME_MONITOR)
+#if !defined(TFM_DEV_MODE)
+#error "BOOT_TIME_MONITOR requires TFM_DEV_MODE"
+#endif /* !TFM_DEV_MODE */
+uint32_t BootTimeCycles[BOOT_TIME_NB] = {0};
+#define BOOT_TIME_CYCLES_TO_US(cycles) ((cycles) / (SystemCoreClock / 1000000U))
+#define BOOT_TIME_MONITOR_PRINT() printf("boot time monitor - Total: %u us, Flash read: %u us, Hash: %u us " \
+                                         "(DMA wait: %u us), ECDSA: %u us\r\n", \
+                                         BOOT_TIME_CYCLES_TO_US(DWT->CYCCNT), \
+                                         BOOT_TIME_CYCLES_TO_US(BootTimeCycles[BOOT_TIME_FLASH_READ]), \
+                                         BOOT_TIME_CYCLES_TO_US(BootTimeCycles[BOOT_TIME_HASH]), \
+                                         BOOT_TIME_CYCLES_TO_US(BootTimeCycles[BOOT_TIME_HASH_WAIT]), \
+                                         BOOT_TIME_CYCLES_TO_US(BootTimeCycles[BOOT_TIME_ECDSA])); \
+                                  BOOT_TIME_VERIFIED_PRINT()
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+static uint32_t BootTimeVerifiedImages = 0U;
+#define BOOT_TIME_VERIFIED_PRINT() printf("boot time monitor - Verified references: %u us, %u images not hashed\r\n", \
+                                          BOOT_TIME_CYCLES_TO_US(BootTimeCycles[BOOT_TIME_VERIFIED]), \
+                                          BootTimeVerifiedImages);
+#else
+#define BOOT_TIME_VERIFIED_PRINT()
+#endif /* MCUBOOT_USE_VERIFIED_REF */
+#else
+#define BOOT_TIME_MONITOR_PRINT()
+#endif /* BOOT_TIME_MONITOR */
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup BOOT_HAL_Private_Functions  Private Functions
   * @{
@@ -107,6 +183,11 @@ void icache_init(void);
   */
 void boot_platform_noimage(void)
 {
+#if defined(MBEDTLS_ECP_ALT) && defined(HW_CRYPTO_PKA_SESSION)
+    /* End of ECC operations */
+    ST_PKA_SessionEnd();
+#endif /* MBEDTLS_ECP_ALT && HW_CRYPTO_PKA_SESSION */
+
     /* Check Flow control for dynamic protections */
     FLOW_CONTROL_CHECK(uFlowProtectValue, FLOW_CTRL_STAGE_2);
     uFlowStage = FLOW_STAGE_CFG;
@@ -349,6 +430,20 @@ void boot_platform_quit(struct boot_arm_vector_table *vector)
     }
 #endif /* MCUBOOT_DOUBLE_SIGN_VERIF */
 
+#if defined(MBEDTLS_ECP_ALT) && defined(HW_CRYPTO_PKA_SESSION)
+    /* End of ECC operations */
+    ST_PKA_SessionEnd();
+#endif /* MBEDTLS_ECP_ALT && HW_CRYPTO_PKA_SESSION */
+
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+    /* Record the images validated by this boot */
+    if (boot_verified_ref_update())
+    {
+        BOOT_LOG_ERR("Error while updating verified references");
+        Error_Handler();
+    }
+#endif /* MCUBOOT_USE_VERIFIED_REF */
+
 #if defined(MCUBOOT_USE_HASH_REF)
     /* Store new hash references in flash for next boot */
     if (ImageValidHashUpdate)
@@ -369,6 +464,7 @@ void boot_platform_quit(struct boot_arm_vector_table *vector)
     RNG_DeInit();
 
     ICACHE_MONITOR_PRINT()
+    BOOT_TIME_MONITOR_PRINT()
 
 #ifdef TFM_ICACHE_ENABLE
     /* Invalidate ICache before jumping to application */
@@ -520,6 +616,15 @@ int boot_hash_ref_store(void)
     return BOOT_EFLASH;
   }
 
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+  /* Store verified references in flash */
+  if (FLASH_DEV_NAME.ProgramData(BL2_VERIFIED_REF_ADDR, ImageVerifiedRef,
+      sizeof(ImageVerifiedRef)) != ARM_DRIVER_OK)
+  {
+    return BOOT_EFLASH;
+  }
+#endif /* MCUBOOT_USE_VERIFIED_REF */
+
   return 0;
 }
 
@@ -536,6 +641,15 @@ int boot_hash_ref_load(void)
     return BOOT_EFLASH;
   }
 
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+  /* Read verified references */
+  if (FLASH_DEV_NAME.ReadData(BL2_VERIFIED_REF_ADDR, ImageVerifiedRef,
+      sizeof(ImageVerifiedRef)) != ARM_DRIVER_OK)
+  {
+    return BOOT_EFLASH;
+  }
+#endif /* MCUBOOT_USE_VERIFIED_REF */
+
   return 0;
 }
 
@@ -597,6 +711,228 @@ int boot_hash_ref_get(uint8_t *hash_ref, uint8_t size, uint8_t image_index)
 }
 #endif /* MCUBOOT_USE_HASH_REF */
 
+#if defined(MCUBOOT_USE_VERIFIED_REF)
+/**
+  * @brief This function hashes a part of a primary slot
+  * @param ctx sha256 context
+  * @param offset offset of the part in flash
+  * @param size size of the part
+  * @return 0 on success; nonzero on failure.
+  */
+static int boot_verified_ref_hash_flash(mbedtls_sha256_context *ctx, uint32_t offset, uint32_t size)
+{
+  uint8_t chunk[VERIFIED_REF_CHUNK_SIZE];
+  uint32_t len;
+
+  while (size > 0U)
+  {
+    len = (size > sizeof(chunk)) ? sizeof(chunk) : size;
+    if ((FLASH_DEV_NAME.ReadData(offset, chunk, len) != ARM_DRIVER_OK)
+        || (mbedtls_sha256_update(ctx, chunk, len) != 0))
+    {
+      return BOOT_EFLASH;
+    }
+    offset += len;
+    size -= len;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief This function computes the verified reference of one image in its current state
+  * @note The key covers the image header, the TLV area holding the image hash, the slot trailer
+  *       and the image security counter : any installation or rollback of the image changes it.
+  *       The MAC binds the key to the hash reference with the SAES hardware unique key, a record
+  *       copied from another device or forged in flash does not match.
+  * @param image_index index of image
+  * @param ref verified reference computed
+  * @return 0 on success; nonzero on failure.
+  */
+static int boot_verified_ref_compute(uint8_t image_index, boot_verified_ref_t *ref)
+{
+  mbedtls_sha256_context sha_ctx;
+  mbedtls_aes_context aes_ctx;
+  struct image_header hdr;
+  uint32_t offset = VerifiedRefSlot[image_index].Offset;
+  uint32_t size = VerifiedRefSlot[image_index].Size;
+  uint32_t tlv_offset;
+  uint32_t tlv_size;
+  uint32_t security_cnt = 0U;
+  uint8_t mac_in[VERIFIED_REF_MAC_LEN];
+  uint32_t i;
+  uint32_t j;
+  int ret = BOOT_EFLASH;
+
+  /* Read image header */
+  if (FLASH_DEV_NAME.ReadData(offset, &hdr, sizeof(hdr)) != ARM_DRIVER_OK)
+  {
+    return BOOT_EFLASH;
+  }
+  if (hdr.ih_magic != IMAGE_MAGIC)
+  {
+    return BOOT_EBADIMAGE;
+  }
+
+  /* TLV area : protected TLVs, then TLV info and image hash */
+  tlv_offset = (uint32_t)hdr.ih_hdr_size + hdr.ih_img_size;
+  tlv_size = (uint32_t)hdr.ih_protect_tlv_size + VERIFIED_REF_TLV_SIZE;
+  if ((tlv_offset >= size) || (tlv_size > (size - tlv_offset)) || (VERIFIED_REF_TRAILER_SIZE > size))
+  {
+    return BOOT_EBADIMAGE;
+  }
+
+  /* Current security counter of the image */
+  if (plat_read_nv_counter((enum nv_counter_t)(PLAT_NV_COUNTER_3 + image_index), sizeof(security_cnt),
+                           (uint8_t *)&security_cnt) != HAL_OK)
+  {
+    return BOOT_EFLASH;
+  }
+
+  /* Key : digest of image index, header, TLV area, trailer and security counter */
+  mbedtls_sha256_init(&sha_ctx);
+  if ((mbedtls_sha256_starts(&sha_ctx, 0) == 0)
+      && (mbedtls_sha256_update(&sha_ctx, &image_index, sizeof(image_index)) == 0)
+      && (mbedtls_sha256_update(&sha_ctx, (const uint8_t *)&hdr, sizeof(hdr)) == 0)
+      && (boot_verified_ref_hash_flash(&sha_ctx, offset + tlv_offset, tlv_size) == 0)
+      && (boot_verified_ref_hash_flash(&sha_ctx, offset + size - VERIFIED_REF_TRAILER_SIZE,
+                                       VERIFIED_REF_TRAILER_SIZE) == 0)
+      && (mbedtls_sha256_update(&sha_ctx, (const uint8_t *)&security_cnt, sizeof(security_cnt)) == 0)
+      && (mbedtls_sha256_finish(&sha_ctx, ref->Key) == 0))
+  {
+    ret = 0;
+  }
+  mbedtls_sha256_free(&sha_ctx);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* MAC : CBC-MAC with the hardware unique key of key and hash reference (fixed length message) */
+  ret = BOOT_EFLASH;
+  mbedtls_aes_init(&aes_ctx);
+  if (mbedtls_aes_setkey_enc(&aes_ctx, NULL, 0) == 0)
+  {
+    memset(ref->Mac, 0, VERIFIED_REF_MAC_LEN);
+    for (i = 0U; i < (2U * SHA256_LEN); i += VERIFIED_REF_MAC_LEN)
+    {
+      for (j = 0U; j < VERIFIED_REF_MAC_LEN; j++)
+      {
+        mac_in[j] = ref->Mac[j] ^ ((i < SHA256_LEN) ? ref->Key[i + j]
+                                   : ImageValidHashRef[(image_index * SHA256_LEN) + i - SHA256_LEN + j]);
+      }
+      if (mbedtls_aes_crypt_ecb(&aes_ctx, MBEDTLS_AES_ENCRYPT, mac_in, ref->Mac) != 0)
+      {
+        break;
+      }
+    }
+    if (i == (2U * SHA256_LEN))
+    {
+      ret = 0;
+    }
+  }
+  mbedtls_aes_free(&aes_ctx);
+
+  return ret;
+}
+
+/**
+  * @brief This function checks whether one image is unchanged since its last full validation
+  * @param image_index index of image
+  * @return 0 if the image matches its verified reference; nonzero otherwise.
+  */
+static int boot_verified_ref_check(uint8_t image_index)
+{
+  boot_verified_ref_t ref;
+  uint8_t diff = 0U;
+  uint32_t i;
+
+  /* Check image index */
+  if (image_index >= MCUBOOT_IMAGE_NUMBER)
+  {
+    return BOOT_EFLASH;
+  }
+
+  if (boot_verified_ref_compute(image_index, &ref) != 0)
+  {
+    return BOOT_EBADIMAGE;
+  }
+
+  /* Constant time comparison */
+  for (i = 0U; i < SHA256_LEN; i++)
+  {
+    diff |= ref.Key[i] ^ ImageVerifiedRef[image_index].Key[i];
+  }
+  for (i = 0U; i < VERIFIED_REF_MAC_LEN; i++)
+  {
+    diff |= ref.Mac[i] ^ ImageVerifiedRef[image_index].Mac[i];
+  }
+
+  return (diff == 0U) ? 0 : BOOT_EBADIMAGE;
+}
+
+/**
+  * @brief This function gets the hash of a primary slot image unchanged since its last validation
+  * @note Called by bootutil_img_hash() before hashing an image of a primary slot : on success,
+  *       the hash reference is the image hash and the image is not read. On failure, the image
+  *       is hashed and validated as without verified reference.
+  * @param hash image hash
+  * @param size size of the image hash
+  * @param image_index index of image
+  * @return 0 on success; nonzero if the image has to be hashed.
+  */
+int boot_verified_ref_hash_get(uint8_t *hash, uint8_t size, uint8_t image_index)
+{
+  int ret;
+  BOOT_TIME_START(start);
+
+  ret = boot_verified_ref_check(image_index);
+  if (ret == 0)
+  {
+    ret = boot_hash_ref_get(hash, size, image_index);
+  }
+  BOOT_TIME_STOP(BOOT_TIME_VERIFIED, start);
+#if defined(BOOT_TIME_MONITOR)
+  if (ret == 0)
+  {
+    BootTimeVerifiedImages++;
+  }
+#endif /* BOOT_TIME_MONITOR */
+
+  return ret;
+}
+
+/**
+  * @brief This function updates in ram the verified references of the validated images
+  * @note To be called once all images are validated. The flash update is done with the hash
+  *       references storage, only when a verified reference has changed.
+  * @return 0 on success; nonzero on failure.
+  */
+int boot_verified_ref_update(void)
+{
+  boot_verified_ref_t ref;
+  uint8_t image_index;
+
+  for (image_index = 0U; image_index < MCUBOOT_IMAGE_NUMBER; image_index++)
+  {
+    if (boot_verified_ref_compute(image_index, &ref) != 0)
+    {
+      return BOOT_EFLASH;
+    }
+
+    if (memcmp(&ref, &ImageVerifiedRef[image_index], sizeof(ref)) != 0)
+    {
+      memcpy(&ImageVerifiedRef[image_index], &ref, sizeof(ref));
+
+      /* Memorize that references will have to be updated in flash (later) */
+      ImageValidHashUpdate++;
+    }
+  }
+
+  return 0;
+}
+#endif /* MCUBOOT_USE_VERIFIED_REF */
+
 /**
   * @brief This function configures and enables the ICache.
   * @note
@@ -650,6 +986,12 @@ int32_t boot_platform_init(void)
          - Set NVIC Group Priority to 3
          - Low Level Initialization
        */
+#if defined(BOOT_TIME_MONITOR)
+    /* Start the cycle counter, boot time is measured from here */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* BOOT_TIME_MONITOR */
     HAL_Init();
 #ifdef TFM_DEV_MODE
     /* Init for log */
@@ -35,6 +35,7 @@
 #if defined(MCUBOOT_DOUBLE_SIGN_VERIF)
 #include "boot_hal_imagevalid.h"
 #endif /* MCUBOOT_DOUBLE_SIGN_VERIF */
+#include "boot_hal_timemonitor.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -195,7 +196,7 @@ int mbedtls_ecdsa_sign(mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
   uint8_t *k_binary = NULL;
 
   mbedtls_mpi k;
-  PKA_HandleTypeDef hpka = {0};
+  PKA_HandleTypeDef *hpka = NULL;
   PKA_ECDSASignInTypeDef ECDSA_SignIn = {0};
   PKA_ECDSASignOutTypeDef ECDSA_SignOut = {0};
 
@@ -249,17 +250,12 @@ int mbedtls_ecdsa_sign(mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
 
   ECDSA_SignIn.integer = k_binary;
 
-  /* Enable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_ENABLE();
-
   /* Initialize HW peripheral */
-  hpka.Instance = PKA;
-  MBEDTLS_MPI_CHK((HAL_PKA_Init(&hpka) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
-
-  HAL_PKA_RAMReset(&hpka);
+  hpka = ST_PKA_Open();
+  MBEDTLS_MPI_CHK((hpka == NULL) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Launch the signature */
-  MBEDTLS_MPI_CHK((HAL_PKA_ECDSASign(&hpka, &ECDSA_SignIn,
+  MBEDTLS_MPI_CHK((HAL_PKA_ECDSASign(hpka, &ECDSA_SignIn,
                                      ST_ECDSA_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Allocate memory space for signature */
@@ -270,7 +266,7 @@ int mbedtls_ecdsa_sign(mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
   MBEDTLS_MPI_CHK((ECDSA_SignOut.SSign == NULL) ? MBEDTLS_ERR_ECP_ALLOC_FAILED : 0);
 
   /* Get the signature into allocated space */
-  HAL_PKA_ECDSASign_GetResult(&hpka, &ECDSA_SignOut, NULL);
+  HAL_PKA_ECDSASign_GetResult(hpka, &ECDSA_SignOut, NULL);
 
   /* Convert the signature into mpi format */
   MBEDTLS_MPI_CHK(mbedtls_mpi_read_binary(r, ECDSA_SignOut.RSign, grp->st_order_size));
@@ -278,11 +274,11 @@ int mbedtls_ecdsa_sign(mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
   MBEDTLS_MPI_CHK(mbedtls_mpi_read_binary(s, ECDSA_SignOut.SSign, grp->st_order_size));
 
 cleanup:
-  /* De-initialize HW peripheral */
-  HAL_PKA_DeInit(&hpka);
-
-  /* Disable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_DISABLE();
+  /* End of HW peripheral operation */
+  if (hpka != NULL)
+  {
+    ST_PKA_Close();
+  }
 
   /* Free memory */
   mbedtls_mpi_free(&k);
@@ -368,9 +364,10 @@ int mbedtls_ecdsa_verify(mbedtls_ecp_group *grp,
   uint8_t *Q_binary;
   uint8_t *r_binary = NULL;
   uint8_t *s_binary = NULL;
-  PKA_HandleTypeDef hpka = {0};
+  PKA_HandleTypeDef *hpka = NULL;
   PKA_ECDSAVerifInTypeDef ECDSA_VerifyIn = {0};
   uint8_t a_digest[66] = {0}; /* Local digest after rework input digest, 66 is the maximum order size supported */
+  BOOT_TIME_START(start);
 
   /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
   if (grp->G.MBEDTLS_PRIVATE(Y).MBEDTLS_PRIVATE(p) == NULL)
@@ -385,6 +382,9 @@ int mbedtls_ecdsa_verify(mbedtls_ecp_group *grp,
     return MBEDTLS_ERR_ECP_VERIFY_FAILED;
   }
 
+  /* Enable HW peripheral clock and the HW peripheral : the PKA RAM erase runs while the inputs are prepared */
+  ST_PKA_Enable();
+
   /* Set HW peripheral Input parameter: curve coefs */
   ECDSA_VerifyIn.primeOrderSize = grp->st_order_size;
   ECDSA_VerifyIn.modulusSize    = grp->st_modulus_size;
@@ -423,21 +423,16 @@ int mbedtls_ecdsa_verify(mbedtls_ecp_group *grp,
   MBEDTLS_MPI_CHK(mbedtls_mpi_write_binary(s, s_binary, grp->st_order_size));
   ECDSA_VerifyIn.SSign = s_binary;
 
-  /* Enable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_ENABLE();
-
-  /* Initialize HW peripheral */
-  hpka.Instance = PKA;
-  MBEDTLS_MPI_CHK((HAL_PKA_Init(&hpka) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
-
-  HAL_PKA_RAMReset(&hpka);
+  /* Initialize HW peripheral, end of the PKA RAM erase */
+  hpka = ST_PKA_Open();
+  MBEDTLS_MPI_CHK((hpka == NULL) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Launch the signature verification */
-  MBEDTLS_MPI_CHK((HAL_PKA_ECDSAVerif(&hpka, &ECDSA_VerifyIn,
+  MBEDTLS_MPI_CHK((HAL_PKA_ECDSAVerif(hpka, &ECDSA_VerifyIn,
                                       ST_ECDSA_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Check the result */
-  MBEDTLS_MPI_CHK((HAL_PKA_ECDSAVerif_IsValidSignature(&hpka) != 1U) ? MBEDTLS_ERR_ECP_VERIFY_FAILED : 0);
+  MBEDTLS_MPI_CHK((HAL_PKA_ECDSAVerif_IsValidSignature(hpka) != 1U) ? MBEDTLS_ERR_ECP_VERIFY_FAILED : 0);
 
 #if defined(MCUBOOT_DOUBLE_SIGN_VERIF)
   /* Double the signature verification (using another way) to resist to basic HW attacks.
@@ -454,16 +449,13 @@ int mbedtls_ecdsa_verify(mbedtls_ecp_group *grp,
     /* Check ImageValidIndex is in expected range MCUBOOT_IMAGE_NUMBER */
     MBEDTLS_MPI_CHK((ImageValidIndex >= MCUBOOT_IMAGE_NUMBER) ? MBEDTLS_ERR_ECP_VERIFY_FAILED : 0);
 
-    ImageValidStatus[ImageValidIndex++] = CheckPKASignature(&hpka, &ECDSA_VerifyIn);
+    ImageValidStatus[ImageValidIndex++] = CheckPKASignature(hpka, &ECDSA_VerifyIn);
   }
 
 #endif /* MCUBOOT_DOUBLE_SIGN_VERIF */
 cleanup:
-  /* De-initialize HW peripheral */
-  HAL_PKA_DeInit(&hpka);
-
-  /* Disable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_DISABLE();
+  /* End of HW peripheral operation, also disabling the PKA enabled before its initialization */
+  ST_PKA_Close();
 
   /* Free memory */
   if (Q_binary != NULL)
@@ -484,6 +476,7 @@ cleanup:
     mbedtls_free(s_binary);
   }
 
+  BOOT_TIME_STOP(BOOT_TIME_ECDSA, start);
   return ret;
 }
 
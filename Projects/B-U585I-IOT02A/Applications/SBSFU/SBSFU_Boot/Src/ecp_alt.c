@@ -104,6 +104,110 @@
 #include "ecp_internal_alt.h"
 
 #define ST_ECP_TIMEOUT     (5000U)
+#define ST_ECP_MAX_MODULUS_SIZE  (66U)   /* Bytes, P-521 */
+
+/* PKA handle shared by the ECP and ECDSA operations */
+static PKA_HandleTypeDef st_hpka = {0};
+#if defined(HW_CRYPTO_PKA_SESSION)
+static uint32_t st_pka_session_open = 0U;
+#endif /* HW_CRYPTO_PKA_SESSION */
+
+#if defined(MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED)
+/* Montgomery parameter of the last curve modulus used by the point check, computed once */
+static uint32_t st_montgomery_param[(ST_ECP_MAX_MODULUS_SIZE + 3U) / 4U];
+static const uint8_t *st_montgomery_modulus = NULL;
+#endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
+
+/**
+  * @brief  Enable the PKA clock and the PKA : the PKA RAM erase runs while the caller
+  *         prepares the operation inputs. Nothing to do when the PKA session is open.
+  * @retval None
+  */
+void ST_PKA_Enable(void)
+{
+#if defined(HW_CRYPTO_PKA_SESSION)
+  if (st_pka_session_open != 0U)
+  {
+    return;
+  }
+#endif /* HW_CRYPTO_PKA_SESSION */
+  __HAL_RCC_PKA_CLK_ENABLE();
+  WRITE_REG(PKA->CR, PKA_CR_EN);
+}
+
+/**
+  * @brief  Initialize the PKA for one operation and reset the PKA RAM.
+  *         With HW_CRYPTO_PKA_SESSION, the PKA is initialized by the first operation only.
+  * @retval PKA handle, NULL on failure
+  */
+PKA_HandleTypeDef *ST_PKA_Open(void)
+{
+#if defined(HW_CRYPTO_PKA_SESSION)
+  if (st_pka_session_open == 0U)
+#endif /* HW_CRYPTO_PKA_SESSION */
+  {
+    /* Enable HW peripheral clock */
+    __HAL_RCC_PKA_CLK_ENABLE();
+
+    /* Initialize HW peripheral */
+    st_hpka.Instance = PKA;
+    if (HAL_PKA_Init(&st_hpka) != HAL_OK)
+    {
+      __HAL_RCC_PKA_CLK_DISABLE();
+      return NULL;
+    }
+#if defined(HW_CRYPTO_PKA_SESSION)
+    st_pka_session_open = 1U;
+#endif /* HW_CRYPTO_PKA_SESSION */
+  }
+
+  /* Reset PKA RAM */
+  HAL_PKA_RAMReset(&st_hpka);
+
+  return &st_hpka;
+}
+
+/**
+  * @brief  End one PKA operation.
+  *         With HW_CRYPTO_PKA_SESSION, the PKA RAM is reset and the PKA stays initialized
+  *         for the next operation, otherwise the PKA is de-initialized.
+  * @retval None
+  */
+void ST_PKA_Close(void)
+{
+#if defined(HW_CRYPTO_PKA_SESSION)
+  if (st_pka_session_open != 0U)
+  {
+    /* Operands and results (private scalar) are not kept between operations */
+    HAL_PKA_RAMReset(&st_hpka);
+    return;
+  }
+#endif /* HW_CRYPTO_PKA_SESSION */
+
+  /* De-initialize HW peripheral */
+  st_hpka.Instance = PKA;
+  HAL_PKA_DeInit(&st_hpka);
+
+  /* Disable HW peripheral clock */
+  __HAL_RCC_PKA_CLK_DISABLE();
+}
+
+#if defined(HW_CRYPTO_PKA_SESSION)
+/**
+  * @brief  End the PKA session : to be called once the image verifications are done,
+  *         before leaving the boot.
+  * @retval None
+  */
+void ST_PKA_SessionEnd(void)
+{
+  if (st_pka_session_open != 0U)
+  {
+    st_pka_session_open = 0U;
+    HAL_PKA_RAMReset(&st_hpka);
+    ST_PKA_Close();
+  }
+}
+#endif /* HW_CRYPTO_PKA_SESSION */
 
 #if defined(MBEDTLS_SELF_TEST)
 /*
@@ -1522,7 +1626,7 @@ static int ecp_mul_comb(mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
   uint8_t *P_binary;
   uint8_t *m_binary = NULL;
   uint8_t *R_binary = NULL;
-  PKA_HandleTypeDef hpka = {0};
+  PKA_HandleTypeDef *hpka = NULL;
   PKA_ECCMulInTypeDef ECC_MulIn = {0};
   PKA_ECCMulOutTypeDef ECC_MulOut;
 
@@ -1554,18 +1658,12 @@ static int ecp_mul_comb(mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
   MBEDTLS_MPI_CHK(mbedtls_mpi_write_binary(m, m_binary, scalarMulSize));
   ECC_MulIn.scalarMul = m_binary;
 
-  /* Enable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_ENABLE();
-
   /* Initialize HW peripheral */
-  hpka.Instance = PKA;
-  MBEDTLS_MPI_CHK((HAL_PKA_Init(&hpka) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
-
-  /* Reset PKA RAM */
-  HAL_PKA_RAMReset(&hpka);
+  hpka = ST_PKA_Open();
+  MBEDTLS_MPI_CHK((hpka == NULL) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Launch the scalar multiplication */
-  MBEDTLS_MPI_CHK((HAL_PKA_ECCMul(&hpka, &ECC_MulIn,
+  MBEDTLS_MPI_CHK((HAL_PKA_ECCMul(hpka, &ECC_MulIn,
                                   ST_ECP_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Allocate memory space for scalar multiplication result */
@@ -1576,18 +1674,18 @@ static int ecp_mul_comb(mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
   ECC_MulOut.ptY = R_binary + grp->st_modulus_size + 1U;
 
   /* Get the scalar multiplication result */
-  HAL_PKA_ECCMul_GetResult(&hpka, &ECC_MulOut);
+  HAL_PKA_ECCMul_GetResult(hpka, &ECC_MulOut);
 
   /* Convert the scalar multiplication result into ecp point format */
   R_binary[0] = 0x04U;
   MBEDTLS_MPI_CHK(mbedtls_ecp_point_read_binary(grp, R, R_binary, 2U * grp->st_modulus_size + 1U));
 
 cleanup:
-  /* De-initialize HW peripheral */
-  HAL_PKA_DeInit(&hpka);
-
-  /* Disable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_DISABLE();
+  /* End of HW peripheral operation */
+  if (hpka != NULL)
+  {
+    ST_PKA_Close();
+  }
 
   /* Free memory */
   if (P_binary != NULL)
@@ -1934,10 +2032,9 @@ static int ecp_check_pubkey_sw(const mbedtls_ecp_group *grp, const mbedtls_ecp_p
   int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
   size_t olen;
   uint8_t *pt_binary;
-  PKA_HandleTypeDef hpka = {0};
+  PKA_HandleTypeDef *hpka = NULL;
   PKA_PointCheckInTypeDef ECC_PointCheck = {0};
   PKA_MontgomeryParamInTypeDef inp = {0};
-  uint8_t *pt_montgomery = NULL;
 
   /* pt coordinates must be normalized for our checks */
   if( mbedtls_mpi_cmp_int( &pt->MBEDTLS_PRIVATE(X), 0 ) < 0 ||
@@ -1959,50 +2056,50 @@ static int ecp_check_pubkey_sw(const mbedtls_ecp_group *grp, const mbedtls_ecp_p
   pt_binary = mbedtls_calloc(( 2U * grp->st_modulus_size ) + 1U, sizeof( uint8_t ));
   MBEDTLS_MPI_CHK((pt_binary == NULL) ? MBEDTLS_ERR_ECP_ALLOC_FAILED : 0);
 
-  pt_montgomery = mbedtls_calloc(grp->st_modulus_size, sizeof( uint8_t ));
-  MBEDTLS_MPI_CHK((pt_montgomery == NULL) ? MBEDTLS_ERR_ECP_ALLOC_FAILED : 0);
+  MBEDTLS_MPI_CHK((grp->st_modulus_size > ST_ECP_MAX_MODULUS_SIZE) ? MBEDTLS_ERR_ECP_BAD_INPUT_DATA : 0);
 
   MBEDTLS_MPI_CHK( mbedtls_ecp_point_write_binary( grp, pt, MBEDTLS_ECP_PF_UNCOMPRESSED, &olen, pt_binary, ( 2U * grp->st_modulus_size ) + 1U ) );
 
   ECC_PointCheck.pointX = pt_binary + 1U;
   ECC_PointCheck.pointY = pt_binary + grp->st_modulus_size + 1U;
 
-  /* Enable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_ENABLE();
-
   /* Initialize HW peripheral */
-  hpka.Instance = PKA;
-  MBEDTLS_MPI_CHK((HAL_PKA_Init(&hpka) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
+  hpka = ST_PKA_Open();
+  MBEDTLS_MPI_CHK((hpka == NULL) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
-  /* Reset PKA RAM */
-  HAL_PKA_RAMReset(&hpka);
+  /* Montgomery R2 parameter of the curve modulus : computed for the first point check only */
+  if (st_montgomery_modulus != grp->st_p)
+  {
+    st_montgomery_modulus = NULL;
 
-  /* Set Montgomery R2 input parameters */
-  inp.size = grp->st_modulus_size;
-  inp.pOp1 = grp->st_p;
+    /* Set Montgomery R2 input parameters */
+    inp.size = grp->st_modulus_size;
+    inp.pOp1 = grp->st_p;
 
-  /* Launch the processing */
-  MBEDTLS_MPI_CHK((HAL_PKA_MontgomeryParam(&hpka, &inp, ST_ECP_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
+    /* Launch the processing */
+    MBEDTLS_MPI_CHK((HAL_PKA_MontgomeryParam(hpka, &inp, ST_ECP_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
-  /* Get Montgomery R2 parameters */
-  HAL_PKA_MontgomeryParam_GetResult(&hpka, (uint32_t*)pt_montgomery);
-  ECC_PointCheck.pMontgomeryParam = (uint32_t*)pt_montgomery;
+    /* Get Montgomery R2 parameters */
+    HAL_PKA_MontgomeryParam_GetResult(hpka, st_montgomery_param);
+    st_montgomery_modulus = grp->st_p;
+  }
+  ECC_PointCheck.pMontgomeryParam = st_montgomery_param;
 
   /* Launch the point check */
-  MBEDTLS_MPI_CHK((HAL_PKA_PointCheck(&hpka, &ECC_PointCheck, ST_ECP_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
+  MBEDTLS_MPI_CHK((HAL_PKA_PointCheck(hpka, &ECC_PointCheck, ST_ECP_TIMEOUT) != HAL_OK) ? MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED : 0);
 
   /* Get the result of the point check */
-  if( HAL_PKA_PointCheck_IsOnCurve(&hpka) != 1U)
+  if( HAL_PKA_PointCheck_IsOnCurve(hpka) != 1U)
   {
 	ret = MBEDTLS_ERR_ECP_INVALID_KEY;
   }
 
 cleanup:
-  /* De-initialize HW peripheral */
-  HAL_PKA_DeInit(&hpka);
-
-  /* Disable HW peripheral clock */
-  __HAL_RCC_PKA_CLK_DISABLE();
+  /* End of HW peripheral operation */
+  if (hpka != NULL)
+  {
+    ST_PKA_Close();
+  }
 
   /* Free memory */
   if (pt_binary != NULL)
@@ -2011,12 +2108,6 @@ cleanup:
     mbedtls_free(pt_binary);
   }
 
-  if (pt_montgomery != NULL)
-  {
-    mbedtls_platform_zeroize(pt_montgomery, grp->st_modulus_size);
-    mbedtls_free(pt_montgomery);
-  }
-
   return ret;
 }
 #endif /* MBEDTLS_ECP_SHORT_WEIERSTRASS_ENABLED */
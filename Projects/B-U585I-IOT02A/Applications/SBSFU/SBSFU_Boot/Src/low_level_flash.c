@@ -19,6 +19,7 @@
 #include <string.h>
 #include "stm32u5xx.h"
 #include "flash_layout.h"
+#include "boot_hal_timemonitor.h"
 #include "stm32u5xx_hal.h"
 #include <stdio.h>
 #ifdef TFM_DEV_MODE
@@ -380,6 +381,9 @@ static int32_t Flash_ReadData(uint32_t addr, void *data, uint32_t cnt)
 #endif /*  DEBUG_FLASH_ACCESS */
   DoubleECC_Error_Counter = 0U;
 
+  /* The read stays a CPU copy, also when the data are hashed : the double ECC error recovery of NMI_Handler
+     skips the faulting CPU instruction and cannot recover a DMA access */
+  BOOT_TIME_START(start);
 #if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U) && !defined(LOCAL_LOADER_CONFIG)
   /* area secure and non secure are done with a non secure access */
   if (is_range_secure(&ARM_FLASH0_DEV, addr, cnt))
@@ -393,6 +397,7 @@ static int32_t Flash_ReadData(uint32_t addr, void *data, uint32_t cnt)
 #else
   memcpy_flash(data, (void *)((uint32_t)addr + FLASH_BASE_NS), cnt);
 #endif
+  BOOT_TIME_STOP(BOOT_TIME_FLASH_READ, start);
   if (DoubleECC_Error_Counter == 0U)
   {
     ret = ARM_DRIVER_OK;
@@ -35,16 +35,124 @@
 #include "mbedtls/platform.h"
 #include "mbedtls/platform_util.h"
 #include "error.h"
+#include "boot_hal_timemonitor.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 #define ST_SHA256_TIMEOUT     ((uint32_t) 3)
 /* #define ST_HW_CONTEXT_SAVING */   /* Allows hash buffers interleaving */
+#if defined(HW_CRYPTO_HASH_DMA)
+#if defined(ST_HW_CONTEXT_SAVING)
+#error "HW_CRYPTO_HASH_DMA does not allow hash buffers interleaving : the DMA staging buffers are shared"
+#endif /* ST_HW_CONTEXT_SAVING */
+#define ST_SHA256_DMA_CHANNEL GPDMA1_Channel0
+#endif /* HW_CRYPTO_HASH_DMA */
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if defined(HW_CRYPTO_HASH_DMA)
+static DMA_HandleTypeDef sha256_hdma;
+/* The caller buffer is reused as soon as mbedtls_sha256_update returns (next flash read) : the DMA reads a copy */
+static uint32_t sha256_dma_buffer[2][ST_SHA256_DMA_BUFFER_SIZE / 4U];
+static uint32_t sha256_dma_index = 0U;
+#endif /* HW_CRYPTO_HASH_DMA */
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+#if defined(HW_CRYPTO_HASH_DMA)
+static int sha256_dma_init(void)
+{
+  __HAL_RCC_GPDMA1_CLK_ENABLE();
+
+  sha256_hdma.Instance                   = ST_SHA256_DMA_CHANNEL;
+  sha256_hdma.Init.Request               = GPDMA1_REQUEST_HASH_IN;
+  sha256_hdma.Init.BlkHWRequest          = DMA_BREQ_SINGLE_BURST;
+  sha256_hdma.Init.Direction             = DMA_MEMORY_TO_PERIPH;
+  sha256_hdma.Init.SrcInc                = DMA_SINC_INCREMENTED;
+  sha256_hdma.Init.DestInc               = DMA_DINC_FIXED;
+  sha256_hdma.Init.SrcDataWidth          = DMA_SRC_DATAWIDTH_WORD;
+  sha256_hdma.Init.DestDataWidth         = DMA_DEST_DATAWIDTH_WORD;
+  sha256_hdma.Init.SrcBurstLength        = 1U;
+  sha256_hdma.Init.DestBurstLength       = 1U;
+  sha256_hdma.Init.Priority              = DMA_HIGH_PRIORITY;
+  sha256_hdma.Init.TransferEventMode     = DMA_TCEM_BLOCK_TRANSFER;
+  sha256_hdma.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  sha256_hdma.Init.Mode                  = DMA_NORMAL;
+  if (HAL_DMA_Init(&sha256_hdma) != HAL_OK)
+  {
+    return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+  }
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+  /* Staging buffers and HASH are accessed through their secure alias */
+  if (HAL_DMA_ConfigChannelAttributes(&sha256_hdma, DMA_CHANNEL_PRIV | DMA_CHANNEL_SEC |
+                                      DMA_CHANNEL_SRC_SEC | DMA_CHANNEL_DEST_SEC) != HAL_OK)
+  {
+    return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+  }
+#endif /* __ARM_FEATURE_CMSE */
+  return 0;
+}
+
+static void sha256_dma_deinit(void)
+{
+  if (sha256_hdma.Instance != NULL)
+  {
+#if defined (__ARM_FEATURE_CMSE) && (__ARM_FEATURE_CMSE == 3U)
+    /* Channel given back with its reset attributes */
+    (void)HAL_DMA_ConfigChannelAttributes(&sha256_hdma, DMA_CHANNEL_NPRIV | DMA_CHANNEL_NSEC |
+                                          DMA_CHANNEL_SRC_NSEC | DMA_CHANNEL_DEST_NSEC);
+#endif /* __ARM_FEATURE_CMSE */
+    (void)HAL_DMA_DeInit(&sha256_hdma);
+    sha256_hdma.Instance = NULL;
+  }
+}
+
+static int sha256_dma_wait(mbedtls_sha256_context *ctx)
+{
+  HAL_StatusTypeDef status;
+
+  if (ctx->dma_pending == 0U)
+  {
+    return 0;
+  }
+  BOOT_TIME_START(start);
+  ctx->dma_pending = 0U;
+  status = HAL_DMA_PollForTransfer(&sha256_hdma, HAL_DMA_FULL_TRANSFER, ST_SHA256_TIMEOUT);
+  CLEAR_BIT(HASH->CR, HASH_CR_DMAE);
+  BOOT_TIME_STOP(BOOT_TIME_HASH_WAIT, start);
+  return (status == HAL_OK) ? 0 : MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+}
+
+/* Blocks following the first one : each chunk is copied to the free staging buffer while the DMA feeds the
+   HASH from the other one, the last transfer runs after return */
+static int sha256_dma_feed(mbedtls_sha256_context *ctx, const unsigned char *input, size_t ilen)
+{
+  size_t len;
+
+  while (ilen != 0U)
+  {
+    len = (ilen < ST_SHA256_DMA_BUFFER_SIZE) ? ilen : ST_SHA256_DMA_BUFFER_SIZE;
+    memcpy(sha256_dma_buffer[sha256_dma_index], input, len);
+    if (sha256_dma_wait(ctx) != 0)
+    {
+      return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+    /* Multiple DMA transfers : the digest is not computed at the end of a transfer */
+    __HAL_HASH_SET_MDMAT();
+    if (HAL_DMA_Start(&sha256_hdma, (uint32_t)sha256_dma_buffer[sha256_dma_index],
+                      (uint32_t)&HASH->DIN, len) != HAL_OK)
+    {
+      return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+    SET_BIT(HASH->CR, HASH_CR_DMAE);
+    ctx->dma_pending = 1U;
+    sha256_dma_index ^= 1U;
+    input += len;
+    ilen -= len;
+  }
+  return 0;
+}
+#endif /* HW_CRYPTO_HASH_DMA */
 
 /* Implementation that should never be optimized out by the compiler */
 static void mbedtls_zeroize(void *value, size_t size)
@@ -71,6 +179,10 @@ void mbedtls_sha256_free(mbedtls_sha256_context *ctx)
     return;
   }
 
+#if defined(HW_CRYPTO_HASH_DMA)
+  (void)sha256_dma_wait(ctx);
+  sha256_dma_deinit();
+#endif /* HW_CRYPTO_HASH_DMA */
   mbedtls_zeroize(ctx, sizeof(mbedtls_sha256_context));
 }
 
@@ -82,6 +194,14 @@ void mbedtls_sha256_clone(mbedtls_sha256_context *dst,
 
 int mbedtls_sha256_starts(mbedtls_sha256_context *ctx, int is224)
 {
+#if defined(HW_CRYPTO_HASH_DMA)
+  if (sha256_dma_wait(ctx) != 0)
+  {
+    return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+  }
+  __HAL_HASH_RESET_MDMAT();
+#endif /* HW_CRYPTO_HASH_DMA */
+
   /* HASH Configuration */
   if (HAL_HASH_DeInit(&ctx->hhash) != HAL_OK)
   {
@@ -93,6 +213,13 @@ int mbedtls_sha256_starts(mbedtls_sha256_context *ctx, int is224)
     return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
   }
 
+#if defined(HW_CRYPTO_HASH_DMA)
+  if (sha256_dma_init() != 0)
+  {
+    return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+  }
+#endif /* HW_CRYPTO_HASH_DMA */
+
   ctx->is224 = is224;
 
   /* first block on 17 words */
@@ -110,6 +237,12 @@ int mbedtls_sha256_starts(mbedtls_sha256_context *ctx, int is224)
 
 int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx, const unsigned char data[ST_SHA256_BLOCK_SIZE])
 {
+#if defined(HW_CRYPTO_HASH_DMA)
+  if (sha256_dma_wait(ctx) != 0)
+  {
+    return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+  }
+#endif /* HW_CRYPTO_HASH_DMA */
 #ifdef ST_HW_CONTEXT_SAVING
   /* restore hw context */
   HAL_HASH_ContextRestoring(&ctx->hhash, ctx->ctx_save_regs);
@@ -141,6 +274,7 @@ int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx, const unsigned
 int mbedtls_sha256_update(mbedtls_sha256_context *ctx, const unsigned char *input, size_t ilen)
 {
   size_t currentlen = ilen;
+  BOOT_TIME_START(start);
 
 #ifdef ST_HW_CONTEXT_SAVING
   /* restore hw context */
@@ -159,6 +293,13 @@ int mbedtls_sha256_update(mbedtls_sha256_context *ctx, const unsigned char *inpu
     memcpy(ctx->sbuf + ctx->sbuf_len, input, (ST_SHA256_BLOCK_SIZE + ctx->first - ctx->sbuf_len));
     currentlen -= (ST_SHA256_BLOCK_SIZE + ctx->first - ctx->sbuf_len);
 
+#if defined(HW_CRYPTO_HASH_DMA)
+    /* The HASH is fed by the CPU for the context buffer */
+    if (sha256_dma_wait(ctx) != 0)
+    {
+      return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+#endif /* HW_CRYPTO_HASH_DMA */
     if (ctx->is224 == 0)
     {
       if (HAL_HASHEx_SHA256_Accmlt(&ctx->hhash, (uint8_t *)(ctx->sbuf), ST_SHA256_BLOCK_SIZE + ctx->first) != 0)
@@ -176,6 +317,16 @@ int mbedtls_sha256_update(mbedtls_sha256_context *ctx, const unsigned char *inpu
 
     /* Process following input data with size multiple of ST_SHA256_BLOCK_SIZE bytes */
     size_t iter = currentlen / ST_SHA256_BLOCK_SIZE;
+#if defined(HW_CRYPTO_HASH_DMA)
+    if (iter != 0)
+    {
+      if (sha256_dma_feed(ctx, input + ST_SHA256_BLOCK_SIZE + ctx->first - ctx->sbuf_len,
+                          (iter * ST_SHA256_BLOCK_SIZE)) != 0)
+      {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+      }
+    }
+#else
     if (iter != 0)
     {
       if (ctx->is224 == 0)
@@ -197,6 +348,7 @@ int mbedtls_sha256_update(mbedtls_sha256_context *ctx, const unsigned char *inpu
         }
       }
     }
+#endif /* HW_CRYPTO_HASH_DMA */
 
     /* following blocks on 16 words */
     ctx->first = 0;
@@ -213,11 +365,21 @@ int mbedtls_sha256_update(mbedtls_sha256_context *ctx, const unsigned char *inpu
   /* save hw context */
   HAL_HASH_ContextSaving(&ctx->hhash, ctx->ctx_save_regs);
 #endif /* ST_HW_CONTEXT_SAVING */
+  BOOT_TIME_STOP(BOOT_TIME_HASH, start);
   return 0;
 }
 
 int mbedtls_sha256_finish(mbedtls_sha256_context *ctx, unsigned char *output)
 {
+  BOOT_TIME_START(start);
+#if defined(HW_CRYPTO_HASH_DMA)
+  if (sha256_dma_wait(ctx) != 0)
+  {
+    return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+  }
+  __HAL_HASH_RESET_MDMAT();
+  sha256_dma_deinit();
+#endif /* HW_CRYPTO_HASH_DMA */
 #ifdef ST_HW_CONTEXT_SAVING
   /* restore hw context */
   HAL_HASH_ContextRestoring(&ctx->hhash, ctx->ctx_save_regs);
@@ -241,6 +403,7 @@ int mbedtls_sha256_finish(mbedtls_sha256_context *ctx, unsigned char *output)
 
   ctx->sbuf_len = 0;
 
+  BOOT_TIME_STOP(BOOT_TIME_HASH, start);
   return 0;
 }
 
@@ -71,6 +71,7 @@ typedef enum
 #define NAK                     ((uint8_t)0x15U)  /*!< negative acknowledge */
 #define CA                      ((uint8_t)0x18U)  /*!< two of these in succession aborts transfer */
 #define CRC16                   ((uint8_t)0x43U)  /*!< 'C' == 0x43, request 16-bit CRC */
+#define YMODEM_G                ((uint8_t)0x47U)  /*!< 'G' == 0x47, request 16-bit CRC and streaming (Ymodem-G) */
 #define RB                      ((uint8_t)0x72U)  /*!< Startup sequence */
 #define NEGATIVE_BYTE           ((uint8_t)0xFFU)  /*!< Negative Byte*/
 
@@ -81,6 +82,12 @@ typedef enum
 #define DOWNLOAD_TIMEOUT        ((uint32_t)2000U) /* One second retry delay */
 #define MAX_ERRORS              ((uint32_t)5U)    /*!< Maximum number of retry*/
 
+#if !defined  (YMODEM_G_STREAMING)
+#define YMODEM_G_STREAMING      0U                /* 1: Ymodem-G requested first (requires COM_UART_RX_DMA): the
+                                                        packets are not acknowledged, any error aborts the transfer */
+#endif /* YMODEM_G_STREAMING */
+#define YMODEM_G_TRIES          ((uint32_t)5U)    /*!< Ymodem-G requests before falling back to Ymodem */
+
 /* Exported functions ------------------------------------------------------- */
 void Ymodem_Init(void);
 COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination);
@@ -26,6 +26,7 @@
 /*#include "low_level_flash.h"*/
 #include "ymodem.h"
 #include "fw_update_app.h"
+#include "delta_patch.h"
 #include "region_defs.h"
 #include "Driver_Flash.h"
 #include "string.h"
@@ -34,6 +35,10 @@
 #include "secure_nsc.h"
 #endif /* MCUBOOT_PRIMARY_ONLY */
 
+#if (FW_UPDATE_DELTA_PATCH == 1) && defined(MCUBOOT_PRIMARY_ONLY)
+#error "FW_UPDATE_DELTA_PATCH requires the secondary slots: the active slot is the source of the patch"
+#endif /* (FW_UPDATE_DELTA_PATCH == 1) && defined(MCUBOOT_PRIMARY_ONLY) */
+
 /** @addtogroup USER_APP User App Example
   * @{
   */
@@ -49,6 +54,10 @@ static uint32_t m_uNbrBlocksYmodem = 0U;   /* !< Ymodem Number of blocks*/
 static uint32_t m_uPacketsReceived = 0U;   /* !< Ymodem packets received*/
 static uint32_t m_uFlashSectorSize = 0U;   /* !< Flash Sector Size */
 static uint32_t m_uFlashMinWriteSize = 0U; /* !< FLash Min Write access*/
+#if (FW_UPDATE_DELTA_PATCH == 1)
+static SFU_FwImageFlashTypeDef *m_pFwImageDwlArea = NULL; /* !< Area of the image being downloaded */
+static uint32_t m_uDeltaPatch = 0U;        /* !< Downloaded file is a delta patch */
+#endif /* (FW_UPDATE_DELTA_PATCH == 1) */
 #if   !defined(MCUBOOT_PRIMARY_ONLY)
 /** @defgroup  FW_UPDATE_Private_Const Private Const
   * @{
@@ -168,6 +177,9 @@ static HAL_StatusTypeDef FW_UPDATE_SECURE_APP_IMAGE(void)
   fw_image_dwl_area.MaxSizeInBytes = FLASH_AREA_2_SIZE;
 #endif /* MCUBOOT_PRIMARY_ONLY */
   fw_image_dwl_area.ImageOffsetInBytes = 0x0;
+  /* Secure active slot not readable from the non secure side */
+  fw_image_dwl_area.ActiveAddr = FW_UPDATE_NO_ACTIVE_SLOT;
+  fw_image_dwl_area.ActiveMaxSizeInBytes = 0U;
   m_uFlashSectorSize = data->sector_size;
   m_uFlashMinWriteSize = data->program_unit;
   /* Download new firmware image*/
@@ -207,6 +219,8 @@ static HAL_StatusTypeDef FW_UPDATE_NONSECURE_APP_IMAGE(void)
 #endif /* MCUBOOT_PRIMARY_ONLY */
   fw_image_dwl_area.MaxSizeInBytes = FLASH_NS_PARTITION_SIZE;
   fw_image_dwl_area.ImageOffsetInBytes = 0x0;
+  fw_image_dwl_area.ActiveAddr = FLASH_AREA_1_OFFSET;
+  fw_image_dwl_area.ActiveMaxSizeInBytes = FLASH_NS_PARTITION_SIZE;
   m_uFlashSectorSize = data->sector_size;
   m_uFlashMinWriteSize = data->program_unit;
   /* Download new firmware image*/
@@ -244,6 +258,9 @@ static HAL_StatusTypeDef FW_UPDATE_SECURE_DATA_IMAGE(void)
   fw_image_dwl_area.MaxSizeInBytes = FLASH_AREA_6_SIZE;
 #endif /* MCUBOOT_PRIMARY_ONLY */
   fw_image_dwl_area.ImageOffsetInBytes = 0x0;
+  /* Secure active slot not readable from the non secure side */
+  fw_image_dwl_area.ActiveAddr = FW_UPDATE_NO_ACTIVE_SLOT;
+  fw_image_dwl_area.ActiveMaxSizeInBytes = 0U;
   m_uFlashSectorSize = data->sector_size;
   m_uFlashMinWriteSize = data->program_unit;
   /* Download new firmware image*/
@@ -281,6 +298,8 @@ static HAL_StatusTypeDef FW_UPDATE_NONSECURE_DATA_IMAGE(void)
   fw_image_dwl_area.MaxSizeInBytes = FLASH_AREA_7_SIZE;
 #endif /* defined(MCUBOOT_PRIMARY_ONLY) */
   fw_image_dwl_area.ImageOffsetInBytes = 0x0;
+  fw_image_dwl_area.ActiveAddr = FLASH_AREA_5_OFFSET;
+  fw_image_dwl_area.ActiveMaxSizeInBytes = FLASH_AREA_5_SIZE;
   m_uFlashSectorSize = data->sector_size;
   m_uFlashMinWriteSize = data->program_unit;
   /* Download new firmware image*/
@@ -375,11 +394,30 @@ static HAL_StatusTypeDef FW_UPDATE_DownloadNewFirmware(SFU_FwImageFlashTypeDef *
 
   /*Init of Ymodem*/
   Ymodem_Init();
+#if (FW_UPDATE_DELTA_PATCH == 1)
+  m_pFwImageDwlArea = pFwImageDwlArea;
+  m_uDeltaPatch = 0U;
+#endif /* (FW_UPDATE_DELTA_PATCH == 1) */
 
   /*Receive through Ymodem*/
   e_result = Ymodem_Receive(&u_fw_size, pFwImageDwlArea->DownloadAddr);
   printf("\r\n\n");
 
+#if (FW_UPDATE_DELTA_PATCH == 1)
+  if ((e_result == COM_OK) && (m_uDeltaPatch == 1U))
+  {
+    /* Program the end of the image and check it, u_fw_size becomes the image size */
+    if (DELTA_Finalize(&u_fw_size) == DELTA_OK)
+    {
+      printf("  -- -- Delta patch applied on the active slot image\r\n\n");
+    }
+    else
+    {
+      e_result = COM_ERROR;
+    }
+  }
+#endif /* (FW_UPDATE_DELTA_PATCH == 1) */
+
   if ((e_result == COM_OK))
   {
     printf("  -- -- Programming Completed Successfully!\r\n\n");
@@ -485,6 +523,35 @@ HAL_StatusTypeDef Ymodem_DataPktRxCpltCallback(uint8_t *pData, uint32_t uFlashDe
 
     m_uPacketsReceived = 0U;
   }
+#if (FW_UPDATE_DELTA_PATCH == 1)
+  /* A file starting with the delta patch magic rebuilds the image from the active slot one */
+  if ((uFlashDestination == m_pFwImageDwlArea->DownloadAddr) && (DELTA_IsPatch(pData, uSize) == 1U))
+  {
+    if (m_pFwImageDwlArea->ActiveAddr == FW_UPDATE_NO_ACTIVE_SLOT)
+    {
+      m_uFileSizeYmodem = 0U;
+      m_uPacketsReceived = 0U;
+      m_uNbrBlocksYmodem = 0U;
+      return HAL_ERROR;
+    }
+    DELTA_Init(m_pFwImageDwlArea->ActiveAddr, m_pFwImageDwlArea->ActiveMaxSizeInBytes,
+               m_pFwImageDwlArea->DownloadAddr, m_pFwImageDwlArea->MaxSizeInBytes - sizeof(MagicTrailerValue),
+               m_uFlashMinWriteSize);
+    m_uDeltaPatch = 1U;
+  }
+  if (m_uDeltaPatch == 1U)
+  {
+    if (DELTA_Process(pData, uSize) != DELTA_OK)
+    {
+      /*Reset of the ymodem variables */
+      m_uFileSizeYmodem = 0U;
+      m_uPacketsReceived = 0U;
+      m_uNbrBlocksYmodem = 0U;
+      return HAL_ERROR;
+    }
+    return HAL_OK;
+  }
+#endif /* (FW_UPDATE_DELTA_PATCH == 1) */
   /*Adjust dimension to 64-bit length */
   if (uSize %  m_uFlashMinWriteSize != 0U)
   {
@@ -34,6 +34,10 @@
 #include "string.h"
 #include "main.h"
 
+#if (YMODEM_G_STREAMING == 1U) && (COM_UART_RX_DMA == 0U)
+#error "YMODEM_G_STREAMING requires COM_UART_RX_DMA: packets are received while the previous one is programmed"
+#endif /* (YMODEM_G_STREAMING == 1U) && (COM_UART_RX_DMA == 0U) */
+
 /* Private const -------------------------------------------------------------*/
 const char BACK_SLASH_POINT[]="\b.";
 /* Private typedef -----------------------------------------------------------*/
@@ -67,6 +71,11 @@ static HAL_StatusTypeDef ReceivePacket(uint8_t *pData, uint32_t *puLength, uint3
   uint32_t crc;
   uint32_t packet_size = 0U;
   HAL_StatusTypeDef status;
+#if (COM_UART_RX_DMA == 1U)
+  uint32_t computed_crc = 0U;
+  uint32_t received;
+  uint16_t length;
+#endif /* (COM_UART_RX_DMA == 1U) */
   uint8_t char1;
   uint8_t char2;
   uint8_t char3;
@@ -121,7 +130,34 @@ static HAL_StatusTypeDef ReceivePacket(uint8_t *pData, uint32_t *puLength, uint3
 
     if (packet_size >= PACKET_SIZE)
     {
+#if (COM_UART_RX_DMA == 1U)
+      /* The CRC is computed on the data already received while the end of the packet is being received */
+      status = COM_Receive_Y(&pData[PACKET_NUMBER_INDEX], PACKET_HEADER_SIZE - 1U, uTimeout);
+      received = 0U;
+      while ((status == HAL_OK) && (received < packet_size))
+      {
+        status = COM_Receive_Y_Partial(&pData[PACKET_DATA_INDEX + received], packet_size - received, &length,
+                                       uTimeout);
+        if (status == HAL_OK)
+        {
+          if (received == 0U)
+          {
+            computed_crc = HAL_CRC_Calculate(&CrcHandle, (uint32_t *)&pData[PACKET_DATA_INDEX], length);
+          }
+          else
+          {
+            computed_crc = HAL_CRC_Accumulate(&CrcHandle, (uint32_t *)&pData[PACKET_DATA_INDEX + received], length);
+          }
+          received += length;
+        }
+      }
+      if (status == HAL_OK)
+      {
+        status = COM_Receive_Y(&pData[packet_size + PACKET_DATA_INDEX], PACKET_TRAILER_SIZE, uTimeout);
+      }
+#else
       status = COM_Receive_Y(&pData[PACKET_NUMBER_INDEX], packet_size + PACKET_OVERHEAD_SIZE, uTimeout);
+#endif /* (COM_UART_RX_DMA == 1U) */
 
       /* Simple packet sanity check */
       if (status == HAL_OK)
@@ -136,7 +172,11 @@ static HAL_StatusTypeDef ReceivePacket(uint8_t *pData, uint32_t *puLength, uint3
           /* Check packet CRC */
           crc = pData[ packet_size + PACKET_DATA_INDEX ] << 8U;
           crc += pData[ packet_size + PACKET_DATA_INDEX + 1U ];
+#if (COM_UART_RX_DMA == 1U)
+          if (computed_crc != crc)
+#else
           if (HAL_CRC_Calculate(&CrcHandle, (uint32_t *)&pData[PACKET_DATA_INDEX], packet_size) != crc)
+#endif /* (COM_UART_RX_DMA == 1U) */
           {
             packet_size = 0U;
             status = HAL_ERROR;
@@ -211,6 +251,13 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
   uint32_t packets_received;
   COM_StatusTypeDef e_result = COM_OK;
   uint32_t cause = 0;
+  uint32_t streaming = 0U;
+#if (YMODEM_G_STREAMING == 1U)
+  uint32_t g_requests = 0U;
+  uint8_t start_char = YMODEM_G;
+#else
+  uint8_t start_char = CRC16;
+#endif /* (YMODEM_G_STREAMING == 1U) */
   while ((session_done == 0U) && (e_result == COM_OK))
   {
     packets_received = 0U;
@@ -232,8 +279,8 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
               e_result = COM_ABORT;
               break;
             case 0U:
-              /* End of transmission */
-              if (!eot)
+              /* End of transmission, acknowledged at once with Ymodem-G */
+              if ((!eot) && (streaming == 0U))
               {
                     Serial_PutByte(NAK);
                     eot = 1;
@@ -250,6 +297,14 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
               if (m_aPacketData[PACKET_NUMBER_INDEX] != (packets_received & 0xff))
               {
                 /*             Serial_PutByte(NAK);*/
+                if (streaming == 1U)
+                {
+                  /* Ymodem-G packets are not repeated, a packet is missing */
+                  Serial_PutByte(CA);
+                  Serial_PutByte(CA);
+                  e_result = COM_ERROR;
+                  cause = 6;
+                }
               }
               else
               {
@@ -287,10 +342,16 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
                     /* Header packet received callback call*/
                     if ((*puSize) && (Ymodem_HeaderPktRxCpltCallback(uFlashDestination, (uint32_t) filesize) == HAL_OK))
                     {
-
-                      Serial_PutByte(ACK);
+#if (YMODEM_G_STREAMING == 1U)
+                      /* The sender answered a Ymodem-G request : the data packets are streamed */
+                      streaming = (start_char == YMODEM_G) ? 1U : 0U;
+#endif /* (YMODEM_G_STREAMING == 1U) */
+                      if (streaming == 0U)
+                      {
+                        Serial_PutByte(ACK);
+                      }
                       COM_Flush();
-                      Serial_PutByte(CRC16);
+                      Serial_PutByte(start_char);
                     }
                     else
                     {
@@ -315,19 +376,31 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
                 else /* Data packet */
                 {
                   ramsource = (uint32_t) & m_aPacketData[PACKET_DATA_INDEX];
+#if (COM_UART_RX_DMA == 1U)
+                  /* Early acknowledge : the next packet is received by the GPDMA while this one is programmed,
+                     a programming error aborts the transfer during the next packet */
+                  if ((*puSize) && (streaming == 0U))
+                  {
+                    Serial_PutByte(ACK);
+                  }
+#endif /* (COM_UART_RX_DMA == 1U) */
 
                   /* Data packet received callback call*/
                   if ((*puSize) && (Ymodem_DataPktRxCpltCallback((uint8_t *)
                                                                  ramsource, uFlashDestination, (uint32_t) packet_length) == HAL_OK))
                   {
                     uFlashDestination += (packet_length);
+#if (COM_UART_RX_DMA == 0U)
                     Serial_PutByte(ACK);
+#endif /* (COM_UART_RX_DMA == 0U) */
                   }
                   else /* An error occurred while writing to Flash memory */
                   {
                     /* End session */
+                    tmp = CA;
                     COM_Transmit_Y(&tmp, 1U, NAK_TIMEOUT);
                     COM_Transmit_Y(&tmp, 1U, NAK_TIMEOUT);
+                    e_result = COM_ERROR;
                     cause = 4;
                   }
                 }
@@ -348,7 +421,15 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
           {
             errors ++;
           }
-          if (errors > MAX_ERRORS)
+          if ((streaming == 1U) && (packets_received > 0U))
+          {
+            /* Ymodem-G packets are not repeated, abort the file on any error */
+            Serial_PutByte(CA);
+            Serial_PutByte(CA);
+            e_result = COM_ERROR;
+            cause = 7;
+          }
+          else if (errors > MAX_ERRORS)
           {
             /* Abort communication */
             Serial_PutByte(CA);
@@ -356,7 +437,14 @@ COM_StatusTypeDef Ymodem_Receive(uint32_t *puSize, uint32_t uFlashDestination)
           }
           else
           {
-            Serial_PutByte(CRC16); /* Ask for a packet */
+#if (YMODEM_G_STREAMING == 1U)
+            /* Fall back to Ymodem when the sender does not answer the Ymodem-G requests */
+            if ((start_char == YMODEM_G) && (session_begin == 0U) && (++g_requests > YMODEM_G_TRIES))
+            {
+              start_char = CRC16;
+            }
+#endif /* (YMODEM_G_STREAMING == 1U) */
+            Serial_PutByte(start_char); /* Ask for a packet */
             /* Replace C char by . on display console */
             COM_Transmit_Y((uint8_t *)BACK_SLASH_POINT, sizeof(BACK_SLASH_POINT)-1, TX_TIMEOUT);
           }
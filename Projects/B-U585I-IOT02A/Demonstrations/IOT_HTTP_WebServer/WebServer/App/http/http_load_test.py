@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    http_load_test.py
+#  @author  MCD Application Team
+#  @brief   Web server load test, measures the requests rate and the latency percentiles seen by concurrent clients
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+Each client opens a persistent connection to the board and sends its requests one after the other, cycling through
+the paths; the connection is reopened when the server closes it (HTTP_KEEPALIVE_MAX_REQUESTS, keep-alive timeout).
+Start more clients than HTTP_MAX_CONNECTIONS to observe the connections waiting in the listen backlog.
+
+Usage: python http_load_test.py <board IP address> [--clients N] [--requests N] [--path <path>]... [--identity]
+"""
+
+import argparse
+import socket
+import threading
+import time
+
+DEFAULT_PATHS = ["/", "/static/js/main.js", "/static/css/main.css", "/favicon.png", "/Read_Temperature"]
+
+
+class Client(threading.Thread):
+    def __init__(self, index, args):
+        threading.Thread.__init__(self, daemon=True)
+        self.index = index
+        self.args = args
+        self.latencies = []
+        self.errors = 0
+        self.connections = 0
+        self.bytes = 0
+
+    def connect(self):
+        sock = socket.create_connection((self.args.host, self.args.port), timeout=self.args.timeout)
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.connections += 1
+        return sock, b""
+
+    def read_response(self, sock, pending):
+        # Headers
+        while b"\r\n\r\n" not in pending:
+            data = sock.recv(65536)
+            if not data:
+                raise ConnectionError("closed by the server")
+            pending += data
+        head, pending = pending.split(b"\r\n\r\n", 1)
+        lines = head.decode("latin-1").split("\r\n")
+        status = int(lines[0].split(" ")[1])
+        length = 0
+        # HTTP/1.0 connections are not persistent unless the server says otherwise
+        close = lines[0].startswith("HTTP/1.0")
+        for line in lines[1:]:
+            name, _, value = line.partition(":")
+            if name.strip().lower() == "content-length":
+                length = int(value)
+            elif name.strip().lower() == "connection":
+                close = value.strip().lower() != "keep-alive"
+        # Body
+        while len(pending) < length:
+            data = sock.recv(65536)
+            if not data:
+                raise ConnectionError("closed by the server")
+            pending += data
+        self.bytes += length
+        return status, close, pending[length:]
+
+    def run(self):
+        paths = self.args.path or DEFAULT_PATHS
+        encoding = "" if self.args.identity else "Accept-Encoding: gzip\r\n"
+        sock = None
+        pending = b""
+        for i in range(self.args.requests):
+            path = paths[(self.index + i) % len(paths)]
+            request = ("GET %s HTTP/1.1\r\nHost: %s\r\n%s\r\n" % (path, self.args.host, encoding)).encode()
+            start = time.perf_counter()
+            try:
+                if sock is None:
+                    sock, pending = self.connect()
+                sock.sendall(request)
+                status, close, pending = self.read_response(sock, pending)
+                if status not in (200, 304):
+                    self.errors += 1
+            except (OSError, ValueError, IndexError):
+                self.errors += 1
+                close = True
+            self.latencies.append(time.perf_counter() - start)
+            if close and sock is not None:
+                sock.close()
+                sock = None
+        if sock is not None:
+            sock.close()
+
+
+def percentile(values, ratio):
+    return values[min(len(values) - 1, int(len(values) * ratio))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load test of the web server")
+    parser.add_argument("host", help="web server IP address")
+    parser.add_argument("--port", type=int, default=80, help="web server port")
+    parser.add_argument("--clients", type=int, default=4, help="number of concurrent clients")
+    parser.add_argument("--requests", type=int, default=100, help="number of requests per client")
+    parser.add_argument("--path", action="append", help="requested path, may be repeated (default: web page set)")
+    parser.add_argument("--identity", action="store_true", help="do not accept the gzip content-encoding")
+    parser.add_argument("--timeout", type=float, default=10.0, help="socket timeout in seconds")
+    args = parser.parse_args()
+
+    clients = [Client(i, args) for i in range(args.clients)]
+    start = time.perf_counter()
+    for client in clients:
+        client.start()
+    for client in clients:
+        client.join()
+    elapsed = time.perf_counter() - start
+
+    latencies = sorted(l for client in clients for l in client.latencies)
+    errors = sum(client.errors for client in clients)
+    print("clients      %u" % args.clients)
+    print("requests     %u (%u errors) on %u connections" % (
+        len(latencies), errors, sum(client.connections for client in clients)))
+    print("duration     %.2f s" % elapsed)
+    print("rate         %.1f requests/s, %.1f kB/s" % (
+        len(latencies) / elapsed, sum(client.bytes for client in clients) / elapsed / 1024))
+    if latencies:
+        print("latency ms   p50 %.1f  p90 %.1f  p99 %.1f  max %.1f" % (
+            percentile(latencies, 0.50) * 1000, percentile(latencies, 0.90) * 1000,
+            percentile(latencies, 0.99) * 1000, latencies[-1] * 1000))
+    for client in clients:
+        if client.latencies:
+            print("  client %-3u  %4u requests  p99 %.1f ms" % (
+                client.index, len(client.latencies), percentile(sorted(client.latencies), 0.99) * 1000))
+
+
+if __name__ == "__main__":
+    main()
@@ -19,55 +19,70 @@
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "webserver_http_cmd.h"
 
-/* HTTP commands */
-const char     http_get_cmd[]    = "GET /";
+/* HTTP methods */
+const char     http_get_cmd[]    = "GET ";
 const uint32_t http_get_cmd_size = sizeof(http_get_cmd) - 1U;
 
 /* Get html command */
-const char     http_html_cmd[]    = " ";
+const char     http_html_cmd[]    = "/";
 const uint32_t http_html_cmd_size = sizeof(http_html_cmd) - 1U;
 
 /* Get css commands */
-const char     http_css_chunk_cmd[]    = "static/css/chunk.css ";
+const char     http_css_chunk_cmd[]    = "/static/css/chunk.css";
 const uint32_t http_css_chunk_cmd_size = sizeof(http_css_chunk_cmd) - 1U;
-const char     http_css_main_cmd[]     = "static/css/main.css ";
+const char     http_css_main_cmd[]     = "/static/css/main.css";
 const uint32_t http_css_main_cmd_size  = sizeof(http_css_main_cmd) - 1U;
 
 /* Get js commands */
-const char     http_js_chunk_cmd[]    = "static/js/chunk.js ";
+const char     http_js_chunk_cmd[]    = "/static/js/chunk.js";
 const uint32_t http_js_chunk_cmd_size = sizeof(http_js_chunk_cmd) - 1U;
-const char     http_js_main_cmd[]     = "static/js/main.js ";
+const char     http_js_main_cmd[]     = "/static/js/main.js";
 const uint32_t http_js_main_cmd_size  = sizeof(http_js_main_cmd) - 1U;
 
 /* Get font command */
-const char     http_font_cmd[]    = "static/media/fa-solid-900.woff2 ";
+const char     http_font_cmd[]    = "/static/media/fa-solid-900.woff2";
 const uint32_t http_font_cmd_size = sizeof(http_font_cmd) - 1U;
 
 /* Get json command */
-const char     http_json_cmd[]    = "manifest.json ";
+const char     http_json_cmd[]    = "/manifest.json";
 const uint32_t http_json_cmd_size = sizeof(http_json_cmd) - 1U;
 
 /* Get favicon command */
-const char     http_favicon_cmd[]    = "favicon.png ";
+const char     http_favicon_cmd[]    = "/favicon.png";
 const uint32_t http_favicon_cmd_size = sizeof(http_favicon_cmd) - 1U;
 
 /* Get image command */
-const char     http_image_cmd[]    = "static/media/FLSTM32U5.jpg ";
+const char     http_image_cmd[]    = "/static/media/FLSTM32U5.jpg";
 const uint32_t http_image_cmd_size = sizeof(http_image_cmd) - 1U;
 
 /* Get css command */
-const char     http_css_cmd[]    = "styles.css ";
+const char     http_css_cmd[]    = "/styles.css";
 const uint32_t http_css_cmd_size = sizeof(http_css_cmd) - 1U;
 
 /* Read temperature command */
-const char     http_read_temperature_cmd[]    = "Read_Temperature ";
+const char     http_read_temperature_cmd[]    = "/Read_Temperature";
 const uint32_t http_read_temperature_cmd_size = sizeof(http_read_temperature_cmd) - 1U;
 /* Read pressure command */
-const char     http_read_pressure_cmd[]    = "Read_Pressure ";
+const char     http_read_pressure_cmd[]    = "/Read_Pressure";
 const uint32_t http_read_pressure_cmd_size = sizeof(http_read_pressure_cmd) - 1U;
 /* Read humidity command */
-const char     http_read_humidity_cmd[]    = "Read_Humidity ";
+const char     http_read_humidity_cmd[]    = "/Read_Humidity";
 const uint32_t http_read_humidity_cmd_size = sizeof(http_read_humidity_cmd) - 1U;
+/* Sensors event stream command */
+const char     http_sensors_stream_cmd[]    = "/Sensors_Stream";
+const uint32_t http_sensors_stream_cmd_size = sizeof(http_sensors_stream_cmd) - 1U;
+
+/* HTTP versions and request headers */
+const char     http_version_1_0[]           = "HTTP/1.0";
+const uint32_t http_version_1_0_size        = sizeof(http_version_1_0) - 1U;
+const char     http_connection_field[]      = "Connection:";
+const uint32_t http_connection_field_size   = sizeof(http_connection_field) - 1U;
+const char     http_accept_encoding_field[] = "Accept-Encoding:";
+const uint32_t http_accept_encoding_field_size = sizeof(http_accept_encoding_field) - 1U;
+const char     http_if_none_match_field[]   = "If-None-Match:";
+const uint32_t http_if_none_match_field_size = sizeof(http_if_none_match_field) - 1U;
+const char     http_gzip_coding[]           = "gzip";
+const uint32_t http_gzip_coding_size        = sizeof(http_gzip_coding) - 1U;
 
 /* HTTP response headers */
 const char *http_headers[] =
@@ -84,6 +99,13 @@ const char *http_headers[] =
   "Access-Control-Allow-Methods: GET\r\n",
   "Access-Control-Allow-Headers: cache-control, last-event-id, X-Requested-With\r\n",
   "Cache-Control: no-cache\r\n",
+  "Connection: keep-alive\r\n",
+  "Content-Length: 0\r\n",
+  "Content-Encoding: gzip\r\n",
+  "Vary: Accept-Encoding\r\n",
+  "ETag: ",
+  "HTTP/1.1 304 Not Modified\r\n",
+  "HTTP/1.1 406 Not Acceptable\r\n",
 };
 
 /* HTTP response content types */
@@ -96,4 +118,5 @@ const char *http_content_types[] =
   "font/woff2\r\n",
   "application/json\r\n",
   "image/jpg\r\n",
+  "text/event-stream\r\n",
 };
@@ -25,7 +25,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
-/* HTTP commands */
+/* HTTP methods */
 extern const char     http_get_cmd[];
 extern const uint32_t http_get_cmd_size;
 
@@ -74,6 +74,21 @@ extern const uint32_t http_read_pressure_cmd_size;
 /* Read humidity command */
 extern const char     http_read_humidity_cmd[];
 extern const uint32_t http_read_humidity_cmd_size;
+/* Sensors event stream command */
+extern const char     http_sensors_stream_cmd[];
+extern const uint32_t http_sensors_stream_cmd_size;
+
+/* HTTP versions and request headers */
+extern const char     http_version_1_0[];
+extern const uint32_t http_version_1_0_size;
+extern const char     http_connection_field[];
+extern const uint32_t http_connection_field_size;
+extern const char     http_accept_encoding_field[];
+extern const uint32_t http_accept_encoding_field_size;
+extern const char     http_if_none_match_field[];
+extern const uint32_t http_if_none_match_field_size;
+extern const char     http_gzip_coding[];
+extern const uint32_t http_gzip_coding_size;
 
 /* HTTP response headers */
 extern const char     *http_headers[];
@@ -98,6 +113,13 @@ extern const uint32_t http_content_types_size;
 #define HTTP_HEADER_CONTROL_METHODS  (9U)
 #define HTTP_HEADER_CONTROL_HEADERS  (10U)
 #define HTTP_HEADER_CACHE_CONTROL    (11U)
+#define HTTP_HEADER_CONNECTION_KEEP  (12U)
+#define HTTP_HEADER_CONTENT_EMPTY    (13U)
+#define HTTP_HEADER_CONTENT_GZIP     (14U)
+#define HTTP_HEADER_VARY_ENCODING    (15U)
+#define HTTP_HEADER_ETAG             (16U)
+#define HTTP_HEADER_NOT_MODIFIED     (17U)
+#define HTTP_HEADER_NOT_ACCEPTABLE   (18U)
 
 /* HTTP response content defines */
 #define HTTP_HEADER_CONTENT_HTML     (0U)
@@ -107,6 +129,7 @@ extern const uint32_t http_content_types_size;
 #define HTTP_HEADER_CONTENT_FONT     (4U)
 #define HTTP_HEADER_CONTENT_JSON     (5U)
 #define HTTP_HEADER_CONTENT_IMAGE    (6U)
+#define HTTP_HEADER_CONTENT_EVENTS   (7U)
 
 /* HTTP response content IDs */
 #define HTTP_HEADER_HTML_ID          (0U)
@@ -120,6 +143,7 @@ extern const uint32_t http_content_types_size;
 #define HTTP_HEADER_FONT_ID          (8U)
 #define HTTP_HEADER_JSON_ID          (9U)
 #define HTTP_HEADER_IMAGE_ID         (10U)
+#define HTTP_HEADER_EVENTS_ID        (11U)
 
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
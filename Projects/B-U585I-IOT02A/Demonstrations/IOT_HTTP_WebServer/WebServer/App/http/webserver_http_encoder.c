@@ -26,6 +26,8 @@
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
 /* Private functions -------------------------------------------------------------------------------------------------*/
 /* Functions prototypes ----------------------------------------------------------------------------------------------*/
+/* The encoders stop after the entity headers: the content-encoding, validation, cache and connection headers and the
+   end of headers are appended by webserver_http_response.c, which knows the request and the stored representation. */
 
 /**
   * @brief  Encode html response.
@@ -65,12 +67,6 @@ WebServer_StatusTypeDef webserver_http_encode_html_response(char *html_response,
   strcat(html_response, body_length);
   strcat(html_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(html_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(html_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -107,12 +103,6 @@ WebServer_StatusTypeDef webserver_http_encode_css_response(char *css_response,
   strcat(css_response, body_length);
   strcat(css_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(css_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(css_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -149,12 +139,6 @@ WebServer_StatusTypeDef webserver_http_encode_js_response(char *js_response,
   strcat(js_response, body_length);
   strcat(js_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(js_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(js_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -178,9 +162,6 @@ WebServer_StatusTypeDef webserver_http_encode_favicon_response(char *favicon_res
   /* Add http server header */
   strcat(favicon_response, http_headers[HTTP_HEADER_SERVER]);
 
-  /* Add http cache control header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
-
   /* Add http content type header */
   strcat(favicon_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
   strcat(favicon_response, http_content_types[HTTP_HEADER_CONTENT_FAVICON]);
@@ -194,12 +175,6 @@ WebServer_StatusTypeDef webserver_http_encode_favicon_response(char *favicon_res
   strcat(favicon_response, body_length);
   strcat(favicon_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(favicon_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -232,12 +207,6 @@ WebServer_StatusTypeDef webserver_http_encode_sensor_response(char *sensor_respo
   strcat(sensor_response, body_length);
   strcat(sensor_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(sensor_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(sensor_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -270,12 +239,6 @@ WebServer_StatusTypeDef webserver_http_encode_woff2_response(char *woff2_respons
   strcat(woff2_response, body_length);
   strcat(woff2_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(woff2_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(woff2_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -309,12 +272,6 @@ WebServer_StatusTypeDef webserver_http_encode_json_response(char *json_response,
   strcat(json_response, body_length);
   strcat(json_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(json_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
-
-  /* Add http end of headers */
-  strcat(json_response, http_headers[HTTP_HEADER_HEADERS_END]);
-
   return WEBSERVER_OK;
 }
 
@@ -348,11 +305,29 @@ WebServer_StatusTypeDef webserver_http_encode_image_response(char *image_respons
   strcat(image_response, body_length);
   strcat(image_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(image_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Encode event stream response, the body is not delimited and lasts until the connection is closed.
+  * @param  events_response : Pointer to event stream response buffer.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_events_response(char *events_response)
+{
+  /* Clear response buffer from any previous response */
+  memset(events_response, 0, strlen(events_response));
+
+  /* Add http accept header */
+  strcpy(events_response, http_headers[HTTP_HEADER_ACCEPT]);
+
+  /* Add http content type header */
+  strcat(events_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  strcat(events_response, http_content_types[HTTP_HEADER_CONTENT_EVENTS]);
 
-  /* Add http end of headers */
-  strcat(image_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  /* Events are never cached and may be read by pages of other origins */
+  strcat(events_response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
+  strcat(events_response, http_headers[HTTP_HEADER_CONTROL_ORIGIN]);
 
   return WEBSERVER_OK;
 }
@@ -44,5 +44,6 @@ WebServer_StatusTypeDef webserver_http_encode_json_response(char *json_response,
                                                             int json_size);
 WebServer_StatusTypeDef webserver_http_encode_image_response(char *image_response,
                                                              int image_size);
+WebServer_StatusTypeDef webserver_http_encode_events_response(char *events_response);
 
 #endif /* WEBSERVER_HTTP_ENCODER_H */
@@ -23,12 +23,47 @@
 #include "net_interface.h"
 #include "mx_wifi.h"
 
+#include <ctype.h>
+
 /* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Registered route, looked up through the path hash table
+  */
+typedef struct
+{
+  const char           *path;
+  uint32_t             path_len;
+  uint32_t             hash;
+  http_route_handler_t handler;
+  const void           *context;
+} http_route_t;
+
+/**
+  * @brief  Static web resource served by http_resource_handler
+  */
+typedef struct
+{
+  const char      *path;
+  uint32_t        headers_id;
+  const web_res_t *res;
+} http_resource_t;
+
+/**
+  * @brief  Sensor served by http_sensor_handler
+  */
+typedef struct
+{
+  const char *path;
+  int (*read)(float *value);
+} http_sensor_t;
+
 /* Private define ----------------------------------------------------------------------------------------------------*/
 #define HTTP_SERVER_PORT         (80U)
-#define HTTP_RECEIVE_BUFFER_SIZE (1500U)
 #define HTTP_SENSORS_BUFFER_SIZE (20U)
-#define HTTP_HEADERS_BUFFER_SIZE (500U)
+#define HTTP_HEADERS_BUFFER_SIZE (640U)
+
+/* Hash table size, a power of two at least twice HTTP_ROUTE_MAX to keep probe sequences short */
+#define HTTP_ROUTE_HASH_SIZE     (32U)
 
 #define MAX_SOCKET_DATASIZE      (MX_WIFI_BUFFER_SIZE - 100U)
 
@@ -38,17 +73,64 @@
 char http_sensor_value[HTTP_SENSORS_BUFFER_SIZE];
 char http_header_response[HTTP_HEADERS_BUFFER_SIZE];
 
+/* HTTP connections pool, served in turn by webserver_http_start */
+static http_connection_t http_connections[HTTP_MAX_CONNECTIONS];
+static uint32_t          http_connections_count;
+static uint32_t          http_streams_count;
+
+/* Sensors event stream frame, shared by all the stream connections */
+static char http_stream_frame[WEBSERVER_SENSORS_FRAME_SIZE];
+
+/* Route table, http_route_slots holds route index + 1 (0 for an empty slot) */
+static http_route_t http_routes[HTTP_ROUTE_MAX];
+static uint32_t     http_routes_count;
+static uint8_t      http_route_slots[HTTP_ROUTE_HASH_SIZE];
+
+/* Static web resources */
+static const http_resource_t http_resources[] =
+{
+  {http_html_cmd,      HTTP_HEADER_HTML_ID,    &html_res},
+  {http_css_chunk_cmd, HTTP_HEADER_CSS_ID,     &css_shunk_res},
+  {http_css_main_cmd,  HTTP_HEADER_CSS_ID,     &css_main_res},
+  {http_js_chunk_cmd,  HTTP_HEADER_JS_ID,      &js_shunk_res},
+  {http_js_main_cmd,   HTTP_HEADER_JS_ID,      &js_main_res},
+  {http_favicon_cmd,   HTTP_HEADER_FAVICON_ID, &favicon_res},
+  {http_json_cmd,      HTTP_HEADER_JSON_ID,    &json_res},
+  {http_font_cmd,      HTTP_HEADER_FONT_ID,    &font_res},
+  {http_image_cmd,     HTTP_HEADER_IMAGE_ID,   &image_res},
+};
+
+/* Sensors */
+static const http_sensor_t http_sensors[] =
+{
+  {http_read_temperature_cmd, webserver_temp_sensor_read},
+  {http_read_pressure_cmd,    webserver_press_sensor_read},
+  {http_read_humidity_cmd,    webserver_humid_sensor_read},
+};
+
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
-static WebServer_StatusTypeDef http_treat_request(int32_t socket);
-static WebServer_StatusTypeDef http_send_headers_response(int32_t socket,
-                                                          uint32_t headers_id,
-                                                          char *headers_buff,
-                                                          uint32_t data_size);
-static WebServer_StatusTypeDef http_send_response(int32_t socket,
-                                                  uint32_t headers_id,
-                                                  char *headers_buff,
-                                                  const char *body_buff,
-                                                  uint32_t data_size);
+static uint32_t http_hash(const char *str, uint32_t len);
+static const http_route_t *http_find_route(const char *path, uint32_t path_len);
+static WebServer_StatusTypeDef http_register_default_routes(void);
+static WebServer_StatusTypeDef http_resource_handler(http_connection_t *connection, const void *context);
+static WebServer_StatusTypeDef http_sensor_handler(http_connection_t *connection, const void *context);
+static WebServer_StatusTypeDef http_stream_handler(http_connection_t *connection, const void *context);
+static bool http_stream_push(void);
+static http_connection_t *http_connection_open(int32_t socket);
+static bool http_connection_process(http_connection_t *connection);
+static void http_connection_close(http_connection_t *connection);
+static WebServer_StatusTypeDef http_send_body(http_connection_t *connection, const char *body, uint32_t size);
+static WebServer_StatusTypeDef http_send_pending(http_connection_t *connection);
+static int32_t http_find_request_end(http_connection_t *connection);
+static bool http_field_matches(const char *field, uint32_t field_len, const char *name, uint32_t name_len);
+static const char *http_field_value(const char *field, uint32_t field_len, uint32_t name_len, uint32_t *value_len);
+static bool http_value_contains(const char *value, uint32_t value_len, const char *token, uint32_t token_len);
+static WebServer_StatusTypeDef http_treat_request(http_connection_t *connection, uint32_t request_len);
+static WebServer_StatusTypeDef http_send_status(http_connection_t *connection, uint32_t status_header);
+static WebServer_StatusTypeDef http_send_end_of_headers(http_connection_t *connection, char *headers_buff);
+static WebServer_StatusTypeDef http_encode_headers(uint32_t headers_id,
+                                                   char *headers_buff,
+                                                   uint32_t data_size);
 static WebServer_StatusTypeDef http_send(int32_t socket,
                                          const char *frame,
                                          uint32_t frame_size);
@@ -67,6 +149,15 @@ WebServer_StatusTypeDef webserver_http_start(void)
   net_ip_addr_t ip_addr_in = {0};
   int32_t timeout = MX_WIFI_CMD_TIMEOUT;
   int32_t sock = 0;
+  uint32_t accept_tick = 0U;
+  bool progress = false;
+
+  /* Register the web resources and sensors routes */
+  if (http_register_default_routes() != WEBSERVER_OK)
+  {
+    printf("*** Fail : Routes not registered !!!!\r\n");
+    return HTTP_ERROR;
+  }
 
   /* Create a TCP socket. */
   printf("\r\n");
@@ -110,185 +201,820 @@ WebServer_StatusTypeDef webserver_http_start(void)
   printf("--> Please connect to %s:%" PRIu32 "\n",
          net_ntoa(&ip_addr_in), (uint32_t)NET_NTOHS(s_addr_in.sin_port));
 
-  /* Infinite loop to serve socket communication */
+  /* Infinite loop accepting connections and serving them in turn */
   while (1)
   {
-    struct net_sockaddr_in s_addr_in_remote_host = {0};
-    uint32_t s_addr_in_remote_host_len = sizeof(s_addr_in_remote_host);
+    /* Accept when idle, or periodically so that busy connections do not starve the new ones */
+    if ((http_connections_count < HTTP_MAX_CONNECTIONS)
+        && ((!progress) || ((HAL_GetTick() - accept_tick) >= HTTP_ACCEPT_POLL_PERIOD)))
+    {
+      struct net_sockaddr_in s_addr_in_remote_host = {0};
+      uint32_t s_addr_in_remote_host_len = sizeof(s_addr_in_remote_host);
+      int32_t newconn;
 
-    /* Accept net socket requests */
-    const int32_t newconn = net_accept(sock, (struct net_sockaddr *)&s_addr_in_remote_host, (uint32_t *)&s_addr_in_remote_host_len);
+      /* Only poll the listening socket while connections are waiting to be served */
+      const int32_t accept_timeout = (http_connections_count == 0U) ? MX_WIFI_CMD_TIMEOUT : HTTP_ACCEPT_POLL_TIMEOUT;
+      if (accept_timeout != timeout)
+      {
+        timeout = accept_timeout;
+        net_setsockopt(sock, NET_SOL_SOCKET, NET_SO_RCVTIMEO, &timeout, sizeof(timeout));
+      }
 
-    /* Check if a valid new connection is requested */
-    if (newconn > 0)
-    {
-      net_ip_addr_t ip_addr_in_remote_host = {0};
-      ip_addr_in_remote_host.addr = s_addr_in_remote_host.sin_addr.s_addr;
+      /* Accept net socket requests */
+      newconn = net_accept(sock, (struct net_sockaddr *)&s_addr_in_remote_host,
+                           (uint32_t *)&s_addr_in_remote_host_len);
+      accept_tick = HAL_GetTick();
 
-      printf("Request from %s:%" PRIu32 "\n",
-             net_ntoa(&ip_addr_in_remote_host), (uint32_t)NET_NTOHS(s_addr_in_remote_host.sin_port));
+      /* Check if a valid new connection is requested */
+      if (newconn > 0)
+      {
+        net_ip_addr_t ip_addr_in_remote_host = {0};
+        ip_addr_in_remote_host.addr = s_addr_in_remote_host.sin_addr.s_addr;
+
+        printf("Request from %s:%" PRIu32 "\n",
+               net_ntoa(&ip_addr_in_remote_host), (uint32_t)NET_NTOHS(s_addr_in_remote_host.sin_port));
 
-      /* Treat net socket requests */
-      if (http_treat_request(newconn) != WEBSERVER_OK)
+        (void) http_connection_open(newconn);
+      }
+      else if (http_connections_count == 0U)
       {
-        printf("*** Fail : Invalid HTTP request !!!!\r\n");
+        printf("*** Fail : Invalid socket connection !!!! \r\n");
         return SOCKET_ERROR;
       }
+      else
+      {
+        /* No pending connection while polling */
+      }
+    }
+    else if (!progress)
+    {
+      /* All the connections are waiting for their peer and the pool is full */
+      HAL_Delay(1);
     }
     else
     {
-      printf("*** Fail : Invalid socket connection !!!! \r\n");
-      return SOCKET_ERROR;
+      /* Keep serving the connections */
+    }
+
+    /* Give each connection one step: one body slice sent, one request answered or one reception */
+    progress = false;
+    for (uint32_t i = 0U; i < HTTP_MAX_CONNECTIONS; i++)
+    {
+      if (http_connections[i].in_use && http_connection_process(&http_connections[i]))
+      {
+        progress = true;
+      }
+    }
+
+    /* Sample the sensors and push the batched frames to the event stream connections */
+    if ((http_streams_count > 0U) && http_stream_push())
+    {
+      progress = true;
     }
   }
 }
 
 /**
-  * @brief  Treat webserver HTTP request
-  * @param  socket : connection socket
+  * @brief  Register a route
+  * @param  path    : absolute request path, without query string, the string must remain valid
+  * @param  handler : function sending the response
+  * @param  context : pointer given back to the handler
   * @retval Web Server status
   */
-static WebServer_StatusTypeDef http_treat_request(int32_t socket)
+WebServer_StatusTypeDef webserver_http_register_route(const char *path,
+                                                      http_route_handler_t handler,
+                                                      const void *context)
 {
-  static unsigned char recv_buffer[HTTP_RECEIVE_BUFFER_SIZE];
+  const uint32_t path_len = strlen(path);
+  uint32_t slot;
 
-  /* Clear receive buffer */
-  memset((void*)recv_buffer, 0, sizeof(recv_buffer));
+  if ((handler == NULL) || (http_routes_count >= HTTP_ROUTE_MAX))
+  {
+    return HTTP_ERROR;
+  }
 
-  /* Read the http request */
-  if (net_recv(socket, recv_buffer, HTTP_RECEIVE_BUFFER_SIZE, 0) < 0)
+  /* A path can only be registered once */
+  if (http_find_route(path, path_len) != NULL)
   {
     return HTTP_ERROR;
   }
 
-  /* Treat get cmd */
-  if (strncmp((char *)recv_buffer, http_get_cmd, http_get_cmd_size) == 0U)
+  http_routes[http_routes_count].path     = path;
+  http_routes[http_routes_count].path_len = path_len;
+  http_routes[http_routes_count].hash     = http_hash(path, path_len);
+  http_routes[http_routes_count].handler  = handler;
+  http_routes[http_routes_count].context  = context;
+
+  /* Linear probing, the table is never full as it is larger than HTTP_ROUTE_MAX */
+  slot = http_routes[http_routes_count].hash & (HTTP_ROUTE_HASH_SIZE - 1U);
+  while (http_route_slots[slot] != 0U)
+  {
+    slot = (slot + 1U) & (HTTP_ROUTE_HASH_SIZE - 1U);
+  }
+  http_routes_count++;
+  http_route_slots[slot] = (uint8_t)http_routes_count;
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  FNV-1a hash of a path
+  * @param  str : pointer to the path
+  * @param  len : path length
+  * @retval Hash value
+  */
+static uint32_t http_hash(const char *str, uint32_t len)
+{
+  uint32_t hash = 2166136261U;
+
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    hash ^= (uint8_t)str[i];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+/**
+  * @brief  Find the route registered for a path
+  * @param  path     : pointer to the path, not necessarily null terminated
+  * @param  path_len : path length
+  * @retval Pointer to the route, NULL if none
+  */
+static const http_route_t *http_find_route(const char *path, uint32_t path_len)
+{
+  const uint32_t hash = http_hash(path, path_len);
+  uint32_t slot = hash & (HTTP_ROUTE_HASH_SIZE - 1U);
+
+  while (http_route_slots[slot] != 0U)
   {
-    /* Send html */
-    if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_html_cmd, http_html_cmd_size) == 0U)
+    const http_route_t *route = &http_routes[http_route_slots[slot] - 1U];
+
+    if ((route->hash == hash) && (route->path_len == path_len) && (memcmp(route->path, path, path_len) == 0))
     {
-      http_send_response(socket, HTTP_HEADER_HTML_ID, http_header_response, html_buff, html_buff_size);
+      return route;
     }
-    /* Send css shunk */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_css_chunk_cmd, http_css_chunk_cmd_size) == 0U)
+    slot = (slot + 1U) & (HTTP_ROUTE_HASH_SIZE - 1U);
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Register the demonstration web resources and sensors
+  * @param  None
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_register_default_routes(void)
+{
+  if (http_routes_count != 0U)
+  {
+    /* Already registered by a previous start */
+    return WEBSERVER_OK;
+  }
+
+  for (uint32_t i = 0U; i < (sizeof(http_resources) / sizeof(http_resources[0])); i++)
+  {
+    if (webserver_http_register_route(http_resources[i].path, http_resource_handler, &http_resources[i]) != WEBSERVER_OK)
     {
-      http_send_response(socket, HTTP_HEADER_CSS_ID, http_header_response, css_shunk_buff, css_shunk_buff_size);
+      return HTTP_ERROR;
     }
-    /* Send main css */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_css_main_cmd, http_css_main_cmd_size) == 0U)
+  }
+
+  for (uint32_t i = 0U; i < (sizeof(http_sensors) / sizeof(http_sensors[0])); i++)
+  {
+    if (webserver_http_register_route(http_sensors[i].path, http_sensor_handler, &http_sensors[i]) != WEBSERVER_OK)
     {
-      http_send_response(socket, HTTP_HEADER_CSS_ID, http_header_response, css_main_buff, css_main_buff_size);
+      return HTTP_ERROR;
     }
-    /* Send js shunk */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_js_chunk_cmd, http_js_chunk_cmd_size) == 0U)
+  }
+
+  if (webserver_http_register_route(http_sensors_stream_cmd, http_stream_handler, NULL) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Send a static web resource
+  * @param  connection : HTTP connection
+  * @param  context    : pointer to the http_resource_t descriptor
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_resource_handler(http_connection_t *connection, const void *context)
+{
+  const web_res_t *res = ((const http_resource_t *)context)->res;
+  const char *body;
+  const char *etag;
+  uint32_t size;
+  bool gzip;
+  bool not_modified = false;
+
+  /* Select the representation, gzip when the client accepts it */
+  if ((res->gzip_buff != NULL) && connection->accept_gzip)
+  {
+    body = res->gzip_buff;
+    size = res->gzip_size;
+    etag = res->gzip_etag;
+    gzip = true;
+  }
+  else if (res->buff != NULL)
+  {
+    body = res->buff;
+    size = res->size;
+    etag = res->etag;
+    gzip = false;
+  }
+  else
+  {
+    /* Resource only stored compressed (packed without --keep-identity) and the client does not accept gzip */
+    return http_send_status(connection, HTTP_HEADER_NOT_ACCEPTABLE);
+  }
+
+  if ((connection->if_none_match != NULL)
+      && (http_value_contains(connection->if_none_match, connection->if_none_match_len, etag, strlen(etag))
+          || http_value_contains(connection->if_none_match, connection->if_none_match_len, "*", 1U)))
+  {
+    /* The client cache is up to date */
+    not_modified = true;
+    strcpy(http_header_response, http_headers[HTTP_HEADER_NOT_MODIFIED]);
+    strcat(http_header_response, http_headers[HTTP_HEADER_SERVER]);
+  }
+  else
+  {
+    if (http_encode_headers(((const http_resource_t *)context)->headers_id, http_header_response, size) != WEBSERVER_OK)
     {
-      http_send_response(socket, HTTP_HEADER_JS_ID, http_header_response, js_shunk_buff, js_shunk_buff_size);
+      return HTTP_ERROR;
     }
-    /* Send main js */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_js_main_cmd, http_js_main_cmd_size) == 0U)
+    if (gzip)
     {
-      http_send_response(socket, HTTP_HEADER_JS_ID, http_header_response, js_main_buff, js_main_buff_size);
+      strcat(http_header_response, http_headers[HTTP_HEADER_CONTENT_GZIP]);
     }
-    /* Send favicon */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_favicon_cmd, http_favicon_cmd_size) == 0U)
+  }
+
+  /* Validation headers, the client revalidates the resource with If-None-Match */
+  if (res->gzip_buff != NULL)
+  {
+    strcat(http_header_response, http_headers[HTTP_HEADER_VARY_ENCODING]);
+  }
+  strcat(http_header_response, http_headers[HTTP_HEADER_ETAG]);
+  strcat(http_header_response, etag);
+  strcat(http_header_response, "\r\n");
+  strcat(http_header_response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
+
+  if (http_send_end_of_headers(connection, http_header_response) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* No body with a 304 response */
+  if (not_modified)
+  {
+    return WEBSERVER_OK;
+  }
+
+  return http_send_body(connection, body, size);
+}
+
+/**
+  * @brief  Send a sensor value
+  * @param  connection : HTTP connection
+  * @param  context    : pointer to the http_sensor_t descriptor
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_sensor_handler(http_connection_t *connection, const void *context)
+{
+  const http_sensor_t *sensor = (const http_sensor_t *)context;
+  float sensor_value = 0;
+
+  sensor->read(&sensor_value);
+  sprintf(http_sensor_value, "%g", sensor_value);
+
+  return webserver_http_send_response(connection, HTTP_HEADER_SENSOR_ID, http_sensor_value, strlen(http_sensor_value));
+}
+
+/**
+  * @brief  Turn the connection into a sensors event stream, see webserver_sensors_stream_poll for the frames format
+  * @param  connection : HTTP connection
+  * @param  context    : unused
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_stream_handler(http_connection_t *connection, const void *context)
+{
+  (void) context;
+
+  if (http_encode_headers(HTTP_HEADER_EVENTS_ID, http_header_response, 0U) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* The stream lasts until the client closes it, the next requests must use another connection */
+  connection->keep_alive = true;
+  if (http_send_end_of_headers(connection, http_header_response) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* The first stream starts a new batch */
+  if (http_streams_count == 0U)
+  {
+    webserver_sensors_stream_reset();
+  }
+  connection->stream = true;
+  http_streams_count++;
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Sample the sensors and send the batched frame, when complete, to every event stream connection
+  * @param  None
+  * @retval true if a frame was sent
+  */
+static bool http_stream_push(void)
+{
+  const uint32_t len = webserver_sensors_stream_poll(http_stream_frame, sizeof(http_stream_frame));
+
+  if (len == 0U)
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0U; i < HTTP_MAX_CONNECTIONS; i++)
+  {
+    http_connection_t *connection = &http_connections[i];
+
+    if (connection->in_use && connection->stream
+        && (http_send(connection->socket, http_stream_frame, len) != WEBSERVER_OK))
     {
-      http_send_response(socket, HTTP_HEADER_FAVICON_ID, http_header_response, favicon_buff, favicon_buff_size);
+      http_connection_close(connection);
     }
-    /* Send json */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_json_cmd, http_json_cmd_size) == 0U)
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Allocate a context of the pool to an accepted connection
+  * @param  socket : connection socket
+  * @retval Pointer to the connection, NULL if the pool is full (the socket is then closed)
+  */
+static http_connection_t *http_connection_open(int32_t socket)
+{
+  for (uint32_t i = 0U; i < HTTP_MAX_CONNECTIONS; i++)
+  {
+    http_connection_t *connection = &http_connections[i];
+
+    if (!connection->in_use)
     {
-      http_send_response(socket, HTTP_HEADER_JSON_ID, http_header_response, json_buff, json_buff_size);
+      connection->in_use        = true;
+      connection->socket        = socket;
+      connection->last_tick     = HAL_GetTick();
+      connection->recv_len      = 0U;
+      connection->scan_len      = 0U;
+      connection->request_count = 0U;
+      connection->keep_alive    = true;
+      connection->stream        = false;
+      connection->tx_buff       = NULL;
+      connection->tx_len        = 0U;
+      connection->tx_idx        = 0U;
+      http_connections_count++;
+      return connection;
     }
-    /* Send font */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_font_cmd, http_font_cmd_size) == 0U)
+  }
+
+  (void) net_closesocket(socket);
+
+  return NULL;
+}
+
+/**
+  * @brief  Advance a connection by one step without blocking on reception: send the next slice of the response
+  *         body, answer the next buffered (possibly pipelined) request, or read the available bytes
+  * @param  connection : HTTP connection
+  * @retval true if the step made progress, false if the connection is waiting for its peer
+  */
+static bool http_connection_process(http_connection_t *connection)
+{
+  const int32_t request_len = http_find_request_end(connection);
+  bool progress = true;
+
+  if (connection->tx_idx < connection->tx_len)
+  {
+    /* The next request is only answered once the current response is complete */
+    if (http_send_pending(connection) != WEBSERVER_OK)
+    {
+      http_connection_close(connection);
+    }
+  }
+  else if (connection->stream)
+  {
+    /* Only watch for the end of the stream, the client does not send requests on it */
+    const int32_t len = net_recv(connection->socket, (uint8_t *)connection->recv_buffer, HTTP_RECEIVE_BUFFER_SIZE,
+                                 NET_MSG_DONTWAIT);
+    if ((len == 0) || (len == NET_TIMEOUT) || (len == NET_ERROR_WOULD_BLOCK))
     {
-      http_send_response(socket, HTTP_HEADER_FONT_ID, http_header_response, font_buff, font_buff_size);
+      progress = false;
     }
-    /* Send image */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_image_cmd, http_image_cmd_size) == 0U)
+    else if (len < 0)
     {
-      http_send_response(socket, HTTP_HEADER_IMAGE_ID, http_header_response, image_buff, image_buff_size);
+      http_connection_close(connection);
     }
-    /* Send read temperature response */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_read_temperature_cmd, http_read_temperature_cmd_size) == 0U)
+    else
     {
-      float temperature_value = 0;
-      webserver_temp_sensor_read(&temperature_value);
-      sprintf(http_sensor_value, "%g", temperature_value);
-      http_send_response(socket, HTTP_HEADER_SENSOR_ID, http_header_response, http_sensor_value, strlen(http_sensor_value));
+      /* Unexpected bytes, discarded */
     }
-    /* Send read pressure response */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_read_pressure_cmd, http_read_pressure_cmd_size) == 0U)
+  }
+  else if (!connection->keep_alive)
+  {
+    /* Response complete, the connection is not persistent */
+    http_connection_close(connection);
+  }
+  else if (request_len > 0)
+  {
+    /* A complete request header is buffered, answer it */
+    if (http_treat_request(connection, (uint32_t)request_len) != WEBSERVER_OK)
     {
-      float pressure_value = 0;
-      webserver_press_sensor_read(&pressure_value);
-      sprintf(http_sensor_value, "%g", pressure_value);
-      http_send_response(socket, HTTP_HEADER_SENSOR_ID, http_header_response, http_sensor_value, strlen(http_sensor_value));
+      http_connection_close(connection);
     }
-    /* Send read humidity response */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_read_humidity_cmd, http_read_humidity_cmd_size) == 0U)
+    else
     {
-      float humidity_value = 0;
-      webserver_humid_sensor_read(&humidity_value);
-      sprintf(http_sensor_value, "%g", humidity_value);
-      http_send_response(socket, HTTP_HEADER_SENSOR_ID, http_header_response, http_sensor_value, strlen(http_sensor_value));
+      /* Keep the bytes of the next pipelined requests */
+      connection->recv_len -= (uint32_t)request_len;
+      memmove(connection->recv_buffer, &connection->recv_buffer[request_len], connection->recv_len);
+      connection->scan_len  = 0U;
+      connection->last_tick = HAL_GetTick();
     }
   }
+  else if (connection->recv_len >= HTTP_RECEIVE_BUFFER_SIZE)
+  {
+    /* Request headers larger than the receive buffer */
+    http_connection_close(connection);
+  }
   else
   {
-    return HTTP_ERROR;
+    /* Read the available bytes, the request headers may span several receptions */
+    const int32_t len = net_recv(connection->socket,
+                                 (uint8_t *)&connection->recv_buffer[connection->recv_len],
+                                 HTTP_RECEIVE_BUFFER_SIZE - connection->recv_len, NET_MSG_DONTWAIT);
+    if (len > 0)
+    {
+      connection->recv_len += (uint32_t)len;
+      connection->last_tick = HAL_GetTick();
+    }
+    else if (((len == 0) || (len == NET_TIMEOUT) || (len == NET_ERROR_WOULD_BLOCK))
+             && ((HAL_GetTick() - connection->last_tick) < (uint32_t)HTTP_KEEPALIVE_TIMEOUT))
+    {
+      /* Nothing received yet */
+      progress = false;
+    }
+    else
+    {
+      /* Connection closed by the peer or idle for HTTP_KEEPALIVE_TIMEOUT */
+      http_connection_close(connection);
+    }
   }
 
+  return progress;
+}
+
+/**
+  * @brief  Close a connection and give its context back to the pool
+  * @param  connection : HTTP connection
+  * @retval None
+  */
+static void http_connection_close(http_connection_t *connection)
+{
   /* Close connection socket */
-  if (net_closesocket(socket) != 0)
+  if (net_closesocket(connection->socket) != 0)
+  {
+    printf("*** Fail : Connection socket not closed !!!!\r\n");
+  }
+
+  if (connection->stream)
+  {
+    connection->stream = false;
+    http_streams_count--;
+  }
+
+  connection->in_use  = false;
+  connection->tx_buff = NULL;
+  connection->tx_len  = 0U;
+  connection->tx_idx  = 0U;
+  http_connections_count--;
+}
+
+/**
+  * @brief  Search the end of the request headers in the receive buffer, resuming the previous search
+  * @param  connection : HTTP connection
+  * @retval Request length including the empty line, 0 if the headers are not complete
+  */
+static int32_t http_find_request_end(http_connection_t *connection)
+{
+  /* Restart 3 bytes back, the "\r\n\r\n" sequence may straddle two receptions */
+  uint32_t idx = (connection->scan_len > 3U) ? (connection->scan_len - 3U) : 0U;
+
+  for (; (idx + 3U) < connection->recv_len; idx++)
+  {
+    if ((connection->recv_buffer[idx]      == '\r') && (connection->recv_buffer[idx + 1U] == '\n') &&
+        (connection->recv_buffer[idx + 2U] == '\r') && (connection->recv_buffer[idx + 3U] == '\n'))
+    {
+      return (int32_t)(idx + 4U);
+    }
+  }
+  connection->scan_len = connection->recv_len;
+
+  return 0;
+}
+
+/**
+  * @brief  Case insensitive check of a header line name
+  * @param  field     : pointer to the header line
+  * @param  field_len : header line length
+  * @param  name      : header name, with the colon
+  * @param  name_len  : header name length
+  * @retval true if the line is the named header
+  */
+static bool http_field_matches(const char *field, uint32_t field_len, const char *name, uint32_t name_len)
+{
+  if (field_len < name_len)
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0U; i < name_len; i++)
+  {
+    if (tolower((unsigned char)field[i]) != tolower((unsigned char)name[i]))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Get the value of a header line, without the leading spaces
+  * @param  field     : pointer to the header line
+  * @param  field_len : header line length
+  * @param  name_len  : header name length, with the colon
+  * @param  value_len : pointer to the value length
+  * @retval Pointer to the value
+  */
+static const char *http_field_value(const char *field, uint32_t field_len, uint32_t name_len, uint32_t *value_len)
+{
+  uint32_t idx = name_len;
+
+  while ((idx < field_len) && (field[idx] == ' '))
+  {
+    idx++;
+  }
+  *value_len = field_len - idx;
+
+  return &field[idx];
+}
+
+/**
+  * @brief  Case insensitive search of a token in a header value
+  * @param  value     : pointer to the header value
+  * @param  value_len : header value length
+  * @param  token     : token to search
+  * @param  token_len : token length
+  * @retval true if the token is found
+  */
+static bool http_value_contains(const char *value, uint32_t value_len, const char *token, uint32_t token_len)
+{
+  for (uint32_t i = 0U; (i + token_len) <= value_len; i++)
+  {
+    if (http_field_matches(&value[i], value_len - i, token, token_len))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+  * @brief  Treat webserver HTTP request
+  * @param  connection  : HTTP connection, the request is at the beginning of the receive buffer
+  * @param  request_len : length of the request headers
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_treat_request(http_connection_t *connection, uint32_t request_len)
+{
+  const char *request = connection->recv_buffer;
+  const http_route_t *route;
+  const char *value;
+  uint32_t value_len;
+  uint32_t path_len = 0U;
+  uint32_t line_end;
+  uint32_t idx;
+
+  /* Only the GET method is served */
+  if ((request_len < http_get_cmd_size) || (strncmp(request, http_get_cmd, http_get_cmd_size) != 0))
   {
     return HTTP_ERROR;
   }
 
-  return WEBSERVER_OK;
+  /* Request line: "GET <path>[?<query>] HTTP/1.x\r\n" */
+  for (line_end = http_get_cmd_size; request[line_end] != '\r'; line_end++)
+  {
+  }
+  while (((http_get_cmd_size + path_len) < line_end) && (request[http_get_cmd_size + path_len] != ' ')
+         && (request[http_get_cmd_size + path_len] != '?'))
+  {
+    path_len++;
+  }
+
+  /* HTTP/1.1 connections are persistent unless the client asks to close them */
+  connection->keep_alive = ((line_end < http_version_1_0_size)
+                            || (strncmp(&request[line_end - http_version_1_0_size], http_version_1_0,
+                                        http_version_1_0_size) != 0));
+
+  /* Header lines, the values point into the receive buffer and are valid until the response is sent */
+  connection->accept_gzip       = false;
+  connection->if_none_match     = NULL;
+  connection->if_none_match_len = 0U;
+  for (idx = line_end + 2U; idx < (request_len - 2U); idx = line_end + 2U)
+  {
+    for (line_end = idx; request[line_end] != '\r'; line_end++)
+    {
+    }
+
+    if (http_field_matches(&request[idx], line_end - idx, http_connection_field, http_connection_field_size))
+    {
+      value = http_field_value(&request[idx], line_end - idx, http_connection_field_size, &value_len);
+      if (http_value_contains(value, value_len, "close", 5U))
+      {
+        connection->keep_alive = false;
+      }
+      else if (http_value_contains(value, value_len, "keep-alive", 10U))
+      {
+        connection->keep_alive = true;
+      }
+    }
+    else if (http_field_matches(&request[idx], line_end - idx, http_accept_encoding_field,
+                                http_accept_encoding_field_size))
+    {
+      value = http_field_value(&request[idx], line_end - idx, http_accept_encoding_field_size, &value_len);
+      connection->accept_gzip = http_value_contains(value, value_len, http_gzip_coding, http_gzip_coding_size);
+    }
+    else if (http_field_matches(&request[idx], line_end - idx, http_if_none_match_field,
+                                http_if_none_match_field_size))
+    {
+      connection->if_none_match = http_field_value(&request[idx], line_end - idx, http_if_none_match_field_size,
+                                                   &connection->if_none_match_len);
+    }
+  }
+
+  /* Bound the number of requests served on one connection */
+  connection->request_count++;
+  if (connection->request_count >= HTTP_KEEPALIVE_MAX_REQUESTS)
+  {
+    connection->keep_alive = false;
+  }
+
+  route = http_find_route(&request[http_get_cmd_size], path_len);
+  if (route == NULL)
+  {
+    return http_send_status(connection, HTTP_HEADER_FILE_NOTFOUND);
+  }
+
+  return route->handler(connection, route->context);
 }
 
 /**
   * @brief  HTTP send headers and body responses data via socket
-  * @param  socket       : connection socket
+  * @note   A body larger than one socket send is sent by the server loop, the buffer must remain valid until then
+  * @param  connection   : HTTP connection
   * @param  headers_id   : specifies the header ID
-  * @param  headers_buff : pointer to headers buffer
+  * @param  body_buff    : pointer to body buffer
   * @param  data_size    : size of body web resources
   * @retval Web Server status
   */
-static WebServer_StatusTypeDef http_send_response(int32_t socket,
-                                                  uint32_t headers_id,
-                                                  char *headers_buff,
-                                                  const char *body_buff,
-                                                  uint32_t data_size)
+WebServer_StatusTypeDef webserver_http_send_response(http_connection_t *connection,
+                                                     uint32_t headers_id,
+                                                     const char *body_buff,
+                                                     uint32_t data_size)
 {
   /* Send HTTP header response */
-  if (http_send_headers_response(socket, headers_id, headers_buff, data_size) != WEBSERVER_OK)
+  if ((http_encode_headers(headers_id, http_header_response, data_size) != WEBSERVER_OK)
+      || (http_send_end_of_headers(connection, http_header_response) != WEBSERVER_OK))
   {
     return HTTP_ERROR;
   }
 
   /* Send HTTP body response */
-  if (http_send(socket, (const char *)body_buff, data_size) != WEBSERVER_OK)
+  return http_send_body(connection, body_buff, data_size);
+}
+
+/**
+  * @brief  Send a response body, at once when it fits in one socket send, otherwise one slice per server loop turn
+  *         so that the large bodies of concurrent connections are interleaved
+  * @param  connection : HTTP connection
+  * @param  body       : pointer to body buffer, must remain valid until sent
+  * @param  size       : body size
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_send_body(http_connection_t *connection, const char *body, uint32_t size)
+{
+  if (size <= MAX_SOCKET_DATASIZE)
+  {
+    return http_send(connection->socket, body, size);
+  }
+
+  connection->tx_buff = body;
+  connection->tx_len  = size;
+  connection->tx_idx  = 0U;
+
+  return http_send_pending(connection);
+}
+
+/**
+  * @brief  Send the next slice of the pending response body
+  * @param  connection : HTTP connection
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_send_pending(http_connection_t *connection)
+{
+  const uint32_t remaining = connection->tx_len - connection->tx_idx;
+  const uint32_t len = (remaining > MAX_SOCKET_DATASIZE) ? MAX_SOCKET_DATASIZE : remaining;
+  const int32_t ret = net_send(connection->socket, (uint8_t *)&connection->tx_buff[connection->tx_idx], len, 0);
+
+  if (ret <= 0)
   {
     return HTTP_ERROR;
   }
 
+  /* Partial sends are resumed at the next turn */
+  connection->tx_idx += (uint32_t)ret;
+  if (connection->tx_idx == connection->tx_len)
+  {
+    connection->tx_buff = NULL;
+    connection->tx_len  = 0U;
+    connection->tx_idx  = 0U;
+
+    /* The keep-alive timeout runs from the end of the response, not from its request */
+    connection->last_tick = HAL_GetTick();
+  }
+
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  HTTP send headers responses data via socket
-  * @param  socket       : connection socket
+  * @brief  HTTP send a response without body via socket
+  * @param  connection    : HTTP connection
+  * @param  status_header : status line header, HTTP_HEADER_FILE_NOTFOUND or HTTP_HEADER_NOT_ACCEPTABLE
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_send_status(http_connection_t *connection, uint32_t status_header)
+{
+  strcpy(http_header_response, http_headers[status_header]);
+  strcat(http_header_response, http_headers[HTTP_HEADER_SERVER]);
+  strcat(http_header_response, http_headers[HTTP_HEADER_CONTENT_EMPTY]);
+
+  return http_send_end_of_headers(connection, http_header_response);
+}
+
+/**
+  * @brief  Complete the headers with the connection header and send them via socket
+  * @param  connection   : HTTP connection
+  * @param  headers_buff : pointer to the encoded headers
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_send_end_of_headers(http_connection_t *connection, char *headers_buff)
+{
+  /* Add http connection header */
+  if (connection->keep_alive)
+  {
+    strcat(headers_buff, http_headers[HTTP_HEADER_CONNECTION_KEEP]);
+  }
+  else
+  {
+    strcat(headers_buff, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  }
+
+  /* Add http end of headers */
+  strcat(headers_buff, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  /* Send HTTP built response */
+  return http_send(connection->socket, (const char *)headers_buff, strlen((char*)headers_buff));
+}
+
+/**
+  * @brief  HTTP encode the status line and entity headers of a response
   * @param  headers_id   : specifies the header ID
   * @param  headers_buff : pointer to headers buffer
   * @param  data_size    : size of body web resources
   * @retval Web Server status
   */
-static WebServer_StatusTypeDef http_send_headers_response(int32_t socket,
-                                                          uint32_t headers_id,
-                                                          char *headers_buff,
-                                                          uint32_t data_size)
+static WebServer_StatusTypeDef http_encode_headers(uint32_t headers_id,
+                                                   char *headers_buff,
+                                                   uint32_t data_size)
 {
   /* Check header ID */
   switch(headers_id)
@@ -381,18 +1107,23 @@ static WebServer_StatusTypeDef http_send_headers_response(int32_t socket,
       break;
     }
 
+    /* Send event stream header response */
+  case HTTP_HEADER_EVENTS_ID:
+    {
+      if (webserver_http_encode_events_response(headers_buff) != WEBSERVER_OK)
+      {
+        return HTTP_ERROR;
+      }
+
+      break;
+    }
+
     /* Invalid header ID */
   default:
     return HTTP_ERROR;
     break;
   }
 
-  /* Send HTTP built response */
-  if (http_send(socket, (const char *)headers_buff, strlen((char*)headers_buff)) != WEBSERVER_OK)
-  {
-    return HTTP_ERROR;
-  }
-
   return WEBSERVER_OK;
 }
 
@@ -408,35 +1139,23 @@ static WebServer_StatusTypeDef http_send(int32_t socket,
                                          uint32_t frame_size)
 {
   /* Setup send information */
-  uint32_t data_size = frame_size;
-  uint32_t data_idx  = 0U;
+  uint32_t data_idx = 0U;
 
   /* Check remaining data */
-  while (data_size > 0U)
+  while (data_idx < frame_size)
   {
-    if (data_size >= MAX_SOCKET_DATASIZE)
-    {
-      /* Send data */
-      if (net_send(socket, (uint8_t*)&frame[data_idx], MAX_SOCKET_DATASIZE, 0) <= 0U)
-      {
-        return HTTP_ERROR;
-      }
+    const uint32_t data_size = ((frame_size - data_idx) > MAX_SOCKET_DATASIZE) ? MAX_SOCKET_DATASIZE
+                               : (frame_size - data_idx);
 
-      /* Update send information */
-      data_size -= MAX_SOCKET_DATASIZE;
-      data_idx += MAX_SOCKET_DATASIZE;
-    }
-    else
+    /* Send data */
+    const int32_t ret = net_send(socket, (uint8_t*)&frame[data_idx], data_size, 0);
+    if (ret <= 0)
     {
-      /* Send data */
-      if (net_send(socket, (uint8_t*)&frame[data_idx], data_size, 0) <= 0U)
-      {
-        return HTTP_ERROR;
-      }
-
-      /* Update send information */
-      data_size = 0U;
+      return HTTP_ERROR;
     }
+
+    /* Update send information, the socket may accept less than requested */
+    data_idx += (uint32_t)ret;
   }
 
   return WEBSERVER_OK;
@@ -25,10 +25,55 @@
 #include "webserver_http_cmd.h"
 #include "res.h"
 
-/* Exported types ----------------------------------------------------------------------------------------------------*/
+#include <stdbool.h>
+
 /* Exported constants ------------------------------------------------------------------------------------------------*/
+#define HTTP_RECEIVE_BUFFER_SIZE     (1500U)
+#define HTTP_ROUTE_MAX               (16U)  /* Maximum number of registered routes */
+#define HTTP_KEEPALIVE_TIMEOUT       (1000) /* Idle time in ms before a persistent connection is closed */
+#define HTTP_KEEPALIVE_MAX_REQUESTS  (64U)  /* Requests served on a connection before it is closed */
+#define HTTP_MAX_CONNECTIONS         (4U)   /* Connections served concurrently, below MX_WIFI_MAX_SOCKET_NBR */
+#define HTTP_ACCEPT_POLL_TIMEOUT     (1)    /* Accept timeout in ms while connections are being served */
+#define HTTP_ACCEPT_POLL_PERIOD      (50U)  /* Maximum time in ms between two accept polls of a busy server */
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  HTTP connection context, the receive buffer keeps the bytes of the next (possibly pipelined) requests
+  *         and the send state lets large response bodies go out one slice per turn of the server loop
+  */
+typedef struct
+{
+  bool     in_use;                                /* Context allocated to an accepted connection */
+  int32_t  socket;
+  uint32_t last_tick;                             /* Tick of the last activity, for the keep-alive timeout */
+  uint32_t recv_len;                              /* Number of valid bytes in recv_buffer */
+  uint32_t scan_len;                              /* Bytes already searched for the end of the request headers */
+  uint32_t request_count;                         /* Requests served on this connection */
+  bool     keep_alive;                            /* Keep the connection open after the current response */
+  bool     stream;                                /* Sensors event stream, frames are pushed by the server loop */
+  bool     accept_gzip;                           /* The current request accepts the gzip content-encoding */
+  const char *if_none_match;                      /* If-None-Match value of the current request, NULL if none */
+  uint32_t if_none_match_len;
+  const char *tx_buff;                            /* Response body being sent, NULL if none */
+  uint32_t tx_len;                                /* Response body size */
+  uint32_t tx_idx;                                /* Response body bytes already sent */
+  char     recv_buffer[HTTP_RECEIVE_BUFFER_SIZE];
+} http_connection_t;
+
+/**
+  * @brief  HTTP route handler, called with the context given at registration to send the response
+  */
+typedef WebServer_StatusTypeDef (*http_route_handler_t)(http_connection_t *connection, const void *context);
+
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
 WebServer_StatusTypeDef webserver_http_start(void);
+WebServer_StatusTypeDef webserver_http_register_route(const char *path,
+                                                      http_route_handler_t handler,
+                                                      const void *context);
+WebServer_StatusTypeDef webserver_http_send_response(http_connection_t *connection,
+                                                     uint32_t headers_id,
+                                                     const char *body_buff,
+                                                     uint32_t data_size);
 
 #endif /* WEBSERVER_HTTP_RESPONSE_H */
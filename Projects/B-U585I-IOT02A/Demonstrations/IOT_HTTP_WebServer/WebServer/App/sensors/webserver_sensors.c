@@ -20,11 +20,37 @@
 #include "webserver_sensors.h"
 #include "b_u585i_iot02a_env_sensors.h"
 
+#include <inttypes.h>
+
 /* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Sensors sample of the event stream
+  */
+typedef struct
+{
+  float value[3]; /* Indexed by SENSORS_STREAM_TEMP, SENSORS_STREAM_PRESS and SENSORS_STREAM_HUMID */
+} webserver_sensors_sample_t;
+
 /* Private define ----------------------------------------------------------------------------------------------------*/
+#define SENSORS_STREAM_TEMP  (0U)
+#define SENSORS_STREAM_PRESS (1U)
+#define SENSORS_STREAM_HUMID (2U)
+#define SENSORS_STREAM_NBR   (3U)
+
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
+/* Event stream batch */
+static webserver_sensors_sample_t sensors_stream_samples[WEBSERVER_SENSORS_STREAM_BATCH];
+static uint32_t sensors_stream_count;
+static uint32_t sensors_stream_tick;       /* Tick of the next sample */
+static uint32_t sensors_stream_first_tick; /* Tick of the first sample of the batch */
+
+/* Event stream series names */
+static const char *const sensors_stream_names[SENSORS_STREAM_NBR] = {"temperature", "pressure", "humidity"};
+
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t webserver_sensors_format_frame(char *frame, uint32_t frame_size);
+static uint32_t webserver_sensors_format_series(char *frame, uint32_t frame_size, uint32_t len, uint32_t sensor);
 /* Functions prototypes ----------------------------------------------------------------------------------------------*/
 
 /**
@@ -243,3 +269,125 @@ int webserver_humid_sensor_read(float *value)
 
   return status;
 }
+
+/**
+  * @brief  Restart the event stream batch, called when the first stream client connects.
+  * @param  None
+  * @retval None
+  */
+void webserver_sensors_stream_reset(void)
+{
+  sensors_stream_count = 0U;
+  sensors_stream_tick  = HAL_GetTick();
+}
+
+/**
+  * @brief  Sample the sensors every WEBSERVER_SENSORS_STREAM_PERIOD ms and build the event stream frame once
+  *         WEBSERVER_SENSORS_STREAM_BATCH samples are collected, to be called periodically.
+  * @param  frame      : pointer to the frame buffer, WEBSERVER_SENSORS_FRAME_SIZE bytes
+  * @param  frame_size : frame buffer size
+  * @retval Frame length, 0 if no frame is ready
+  */
+uint32_t webserver_sensors_stream_poll(char *frame, uint32_t frame_size)
+{
+  const uint32_t tick = HAL_GetTick();
+  webserver_sensors_sample_t *sample;
+
+  if ((tick - sensors_stream_tick) < WEBSERVER_SENSORS_STREAM_PERIOD)
+  {
+    return 0U;
+  }
+
+  /* Resynchronize instead of sampling in burst after a long stall */
+  if ((tick - sensors_stream_tick) >= (2U * WEBSERVER_SENSORS_STREAM_PERIOD))
+  {
+    sensors_stream_tick = tick;
+  }
+
+  if (sensors_stream_count == 0U)
+  {
+    sensors_stream_first_tick = sensors_stream_tick;
+  }
+  sensors_stream_tick += WEBSERVER_SENSORS_STREAM_PERIOD;
+
+  sample = &sensors_stream_samples[sensors_stream_count];
+  (void) webserver_temp_sensor_read(&sample->value[SENSORS_STREAM_TEMP]);
+  (void) webserver_press_sensor_read(&sample->value[SENSORS_STREAM_PRESS]);
+  (void) webserver_humid_sensor_read(&sample->value[SENSORS_STREAM_HUMID]);
+  sensors_stream_count++;
+
+  if (sensors_stream_count < WEBSERVER_SENSORS_STREAM_BATCH)
+  {
+    return 0U;
+  }
+  sensors_stream_count = 0U;
+
+  return webserver_sensors_format_frame(frame, frame_size);
+}
+
+/**
+  * @brief  Format the batch as one event: data: {"ts":<tick>,"period":<ms>,"temperature":[...],...}
+  * @param  frame      : pointer to the frame buffer
+  * @param  frame_size : frame buffer size
+  * @retval Frame length, 0 if the buffer is too small
+  */
+static uint32_t webserver_sensors_format_frame(char *frame, uint32_t frame_size)
+{
+  int len;
+
+  len = snprintf(frame, frame_size, "data: {\"ts\":%" PRIu32 ",\"period\":%" PRIu32,
+                 sensors_stream_first_tick, (uint32_t)WEBSERVER_SENSORS_STREAM_PERIOD);
+  if ((len < 0) || ((uint32_t)len >= frame_size))
+  {
+    return 0U;
+  }
+
+  for (uint32_t sensor = 0U; sensor < SENSORS_STREAM_NBR; sensor++)
+  {
+    len = (int)webserver_sensors_format_series(frame, frame_size, (uint32_t)len, sensor);
+  }
+
+  /* Close the object and end the event with an empty line */
+  if ((len == 0) || (((uint32_t)len + 4U) >= frame_size))
+  {
+    return 0U;
+  }
+  strcpy(&frame[len], "}\n\n");
+
+  return (uint32_t)len + 3U;
+}
+
+/**
+  * @brief  Append one sensor series of the batch to the frame
+  * @param  frame      : pointer to the frame buffer
+  * @param  frame_size : frame buffer size
+  * @param  len        : current frame length, 0 if a previous append failed
+  * @param  sensor     : sensor index in the samples
+  * @retval New frame length, 0 if the buffer is too small
+  */
+static uint32_t webserver_sensors_format_series(char *frame, uint32_t frame_size, uint32_t len, uint32_t sensor)
+{
+  uint32_t idx = len;
+  int ret;
+
+  if (idx == 0U)
+  {
+    return 0U;
+  }
+
+  ret = snprintf(&frame[idx], frame_size - idx, ",\"%s\":[", sensors_stream_names[sensor]);
+  for (uint32_t i = 0U; (ret >= 0) && ((idx + (uint32_t)ret) < frame_size) && (i < WEBSERVER_SENSORS_STREAM_BATCH); i++)
+  {
+    idx += (uint32_t)ret;
+    ret = snprintf(&frame[idx], frame_size - idx, (i == 0U) ? "%.2f" : ",%.2f",
+                   (double)sensors_stream_samples[i].value[sensor]);
+  }
+  if ((ret < 0) || ((idx + (uint32_t)ret + 1U) >= frame_size))
+  {
+    return 0U;
+  }
+  idx += (uint32_t)ret;
+  frame[idx] = ']';
+
+  return idx + 1U;
+}
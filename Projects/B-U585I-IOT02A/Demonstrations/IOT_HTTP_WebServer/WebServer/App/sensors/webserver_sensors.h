@@ -25,6 +25,18 @@
 
 /* Exported types ----------------------------------------------------------------------------------------------------*/
 /* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Sampling period of the sensors event stream in ms */
+#ifndef WEBSERVER_SENSORS_STREAM_PERIOD
+#define WEBSERVER_SENSORS_STREAM_PERIOD  (100U)
+#endif /* WEBSERVER_SENSORS_STREAM_PERIOD */
+
+/* Samples batched in one event stream frame */
+#ifndef WEBSERVER_SENSORS_STREAM_BATCH
+#define WEBSERVER_SENSORS_STREAM_BATCH   (10U)
+#endif /* WEBSERVER_SENSORS_STREAM_BATCH */
+
+/* Event stream frame size: fixed part (tick, period, series names), then 3 values of at most 10 characters per sample */
+#define WEBSERVER_SENSORS_FRAME_SIZE     (128U + (WEBSERVER_SENSORS_STREAM_BATCH * 30U))
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
 int webserver_temp_sensor_start(void);
@@ -37,6 +49,8 @@ int webserver_humid_sensor_start(void);
 int webserver_humid_sensor_stop(void);
 int webserver_humid_sensor_read(float *value);
 int webserver_sensors_start(void);
+void webserver_sensors_stream_reset(void);
+uint32_t webserver_sensors_stream_poll(char *frame, uint32_t frame_size);
 
 /* Private defines ---------------------------------------------------------------------------------------------------*/
 
@@ -1,8 +1,8 @@
 /**
   **********************************************************************************************************************
-  * @file    css_main_res.c
+  * @file    css_shunk_res.c
   * @author  MCD Application Team
-  * @brief   This file implements the web page shunk cascading style sheets resources
+  * @brief   This file implements the web page shunk css resources
   **********************************************************************************************************************
   * @attention
   *
@@ -16,3697 +16,814 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page shunk css resources buffer */
-const char css_shunk_buff[] =
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Web page shunk css resources buffer, gzip content-encoding */
+static const char css_shunk_buff_gz[] =
 {
-  0x2a, 0x2f, 0x2e, 0x66, 0x61, 0x2c, 0x2e, 0x66, 0x61, 0x62, 0x2c, 0x2e, 0x66, 0x61, 0x64, 0x2c,
-  0x2e, 0x66, 0x61, 0x6c, 0x2c, 0x2e, 0x66, 0x61, 0x72, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x7b, 0x2d,
-  0x6d, 0x6f, 0x7a, 0x2d, 0x6f, 0x73, 0x78, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x6d, 0x6f,
-  0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3a, 0x67, 0x72, 0x61, 0x79, 0x73, 0x63, 0x61, 0x6c, 0x65,
-  0x3b, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x6d,
-  0x6f, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3a, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x61,
-  0x73, 0x65, 0x64, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x69, 0x6e, 0x6c, 0x69,
-  0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74,
-  0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2d, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73,
-  0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x76, 0x61, 0x72,
-  0x69, 0x61, 0x6e, 0x74, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x74, 0x65, 0x78, 0x74,
-  0x2d, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b,
-  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x67, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31,
-  0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x65, 0x6d, 0x3b, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x3b, 0x76, 0x65, 0x72, 0x74, 0x69,
-  0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x2d, 0x2e, 0x30, 0x36, 0x36, 0x37,
-  0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x78, 0x73, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
-  0x69, 0x7a, 0x65, 0x3a, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6d,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x2e, 0x38, 0x37, 0x35, 0x65,
-  0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x31, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
-  0x7a, 0x65, 0x3a, 0x31, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x32, 0x78, 0x7b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x32, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x33, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x33, 0x65, 0x6d,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x34, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a,
-  0x65, 0x3a, 0x34, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x35, 0x78, 0x7b, 0x66, 0x6f, 0x6e,
-  0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x36,
-  0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x36, 0x65, 0x6d, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x37, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
-  0x3a, 0x37, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x38, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74,
-  0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x38, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x39, 0x78,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x39, 0x65, 0x6d, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x31, 0x30, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
-  0x3a, 0x31, 0x30, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x77, 0x7b, 0x74, 0x65, 0x78,
-  0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x77,
-  0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x2e, 0x32, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x6c, 0x7b, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 0x79,
-  0x70, 0x65, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c,
-  0x65, 0x66, 0x74, 0x3a, 0x32, 0x2e, 0x35, 0x65, 0x6d, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
-  0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x30, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6c, 0x3e,
-  0x6c, 0x69, 0x7b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x7b, 0x6c, 0x65, 0x66, 0x74,
-  0x3a, 0x2d, 0x32, 0x65, 0x6d, 0x3b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61,
-  0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69,
-  0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
-  0x32, 0x65, 0x6d, 0x3b, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
-  0x69, 0x6e, 0x68, 0x65, 0x72, 0x69, 0x74, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x2e, 0x30, 0x38, 0x65, 0x6d, 0x20,
-  0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x65, 0x65, 0x65, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x2e, 0x31, 0x65, 0x6d, 0x3b, 0x70, 0x61,
-  0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x2e, 0x32, 0x65, 0x6d, 0x20, 0x2e, 0x32, 0x35, 0x65, 0x6d,
-  0x20, 0x2e, 0x31, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x7b, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3a, 0x6c, 0x65, 0x66, 0x74, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x7b, 0x66,
-  0x6c, 0x6f, 0x61, 0x74, 0x3a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x2e, 0x66, 0x61, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2c, 0x2e, 0x66, 0x61, 0x62,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2c, 0x2e, 0x66,
-  0x61, 0x6c, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2c,
-  0x2e, 0x66, 0x61, 0x72, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c,
-  0x65, 0x66, 0x74, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x3a, 0x2e, 0x33, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c,
-  0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x2e, 0x66, 0x61, 0x62, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x2e, 0x66, 0x61, 0x6c, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x2e, 0x66,
-  0x61, 0x72, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x2c, 0x2e, 0x66, 0x61, 0x73, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a,
-  0x2e, 0x33, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x7b, 0x61, 0x6e,
-  0x69, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x20,
-  0x32, 0x73, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x69,
-  0x74, 0x65, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x73, 0x65, 0x7b, 0x61, 0x6e, 0x69,
-  0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x20, 0x31,
-  0x73, 0x20, 0x73, 0x74, 0x65, 0x70, 0x73, 0x28, 0x38, 0x29, 0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e,
-  0x69, 0x74, 0x65, 0x7d, 0x40, 0x6b, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x66,
-  0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x7b, 0x30, 0x25, 0x7b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66,
-  0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x30, 0x64, 0x65, 0x67, 0x29,
-  0x7d, 0x74, 0x6f, 0x7b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f,
-  0x74, 0x61, 0x74, 0x65, 0x28, 0x31, 0x74, 0x75, 0x72, 0x6e, 0x29, 0x7d, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x39, 0x30, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66,
-  0x69, 0x6c, 0x74, 0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58,
-  0x49, 0x6d, 0x61, 0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d,
-  0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d,
-  0x61, 0x67, 0x65, 0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x31, 0x29, 0x22,
-  0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x39, 0x30, 0x64, 0x65, 0x67, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74,
-  0x61, 0x74, 0x65, 0x2d, 0x31, 0x38, 0x30, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69, 0x6c, 0x74,
-  0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49, 0x6d, 0x61,
-  0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69, 0x63, 0x72,
-  0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61, 0x67, 0x65,
-  0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x32, 0x29, 0x22, 0x3b, 0x74, 0x72,
-  0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x31,
-  0x38, 0x30, 0x64, 0x65, 0x67, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74,
-  0x65, 0x2d, 0x32, 0x37, 0x30, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72,
-  0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49, 0x6d, 0x61, 0x67, 0x65,
-  0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73,
-  0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x28, 0x72,
-  0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x33, 0x29, 0x22, 0x3b, 0x74, 0x72, 0x61, 0x6e,
-  0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x32, 0x37, 0x30,
-  0x64, 0x65, 0x67, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x68, 0x6f,
-  0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69, 0x6c,
-  0x74, 0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49, 0x6d,
-  0x61, 0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69, 0x63,
-  0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61, 0x67,
-  0x65, 0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x30, 0x2c, 0x20, 0x6d, 0x69,
-  0x72, 0x72, 0x6f, 0x72, 0x3d, 0x31, 0x29, 0x22, 0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f,
-  0x72, 0x6d, 0x3a, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x58, 0x28, 0x2d, 0x31, 0x29, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x7b,
-  0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x59,
-  0x28, 0x2d, 0x31, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x62, 0x6f,
-  0x74, 0x68, 0x2c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x68, 0x6f, 0x72, 0x69,
-  0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x76,
-  0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70,
-  0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69,
-  0x6c, 0x74, 0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49,
-  0x6d, 0x61, 0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69,
-  0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61,
-  0x67, 0x65, 0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x32, 0x2c, 0x20, 0x6d,
-  0x69, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x31, 0x29, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c,
-  0x69, 0x70, 0x2d, 0x62, 0x6f, 0x74, 0x68, 0x2c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70,
-  0x2d, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x69, 0x70, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x7b, 0x74, 0x72, 0x61,
-  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x28, 0x2d, 0x31, 0x29,
-  0x7d, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d,
-  0x62, 0x6f, 0x74, 0x68, 0x2c, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x69, 0x70, 0x2d, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x2c, 0x3a,
-  0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x76, 0x65,
-  0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2c, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x39, 0x30, 0x2c, 0x3a, 0x72, 0x6f, 0x6f, 0x74,
-  0x20, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x31, 0x38, 0x30, 0x2c,
-  0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65,
-  0x2d, 0x32, 0x37, 0x30, 0x7b, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x66, 0x69, 0x6c,
-  0x74, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3a,
-  0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x7b, 0x64,
-  0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x65, 0x6d, 0x3b, 0x6c,
-  0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x65, 0x6d, 0x3b, 0x70,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65,
-  0x3b, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a,
-  0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x32, 0x2e, 0x35,
-  0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x31, 0x78, 0x2c,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x32, 0x78, 0x7b, 0x6c, 0x65, 0x66,
-  0x74, 0x3a, 0x30, 0x3b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61, 0x62, 0x73,
-  0x6f, 0x6c, 0x75, 0x74, 0x65, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-  0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30,
-  0x30, 0x25, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x31, 0x78, 0x7b,
-  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x69, 0x6e, 0x68, 0x65,
-  0x72, 0x69, 0x74, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x32, 0x78,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x32, 0x65, 0x6d, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
-  0x3a, 0x23, 0x66, 0x66, 0x66, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x35, 0x30, 0x30, 0x70, 0x78, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x73,
-  0x73, 0x69, 0x62, 0x6c, 0x65, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x63, 0x63, 0x75, 0x73, 0x6f, 0x66, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2d, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61,
-  0x74, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64, 0x64,
-  0x72, 0x65, 0x73, 0x73, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x63, 0x61, 0x72,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64, 0x6a,
-  0x75, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x64, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64,
-  0x76, 0x65, 0x72, 0x73, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x66, 0x66, 0x69, 0x6c, 0x69, 0x61, 0x74, 0x65, 0x74, 0x68, 0x65, 0x6d, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x69, 0x72, 0x2d,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x65, 0x6e, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x69, 0x72, 0x62, 0x6e, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x67, 0x6f, 0x6c, 0x69, 0x61, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d,
-  0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x33, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x69, 0x70, 0x61, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x36, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x67,
-  0x69, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x6d, 0x61, 0x7a, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6d, 0x61, 0x7a, 0x6f, 0x6e, 0x2d, 0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6d, 0x62, 0x75, 0x6c, 0x61, 0x6e, 0x63, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6d, 0x65, 0x72,
-  0x69, 0x63, 0x61, 0x6e, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
-  0x67, 0x65, 0x2d, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x69, 0x6e, 0x67, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6d, 0x69, 0x6c, 0x69,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x63,
-  0x68, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x6e, 0x64, 0x72, 0x6f, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6c, 0x69, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75,
-  0x62, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
-  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2d, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d,
-  0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67,
-  0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6e, 0x67, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x6e, 0x67, 0x72, 0x79, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x75, 0x6c,
-  0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e,
-  0x6b, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70,
-  0x70, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x61, 0x70, 0x70, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2d, 0x69, 0x6f, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70, 0x70, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70, 0x70,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70,
-  0x70, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x63, 0x68, 0x77,
-  0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x64,
-  0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65,
-  0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x64, 0x6f,
-  0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77,
-  0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x63,
-  0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x75, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77,
-  0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x68, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d,
-  0x61, 0x6c, 0x74, 0x2d, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x72, 0x74, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x73, 0x73, 0x69, 0x73, 0x74, 0x69, 0x76, 0x65,
-  0x2d, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x79, 0x73, 0x74, 0x65,
-  0x6d, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x73,
-  0x74, 0x65, 0x72, 0x69, 0x73, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x73, 0x79, 0x6d, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x61, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x6f, 0x6d,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x75, 0x64, 0x69,
-  0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x75, 0x64, 0x69, 0x6f, 0x2d, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x75, 0x74, 0x6f,
-  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x61, 0x76, 0x69, 0x61, 0x6e, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x76, 0x69, 0x61, 0x74, 0x6f, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x77, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x37, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x62, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x62, 0x79, 0x2d, 0x63, 0x61,
-  0x72, 0x72, 0x69, 0x61, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x63, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x63, 0x74,
-  0x65, 0x72, 0x69, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x61, 0x63, 0x74, 0x65, 0x72, 0x69, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x68, 0x61, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x2d, 0x73, 0x63,
-  0x61, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6c,
-  0x61, 0x6e, 0x63, 0x65, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6e, 0x64, 0x2d,
-  0x61, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x61, 0x6e, 0x64, 0x63, 0x61, 0x6d, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x61, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x62, 0x61, 0x6c, 0x6c, 0x2d, 0x62,
-  0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x61, 0x73, 0x6b, 0x65, 0x74, 0x62, 0x61, 0x6c, 0x6c, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x68, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72,
-  0x79, 0x2d, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x34, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65,
-  0x72, 0x79, 0x2d, 0x68, 0x61, 0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x2d, 0x71, 0x75, 0x61, 0x72, 0x74,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61,
-  0x74, 0x74, 0x65, 0x72, 0x79, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2d, 0x71, 0x75, 0x61, 0x72,
-  0x74, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x2d, 0x6e, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x62, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x65, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x65, 0x6c, 0x6c, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x66, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x7a, 0x69, 0x65, 0x72, 0x2d, 0x63,
-  0x75, 0x72, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x69, 0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x62, 0x69, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x34, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x6d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x6e, 0x6f, 0x63,
-  0x75, 0x6c, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x62, 0x69, 0x6f, 0x68, 0x61, 0x7a, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x72, 0x74, 0x68, 0x64, 0x61, 0x79, 0x2d, 0x63,
-  0x61, 0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x69, 0x74, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x74, 0x63, 0x6f, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x2d, 0x74, 0x69, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x37, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x61, 0x63,
-  0x6b, 0x62, 0x65, 0x72, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2d, 0x70, 0x68, 0x6f,
-  0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c,
-  0x69, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x6c, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x6c, 0x6f, 0x67, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6c, 0x6f, 0x67, 0x67, 0x65, 0x72, 0x2d, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x75, 0x65,
-  0x74, 0x6f, 0x6f, 0x74, 0x68, 0x2d, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6c, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6d, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x64, 0x65, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x62, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x6d, 0x65, 0x64,
-  0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b,
-  0x6d, 0x61, 0x72, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x34, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x6e, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x35, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x38, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x77, 0x6c, 0x69, 0x6e,
-  0x67, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x62, 0x6f, 0x78, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x78, 0x2d, 0x74, 0x69, 0x73, 0x73, 0x75, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x78, 0x65, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x69,
-  0x6c, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x69, 0x65, 0x66, 0x63, 0x61, 0x73, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x69, 0x65,
-  0x66, 0x63, 0x61, 0x73, 0x65, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x6f, 0x61, 0x64, 0x63, 0x61,
-  0x73, 0x74, 0x2d, 0x74, 0x6f, 0x77, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x6f, 0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x75, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x74, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x68, 0x6f,
-  0x72, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75,
-  0x6c, 0x6c, 0x73, 0x65, 0x79, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x75, 0x72, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x75, 0x72, 0x6f, 0x6d, 0x6f, 0x62, 0x65, 0x6c, 0x65, 0x78, 0x70, 0x65, 0x72,
-  0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x73,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x75, 0x73, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x79, 0x2d, 0x6e, 0x2d, 0x6c,
-  0x61, 0x72, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x75, 0x79, 0x73, 0x65, 0x6c, 0x6c, 0x61, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x65, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65,
-  0x6e, 0x64, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x37, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72,
-  0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x64, 0x61, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64,
-  0x61, 0x72, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x70, 0x6c, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c,
-  0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d,
-  0x77, 0x65, 0x65, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x61, 0x6d, 0x65, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x6d, 0x65, 0x72, 0x61, 0x2d, 0x72, 0x65, 0x74, 0x72, 0x6f, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6d, 0x70, 0x67, 0x72,
-  0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x61, 0x6e, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x2d, 0x6d, 0x61, 0x70, 0x6c, 0x65, 0x2d, 0x6c,
-  0x65, 0x61, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x6e, 0x64, 0x79, 0x2d, 0x63, 0x61, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6e, 0x6e, 0x61, 0x62, 0x69, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x35, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x70, 0x73, 0x75, 0x6c, 0x65,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x2d,
-  0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x72, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x2d, 0x63, 0x72, 0x61, 0x73, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x2d, 0x73,
-  0x69, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x66, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x6c, 0x65,
-  0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61,
-  0x72, 0x65, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x6c,
-  0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x72, 0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72,
-  0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x35, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x75, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x72,
-  0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61,
-  0x72, 0x74, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x31, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x74, 0x2d, 0x70, 0x6c,
-  0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61,
-  0x73, 0x68, 0x2d, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x62, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x61, 0x6d, 0x61, 0x7a, 0x6f, 0x6e, 0x2d,
-  0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x63, 0x2d, 0x61, 0x6d, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x63, 0x2d, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x64, 0x69, 0x6e,
-  0x65, 0x72, 0x73, 0x2d, 0x63, 0x6c, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x6a, 0x63,
-  0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d,
-  0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x70, 0x61, 0x79, 0x70, 0x61, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x66, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x73, 0x74,
-  0x72, 0x69, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x63, 0x2d, 0x76, 0x69, 0x73, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x38, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x65, 0x6e, 0x74, 0x6f, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x65, 0x72, 0x74, 0x69,
-  0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x61, 0x69, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x6c, 0x6b, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x31, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x6c, 0x6b, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x2d, 0x74, 0x65, 0x61, 0x63, 0x68, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x67, 0x2d,
-  0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x61, 0x72, 0x65, 0x61, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x66, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x62,
-  0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68,
-  0x61, 0x72, 0x74, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x70, 0x69, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x30, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d,
-  0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x65, 0x65, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x62, 0x69, 0x73, 0x68, 0x6f,
-  0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65,
-  0x73, 0x73, 0x2d, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x33, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d,
-  0x6b, 0x6e, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x70, 0x61, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x34, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x71, 0x75,
-  0x65, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x68, 0x65, 0x73, 0x73, 0x2d, 0x72, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72,
-  0x63, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x35, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e,
-  0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x68, 0x69, 0x6c, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x63, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38,
-  0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x75, 0x72, 0x63, 0x68, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x31, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x2d, 0x6e, 0x6f, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x69, 0x6e, 0x69, 0x63, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63,
-  0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c,
-  0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x32, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x6c, 0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2d, 0x63, 0x68, 0x65,
-  0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c,
-  0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x31, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64,
-  0x2d, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x63, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x64, 0x6f,
-  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x6d, 0x65, 0x61, 0x74,
-  0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x6d, 0x6f, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x6d, 0x6f, 0x6f, 0x6e,
-  0x2d, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x33,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x73, 0x68, 0x6f,
-  0x77, 0x65, 0x72, 0x73, 0x2d, 0x68, 0x65, 0x61, 0x76, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x73, 0x75, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64,
-  0x2d, 0x73, 0x75, 0x6e, 0x2d, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x75, 0x70, 0x6c, 0x6f, 0x61,
-  0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x66, 0x6c, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x73, 0x63, 0x61, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f,
-  0x75, 0x64, 0x73, 0x6d, 0x69, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x76, 0x65, 0x72, 0x73, 0x69, 0x66, 0x79, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x63, 0x6b, 0x74,
-  0x61, 0x69, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x64, 0x65, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x64, 0x69, 0x65, 0x70, 0x69,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x66,
-  0x66, 0x65, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f,
-  0x67, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f,
-  0x69, 0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x37, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d,
-  0x65, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x6f,
-  0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f,
-  0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x66, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74,
-  0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2d, 0x64,
-  0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x63, 0x74, 0x2d, 0x64, 0x69, 0x73, 0x63, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x31, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x70,
-  0x72, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x32, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73,
-  0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6e, 0x63, 0x69, 0x65, 0x72, 0x67, 0x65,
-  0x2d, 0x62, 0x65, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x64, 0x65,
-  0x76, 0x65, 0x6c, 0x6f, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x2d, 0x62, 0x69, 0x74, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x70, 0x79,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x70, 0x79,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x74, 0x74, 0x6f, 0x6e, 0x2d, 0x62, 0x75, 0x72, 0x65, 0x61, 0x75, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x38, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x75, 0x63, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x70, 0x61, 0x6e, 0x65,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x62, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x65, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65,
-  0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d,
-  0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x63, 0x2d, 0x65, 0x75, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x65, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x63, 0x2d, 0x6a, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x65, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74,
-  0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69,
-  0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x70, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x65, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x70, 0x64, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x72, 0x65, 0x6d,
-  0x69, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x73,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x73, 0x61,
-  0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-  0x6e, 0x73, 0x2d, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x6c, 0x75, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x73, 0x68, 0x61,
-  0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x7a,
-  0x65, 0x72, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x72, 0x65, 0x64, 0x69, 0x74, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x69, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x72,
-  0x6f, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x72, 0x6f, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x72, 0x6f, 0x70, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x68, 0x61, 0x69, 0x72, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x77, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x32, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x77, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x75, 0x74, 0x63,
-  0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x73, 0x73,
-  0x33, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x73, 0x73,
-  0x33, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x75, 0x62, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x75, 0x62, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x75, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x75, 0x74, 0x74, 0x6c, 0x65, 0x66, 0x69, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x2d, 0x61, 0x6e, 0x64, 0x2d, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x2d, 0x61, 0x6e, 0x64, 0x2d,
-  0x64, 0x2d, 0x62, 0x65, 0x79, 0x6f, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x64, 0x61, 0x69, 0x6c, 0x79, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x61, 0x73, 0x68, 0x63,
-  0x75, 0x62, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x65, 0x61, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x65, 0x65, 0x7a, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x6c, 0x69, 0x63, 0x69, 0x6f, 0x75, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x6d, 0x6f, 0x63, 0x72,
-  0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65,
-  0x70, 0x6c, 0x6f, 0x79, 0x64, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x65, 0x73, 0x6b, 0x70, 0x72, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x73, 0x6b, 0x74, 0x6f, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x30, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x76, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x76, 0x69, 0x61, 0x6e, 0x74, 0x61,
-  0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x68,
-  0x61, 0x72, 0x6d, 0x61, 0x63, 0x68, 0x61, 0x6b, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x68, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x65, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x61, 0x73, 0x70, 0x6f,
-  0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69,
-  0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69,
-  0x63, 0x65, 0x2d, 0x64, 0x32, 0x30, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x64, 0x36, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x66, 0x69, 0x76, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x32, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x66,
-  0x6f, 0x75, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x69, 0x63, 0x65, 0x2d, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x73, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x74, 0x68, 0x72, 0x65,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63,
-  0x65, 0x2d, 0x74, 0x77, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x69, 0x67, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x6f, 0x63, 0x65, 0x61, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61,
-  0x6c, 0x2d, 0x74, 0x61, 0x63, 0x68, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69,
-  0x73, 0x63, 0x6f, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x75, 0x72, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x73, 0x65, 0x61, 0x73, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x7a, 0x7a, 0x79,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6e, 0x61, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x63, 0x68, 0x75,
-  0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x63,
-  0x6b, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f,
-  0x6c, 0x6c, 0x61, 0x72, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x79, 0x2d, 0x66, 0x6c, 0x61, 0x74,
-  0x62, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x6f, 0x6e, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x6f, 0x6f, 0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x6f, 0x72, 0x2d, 0x6f, 0x70, 0x65,
-  0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x74,
-  0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x6f, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x62, 0x61, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x61, 0x66, 0x74, 0x32, 0x64, 0x69, 0x67,
-  0x69, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x64, 0x72, 0x61, 0x66, 0x74, 0x69, 0x6e, 0x67, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x61, 0x67,
-  0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72,
-  0x61, 0x77, 0x2d, 0x70, 0x6f, 0x6c, 0x79, 0x67, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x69, 0x62, 0x62, 0x62, 0x6c, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x69, 0x62, 0x62, 0x62,
-  0x6c, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x6f, 0x70, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x75, 0x6d, 0x2d, 0x73, 0x74, 0x65,
-  0x65, 0x6c, 0x70, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x72, 0x75, 0x6d, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x2d, 0x62, 0x69, 0x74, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x75, 0x70, 0x61,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x75, 0x6d,
-  0x62, 0x62, 0x65, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x75, 0x6d, 0x70, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x75, 0x6d, 0x70, 0x73, 0x74, 0x65, 0x72, 0x2d, 0x66, 0x69,
-  0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x75,
-  0x6e, 0x67, 0x65, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x79, 0x61, 0x6c, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x62, 0x69, 0x72, 0x64, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x62, 0x61, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x66, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x64, 0x67, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x64, 0x67, 0x65, 0x2d, 0x6c, 0x65,
-  0x67, 0x61, 0x63, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x64, 0x69, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x67, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x66, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65,
-  0x6a, 0x65, 0x63, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69, 0x73, 0x2d, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6c, 0x6c, 0x69, 0x70,
-  0x73, 0x69, 0x73, 0x2d, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x65, 0x6c, 0x6c, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65,
-  0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x2d, 0x74,
-  0x65, 0x78, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65,
-  0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x61,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x71, 0x75, 0x61,
-  0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x72,
-  0x61, 0x73, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x72, 0x6c, 0x61, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x74, 0x68, 0x65, 0x72, 0x65, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x65, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x74, 0x73, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x75, 0x72, 0x6f, 0x2d, 0x73,
-  0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65,
-  0x76, 0x65, 0x72, 0x6e, 0x6f, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x65, 0x78, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x63, 0x6c, 0x61,
-  0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x69,
-  0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x74, 0x72, 0x69, 0x61,
-  0x6e, 0x67, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2d, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x31, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x70, 0x65, 0x64, 0x69, 0x74, 0x65, 0x64, 0x73, 0x73,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x74,
-  0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
-  0x61, 0x6c, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x61,
-  0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x79,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x79, 0x65,
-  0x2d, 0x64, 0x72, 0x6f, 0x70, 0x70, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x65, 0x79, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x62, 0x6f, 0x6f,
-  0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x63,
-  0x65, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x6d, 0x65, 0x73, 0x73,
-  0x65, 0x6e, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x66, 0x61, 0x63, 0x65, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x6e, 0x74, 0x61,
-  0x73, 0x79, 0x2d, 0x66, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x73, 0x74, 0x2d,
-  0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x73, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x35, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x75, 0x63,
-  0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61,
-  0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x61,
-  0x74, 0x68, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36,
-  0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x64, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x39, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x64, 0x6f, 0x72, 0x61, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x67, 0x68,
-  0x74, 0x65, 0x72, 0x2d, 0x6a, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x67, 0x6d, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x72, 0x63,
-  0x68, 0x69, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x37,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d,
-  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x63, 0x73, 0x76, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x64, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77,
-  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x78, 0x70, 0x6f,
-  0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69,
-  0x6c, 0x65, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x36, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d,
-  0x69, 0x6e, 0x76, 0x6f, 0x69, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x69, 0x6e, 0x76, 0x6f, 0x69, 0x63, 0x65, 0x2d,
-  0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x6d,
-  0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70, 0x64, 0x66, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70,
-  0x6f, 0x77, 0x65, 0x72, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72,
-  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x37, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65,
-  0x2d, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x63, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x77, 0x6f,
-  0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69,
-  0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69,
-  0x6c, 0x6c, 0x2d, 0x64, 0x72, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x36, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x62, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6e, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x65,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x72, 0x65, 0x2d, 0x65, 0x78, 0x74, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x68, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72,
-  0x65, 0x66, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x72, 0x65, 0x66, 0x6f, 0x78, 0x2d, 0x62, 0x72, 0x6f, 0x77, 0x73, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x73, 0x74,
-  0x2d, 0x61, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x72, 0x73, 0x74, 0x2d, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2d, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x69, 0x72, 0x73, 0x74, 0x64, 0x72, 0x61, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x73, 0x74, 0x2d, 0x72, 0x61, 0x69,
-  0x73, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x61, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x61, 0x67, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x61, 0x67, 0x2d, 0x75, 0x73,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x61,
-  0x73, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c,
-  0x69, 0x63, 0x6b, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6c, 0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x64, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d,
-  0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d, 0x70,
-  0x6c, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6f, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73,
-  0x6f, 0x6d, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2d,
-  0x66, 0x6c, 0x61, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2d, 0x6c, 0x6f, 0x67,
-  0x6f, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x69, 0x63, 0x6f, 0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x69, 0x63, 0x6f, 0x6e, 0x73,
-  0x2d, 0x66, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6f, 0x6f, 0x74, 0x62, 0x61, 0x6c, 0x6c, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x77, 0x65,
-  0x73, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x72, 0x75,
-  0x6d, 0x62, 0x65, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x6f, 0x75, 0x72, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x38, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x2d, 0x63, 0x6f,
-  0x64, 0x65, 0x2d, 0x63, 0x61, 0x6d, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x62, 0x73, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x6f, 0x77, 0x6e, 0x2d, 0x6f, 0x70, 0x65,
-  0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x75, 0x6c,
-  0x63, 0x72, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x75, 0x74, 0x62, 0x6f, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x6c, 0x61, 0x63,
-  0x74, 0x69, 0x63, 0x2d, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x6c, 0x61, 0x63, 0x74, 0x69, 0x63,
-  0x2d, 0x73, 0x65, 0x6e, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x61, 0x6d, 0x65, 0x70, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31, 0x62,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x73, 0x2d, 0x70, 0x75, 0x6d, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x76, 0x65, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x65, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x65, 0x6e, 0x64, 0x65, 0x72,
-  0x6c, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x67, 0x65, 0x74, 0x2d, 0x70, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x67, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x36, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x66, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x66, 0x74, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x39, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x38, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74,
-  0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x68, 0x75,
-  0x62, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x6b, 0x72, 0x61, 0x6b, 0x65, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x6c, 0x61, 0x62, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x74, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61,
-  0x73, 0x73, 0x2d, 0x63, 0x68, 0x65, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x66, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x6d, 0x61, 0x72, 0x74, 0x69,
-  0x6e, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c,
-  0x61, 0x73, 0x73, 0x2d, 0x6d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x69, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73,
-  0x2d, 0x77, 0x68, 0x69, 0x73, 0x6b, 0x65, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x69, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x69, 0x64, 0x65, 0x2d, 0x67, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x61, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62,
-  0x65, 0x2d, 0x61, 0x66, 0x72, 0x69, 0x63, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x65, 0x2d, 0x61, 0x6d, 0x65, 0x72, 0x69, 0x63,
-  0x61, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c,
-  0x6f, 0x62, 0x65, 0x2d, 0x61, 0x73, 0x69, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x65, 0x2d, 0x65, 0x75, 0x72, 0x6f, 0x70, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x66, 0x6f,
-  0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f,
-  0x6c, 0x66, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x64, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x64, 0x72, 0x65, 0x61, 0x64,
-  0x73, 0x2d, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67,
-  0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x72, 0x69, 0x76, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d,
-  0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67,
-  0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x62,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f,
-  0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x75,
-  0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x77, 0x61, 0x6c, 0x6c, 0x65,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x70,
-  0x75, 0x72, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x67, 0x72, 0x61, 0x64, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x61, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x39, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x61, 0x74, 0x69, 0x70,
-  0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72,
-  0x61, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x74, 0x68,
-  0x61, 0x6e, 0x2d, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6d, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37,
-  0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d,
-  0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x67, 0x72, 0x69, 0x6e, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x77, 0x65, 0x61, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d,
-  0x68, 0x65, 0x61, 0x72, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x71,
-  0x75, 0x69, 0x6e, 0x74, 0x2d, 0x74, 0x65, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e,
-  0x2d, 0x74, 0x65, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x6e, 0x67, 0x75, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f,
-  0x6e, 0x67, 0x75, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x6e, 0x67,
-  0x75, 0x65, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x38, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x68, 0x6f, 0x72,
-  0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x61, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x6c, 0x69,
-  0x6e, 0x65, 0x73, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x76, 0x65, 0x72,
-  0x74, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x67, 0x72, 0x69, 0x70, 0x66, 0x69, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x75, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65,
-  0x30, 0x37, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x75, 0x69, 0x74, 0x61, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x75, 0x6c, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x2d, 0x73, 0x71, 0x75,
-  0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68,
-  0x61, 0x63, 0x6b, 0x65, 0x72, 0x2d, 0x6e, 0x65, 0x77, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x2d, 0x6e, 0x65, 0x77,
-  0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x6b, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6d, 0x62, 0x75, 0x72,
-  0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68,
-  0x61, 0x6d, 0x6d, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x61, 0x6d, 0x73, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68,
-  0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x62, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c,
-  0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30,
-  0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c,
-  0x64, 0x69, 0x6e, 0x67, 0x2d, 0x75, 0x73, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67,
-  0x2d, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x6c, 0x69, 0x7a, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x6d, 0x69,
-  0x64, 0x64, 0x6c, 0x65, 0x2d, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x61, 0x70, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e,
-  0x64, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d, 0x64, 0x6f,
-  0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61,
-  0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f,
-  0x69, 0x6e, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d,
-  0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61,
-  0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x72, 0x6f, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x35, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d,
-  0x73, 0x63, 0x69, 0x73, 0x73, 0x6f, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x73, 0x70, 0x61, 0x72, 0x6b, 0x6c, 0x65,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e,
-  0x64, 0x2d, 0x73, 0x70, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x68, 0x65, 0x6c, 0x70, 0x69, 0x6e,
-  0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e,
-  0x64, 0x73, 0x2d, 0x77, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b,
-  0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35,
-  0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b, 0x65,
-  0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x61, 0x6e, 0x75, 0x6b, 0x69, 0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x72, 0x64, 0x2d, 0x68, 0x61, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x38, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
-  0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x74,
-  0x2d, 0x63, 0x6f, 0x77, 0x62, 0x6f, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x74, 0x2d, 0x63, 0x6f, 0x77, 0x62, 0x6f, 0x79, 0x2d, 0x73, 0x69,
-  0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61,
-  0x74, 0x2d, 0x77, 0x69, 0x7a, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65, 0x38, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x64, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x2d, 0x63, 0x6f, 0x75,
-  0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65,
-  0x61, 0x64, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x2d, 0x63, 0x6f, 0x75, 0x67, 0x68, 0x2d, 0x73, 0x6c,
-  0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68,
-  0x65, 0x61, 0x64, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x2d, 0x6d, 0x61, 0x73, 0x6b, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65,
-  0x30, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x2d, 0x73, 0x69,
-  0x64, 0x65, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6f, 0x6e, 0x65,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61,
-  0x64, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38,
-  0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x73, 0x65, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x39, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74,
-  0x2d, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x6c, 0x69, 0x63, 0x6f, 0x70, 0x74,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69,
-  0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x70, 0x70, 0x6f, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x70, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x72, 0x65, 0x2d, 0x61, 0x2d, 0x68,
-  0x65, 0x6c, 0x70, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x63, 0x6b, 0x65, 0x79, 0x2d, 0x70, 0x75, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x6c, 0x6c, 0x79,
-  0x2d, 0x62, 0x65, 0x72, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x6f, 0x6f, 0x6c, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x6f, 0x72, 0x6e, 0x62, 0x69, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x66, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x2d, 0x68, 0x65,
-  0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f,
-  0x73, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74,
-  0x61, 0x6c, 0x2d, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x75, 0x73,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f,
-  0x74, 0x2d, 0x74, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x6f, 0x74, 0x64, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x6f, 0x74, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x74, 0x6a, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x72, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x35, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x72, 0x67,
-  0x6c, 0x61, 0x73, 0x73, 0x2d, 0x65, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x72, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x68, 0x61,
-  0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f,
-  0x75, 0x72, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x35, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x2d, 0x64,
-  0x61, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36,
-  0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x7a, 0x7a, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x72, 0x79, 0x76, 0x6e, 0x69, 0x61, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x74, 0x6d, 0x6c, 0x35,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x75, 0x62, 0x73,
-  0x70, 0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x2d, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x36, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x69, 0x63, 0x65, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38,
-  0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x63, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x38, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x64, 0x2d, 0x62,
-  0x61, 0x64, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x69, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x69, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x64, 0x65, 0x61, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x67, 0x6c, 0x6f, 0x6f,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6d, 0x61, 0x67,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6d, 0x61,
-  0x67, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x6d, 0x64, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x6e, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x69, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x69, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x66, 0x6f, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x63,
-  0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x69, 0x6e, 0x6e, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x67,
-  0x72, 0x61, 0x6d, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6f, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x65, 0x30, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x63,
-  0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x6e, 0x65, 0x74, 0x2d, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x76, 0x69, 0x73,
-  0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x6f, 0x78, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x69, 0x74, 0x63, 0x68, 0x2d, 0x69, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x74, 0x75, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x62, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x74, 0x75, 0x6e, 0x65, 0x73, 0x2d,
-  0x6e, 0x6f, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6a, 0x61, 0x76, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6a, 0x65, 0x64, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6a, 0x65, 0x64, 0x69, 0x2d, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x65, 0x6e, 0x6b, 0x69, 0x6e, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x69, 0x72, 0x61, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x67, 0x65, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x62, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x69, 0x6e, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x6f, 0x6d, 0x6c,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x75,
-  0x72, 0x6e, 0x61, 0x6c, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x73, 0x66, 0x69, 0x64, 0x64,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x61,
-  0x61, 0x62, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b,
-  0x61, 0x67, 0x67, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6b, 0x65, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6b, 0x65, 0x79, 0x62, 0x61, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x65, 0x79, 0x63, 0x64, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x68, 0x61, 0x6e, 0x64, 0x61, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x63, 0x6b, 0x73,
-  0x74, 0x61, 0x72, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6b, 0x69, 0x63, 0x6b, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x72, 0x2d, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x73, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x73, 0x73, 0x2d,
-  0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6b, 0x69, 0x73, 0x73, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x77, 0x69, 0x2d,
-  0x62, 0x69, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6b, 0x6f, 0x72, 0x76, 0x75, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x61, 0x6e, 0x64, 0x6d, 0x61, 0x72, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74, 0x6f, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74,
-  0x6f, 0x70, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74, 0x6f, 0x70, 0x2d, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74, 0x6f,
-  0x70, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x31, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x73, 0x74, 0x66, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x73, 0x74, 0x66, 0x6d,
-  0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d,
-  0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x39, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2d, 0x67, 0x72,
-  0x6f, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x65, 0x61, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x65, 0x61, 0x6e, 0x70, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x65, 0x6d, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x33, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x68, 0x61,
-  0x6e, 0x2d, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x65, 0x76,
-  0x65, 0x6c, 0x2d, 0x75, 0x70, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x66, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x66, 0x65, 0x2d, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x62,
-  0x75, 0x6c, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x69, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x69, 0x6e, 0x6b, 0x65, 0x64, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x69, 0x6e, 0x2d, 0x69, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x6e, 0x6f, 0x64, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x6e, 0x75,
-  0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x72,
-  0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6f, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x75, 0x6c,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x63, 0x6b, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d,
-  0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x30, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x77, 0x2d, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x75, 0x67, 0x67,
-  0x61, 0x67, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x64, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x75, 0x6e, 0x67, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x30, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x75, 0x6e, 0x67, 0x73, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x65, 0x30, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x79, 0x66, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x63, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x67, 0x65,
-  0x6e, 0x74, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d,
-  0x61, 0x67, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x67, 0x6e, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x69, 0x6c, 0x2d, 0x62, 0x75, 0x6c, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x69, 0x6c, 0x63, 0x68, 0x69, 0x6d, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x6c, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x6e, 0x64,
-  0x61, 0x6c, 0x6f, 0x72, 0x69, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x39, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b,
-  0x65, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b,
-  0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f,
-  0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x30, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61,
-  0x72, 0x6b, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x72, 0x73, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x72, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f,
-  0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61,
-  0x72, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32,
-  0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x72, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f,
-  0x6b, 0x65, 0x2d, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x73, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x73, 0x74, 0x6f, 0x64, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x78, 0x63, 0x64, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x64, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x61, 0x70, 0x70, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x33, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x75,
-  0x6d, 0x2d, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d,
-  0x65, 0x64, 0x6b, 0x69, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6d, 0x65, 0x64, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x65, 0x65, 0x74, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x67, 0x61, 0x70, 0x6f, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x68, 0x2d, 0x62, 0x6c, 0x61, 0x6e, 0x6b,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x61, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x68, 0x2d,
-  0x72, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x2d, 0x65, 0x79, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x6c,
-  0x65, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65,
-  0x6e, 0x6f, 0x72, 0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6d, 0x65, 0x72, 0x63, 0x75, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x74, 0x65, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x62, 0x6c, 0x6f, 0x67, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x31, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f,
-  0x63, 0x68, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73,
-  0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72,
-  0x6f, 0x73, 0x63, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x2d, 0x63, 0x69,
-  0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x6e, 0x75, 0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x34, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x78, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x78, 0x63, 0x6c, 0x6f, 0x75,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x78,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69,
-  0x7a, 0x75, 0x6e, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x64, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x72, 0x6f, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d,
-  0x62, 0x69, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x62, 0x69, 0x6c, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x64, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d,
-  0x62, 0x69, 0x6c, 0x6c, 0x2d, 0x77, 0x61, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x62, 0x69, 0x6c, 0x6c, 0x2d,
-  0x77, 0x61, 0x76, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79,
-  0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6f, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x38, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x72, 0x74, 0x61, 0x72,
-  0x2d, 0x70, 0x65, 0x73, 0x74, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x73, 0x71, 0x75, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x74, 0x6f, 0x72, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x31, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x75, 0x6e, 0x74,
-  0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x66, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d,
-  0x6f, 0x75, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x6f, 0x75, 0x73, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x34, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x75, 0x67, 0x2d, 0x68, 0x6f, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x75, 0x73, 0x69,
-  0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x61, 0x70,
-  0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6e, 0x65, 0x6f, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x31, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x77, 0x69, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x66, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x65, 0x75, 0x74, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x32, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x65, 0x77, 0x73, 0x70,
-  0x61, 0x70, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6e, 0x69, 0x6d, 0x62, 0x6c, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6e, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6e, 0x6f, 0x64, 0x65, 0x2d, 0x6a, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x6f, 0x74, 0x2d, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x6f, 0x74, 0x65, 0x73, 0x2d,
-  0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6e, 0x70, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6e, 0x73, 0x38, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6e, 0x75, 0x74, 0x72, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x67,
-  0x72, 0x6f, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x75, 0x6e, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x34, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x63, 0x74, 0x6f, 0x70, 0x75,
-  0x73, 0x2d, 0x64, 0x65, 0x70, 0x6c, 0x6f, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x64, 0x6e, 0x6f, 0x6b, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x69, 0x6b,
-  0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x64, 0x6e,
-  0x6f, 0x6b, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x69, 0x6b, 0x69, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x69, 0x6c,
-  0x2d, 0x63, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6f, 0x6c, 0x64, 0x2d, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x63, 0x61, 0x72, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x33, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x69, 0x64,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x39, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x65, 0x72,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x74,
-  0x69, 0x6e, 0x2d, 0x6d, 0x6f, 0x6e, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x72, 0x63, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x64,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x73, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x74, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x75, 0x74, 0x64, 0x65, 0x6e, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x34, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x6c,
-  0x69, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x61, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2d, 0x62, 0x72, 0x75, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x66, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2d, 0x72, 0x6f,
-  0x6c, 0x6c, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x61, 0x6c, 0x66, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x6c, 0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x2d, 0x70, 0x6c, 0x61,
-  0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61,
-  0x70, 0x65, 0x72, 0x63, 0x6c, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x36, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x63, 0x68, 0x75, 0x74, 0x65, 0x2d, 0x62, 0x6f, 0x78,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x72, 0x61,
-  0x67, 0x72, 0x61, 0x70, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x73, 0x74, 0x61, 0x66, 0x61, 0x72,
-  0x69, 0x61, 0x6e, 0x69, 0x73, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x61, 0x73, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x61, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x61, 0x74, 0x72, 0x65, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x75, 0x73, 0x65, 0x2d, 0x63, 0x69, 0x72,
-  0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70,
-  0x61, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61,
-  0x79, 0x70, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x65, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x65, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x2d, 0x66, 0x61, 0x6e, 0x63, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x2d, 0x6e, 0x69, 0x62, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x2d, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x65, 0x6e, 0x63, 0x69, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x63, 0x69, 0x6c, 0x2d, 0x72, 0x75,
-  0x6c, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70,
-  0x65, 0x6e, 0x6e, 0x79, 0x2d, 0x61, 0x72, 0x63, 0x61, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x70, 0x70, 0x65, 0x72, 0x2d, 0x68,
-  0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65,
-  0x72, 0x62, 0x79, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x72, 0x69, 0x73, 0x63,
-  0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70,
-  0x65, 0x72, 0x73, 0x6f, 0x6e, 0x2d, 0x62, 0x6f, 0x6f, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x61, 0x62, 0x72, 0x69, 0x63, 0x61, 0x74,
-  0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68,
-  0x6f, 0x65, 0x6e, 0x69, 0x78, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x65, 0x6e,
-  0x69, 0x78, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x64, 0x72, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x38, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f,
-  0x6e, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x64, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e,
-  0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38,
-  0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x76, 0x6f,
-  0x6c, 0x75, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x68, 0x6f, 0x74, 0x6f, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x37,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x37,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69, 0x70, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64,
-  0x2d, 0x70, 0x69, 0x70, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69, 0x70, 0x65, 0x72,
-  0x2d, 0x68, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69, 0x70, 0x65, 0x72, 0x2d, 0x70, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69,
-  0x70, 0x65, 0x72, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x31, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x67, 0x67, 0x79, 0x2d, 0x62, 0x61, 0x6e, 0x6b,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x6c, 0x6c,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x2d, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x65,
-  0x73, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x7a, 0x7a, 0x61, 0x2d, 0x73, 0x6c, 0x69, 0x63, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x38, 0x31, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x63,
-  0x65, 0x2d, 0x6f, 0x66, 0x2d, 0x77, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x37, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x2d, 0x61,
-  0x72, 0x72, 0x69, 0x76, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x2d, 0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61,
-  0x6e, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x34, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x73,
-  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x75, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x35, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x73, 0x71,
-  0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x6f, 0x64, 0x63, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6c, 0x6c, 0x2d, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6f, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x6d, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x35, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6f, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x31, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x72, 0x74, 0x72, 0x61, 0x69,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x75,
-  0x6e, 0x64, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2d, 0x6f, 0x66, 0x66, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x61, 0x79, 0x69, 0x6e, 0x67, 0x2d,
-  0x68, 0x61, 0x6e, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
-  0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x38, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x69, 0x6e, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x63,
-  0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x2d, 0x68, 0x75, 0x6e, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
-  0x74, 0x2d, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6d,
-  0x70, 0x2d, 0x73, 0x6f, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x7a, 0x7a, 0x6c, 0x65, 0x2d, 0x70, 0x69, 0x65, 0x63, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x79, 0x74, 0x68,
-  0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x71,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x72, 0x63, 0x6f,
-  0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75,
-  0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x69,
-  0x64, 0x64, 0x69, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x71, 0x75, 0x69, 0x6e, 0x73, 0x63, 0x61, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x6f, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x6c, 0x65,
-  0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75,
-  0x6f, 0x74, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x72, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x37,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x2d, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x61, 0x64, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x69, 0x6e, 0x62, 0x6f, 0x77,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x6e, 0x64,
-  0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61,
-  0x73, 0x70, 0x62, 0x65, 0x72, 0x72, 0x79, 0x2d, 0x70, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x62,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x72, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x61, 0x63, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x31, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x61, 0x63, 0x74, 0x65,
-  0x75, 0x72, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x62, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x63, 0x65, 0x69, 0x70, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x76, 0x69,
-  0x6e, 0x79, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72,
-  0x65, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x72, 0x65, 0x64, 0x2d, 0x72, 0x69, 0x76, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x64, 0x69, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x64, 0x69, 0x74, 0x2d,
-  0x61, 0x6c, 0x69, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x65, 0x64, 0x64, 0x69, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x68, 0x61, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x6f,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x6f,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x2d, 0x66, 0x6f, 0x72,
-  0x6d, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72,
-  0x65, 0x6e, 0x72, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x65, 0x70, 0x6c, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x72, 0x65, 0x70, 0x6c, 0x79, 0x2d, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x70, 0x6c, 0x79, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69,
-  0x63, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72,
-  0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x67, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x69, 0x6e, 0x67,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x65, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x73, 0x74,
-  0x72, 0x6f, 0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x65, 0x74, 0x77, 0x65, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x72, 0x69, 0x62, 0x62, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x38, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33,
-  0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x63, 0x68, 0x61,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x63,
-  0x6b, 0x72, 0x6d, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x6f, 0x75, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x73, 0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x62, 0x6c, 0x65, 0x2d, 0x73, 0x69, 0x67, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c,
-  0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x2d, 0x68, 0x6f, 0x72,
-  0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6e,
-  0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x75, 0x70, 0x65, 0x65, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x64, 0x2d, 0x63, 0x72, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x64, 0x2d, 0x74, 0x65, 0x61,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x66,
-  0x61, 0x72, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x61, 0x6c, 0x65, 0x73, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x74, 0x65, 0x6c, 0x6c, 0x69, 0x74, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x62, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x74, 0x65, 0x6c, 0x6c,
-  0x69, 0x74, 0x65, 0x2d, 0x64, 0x69, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x63, 0x68, 0x6c, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x63, 0x68, 0x6f, 0x6f, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x34, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x63, 0x72, 0x65, 0x77, 0x64, 0x72, 0x69,
-  0x76, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x63, 0x72, 0x69, 0x62, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2d, 0x64,
-  0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x36, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x30, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x65, 0x65, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x6c, 0x6c, 0x63, 0x61, 0x73, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x6c, 0x6c, 0x73, 0x79,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x72, 0x76,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65,
-  0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x70, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x31, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2d, 0x61,
-  0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68,
-  0x61, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x68, 0x65, 0x6b, 0x65, 0x6c, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x2d,
-  0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x68, 0x69, 0x65, 0x6c, 0x64, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x69, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d,
-  0x66, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x68, 0x69, 0x72, 0x74, 0x73, 0x69, 0x6e, 0x62, 0x75, 0x6c, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x31, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x6f, 0x65, 0x2d, 0x70, 0x72, 0x69,
-  0x6e, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x68, 0x6f, 0x70, 0x69, 0x66, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x68, 0x6f, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x61, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x39, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x6f, 0x70, 0x70, 0x69,
-  0x6e, 0x67, 0x2d, 0x62, 0x61, 0x73, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x6f, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x63, 0x61,
-  0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68,
-  0x6f, 0x70, 0x77, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x68, 0x6f, 0x77, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x75, 0x74, 0x74, 0x6c, 0x65, 0x2d, 0x76, 0x61, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d,
-  0x69, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d,
-  0x6f, 0x75, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x62, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x6d, 0x2d, 0x63, 0x61,
-  0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69,
-  0x6d, 0x70, 0x6c, 0x79, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x64, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x73, 0x74, 0x72, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x65, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x74, 0x65, 0x6d, 0x61, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x74, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x31, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x61, 0x74, 0x69,
-  0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b,
-  0x65, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x6b, 0x69, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x6b, 0x69, 0x69, 0x6e, 0x67, 0x2d, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x75, 0x6c, 0x6c,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x34, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x75, 0x6c,
-  0x6c, 0x2d, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x62, 0x6f, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x31, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x79, 0x61, 0x74, 0x6c, 0x61, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x79, 0x70,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x61,
-  0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c,
-  0x61, 0x63, 0x6b, 0x2d, 0x68, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x31, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x65, 0x69, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x73, 0x2d, 0x68,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x69, 0x64,
-  0x65, 0x73, 0x68, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x2d, 0x77,
-  0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x6d, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x6d, 0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x6d, 0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x61, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6d, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x61, 0x70, 0x63, 0x68, 0x61, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x61, 0x70,
-  0x63, 0x68, 0x61, 0x74, 0x2d, 0x67, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x61, 0x70, 0x63, 0x68, 0x61, 0x74, 0x2d, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6e, 0x6f, 0x77, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x6f, 0x77, 0x66, 0x6c, 0x61,
-  0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e,
-  0x6f, 0x77, 0x6d, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6e, 0x6f, 0x77, 0x70, 0x6c, 0x6f, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x63, 0x6b, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x61, 0x72, 0x2d, 0x70, 0x61, 0x6e, 0x65,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72,
-  0x74, 0x2d, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6c, 0x70,
-  0x68, 0x61, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6c, 0x70, 0x68,
-  0x61, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x2d, 0x75, 0x70, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72,
-  0x74, 0x2d, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6d,
-  0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x38, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6d,
-  0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x75,
-  0x70, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72,
-  0x69, 0x63, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x2d,
-  0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63,
-  0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x2d, 0x75, 0x70, 0x2d, 0x61,
-  0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f,
-  0x72, 0x74, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6f, 0x75, 0x6e, 0x64, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62,
-  0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x74, 0x72, 0x65,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x61,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x61, 0x63,
-  0x65, 0x2d, 0x73, 0x68, 0x75, 0x74, 0x74, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x2d,
-  0x64, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x70, 0x65, 0x6c, 0x6c, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x39,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x31, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x6c, 0x6f,
-  0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x70, 0x6f, 0x74, 0x69, 0x66, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x70, 0x72, 0x61, 0x79, 0x2d, 0x63, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x63, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d,
-  0x66, 0x75, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x72, 0x6f, 0x6f, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x65, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x65, 0x78, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63,
-  0x6b, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x70, 0x61, 0x74, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x6d, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x62, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72,
-  0x2d, 0x61, 0x6e, 0x64, 0x2d, 0x63, 0x72, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x2d, 0x68, 0x61,
-  0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74,
-  0x61, 0x72, 0x2d, 0x68, 0x61, 0x6c, 0x66, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x2d, 0x6f, 0x66, 0x2d, 0x64,
-  0x61, 0x76, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x74, 0x61, 0x72, 0x2d, 0x6f, 0x66, 0x2d, 0x6c, 0x69, 0x66, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x79, 0x6c, 0x69, 0x6e, 0x6b,
-  0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74,
-  0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x74, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x79, 0x6d,
-  0x62, 0x6f, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x74, 0x65, 0x70, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x34, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x65, 0x70, 0x2d, 0x66, 0x6f, 0x72,
-  0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x74, 0x65, 0x74, 0x68, 0x6f, 0x73, 0x63, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x2d, 0x6d,
-  0x75, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x74, 0x69, 0x63, 0x6b, 0x79, 0x2d, 0x6e, 0x6f, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x70, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f,
-  0x70, 0x77, 0x61, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x6f, 0x70, 0x77, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x32, 0x30, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x65, 0x30, 0x36, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x74, 0x6f, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65,
-  0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x72, 0x61, 0x76, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x38, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x65, 0x65, 0x74, 0x2d, 0x76, 0x69, 0x65,
-  0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72,
-  0x69, 0x6b, 0x65, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x70, 0x65, 0x2d, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x6f,
-  0x6f, 0x70, 0x77, 0x61, 0x66, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x74, 0x75, 0x64, 0x69, 0x6f, 0x76, 0x69, 0x6e, 0x61, 0x72, 0x69, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x66, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x75, 0x6d, 0x62,
-  0x6c, 0x65, 0x75, 0x70, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x75, 0x6d, 0x62, 0x6c, 0x65, 0x75, 0x70, 0x6f, 0x6e, 0x2d, 0x63, 0x69,
-  0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x62, 0x77, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x69, 0x74, 0x63, 0x61, 0x73, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x69, 0x74, 0x63,
-  0x61, 0x73, 0x65, 0x2d, 0x72, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x70, 0x65, 0x72, 0x70, 0x6f, 0x77, 0x65, 0x72,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x70,
-  0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x63, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x73, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x77, 0x61, 0x74, 0x63, 0x68,
-  0x62, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x77, 0x69, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x77, 0x69, 0x6d, 0x6d, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x77, 0x69, 0x6d, 0x6d, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x6f, 0x6f,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x6d,
-  0x66, 0x6f, 0x6e, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x79, 0x6e, 0x61, 0x67, 0x6f, 0x67, 0x75, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x6e, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x6e, 0x63, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x72, 0x69, 0x6e, 0x67, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x38, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x2d, 0x74, 0x65, 0x6e, 0x6e, 0x69, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x64, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x74, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x61, 0x63, 0x68, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x67, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x32, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x67, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x32, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x70, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x73, 0x6b, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x78, 0x69, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x61, 0x6d, 0x73, 0x70,
-  0x65, 0x61, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x65, 0x65, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x65, 0x65, 0x74, 0x68, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x32, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6c, 0x65, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6c, 0x65, 0x67, 0x72,
-  0x61, 0x6d, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2d,
-  0x68, 0x69, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2d, 0x6c, 0x6f, 0x77, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6e, 0x63, 0x65,
-  0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x62, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6e, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x32, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x68, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x65, 0x78, 0x74, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x2d, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x2d, 0x72,
-  0x65, 0x64, 0x2d, 0x79, 0x65, 0x74, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x6d, 0x61, 0x73, 0x6b, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x36, 0x33, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x6d,
-  0x65, 0x63, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x68, 0x65, 0x6d, 0x65, 0x69, 0x73, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d,
-  0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65,
-  0x74, 0x65, 0x72, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d,
-  0x68, 0x61, 0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x71, 0x75, 0x61, 0x72,
-  0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x65,
-  0x2d, 0x71, 0x75, 0x61, 0x72, 0x74, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x69, 0x6e, 0x6b, 0x2d, 0x70, 0x65, 0x61, 0x6b, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x75, 0x6d,
-  0x62, 0x73, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x73, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x74, 0x61, 0x63,
-  0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x63,
-  0x6b, 0x65, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x69, 0x6b, 0x74, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69,
-  0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69,
-  0x6e, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x67, 0x67, 0x6c,
-  0x65, 0x2d, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x6f, 0x69, 0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x74, 0x6f, 0x69, 0x6c, 0x65, 0x74, 0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x69, 0x6c, 0x65, 0x74,
-  0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30,
-  0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x6f, 0x6c, 0x62, 0x6f, 0x78, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x6f, 0x6c, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x6f, 0x74,
-  0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x72,
-  0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f,
-  0x72, 0x69, 0x69, 0x2d, 0x67, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x32,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x64, 0x65, 0x2d, 0x66, 0x65, 0x64,
-  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x66, 0x66, 0x69, 0x63, 0x2d,
-  0x6c, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x34, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x67, 0x65, 0x6e, 0x64, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x6e,
-  0x73, 0x67, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32,
-  0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x66, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x73, 0x68, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61,
-  0x73, 0x68, 0x2d, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x32, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x73, 0x68, 0x2d, 0x72, 0x65, 0x73, 0x74,
-  0x6f, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x32, 0x61, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x72, 0x65, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x72, 0x65, 0x6c, 0x6c, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x69, 0x70, 0x61, 0x64, 0x76, 0x69, 0x73, 0x6f, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x6f, 0x70,
-  0x68, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72,
-  0x75, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x72, 0x75, 0x63, 0x6b, 0x2d, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x75, 0x63, 0x6b, 0x2d, 0x6d, 0x6f,
-  0x6e, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x74, 0x72, 0x75, 0x63, 0x6b, 0x2d, 0x6d, 0x6f, 0x76, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x64, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x75, 0x63, 0x6b, 0x2d, 0x70,
-  0x69, 0x63, 0x6b, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x74, 0x73, 0x68, 0x69, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x74, 0x75, 0x6d, 0x62, 0x6c, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x75, 0x6d, 0x62, 0x6c, 0x72, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x76, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x77, 0x69, 0x74, 0x63,
-  0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x77, 0x69,
-  0x74, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x77, 0x69, 0x74, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x79, 0x70, 0x6f, 0x33, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x32, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x62, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x62, 0x75, 0x6e, 0x74,
-  0x75, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x69, 0x6b,
-  0x69, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6d,
-  0x62, 0x72, 0x61, 0x63, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x75, 0x6d, 0x62, 0x72, 0x65, 0x6c, 0x6c, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6d, 0x62, 0x72, 0x65, 0x6c, 0x6c, 0x61, 0x2d, 0x62, 0x65,
-  0x61, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75,
-  0x6e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x64, 0x6f, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x64, 0x6f, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x69,
-  0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x34, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x69, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6c, 0x2d, 0x61,
-  0x63, 0x63, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x75, 0x6e, 0x69, 0x76, 0x65, 0x72, 0x73, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x32, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x39, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x6c, 0x6f, 0x63,
-  0x6b, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x75, 0x6e, 0x73, 0x70, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x74, 0x61, 0x70, 0x70, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x70, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x62, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x30, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x61, 0x73, 0x74, 0x72, 0x6f,
-  0x6e, 0x61, 0x75, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x73, 0x65, 0x72, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65,
-  0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66,
-  0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x65, 0x64, 0x69, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x66, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x2d, 0x66, 0x72, 0x69, 0x65, 0x6e, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x75, 0x61, 0x74,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65,
-  0x72, 0x2d, 0x69, 0x6e, 0x6a, 0x75, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x32, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6d,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65,
-  0x72, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6e, 0x69, 0x6e, 0x6a, 0x61, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6e, 0x75,
-  0x72, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75,
-  0x73, 0x65, 0x72, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x65, 0x63, 0x72, 0x65, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x31, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d,
-  0x73, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x30, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x74, 0x61, 0x67,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x2d, 0x74, 0x69, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x73, 0x65, 0x72, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x73, 0x2d, 0x63, 0x6f, 0x67,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x73, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x70, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x73, 0x75, 0x6e, 0x6e, 0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6c, 0x2d, 0x73,
-  0x70, 0x6f, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x61, 0x61, 0x64, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x73, 0x71, 0x75,
-  0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76,
-  0x65, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x76, 0x65, 0x6e, 0x75, 0x73, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x32, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65, 0x6e, 0x75, 0x73, 0x2d, 0x6d, 0x61,
-  0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65,
-  0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65,
-  0x73, 0x74, 0x2d, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x63, 0x6f, 0x69, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x64, 0x65, 0x6f, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x64, 0x65,
-  0x6f, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x62, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x2d, 0x73, 0x6c, 0x61,
-  0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69,
-  0x68, 0x61, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x76, 0x69, 0x6d, 0x65, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x76, 0x69, 0x6d, 0x65, 0x6f, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x39, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x6d, 0x65, 0x6f, 0x2d, 0x76,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x6e, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x72, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x72,
-  0x75, 0x73, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6e, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x69, 0x63, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x38, 0x39, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x6c, 0x65, 0x79, 0x62,
-  0x61, 0x6c, 0x6c, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x32, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d,
-  0x65, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x32, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x2d, 0x75,
-  0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x74,
-  0x65, 0x2d, 0x79, 0x65, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x76, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x75, 0x65, 0x6a, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x31, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x6c, 0x6b, 0x69, 0x6e,
-  0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x6c,
-  0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77,
-  0x61, 0x72, 0x65, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x74, 0x63, 0x68, 0x6d, 0x61, 0x6e, 0x2d, 0x6d, 0x6f, 0x6e,
-  0x69, 0x74, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x76, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x7a, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x33, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65, 0x65, 0x62, 0x6c,
-  0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65, 0x69,
-  0x62, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x68, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65, 0x69, 0x78, 0x69, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x68, 0x61, 0x74,
-  0x73, 0x61, 0x70, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x77, 0x68, 0x61, 0x74, 0x73, 0x61, 0x70, 0x70, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x68, 0x65, 0x65, 0x6c,
-  0x63, 0x68, 0x61, 0x69, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x68, 0x6d, 0x63, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x77, 0x69, 0x66, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x77, 0x69, 0x6b, 0x69, 0x70, 0x65, 0x64, 0x69, 0x61, 0x2d, 0x77, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d,
-  0x63, 0x6c, 0x6f, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x69, 0x7a, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64,
-  0x6f, 0x77, 0x2d, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x72, 0x65,
-  0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x65, 0x2d,
-  0x67, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x69, 0x6e, 0x65, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x78, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x63, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x7a, 0x61, 0x72, 0x64,
-  0x73, 0x2d, 0x6f, 0x66, 0x2d, 0x74, 0x68, 0x65, 0x2d, 0x63, 0x6f, 0x61, 0x73, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x33, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x64, 0x75, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x65, 0x30, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x6c, 0x66, 0x2d, 0x70,
-  0x61, 0x63, 0x6b, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x61, 0x6c, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x31, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x6e, 0x2d, 0x73, 0x69, 0x67,
-  0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x72,
-  0x64, 0x70, 0x72, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x77, 0x6f, 0x72, 0x64, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x73, 0x69, 0x6d, 0x70,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70,
-  0x62, 0x65, 0x67, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70, 0x66, 0x6f, 0x72, 0x6d,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70, 0x72,
-  0x65, 0x73, 0x73, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x77, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x78, 0x2d, 0x72, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x78, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x78, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x78, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x2d, 0x63, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x79, 0x61, 0x68, 0x6f, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x79, 0x61, 0x6d, 0x6d, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x34, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x61, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x61, 0x6e, 0x64, 0x65, 0x78, 0x2d, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x61, 0x72, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x65, 0x6c, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x65, 0x6e, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x69, 0x6e, 0x2d, 0x79,
-  0x61, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79,
-  0x6f, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x79, 0x6f, 0x75, 0x74, 0x75, 0x62, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x79, 0x6f, 0x75, 0x74, 0x75, 0x62, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x7a, 0x68, 0x69,
-  0x68, 0x75, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x66, 0x22, 0x7d, 0x2e, 0x73, 0x72, 0x2d, 0x6f, 0x6e,
-  0x6c, 0x79, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x30, 0x3b, 0x63, 0x6c, 0x69, 0x70,
-  0x3a, 0x72, 0x65, 0x63, 0x74, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3b, 0x68,
-  0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
-  0x3a, 0x2d, 0x31, 0x70, 0x78, 0x3b, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x68,
-  0x69, 0x64, 0x64, 0x65, 0x6e, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x30, 0x3b,
-  0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74,
-  0x65, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x70, 0x78, 0x7d, 0x2e, 0x73, 0x72, 0x2d,
-  0x6f, 0x6e, 0x6c, 0x79, 0x2d, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3a, 0x61,
-  0x63, 0x74, 0x69, 0x76, 0x65, 0x2c, 0x2e, 0x73, 0x72, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x2d, 0x66,
-  0x6f, 0x63, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x7b, 0x63,
-  0x6c, 0x69, 0x70, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
-  0x61, 0x75, 0x74, 0x6f, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x3b, 0x6f, 0x76,
-  0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x3b, 0x70,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x3b, 0x77,
-  0x69, 0x64, 0x74, 0x68, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x7d, 0x40, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x66, 0x61, 0x63, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79,
-  0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35,
-  0x20, 0x42, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x22, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74,
-  0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30, 0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x73, 0x72,
-  0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e,
-  0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30, 0x66, 0x65, 0x61, 0x32, 0x34, 0x39, 0x36, 0x2e,
-  0x65, 0x6f, 0x74, 0x29, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f,
-  0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f,
-  0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30, 0x66,
-  0x65, 0x61, 0x32, 0x34, 0x39, 0x36, 0x2e, 0x65, 0x6f, 0x74, 0x3f, 0x23, 0x69, 0x65, 0x66, 0x69,
-  0x78, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x65, 0x6d, 0x62, 0x65, 0x64,
-  0x64, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75,
-  0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d,
-  0x34, 0x30, 0x30, 0x2e, 0x63, 0x39, 0x36, 0x37, 0x61, 0x39, 0x34, 0x63, 0x2e, 0x77, 0x6f, 0x66,
-  0x66, 0x32, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66,
-  0x32, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72,
-  0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x64, 0x63, 0x32, 0x63, 0x62, 0x61, 0x64,
-  0x64, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22,
-  0x77, 0x6f, 0x66, 0x66, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61,
-  0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x65, 0x63, 0x38, 0x32,
-  0x66, 0x32, 0x38, 0x32, 0x2e, 0x74, 0x74, 0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
-  0x28, 0x22, 0x74, 0x72, 0x75, 0x65, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c,
-  0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30,
-  0x30, 0x2e, 0x65, 0x33, 0x33, 0x65, 0x32, 0x63, 0x66, 0x36, 0x2e, 0x73, 0x76, 0x67, 0x23, 0x66,
-  0x6f, 0x6e, 0x74, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d,
-  0x61, 0x74, 0x28, 0x22, 0x73, 0x76, 0x67, 0x22, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x62, 0x7b, 0x66,
-  0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74,
-  0x20, 0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x42, 0x72, 0x61, 0x6e, 0x64,
-  0x73, 0x22, 0x7d, 0x40, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x7b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20,
-  0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x46, 0x72, 0x65, 0x65, 0x22, 0x3b,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30,
-  0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f,
-  0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30,
-  0x38, 0x66, 0x39, 0x38, 0x39, 0x31, 0x61, 0x2e, 0x65, 0x6f, 0x74, 0x29, 0x3b, 0x73, 0x72, 0x63,
-  0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69,
-  0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c,
-  0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30, 0x38, 0x66, 0x39, 0x38, 0x39, 0x31, 0x61, 0x2e,
-  0x65, 0x6f, 0x74, 0x3f, 0x23, 0x69, 0x65, 0x66, 0x69, 0x78, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d,
-  0x61, 0x74, 0x28, 0x22, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x65,
-  0x6e, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e,
-  0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66,
-  0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x31, 0x30,
-  0x30, 0x38, 0x62, 0x35, 0x32, 0x32, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x29, 0x20, 0x66, 0x6f,
-  0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x22, 0x29, 0x2c, 0x75, 0x72,
-  0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d,
-  0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d,
-  0x34, 0x30, 0x30, 0x2e, 0x31, 0x30, 0x36, 0x39, 0x65, 0x61, 0x35, 0x35, 0x2e, 0x77, 0x6f, 0x66,
-  0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x22,
-  0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75,
-  0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x31, 0x34, 0x39, 0x35, 0x66, 0x35, 0x37, 0x38,
-  0x2e, 0x74, 0x74, 0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x74, 0x72,
-  0x75, 0x65, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f,
-  0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30,
-  0x36, 0x62, 0x39, 0x64, 0x31, 0x39, 0x63, 0x2e, 0x73, 0x76, 0x67, 0x23, 0x66, 0x6f, 0x6e, 0x74,
-  0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28,
-  0x22, 0x73, 0x76, 0x67, 0x22, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x62, 0x2c, 0x2e, 0x66, 0x61, 0x72,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30, 0x30,
-  0x7d, 0x40, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74,
-  0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77,
-  0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x46, 0x72, 0x65, 0x65, 0x22, 0x3b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x39, 0x30, 0x30, 0x3b,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61,
-  0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30, 0x2e, 0x33, 0x61, 0x32, 0x34, 0x61,
-  0x36, 0x30, 0x65, 0x2e, 0x65, 0x6f, 0x74, 0x29, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c,
-  0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30,
-  0x2e, 0x33, 0x61, 0x32, 0x34, 0x61, 0x36, 0x30, 0x65, 0x2e, 0x65, 0x6f, 0x74, 0x3f, 0x23, 0x69,
-  0x65, 0x66, 0x69, 0x78, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x65, 0x6d,
-  0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x79, 0x70, 0x65, 0x22,
-  0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69,
-  0x64, 0x2d, 0x39, 0x30, 0x30, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x29, 0x20, 0x66, 0x6f, 0x72,
-  0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c,
-  0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30,
-  0x2e, 0x34, 0x36, 0x66, 0x64, 0x62, 0x64, 0x32, 0x64, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x29, 0x20,
-  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x22, 0x29, 0x2c, 0x75,
-  0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39,
-  0x30, 0x30, 0x2e, 0x31, 0x30, 0x65, 0x63, 0x65, 0x66, 0x63, 0x32, 0x2e, 0x74, 0x74, 0x66, 0x29,
-  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x74, 0x72, 0x75, 0x65, 0x74, 0x79, 0x70,
-  0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f,
-  0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30, 0x2e, 0x33, 0x37, 0x31, 0x64, 0x62, 0x63, 0x65, 0x30,
-  0x2e, 0x73, 0x76, 0x67, 0x23, 0x66, 0x6f, 0x6e, 0x74, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65,
-  0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x73, 0x76, 0x67, 0x22, 0x29, 0x7d,
-  0x2e, 0x66, 0x61, 0x2c, 0x2e, 0x66, 0x61, 0x72, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x7b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20,
-  0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x46, 0x72, 0x65, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x39, 0x30, 0x30, 0x7d
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x9D, 0x5B, 0xAF, 0xE3, 0x38,
+  0xB6, 0xDF, 0xBF, 0x4A, 0xA1, 0x07, 0x07, 0xE8, 0x06, 0x5A, 0x35, 0xBA, 0x4B, 0xAE, 0x42, 0x92,
+  0x93, 0x83, 0xE0, 0x00, 0x79, 0xC8, 0x5B, 0x1E, 0x4E, 0x80, 0xBC, 0x50, 0x12, 0x65, 0xB3, 0xB6,
+  0x24, 0xAA, 0x75, 0xB1, 0xB7, 0xAB, 0xD0, 0xDF, 0x3D, 0xA4, 0xEC, 0x45, 0xD1, 0xDE, 0xFF, 0xE5,
+  0xE9, 0xEE, 0x33, 0x99, 0x19, 0xD4, 0x54, 0x49, 0x3F, 0x4B, 0x14, 0xAF, 0x8B, 0xEB, 0xC6, 0xCF,
+  0xAD, 0xF8, 0xF5, 0x73, 0x2B, 0x2A, 0xFB, 0x47, 0x63, 0xFF, 0xE8, 0xEC, 0x1F, 0x93, 0xFD, 0x63,
+  0xFE, 0x11, 0xF4, 0xFA, 0x7B, 0xA0, 0xE7, 0xF7, 0xA0, 0xD5, 0xC3, 0x12, 0xCC, 0xBD, 0xD6, 0xCB,
+  0x49, 0x0D, 0xC7, 0x2F, 0xC7, 0x49, 0x5C, 0xE7, 0x5A, 0x74, 0xF2, 0x6B, 0x70, 0x91, 0xD5, 0x9B,
+  0x5A, 0x9E, 0x01, 0x31, 0x2C, 0x4A, 0x74, 0x4A, 0xCC, 0xB2, 0xF9, 0xDA, 0xA8, 0x79, 0xEC, 0xC4,
+  0xF5, 0x8B, 0x1A, 0x3A, 0x35, 0xC8, 0xA0, 0xEA, 0x74, 0xFD, 0xF6, 0xF5, 0xC6, 0x2F, 0xD7, 0x4E,
+  0x7E, 0x19, 0xF4, 0xD4, 0x8B, 0xEE, 0x76, 0xA5, 0x95, 0x62, 0x59, 0x27, 0x19, 0xCC, 0x72, 0x59,
+  0xCC, 0x73, 0xE6, 0x87, 0x9B, 0x67, 0x31, 0x29, 0xF3, 0x60, 0xBA, 0xB6, 0xC8, 0xF7, 0x25, 0x98,
+  0xE4, 0xD0, 0xC8, 0x69, 0x7B, 0xE5, 0xBA, 0xE8, 0xAF, 0xDB, 0x1B, 0x4E, 0x52, 0x1D, 0x4F, 0xCB,
+  0x97, 0xE8, 0x77, 0xF3, 0x0D, 0x41, 0x77, 0xFC, 0x71, 0x7B, 0x97, 0xFA, 0x2E, 0xBF, 0x44, 0x9F,
+  0x13, 0xFB, 0x1F, 0xD9, 0x3F, 0x80, 0x9F, 0x8B, 0xCC, 0x5C, 0x39, 0xCB, 0x69, 0x51, 0xE6, 0x9B,
+  0x02, 0x53, 0xEE, 0xE3, 0xF0, 0x25, 0xF8, 0x1C, 0xE6, 0x79, 0x21, 0xFB, 0xED, 0x21, 0xEF, 0xB3,
+  0xF7, 0x90, 0x0D, 0xDF, 0x2E, 0xCF, 0xBD, 0x7F, 0xB9, 0x74, 0xD7, 0xA3, 0x77, 0xFF, 0x9D, 0xF7,
+  0x8B, 0xB1, 0x7F, 0x31, 0xBE, 0x5F, 0x4C, 0xFC, 0x8B, 0xC9, 0xFD, 0x62, 0xEA, 0x5F, 0x4C, 0xEF,
+  0x17, 0x33, 0xFF, 0x22, 0xBD, 0x28, 0xF7, 0x2F, 0xE6, 0xF7, 0x8B, 0x85, 0x7F, 0x91, 0xBE, 0xA0,
+  0xF4, 0x2F, 0x96, 0xF7, 0x8B, 0x07, 0xFF, 0xE2, 0x81, 0x0A, 0x1F, 0x3E, 0x94, 0x3E, 0xBC, 0x5F,
+  0x6E, 0x2F, 0x3F, 0xB6, 0x0A, 0xBF, 0xD5, 0x4E, 0x2D, 0x87, 0x45, 0x4E, 0x5F, 0x2F, 0xAA, 0x59,
+  0x4E, 0xA6, 0x56, 0x63, 0x2A, 0xD0, 0xDA, 0xFD, 0xE8, 0xD4, 0x7C, 0x6F, 0xD9, 0x60, 0xB9, 0x8E,
+  0xB6, 0x79, 0x07, 0xF9, 0xB5, 0x17, 0xD3, 0x51, 0x0D, 0x41, 0x27, 0xDB, 0xE5, 0x4B, 0xFC, 0xD9,
+  0x56, 0xF7, 0x28, 0x9A, 0xC6, 0x34, 0xDB, 0xED, 0x52, 0x78, 0xFF, 0xF1, 0x7F, 0xED, 0xD4, 0x8F,
+  0x51, 0xCF, 0x6A, 0x51, 0x7A, 0xF8, 0x32, 0xC9, 0x4E, 0x2C, 0xEA, 0x2C, 0x6F, 0xCD, 0xA8, 0x7E,
+  0x6C, 0x64, 0x10, 0xDB, 0xDF, 0x12, 0x22, 0xAA, 0x59, 0x77, 0xEB, 0x22, 0xBF, 0x72, 0x45, 0x8B,
+  0x9F, 0x9A, 0x5A, 0x0D, 0x27, 0xD3, 0x5B, 0x96, 0xED, 0x91, 0x95, 0x9E, 0x4C, 0xD7, 0xF9, 0x71,
+  0xFB, 0xBF, 0x2F, 0x9F, 0x43, 0x53, 0x2B, 0x9F, 0xCC, 0xE3, 0x54, 0xF3, 0xE9, 0x6F, 0x52, 0xCA,
+  0xAF, 0xB7, 0xEB, 0xC1, 0x24, 0x1A, 0xB5, 0xCE, 0x5F, 0x3E, 0x47, 0x7B, 0x99, 0xBF, 0x7C, 0x36,
+  0x8F, 0xFD, 0xB4, 0x7D, 0xF4, 0xA7, 0xCF, 0x11, 0x7D, 0xFA, 0xB8, 0x76, 0xDD, 0xF6, 0x35, 0x3F,
+  0xDA, 0x4E, 0x8B, 0xE5, 0x8B, 0xFD, 0xEB, 0x7E, 0x63, 0xB2, 0xAF, 0xBF, 0xDF, 0xD9, 0xFE, 0x6E,
+  0x6F, 0x3D, 0xFC, 0x6C, 0x1B, 0x85, 0x1F, 0xAE, 0x74, 0x1F, 0xAE, 0x4C, 0x1F, 0xAE, 0xCC, 0x8F,
+  0xAF, 0xBF, 0xD7, 0xF5, 0x74, 0xEB, 0xDB, 0xF7, 0x4E, 0xF5, 0x58, 0x90, 0xC7, 0x77, 0xB9, 0x4B,
+  0xDD, 0xC7, 0x4B, 0xD3, 0xC7, 0x4B, 0xF3, 0xD3, 0x47, 0xF9, 0x6D, 0x4B, 0xAF, 0x0B, 0xE6, 0x51,
+  0x0D, 0x3F, 0xC4, 0xA0, 0x7A, 0xB1, 0x35, 0xD4, 0xFD, 0xCA, 0xA7, 0x78, 0xFE, 0x64, 0x9B, 0x43,
+  0x4C, 0x9F, 0xD4, 0xD0, 0xAA, 0x41, 0x2D, 0x92, 0xAA, 0x68, 0x96, 0x00, 0x8F, 0xE6, 0x4F, 0xF3,
+  0x22, 0xC7, 0xF9, 0xE7, 0xF2, 0x97, 0xFD, 0x07, 0xFF, 0xFA, 0x26, 0xAF, 0xED, 0x24, 0x7A, 0x39,
+  0x7F, 0xA2, 0x17, 0x85, 0xFF, 0xF2, 0x63, 0x99, 0xC4, 0x30, 0xB7, 0x66, 0x66, 0xF8, 0x32, 0xE9,
+  0x45, 0x2C, 0xF2, 0xE7, 0xB0, 0x91, 0xC7, 0x5F, 0x7E, 0x5F, 0xF4, 0xC7, 0x3B, 0x91, 0x99, 0x62,
+  0x86, 0x5F, 0x7E, 0xDF, 0xDE, 0x7C, 0xBB, 0x14, 0x1C, 0x42, 0x33, 0xD7, 0xCD, 0x41, 0xAB, 0x3A,
+  0xD3, 0x77, 0xBE, 0xFC, 0x34, 0x4E, 0xFA, 0xA8, 0x9A, 0x2F, 0xFF, 0xE3, 0x3F, 0xFE, 0x67, 0x2F,
+  0x8E, 0xF2, 0x7F, 0xD3, 0x03, 0x3E, 0xFF, 0x2F, 0x55, 0x4F, 0x7A, 0xD6, 0xED, 0xF2, 0xF9, 0xDF,
+  0xC4, 0xAC, 0xEA, 0xED, 0xEE, 0xCF, 0xDB, 0x23, 0x4C, 0xA9, 0xFF, 0x4B, 0xF4, 0xCB, 0x4F, 0x5F,
+  0x3F, 0xBC, 0xEC, 0x70, 0x2B, 0x87, 0xF7, 0xAE, 0xA8, 0xFC, 0x67, 0xBC, 0x2C, 0x46, 0x2F, 0x33,
+  0x8F, 0x7E, 0x7E, 0x5B, 0x5C, 0xFC, 0x33, 0xDE, 0x96, 0xA0, 0xB7, 0x99, 0x47, 0xBB, 0xB7, 0xB5,
+  0x9D, 0x1A, 0x83, 0x93, 0x9E, 0xD4, 0x77, 0x33, 0x75, 0x88, 0xEE, 0x9F, 0xF0, 0xCA, 0xF0, 0xD7,
+  0x4F, 0xBD, 0x9A, 0x26, 0x3D, 0x3D, 0xD5, 0xEB, 0xB6, 0xEE, 0xFC, 0xC7, 0xCF, 0x41, 0xE4, 0xBD,
+  0x98, 0xE6, 0xEE, 0x1F, 0x4F, 0xD8, 0xFF, 0x79, 0xC4, 0x2A, 0xB3, 0x3A, 0xFD, 0x0A, 0x4A, 0xFB,
+  0xE1, 0x39, 0xBF, 0x7E, 0x7C, 0xF2, 0x3F, 0xA1, 0xC5, 0xFC, 0x0F, 0xFA, 0x0B, 0x85, 0x7A, 0xFE,
+  0xB8, 0xED, 0xDB, 0x4C, 0x5B, 0xE8, 0xE5, 0xD3, 0xE3, 0xC3, 0x9E, 0xAE, 0xED, 0x8F, 0x7C, 0xBE,
+  0xE3, 0x3E, 0x77, 0xBF, 0xEE, 0xC6, 0xC3, 0xC7, 0x6B, 0xA6, 0x73, 0x7D, 0xBC, 0xB8, 0x75, 0x2F,
+  0x92, 0x01, 0x6E, 0xD5, 0xB3, 0x4D, 0xF8, 0xDE, 0xDF, 0x6F, 0xF3, 0xC1, 0x22, 0xEA, 0xB7, 0x1F,
+  0x50, 0x14, 0xB8, 0x4F, 0xCD, 0xCF, 0x53, 0xF5, 0xC3, 0x44, 0x4F, 0x6B, 0xC1, 0xF3, 0x2A, 0xDD,
+  0xAB, 0xA6, 0x31, 0x52, 0xC8, 0x7D, 0xB2, 0xFF, 0xEC, 0x16, 0x66, 0xFB, 0x36, 0xB3, 0x0C, 0xFF,
+  0xBA, 0xFF, 0xC3, 0x2C, 0xBF, 0xB7, 0xA5, 0xE6, 0x4F, 0xAC, 0x1E, 0x51, 0x18, 0xFE, 0xCB, 0xC3,
+  0xF3, 0x7E, 0x70, 0x6B, 0x89, 0x7B, 0xC7, 0xC7, 0x25, 0x5E, 0x0D, 0xA6, 0xCC, 0x66, 0x76, 0xAB,
+  0x75, 0xA7, 0xA7, 0x2F, 0x7F, 0x6B, 0xDB, 0xF6, 0xB6, 0x9E, 0x87, 0xE1, 0xF8, 0xFE, 0xA5, 0x92,
+  0xA6, 0x3D, 0xED, 0x3D, 0xF3, 0x56, 0x23, 0xD9, 0xFC, 0xF4, 0x7F, 0xDB, 0x38, 0x97, 0xB7, 0xCE,
+  0x21, 0xEA, 0x5A, 0xCE, 0xB3, 0xAA, 0xCC, 0x3A, 0xAA, 0xCC, 0x7D, 0x80, 0x26, 0x79, 0xE9, 0xD0,
+  0xD5, 0x76, 0x3B, 0xC8, 0x1C, 0x88, 0xF9, 0x6D, 0x55, 0xB7, 0x0F, 0x9F, 0x4D, 0x99, 0x6A, 0x3D,
+  0x8D, 0x7A, 0x32, 0x2D, 0xD8, 0x80, 0x1F, 0xE5, 0xA2, 0xBD, 0xFF, 0x08, 0xDE, 0x4D, 0x23, 0xBA,
+  0xDB, 0x4C, 0xA6, 0x88, 0xA6, 0xD3, 0xE9, 0x37, 0xF4, 0x25, 0xD5, 0xE1, 0x91, 0xAB, 0xC5, 0xD4,
+  0x40, 0xAE, 0x22, 0xEE, 0xDB, 0x3A, 0xA3, 0x8F, 0x08, 0xD3, 0x98, 0x08, 0x54, 0x0F, 0x51, 0x11,
+  0xD2, 0x6D, 0x5B, 0xD5, 0xA2, 0x83, 0xF5, 0x20, 0xEE, 0x4C, 0x6B, 0xBA, 0xA6, 0x32, 0x1F, 0xBE,
+  0x9C, 0x64, 0x2F, 0x21, 0x49, 0xC5, 0x51, 0x53, 0xD0, 0x9A, 0x82, 0x9F, 0xE4, 0x60, 0x7A, 0xF2,
+  0x47, 0x30, 0x6B, 0x42, 0x07, 0x56, 0x43, 0x05, 0x88, 0x32, 0x49, 0xEF, 0x44, 0x77, 0x34, 0x82,
+  0x85, 0x80, 0x6F, 0xAB, 0x09, 0x31, 0xDD, 0x2F, 0xB8, 0x75, 0x3F, 0x54, 0x05, 0x49, 0xE1, 0x73,
+  0xB6, 0xA2, 0x54, 0x7B, 0x85, 0xE0, 0xC1, 0x07, 0xB7, 0x3E, 0x8F, 0xA8, 0xDC, 0xA7, 0x6E, 0xB2,
+  0x02, 0xC2, 0x4A, 0x87, 0x8D, 0xE2, 0x0A, 0x3B, 0x03, 0x35, 0x4D, 0xD7, 0x49, 0x23, 0x07, 0xC8,
+  0x19, 0x40, 0x69, 0x4E, 0x3D, 0xA6, 0x17, 0xDF, 0x61, 0x57, 0x8E, 0x5D, 0x13, 0x6E, 0x44, 0x80,
+  0x5F, 0x96, 0xC6, 0x54, 0x59, 0x7D, 0xB5, 0x76, 0x62, 0xA8, 0x51, 0xFB, 0x85, 0x2D, 0x55, 0x40,
+  0x6F, 0x86, 0x67, 0x2D, 0x06, 0x33, 0x1C, 0x6D, 0x45, 0x88, 0xE1, 0xB8, 0x9A, 0xF9, 0xD8, 0xF4,
+  0x7D, 0x53, 0xC3, 0xE3, 0x24, 0xED, 0xFE, 0x02, 0x95, 0x44, 0x24, 0xF4, 0x73, 0xC5, 0x35, 0x59,
+  0x73, 0x27, 0x86, 0xDA, 0xCC, 0xAD, 0xA8, 0x43, 0x26, 0x8E, 0x68, 0x26, 0xAD, 0x1A, 0xD8, 0x67,
+  0xA9, 0x97, 0x0D, 0x47, 0xD9, 0x59, 0x99, 0x19, 0x95, 0x25, 0x3C, 0x38, 0xC8, 0x4C, 0x03, 0x8D,
+  0x5E, 0xAB, 0xED, 0xFF, 0x2E, 0x70, 0x14, 0x84, 0x09, 0x80, 0x99, 0xF6, 0x37, 0x33, 0x1B, 0x80,
+  0xB9, 0x6E, 0x10, 0x85, 0x11, 0xA0, 0xD7, 0x11, 0xA2, 0xF1, 0x23, 0xCA, 0x94, 0xB5, 0xF0, 0x29,
+  0xB6, 0x90, 0xA9, 0x4F, 0xF1, 0xA5, 0xCB, 0x7C, 0x8C, 0x29, 0x56, 0xEE, 0x98, 0x09, 0x75, 0xAD,
+  0x2C, 0xF3, 0x81, 0x7A, 0x92, 0xDB, 0x72, 0x03, 0x5B, 0x5F, 0x3A, 0xD0, 0xF4, 0xC1, 0x09, 0x76,
+  0x53, 0x57, 0xB9, 0x6F, 0x27, 0x38, 0x66, 0xE8, 0xBB, 0xC6, 0xD1, 0xAC, 0x1C, 0xE6, 0x2E, 0x7C,
+  0x4F, 0xFB, 0x04, 0x05, 0x4A, 0xA3, 0xC1, 0x95, 0xB8, 0xA1, 0x33, 0x8E, 0x70, 0xEA, 0x48, 0x8A,
+  0xC8, 0x01, 0x9D, 0x84, 0x7D, 0xF1, 0xE0, 0x01, 0x66, 0x24, 0x2F, 0x70, 0xB6, 0xF3, 0x9F, 0xC2,
+  0x0D, 0xD0, 0x88, 0x9A, 0x62, 0xAA, 0x4F, 0xB8, 0xFE, 0xA2, 0xB2, 0xD8, 0x91, 0x8B, 0xC0, 0x6D,
+  0xE1, 0x90, 0x49, 0x5F, 0x6C, 0x79, 0x82, 0x5A, 0x4D, 0x35, 0xDF, 0x9D, 0x92, 0xAC, 0x64, 0x7E,
+  0xC0, 0xF4, 0xAC, 0x24, 0x3B, 0x30, 0x3F, 0xE0, 0x3A, 0x59, 0x92, 0x09, 0xE6, 0x17, 0xB0, 0xBF,
+  0x25, 0x59, 0xE5, 0xE3, 0xAF, 0x8B, 0x1F, 0x0A, 0x04, 0x73, 0x33, 0xB7, 0x28, 0x01, 0xCC, 0x4E,
+  0xE0, 0xE2, 0x00, 0x68, 0x58, 0xE4, 0x50, 0x3C, 0x7C, 0x21, 0x57, 0xD6, 0x3C, 0xF1, 0x29, 0xAE,
+  0x90, 0x79, 0xE8, 0x53, 0x6C, 0xE9, 0xDC, 0xBA, 0xB0, 0x61, 0xB8, 0x58, 0x79, 0xEC, 0x31, 0x33,
+  0xD3, 0x3B, 0xC3, 0xEA, 0x03, 0x15, 0xA0, 0xA1, 0x97, 0x24, 0xC5, 0x07, 0xEE, 0x0C, 0x39, 0x57,
+  0xCB, 0xCB, 0x7C, 0x93, 0xDF, 0x01, 0x55, 0x14, 0x54, 0x65, 0x46, 0x50, 0x9B, 0xED, 0x84, 0x11,
+  0xD8, 0x99, 0x5C, 0x0E, 0x56, 0xB1, 0x31, 0x5F, 0xCD, 0xDF, 0xFA, 0x19, 0x2E, 0x31, 0x54, 0x58,
+  0x43, 0x4C, 0x6A, 0x7E, 0x83, 0x9F, 0x4D, 0x0D, 0x37, 0x5F, 0xFB, 0x5E, 0x2E, 0x93, 0x7A, 0x83,
+  0x43, 0x9B, 0x9E, 0x04, 0x27, 0xC6, 0x96, 0x8A, 0xB7, 0x74, 0x62, 0x86, 0x03, 0xAD, 0xF4, 0x80,
+  0x59, 0x09, 0xFC, 0x91, 0xD4, 0x3B, 0x17, 0xDD, 0xC3, 0x89, 0x81, 0xCA, 0xB0, 0x36, 0x56, 0x5A,
+  0x85, 0xC5, 0x4C, 0x76, 0x44, 0x07, 0x8D, 0x9C, 0xEB, 0x49, 0x8D, 0x4C, 0xA5, 0xC6, 0x07, 0x9A,
+  0x60, 0xD7, 0x45, 0x9B, 0x75, 0xBA, 0x55, 0xEF, 0x70, 0x5A, 0x4B, 0x23, 0x12, 0x06, 0xCE, 0xA6,
+  0xE0, 0xF2, 0x1D, 0xBE, 0x37, 0xDD, 0x91, 0x45, 0xC3, 0xA9, 0x9A, 0x7A, 0xE0, 0x05, 0x0B, 0xA7,
+  0x99, 0x9B, 0x29, 0x2E, 0x78, 0xF2, 0xBD, 0x4F, 0x78, 0x95, 0xA8, 0xAE, 0xB0, 0xF2, 0xEA, 0xFD,
+  0xBE, 0x15, 0x80, 0x27, 0x65, 0x64, 0x10, 0x08, 0x36, 0x04, 0xD6, 0x6F, 0xF3, 0x28, 0xA0, 0x68,
+  0x93, 0xD1, 0x24, 0x64, 0x21, 0xA6, 0xC0, 0x61, 0xBA, 0x33, 0xB8, 0xD3, 0x4A, 0x57, 0xE4, 0xDA,
+  0x76, 0x3F, 0x20, 0xE2, 0xC8, 0x90, 0xBE, 0xFA, 0xCE, 0xAC, 0x3D, 0x84, 0xDC, 0x9B, 0x4E, 0x42,
+  0xA1, 0x75, 0x2E, 0xCF, 0x09, 0xD8, 0x84, 0xB5, 0x60, 0xDB, 0xB6, 0xA2, 0x26, 0x4F, 0x25, 0x00,
+  0xB9, 0xC9, 0x25, 0x8B, 0x32, 0x44, 0x73, 0x93, 0x4C, 0x16, 0xB9, 0x52, 0xC0, 0x09, 0x2D, 0x73,
+  0xEF, 0x1E, 0x1A, 0x23, 0xCA, 0x37, 0x50, 0x7E, 0x8D, 0x77, 0xA6, 0x16, 0x3D, 0x9A, 0xA7, 0xE2,
+  0xC6, 0x95, 0x6A, 0xAA, 0x75, 0x03, 0x25, 0xD3, 0xD8, 0x55, 0xD8, 0x84, 0x3A, 0x53, 0x58, 0xBB,
+  0x5A, 0x9F, 0xA5, 0xF9, 0xB8, 0xCE, 0x7E, 0x21, 0xDA, 0xCC, 0xA4, 0x49, 0xE2, 0xC0, 0x37, 0xB9,
+  0xBC, 0x46, 0x53, 0x42, 0x17, 0x34, 0x21, 0xC6, 0xB5, 0xEB, 0x77, 0x8B, 0x69, 0xE9, 0x6B, 0x20,
+  0xFB, 0x71, 0xB9, 0xC2, 0x36, 0x4A, 0x1F, 0xC1, 0x76, 0x85, 0x2F, 0x8C, 0xD3, 0xF0, 0x91, 0x3B,
+  0x89, 0xAE, 0x85, 0x5C, 0xFC, 0xC8, 0xFD, 0xB6, 0x9A, 0xB9, 0x16, 0x8E, 0xF4, 0x38, 0x4D, 0x1E,
+  0xD1, 0xE5, 0x34, 0x49, 0x49, 0x3F, 0x80, 0x33, 0x2C, 0x6D, 0x51, 0xED, 0x2F, 0x4C, 0xDF, 0x18,
+  0xE4, 0x02, 0xB7, 0x67, 0xD4, 0x64, 0x70, 0x17, 0x1C, 0xD3, 0x1E, 0xA9, 0x92, 0x78, 0x4B, 0xD6,
+  0xD2, 0xD8, 0x96, 0x27, 0x66, 0x2F, 0x12, 0x55, 0xE9, 0x03, 0x12, 0xCC, 0xB6, 0xD0, 0x98, 0x74,
+  0x65, 0x81, 0xD5, 0x1A, 0xB6, 0xC9, 0x7E, 0x3F, 0x98, 0xCD, 0x74, 0x7D, 0x82, 0x33, 0xBE, 0x2B,
+  0xF2, 0x77, 0x25, 0xA7, 0xA0, 0x5E, 0xA7, 0x33, 0x9E, 0x48, 0xEE, 0x73, 0x7A, 0xC5, 0xCC, 0xD8,
+  0x79, 0x5A, 0x10, 0x50, 0x5F, 0x6B, 0x3C, 0x68, 0x49, 0xA4, 0xAE, 0xD4, 0x1B, 0xDE, 0x4A, 0x95,
+  0x6E, 0x2A, 0x52, 0xBD, 0xAE, 0xBE, 0xC9, 0x1A, 0x0A, 0x56, 0x45, 0x49, 0xD0, 0xA0, 0x6B, 0x2B,
+  0x51, 0xA3, 0x06, 0x8D, 0xDC, 0xA4, 0xA5, 0xF4, 0x49, 0x7C, 0xC7, 0x53, 0x5F, 0x51, 0x52, 0xD7,
+  0x53, 0xD3, 0x72, 0x6A, 0x84, 0x9D, 0x70, 0xDF, 0x60, 0x65, 0xB7, 0xD4, 0xE9, 0xD5, 0x52, 0xAD,
+  0xF5, 0x1B, 0xEC, 0x1D, 0x11, 0x89, 0xCD, 0x06, 0xAA, 0xB5, 0x82, 0x72, 0x27, 0x09, 0xCE, 0x06,
+  0xB9, 0xC2, 0xFB, 0x54, 0x01, 0x9D, 0x55, 0x0F, 0x2D, 0x0A, 0xD6, 0x63, 0x21, 0x3D, 0xA8, 0x92,
+  0xD3, 0x84, 0x1F, 0x45, 0x2D, 0xD6, 0x6D, 0x16, 0x2F, 0x38, 0xD1, 0x15, 0x0F, 0x48, 0x30, 0x9E,
+  0xF4, 0x00, 0x1B, 0xB7, 0xA2, 0x96, 0xEB, 0xD4, 0x00, 0x7B, 0xFE, 0x81, 0xEA, 0xA7, 0xD3, 0x47,
+  0x58, 0xD1, 0xD1, 0x7E, 0xFF, 0xC8, 0x6C, 0x3A, 0xEA, 0x07, 0x24, 0xA8, 0x20, 0xE4, 0xDE, 0xB3,
+  0xCA, 0xC5, 0xDA, 0x0E, 0x61, 0x61, 0x92, 0x27, 0x08, 0x3E, 0x2B, 0x3E, 0xD0, 0x50, 0xD3, 0x1D,
+  0x5C, 0x17, 0x93, 0xD8, 0xDD, 0x87, 0x12, 0xA4, 0xA4, 0xDA, 0xD3, 0x7D, 0x05, 0x7B, 0xA0, 0xFB,
+  0x3D, 0xAC, 0xD4, 0xAC, 0x71, 0xBF, 0x87, 0x83, 0x21, 0xCB, 0xA8, 0x42, 0xB0, 0xB6, 0x2C, 0x8C,
+  0x9B, 0xFD, 0xBE, 0x11, 0x91, 0xB0, 0xEA, 0xAD, 0x2A, 0x3C, 0xA8, 0x97, 0x8D, 0x55, 0x85, 0xC2,
+  0x35, 0x3E, 0xF7, 0x38, 0x3D, 0xCA, 0x01, 0xF6, 0x97, 0xD2, 0x83, 0xCC, 0x8E, 0x97, 0xE9, 0x56,
+  0x8D, 0xD8, 0xB1, 0x5E, 0x4C, 0xB8, 0xF0, 0xD2, 0x31, 0x46, 0x5E, 0x9E, 0xC4, 0x08, 0xA7, 0x5B,
+  0x57, 0xA8, 0xCD, 0xB2, 0x86, 0x17, 0xAC, 0x32, 0xAD, 0x1F, 0xA8, 0x01, 0x57, 0x77, 0x99, 0x85,
+  0x0F, 0xD8, 0xCD, 0x94, 0x8C, 0x38, 0xEA, 0x3D, 0xFA, 0xD2, 0x59, 0xB1, 0x9C, 0x5D, 0x27, 0x5D,
+  0xE1, 0xDE, 0xA1, 0x04, 0xB0, 0xDF, 0xE6, 0xEA, 0x33, 0x3D, 0xC8, 0x9D, 0x59, 0xD4, 0x3C, 0xAF,
+  0x12, 0x4A, 0x4D, 0x95, 0xA3, 0x18, 0x65, 0x19, 0x35, 0xCB, 0x24, 0x54, 0x87, 0xA7, 0x5E, 0x11,
+  0xED, 0x08, 0x6C, 0xDA, 0x86, 0x2A, 0xD1, 0x36, 0xAB, 0x59, 0x2E, 0x14, 0x5C, 0x9E, 0x0A, 0xE9,
+  0x30, 0x25, 0xDB, 0xDA, 0x48, 0x1D, 0x70, 0x6B, 0x15, 0x3D, 0x41, 0x2F, 0x3A, 0x5E, 0x4A, 0xDB,
+  0x96, 0x6A, 0xD2, 0xC2, 0x88, 0x4A, 0xF3, 0x12, 0x2C, 0xFA, 0xC2, 0x4C, 0x57, 0x3B, 0x8A, 0x37,
+  0x16, 0x11, 0x75, 0xBC, 0x69, 0x85, 0xAB, 0x5D, 0x96, 0xD1, 0x90, 0x59, 0x6A, 0x34, 0x62, 0x9D,
+  0x7C, 0xBA, 0xB6, 0x2D, 0x2C, 0x42, 0x49, 0xBB, 0xC1, 0x6A, 0x3D, 0x42, 0x55, 0x05, 0xB5, 0xC4,
+  0xAA, 0xBA, 0x06, 0xAF, 0x71, 0x91, 0xA0, 0x32, 0x18, 0x71, 0xE8, 0xA4, 0x27, 0xBC, 0xBF, 0x8F,
+  0x76, 0x66, 0x96, 0x57, 0xB8, 0x24, 0x39, 0xB1, 0x69, 0x85, 0xCF, 0x48, 0x73, 0xF7, 0x31, 0x93,
+  0x36, 0xAB, 0xA9, 0xEC, 0xE4, 0xFB, 0x28, 0x8D, 0xFC, 0x03, 0xA7, 0xD5, 0x96, 0x58, 0x28, 0x1C,
+  0x85, 0xEE, 0xAB, 0xB9, 0xED, 0x74, 0xE6, 0x84, 0xE2, 0x75, 0x56, 0x83, 0xD5, 0xDD, 0x2F, 0xAA,
+  0xC7, 0x72, 0x82, 0x2B, 0xD6, 0x35, 0xB0, 0x4A, 0xD6, 0x09, 0xEE, 0x6E, 0x4A, 0x91, 0x3B, 0x6C,
+  0x36, 0x02, 0x8C, 0x68, 0x70, 0xC1, 0xEE, 0x75, 0x69, 0xFA, 0x96, 0x95, 0x04, 0x16, 0xAC, 0x5C,
+  0xA5, 0x4E, 0x6B, 0xA5, 0xFE, 0xA1, 0x11, 0x58, 0x01, 0x9B, 0x3C, 0x32, 0x9C, 0xDA, 0xA0, 0x78,
+  0xE6, 0xEA, 0x93, 0xAC, 0xA1, 0x31, 0x83, 0xB6, 0x92, 0x8E, 0x6C, 0xA0, 0xEE, 0xAA, 0x28, 0x9F,
+  0x9F, 0xD8, 0xAB, 0x01, 0x37, 0x03, 0xED, 0xDD, 0x1D, 0x39, 0x76, 0x0C, 0x18, 0x3D, 0x81, 0xB6,
+  0x31, 0x30, 0xF9, 0xFC, 0xF2, 0x8B, 0x94, 0x6F, 0xB0, 0x94, 0xEE, 0x6B, 0x7A, 0x39, 0x09, 0xB8,
+  0x5C, 0x86, 0x3E, 0x61, 0x96, 0x87, 0x65, 0x42, 0x1B, 0xE8, 0x70, 0xFF, 0xDE, 0x7E, 0x3C, 0x4E,
+  0x7A, 0x1D, 0xF0, 0xBA, 0x55, 0x11, 0x35, 0x88, 0xC6, 0x6C, 0xD7, 0x83, 0x5E, 0x8C, 0xDB, 0x0E,
+  0x4F, 0xB4, 0xB0, 0x78, 0x99, 0xC3, 0x1B, 0x2B, 0xC5, 0xC1, 0x25, 0xA0, 0x28, 0x73, 0x47, 0x0D,
+  0xA2, 0x52, 0x58, 0xC3, 0xD1, 0x12, 0x33, 0xCE, 0x6B, 0xC7, 0x4C, 0xB8, 0xAE, 0x70, 0xB0, 0x2F,
+  0x91, 0x19, 0xAB, 0x66, 0xBB, 0x51, 0xD6, 0xC8, 0x1D, 0xB9, 0x6F, 0x52, 0x20, 0xD6, 0xEE, 0x58,
+  0x3D, 0x61, 0x11, 0x3E, 0x93, 0xD1, 0x0E, 0xCD, 0x0A, 0x6E, 0x24, 0x33, 0xE9, 0x9A, 0x6F, 0x12,
+  0x67, 0xB8, 0xAD, 0x2D, 0xDB, 0xFD, 0x5D, 0x72, 0x61, 0xB5, 0x79, 0x24, 0xB4, 0xDC, 0x28, 0x4E,
+  0x9B, 0xD7, 0x1C, 0x7C, 0x8A, 0xD5, 0xE6, 0x91, 0xA0, 0x70, 0xC3, 0x6E, 0x5B, 0x1D, 0xD6, 0x02,
+  0x90, 0x85, 0x00, 0xE6, 0x0C, 0x01, 0x87, 0x08, 0xC0, 0xAC, 0x3D, 0x20, 0x8B, 0x01, 0x8D, 0xCD,
+  0x02, 0xD9, 0xC3, 0x83, 0xB1, 0x02, 0xB2, 0x29, 0x1D, 0x33, 0xE9, 0x05, 0x76, 0xC4, 0xBD, 0x16,
+  0x97, 0xD7, 0xEA, 0xD3, 0x38, 0x2A, 0x3D, 0x94, 0x1B, 0xF0, 0x91, 0x7B, 0xDE, 0x7C, 0x32, 0x23,
+  0xEF, 0x68, 0x75, 0x8A, 0x13, 0x7C, 0xB1, 0x7B, 0xDA, 0x02, 0x47, 0x1D, 0x75, 0xCB, 0xFA, 0x1F,
+  0xD9, 0xD5, 0x1A, 0x0F, 0x84, 0xAA, 0xB4, 0x88, 0xF6, 0x9F, 0x16, 0x79, 0x69, 0x01, 0xC8, 0x1D,
+  0x67, 0x96, 0x4C, 0xB3, 0x3D, 0x0F, 0xEA, 0x6E, 0x85, 0x02, 0x3B, 0x09, 0x7A, 0x1B, 0x39, 0xD7,
+  0xFA, 0x0C, 0xBF, 0x31, 0x6A, 0x63, 0x87, 0x7D, 0xAB, 0xF1, 0x83, 0x2A, 0x47, 0xF4, 0x9B, 0x4A,
+  0x95, 0x31, 0x34, 0x47, 0x6D, 0xE4, 0x40, 0x53, 0xFA, 0x11, 0x4A, 0x30, 0x51, 0x9B, 0x3A, 0xC8,
+  0x48, 0xB2, 0x6A, 0xC4, 0x1B, 0xC8, 0xCC, 0x41, 0x67, 0x35, 0x0B, 0x88, 0x50, 0x07, 0xDF, 0x4C,
+  0xBA, 0x8C, 0x4A, 0x28, 0x29, 0x3D, 0x0A, 0x9A, 0x77, 0x8A, 0x92, 0x06, 0x9F, 0xF5, 0x7C, 0x68,
+  0x8D, 0xDC, 0x05, 0xD7, 0xFC, 0x90, 0xCC, 0x96, 0xF5, 0x49, 0x28, 0x54, 0x8F, 0x79, 0x1D, 0x3A,
+  0xA0, 0x7B, 0xAB, 0x34, 0xA3, 0xEE, 0x8C, 0xAA, 0x67, 0x2A, 0x58, 0xA4, 0x30, 0xAB, 0x22, 0x16,
+  0xE1, 0x6A, 0x47, 0x5B, 0x1F, 0xB0, 0x63, 0xC0, 0xEB, 0xCA, 0x33, 0xDA, 0x5F, 0x59, 0xD6, 0x8E,
+  0x12, 0x89, 0x6B, 0x4D, 0xFA, 0x54, 0x05, 0x67, 0xE4, 0xB0, 0x0C, 0x7D, 0xC8, 0xFA, 0x64, 0x40,
+  0x69, 0x22, 0xF2, 0xA9, 0x11, 0x6F, 0xBE, 0x43, 0xF7, 0x28, 0xBC, 0xEE, 0x87, 0x61, 0xED, 0x01,
+  0x77, 0x03, 0x0A, 0x54, 0x23, 0x96, 0x3E, 0x77, 0x33, 0x91, 0xA2, 0x6A, 0xC8, 0xFD, 0x17, 0xBE,
+  0xD0, 0x07, 0x91, 0x60, 0x65, 0x38, 0x39, 0x63, 0xE1, 0xBD, 0x75, 0xC4, 0x0C, 0xD7, 0x35, 0xF2,
+  0x04, 0xD8, 0x80, 0xC0, 0x2C, 0x90, 0x27, 0x3D, 0x42, 0x4E, 0x3C, 0x70, 0x4C, 0xD7, 0x48, 0x93,
+  0xDA, 0xC7, 0x18, 0x9D, 0x4F, 0x9A, 0xB4, 0x0F, 0xD4, 0xC0, 0x4C, 0xD2, 0x69, 0x1A, 0xF9, 0xDC,
+  0x28, 0xE0, 0x74, 0x99, 0xA6, 0x89, 0x4F, 0xFD, 0xB6, 0x4A, 0xBC, 0xF3, 0x4A, 0x33, 0x1F, 0x9B,
+  0xF0, 0x0E, 0x3B, 0x4D, 0x5D, 0x0F, 0x94, 0xE7, 0xC9, 0x4C, 0x86, 0xAF, 0xAD, 0x72, 0x91, 0x57,
+  0x2D, 0x3E, 0xCE, 0xAD, 0x51, 0x09, 0x7E, 0x3A, 0xBB, 0x4A, 0x25, 0x25, 0xE4, 0xF1, 0x3A, 0xE5,
+  0x35, 0xE5, 0x06, 0x73, 0xEB, 0x79, 0xF1, 0xF4, 0x50, 0x6E, 0x45, 0xCF, 0x92, 0x47, 0x8E, 0x5D,
+  0xD3, 0xB3, 0xF4, 0x11, 0xC4, 0x4B, 0x64, 0xE1, 0xBE, 0x5D, 0x41, 0xE5, 0x4B, 0x24, 0xDC, 0xB0,
+  0x36, 0xBB, 0x17, 0x38, 0x10, 0xF3, 0xD2, 0x27, 0xEC, 0xCE, 0x11, 0x6E, 0xD8, 0x1C, 0xB5, 0x4E,
+  0x35, 0x14, 0x9F, 0x22, 0x5A, 0xCA, 0xB8, 0x91, 0x1A, 0x45, 0x91, 0x4F, 0x04, 0x83, 0x5E, 0xE0,
+  0x93, 0xA2, 0x9A, 0xCA, 0x8C, 0x95, 0x7B, 0x79, 0x4A, 0x3D, 0xDD, 0x4C, 0x40, 0xAA, 0x7E, 0xA5,
+  0x8D, 0x71, 0x4B, 0x58, 0xA7, 0x46, 0x6E, 0x78, 0x25, 0x71, 0xF9, 0x04, 0xB1, 0x73, 0x52, 0x4A,
+  0x3E, 0x43, 0x3B, 0xCA, 0x38, 0x90, 0xA4, 0xE4, 0xAA, 0x52, 0x5B, 0x4F, 0x3B, 0xD4, 0x72, 0x4E,
+  0xD4, 0xE8, 0xB0, 0x9E, 0x25, 0x4E, 0xF7, 0x27, 0xCC, 0xB2, 0xB1, 0x72, 0xB4, 0x9D, 0xE0, 0x19,
+  0xDF, 0x99, 0x50, 0x38, 0x78, 0x85, 0x4A, 0xB8, 0x3A, 0xF6, 0x80, 0xAD, 0x17, 0x77, 0x5A, 0x34,
+  0x8C, 0x58, 0x9D, 0x90, 0x9A, 0xF1, 0x46, 0xF7, 0x52, 0x2C, 0x8C, 0xF6, 0xA6, 0x48, 0xAA, 0x07,
+  0x52, 0xC3, 0x25, 0x28, 0xAF, 0x93, 0x67, 0x2A, 0x60, 0x14, 0x28, 0x85, 0x9B, 0xEC, 0x36, 0x94,
+  0xA5, 0x1A, 0x9F, 0x32, 0xF3, 0xEB, 0xC5, 0x0A, 0x3C, 0x27, 0x29, 0xCE, 0x70, 0x6F, 0x48, 0x7B,
+  0xFC, 0x3B, 0xBE, 0xE2, 0x42, 0xA6, 0x4F, 0x10, 0xFB, 0xF6, 0xF4, 0xE1, 0x73, 0xD6, 0xF1, 0x65,
+  0x55, 0xFA, 0x15, 0xDF, 0x76, 0x70, 0xD1, 0x91, 0x61, 0xE1, 0x7F, 0x0F, 0x67, 0xAD, 0x4B, 0x4A,
+  0xFF, 0xBD, 0x73, 0xAF, 0xA0, 0xDA, 0x36, 0x29, 0xFD, 0xEF, 0xB0, 0x7E, 0x79, 0xD8, 0x5F, 0x2D,
+  0x71, 0x7B, 0x3D, 0xD3, 0x43, 0x17, 0xA1, 0x3A, 0xB8, 0x68, 0x52, 0x47, 0xC0, 0x52, 0x54, 0x14,
+  0x7B, 0xF7, 0xAD, 0x52, 0x6C, 0xC0, 0x23, 0x3A, 0xCE, 0x77, 0x0C, 0xEB, 0xF0, 0xA2, 0xBA, 0x72,
+  0x88, 0x92, 0x8C, 0xCC, 0xE0, 0xBE, 0x4C, 0xB7, 0xAD, 0xC4, 0x2E, 0x68, 0x8E, 0x38, 0xC2, 0x41,
+  0x97, 0xB8, 0xDB, 0xD0, 0x0E, 0xB8, 0x57, 0x89, 0x1A, 0xE0, 0xAE, 0x36, 0xA2, 0xA9, 0x49, 0x77,
+  0x6B, 0x0F, 0x91, 0xB0, 0x71, 0x1F, 0xD2, 0xF7, 0xF6, 0x1A, 0x9A, 0xB5, 0xB3, 0x07, 0x84, 0xE9,
+  0x3A, 0x31, 0x19, 0x31, 0x08, 0x6B, 0x74, 0x87, 0xFD, 0x9E, 0x72, 0xB7, 0x9B, 0x72, 0xE4, 0x02,
+  0x05, 0x13, 0xD2, 0x99, 0x11, 0xF7, 0x6A, 0xEA, 0x7C, 0x2A, 0x23, 0x67, 0xF9, 0x4A, 0xAB, 0xE4,
+  0x01, 0xC4, 0xF5, 0x9A, 0x3F, 0x32, 0xAF, 0x3E, 0x65, 0x7F, 0xDC, 0x28, 0xEA, 0x65, 0xDB, 0xA1,
+  0xC0, 0x96, 0x68, 0x3D, 0x0E, 0x8A, 0x61, 0x51, 0x2A, 0x77, 0x64, 0xC2, 0xA2, 0x5A, 0x98, 0xE7,
+  0x8F, 0x0C, 0xD3, 0x16, 0x69, 0x1C, 0x3F, 0x73, 0xAF, 0xBC, 0x62, 0x8A, 0x92, 0x66, 0x31, 0x3D,
+  0xD4, 0x4A, 0x4E, 0x47, 0xC9, 0x99, 0x17, 0xB3, 0xDC, 0x3D, 0x78, 0x68, 0xBB, 0x55, 0x62, 0x73,
+  0x66, 0x51, 0xBA, 0x86, 0x1B, 0x06, 0x59, 0x2F, 0x8D, 0x3C, 0xCB, 0x0E, 0xCA, 0x94, 0x71, 0xE8,
+  0x3E, 0x7A, 0x58, 0x84, 0x86, 0x0B, 0xBE, 0x7B, 0x96, 0x7E, 0x53, 0x58, 0x54, 0x4E, 0x7C, 0xC2,
+  0x1A, 0xD9, 0x30, 0xE6, 0x06, 0xDB, 0x08, 0x1D, 0x62, 0xEB, 0x6C, 0xBF, 0xCF, 0x4A, 0x63, 0xE4,
+  0x34, 0x5A, 0xEB, 0x65, 0x31, 0xCB, 0x42, 0xB5, 0x9A, 0xFD, 0xC9, 0x8A, 0x24, 0x90, 0x83, 0xFB,
+  0xB0, 0xB5, 0xC6, 0x1D, 0x91, 0xD6, 0xF1, 0x51, 0x0C, 0x12, 0xBA, 0x22, 0xBB, 0x5D, 0xFB, 0xDD,
+  0xCB, 0x70, 0xEB, 0x8F, 0x1A, 0x0E, 0xE3, 0x98, 0x14, 0xB1, 0xCF, 0x6C, 0x00, 0xDD, 0x4D, 0x52,
+  0xB7, 0xC9, 0x7A, 0xC6, 0x87, 0x1A, 0xE2, 0x25, 0x8B, 0x07, 0x72, 0x85, 0xBF, 0x38, 0xF0, 0xBF,
+  0xF8, 0x06, 0x77, 0x17, 0x52, 0x70, 0xBF, 0x80, 0xBB, 0x0C, 0x59, 0x31, 0xF8, 0x88, 0xF1, 0x9A,
+  0xC5, 0xB9, 0x31, 0x24, 0x1B, 0xE6, 0x27, 0x93, 0xEC, 0x15, 0x34, 0xFE, 0x48, 0xAE, 0x11, 0xE0,
+  0xCE, 0x3F, 0x75, 0x1B, 0xB3, 0x8F, 0x78, 0x3F, 0x76, 0xCC, 0xBE, 0xC9, 0xA9, 0x0B, 0xB8, 0x1F,
+  0x71, 0xDA, 0xA2, 0xD4, 0x69, 0x35, 0x3E, 0xFC, 0xF2, 0x84, 0xF7, 0x96, 0xA9, 0x93, 0x47, 0x9F,
+  0x7F, 0xF1, 0x5D, 0x42, 0x25, 0x6F, 0xEA, 0x94, 0x3F, 0x93, 0x99, 0xA9, 0x17, 0xCE, 0x91, 0x3F,
+  0x3C, 0xB8, 0x9A, 0x55, 0xB7, 0x20, 0x8D, 0x49, 0x63, 0xEF, 0x82, 0xDA, 0xF5, 0x22, 0x38, 0x7B,
+  0x44, 0x71, 0xB6, 0xDF, 0xE7, 0x74, 0xAE, 0xF9, 0xCE, 0xC0, 0x39, 0x35, 0x77, 0x5B, 0x17, 0x0B,
+  0x58, 0xAD, 0x08, 0x9C, 0x79, 0x33, 0xD7, 0xDF, 0xF4, 0x05, 0xBD, 0x26, 0x0E, 0xF7, 0xFB, 0x50,
+  0xAF, 0xE1, 0x64, 0x8F, 0x69, 0xC5, 0x1B, 0x89, 0xA2, 0xA5, 0x41, 0x39, 0xCF, 0x09, 0xDC, 0xDC,
+  0xD5, 0xFB, 0x7D, 0x56, 0x7E, 0xA3, 0x62, 0xAE, 0x15, 0x76, 0x1F, 0x89, 0xF7, 0xFB, 0x70, 0x15,
+  0x72, 0xEB, 0xE3, 0x0A, 0x65, 0x01, 0x27, 0x75, 0xAE, 0xD6, 0x61, 0xA6, 0x55, 0x33, 0x96, 0xE9,
+  0xEE, 0x25, 0x6D, 0xAC, 0x67, 0x7B, 0x00, 0xB7, 0x31, 0xB4, 0x44, 0xDC, 0x11, 0xB3, 0xE0, 0x5C,
+  0x35, 0xB6, 0x09, 0xD4, 0xF7, 0x89, 0xA1, 0x31, 0x42, 0xDF, 0xB5, 0xD7, 0x58, 0x6F, 0x24, 0x43,
+  0xD2, 0xE6, 0x36, 0x66, 0xE1, 0x67, 0xBE, 0x3E, 0x8E, 0x42, 0x62, 0x16, 0x51, 0x61, 0x33, 0x66,
+  0x44, 0xFA, 0xAF, 0x06, 0xDB, 0x1C, 0x62, 0x91, 0xD2, 0x7D, 0xF9, 0x1D, 0x69, 0xBB, 0xA4, 0xDB,
+  0xE5, 0x36, 0xB2, 0x53, 0xB5, 0xD2, 0x70, 0x34, 0x46, 0x22, 0x23, 0xA8, 0xD7, 0xF5, 0x04, 0xF5,
+  0xB2, 0x45, 0xEA, 0x1E, 0x64, 0x64, 0xF6, 0x6B, 0x03, 0x85, 0xC4, 0xA4, 0x94, 0x04, 0xCD, 0x6F,
+  0x23, 0x1C, 0x96, 0x49, 0xD9, 0xEE, 0xC8, 0x82, 0x47, 0x52, 0x58, 0x12, 0x72, 0x86, 0x6D, 0x50,
+  0xBB, 0xDB, 0x36, 0xB4, 0x5A, 0x4C, 0x70, 0x71, 0xAC, 0xA8, 0x4D, 0xCD, 0x84, 0xD2, 0x8B, 0xFA,
+  0x24, 0xDE, 0xA0, 0xCD, 0x28, 0xCF, 0xE8, 0xDB, 0x4F, 0x50, 0x96, 0x3B, 0x50, 0x0B, 0x28, 0x71,
+  0x1C, 0xCC, 0x6E, 0x12, 0xCE, 0x66, 0xC5, 0x0E, 0xCD, 0x36, 0x42, 0x09, 0x3E, 0x28, 0x22, 0x06,
+  0xBB, 0x49, 0x92, 0x94, 0x64, 0xEF, 0x07, 0x4D, 0x1C, 0xC2, 0x2F, 0x6F, 0x7D, 0x26, 0x47, 0x48,
+  0xE3, 0xBD, 0x26, 0x68, 0xB1, 0x3B, 0x7B, 0x16, 0x27, 0x3E, 0xA4, 0x57, 0xA8, 0x27, 0x8D, 0x53,
+  0x0F, 0x62, 0xFC, 0x47, 0x68, 0xCE, 0xDB, 0x98, 0x19, 0x2E, 0x44, 0x19, 0x6D, 0x60, 0x36, 0x66,
+  0xF3, 0x82, 0x83, 0x54, 0xE1, 0x53, 0x17, 0x0D, 0x19, 0xEA, 0x17, 0xEA, 0x88, 0xCD, 0xDA, 0xEE,
+  0x4D, 0x47, 0xB5, 0x98, 0x99, 0x5C, 0xD7, 0x12, 0xDA, 0x99, 0x92, 0xBD, 0x2D, 0x6E, 0xE0, 0x62,
+  0xFA, 0x87, 0x3E, 0x4E, 0x62, 0x84, 0xDA, 0x99, 0xDC, 0x3D, 0x76, 0x32, 0xF2, 0xA3, 0xC2, 0x42,
+  0x4F, 0x46, 0x32, 0xC0, 0x66, 0x16, 0xC0, 0xDA, 0x92, 0x43, 0xEC, 0x21, 0xEB, 0x04, 0x87, 0x7C,
+  0x72, 0x70, 0x6D, 0x33, 0x4B, 0x3C, 0x2B, 0x14, 0xE4, 0x22, 0xDD, 0xA8, 0x33, 0x63, 0x6B, 0x8B,
+  0x0F, 0x44, 0x7C, 0xFF, 0x0E, 0xAD, 0x7A, 0x39, 0x55, 0xF7, 0x00, 0xA5, 0x01, 0xB2, 0xDE, 0x36,
+  0xBA, 0x3E, 0x41, 0x43, 0x48, 0x42, 0x9E, 0x4B, 0x86, 0x78, 0xC3, 0xCE, 0x54, 0x07, 0xEA, 0x1B,
+  0x70, 0xAA, 0xC8, 0x1B, 0xFA, 0xCE, 0x6D, 0x3B, 0xB3, 0xC5, 0x3B, 0x41, 0x63, 0x57, 0xB6, 0x63,
+  0x50, 0x7A, 0x24, 0x8B, 0xF4, 0x06, 0x04, 0x6D, 0x27, 0x16, 0xEC, 0x19, 0x99, 0x16, 0xAE, 0xC4,
+  0x03, 0x36, 0x47, 0xA4, 0x64, 0x34, 0x6D, 0xB4, 0x9E, 0xEE, 0xBA, 0x23, 0x58, 0xB9, 0xC2, 0xC3,
+  0x38, 0x3F, 0xA5, 0x98, 0xBA, 0x83, 0x5E, 0x5E, 0xA8, 0xF5, 0x5C, 0x8F, 0xD0, 0x67, 0x5C, 0x22,
+  0xF7, 0xAA, 0x9B, 0xD2, 0x09, 0x6E, 0xCC, 0xA9, 0xD4, 0x93, 0x68, 0x97, 0xF8, 0xDE, 0xA5, 0x61,
+  0x83, 0xE4, 0x1E, 0x68, 0x85, 0x33, 0x7E, 0xFF, 0x97, 0x91, 0x66, 0xD3, 0xB0, 0x47, 0xAC, 0x97,
+  0x22, 0xD7, 0x61, 0x43, 0x5C, 0x82, 0x51, 0x77, 0xD7, 0x23, 0x63, 0x42, 0xA1, 0x25, 0x61, 0x52,
+  0x55, 0x55, 0x31, 0xB1, 0x3C, 0xCD, 0x23, 0xC3, 0x9B, 0x18, 0x92, 0x03, 0x75, 0x5C, 0x23, 0x65,
+  0x61, 0xB7, 0xA7, 0x88, 0x4C, 0xE3, 0xCD, 0xB4, 0x42, 0x17, 0x9D, 0xFC, 0xB0, 0xDF, 0x0F, 0xE6,
+  0x45, 0xCA, 0x6E, 0x84, 0xD3, 0x44, 0x46, 0xEE, 0x2B, 0x16, 0x9C, 0x8D, 0x70, 0xF8, 0xC6, 0x6D,
+  0xE7, 0xF2, 0xC6, 0x95, 0x6A, 0x65, 0x2C, 0x74, 0x14, 0xD3, 0xD2, 0xAC, 0x7D, 0xC5, 0xEC, 0x67,
+  0x53, 0xB2, 0x09, 0x1A, 0x66, 0xE4, 0xAC, 0xA7, 0x6E, 0x7A, 0xB8, 0x33, 0x66, 0x8E, 0x87, 0x15,
+  0x55, 0xB8, 0x01, 0xBA, 0x0E, 0x47, 0xC9, 0x34, 0x21, 0x95, 0xE9, 0x2A, 0xB0, 0xCF, 0x64, 0x72,
+  0xB8, 0x13, 0x52, 0x4C, 0xDD, 0xB5, 0x52, 0x13, 0x74, 0x81, 0x49, 0x0E, 0xF7, 0x7A, 0x92, 0x15,
+  0x36, 0xAF, 0x92, 0x66, 0x49, 0x36, 0x47, 0xAC, 0x9B, 0x8A, 0xF7, 0xFB, 0x41, 0x27, 0x8F, 0xA2,
+  0xBE, 0x42, 0x51, 0xA6, 0x24, 0x4C, 0xE1, 0x80, 0x5B, 0x7A, 0x0D, 0x5C, 0x1D, 0x8A, 0xF6, 0x5E,
+  0xBB, 0x92, 0x71, 0xEA, 0x75, 0x42, 0x9B, 0xEC, 0xA4, 0xD5, 0xB4, 0x40, 0x47, 0x9E, 0x94, 0x5C,
+  0x4C, 0x6C, 0xFC, 0xE3, 0x38, 0xAB, 0x19, 0x46, 0xEC, 0x44, 0x64, 0x28, 0x72, 0xD4, 0x19, 0x52,
+  0xEE, 0x85, 0x1D, 0x5C, 0xEF, 0x68, 0x93, 0x24, 0xFB, 0x0A, 0x47, 0x93, 0xD0, 0x3A, 0x2E, 0xFB,
+  0x11, 0xF7, 0x82, 0x88, 0xC4, 0x01, 0x39, 0x6C, 0x5A, 0x0F, 0xA8, 0xF8, 0x93, 0xE1, 0x23, 0xC3,
+  0xCD, 0x69, 0x31, 0xB9, 0xE0, 0x3E, 0x80, 0x81, 0x0D, 0x44, 0x87, 0x82, 0x55, 0xF9, 0x44, 0xF3,
+  0x76, 0x43, 0xD7, 0xCD, 0x86, 0xB3, 0x82, 0xD2, 0x53, 0xEC, 0x08, 0xF3, 0x8C, 0x0E, 0xCE, 0x58,
+  0x14, 0x66, 0x2B, 0x27, 0xB3, 0x6A, 0x42, 0xA3, 0x3C, 0x39, 0x0C, 0xC8, 0xC9, 0xC6, 0xD5, 0xC2,
+  0x8E, 0x4C, 0xC4, 0x72, 0x92, 0x93, 0x84, 0xB3, 0x47, 0x4A, 0x5E, 0xA3, 0x1B, 0x83, 0x7D, 0xF4,
+  0x0B, 0x9A, 0x69, 0xE5, 0x32, 0xC3, 0xB0, 0x04, 0x9A, 0x2E, 0xE4, 0x3A, 0x69, 0x7E, 0xE5, 0xA3,
+  0xC6, 0x3D, 0x9B, 0xF7, 0x68, 0x38, 0xEF, 0x94, 0x64, 0x62, 0x93, 0xEF, 0x46, 0xC0, 0x35, 0xE3,
+  0x9C, 0xDB, 0x89, 0x91, 0xA6, 0xCC, 0x70, 0x9D, 0xE8, 0x39, 0x73, 0x77, 0x44, 0x2B, 0x9B, 0x87,
+  0xBD, 0xB0, 0x1E, 0xE7, 0x80, 0x5E, 0x6C, 0xB6, 0xA3, 0x23, 0xE6, 0x49, 0xA8, 0x90, 0xEF, 0x66,
+  0xBE, 0x85, 0x4B, 0x19, 0x6D, 0x8F, 0x6F, 0x04, 0xAB, 0x4F, 0x4C, 0x1F, 0xA9, 0x57, 0xDA, 0xC4,
+  0x84, 0xB4, 0xCE, 0xD6, 0xF3, 0xD0, 0xCC, 0x1B, 0xB2, 0x99, 0x67, 0x18, 0x01, 0x92, 0x38, 0xCE,
+  0x4C, 0xAA, 0x83, 0x91, 0x09, 0x3B, 0x35, 0xBC, 0x71, 0x0F, 0x25, 0x1F, 0xCE, 0x47, 0xF8, 0xEE,
+  0xB4, 0xC3, 0x35, 0x01, 0x8D, 0xB2, 0x2B, 0xAE, 0x4C, 0xE9, 0x6E, 0x6F, 0x6B, 0xDB, 0xC8, 0x38,
+  0x96, 0x54, 0x3B, 0xC6, 0xA9, 0x95, 0x43, 0xDA, 0x8E, 0xB4, 0xA2, 0x96, 0x9C, 0xE7, 0x36, 0xCD,
+  0xD9, 0xC4, 0x04, 0x2D, 0x1C, 0x10, 0xF2, 0x89, 0xEA, 0xE5, 0x3C, 0xCB, 0x81, 0x71, 0x9F, 0x3F,
+  0xB4, 0x4F, 0x34, 0x3B, 0xE2, 0x43, 0x9A, 0xF2, 0x5B, 0xEC, 0x08, 0x46, 0x5A, 0xD4, 0xD6, 0xEE,
+  0xEF, 0x66, 0x2B, 0xD6, 0x59, 0x1D, 0x68, 0x70, 0x14, 0xD8, 0x87, 0x30, 0x27, 0xD7, 0xE1, 0xD6,
+  0x3A, 0xEF, 0xBE, 0x0C, 0x34, 0x3B, 0x78, 0xA0, 0xB9, 0xCB, 0x71, 0x99, 0xAB, 0xC2, 0xB5, 0x46,
+  0x63, 0x5C, 0x86, 0x14, 0xC0, 0xDD, 0x0A, 0x28, 0x84, 0x08, 0x2A, 0x91, 0x14, 0x0B, 0xE3, 0x88,
+  0x42, 0xF3, 0xD1, 0x1D, 0x61, 0x75, 0x46, 0x15, 0x61, 0x0D, 0xF4, 0x72, 0x2A, 0x48, 0x24, 0x32,
+  0x00, 0xB7, 0xF7, 0x2C, 0x89, 0xE8, 0xB1, 0x79, 0x2C, 0x72, 0xED, 0x61, 0xEB, 0xD9, 0x94, 0xE5,
+  0x1B, 0x9C, 0xD8, 0x42, 0xEA, 0x7E, 0x06, 0xEB, 0xF1, 0x9B, 0xA8, 0x7E, 0x15, 0x7E, 0x4F, 0x56,
+  0xED, 0xF7, 0x99, 0x0F, 0x8E, 0x28, 0xE8, 0xE0, 0xC6, 0xF0, 0x41, 0xD9, 0x75, 0xEE, 0x73, 0x36,
+  0x4A, 0x13, 0x52, 0x85, 0x47, 0x71, 0xB6, 0xB8, 0xFA, 0xF0, 0x00, 0x0D, 0xCB, 0x24, 0x6A, 0xDC,
+  0x18, 0x7E, 0xD9, 0xEA, 0x19, 0xEA, 0x27, 0x9A, 0xC6, 0x63, 0x5E, 0x48, 0xEE, 0x59, 0xEE, 0x83,
+  0x66, 0x16, 0x85, 0x9A, 0xF7, 0x88, 0x0C, 0xC0, 0x77, 0x6A, 0xD4, 0x13, 0x2E, 0x99, 0xF4, 0x30,
+  0xD5, 0xE3, 0x88, 0xCD, 0x88, 0xEC, 0x0A, 0x77, 0x8A, 0x7D, 0x58, 0xEB, 0x63, 0xC3, 0x59, 0x33,
+  0x4A, 0x0B, 0x37, 0xD3, 0x78, 0x1C, 0x6F, 0xA0, 0xCA, 0x68, 0x05, 0xD8, 0xF0, 0x17, 0x0E, 0xF9,
+  0x45, 0xF1, 0x91, 0xE3, 0x56, 0x03, 0x92, 0x0A, 0x37, 0x76, 0x6C, 0x5A, 0xF8, 0xD5, 0xFE, 0x7B,
+  0x47, 0x6B, 0xF0, 0x1E, 0xB5, 0x82, 0xF6, 0xC5, 0x88, 0x74, 0x8A, 0x37, 0x74, 0x7A, 0x19, 0xF5,
+  0x9B, 0x15, 0xB1, 0x07, 0xDB, 0x75, 0x7C, 0x4B, 0x04, 0x08, 0x49, 0xBF, 0x11, 0x6F, 0x56, 0x6F,
+  0x88, 0xF9, 0x6F, 0xB7, 0x9B, 0x7B, 0xDC, 0xA5, 0xFD, 0x4F, 0xBE, 0x60, 0x65, 0x43, 0x54, 0xEF,
+  0x65, 0x83, 0xC6, 0xB3, 0x62, 0xEF, 0x09, 0x9D, 0xDD, 0x78, 0x8D, 0x10, 0xDA, 0x87, 0x58, 0x0F,
+  0x1D, 0xCD, 0xF6, 0x92, 0x30, 0x29, 0x60, 0x2A, 0xD7, 0x43, 0xEC, 0xAA, 0x31, 0x4E, 0xB8, 0xDA,
+  0xB3, 0xBD, 0xC5, 0xF1, 0x7A, 0xB1, 0x0F, 0x15, 0x76, 0x85, 0x2D, 0x64, 0xEA, 0x31, 0x66, 0x69,
+  0x36, 0x6F, 0x5C, 0xD5, 0x8C, 0x27, 0xDF, 0x28, 0xF1, 0xE0, 0x56, 0xE3, 0xA4, 0x46, 0x87, 0x07,
+  0xC4, 0xC6, 0x7C, 0x5C, 0x66, 0xAC, 0x65, 0x0D, 0xF7, 0xE2, 0x9B, 0x75, 0x85, 0x09, 0xC8, 0x2D,
+  0x0E, 0x3E, 0x74, 0xCB, 0xE0, 0x87, 0xA4, 0xEC, 0xF0, 0x03, 0xC6, 0x2D, 0x0D, 0xE4, 0xBA, 0xB2,
+  0xA1, 0xDB, 0xB6, 0x1E, 0x2D, 0xCB, 0xC2, 0xF5, 0x7E, 0xEC, 0xBC, 0xBD, 0x8F, 0x20, 0xF3, 0xBE,
+  0x49, 0x28, 0xAC, 0xF6, 0xC8, 0xC9, 0x5F, 0xBC, 0xED, 0x04, 0x74, 0x10, 0x20, 0xB1, 0xCC, 0xDE,
+  0xBF, 0xB9, 0x01, 0x19, 0x19, 0x1A, 0x76, 0xCD, 0xC8, 0x7B, 0x52, 0xB0, 0x42, 0x7B, 0x54, 0x41,
+  0x2E, 0x3C, 0x86, 0xC1, 0xB9, 0x06, 0xDC, 0xB4, 0xD8, 0x99, 0x8D, 0x39, 0x6C, 0x62, 0x37, 0x23,
+  0xBE, 0xF0, 0x60, 0x4A, 0xF7, 0xF7, 0xAC, 0xA6, 0xAB, 0xE0, 0x41, 0x49, 0xED, 0x86, 0x15, 0x50,
+  0xE4, 0x8D, 0xD4, 0xEA, 0x0E, 0xB7, 0x68, 0x48, 0x61, 0x90, 0x37, 0x82, 0x0D, 0xAE, 0xC8, 0x49,
+  0xAC, 0xBC, 0x73, 0xCC, 0x36, 0x2C, 0xA4, 0x28, 0xC5, 0x3B, 0xC6, 0x98, 0xD8, 0x72, 0xB2, 0xC2,
+  0xDA, 0xEC, 0x5E, 0x30, 0x58, 0x22, 0xDA, 0xEF, 0x07, 0xE2, 0x22, 0x67, 0xC6, 0xC9, 0x8D, 0xC2,
+  0x81, 0x7D, 0x8E, 0x15, 0x8C, 0x6B, 0xC0, 0x32, 0x1D, 0x26, 0x25, 0xE5, 0xF1, 0x03, 0xDC, 0xE9,
+  0xA3, 0xE6, 0xC2, 0xB4, 0x53, 0x8A, 0x10, 0xB4, 0xBF, 0xB0, 0xF9, 0xC5, 0xA0, 0xF5, 0x99, 0x1C,
+  0x6D, 0x1D, 0x64, 0x3A, 0x36, 0x1C, 0x16, 0x34, 0x41, 0x6A, 0xFD, 0x3A, 0x1A, 0x3D, 0x75, 0x15,
+  0x39, 0xBD, 0xAC, 0xA8, 0x32, 0xFF, 0xC8, 0x71, 0x15, 0x45, 0x9E, 0xCF, 0xE6, 0xC6, 0x6A, 0x76,
+  0xF7, 0xD8, 0x40, 0xE4, 0x1A, 0x88, 0x15, 0x53, 0xF7, 0xA2, 0xAD, 0x13, 0xBF, 0xBD, 0x76, 0x35,
+  0x62, 0x23, 0xD0, 0x37, 0x77, 0x23, 0x2E, 0x1F, 0x80, 0x13, 0x0F, 0x0C, 0x59, 0xCD, 0x50, 0x89,
+  0x4D, 0x26, 0xA7, 0x76, 0x82, 0x2A, 0xA3, 0x8C, 0xF6, 0xC7, 0x2D, 0x63, 0x7B, 0x8C, 0x48, 0x5F,
+  0xB9, 0x01, 0xAC, 0xFE, 0x94, 0x1C, 0x78, 0x4C, 0x57, 0xA8, 0x19, 0x3D, 0x5E, 0x48, 0xC3, 0x6A,
+  0x1D, 0x06, 0xD9, 0xBD, 0xF0, 0x8B, 0xA1, 0xDD, 0x6F, 0xBB, 0x2E, 0x95, 0x86, 0x32, 0x96, 0xBC,
+  0x37, 0xC7, 0x51, 0x74, 0x46, 0xF0, 0x53, 0x75, 0x30, 0xC9, 0x71, 0xAD, 0xCC, 0xCC, 0x02, 0xDF,
+  0x5B, 0x3F, 0xC1, 0x66, 0x47, 0x84, 0x35, 0xCA, 0x19, 0x05, 0x87, 0xD9, 0x8D, 0xCB, 0x28, 0xF0,
+  0x64, 0x58, 0x11, 0x32, 0x07, 0xE3, 0x0A, 0x9B, 0x25, 0x8B, 0x5B, 0x62, 0xCE, 0x50, 0x46, 0x0C,
+  0x5D, 0xF9, 0x65, 0x0F, 0xDB, 0x2C, 0xA3, 0xDB, 0x36, 0xC6, 0xBA, 0xC3, 0xFE, 0x3C, 0x31, 0xED,
+  0x47, 0x8E, 0x72, 0x31, 0x42, 0x12, 0x13, 0x61, 0x1E, 0xD3, 0x1E, 0x1D, 0x2A, 0xD9, 0x62, 0xDA,
+  0xE5, 0x1E, 0x8F, 0xBC, 0xE2, 0x20, 0x26, 0xCF, 0xB8, 0xE3, 0x49, 0x43, 0x0F, 0xD0, 0x9C, 0xC2,
+  0x96, 0x8F, 0x8A, 0xC9, 0xD4, 0x53, 0xED, 0xF7, 0x61, 0xFC, 0xC1, 0x81, 0x9A, 0x08, 0x6A, 0x0A,
+  0x23, 0xB2, 0x3D, 0x98, 0xDB, 0xCC, 0x00, 0x2D, 0x49, 0x83, 0x67, 0x11, 0x7E, 0x64, 0x35, 0xAE,
+  0xA0, 0x0B, 0xB6, 0x93, 0x84, 0x87, 0xCA, 0x27, 0xB8, 0x2D, 0x4F, 0x94, 0x3C, 0x50, 0xFC, 0xBE,
+  0xF9, 0xB0, 0xBF, 0xF0, 0x6D, 0x12, 0x6F, 0x70, 0xEC, 0x24, 0x64, 0x07, 0x33, 0x50, 0x27, 0x70,
+  0xDC, 0xF9, 0x4E, 0x2C, 0x8C, 0x6A, 0x91, 0x08, 0x9B, 0x64, 0x67, 0x73, 0xE8, 0x9F, 0x70, 0x4D,
+  0xB7, 0x3E, 0xD7, 0x8B, 0xC9, 0x88, 0x5D, 0x0A, 0x8A, 0x8A, 0x21, 0x00, 0x39, 0xC1, 0x86, 0x56,
+  0xCC, 0x1B, 0x7C, 0x39, 0xA9, 0xF9, 0x4D, 0x42, 0xEF, 0x54, 0xE1, 0x3F, 0x15, 0xEA, 0x06, 0xB2,
+  0xC4, 0x21, 0xD8, 0x58, 0x16, 0xBB, 0xD1, 0x61, 0x81, 0x00, 0xE7, 0xD7, 0x73, 0xB5, 0xA1, 0x2B,
+  0x1C, 0xC9, 0x52, 0x7B, 0x40, 0x20, 0x5A, 0x9B, 0xC4, 0x0F, 0x7E, 0xD8, 0x23, 0x77, 0xCB, 0xF6,
+  0x07, 0x8B, 0x4D, 0x36, 0x91, 0x3B, 0x39, 0x2B, 0xFC, 0x3C, 0xE9, 0x53, 0x56, 0x9F, 0x08, 0x75,
+  0xBC, 0x05, 0x2D, 0x76, 0x47, 0xDD, 0x32, 0xA9, 0xDB, 0x44, 0x41, 0x44, 0xD7, 0xB2, 0x4B, 0x21,
+  0xA9, 0x45, 0x8E, 0x5A, 0x37, 0x36, 0x4A, 0x1B, 0x9A, 0x03, 0x28, 0xD9, 0x97, 0x83, 0x60, 0x9D,
+  0x26, 0x64, 0x11, 0x31, 0x18, 0x56, 0x18, 0x46, 0x22, 0xF4, 0x09, 0xBB, 0x49, 0xC1, 0xD9, 0xED,
+  0x28, 0x09, 0xD8, 0x9D, 0x83, 0x41, 0x5E, 0x32, 0x2C, 0x0E, 0x8F, 0x54, 0x07, 0x8D, 0x15, 0x09,
+  0xE5, 0x35, 0x73, 0x18, 0x0E, 0x77, 0x23, 0xD7, 0x14, 0x0F, 0x83, 0x9F, 0x19, 0x92, 0x9D, 0xCC,
+  0x07, 0xF9, 0xF1, 0xDD, 0xA4, 0x0F, 0xF4, 0xC5, 0x66, 0xA8, 0x84, 0x33, 0x06, 0x99, 0xD5, 0x8E,
+  0x7A, 0x5C, 0x27, 0xD1, 0xC3, 0x65, 0x8F, 0x9E, 0x35, 0x89, 0x66, 0xBD, 0x2B, 0x73, 0x61, 0x92,
+  0x83, 0x88, 0xF4, 0xDE, 0x86, 0x5C, 0x98, 0x9C, 0x99, 0x51, 0xB9, 0x3F, 0xED, 0x0C, 0x75, 0xDA,
+  0x34, 0x44, 0xAC, 0x7F, 0x96, 0x11, 0x4B, 0x97, 0x13, 0x36, 0xAA, 0x91, 0xD8, 0xE9, 0x73, 0x37,
+  0xB5, 0x3E, 0xA4, 0xA9, 0xDF, 0x4E, 0xAA, 0x67, 0xF2, 0x4B, 0x51, 0xE0, 0xB8, 0x41, 0xE0, 0x0B,
+  0x49, 0xFA, 0xB1, 0xF7, 0xB9, 0xF9, 0xA6, 0x8C, 0x3C, 0xA6, 0x92, 0xB0, 0x3E, 0xB3, 0x32, 0x7E,
+  0x82, 0x82, 0xF9, 0x22, 0x05, 0x7E, 0x5E, 0xE2, 0xA1, 0x27, 0x69, 0x13, 0xB2, 0x41, 0x2C, 0xF5,
+  0x30, 0xD3, 0x29, 0x98, 0xCD, 0x31, 0xB9, 0x56, 0x7B, 0x98, 0x0D, 0x70, 0x9B, 0xF0, 0x33, 0x73,
+  0x1F, 0x5E, 0x38, 0xAA, 0xF0, 0x28, 0xFE, 0x59, 0xA5, 0x4F, 0x69, 0xB3, 0x9F, 0x86, 0x2D, 0x40,
+  0xD1, 0x7E, 0x1E, 0xF6, 0xEA, 0x6B, 0xC4, 0x47, 0xFA, 0xA2, 0x86, 0x37, 0xC8, 0x56, 0x1E, 0xCB,
+  0x42, 0xB5, 0x83, 0xFC, 0xC4, 0xD1, 0x10, 0x6D, 0x3C, 0xD4, 0xC6, 0xE0, 0xC1, 0x35, 0x4D, 0xA4,
+  0xCF, 0x94, 0xCB, 0x3A, 0x0D, 0xF1, 0xCC, 0xC3, 0x5F, 0x80, 0x19, 0x79, 0x47, 0x59, 0x90, 0x51,
+  0x74, 0x24, 0x6E, 0x21, 0x99, 0xD6, 0x01, 0xEF, 0x1C, 0xE8, 0x13, 0x6C, 0x7E, 0x07, 0xB4, 0x61,
+  0x35, 0x33, 0x9D, 0x74, 0xC8, 0x02, 0x25, 0xE2, 0xC2, 0xAD, 0x67, 0x6B, 0x07, 0x33, 0x41, 0x52,
+  0xE8, 0xD3, 0xE9, 0xC5, 0x54, 0x45, 0xF9, 0x88, 0x4E, 0xC2, 0xEE, 0xF4, 0x83, 0x41, 0xC2, 0x64,
+  0x73, 0x11, 0xCD, 0x68, 0x1E, 0xF6, 0xC2, 0xBC, 0x4F, 0x49, 0x9C, 0x6F, 0xF4, 0x24, 0x70, 0x8B,
+  0x93, 0x73, 0xE2, 0xC9, 0xE6, 0xD4, 0x9D, 0xB0, 0x35, 0xA2, 0x24, 0x05, 0xBD, 0x81, 0x7A, 0x48,
+  0xE4, 0x24, 0x35, 0x1B, 0x02, 0x2A, 0x21, 0xF2, 0xDC, 0x3D, 0x62, 0x68, 0x4C, 0xCF, 0xE2, 0xF2,
+  0x69, 0xA4, 0x55, 0xF3, 0x91, 0xBB, 0x0D, 0x7B, 0x48, 0x4B, 0x40, 0xB3, 0xDA, 0x50, 0x19, 0xD2,
+  0xA6, 0xFA, 0x81, 0x5F, 0xE1, 0xEE, 0x2C, 0x25, 0x87, 0xC1, 0x07, 0xF6, 0x22, 0x18, 0x21, 0x8F,
+  0xF4, 0xA2, 0x1B, 0xDD, 0x29, 0x26, 0x45, 0x55, 0x4C, 0x96, 0xDC, 0x0D, 0xBB, 0x65, 0x2F, 0xBF,
+  0xEB, 0xF3, 0x60, 0xBD, 0xE7, 0x1E, 0x3D, 0x0A, 0x6C, 0xC8, 0x8A, 0xB3, 0x07, 0x4A, 0xE2, 0xB9,
+  0x3D, 0x26, 0x73, 0xC1, 0x8D, 0xB2, 0x3A, 0x5B, 0x3E, 0x1F, 0x69, 0xF1, 0x01, 0x65, 0xB3, 0x91,
+  0x66, 0x1F, 0x50, 0x3E, 0x17, 0x69, 0xFA, 0x81, 0x65, 0x32, 0x91, 0xE6, 0xCF, 0x20, 0xF3, 0xE1,
+  0xC2, 0xE3, 0x26, 0x1C, 0xE1, 0x16, 0x67, 0x7E, 0x09, 0xE7, 0x5A, 0xCD, 0xB3, 0xC6, 0x39, 0xE3,
+  0x32, 0xFF, 0xAB, 0xE7, 0x51, 0x4C, 0x6F, 0x30, 0x5F, 0x84, 0xE9, 0x44, 0xCD, 0x03, 0xC8, 0xBD,
+  0xF7, 0xB0, 0x53, 0xD0, 0xD3, 0x91, 0xB4, 0xCA, 0x1B, 0x60, 0xBA, 0x78, 0x37, 0x32, 0x43, 0xA2,
+  0x4E, 0x7D, 0xF0, 0x02, 0x2D, 0x95, 0xD2, 0xE5, 0x31, 0xDC, 0xA8, 0x13, 0x4E, 0x7C, 0x16, 0x57,
+  0xD9, 0x13, 0xB4, 0x65, 0x40, 0x65, 0xAC, 0x9F, 0xE6, 0x99, 0xED, 0x33, 0xCE, 0xA2, 0xF9, 0x3E,
+  0x5A, 0xD6, 0x37, 0x25, 0x60, 0xDE, 0x63, 0xE9, 0xDA, 0x75, 0x32, 0x23, 0x0A, 0x2E, 0xF7, 0x65,
+  0xE8, 0x5A, 0x61, 0x3E, 0x2D, 0x50, 0xD9, 0x15, 0x1F, 0x5C, 0xC5, 0x2D, 0x41, 0xAD, 0x2F, 0x95,
+  0x46, 0x42, 0x56, 0xB9, 0x0F, 0x5F, 0xA2, 0xB8, 0x74, 0x1A, 0xE5, 0x3E, 0x76, 0x17, 0xB3, 0x32,
+  0x32, 0x43, 0x37, 0xA7, 0x60, 0x89, 0x53, 0x03, 0xF5, 0x47, 0x24, 0x61, 0x9F, 0xB6, 0x8C, 0x4B,
+  0x76, 0xFB, 0x53, 0xEB, 0xF5, 0x88, 0xEB, 0x2A, 0x82, 0xE8, 0x8B, 0xCA, 0x8D, 0x9F, 0x7F, 0xD0,
+  0x43, 0x55, 0xAE, 0x74, 0xE9, 0x79, 0x77, 0xF2, 0xAC, 0xA6, 0x15, 0x76, 0x63, 0x92, 0x69, 0x2D,
+  0xCA, 0x24, 0x37, 0x22, 0x5B, 0xB0, 0x45, 0xB6, 0x6C, 0x72, 0xD0, 0x85, 0x9E, 0x94, 0x8F, 0x3B,
+  0xC5, 0xCA, 0x86, 0xED, 0x4E, 0xCE, 0x50, 0x18, 0xCF, 0x0E, 0x7B, 0x35, 0xC2, 0x29, 0x3F, 0x0C,
+  0x53, 0x0F, 0xB0, 0x86, 0x04, 0xBC, 0x73, 0x2F, 0x68, 0x4F, 0xB4, 0x71, 0x15, 0x16, 0x2E, 0x63,
+  0x52, 0x9F, 0x9F, 0xAC, 0x4B, 0xB7, 0x1E, 0xF1, 0x3C, 0x93, 0x51, 0x36, 0xA1, 0x93, 0x99, 0xD9,
+  0xBA, 0x9B, 0x55, 0x17, 0x16, 0x9D, 0x9A, 0x95, 0x4B, 0x88, 0x98, 0x53, 0xB4, 0xCA, 0x49, 0x8D,
+  0xA3, 0x86, 0x40, 0xE3, 0x00, 0x38, 0x67, 0x90, 0x5F, 0xD5, 0x69, 0xB3, 0xDD, 0x6C, 0x93, 0x06,
+  0xF6, 0x1F, 0x20, 0xCB, 0x87, 0xD9, 0xEE, 0x2F, 0x1A, 0x66, 0xA3, 0x89, 0x28, 0x5D, 0x0B, 0xB6,
+  0x09, 0x1B, 0xD1, 0x87, 0x1A, 0xCB, 0xEA, 0xAF, 0xAE, 0xC1, 0xB8, 0xE2, 0x60, 0x64, 0xF2, 0xAD,
+  0x39, 0x6D, 0x4E, 0xA3, 0x5C, 0xFE, 0xC2, 0x82, 0x36, 0x96, 0x27, 0xAC, 0xF1, 0x0D, 0x29, 0xA9,
+  0xEB, 0x49, 0xEB, 0x4E, 0x41, 0x2D, 0x0A, 0x4D, 0x0C, 0x7A, 0x1A, 0x2A, 0xC6, 0x10, 0xE7, 0x66,
+  0x06, 0x8D, 0x3D, 0x82, 0x73, 0x8A, 0xB2, 0xD9, 0x80, 0xAD, 0x1B, 0xC2, 0xB2, 0xD2, 0x52, 0xA9,
+  0xE7, 0x91, 0xF1, 0x00, 0x0D, 0xDB, 0xF2, 0x91, 0x61, 0x6D, 0xAA, 0xCD, 0x13, 0x37, 0x5F, 0x7B,
+  0xAC, 0x39, 0x4D, 0x49, 0xD6, 0x74, 0xE8, 0x3A, 0x33, 0x62, 0x81, 0x7B, 0xA6, 0xD9, 0xBC, 0x40,
+  0x5D, 0x59, 0x76, 0x70, 0xAD, 0xB2, 0x60, 0xA7, 0xE1, 0x32, 0x74, 0xCD, 0xBB, 0x48, 0x5C, 0x99,
+  0xA9, 0x03, 0xBE, 0x09, 0xDC, 0xC9, 0xA8, 0xC3, 0x6B, 0x23, 0x39, 0x76, 0xD8, 0xFD, 0x35, 0xCE,
+  0xD2, 0x27, 0x28, 0x90, 0x38, 0xE9, 0xE4, 0xDE, 0x91, 0x08, 0xE4, 0x52, 0xC7, 0xBA, 0x51, 0xE0,
+  0xC8, 0x99, 0x09, 0x5D, 0x88, 0xB3, 0xBD, 0x88, 0xA6, 0xC1, 0x1B, 0xC1, 0x18, 0xF3, 0xF3, 0xF6,
+  0x81, 0x5B, 0x19, 0xDB, 0xA4, 0x13, 0x62, 0xF5, 0xFA, 0xFD, 0x3B, 0x8C, 0x95, 0xA5, 0x01, 0x3E,
+  0x5D, 0xCF, 0x03, 0x54, 0x33, 0xE5, 0x14, 0x7C, 0x75, 0x5A, 0xFA, 0x2E, 0x83, 0xE6, 0x54, 0xEA,
+  0x7D, 0x6B, 0x65, 0x84, 0x0B, 0xB8, 0x71, 0xA1, 0x68, 0x1F, 0x65, 0x33, 0xBC, 0xCE, 0x1A, 0x27,
+  0xCD, 0xBD, 0x2F, 0xB6, 0xD6, 0x8D, 0xC0, 0x06, 0x7A, 0xA1, 0x7D, 0x78, 0x49, 0x81, 0x33, 0xAA,
+  0x56, 0x75, 0xC7, 0xEC, 0xE0, 0x1A, 0x42, 0xB0, 0x91, 0xA8, 0x24, 0x7B, 0xB2, 0x6A, 0x82, 0x4A,
+  0x30, 0x6E, 0xA9, 0xB4, 0xC2, 0xAA, 0x86, 0x3D, 0x05, 0x86, 0xC4, 0xA1, 0x3B, 0xC2, 0x8E, 0xA7,
+  0x96, 0x30, 0x89, 0x45, 0x7C, 0xD2, 0xFF, 0xAA, 0x63, 0xA7, 0x35, 0xFC, 0xA0, 0xFB, 0x30, 0xE3,
+  0x1C, 0x3B, 0xC2, 0xC4, 0x07, 0xA0, 0x5A, 0x8E, 0x0E, 0xB9, 0x50, 0x7D, 0x03, 0x75, 0xC2, 0x94,
+  0x32, 0x4A, 0x0D, 0xD8, 0xAF, 0x3A, 0xA4, 0xC4, 0x39, 0x6A, 0x68, 0x98, 0xE0, 0xEC, 0x64, 0x27,
+  0xD6, 0x79, 0x81, 0x73, 0x6A, 0x4C, 0x7E, 0x07, 0xF7, 0xA3, 0xD1, 0x60, 0x74, 0x02, 0x19, 0xE7,
+  0x0D, 0x03, 0x1D, 0x20, 0x28, 0xBC, 0xC1, 0xDE, 0x7F, 0x95, 0xDE, 0x46, 0x10, 0x36, 0x68, 0x7C,
+  0xD4, 0x90, 0x74, 0x69, 0x79, 0xD4, 0x60, 0x86, 0xE3, 0x11, 0x6B, 0xD2, 0x22, 0xD7, 0x5B, 0x08,
+  0x62, 0x77, 0xB0, 0x46, 0xFC, 0xCC, 0x3C, 0xB6, 0xD3, 0x70, 0x83, 0x4E, 0xEA, 0x26, 0x75, 0xCB,
+  0xB2, 0xD4, 0xC3, 0x16, 0x6F, 0x3D, 0x66, 0x90, 0x8B, 0x75, 0xFD, 0xE9, 0x0C, 0x04, 0xC7, 0x0D,
+  0x19, 0x44, 0xD4, 0x70, 0x56, 0x33, 0x93, 0xF7, 0x9F, 0x56, 0x57, 0xA5, 0xDF, 0x19, 0xBB, 0x4B,
+  0x4C, 0xEE, 0x1C, 0x76, 0x22, 0x87, 0xB6, 0xAF, 0x90, 0xA4, 0x0A, 0xB5, 0xD4, 0xA7, 0x00, 0x3A,
+  0x5C, 0x95, 0x94, 0x82, 0x46, 0x2D, 0x2B, 0x96, 0xBD, 0x12, 0xB2, 0x28, 0xDF, 0x88, 0x80, 0x71,
+  0x6E, 0x4D, 0x48, 0xEE, 0xFF, 0x26, 0xCE, 0x38, 0x64, 0xF5, 0xFE, 0x98, 0x6F, 0x66, 0xEB, 0x0C,
+  0x77, 0xEF, 0x87, 0xFD, 0x3E, 0xEB, 0x6E, 0x91, 0x51, 0xD0, 0xF7, 0x37, 0x39, 0xBC, 0xE1, 0xCC,
+  0x05, 0x09, 0xF9, 0x3D, 0x7F, 0xC3, 0xCE, 0xC9, 0x05, 0x2D, 0x29, 0xDF, 0xF4, 0x51, 0xE2, 0xA9,
+  0xAF, 0x20, 0x80, 0xD1, 0x89, 0x51, 0xAC, 0xCC, 0x37, 0xAD, 0xFB, 0x0E, 0xE6, 0x98, 0x22, 0x51,
+  0xE4, 0x9B, 0x59, 0x3E, 0xAC, 0xC7, 0xE9, 0xE5, 0x64, 0xC4, 0x09, 0x68, 0xF7, 0x27, 0xB7, 0xDC,
+  0x6F, 0xF8, 0x5B, 0x4A, 0xBA, 0xFB, 0x42, 0x0B, 0x43, 0x81, 0x30, 0xDF, 0xE6, 0x76, 0xDB, 0xED,
+  0x43, 0xFF, 0xA2, 0xFB, 0x58, 0x7F, 0x13, 0xA2, 0xC2, 0xCA, 0x93, 0x8A, 0x80, 0x23, 0xD6, 0xEF,
+  0x67, 0x14, 0xC7, 0x84, 0x6D, 0x3B, 0x21, 0x69, 0x47, 0xCD, 0x6D, 0x26, 0x3E, 0x32, 0xA5, 0x4C,
+  0x0B, 0x16, 0x61, 0x3C, 0x3C, 0x22, 0x9A, 0xB6, 0x0C, 0x53, 0xC3, 0xA3, 0xB8, 0x12, 0x8A, 0xB2,
+  0x79, 0xB3, 0x5B, 0x46, 0xFC, 0x2D, 0xF7, 0x09, 0xE0, 0x4D, 0xD5, 0x6F, 0xDB, 0xB2, 0xCD, 0x08,
+  0xB0, 0xD5, 0x07, 0x2C, 0x80, 0x47, 0x60, 0x54, 0x54, 0x26, 0x85, 0xC3, 0x6F, 0xC8, 0x3E, 0x67,
+  0xEF, 0xB3, 0xFA, 0x68, 0xF2, 0xFB, 0xDC, 0x20, 0xAB, 0x1C, 0x65, 0xF7, 0x1F, 0x19, 0x39, 0x80,
+  0xBE, 0xA9, 0x8B, 0xB2, 0x99, 0xC6, 0xA1, 0x9F, 0x0B, 0x65, 0x96, 0x7F, 0xD3, 0xD3, 0x19, 0x2A,
+  0x7A, 0x53, 0xB2, 0x43, 0x77, 0xA6, 0x9E, 0x98, 0xAC, 0xCA, 0x79, 0xBE, 0x33, 0xDB, 0xD9, 0x55,
+  0xB0, 0x33, 0x57, 0xC4, 0x8C, 0x5C, 0x08, 0xE8, 0xC1, 0x27, 0x38, 0xBF, 0xCD, 0x8C, 0xB2, 0xD9,
+  0xDF, 0xB1, 0x4D, 0x10, 0x82, 0x32, 0x50, 0xFE, 0xC0, 0xF1, 0xAE, 0x87, 0x65, 0x14, 0x13, 0x39,
+  0x31, 0xC6, 0xF6, 0x84, 0xB4, 0x7D, 0x46, 0x88, 0x5B, 0xDA, 0x1E, 0xCE, 0xA3, 0xB1, 0x4F, 0xF0,
+  0x03, 0x2D, 0xA6, 0xE3, 0xAF, 0x3A, 0x01, 0x77, 0xDD, 0xA6, 0xE1, 0x0E, 0x1E, 0xC0, 0xF7, 0x04,
+  0xE1, 0x53, 0xBC, 0xEA, 0xFD, 0x50, 0xF9, 0x1C, 0xA7, 0x4F, 0x3F, 0xB8, 0x4A, 0xBD, 0x9A, 0xFE,
+  0x6B, 0xF3, 0xA3, 0x42, 0xA7, 0x04, 0xD2, 0xFF, 0x32, 0xF9, 0x50, 0x43, 0x72, 0x95, 0x35, 0xF7,
+  0x87, 0x11, 0x67, 0x53, 0x74, 0x95, 0x2D, 0x7B, 0xB8, 0x66, 0x85, 0x24, 0xCE, 0x33, 0x2E, 0x0B,
+  0x69, 0xD4, 0xEC, 0xF7, 0x79, 0x8B, 0x53, 0xFE, 0x04, 0xBD, 0x30, 0x37, 0x15, 0x84, 0x9E, 0x37,
+  0x8F, 0x92, 0x0B, 0x67, 0x31, 0x4A, 0x48, 0x89, 0x7B, 0x23, 0xD7, 0x91, 0xE5, 0x68, 0x38, 0xA8,
+  0xD6, 0xE6, 0x55, 0xC3, 0x2A, 0x0B, 0x3A, 0xCF, 0x62, 0xDB, 0xA7, 0x57, 0x6B, 0x07, 0x3D, 0x09,
+  0x28, 0xC0, 0x94, 0x49, 0x1D, 0x98, 0x90, 0xEE, 0xA8, 0xC3, 0xCD, 0x1A, 0x92, 0x38, 0x6B, 0xEF,
+  0x9B, 0xFE, 0x0F, 0xEB, 0x9B, 0x4C, 0x29, 0xC4, 0x04, 0x18, 0x93, 0xFB, 0xA3, 0xF0, 0xC0, 0x8C,
+  0x69, 0x99, 0x31, 0xC4, 0x0A, 0xFD, 0xE3, 0x0B, 0xF7, 0xA6, 0x49, 0xB0, 0x21, 0x30, 0xB4, 0x2C,
+  0x32, 0x99, 0xC2, 0x42, 0x12, 0x35, 0xB6, 0xE3, 0x9B, 0x99, 0x6C, 0xC9, 0x14, 0x57, 0xBD, 0x31,
+  0x70, 0x0F, 0x1B, 0xD6, 0x95, 0x87, 0xAC, 0x18, 0xA1, 0x37, 0xE9, 0xFA, 0x66, 0x49, 0xDD, 0xA2,
+  0x4E, 0xA0, 0x6C, 0x9A, 0x3A, 0x12, 0x67, 0x9D, 0x4F, 0xF6, 0xFB, 0x9C, 0xF7, 0x53, 0xE2, 0xDA,
+  0x4A, 0x0F, 0x47, 0xEF, 0xF4, 0x2E, 0xEE, 0x28, 0x31, 0x37, 0x5B, 0x3E, 0xE2, 0xDC, 0x41, 0x62,
+  0xA1, 0x80, 0x38, 0x7B, 0x8C, 0x18, 0x39, 0x5A, 0x3D, 0xF1, 0xF8, 0x10, 0x31, 0xF2, 0x8E, 0xEA,
+  0x0C, 0xC5, 0x0A, 0xA3, 0x31, 0xF9, 0x08, 0x74, 0xEB, 0xF1, 0x68, 0x0F, 0x38, 0xAC, 0xB9, 0x85,
+  0x8B, 0x46, 0xC6, 0x3A, 0xC0, 0xB4, 0x53, 0x39, 0x69, 0xD6, 0x36, 0xE0, 0x85, 0xDE, 0x90, 0x06,
+  0xF6, 0x15, 0x57, 0x09, 0x79, 0x93, 0xDA, 0xDD, 0xD3, 0x00, 0x4F, 0x5D, 0x4A, 0x48, 0xA3, 0x6D,
+  0x10, 0x2C, 0x1B, 0xD3, 0xD1, 0x9A, 0x06, 0xC0, 0x71, 0x61, 0x21, 0xB9, 0x53, 0xF7, 0x42, 0x75,
+  0x36, 0xB1, 0x3A, 0x5C, 0x40, 0x8B, 0x74, 0x87, 0xEA, 0x93, 0xC2, 0x1E, 0x61, 0x14, 0x98, 0xC3,
+  0xC6, 0x73, 0xB8, 0xEF, 0x31, 0x12, 0x8D, 0xD9, 0x36, 0xE0, 0x63, 0xB2, 0x32, 0xD2, 0xA7, 0xF4,
+  0xD0, 0x2F, 0x20, 0x26, 0x97, 0x09, 0x73, 0xDB, 0x7A, 0xEC, 0xBC, 0x61, 0xFF, 0xD8, 0x43, 0xFB,
+  0x4C, 0x71, 0xAA, 0x54, 0x11, 0x3E, 0x91, 0xD0, 0x5D, 0x96, 0x5C, 0xAF, 0x76, 0x8A, 0x9B, 0x5C,
+  0xC9, 0x5D, 0xD1, 0x92, 0xA3, 0xC2, 0x67, 0x74, 0xE6, 0x3B, 0x62, 0xA7, 0x19, 0x9C, 0x82, 0xBC,
+  0x20, 0x68, 0x7A, 0x63, 0xC6, 0x58, 0xBE, 0x57, 0x15, 0x53, 0xEE, 0x4C, 0xB8, 0x72, 0x63, 0x5B,
+  0x0D, 0xCD, 0x44, 0xF6, 0x3E, 0x9F, 0x6C, 0x35, 0x8E, 0x0B, 0x0F, 0x33, 0xBB, 0x68, 0x8D, 0xAD,
+  0x22, 0xF1, 0xE1, 0x03, 0x06, 0x63, 0x51, 0x63, 0x8A, 0x44, 0xF7, 0x41, 0xE8, 0xC1, 0x41, 0xD1,
+  0x7F, 0x58, 0x4D, 0xDF, 0xE6, 0xED, 0x7E, 0x7F, 0xD1, 0x0D, 0x1C, 0xD7, 0x69, 0xEB, 0xAA, 0xFB,
+  0x1D, 0x0B, 0xDB, 0x11, 0xAD, 0xC6, 0x58, 0x0B, 0x51, 0xD2, 0x44, 0x6B, 0x44, 0x34, 0xBC, 0x44,
+  0x93, 0x27, 0x93, 0x05, 0x46, 0xA8, 0x70, 0x4E, 0x28, 0x30, 0xC8, 0x8A, 0x79, 0xD0, 0x75, 0x34,
+  0x4E, 0x84, 0x4F, 0x04, 0xD0, 0x69, 0x92, 0x02, 0x87, 0x0C, 0xF3, 0x86, 0x03, 0x8E, 0xDB, 0xFD,
+  0x29, 0x13, 0xEE, 0x9F, 0x25, 0x01, 0x72, 0x81, 0xB3, 0x65, 0x4C, 0xB1, 0xB7, 0xBD, 0x3C, 0x0A,
+  0x2E, 0x18, 0x87, 0x7C, 0x85, 0x7B, 0x09, 0x63, 0x8D, 0x23, 0x57, 0x8A, 0x93, 0x3D, 0x8E, 0x07,
+  0xCB, 0x74, 0x64, 0xC6, 0xB4, 0xD0, 0xA4, 0xBB, 0x2D, 0x37, 0x93, 0xBC, 0x62, 0x87, 0x39, 0x32,
+  0x8F, 0xF6, 0x46, 0x2A, 0xC3, 0x39, 0xE1, 0x13, 0xF7, 0x5D, 0x43, 0x23, 0x3B, 0xEC, 0x99, 0x57,
+  0xB9, 0x52, 0x0F, 0x7A, 0xC2, 0xA6, 0x35, 0x37, 0x36, 0xE5, 0x54, 0xAF, 0x58, 0x5B, 0x14, 0xBB,
+  0xA7, 0x2C, 0x12, 0xAA, 0x0C, 0x0B, 0xD2, 0xC0, 0xF6, 0xF6, 0x1C, 0x73, 0x7C, 0xF6, 0x8F, 0x0C,
+  0x5D, 0x1D, 0x59, 0xC8, 0x4C, 0xAA, 0xF8, 0x30, 0xB4, 0xCA, 0x83, 0xB8, 0x73, 0x88, 0x22, 0x72,
+  0x27, 0xDC, 0x29, 0x76, 0x76, 0x3A, 0x20, 0x92, 0x0D, 0xDB, 0xCC, 0x92, 0x8F, 0x3C, 0x7B, 0x66,
+  0x16, 0x79, 0x51, 0x6D, 0xEC, 0x5C, 0x63, 0xAF, 0xBF, 0x3C, 0xF2, 0xCB, 0xCA, 0x1D, 0xB6, 0xED,
+  0x46, 0x1C, 0x13, 0x96, 0x10, 0x52, 0x2E, 0x88, 0x0D, 0x78, 0xA5, 0x6E, 0xCB, 0x7D, 0xEE, 0x45,
+  0x96, 0x68, 0xC7, 0x2D, 0x0B, 0x36, 0x83, 0x91, 0xE6, 0x07, 0xA7, 0x36, 0x4B, 0x6A, 0xD7, 0x50,
+  0xEF, 0x5C, 0xD2, 0xD6, 0xB8, 0x74, 0x95, 0xF9, 0x8E, 0xD5, 0xE2, 0x7B, 0x69, 0xBF, 0xAF, 0xD0,
+  0x63, 0x35, 0x21, 0x0D, 0x47, 0xAF, 0x2B, 0x26, 0x9A, 0x91, 0x04, 0xA3, 0x1B, 0xC1, 0xF6, 0x83,
+  0x86, 0xA8, 0x06, 0xC6, 0x19, 0x91, 0x7B, 0x97, 0xD9, 0x03, 0xE1, 0x54, 0x66, 0x89, 0x93, 0x2C,
+  0x0C, 0x71, 0x0D, 0x18, 0x43, 0x52, 0x48, 0x1E, 0x78, 0x3B, 0xC5, 0x95, 0x88, 0xB2, 0x02, 0x78,
+  0xE4, 0x45, 0xE0, 0x54, 0x41, 0x6E, 0xA6, 0x7C, 0x44, 0xB9, 0x15, 0x3E, 0xA9, 0x7C, 0x9C, 0x4B,
+  0x06, 0x9C, 0x25, 0xF5, 0x07, 0x8C, 0x7D, 0xA2, 0xAB, 0xBD, 0x61, 0x65, 0x92, 0x82, 0x66, 0xC2,
+  0x7D, 0x39, 0x8E, 0x6B, 0x2F, 0xDD, 0xFD, 0x69, 0xB1, 0x67, 0x96, 0xC8, 0x79, 0xC1, 0x1A, 0x29,
+  0x72, 0x22, 0xE9, 0xB5, 0xE9, 0xBE, 0x70, 0x48, 0x51, 0xB0, 0x54, 0xAF, 0x17, 0x3D, 0xB1, 0xC7,
+  0xCC, 0x45, 0xEE, 0xFB, 0xD6, 0x61, 0xC1, 0x99, 0x70, 0xF3, 0x76, 0x67, 0x66, 0x6C, 0xE1, 0xF7,
+  0x81, 0x57, 0x2E, 0x25, 0x94, 0x49, 0xBC, 0x5F, 0x8F, 0xD6, 0xF0, 0x05, 0x47, 0x14, 0xD5, 0xC0,
+  0x3A, 0x63, 0xE1, 0x95, 0x12, 0xCF, 0x0F, 0x82, 0x4B, 0x3D, 0x92, 0x90, 0xB3, 0xFB, 0x20, 0x61,
+  0xD2, 0xFF, 0x3C, 0x72, 0xF7, 0x97, 0x8B, 0x9E, 0xDE, 0x82, 0x8B, 0xC2, 0xF1, 0x5F, 0x39, 0x1D,
+  0xF3, 0x31, 0xC8, 0x95, 0xF9, 0x22, 0x4A, 0xE6, 0x60, 0xBD, 0xC5, 0x38, 0x17, 0xA2, 0x88, 0x92,
+  0x34, 0x0E, 0xAA, 0xAF, 0x3A, 0x2C, 0x91, 0xDD, 0x1B, 0x8B, 0xD9, 0xA5, 0xA6, 0x14, 0x8A, 0x62,
+  0xEF, 0x33, 0xFA, 0x52, 0x0A, 0x15, 0x18, 0xF4, 0xF2, 0x42, 0x6D, 0x20, 0x1D, 0x24, 0xE7, 0x57,
+  0x81, 0xAD, 0xA4, 0xF8, 0x1F, 0x46, 0x28, 0x72, 0x90, 0xAF, 0xDC, 0x30, 0x97, 0xF0, 0xF6, 0xBD,
+  0x9D, 0x87, 0x75, 0xB1, 0xC9, 0x0A, 0xF5, 0x80, 0xA7, 0x47, 0x9A, 0x07, 0x6E, 0xC7, 0x17, 0xB2,
+  0x0A, 0x9C, 0x98, 0x32, 0xBA, 0xDD, 0x39, 0xB3, 0x81, 0x62, 0xC9, 0x7B, 0x3D, 0xEA, 0x7A, 0xD1,
+  0xA3, 0x99, 0xDB, 0x6F, 0x39, 0xE0, 0xA0, 0x65, 0xE3, 0xDE, 0x07, 0x74, 0x33, 0xE8, 0x37, 0x6B,
+  0xE5, 0x1C, 0xD4, 0x9B, 0x82, 0x16, 0x8B, 0x04, 0x80, 0x2F, 0x34, 0x65, 0xE4, 0xF8, 0xA1, 0xCD,
+  0xCE, 0xA9, 0x86, 0x9B, 0x99, 0x9C, 0x8C, 0x68, 0xBA, 0x6B, 0x5E, 0xC6, 0xEF, 0xD0, 0xAA, 0x08,
+  0xED, 0x2E, 0x39, 0xED, 0x79, 0xEC, 0xD6, 0x9C, 0xD9, 0x95, 0xC6, 0x34, 0x27, 0x59, 0x06, 0xC6,
+  0x7A, 0x46, 0xA4, 0x69, 0x33, 0x04, 0x4E, 0x68, 0x42, 0x5A, 0x7A, 0x3D, 0x2E, 0x6A, 0xB0, 0x93,
+  0x1B, 0x33, 0xEA, 0x62, 0x9A, 0x2A, 0xCD, 0x6C, 0x03, 0x5F, 0x55, 0xD2, 0xB0, 0xD4, 0x33, 0x74,
+  0x41, 0x20, 0xD1, 0x47, 0x33, 0x91, 0x1E, 0x05, 0x05, 0x66, 0xE8, 0x75, 0x61, 0xED, 0x7A, 0xF7,
+  0xAF, 0x19, 0xCD, 0xEE, 0x38, 0x85, 0x5D, 0xAE, 0xD8, 0x01, 0xCE, 0xAD, 0x36, 0x22, 0xE5, 0x92,
+  0x85, 0xA0, 0x8B, 0x00, 0xB9, 0x53, 0x8C, 0xC2, 0xBA, 0xD9, 0x71, 0x27, 0xA8, 0x45, 0x6D, 0xED,
+  0x63, 0x56, 0x9A, 0x65, 0xF6, 0x63, 0x82, 0xB8, 0x4E, 0x2E, 0x38, 0x3E, 0x8B, 0x0E, 0x7E, 0x30,
+  0x48, 0x0B, 0xE7, 0xAA, 0x84, 0xAC, 0xA2, 0x23, 0xE7, 0x89, 0x9F, 0x52, 0x97, 0xDF, 0xE6, 0x29,
+  0x1B, 0x56, 0x80, 0xE5, 0xC6, 0xFD, 0x41, 0x06, 0xB3, 0x49, 0xF0, 0xA1, 0x9A, 0x29, 0x27, 0x68,
+  0x12, 0xF5, 0xC9, 0xCC, 0x8E, 0xDC, 0xD1, 0x7E, 0x24, 0x53, 0x58, 0x90, 0x4B, 0x5C, 0x17, 0x35,
+  0x3B, 0xC4, 0x38, 0xF7, 0x64, 0x94, 0xDD, 0xDD, 0xE6, 0x01, 0x63, 0xF7, 0x1F, 0xAE, 0xF5, 0xE7,
+  0x45, 0xB4, 0xC2, 0xEA, 0x12, 0xD4, 0x8C, 0xC7, 0x8E, 0x47, 0xE2, 0x54, 0x43, 0xAE, 0x49, 0x96,
+  0x09, 0x27, 0xA5, 0x4A, 0x28, 0x29, 0xD5, 0x28, 0xF0, 0xB2, 0x18, 0xA6, 0xB5, 0x07, 0xBC, 0x88,
+  0x32, 0x2B, 0x5D, 0x61, 0xA0, 0x9E, 0xAE, 0x72, 0x5F, 0xCE, 0x1D, 0xAA, 0x43, 0x7E, 0x4D, 0x9C,
+  0x77, 0x6A, 0x4E, 0x3A, 0x4C, 0x46, 0x89, 0x47, 0xAA, 0x29, 0x9B, 0x24, 0x89, 0x11, 0xC4, 0xC8,
+  0x47, 0xD9, 0x22, 0xAD, 0x18, 0x6A, 0xB8, 0xDB, 0x12, 0xFB, 0x6B, 0xCC, 0x5A, 0x07, 0x3D, 0x67,
+  0x44, 0xB3, 0x23, 0x2F, 0x04, 0xEF, 0xCA, 0x51, 0xB5, 0x62, 0x85, 0x43, 0xB2, 0x49, 0xDC, 0xA9,
+  0x69, 0xE5, 0x86, 0x97, 0x74, 0xDC, 0x70, 0xB5, 0x79, 0x3A, 0x04, 0x5C, 0x64, 0x8B, 0xBD, 0x1A,
+  0xF4, 0xB8, 0x25, 0xF4, 0xB0, 0x61, 0xF4, 0x50, 0x47, 0x57, 0x3E, 0x80, 0xF6, 0xE8, 0x2A, 0x18,
+  0x70, 0x5D, 0xBB, 0x17, 0xDB, 0x2C, 0x39, 0x8C, 0xC4, 0x53, 0xD2, 0x99, 0x4E, 0x06, 0xA9, 0xAE,
+  0x0B, 0xB4, 0x0A, 0x95, 0xEE, 0x4B, 0xA7, 0x1A, 0xCF, 0x7C, 0xF1, 0x21, 0x7B, 0x40, 0xB0, 0x3D,
+  0x2B, 0x23, 0x8D, 0x95, 0xA1, 0x14, 0xB7, 0x19, 0x4B, 0xC8, 0x75, 0xCD, 0x40, 0xB3, 0xCD, 0xD6,
+  0xCD, 0x1C, 0x1D, 0x5B, 0xD0, 0xC6, 0x64, 0x3C, 0x89, 0xCA, 0x46, 0x87, 0xE1, 0x44, 0x64, 0x09,
+  0xED, 0x56, 0xCD, 0x46, 0xD1, 0x2C, 0x42, 0xEF, 0x41, 0x3B, 0x89, 0x5E, 0x5A, 0xB9, 0x0B, 0xC2,
+  0xF5, 0x23, 0x6C, 0xFB, 0x48, 0x33, 0xE1, 0xA4, 0x16, 0x14, 0x76, 0xCC, 0xED, 0x80, 0x43, 0x57,
+  0x27, 0x2F, 0x36, 0xBF, 0x25, 0x2D, 0xA3, 0xAF, 0xF7, 0xB1, 0x89, 0x9B, 0xA2, 0x6E, 0x18, 0x1F,
+  0xF7, 0x58, 0x7E, 0xE4, 0xD8, 0x57, 0x57, 0x3E, 0x7B, 0xB6, 0xC7, 0x0D, 0xE0, 0xB8, 0xBF, 0xD0,
+  0x71, 0x8B, 0x66, 0xB3, 0x6D, 0x94, 0x6E, 0x94, 0x9F, 0x60, 0xAA, 0x70, 0xF2, 0xC0, 0x1E, 0x95,
+  0x6C, 0xCC, 0x1F, 0x8C, 0xBB, 0xBB, 0x1B, 0x2C, 0x8E, 0xE2, 0x42, 0x41, 0x49, 0x66, 0xF5, 0x48,
+  0xEC, 0x75, 0x9C, 0xD2, 0xF1, 0xD2, 0x1E, 0x39, 0x42, 0x63, 0xAA, 0xF8, 0x50, 0xC4, 0x17, 0xFE,
+  0x2B, 0x91, 0x2B, 0xE9, 0xF1, 0x78, 0xB5, 0x87, 0xC7, 0x43, 0x07, 0x4A, 0x12, 0x8B, 0x47, 0xC6,
+  0x0B, 0x21, 0x25, 0xE3, 0xFD, 0xB8, 0xED, 0x5A, 0x24, 0xB6, 0xDF, 0x90, 0xE8, 0xE2, 0xA0, 0x00,
+  0x8A, 0x9F, 0xA4, 0xEC, 0xD8, 0xB1, 0x17, 0x01, 0x74, 0xAE, 0x60, 0xDF, 0xBF, 0x0B, 0xF6, 0x10,
+  0xD9, 0x92, 0x8E, 0xB4, 0x33, 0xCB, 0xB5, 0xCD, 0x6E, 0xDB, 0xDA, 0x34, 0x2A, 0x33, 0xD6, 0x0B,
+  0xE5, 0xE4, 0xBD, 0xC5, 0x2D, 0xED, 0x21, 0xA5, 0x81, 0xD9, 0x00, 0x3B, 0xC1, 0xA9, 0x33, 0xA3,
+  0xBB, 0xF4, 0x9F, 0x64, 0xA5, 0x68, 0x23, 0x5F, 0x32, 0x09, 0x63, 0xDC, 0xF2, 0xB4, 0xA1, 0xBC,
+  0x93, 0xF5, 0xC1, 0x61, 0xD0, 0x87, 0xC2, 0x4D, 0xF9, 0x9D, 0x3D, 0x59, 0x9C, 0xCD, 0x43, 0x4A,
+  0xA9, 0x13, 0x2D, 0xC6, 0x1F, 0x87, 0x96, 0x34, 0xAE, 0xFC, 0xF8, 0xEC, 0x59, 0xF2, 0x95, 0x67,
+  0x82, 0x26, 0x9D, 0x15, 0x66, 0x0B, 0x82, 0x7C, 0xA1, 0x48, 0xCA, 0x3C, 0xEC, 0x45, 0x00, 0x12,
+  0xF5, 0x54, 0xDD, 0x30, 0x47, 0x2F, 0xC5, 0x6E, 0xA9, 0xD0, 0x50, 0x65, 0x92, 0xD3, 0x7E, 0xCC,
+  0xDE, 0x87, 0xDA, 0xF3, 0xDC, 0x49, 0x77, 0xD0, 0x2F, 0x2F, 0xDE, 0xCB, 0xA0, 0x03, 0xEB, 0xB4,
+  0x0C, 0x5D, 0xB9, 0xC8, 0x0F, 0xCD, 0x40, 0xB0, 0x83, 0xD1, 0x36, 0xD4, 0x0A, 0x60, 0x93, 0x80,
+  0xBA, 0xE6, 0x84, 0x14, 0xC5, 0xA3, 0x3D, 0xAD, 0x94, 0xCF, 0x19, 0x48, 0xED, 0x68, 0x73, 0x1C,
+  0x99, 0x6E, 0x0D, 0x0D, 0xF3, 0x6E, 0x82, 0x9F, 0x60, 0x9F, 0xC9, 0xDD, 0xB2, 0x68, 0xEE, 0x6F,
+  0x81, 0x4C, 0x4C, 0x30, 0x48, 0xEE, 0xC6, 0xF8, 0x3F, 0x48, 0x93, 0x54, 0x45, 0x1F, 0x39, 0xB3,
+  0xFE, 0x2D, 0x58, 0x09, 0x93, 0x92, 0x3E, 0x0C, 0xE0, 0x9C, 0x83, 0x25, 0x29, 0x78, 0xB8, 0xFC,
+  0x42, 0x21, 0x79, 0xAE, 0x8C, 0x93, 0xAE, 0x65, 0x63, 0xC6, 0x1C, 0x9E, 0xB4, 0x0A, 0x47, 0x35,
+  0xAB, 0xD9, 0x12, 0x9F, 0x70, 0x0C, 0x5E, 0x4C, 0x71, 0x91, 0x86, 0xDB, 0xB6, 0xCE, 0x36, 0x39,
+  0x38, 0x76, 0x1D, 0xCC, 0x28, 0xC7, 0xA7, 0x4D, 0xED, 0xF0, 0x2A, 0xC8, 0x8B, 0xF6, 0x83, 0x1B,
+  0x37, 0x6B, 0x64, 0x8F, 0x93, 0x2E, 0xEF, 0xC1, 0xC8, 0xE5, 0xAA, 0x49, 0xC8, 0x32, 0x3F, 0xAE,
+  0xDF, 0xBF, 0xDB, 0x68, 0x63, 0x25, 0x6B, 0x7C, 0xF8, 0x10, 0xF5, 0xDB, 0xEB, 0x72, 0xC2, 0x63,
+  0x9D, 0x72, 0x30, 0xFC, 0xF6, 0x1B, 0xDC, 0x5A, 0xDC, 0x2B, 0xFC, 0x37, 0xEE, 0x90, 0xC8, 0x90,
+  0xEC, 0x53, 0xBF, 0xAD, 0x66, 0xC2, 0xE6, 0xF2, 0x4D, 0x96, 0x8F, 0xCC, 0xAB, 0x39, 0xC1, 0x3D,
+  0x4E, 0x35, 0x8D, 0xC2, 0x87, 0x16, 0xA4, 0x99, 0x7B, 0x9E, 0x1A, 0xE6, 0x5A, 0x40, 0x39, 0x2C,
+  0xDD, 0x9F, 0x84, 0xB3, 0xE5, 0xC5, 0x64, 0xE8, 0x35, 0xC0, 0xC2, 0x1F, 0x9D, 0x47, 0xFE, 0xEC,
+  0x37, 0x8A, 0x3D, 0xA3, 0x85, 0xDC, 0x0B, 0x7F, 0x5B, 0x27, 0xAC, 0xB5, 0xA0, 0x3E, 0x37, 0x51,
+  0x6F, 0x82, 0x66, 0x35, 0x82, 0xEC, 0x41, 0xC4, 0x0B, 0xE7, 0xE0, 0x79, 0x78, 0x82, 0xB8, 0x44,
+  0x59, 0xE4, 0xEF, 0x66, 0xCF, 0xE8, 0xAA, 0xA0, 0x17, 0x43, 0x41, 0x81, 0x77, 0xA6, 0xD0, 0x0D,
+  0xD4, 0x93, 0x84, 0x64, 0xA6, 0x9E, 0xC4, 0x3C, 0x6E, 0x01, 0x14, 0xA6, 0xB3, 0xC1, 0x97, 0xB9,
+  0x27, 0x9D, 0x65, 0x87, 0x8D, 0x3C, 0xB4, 0xE5, 0x9B, 0x24, 0xCE, 0xBA, 0x97, 0x52, 0x8E, 0x94,
+  0x0D, 0xE0, 0x93, 0x1C, 0x50, 0x8C, 0x9B, 0x4D, 0x3A, 0x00, 0x45, 0xBE, 0x94, 0x34, 0x68, 0x93,
+  0xAC, 0x70, 0xB2, 0x3D, 0xD2, 0xB4, 0x4F, 0x66, 0xDC, 0x98, 0x99, 0x07, 0x8E, 0xE8, 0xC4, 0x21,
+  0x7A, 0x6A, 0x8C, 0xDC, 0x38, 0x5C, 0xA1, 0x27, 0xD9, 0xFE, 0x55, 0x9C, 0x9A, 0x38, 0x22, 0x2F,
+  0x99, 0xC9, 0xC8, 0x65, 0x36, 0xB9, 0x01, 0x14, 0xF4, 0xA5, 0x7B, 0x5F, 0x83, 0x13, 0x1F, 0x47,
+  0x64, 0x78, 0xBE, 0x11, 0xA6, 0xD5, 0x15, 0xCE, 0xDF, 0x5B, 0x3E, 0x72, 0xFC, 0x46, 0x91, 0x6C,
+  0xAC, 0x06, 0xC4, 0xB2, 0x67, 0x41, 0x0E, 0x8C, 0x86, 0x80, 0x27, 0x6C, 0x93, 0x14, 0x69, 0xEF,
+  0x73, 0x67, 0x74, 0xB5, 0xAE, 0x82, 0x6E, 0x87, 0x05, 0x4B, 0x1C, 0x61, 0xE1, 0x1A, 0xB5, 0xD7,
+  0x67, 0x7B, 0x5A, 0xC1, 0xD4, 0xE3, 0x20, 0xBC, 0xC2, 0x81, 0xC3, 0x84, 0xCF, 0x49, 0x2B, 0x5D,
+  0x37, 0x1A, 0x61, 0x2A, 0xAF, 0x44, 0x66, 0x1E, 0x10, 0xE0, 0x1C, 0x18, 0x51, 0x1C, 0x7B, 0x10,
+  0x9E, 0x84, 0x73, 0x47, 0x6C, 0x4A, 0x48, 0x38, 0xF0, 0x8B, 0xCC, 0x55, 0xD1, 0x2C, 0x6D, 0x96,
+  0xCB, 0x23, 0x93, 0x95, 0xBE, 0x75, 0x9D, 0x64, 0xD6, 0xDD, 0x19, 0xEB, 0x71, 0x12, 0x3A, 0x43,
+  0xC9, 0x4A, 0xC7, 0x93, 0xC6, 0x1E, 0xE5, 0x95, 0xAB, 0xA0, 0xE5, 0x22, 0x19, 0x07, 0x15, 0xD7,
+  0x24, 0x67, 0xB8, 0x90, 0xD3, 0xA7, 0xAB, 0xAA, 0xC2, 0xF6, 0x7F, 0x5A, 0x17, 0x18, 0x4F, 0xB7,
+  0x82, 0x2C, 0x66, 0x13, 0x97, 0xCC, 0x9E, 0x3E, 0x56, 0x57, 0x1A, 0x8F, 0x3E, 0x9A, 0x76, 0xB8,
+  0x04, 0x45, 0x11, 0xB9, 0xB1, 0xDE, 0x88, 0x1A, 0x77, 0xE0, 0x44, 0x96, 0x3B, 0x35, 0xF5, 0x50,
+  0xF5, 0x4F, 0xC7, 0x46, 0x4D, 0x7A, 0xC5, 0x2D, 0x43, 0x5A, 0xCF, 0x09, 0x9F, 0x8F, 0x46, 0x3E,
+  0x3A, 0xD3, 0xFC, 0xD2, 0x1A, 0x4A, 0xC3, 0x7B, 0xAD, 0xEE, 0x49, 0x24, 0xA1, 0x60, 0x47, 0xC5,
+  0xE5, 0xB4, 0x31, 0x64, 0x03, 0xDA, 0x00, 0x9B, 0xD9, 0xBF, 0x52, 0x03, 0x76, 0xD7, 0x21, 0xF3,
+  0xEB, 0x8D, 0x7C, 0x9D, 0x2F, 0x81, 0x4C, 0x04, 0x37, 0xF6, 0x55, 0x6E, 0x83, 0xD4, 0x15, 0x70,
+  0x18, 0xB8, 0xB6, 0xA7, 0x39, 0x63, 0x1D, 0xE5, 0x8B, 0x2F, 0x75, 0xC5, 0x9B, 0x61, 0xC0, 0x06,
+  0x25, 0x06, 0x9B, 0x45, 0x13, 0xD4, 0xD8, 0x3D, 0x81, 0x5C, 0x0F, 0x2C, 0x62, 0x73, 0x5B, 0x40,
+  0x26, 0x25, 0xC6, 0x6A, 0x34, 0xA1, 0x86, 0xBE, 0x20, 0xA2, 0x93, 0xB3, 0xB9, 0x8B, 0x37, 0x92,
+  0xA4, 0x1A, 0x9F, 0x05, 0xE3, 0xA1, 0x2A, 0xE9, 0xFE, 0x62, 0x93, 0xC1, 0xC3, 0x8E, 0x54, 0x90,
+  0x93, 0xA8, 0x83, 0xEC, 0xE9, 0x1F, 0x50, 0x39, 0x44, 0x4E, 0x9E, 0x33, 0x36, 0xD7, 0x86, 0xE4,
+  0xB4, 0x32, 0xD7, 0xA7, 0x0E, 0x5B, 0x87, 0x48, 0x05, 0x6B, 0x08, 0xAD, 0x71, 0x53, 0x1E, 0x88,
+  0x98, 0xE4, 0xA5, 0xE1, 0xD6, 0xA5, 0x2C, 0x75, 0x0F, 0x32, 0xD3, 0x01, 0xB6, 0xC1, 0xEF, 0x04,
+  0xDE, 0x7F, 0x15, 0x24, 0x1D, 0xCD, 0x6C, 0x88, 0x55, 0x41, 0x21, 0x56, 0xB7, 0x49, 0x12, 0x9A,
+  0x2E, 0x1F, 0x88, 0x17, 0x79, 0xE0, 0x48, 0x6C, 0xBF, 0x83, 0xE4, 0xCB, 0x09, 0xD1, 0xC3, 0x03,
+  0xCA, 0xFA, 0x46, 0x90, 0x2D, 0xE9, 0xCE, 0x71, 0x1B, 0x5F, 0xF7, 0x9D, 0x1B, 0x26, 0x87, 0xA3,
+  0xC2, 0x32, 0x37, 0x75, 0x26, 0x29, 0x1B, 0xEE, 0xCC, 0xB5, 0xC6, 0x7D, 0x44, 0xD7, 0x71, 0xDB,
+  0x5E, 0x52, 0x35, 0x5A, 0x06, 0x67, 0xA0, 0x27, 0x5B, 0xD9, 0x2C, 0xA7, 0x33, 0x63, 0x77, 0xF2,
+  0x08, 0x55, 0x9B, 0x65, 0x45, 0x40, 0x53, 0x7E, 0x42, 0xE1, 0xC1, 0xF3, 0xC9, 0xC8, 0xDB, 0xD8,
+  0x2E, 0xDC, 0x3A, 0x82, 0x49, 0xEE, 0x9A, 0x7A, 0x00, 0xA7, 0x17, 0xA3, 0x0D, 0xB0, 0x83, 0x5E,
+  0xCC, 0xA9, 0xB4, 0x0B, 0xBA, 0xB1, 0x2F, 0xE6, 0xDE, 0x86, 0x38, 0xF9, 0x26, 0x3B, 0x6E, 0x4A,
+  0x8A, 0x69, 0xD1, 0x9A, 0x4F, 0x4A, 0x76, 0xEC, 0x69, 0xB5, 0xB2, 0x79, 0xA0, 0x78, 0x57, 0x54,
+  0x57, 0x61, 0xD8, 0x0D, 0x89, 0x0C, 0x76, 0xF6, 0xBE, 0xCD, 0xAE, 0xB0, 0xE5, 0x2A, 0x87, 0xBB,
+  0xD5, 0xBD, 0x58, 0xD3, 0x32, 0x1B, 0x51, 0x1E, 0x3B, 0x94, 0xC6, 0x91, 0xAB, 0x5E, 0x2D, 0x6F,
+  0x3B, 0x64, 0xE8, 0xF6, 0x95, 0xBA, 0xC7, 0xE9, 0x11, 0x1E, 0x7B, 0x2B, 0x43, 0xD2, 0x75, 0x5A,
+  0x64, 0x2B, 0x5A, 0xC5, 0x24, 0x3B, 0x08, 0x3F, 0x70, 0x33, 0x93, 0x4E, 0xF0, 0x10, 0x3D, 0xA1,
+  0x8C, 0xCD, 0x75, 0x9F, 0xF7, 0x0D, 0x78, 0x11, 0x8C, 0xD2, 0x2C, 0x73, 0xCC, 0x05, 0xF7, 0xEA,
+  0xDA, 0x55, 0xFE, 0x76, 0x66, 0x5C, 0x70, 0xC6, 0x7E, 0xB1, 0xE4, 0x2E, 0xC1, 0xF4, 0x88, 0x94,
+  0x64, 0x7B, 0x7B, 0x3F, 0x60, 0xD3, 0x4A, 0xC5, 0xAD, 0xF7, 0x98, 0x57, 0x01, 0x31, 0x31, 0x69,
+  0x68, 0x37, 0xD0, 0x88, 0x1B, 0xEC, 0x03, 0xB3, 0x9D, 0xC3, 0x21, 0xDE, 0xE4, 0x84, 0xF1, 0x32,
+  0x1B, 0x75, 0xE5, 0x5E, 0xD7, 0xF3, 0xF3, 0x6E, 0xEA, 0x18, 0x23, 0xE7, 0x56, 0xAB, 0xC2, 0x25,
+  0x8A, 0x5C, 0x89, 0x06, 0x9C, 0xDB, 0x81, 0x46, 0x85, 0x11, 0xF1, 0x27, 0x66, 0x45, 0xA2, 0xC9,
+  0xD1, 0x2C, 0x7C, 0xD8, 0x11, 0x39, 0x24, 0x69, 0x6D, 0xC6, 0xE7, 0x36, 0x67, 0xEE, 0xAB, 0xDF,
+  0xC4, 0xC2, 0x48, 0x1F, 0xE4, 0x2B, 0x3C, 0x6F, 0x42, 0x21, 0x24, 0xA8, 0xB5, 0xDE, 0x14, 0xF7,
+  0x8C, 0x83, 0x4F, 0x04, 0x83, 0xD9, 0xFF, 0x41, 0x17, 0x83, 0x82, 0x7C, 0xEA, 0xE6, 0x37, 0x9C,
+  0xC9, 0x36, 0x23, 0x23, 0xE6, 0x06, 0xDC, 0x4E, 0x7B, 0xAC, 0x98, 0x54, 0x15, 0x85, 0x1B, 0xBF,
+  0x6F, 0x57, 0xB1, 0x74, 0x30, 0x5B, 0x60, 0x1C, 0xB9, 0xB2, 0x5F, 0x47, 0x7C, 0xC4, 0x12, 0x55,
+  0x72, 0x87, 0xE7, 0xF1, 0x88, 0x2C, 0x2C, 0x1B, 0xB0, 0x65, 0x32, 0x81, 0x6D, 0xD5, 0x3A, 0x0A,
+  0x0B, 0x28, 0xAE, 0x3F, 0x74, 0x52, 0x1D, 0x71, 0x35, 0xD3, 0xA7, 0xDB, 0x74, 0x8B, 0x13, 0x73,
+  0x80, 0x4E, 0x23, 0x3D, 0x88, 0x5B, 0x38, 0x22, 0xDA, 0xF5, 0xCC, 0x3D, 0xE3, 0xA0, 0x47, 0xDB,
+  0x89, 0x0D, 0x60, 0xC3, 0xA7, 0xAA, 0x07, 0x8A, 0x09, 0x8B, 0x4A, 0xDD, 0xA2, 0xDA, 0xC3, 0xDC,
+  0x04, 0x05, 0xE5, 0x9D, 0x31, 0xF7, 0x19, 0x6B, 0x7B, 0x4A, 0xE9, 0xC7, 0xEE, 0x88, 0xB5, 0xAE,
+  0xC0, 0xCE, 0xE1, 0x30, 0xD8, 0x1F, 0xC8, 0xF6, 0x3F, 0x0F, 0x62, 0x64, 0xB6, 0x37, 0x31, 0xD9,
+  0xEC, 0x89, 0x61, 0x73, 0xAD, 0xC6, 0x64, 0x5D, 0x76, 0x24, 0xEF, 0x83, 0x23, 0xDC, 0x8B, 0x6D,
+  0x6A, 0x1A, 0x33, 0x6F, 0x70, 0xC3, 0x44, 0xEE, 0x5C, 0xDB, 0x31, 0x59, 0x7D, 0x9A, 0x7A, 0x87,
+  0x7A, 0xBC, 0x43, 0x26, 0x65, 0x8C, 0x45, 0xC6, 0x0E, 0x2B, 0xAA, 0xC8, 0x84, 0xC4, 0xAA, 0x4C,
+  0xA9, 0x2C, 0x66, 0x9F, 0x07, 0xA5, 0x13, 0x0A, 0xB5, 0x34, 0x9B, 0x6B, 0xEB, 0x1A, 0xC8, 0x9C,
+  0x7F, 0x9C, 0x91, 0xCE, 0x6C, 0xC6, 0x4E, 0x12, 0xA1, 0xFB, 0x9C, 0x2D, 0xF9, 0x73, 0x37, 0x9E,
+  0x04, 0x17, 0xAD, 0x13, 0x91, 0x46, 0xE3, 0x09, 0xE5, 0xCC, 0x99, 0xA4, 0xB5, 0xF1, 0x70, 0xE8,
+  0xA5, 0x15, 0x65, 0x12, 0x80, 0xEC, 0x53, 0x63, 0x1F, 0xDE, 0xFC, 0x14, 0xD9, 0x02, 0x53, 0x9A,
+  0xA4, 0x67, 0x96, 0x7D, 0x76, 0xFA, 0x91, 0xC7, 0x45, 0xCE, 0x23, 0x44, 0xB2, 0xCF, 0xCD, 0x3C,
+  0x9A, 0xCB, 0x03, 0xD6, 0xF8, 0xB5, 0x6B, 0x5D, 0x46, 0x27, 0x55, 0xF3, 0x5F, 0x16, 0x33, 0x30,
+  0x5B, 0x84, 0x1C, 0xFC, 0x80, 0xF9, 0xB6, 0x04, 0xA2, 0xEC, 0x93, 0x0B, 0x0F, 0xC7, 0x29, 0xC6,
+  0xDC, 0xA4, 0x68, 0x6D, 0x40, 0x9C, 0xE7, 0x73, 0x54, 0xED, 0x94, 0xD9, 0xB3, 0x2E, 0xF8, 0xBC,
+  0xCD, 0x82, 0xEC, 0xA4, 0xF3, 0x08, 0xF3, 0xCA, 0x92, 0xD6, 0xD6, 0xDC, 0xB6, 0x27, 0x7B, 0xDE,
+  0xA4, 0x25, 0xB8, 0x6C, 0x50, 0xB1, 0x47, 0x29, 0xDE, 0xE0, 0xE2, 0x9D, 0xB4, 0x89, 0x87, 0xC8,
+  0x29, 0x68, 0xB0, 0x53, 0x70, 0x49, 0x9E, 0x6E, 0x86, 0xB3, 0x6B, 0x22, 0xE3, 0x3B, 0x5C, 0x3A,
+  0x89, 0x71, 0x54, 0x38, 0xA4, 0xBF, 0x88, 0x5C, 0x99, 0xD4, 0x30, 0x60, 0xDF, 0x51, 0xB7, 0x6F,
+  0x33, 0xF3, 0x0A, 0x16, 0x07, 0xB2, 0xCA, 0x15, 0x47, 0x2F, 0x50, 0x1E, 0x36, 0x55, 0xED, 0x90,
+  0xC9, 0x9A, 0x57, 0x19, 0x59, 0x92, 0x3A, 0x24, 0x6B, 0xC8, 0xA4, 0x30, 0x91, 0xBB, 0x5B, 0x03,
+  0x97, 0xFD, 0x9E, 0xF2, 0x00, 0xDE, 0xB1, 0x49, 0x6B, 0x4E, 0x4E, 0xCC, 0x0F, 0x0F, 0x4F, 0xDC,
+  0x1A, 0x11, 0x16, 0x8D, 0xBA, 0x8A, 0xDD, 0xDC, 0xB9, 0x43, 0xC4, 0xA0, 0xEA, 0xB4, 0xF1, 0x49,
+  0x6D, 0xF6, 0x8C, 0x2D, 0x9E, 0x90, 0x23, 0xB7, 0xBD, 0xB1, 0xE4, 0x28, 0xA0, 0xBC, 0x56, 0x92,
+  0x55, 0xCC, 0x40, 0x38, 0xBE, 0xCD, 0x69, 0x44, 0x70, 0x02, 0x4B, 0x77, 0xFA, 0x92, 0xBD, 0xBF,
+  0x1D, 0xDA, 0x5C, 0x5B, 0x63, 0x21, 0x76, 0xE2, 0xC9, 0x29, 0x88, 0x7A, 0x83, 0x99, 0xFC, 0x3C,
+  0x61, 0xF9, 0x0C, 0x71, 0x0E, 0xE9, 0x4E, 0x05, 0x63, 0x41, 0xDD, 0x06, 0x8D, 0x38, 0x43, 0xC7,
+  0xCC, 0x9C, 0xA2, 0xB2, 0x09, 0xB4, 0x21, 0xC0, 0x88, 0xA3, 0xC3, 0xB8, 0x0D, 0x77, 0xBD, 0x05,
+  0xDE, 0xC2, 0x51, 0xE4, 0xBE, 0x18, 0x4B, 0x31, 0x91, 0xDB, 0xB3, 0x2C, 0xF2, 0x45, 0x82, 0x12,
+  0xC3, 0x15, 0x0F, 0x1C, 0x97, 0xD9, 0x29, 0x69, 0xF7, 0xE7, 0x8D, 0xAF, 0xCF, 0xD4, 0x2A, 0x3D,
+  0xF0, 0xD5, 0x99, 0x5A, 0xEE, 0x3B, 0xE5, 0x72, 0x62, 0x83, 0x56, 0xC2, 0xD6, 0x61, 0x6A, 0xCB,
+  0x18, 0xDA, 0xAF, 0x70, 0xE6, 0x49, 0xDA, 0xC2, 0xE3, 0xAE, 0x5C, 0x16, 0x91, 0xD8, 0x69, 0xB3,
+  0x70, 0xA6, 0x81, 0xD0, 0x09, 0x5B, 0x5B, 0x9E, 0x01, 0xDE, 0x9B, 0xD0, 0xC3, 0x2E, 0x02, 0x4F,
+  0x19, 0x71, 0x1B, 0x3F, 0x41, 0x01, 0x3A, 0xC7, 0xD9, 0x08, 0x25, 0xAE, 0x77, 0xE3, 0x64, 0xDC,
+  0x59, 0x2A, 0x3D, 0x80, 0xEB, 0x88, 0x69, 0xFB, 0x04, 0xF1, 0x6E, 0x22, 0x45, 0xE8, 0xA3, 0x3C,
+  0xE6, 0xAA, 0x7E, 0x62, 0x72, 0xAE, 0xC4, 0xAE, 0xAD, 0x99, 0xEC, 0x4C, 0x59, 0x16, 0xEE, 0x84,
+  0x5C, 0x82, 0xB3, 0x92, 0x17, 0xB8, 0x61, 0x71, 0xF5, 0x39, 0x29, 0xB3, 0x23, 0x3B, 0x4D, 0x38,
+  0xEF, 0xA0, 0x99, 0x1C, 0xEB, 0x1D, 0xC4, 0x06, 0xDD, 0xF8, 0xE0, 0x13, 0x01, 0x54, 0xC3, 0xC6,
+  0x6E, 0x2C, 0x9A, 0x69, 0xD3, 0xB4, 0x4D, 0x8B, 0xA5, 0xBC, 0xBD, 0x8B, 0xDA, 0xE3, 0xC4, 0xCE,
+  0x6A, 0xC0, 0xBA, 0xE1, 0xA4, 0x75, 0xD5, 0xB0, 0xF6, 0x55, 0x27, 0xD7, 0x11, 0xDB, 0xB7, 0x29,
+  0xEA, 0xCE, 0xC3, 0x5E, 0x38, 0xE1, 0x50, 0x9C, 0xDF, 0xBC, 0x56, 0x37, 0xBF, 0x07, 0x68, 0x7D,
+  0xAA, 0x1D, 0x74, 0x81, 0xEE, 0x1B, 0x31, 0x85, 0x91, 0xCD, 0xAB, 0x5A, 0x6A, 0x9C, 0x37, 0x25,
+  0x74, 0x1D, 0xF5, 0xCE, 0x50, 0x4C, 0x20, 0x9C, 0xEF, 0xA8, 0x4E, 0x56, 0x6C, 0x54, 0xA3, 0x79,
+  0x69, 0x1D, 0xED, 0xB1, 0x5A, 0x17, 0x7C, 0x4E, 0x40, 0xEC, 0xC4, 0x32, 0x8B, 0xBD, 0xF8, 0xBC,
+  0xCA, 0x61, 0x23, 0x33, 0xEC, 0xDD, 0xE7, 0xD9, 0xD3, 0xA4, 0xE0, 0xE7, 0x65, 0x4E, 0x67, 0x8C,
+  0x5D, 0x88, 0x0B, 0xB2, 0x52, 0xCD, 0xDB, 0x20, 0x65, 0x8E, 0x48, 0xCC, 0x28, 0x26, 0x7C, 0xBE,
+  0xE0, 0x63, 0x28, 0x4A, 0xA7, 0x66, 0xBC, 0x28, 0x26, 0xC5, 0x70, 0xE6, 0xB4, 0x28, 0x16, 0xB1,
+  0x5B, 0xBE, 0x91, 0x51, 0xBA, 0x3B, 0xF5, 0xC4, 0xB5, 0x6F, 0xF5, 0x00, 0x93, 0x83, 0x52, 0xD4,
+  0xC1, 0x7C, 0x1D, 0xC4, 0x51, 0xE3, 0x5C, 0xDC, 0x39, 0x05, 0x1E, 0x18, 0x08, 0xC6, 0xF9, 0xB8,
+  0xC5, 0xC6, 0xDC, 0x67, 0xB5, 0x4C, 0x8E, 0xB1, 0x66, 0x3C, 0xEC, 0xA3, 0x73, 0x9F, 0xA0, 0x16,
+  0x81, 0xA3, 0x98, 0xC3, 0xDA, 0x07, 0x02, 0x73, 0x79, 0x50, 0x38, 0x39, 0x64, 0xE3, 0x71, 0xD8,
+  0x83, 0x42, 0xF8, 0x04, 0xA7, 0x7D, 0x6D, 0x1F, 0x28, 0xF8, 0x2A, 0xD2, 0x4A, 0x6E, 0xA7, 0xBD,
+  0xDB, 0x80, 0x52, 0x36, 0xAE, 0xBC, 0x75, 0x85, 0xC2, 0x27, 0x5D, 0x55, 0xEE, 0x36, 0xCE, 0x2D,
+  0x5A, 0xD3, 0x7D, 0x3C, 0x61, 0x35, 0xEE, 0xF7, 0x33, 0xDC, 0x93, 0x86, 0xC2, 0x55, 0xDE, 0xBB,
+  0x82, 0x4B, 0x38, 0x7D, 0xAC, 0x99, 0x83, 0x37, 0xA9, 0x1A, 0xDA, 0x8D, 0x0F, 0x04, 0x49, 0x28,
+  0x84, 0xE5, 0xE4, 0x03, 0xB4, 0x01, 0x5C, 0x2A, 0x8A, 0x9C, 0x3C, 0xA7, 0x16, 0xD9, 0x49, 0xC6,
+  0xC9, 0x29, 0x26, 0xCD, 0x19, 0x31, 0xAC, 0xAB, 0x64, 0xD2, 0xBA, 0x77, 0xF6, 0x36, 0x32, 0xC6,
+  0x2A, 0x28, 0xB7, 0x0C, 0xA5, 0x68, 0x94, 0xE6, 0x87, 0x8F, 0x2C, 0xA3, 0x05, 0x20, 0xC7, 0x28,
+  0x73, 0xC1, 0x0A, 0x81, 0xC1, 0x45, 0xAA, 0x0A, 0x66, 0x8E, 0x23, 0x07, 0x90, 0x45, 0xE2, 0x8E,
+  0x5D, 0x90, 0x4D, 0xD7, 0xF4, 0x0E, 0x33, 0x5E, 0x71, 0x60, 0x40, 0x4C, 0x1D, 0x49, 0xBE, 0x2F,
+  0xC1, 0x49, 0x72, 0xA9, 0xA3, 0x29, 0x8B, 0xDD, 0x86, 0x5D, 0x54, 0x03, 0x5B, 0x21, 0x24, 0x73,
+  0x35, 0xBE, 0xEB, 0x3A, 0xFF, 0xC9, 0x66, 0x24, 0xC2, 0xA9, 0xFF, 0x28, 0xFB, 0x87, 0x65, 0x98,
+  0x44, 0x29, 0x64, 0xC1, 0x58, 0x4E, 0x72, 0x73, 0x36, 0xB9, 0xCA, 0x05, 0xA6, 0x4C, 0xA3, 0x74,
+  0x1B, 0x86, 0xDB, 0x0E, 0x67, 0xE8, 0x99, 0x1E, 0x9A, 0x53, 0x14, 0xB4, 0x01, 0x7B, 0x59, 0xC3,
+  0xD3, 0xAB, 0x5D, 0xA7, 0xB0, 0x88, 0x9A, 0xB1, 0x58, 0x45, 0x1E, 0x05, 0xF6, 0x00, 0xD4, 0xFE,
+  0x36, 0x28, 0xE1, 0xD0, 0x8D, 0x3E, 0x60, 0xF6, 0xD0, 0x6B, 0x98, 0x3D, 0x30, 0xAE, 0xAB, 0x8F,
+  0x30, 0xB3, 0xA7, 0x8A, 0xC9, 0x5E, 0xEA, 0xB3, 0x5C, 0x06, 0xCF, 0xFA, 0xF0, 0x91, 0xB5, 0x52,
+  0x36, 0x13, 0xB8, 0x55, 0x8B, 0x8F, 0xB8, 0x91, 0x73, 0xA4, 0xA4, 0x1F, 0xC1, 0x75, 0x92, 0xF6,
+  0x82, 0xCB, 0xC9, 0x26, 0xF4, 0xB2, 0x63, 0x1B, 0xEA, 0x00, 0x13, 0x57, 0x21, 0x46, 0xB2, 0x98,
+  0x79, 0xFD, 0x46, 0xF6, 0x80, 0x31, 0x8A, 0x8A, 0xD4, 0x83, 0x18, 0x33, 0x5F, 0x48, 0xF2, 0xEF,
+  0x26, 0x94, 0xF3, 0xB3, 0x30, 0x4D, 0x16, 0xEA, 0x6D, 0xD1, 0xD0, 0x1E, 0x40, 0xCE, 0xF9, 0x8B,
+  0xC2, 0x47, 0xF9, 0x86, 0x61, 0xE3, 0x01, 0xAF, 0x1C, 0x02, 0xA9, 0xE5, 0x18, 0x8F, 0x4F, 0xF2,
+  0xAB, 0xB0, 0xF7, 0xF9, 0x98, 0x7B, 0xD7, 0xFE, 0x4C, 0xAC, 0x6A, 0xE6, 0xDA, 0x43, 0xDB, 0x2C,
+  0x76, 0x8C, 0x4B, 0x6D, 0x4C, 0x31, 0x2E, 0x44, 0x61, 0x33, 0x22, 0x35, 0x86, 0x56, 0x78, 0xA9,
+  0x2B, 0x9A, 0xD2, 0x27, 0xD8, 0xE4, 0xF9, 0x05, 0x39, 0x15, 0xF8, 0xDC, 0x0B, 0xA9, 0x9E, 0xC6,
+  0x98, 0x11, 0x3D, 0x70, 0x38, 0x59, 0x96, 0x79, 0x08, 0xEC, 0x6F, 0x64, 0xF0, 0x5A, 0x98, 0xA8,
+  0x95, 0xCC, 0x0D, 0x0E, 0x2E, 0xD9, 0x03, 0x45, 0x5B, 0x18, 0x40, 0xA9, 0x80, 0x71, 0x76, 0xCA,
+  0xC9, 0x95, 0x6D, 0x3B, 0x80, 0x17, 0x27, 0x7C, 0x20, 0xFF, 0x2B, 0x83, 0x34, 0x72, 0x3B, 0x15,
+  0x79, 0xE2, 0xCC, 0xF8, 0x19, 0x99, 0xB9, 0x37, 0x96, 0xC9, 0x58, 0x17, 0x93, 0x5E, 0xC5, 0x40,
+  0x6D, 0xAB, 0xEA, 0x5B, 0x16, 0x2E, 0x38, 0xE9, 0x15, 0x0E, 0x54, 0x1D, 0xCE, 0x2A, 0x90, 0xEE,
+  0xE5, 0xC7, 0xF9, 0x68, 0x28, 0x75, 0xC6, 0x82, 0x97, 0xD2, 0x82, 0xAC, 0x0C, 0xE6, 0xFE, 0x30,
+  0xDF, 0xCE, 0x6B, 0x83, 0x01, 0xD2, 0xE9, 0x07, 0x8C, 0x93, 0xE6, 0x28, 0xD3, 0xB9, 0x41, 0x99,
+  0x78, 0xCA, 0xD2, 0x03, 0xB8, 0xA7, 0x90, 0x75, 0xFB, 0x06, 0x59, 0x37, 0x33, 0xBC, 0x75, 0x2D,
+  0x69, 0x37, 0xF6, 0x00, 0x72, 0x4A, 0xCF, 0xD8, 0x7D, 0xAD, 0xC4, 0xBA, 0x8A, 0xCA, 0xDD, 0xEF,
+  0x3A, 0xB8, 0xA0, 0x97, 0xAE, 0xC2, 0xD5, 0x28, 0x9A, 0xB3, 0x62, 0x12, 0x0B, 0xE7, 0xAE, 0xD3,
+  0xE8, 0xF1, 0x04, 0x23, 0x25, 0xDC, 0x12, 0x33, 0xE1, 0x9C, 0xE1, 0x61, 0xE3, 0x03, 0x81, 0x3D,
+  0xC1, 0x97, 0xF3, 0xD0, 0x90, 0x3E, 0xC8, 0x87, 0xF6, 0xE6, 0x49, 0xF5, 0x08, 0x9E, 0xB9, 0x07,
+  0xB6, 0x3E, 0x37, 0x9A, 0x19, 0x18, 0x4E, 0xE4, 0x39, 0x29, 0x50, 0x97, 0xCD, 0x23, 0x00, 0x8E,
+  0x73, 0x1A, 0x0F, 0x70, 0xE5, 0x8C, 0x28, 0xA3, 0xEA, 0xB6, 0x5D, 0x85, 0x7A, 0x53, 0x3A, 0xC7,
+  0xF8, 0x46, 0xBC, 0xD0, 0x32, 0x91, 0x7B, 0xF0, 0x02, 0x53, 0x0D, 0x91, 0x92, 0x70, 0xB9, 0x30,
+  0xAE, 0xDC, 0x11, 0x59, 0x7C, 0x2D, 0xC1, 0x1C, 0x2D, 0x4C, 0x6A, 0xBD, 0x3B, 0xF2, 0xEA, 0xB4,
+  0x79, 0x6A, 0xBA, 0xEB, 0xA8, 0x13, 0xA8, 0x1E, 0xB8, 0xB7, 0xC4, 0x5A, 0x61, 0xF9, 0x83, 0x5C,
+  0x8C, 0xD6, 0x6A, 0x1D, 0x96, 0x15, 0x8E, 0xDB, 0x7B, 0x1B, 0xAD, 0x0A, 0x27, 0x0B, 0x4A, 0x29,
+  0xAC, 0xD2, 0x54, 0x9C, 0x99, 0xDB, 0x60, 0xA4, 0x19, 0x7D, 0xB3, 0x45, 0x4C, 0x7F, 0x17, 0xD0,
+  0x12, 0x7E, 0x78, 0x64, 0xAC, 0x51, 0x13, 0xEB, 0xAF, 0x49, 0xFE, 0x58, 0x87, 0xFA, 0x64, 0xE5,
+  0x0D, 0x9C, 0x89, 0x38, 0x25, 0xC8, 0x1E, 0x0C, 0x89, 0x33, 0x0B, 0x86, 0x64, 0x70, 0x34, 0x10,
+  0x74, 0xF6, 0xA5, 0x50, 0x01, 0x7B, 0x9F, 0x9D, 0x3F, 0x5C, 0x69, 0xD4, 0xCD, 0xDF, 0x17, 0xC7,
+  0x76, 0x86, 0xAE, 0x3C, 0x30, 0x35, 0xB4, 0x99, 0x60, 0x0F, 0x0E, 0x38, 0x1B, 0x11, 0xCA, 0xE6,
+  0xB0, 0xAF, 0x6B, 0xE6, 0x40, 0xCB, 0x83, 0x78, 0x60, 0x71, 0xB2, 0xE9, 0x88, 0xD2, 0x5D, 0xAE,
+  0x03, 0x93, 0x39, 0x31, 0xA2, 0x8C, 0x5C, 0x86, 0x60, 0x92, 0xFA, 0x79, 0xCF, 0xD0, 0x6C, 0x2A,
+  0x93, 0x88, 0xD2, 0x44, 0xAC, 0xC3, 0x3C, 0xB2, 0x8B, 0xB5, 0x7B, 0x92, 0xD9, 0x3D, 0x8E, 0xF0,
+  0x8C, 0x1F, 0x92, 0x23, 0xD8, 0x63, 0xC4, 0x43, 0x4A, 0xA4, 0xBF, 0xC2, 0xFC, 0x58, 0x05, 0xB9,
+  0x52, 0xAD, 0x33, 0xCC, 0xCA, 0x49, 0x96, 0x28, 0x26, 0x93, 0xBF, 0x3B, 0xEC, 0xDA, 0xDE, 0xE7,
+  0x02, 0x72, 0xE8, 0x10, 0x20, 0x62, 0x58, 0x09, 0x2C, 0xA5, 0x8D, 0xFB, 0x8D, 0xB4, 0xFA, 0xB9,
+  0x41, 0xAC, 0x38, 0x08, 0xA2, 0xF2, 0x48, 0xCE, 0x3C, 0x94, 0x52, 0x76, 0x80, 0x1B, 0xC5, 0xEA,
+  0x73, 0xC9, 0x2A, 0x73, 0xC3, 0x98, 0x76, 0x4D, 0xDB, 0x07, 0x0A, 0xDA, 0xFD, 0x53, 0xDA, 0xD2,
+  0x6E, 0x8C, 0xC4, 0x2E, 0xFA, 0x29, 0x09, 0xC6, 0x1B, 0xD4, 0x4E, 0x4A, 0xE2, 0x90, 0xAA, 0x2C,
+  0x0C, 0x3D, 0xEE, 0x7E, 0x70, 0x1F, 0x3E, 0x59, 0x36, 0xF2, 0x40, 0x35, 0x7C, 0x5B, 0xB1, 0xFC,
+  0x5A, 0x90, 0xC2, 0x76, 0xE3, 0x98, 0xCF, 0xCC, 0xDC, 0xF4, 0x66, 0xA1, 0x1E, 0x76, 0xA9, 0xD6,
+  0x2F, 0x18, 0xE7, 0x0E, 0x99, 0xB9, 0x49, 0xCE, 0x52, 0x83, 0x29, 0x16, 0x34, 0x2E, 0xBA, 0x41,
+  0xBE, 0x51, 0x2B, 0x3E, 0xF6, 0xA2, 0x8C, 0xFD, 0x2A, 0xE3, 0x8E, 0x61, 0x4C, 0xFC, 0x47, 0xCD,
+  0xB2, 0x9E, 0xB0, 0x97, 0x59, 0xE4, 0x77, 0x9D, 0x9B, 0x83, 0x1E, 0x2C, 0x58, 0xE6, 0x63, 0xDC,
+  0x9E, 0xE1, 0xA1, 0x6F, 0x63, 0x15, 0x51, 0xF6, 0x30, 0x46, 0x16, 0x85, 0x9B, 0xB0, 0x7C, 0x60,
+  0xF0, 0x7E, 0x28, 0x4E, 0xBC, 0x32, 0xC1, 0x0D, 0x53, 0xED, 0xB5, 0xCC, 0xCC, 0x74, 0xD2, 0x8C,
+  0x74, 0x04, 0x37, 0x88, 0xDF, 0x2A, 0xB8, 0xF6, 0x63, 0x66, 0x0E, 0xD7, 0xEB, 0xE6, 0x75, 0x18,
+  0xA0, 0xA0, 0x9F, 0xBA, 0x4F, 0x37, 0x57, 0x66, 0xD5, 0x59, 0xFB, 0x29, 0xDE, 0x0F, 0x51, 0xB4,
+  0xC5, 0x1D, 0x84, 0x5F, 0x4F, 0x1E, 0x3E, 0x67, 0x21, 0x70, 0xCA, 0xDA, 0x94, 0x6A, 0xF1, 0x2C,
+  0xED, 0x86, 0x81, 0x17, 0x02, 0x32, 0x52, 0x0B, 0x9C, 0x25, 0xEE, 0xBC, 0x31, 0xA9, 0x46, 0x37,
+  0xE0, 0x55, 0x82, 0xC6, 0xDC, 0xE7, 0xD8, 0x6C, 0x8F, 0xAE, 0x5C, 0xD8, 0x8F, 0x9D, 0xF4, 0xE6,
+  0xE7, 0x2D, 0xEC, 0xD9, 0xEA, 0xA1, 0xF1, 0xC1, 0x5D, 0xE4, 0x71, 0x70, 0x56, 0x46, 0x6A, 0x60,
+  0xF6, 0x14, 0x85, 0x43, 0x70, 0x0C, 0x7B, 0x4C, 0xE7, 0x0A, 0xDD, 0x88, 0x57, 0x2E, 0x3E, 0xC2,
+  0x81, 0xD0, 0x06, 0x4D, 0x87, 0xD5, 0xD8, 0xFB, 0x58, 0xC9, 0x9A, 0x10, 0xC0, 0x89, 0x52, 0xAE,
+  0x28, 0xB8, 0xAC, 0x21, 0xA9, 0xB9, 0x37, 0x80, 0x5F, 0x37, 0xA4, 0x2B, 0x89, 0x91, 0x6E, 0x60,
+  0xD2, 0x76, 0xE1, 0xAA, 0xA5, 0x87, 0x6F, 0x4A, 0x43, 0xE1, 0x01, 0x2F, 0x64, 0x59, 0xCA, 0x42,
+  0x7D, 0xE3, 0xA0, 0x40, 0x5B, 0xB8, 0x42, 0xE3, 0xEC, 0x2F, 0xB5, 0x7B, 0x15, 0xE3, 0x15, 0x5C,
+  0xA4, 0x1E, 0xF0, 0x62, 0x80, 0x66, 0x1E, 0x86, 0x3B, 0x0C, 0x65, 0x55, 0x3C, 0x43, 0x59, 0x86,
+  0xCC, 0xDC, 0xE7, 0xE1, 0x0C, 0xAB, 0x84, 0x06, 0x89, 0x56, 0xB5, 0xB4, 0x19, 0x68, 0xA1, 0x07,
+  0x06, 0x55, 0xAC, 0x4D, 0xBD, 0x73, 0xB5, 0x67, 0x05, 0xF3, 0x07, 0x06, 0xB7, 0x0E, 0x5D, 0x7B,
+  0xC9, 0x3A, 0xED, 0xC4, 0xC5, 0x03, 0xD6, 0xAF, 0x8C, 0x76, 0xE0, 0xF0, 0x80, 0x31, 0xF1, 0xCD,
+  0x6E, 0x7C, 0xDE, 0x28, 0xEC, 0x4B, 0xE3, 0x86, 0xA7, 0x8D, 0xDE, 0xBC, 0x4A, 0x78, 0xAE, 0x03,
+  0x29, 0x4E, 0xCE, 0xD3, 0xE6, 0x25, 0xCB, 0x9D, 0x30, 0x50, 0xD0, 0x96, 0xF7, 0xBC, 0xCA, 0x6F,
+  0x38, 0x08, 0xE4, 0x5E, 0x0B, 0x17, 0xD1, 0x71, 0x89, 0x78, 0x28, 0x72, 0x9B, 0x3D, 0xF1, 0x37,
+  0xA3, 0xA8, 0x78, 0xEB, 0xFC, 0xCC, 0x24, 0xBA, 0x37, 0xC3, 0xCF, 0x3D, 0xC6, 0x4C, 0x28, 0xBD,
+  0xD8, 0x32, 0x4B, 0x29, 0xAB, 0x72, 0x19, 0x60, 0x5E, 0x4C, 0x12, 0xF5, 0xB8, 0x13, 0x22, 0x0B,
+  0x5A, 0x10, 0xB6, 0x9C, 0x7F, 0xEC, 0x08, 0x29, 0x49, 0xB2, 0xBD, 0x88, 0xEF, 0xF8, 0x3E, 0x55,
+  0x80, 0x94, 0x15, 0x0C, 0xBD, 0xCB, 0xC8, 0xCC, 0xCB, 0x6A, 0xEE, 0x29, 0x98, 0xE4, 0xC2, 0xE9,
+  0xDB, 0x53, 0xF2, 0xE4, 0xBB, 0x11, 0x36, 0x6C, 0xFD, 0xC8, 0x99, 0x34, 0x1B, 0x47, 0xBE, 0xC3,
+  0x29, 0x35, 0x22, 0x33, 0xC0, 0xE5, 0x24, 0x96, 0x59, 0x8C, 0x38, 0x2D, 0x45, 0xFC, 0xC8, 0xF0,
+  0xF5, 0x93, 0x52, 0xE8, 0xD3, 0xE5, 0x24, 0x65, 0x67, 0xB6, 0x63, 0x0A, 0x6E, 0xAE, 0x69, 0xEE,
+  0xBC, 0x9C, 0xFA, 0x1A, 0xF6, 0x23, 0xD2, 0x8D, 0x5E, 0x54, 0x0B, 0xED, 0x42, 0x14, 0x3F, 0x72,
+  0x31, 0x9B, 0xD0, 0xD1, 0x88, 0xA2, 0xE6, 0x6F, 0x70, 0xF7, 0x4D, 0x15, 0xA5, 0x06, 0xDC, 0x9F,
+  0xE5, 0x7E, 0x5F, 0x5F, 0xAC, 0x74, 0x8C, 0x3B, 0x1B, 0x39, 0x51, 0xDD, 0xB9, 0x5E, 0xBC, 0xAB,
+  0x5E, 0x7D, 0xC7, 0xDE, 0x9E, 0x4F, 0xA8, 0x1A, 0x78, 0x34, 0x7A, 0x40, 0x79, 0x55, 0x53, 0x4C,
+  0xBE, 0x9F, 0x37, 0x12, 0xE6, 0x1C, 0xA3, 0xA8, 0x01, 0x83, 0x48, 0x3E, 0xE5, 0x40, 0x41, 0xB2,
+  0xE6, 0x86, 0x71, 0xA7, 0x82, 0xA5, 0x14, 0x89, 0xBB, 0x53, 0xAC, 0x8F, 0x90, 0xAB, 0x41, 0xA8,
+  0x6E, 0xAD, 0xDD, 0xEB, 0xEC, 0xB9, 0x8D, 0xB3, 0x75, 0x0E, 0xB2, 0x96, 0x99, 0x5A, 0xE3, 0x48,
+  0x8F, 0x82, 0xAC, 0x2D, 0x17, 0xDD, 0xAC, 0x70, 0x18, 0x97, 0x74, 0xBF, 0x6B, 0x8D, 0x2C, 0x61,
+  0x76, 0xA0, 0x95, 0x58, 0xEC, 0x19, 0x3E, 0x8C, 0x56, 0x94, 0x26, 0x09, 0x3D, 0xF0, 0x61, 0x78,
+  0x07, 0x62, 0xA6, 0xC6, 0x26, 0x62, 0x80, 0xB5, 0x4B, 0x1B, 0x6C, 0x07, 0xDD, 0xA2, 0x05, 0x70,
+  0x67, 0xA1, 0x66, 0x1D, 0x2B, 0xB3, 0xFF, 0x67, 0xFC, 0xF2, 0x62, 0x5A, 0x5A, 0x2E, 0xE3, 0xAB,
+  0xE3, 0x8E, 0x48, 0xC3, 0x76, 0x19, 0x6D, 0x38, 0x30, 0xDE, 0xFB, 0x53, 0x95, 0x6C, 0xE5, 0xC2,
+  0x81, 0xD5, 0x54, 0x0D, 0x93, 0x1C, 0x70, 0x64, 0x19, 0x39, 0x3C, 0xBF, 0x07, 0x38, 0x55, 0x46,
+  0x4A, 0xC5, 0x7D, 0x67, 0xD2, 0xB4, 0x51, 0x5C, 0xC2, 0x3B, 0x73, 0xF0, 0x03, 0xA5, 0xBC, 0xB2,
+  0xF7, 0x5F, 0x08, 0x20, 0x64, 0x09, 0xBD, 0xDE, 0x03, 0x3B, 0x99, 0x9C, 0x50, 0x31, 0x29, 0x14,
+  0xAF, 0xE2, 0x04, 0xD3, 0x95, 0x44, 0x14, 0x92, 0x7A, 0xE5, 0xCE, 0x44, 0x2E, 0x29, 0x21, 0xDC,
+  0x55, 0x0C, 0x8D, 0xC4, 0xDF, 0x94, 0xF8, 0xC4, 0xFD, 0x7C, 0xAA, 0x4D, 0x03, 0x8F, 0x45, 0x46,
+  0xEA, 0x6D, 0x57, 0x31, 0x41, 0x2F, 0x6F, 0x1A, 0x55, 0x57, 0x09, 0xCF, 0xA2, 0x8E, 0x48, 0xE3,
+  0x75, 0x95, 0x2F, 0x7A, 0xEB, 0xBD, 0x1D, 0xAE, 0x6A, 0xB0, 0xE5, 0x82, 0xE7, 0x58, 0x52, 0x63,
+  0x5E, 0x99, 0x51, 0x16, 0x53, 0x9A, 0x92, 0xAB, 0x5E, 0x97, 0xB5, 0xC2, 0x0D, 0x51, 0x3C, 0x20,
+  0x2F, 0x66, 0x7C, 0x32, 0xD0, 0x7D, 0x3F, 0xA9, 0xD3, 0x0A, 0x95, 0xB5, 0x76, 0x0E, 0x98, 0xA7,
+  0x40, 0x0F, 0xDD, 0xF5, 0x47, 0x75, 0x3B, 0x9E, 0x2A, 0xFC, 0xBA, 0x25, 0x06, 0x9C, 0xCC, 0x56,
+  0xE6, 0xE7, 0xF0, 0xD7, 0xED, 0xBF, 0xBF, 0x7C, 0xBD, 0x1B, 0x98, 0xA3, 0xF1, 0xFD, 0xAB, 0xD9,
+  0x6B, 0xD8, 0xC8, 0xC1, 0xC0, 0xFE, 0xDD, 0xF9, 0x60, 0x9E, 0x54, 0xD3, 0xC8, 0xE1, 0xEB, 0x28,
+  0x9A, 0x4D, 0x21, 0x1D, 0x7E, 0x1D, 0xF5, 0xBC, 0x65, 0x07, 0xFD, 0x22, 0xAA, 0xD9, 0x88, 0x40,
+  0x8B, 0xFC, 0x7A, 0x33, 0x3E, 0x9B, 0x5F, 0xB9, 0x37, 0x06, 0xAD, 0xAE, 0xD7, 0x79, 0x73, 0xDE,
+  0x10, 0xF5, 0xA2, 0xCE, 0xF2, 0x57, 0x70, 0x67, 0xFB, 0xDB, 0x8F, 0xAD, 0x48, 0x62, 0x5D, 0x34,
+  0x95, 0x64, 0xFB, 0xFB, 0xBD, 0x28, 0xE1, 0x5E, 0x0E, 0x7B, 0xD8, 0x83, 0xF9, 0xD5, 0xFE, 0xFA,
+  0x2D, 0x91, 0x50, 0x7D, 0x7F, 0xB9, 0xFD, 0xD1, 0xEF, 0xFF, 0xDA, 0x9A, 0x0A, 0x08, 0x5A, 0x51,
+  0xCB, 0x1F, 0xF7, 0xBF, 0xF5, 0xCA, 0x88, 0x03, 0x3F, 0xFD, 0xBB, 0xF9, 0xC7, 0xA7, 0xFF, 0x7E,
+  0x91, 0xB3, 0xEE, 0xE5, 0xA7, 0xEC, 0xD3, 0xBF, 0xD9, 0xAC, 0x13, 0xF3, 0x4F, 0x5F, 0x37, 0x66,
+  0x5E, 0xAE, 0xA6, 0x28, 0x83, 0x0D, 0xFB, 0xEF, 0x6E, 0x57, 0xEE, 0x12, 0x40, 0x1A, 0x86, 0xB7,
+  0x7F, 0x37, 0x6A, 0xBE, 0xA5, 0x3F, 0xB2, 0xEA, 0x8D, 0xAF, 0xF3, 0x54, 0x7F, 0x59, 0xA7, 0xEE,
+  0xE7, 0xCF, 0x9F, 0xFF, 0x6E, 0xFE, 0x77, 0x2B, 0xC3, 0xDF, 0x6D, 0xE2, 0x15, 0xF1, 0x77, 0xD3,
+  0x1C, 0xD5, 0xF6, 0xE8, 0xC0, 0xFC, 0xF6, 0x73, 0xD8, 0x4A, 0x11, 0x1B, 0xA1, 0xE1, 0xB3, 0xD4,
+  0xCB, 0x2F, 0x7F, 0xED, 0x67, 0xFF, 0xED, 0x6F, 0x4A, 0xB6, 0xEA, 0xFD, 0x97, 0x4F, 0xB7, 0xAC,
+  0x04, 0x3F, 0xFF, 0x24, 0xFB, 0x4A, 0x9A, 0xD6, 0x68, 0x36, 0x6F, 0x8A, 0xE5, 0x3A, 0xCA, 0x9F,
+  0x7E, 0xF9, 0xF5, 0x0F, 0x3D, 0xB5, 0x3E, 0xE4, 0x85, 0x38, 0xA4, 0xF5, 0xE7, 0x8B, 0x11, 0x6A,
+  0xE3, 0xFD, 0x81, 0xDB, 0x3F, 0xFF, 0xE8, 0x43, 0x9A, 0x3A, 0xAE, 0x2B, 0xD3, 0x0D, 0xB6, 0x87,
+  0x3C, 0x3E, 0xE3, 0x8F, 0x3E, 0x42, 0xD6, 0x65, 0xDC, 0xC6, 0x65, 0xFC, 0x79, 0x59, 0xBC, 0x27,
+  0x2C, 0xD3, 0x2A, 0xFF, 0xCC, 0xD7, 0xC8, 0x24, 0x91, 0x71, 0xDD, 0xE6, 0x9F, 0xE7, 0xF3, 0xF1,
+  0x6F, 0xB6, 0x8D, 0xC4, 0xAD, 0x6D, 0xF7, 0x27, 0x9A, 0x1B, 0x3F, 0xFD, 0x62, 0x07, 0x48, 0xF5,
+  0x47, 0x7A, 0xC2, 0x1F, 0xED, 0x38, 0xFF, 0x3E, 0x49, 0xF9, 0xFF, 0xA5, 0xDB, 0x4C, 0xF2, 0xB8,
+  0xDA, 0xF0, 0x90, 0xAD, 0x03, 0x94, 0xED, 0xA1, 0x3C, 0x44, 0xE2, 0x8F, 0xF4, 0x1B, 0xEE, 0x77,
+  0xFF, 0xC9, 0x8E, 0xE3, 0x3F, 0x36, 0x0A, 0xC3, 0xB2, 0xCA, 0xE2, 0xF8, 0xCF, 0xF7, 0x9C, 0xC7,
+  0xA7, 0xE4, 0x07, 0x29, 0xB2, 0xEC, 0xCF, 0x76, 0x9D, 0x87, 0x67, 0xA4, 0x87, 0xAC, 0xCD, 0x8A,
+  0xF2, 0x2F, 0xF4, 0x9D, 0x87, 0x7A, 0xCA, 0xAB, 0x43, 0x13, 0x1D, 0xEA, 0x3F, 0xD2, 0x79, 0x7E,
+  0x35, 0x7F, 0x4C, 0x3F, 0x9E, 0x9A, 0xF7, 0x9F, 0xD9, 0x5B, 0x0E, 0x7F, 0xA5, 0xB7, 0x98, 0x59,
+  0x57, 0x35, 0x81, 0xF9, 0xE9, 0xE7, 0xC4, 0x4C, 0x15, 0x22, 0x0F, 0xE5, 0x1F, 0xE9, 0x2B, 0xF8,
+  0x57, 0xFF, 0xC9, 0x9E, 0xB2, 0x3F, 0xF4, 0x4F, 0x77, 0x8F, 0xFD, 0xA7, 0x69, 0xDE, 0x36, 0x55,
+  0x13, 0xFF, 0xE9, 0x79, 0x65, 0x7F, 0x42, 0x14, 0xCA, 0x5A, 0xB6, 0xF5, 0x5F, 0x99, 0x56, 0xBC,
+  0x6A, 0x29, 0xA2, 0xA6, 0xAA, 0x65, 0xF8, 0x07, 0x3A, 0xC6, 0xD6, 0x2F, 0xEC, 0x1F, 0xF3, 0x3F,
+  0xEE, 0x01, 0xC4, 0xCF, 0x3F, 0x9E, 0x1A, 0xFE, 0xF7, 0xFF, 0x07, 0xD3, 0xAF, 0xB9, 0x92, 0x67,
+  0xE6, 0x00, 0x00
 };
 
-const unsigned long css_shunk_buff_size = sizeof(css_shunk_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page shunk css resources, 58983 bytes (gzip 12643 bytes) */
+const web_res_t css_shunk_res =
+{
+  NULL,
+  0U,
+  css_shunk_buff_gz,
+  sizeof(css_shunk_buff_gz),
+  NULL,
+  "\"feded815ea21d5ff-gz\""
+};
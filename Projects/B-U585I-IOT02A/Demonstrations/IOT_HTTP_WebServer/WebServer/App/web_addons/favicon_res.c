@@ -16,268 +16,281 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
 /* Web page favicon resources buffer */
-const char favicon_buff[] =
+static const char favicon_buff[] =
 {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x03, 0x00, 0x00, 0x00, 0x44, 0xa4, 0x8a,
-  0xc6, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x00, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x52, 0x65, 0x61,
-  0x64, 0x79, 0x71, 0xc9, 0x65, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x50, 0x4c, 0x54, 0x45, 0x81, 0x91,
-  0xa5, 0x13, 0x31, 0x56, 0xef, 0xf1, 0xf4, 0x62, 0x76, 0x8f, 0xa0, 0xac, 0xbb, 0xd0, 0xd6, 0xdd,
-  0xdf, 0xe3, 0xe8, 0x32, 0x4c, 0x6d, 0x90, 0x9e, 0xb0, 0x52, 0x68, 0x83, 0xc0, 0xc8, 0xd2, 0x23,
-  0x3f, 0x62, 0xb0, 0xba, 0xc7, 0x72, 0x84, 0x9a, 0x42, 0x5a, 0x78, 0x03, 0x23, 0x4b, 0xff, 0xff,
-  0xff, 0x79, 0x3e, 0x8c, 0x82, 0x00, 0x00, 0x00, 0x11, 0x74, 0x52, 0x4e, 0x53, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x25, 0xad,
-  0x99, 0x62, 0x00, 0x00, 0x00, 0xc2, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xdc, 0x93, 0xdd, 0x16,
-  0x84, 0x20, 0x08, 0x84, 0x11, 0xcd, 0xb4, 0x1f, 0xe5, 0xfd, 0x9f, 0x76, 0x19, 0xb4, 0xad, 0x73,
-  0x36, 0xdb, 0xfb, 0xb8, 0x19, 0xcb, 0x4f, 0x18, 0xc8, 0x48, 0xfe, 0x04, 0xbd, 0x09, 0x88, 0x94,
-  0xcb, 0x7d, 0x34, 0x20, 0xd4, 0x51, 0x38, 0x03, 0x96, 0xe1, 0x7e, 0x25, 0x03, 0x32, 0x56, 0xd3,
-  0xd8, 0x43, 0xd4, 0xfd, 0xf0, 0x64, 0x72, 0xaf, 0x75, 0x7e, 0xec, 0xc2, 0x69, 0x01, 0x91, 0x74,
-  0xa9, 0xac, 0xfc, 0x04, 0x2d, 0x06, 0xa0, 0x85, 0x5d, 0x64, 0xbb, 0x5a, 0x13, 0xf1, 0xd0, 0x64,
-  0x40, 0xd1, 0xd5, 0xca, 0x0a, 0xba, 0x2f, 0xc0, 0xc2, 0x5d, 0x15, 0xb0, 0x5c, 0xd5, 0x6b, 0xa9,
-  0xe9, 0x20, 0x7c, 0x2f, 0xe8, 0xcd, 0x83, 0xef, 0x2f, 0xf9, 0x24, 0x16, 0x91, 0xb5, 0xab, 0x10,
-  0x1f, 0xc7, 0x66, 0xee, 0xce, 0x60, 0x71, 0xe9, 0xaa, 0xc0, 0x69, 0x1e, 0x84, 0xa5, 0x0b, 0x6d,
-  0x74, 0x6d, 0x36, 0xb4, 0x9e, 0xde, 0x73, 0x2b, 0xed, 0xd8, 0x46, 0x07, 0x05, 0x70, 0x89, 0x4d,
-  0x1f, 0x9b, 0x35, 0x08, 0x5a, 0xff, 0xbd, 0x0f, 0xc8, 0x17, 0x6d, 0x74, 0xd5, 0xc5, 0x1b, 0xc0,
-  0xb7, 0xe9, 0x61, 0x74, 0x2e, 0xdc, 0xdc, 0x28, 0xc2, 0x0d, 0xd1, 0xaf, 0xba, 0x95, 0x9c, 0xe2,
-  0x1b, 0xff, 0x8b, 0x71, 0x7c, 0x04, 0x18, 0x00, 0x62, 0x78, 0x3a, 0x66, 0xfb, 0x38, 0xb6, 0x2e,
-  0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 0x2a, 0x00, 0x00, 0x78,
-  0x99, 0xb2, 0x3c, 0xb9, 0x24, 0x39, 0x45, 0x81, 0x5b, 0x08, 0x2d, 0x71, 0x07, 0x57, 0x57, 0x2e,
-  0x1e, 0x28, 0xce, 0x49, 0x17, 0x2b, 0x14, 0x36, 0x61, 0x02, 0x61, 0x9a, 0x40, 0x2e, 0xc2, 0x79,
-  0x99, 0x19, 0x32, 0x81, 0x34, 0x0f, 0xe0, 0xf3, 0xcc, 0x00, 0x00, 0xa0, 0x91, 0x15, 0x11, 0xe0,
-  0x83, 0xf3, 0xfd, 0x78, 0xce, 0x0e, 0xae, 0xce, 0xce, 0x36, 0x8e, 0xb6, 0x0e, 0x5f, 0x2d, 0xea,
-  0xbf, 0x06, 0xff, 0x22, 0x62, 0x62, 0xe3, 0xfe, 0xe5, 0xcf, 0xab, 0x70, 0x40, 0x00, 0x00, 0xe1,
-  0x74, 0x7e, 0xd1, 0xfe, 0x2c, 0x2f, 0xb3, 0x1a, 0x80, 0x3b, 0x06, 0x80, 0x6d, 0xfe, 0xa2, 0x25,
-  0xee, 0x04, 0x68, 0x5e, 0x0b, 0xa0, 0x75, 0xf7, 0x8b, 0x66, 0xb2, 0x0f, 0x40, 0xb5, 0x00, 0xa0,
-  0xe9, 0xda, 0x57, 0xf3, 0x70, 0xf8, 0x7e, 0x3c, 0x3c, 0x45, 0xa1, 0x90, 0xb9, 0xd9, 0xd9, 0xe5,
-  0xe4, 0xe4, 0xd8, 0x4a, 0xc4, 0x42, 0x5b, 0x61, 0xca, 0x57, 0x7d, 0xfe, 0x67, 0xc2, 0x5f, 0xc0,
-  0x57, 0xfd, 0x6c, 0xf9, 0x7e, 0x3c, 0xfc, 0xf7, 0xf5, 0xe0, 0xbe, 0xe2, 0x24, 0x81, 0x32, 0x5d,
-  0x81, 0x47, 0x04, 0xf8, 0xe0, 0xc2, 0xcc, 0xf4, 0x4c, 0xa5, 0x1c, 0xcf, 0x92, 0x09, 0x84, 0x62,
-  0xdc, 0xe6, 0x8f, 0x47, 0xfc, 0xb7, 0x0b, 0xff, 0xfc, 0x1d, 0xd3, 0x22, 0xc4, 0x49, 0x62, 0xb9,
-  0x58, 0x2a, 0x14, 0xe3, 0x51, 0x12, 0x71, 0x8e, 0x44, 0x9a, 0x8c, 0xf3, 0x32, 0xa5, 0x22, 0x89,
-  0x42, 0x92, 0x29, 0xc5, 0x25, 0xd2, 0xff, 0x64, 0xe2, 0xdf, 0x2c, 0xfb, 0x03, 0x3e, 0xdf, 0x35,
-  0x00, 0xb0, 0x6a, 0x3e, 0x01, 0x7b, 0x91, 0x2d, 0xa8, 0x5d, 0x63, 0x03, 0xf6, 0x4b, 0x27, 0x10,
-  0x58, 0x74, 0xc0, 0xe2, 0xf7, 0x00, 0x00, 0xf2, 0xbb, 0x6f, 0xc1, 0xd4, 0x28, 0x08, 0x03, 0x80,
-  0x68, 0x83, 0xe1, 0xcf, 0x77, 0xff, 0xef, 0x3f, 0xfd, 0x47, 0xa0, 0x25, 0x00, 0x80, 0x66, 0x49,
-  0x92, 0x71, 0x00, 0x00, 0x5e, 0x44, 0x24, 0x2e, 0x54, 0xca, 0xb3, 0x3f, 0xc7, 0x08, 0x00, 0x00,
-  0x44, 0xa0, 0x81, 0x2a, 0xb0, 0x41, 0x1b, 0xf4, 0xc1, 0x18, 0x2c, 0xc0, 0x06, 0x1c, 0xc1, 0x05,
-  0xdc, 0xc1, 0x0b, 0xfc, 0x60, 0x36, 0x84, 0x42, 0x24, 0xc4, 0xc2, 0x42, 0x10, 0x42, 0x0a, 0x64,
-  0x80, 0x1c, 0x72, 0x60, 0x29, 0xac, 0x82, 0x42, 0x28, 0x86, 0xcd, 0xb0, 0x1d, 0x2a, 0x60, 0x2f,
-  0xd4, 0x40, 0x1d, 0x34, 0xc0, 0x51, 0x68, 0x86, 0x93, 0x70, 0x0e, 0x2e, 0xc2, 0x55, 0xb8, 0x0e,
-  0x3d, 0x70, 0x0f, 0xfa, 0x61, 0x08, 0x9e, 0xc1, 0x28, 0xbc, 0x81, 0x09, 0x04, 0x41, 0xc8, 0x08,
-  0x13, 0x61, 0x21, 0xda, 0x88, 0x01, 0x62, 0x8a, 0x58, 0x23, 0x8e, 0x08, 0x17, 0x99, 0x85, 0xf8,
-  0x21, 0xc1, 0x48, 0x04, 0x12, 0x8b, 0x24, 0x20, 0xc9, 0x88, 0x14, 0x51, 0x22, 0x4b, 0x91, 0x35,
-  0x48, 0x31, 0x52, 0x8a, 0x54, 0x20, 0x55, 0x48, 0x1d, 0xf2, 0x3d, 0x72, 0x02, 0x39, 0x87, 0x5c,
-  0x46, 0xba, 0x91, 0x3b, 0xc8, 0x00, 0x32, 0x82, 0xfc, 0x86, 0xbc, 0x47, 0x31, 0x94, 0x81, 0xb2,
-  0x51, 0x3d, 0xd4, 0x0c, 0xb5, 0x43, 0xb9, 0xa8, 0x37, 0x1a, 0x84, 0x46, 0xa2, 0x0b, 0xd0, 0x64,
-  0x74, 0x31, 0x9a, 0x8f, 0x16, 0xa0, 0x9b, 0xd0, 0x72, 0xb4, 0x1a, 0x3d, 0x8c, 0x36, 0xa1, 0xe7,
-  0xd0, 0xab, 0x68, 0x0f, 0xda, 0x8f, 0x3e, 0x43, 0xc7, 0x30, 0xc0, 0xe8, 0x18, 0x07, 0x33, 0xc4,
-  0x6c, 0x30, 0x2e, 0xc6, 0xc3, 0x42, 0xb1, 0x38, 0x2c, 0x09, 0x93, 0x63, 0xcb, 0xb1, 0x22, 0xac,
-  0x0c, 0xab, 0xc6, 0x1a, 0xb0, 0x56, 0xac, 0x03, 0xbb, 0x89, 0xf5, 0x63, 0xcf, 0xb1, 0x77, 0x04,
-  0x12, 0x81, 0x45, 0xc0, 0x09, 0x36, 0x04, 0x77, 0x42, 0x20, 0x61, 0x1e, 0x41, 0x48, 0x58, 0x4c,
-  0x58, 0x4e, 0xd8, 0x48, 0xa8, 0x20, 0x1c, 0x24, 0x34, 0x11, 0xda, 0x09, 0x37, 0x09, 0x03, 0x84,
-  0x51, 0xc2, 0x27, 0x22, 0x93, 0xa8, 0x4b, 0xb4, 0x26, 0xba, 0x11, 0xf9, 0xc4, 0x18, 0x62, 0x32,
-  0x31, 0x87, 0x58, 0x48, 0x2c, 0x23, 0xd6, 0x12, 0x8f, 0x13, 0x2f, 0x10, 0x7b, 0x88, 0x43, 0xc4,
-  0x37, 0x24, 0x12, 0x89, 0x43, 0x32, 0x27, 0xb9, 0x90, 0x02, 0x49, 0xb1, 0xa4, 0x54, 0xd2, 0x12,
-  0xd2, 0x46, 0xd2, 0x6e, 0x52, 0x23, 0xe9, 0x2c, 0xa9, 0x9b, 0x34, 0x48, 0x1a, 0x23, 0x93, 0xc9,
-  0xda, 0x64, 0x6b, 0xb2, 0x07, 0x39, 0x94, 0x2c, 0x20, 0x2b, 0xc8, 0x85, 0xe4, 0x9d, 0xe4, 0xc3,
-  0xe4, 0x33, 0xe4, 0x1b, 0xe4, 0x21, 0xf2, 0x5b, 0x0a, 0x9d, 0x62, 0x40, 0x71, 0xa4, 0xf8, 0x53,
-  0xe2, 0x28, 0x52, 0xca, 0x6a, 0x4a, 0x19, 0xe5, 0x10, 0xe5, 0x34, 0xe5, 0x06, 0x65, 0x98, 0x32,
-  0x41, 0x55, 0xa3, 0x9a, 0x52, 0xdd, 0xa8, 0xa1, 0x54, 0x11, 0x35, 0x8f, 0x5a, 0x42, 0xad, 0xa1,
-  0xb6, 0x52, 0xaf, 0x51, 0x87, 0xa8, 0x13, 0x34, 0x75, 0x9a, 0x39, 0xcd, 0x83, 0x16, 0x49, 0x4b,
-  0xa5, 0xad, 0xa2, 0x95, 0xd3, 0x1a, 0x68, 0x17, 0x68, 0xf7, 0x69, 0xaf, 0xe8, 0x74, 0xba, 0x11,
-  0xdd, 0x95, 0x1e, 0x4e, 0x97, 0xd0, 0x57, 0xd2, 0xcb, 0xe9, 0x47, 0xe8, 0x97, 0xe8, 0x03, 0xf4,
-  0x77, 0x0c, 0x0d, 0x86, 0x15, 0x83, 0xc7, 0x88, 0x67, 0x28, 0x19, 0x9b, 0x18, 0x07, 0x18, 0x67,
-  0x19, 0x77, 0x18, 0xaf, 0x98, 0x4c, 0xa6, 0x19, 0xd3, 0x8b, 0x19, 0xc7, 0x54, 0x30, 0x37, 0x31,
-  0xeb, 0x98, 0xe7, 0x99, 0x0f, 0x99, 0x6f, 0x55, 0x58, 0x2a, 0xb6, 0x2a, 0x7c, 0x15, 0x91, 0xca,
-  0x0a, 0x95, 0x4a, 0x95, 0x26, 0x95, 0x1b, 0x2a, 0x2f, 0x54, 0xa9, 0xaa, 0xa6, 0xaa, 0xde, 0xaa,
-  0x0b, 0x55, 0xf3, 0x55, 0xcb, 0x54, 0x8f, 0xa9, 0x5e, 0x53, 0x7d, 0xae, 0x46, 0x55, 0x33, 0x53,
-  0xe3, 0xa9, 0x09, 0xd4, 0x96, 0xab, 0x55, 0xaa, 0x9d, 0x50, 0xeb, 0x53, 0x1b, 0x53, 0x67, 0xa9,
-  0x3b, 0xa8, 0x87, 0xaa, 0x67, 0xa8, 0x6f, 0x54, 0x3f, 0xa4, 0x7e, 0x59, 0xfd, 0x89, 0x06, 0x59,
-  0xc3, 0x4c, 0xc3, 0x4f, 0x43, 0xa4, 0x51, 0xa0, 0xb1, 0x5f, 0xe3, 0xbc, 0xc6, 0x20, 0x0b, 0x63,
-  0x19, 0xb3, 0x78, 0x2c, 0x21, 0x6b, 0x0d, 0xab, 0x86, 0x75, 0x81, 0x35, 0xc4, 0x26, 0xb1, 0xcd,
-  0xd9, 0x7c, 0x76, 0x2a, 0xbb, 0x98, 0xfd, 0x1d, 0xbb, 0x8b, 0x3d, 0xaa, 0xa9, 0xa1, 0x39, 0x43,
-  0x33, 0x4a, 0x33, 0x57, 0xb3, 0x52, 0xf3, 0x94, 0x66, 0x3f, 0x07, 0xe3, 0x98, 0x71, 0xf8, 0x9c,
-  0x74, 0x4e, 0x09, 0xe7, 0x28, 0xa7, 0x97, 0xf3, 0x7e, 0x8a, 0xde, 0x14, 0xef, 0x29, 0xe2, 0x29,
-  0x1b, 0xa6, 0x34, 0x4c, 0xb9, 0x31, 0x65, 0x5c, 0x6b, 0xaa, 0x96, 0x97, 0x96, 0x58, 0xab, 0x48,
-  0xab, 0x51, 0xab, 0x47, 0xeb, 0xbd, 0x36, 0xae, 0xed, 0xa7, 0x9d, 0xa6, 0xbd, 0x45, 0xbb, 0x59,
-  0xfb, 0x81, 0x0e, 0x41, 0xc7, 0x4a, 0x27, 0x5c, 0x27, 0x47, 0x67, 0x8f, 0xce, 0x05, 0x9d, 0xe7,
-  0x53, 0xd9, 0x53, 0xdd, 0xa7, 0x0a, 0xa7, 0x16, 0x4d, 0x3d, 0x3a, 0xf5, 0xae, 0x2e, 0xaa, 0x6b,
-  0xa5, 0x1b, 0xa1, 0xbb, 0x44, 0x77, 0xbf, 0x6e, 0xa7, 0xee, 0x98, 0x9e, 0xbe, 0x5e, 0x80, 0x9e,
-  0x4c, 0x6f, 0xa7, 0xde, 0x79, 0xbd, 0xe7, 0xfa, 0x1c, 0x7d, 0x2f, 0xfd, 0x54, 0xfd, 0x6d, 0xfa,
-  0xa7, 0xf5, 0x47, 0x0c, 0x58, 0x06, 0xb3, 0x0c, 0x24, 0x06, 0xdb, 0x0c, 0xce, 0x18, 0x3c, 0xc5,
-  0x35, 0x71, 0x6f, 0x3c, 0x1d, 0x2f, 0xc7, 0xdb, 0xf1, 0x51, 0x43, 0x5d, 0xc3, 0x40, 0x43, 0xa5,
-  0x61, 0x95, 0x61, 0x97, 0xe1, 0x84, 0x91, 0xb9, 0xd1, 0x3c, 0xa3, 0xd5, 0x46, 0x8d, 0x46, 0x0f,
-  0x8c, 0x69, 0xc6, 0x5c, 0xe3, 0x24, 0xe3, 0x6d, 0xc6, 0x6d, 0xc6, 0xa3, 0x26, 0x06, 0x26, 0x21,
-  0x26, 0x4b, 0x4d, 0xea, 0x4d, 0xee, 0x9a, 0x52, 0x4d, 0xb9, 0xa6, 0x29, 0xa6, 0x3b, 0x4c, 0x3b,
-  0x4c, 0xc7, 0xcd, 0xcc, 0xcd, 0xa2, 0xcd, 0xd6, 0x99, 0x35, 0x9b, 0x3d, 0x31, 0xd7, 0x32, 0xe7,
-  0x9b, 0xe7, 0x9b, 0xd7, 0x9b, 0xdf, 0xb7, 0x60, 0x5a, 0x78, 0x5a, 0x2c, 0xb6, 0xa8, 0xb6, 0xb8,
-  0x65, 0x49, 0xb2, 0xe4, 0x5a, 0xa6, 0x59, 0xee, 0xb6, 0xbc, 0x6e, 0x85, 0x5a, 0x39, 0x59, 0xa5,
-  0x58, 0x55, 0x5a, 0x5d, 0xb3, 0x46, 0xad, 0x9d, 0xad, 0x25, 0xd6, 0xbb, 0xad, 0xbb, 0xa7, 0x11,
-  0xa7, 0xb9, 0x4e, 0x93, 0x4e, 0xab, 0x9e, 0xd6, 0x67, 0xc3, 0xb0, 0xf1, 0xb6, 0xc9, 0xb6, 0xa9,
-  0xb7, 0x19, 0xb0, 0xe5, 0xd8, 0x06, 0xdb, 0xae, 0xb6, 0x6d, 0xb6, 0x7d, 0x61, 0x67, 0x62, 0x17,
-  0x67, 0xb7, 0xc5, 0xae, 0xc3, 0xee, 0x93, 0xbd, 0x93, 0x7d, 0xba, 0x7d, 0x8d, 0xfd, 0x3d, 0x07,
-  0x0d, 0x87, 0xd9, 0x0e, 0xab, 0x1d, 0x5a, 0x1d, 0x7e, 0x73, 0xb4, 0x72, 0x14, 0x3a, 0x56, 0x3a,
-  0xde, 0x9a, 0xce, 0x9c, 0xee, 0x3f, 0x7d, 0xc5, 0xf4, 0x96, 0xe9, 0x2f, 0x67, 0x58, 0xcf, 0x10,
-  0xcf, 0xd8, 0x33, 0xe3, 0xb6, 0x13, 0xcb, 0x29, 0xc4, 0x69, 0x9d, 0x53, 0x9b, 0xd3, 0x47, 0x67,
-  0x17, 0x67, 0xb9, 0x73, 0x83, 0xf3, 0x88, 0x8b, 0x89, 0x4b, 0x82, 0xcb, 0x2e, 0x97, 0x3e, 0x2e,
-  0x9b, 0x1b, 0xc6, 0xdd, 0xc8, 0xbd, 0xe4, 0x4a, 0x74, 0xf5, 0x71, 0x5d, 0xe1, 0x7a, 0xd2, 0xf5,
-  0x9d, 0x9b, 0xb3, 0x9b, 0xc2, 0xed, 0xa8, 0xdb, 0xaf, 0xee, 0x36, 0xee, 0x69, 0xee, 0x87, 0xdc,
-  0x9f, 0xcc, 0x34, 0x9f, 0x29, 0x9e, 0x59, 0x33, 0x73, 0xd0, 0xc3, 0xc8, 0x43, 0xe0, 0x51, 0xe5,
-  0xd1, 0x3f, 0x0b, 0x9f, 0x95, 0x30, 0x6b, 0xdf, 0xac, 0x7e, 0x4f, 0x43, 0x4f, 0x81, 0x67, 0xb5,
-  0xe7, 0x23, 0x2f, 0x63, 0x2f, 0x91, 0x57, 0xad, 0xd7, 0xb0, 0xb7, 0xa5, 0x77, 0xaa, 0xf7, 0x61,
-  0xef, 0x17, 0x3e, 0xf6, 0x3e, 0x72, 0x9f, 0xe3, 0x3e, 0xe3, 0x3c, 0x37, 0xde, 0x32, 0xde, 0x59,
-  0x5f, 0xcc, 0x37, 0xc0, 0xb7, 0xc8, 0xb7, 0xcb, 0x4f, 0xc3, 0x6f, 0x9e, 0x5f, 0x85, 0xdf, 0x43,
-  0x7f, 0x23, 0xff, 0x64, 0xff, 0x7a, 0xff, 0xd1, 0x00, 0xa7, 0x80, 0x25, 0x01, 0x67, 0x03, 0x89,
-  0x81, 0x41, 0x81, 0x5b, 0x02, 0xfb, 0xf8, 0x7a, 0x7c, 0x21, 0xbf, 0x8e, 0x3f, 0x3a, 0xdb, 0x65,
-  0xf6, 0xb2, 0xd9, 0xed, 0x41, 0x8c, 0xa0, 0xb9, 0x41, 0x15, 0x41, 0x8f, 0x82, 0xad, 0x82, 0xe5,
-  0xc1, 0xad, 0x21, 0x68, 0xc8, 0xec, 0x90, 0xad, 0x21, 0xf7, 0xe7, 0x98, 0xce, 0x91, 0xce, 0x69,
-  0x0e, 0x85, 0x50, 0x7e, 0xe8, 0xd6, 0xd0, 0x07, 0x61, 0xe6, 0x61, 0x8b, 0xc3, 0x7e, 0x0c, 0x27,
-  0x85, 0x87, 0x85, 0x57, 0x86, 0x3f, 0x8e, 0x70, 0x88, 0x58, 0x1a, 0xd1, 0x31, 0x97, 0x35, 0x77,
-  0xd1, 0xdc, 0x43, 0x73, 0xdf, 0x44, 0xfa, 0x44, 0x96, 0x44, 0xde, 0x9b, 0x67, 0x31, 0x4f, 0x39,
-  0xaf, 0x2d, 0x4a, 0x35, 0x2a, 0x3e, 0xaa, 0x2e, 0x6a, 0x3c, 0xda, 0x37, 0xba, 0x34, 0xba, 0x3f,
-  0xc6, 0x2e, 0x66, 0x59, 0xcc, 0xd5, 0x58, 0x9d, 0x58, 0x49, 0x6c, 0x4b, 0x1c, 0x39, 0x2e, 0x2a,
-  0xae, 0x36, 0x6e, 0x6c, 0xbe, 0xdf, 0xfc, 0xed, 0xf3, 0x87, 0xe2, 0x9d, 0xe2, 0x0b, 0xe3, 0x7b,
-  0x17, 0x98, 0x2f, 0xc8, 0x5d, 0x70, 0x79, 0xa1, 0xce, 0xc2, 0xf4, 0x85, 0xa7, 0x16, 0xa9, 0x2e,
-  0x12, 0x2c, 0x3a, 0x96, 0x40, 0x4c, 0x88, 0x4e, 0x38, 0x94, 0xf0, 0x41, 0x10, 0x2a, 0xa8, 0x16,
-  0x8c, 0x25, 0xf2, 0x13, 0x77, 0x25, 0x8e, 0x0a, 0x79, 0xc2, 0x1d, 0xc2, 0x67, 0x22, 0x2f, 0xd1,
-  0x36, 0xd1, 0x88, 0xd8, 0x43, 0x5c, 0x2a, 0x1e, 0x4e, 0xf2, 0x48, 0x2a, 0x4d, 0x7a, 0x92, 0xec,
-  0x91, 0xbc, 0x35, 0x79, 0x24, 0xc5, 0x33, 0xa5, 0x2c, 0xe5, 0xb9, 0x84, 0x27, 0xa9, 0x90, 0xbc,
-  0x4c, 0x0d, 0x4c, 0xdd, 0x9b, 0x3a, 0x9e, 0x16, 0x9a, 0x76, 0x20, 0x6d, 0x32, 0x3d, 0x3a, 0xbd,
-  0x31, 0x83, 0x92, 0x91, 0x90, 0x71, 0x42, 0xaa, 0x21, 0x4d, 0x93, 0xb6, 0x67, 0xea, 0x67, 0xe6,
-  0x66, 0x76, 0xcb, 0xac, 0x65, 0x85, 0xb2, 0xfe, 0xc5, 0x6e, 0x8b, 0xb7, 0x2f, 0x1e, 0x95, 0x07,
-  0xc9, 0x6b, 0xb3, 0x90, 0xac, 0x05, 0x59, 0x2d, 0x0a, 0xb6, 0x42, 0xa6, 0xe8, 0x54, 0x5a, 0x28,
-  0xd7, 0x2a, 0x07, 0xb2, 0x67, 0x65, 0x57, 0x66, 0xbf, 0xcd, 0x89, 0xca, 0x39, 0x96, 0xab, 0x9e,
-  0x2b, 0xcd, 0xed, 0xcc, 0xb3, 0xca, 0xdb, 0x90, 0x37, 0x9c, 0xef, 0x9f, 0xff, 0xed, 0x12, 0xc2,
-  0x12, 0xe1, 0x92, 0xb6, 0xa5, 0x86, 0x4b, 0x57, 0x2d, 0x1d, 0x58, 0xe6, 0xbd, 0xac, 0x6a, 0x39,
-  0xb2, 0x3c, 0x71, 0x79, 0xdb, 0x0a, 0xe3, 0x15, 0x05, 0x2b, 0x86, 0x56, 0x06, 0xac, 0x3c, 0xb8,
-  0x8a, 0xb6, 0x2a, 0x6d, 0xd5, 0x4f, 0xab, 0xed, 0x57, 0x97, 0xae, 0x7e, 0xbd, 0x26, 0x7a, 0x4d,
-  0x6b, 0x81, 0x5e, 0xc1, 0xca, 0x82, 0xc1, 0xb5, 0x01, 0x6b, 0xeb, 0x0b, 0x55, 0x0a, 0xe5, 0x85,
-  0x7d, 0xeb, 0xdc, 0xd7, 0xed, 0x5d, 0x4f, 0x58, 0x2f, 0x59, 0xdf, 0xb5, 0x61, 0xfa, 0x86, 0x9d,
-  0x1b, 0x3e, 0x15, 0x89, 0x8a, 0xae, 0x14, 0xdb, 0x17, 0x97, 0x15, 0x7f, 0xd8, 0x28, 0xdc, 0x78,
-  0xe5, 0x1b, 0x87, 0x6f, 0xca, 0xbf, 0x99, 0xdc, 0x94, 0xb4, 0xa9, 0xab, 0xc4, 0xb9, 0x64, 0xcf,
-  0x66, 0xd2, 0x66, 0xe9, 0xe6, 0xde, 0x2d, 0x9e, 0x5b, 0x0e, 0x96, 0xaa, 0x97, 0xe6, 0x97, 0x0e,
-  0x6e, 0x0d, 0xd9, 0xda, 0xb4, 0x0d, 0xdf, 0x56, 0xb4, 0xed, 0xf5, 0xf6, 0x45, 0xdb, 0x2f, 0x97,
-  0xcd, 0x28, 0xdb, 0xbb, 0x83, 0xb6, 0x43, 0xb9, 0xa3, 0xbf, 0x3c, 0xb8, 0xbc, 0x65, 0xa7, 0xc9,
-  0xce, 0xcd, 0x3b, 0x3f, 0x54, 0xa4, 0x54, 0xf4, 0x54, 0xfa, 0x54, 0x36, 0xee, 0xd2, 0xdd, 0xb5,
-  0x61, 0xd7, 0xf8, 0x6e, 0xd1, 0xee, 0x1b, 0x7b, 0xbc, 0xf6, 0x34, 0xec, 0xd5, 0xdb, 0x5b, 0xbc,
-  0xf7, 0xfd, 0x3e, 0xc9, 0xbe, 0xdb, 0x55, 0x01, 0x55, 0x4d, 0xd5, 0x66, 0xd5, 0x65, 0xfb, 0x49,
-  0xfb, 0xb3, 0xf7, 0x3f, 0xae, 0x89, 0xaa, 0xe9, 0xf8, 0x96, 0xfb, 0x6d, 0x5d, 0xad, 0x4e, 0x6d,
-  0x71, 0xed, 0xc7, 0x03, 0xd2, 0x03, 0xfd, 0x07, 0x23, 0x0e, 0xb6, 0xd7, 0xb9, 0xd4, 0xd5, 0x1d,
-  0xd2, 0x3d, 0x54, 0x52, 0x8f, 0xd6, 0x2b, 0xeb, 0x47, 0x0e, 0xc7, 0x1f, 0xbe, 0xfe, 0x9d, 0xef,
-  0x77, 0x2d, 0x0d, 0x36, 0x0d, 0x55, 0x8d, 0x9c, 0xc6, 0xe2, 0x23, 0x70, 0x44, 0x79, 0xe4, 0xe9,
-  0xf7, 0x09, 0xdf, 0xf7, 0x1e, 0x0d, 0x3a, 0xda, 0x76, 0x8c, 0x7b, 0xac, 0xe1, 0x07, 0xd3, 0x1f,
-  0x76, 0x1d, 0x67, 0x1d, 0x2f, 0x6a, 0x42, 0x9a, 0xf2, 0x9a, 0x46, 0x9b, 0x53, 0x9a, 0xfb, 0x5b,
-  0x62, 0x5b, 0xba, 0x4f, 0xcc, 0x3e, 0xd1, 0xd6, 0xea, 0xde, 0x7a, 0xfc, 0x47, 0xdb, 0x1f, 0x0f,
-  0x9c, 0x34, 0x3c, 0x59, 0x79, 0x4a, 0xf3, 0x54, 0xc9, 0x69, 0xda, 0xe9, 0x82, 0xd3, 0x93, 0x67,
-  0xf2, 0xcf, 0x8c, 0x9d, 0x95, 0x9d, 0x7d, 0x7e, 0x2e, 0xf9, 0xdc, 0x60, 0xdb, 0xa2, 0xb6, 0x7b,
-  0xe7, 0x63, 0xce, 0xdf, 0x6a, 0x0f, 0x6f, 0xef, 0xba, 0x10, 0x74, 0xe1, 0xd2, 0x45, 0xff, 0x8b,
-  0xe7, 0x3b, 0xbc, 0x3b, 0xce, 0x5c, 0xf2, 0xb8, 0x74, 0xf2, 0xb2, 0xdb, 0xe5, 0x13, 0x57, 0xb8,
-  0x57, 0x9a, 0xaf, 0x3a, 0x5f, 0x6d, 0xea, 0x74, 0xea, 0x3c, 0xfe, 0x93, 0xd3, 0x4f, 0xc7, 0xbb,
-  0x9c, 0xbb, 0x9a, 0xae, 0xb9, 0x5c, 0x6b, 0xb9, 0xee, 0x7a, 0xbd, 0xb5, 0x7b, 0x66, 0xf7, 0xe9,
-  0x1b, 0x9e, 0x37, 0xce, 0xdd, 0xf4, 0xbd, 0x79, 0xf1, 0x16, 0xff, 0xd6, 0xd5, 0x9e, 0x39, 0x3d,
-  0xdd, 0xbd, 0xf3, 0x7a, 0x6f, 0xf7, 0xc5, 0xf7, 0xf5, 0xdf, 0x16, 0xdd, 0x7e, 0x72, 0x27, 0xfd,
-  0xce, 0xcb, 0xbb, 0xd9, 0x77, 0x27, 0xee, 0xad, 0xbc, 0x4f, 0xbc, 0x5f, 0xf4, 0x40, 0xed, 0x41,
-  0xd9, 0x43, 0xdd, 0x87, 0xd5, 0x3f, 0x5b, 0xfe, 0xdc, 0xd8, 0xef, 0xdc, 0x7f, 0x6a, 0xc0, 0x77,
-  0xa0, 0xf3, 0xd1, 0xdc, 0x47, 0xf7, 0x06, 0x85, 0x83, 0xcf, 0xfe, 0x91, 0xf5, 0x8f, 0x0f, 0x43,
-  0x05, 0x8f, 0x99, 0x8f, 0xcb, 0x86, 0x0d, 0x86, 0xeb, 0x9e, 0x38, 0x3e, 0x39, 0x39, 0xe2, 0x3f,
-  0x72, 0xfd, 0xe9, 0xfc, 0xa7, 0x43, 0xcf, 0x64, 0xcf, 0x26, 0x9e, 0x17, 0xfe, 0xa2, 0xfe, 0xcb,
-  0xae, 0x17, 0x16, 0x2f, 0x7e, 0xf8, 0xd5, 0xeb, 0xd7, 0xce, 0xd1, 0x98, 0xd1, 0xa1, 0x97, 0xf2,
-  0x97, 0x93, 0xbf, 0x6d, 0x7c, 0xa5, 0xfd, 0xea, 0xc0, 0xeb, 0x19, 0xaf, 0xdb, 0xc6, 0xc2, 0xc6,
-  0x1e, 0xbe, 0xc9, 0x78, 0x33, 0x31, 0x5e, 0xf4, 0x56, 0xfb, 0xed, 0xc1, 0x77, 0xdc, 0x77, 0x1d,
-  0xef, 0xa3, 0xdf, 0x0f, 0x4f, 0xe4, 0x7c, 0x20, 0x7f, 0x28, 0xff, 0x68, 0xf9, 0xb1, 0xf5, 0x53,
-  0xd0, 0xa7, 0xfb, 0x93, 0x19, 0x93, 0x93, 0xff, 0x04, 0x03, 0x98, 0xf3, 0xfc, 0x63, 0x33, 0x2d,
-  0xdb, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x80,
-  0x83, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x80, 0xe9, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea,
-  0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17, 0x6f, 0x92, 0x5f, 0xc5, 0x46, 0x00, 0x00, 0x05,
-  0x49, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xec, 0x97, 0x5b, 0x8c, 0x55, 0xd5, 0x19, 0xc7, 0x7f,
-  0xdf, 0x5a, 0x6b, 0x9f, 0x7d, 0xce, 0x99, 0x39, 0x03, 0x33, 0x82, 0x30, 0xe0, 0x08, 0x4e, 0x90,
-  0x71, 0x20, 0x58, 0x8b, 0x80, 0x90, 0x82, 0x63, 0xd1, 0x52, 0x2f, 0x68, 0x52, 0xdb, 0x10, 0x43,
-  0x22, 0x89, 0x97, 0xc8, 0x8b, 0x55, 0x1e, 0x9a, 0xf0, 0xa0, 0xc6, 0x4b, 0x7c, 0xa0, 0x4d, 0x5a,
-  0xab, 0xa9, 0x46, 0x93, 0xda, 0x42, 0x43, 0x8c, 0x41, 0x25, 0xad, 0x86, 0x96, 0x91, 0xe8, 0x08,
-  0x58, 0xb5, 0x53, 0xc4, 0x51, 0xc1, 0x91, 0xab, 0x30, 0x83, 0x9c, 0xb9, 0xe0, 0x5c, 0xce, 0x99,
-  0x39, 0xb7, 0xbd, 0xf7, 0x5a, 0x7d, 0xd8, 0x13, 0x8a, 0x81, 0x69, 0x7c, 0x20, 0xf1, 0xa1, 0xb3,
-  0x92, 0x9d, 0xb5, 0x92, 0x2f, 0x7b, 0xad, 0xdf, 0xf7, 0xad, 0x6f, 0xfd, 0xbf, 0xb5, 0xc4, 0x39,
-  0xc7, 0xf7, 0xd9, 0x14, 0xdf, 0x73, 0x9b, 0x00, 0x98, 0x00, 0x98, 0x00, 0x30, 0xff, 0xcb, 0x98,
-  0x1d, 0xc8, 0xdd, 0xdd, 0xda, 0x71, 0x7c, 0x7d, 0xd7, 0xe0, 0xe8, 0x6c, 0x94, 0x11, 0xa5, 0xb5,
-  0x43, 0x69, 0xb4, 0x12, 0x8c, 0x08, 0x5a, 0x2b, 0xb4, 0x08, 0x5a, 0x0b, 0x5a, 0x04, 0xa5, 0x00,
-  0x04, 0x6b, 0xc1, 0xe2, 0x88, 0x2c, 0x58, 0x17, 0xf7, 0x91, 0x03, 0x67, 0x2d, 0xb8, 0x88, 0x72,
-  0x25, 0x50, 0x0b, 0x67, 0x4f, 0xe9, 0x5e, 0x7d, 0xcd, 0x15, 0xd7, 0x8d, 0x0b, 0xd0, 0xde, 0x79,
-  0x7c, 0xd3, 0xc6, 0x2d, 0xbb, 0x36, 0x66, 0x0b, 0x0e, 0x4c, 0x92, 0x00, 0x05, 0x9e, 0x8f, 0x78,
-  0x49, 0x7c, 0xa3, 0x48, 0x7b, 0x0a, 0xdf, 0xd3, 0xf8, 0x9e, 0x26, 0x69, 0x84, 0xa4, 0xa7, 0x48,
-  0x68, 0x85, 0x73, 0x8e, 0x52, 0x68, 0xe3, 0x2f, 0x70, 0x94, 0x03, 0x4b, 0x29, 0x88, 0x28, 0x86,
-  0x96, 0x30, 0x08, 0xb1, 0x41, 0x89, 0x62, 0x7e, 0x98, 0x17, 0xef, 0x6d, 0xf9, 0x60, 0xdc, 0x08,
-  0x8c, 0x16, 0x4b, 0x3f, 0x7a, 0xf2, 0x2f, 0xad, 0x1b, 0xfb, 0xf3, 0x21, 0x09, 0x2f, 0x41, 0x7d,
-  0x46, 0x58, 0xd4, 0x78, 0x29, 0x99, 0x64, 0x02, 0x27, 0x0a, 0x11, 0x50, 0x12, 0x7b, 0x2d, 0x2a,
-  0x1e, 0x2b, 0x01, 0x85, 0x80, 0x80, 0x75, 0xb1, 0xe7, 0x8e, 0x78, 0xec, 0x1c, 0x58, 0xc6, 0xfa,
-  0x28, 0x24, 0xe5, 0xcd, 0x70, 0x37, 0x2d, 0xb8, 0xe2, 0x85, 0x71, 0x01, 0xda, 0x3e, 0x3b, 0x76,
-  0xdf, 0xf1, 0xbe, 0x1c, 0x26, 0x95, 0xe2, 0xc7, 0xcd, 0xf5, 0x3c, 0xb6, 0xa6, 0x85, 0x29, 0xb5,
-  0x93, 0x2e, 0xe6, 0xd6, 0x77, 0x00, 0xbb, 0x2f, 0x08, 0xe0, 0xa0, 0xe1, 0xad, 0xf6, 0x43, 0x3f,
-  0x8b, 0xa2, 0x88, 0xcb, 0xeb, 0x6a, 0x78, 0x7a, 0xdd, 0xcd, 0x64, 0x52, 0x89, 0x8b, 0x9d, 0x7b,
-  0x2f, 0x3b, 0xe7, 0x22, 0x11, 0x39, 0x1f, 0xe0, 0x50, 0x76, 0x78, 0x4d, 0x7b, 0xe7, 0x89, 0xc9,
-  0x4a, 0x60, 0xc9, 0xbc, 0xc6, 0xb3, 0x8b, 0xff, 0xfb, 0xc8, 0x29, 0xda, 0xbe, 0xe8, 0xc6, 0x4f,
-  0x24, 0x50, 0x5a, 0x83, 0xd2, 0x28, 0xa5, 0x11, 0xa5, 0xc6, 0x12, 0x50, 0x10, 0x11, 0x02, 0x6b,
-  0x59, 0x39, 0x77, 0x3a, 0x4d, 0xd3, 0xe3, 0x88, 0xbd, 0xfd, 0xc9, 0x51, 0xf6, 0x77, 0x0d, 0x90,
-  0x4a, 0x25, 0x89, 0x1c, 0x2c, 0x6e, 0xbc, 0xf4, 0xcc, 0x8a, 0x2b, 0xa7, 0xbf, 0x3e, 0xde, 0x29,
-  0xf0, 0x5b, 0x3f, 0x3e, 0xbc, 0x6e, 0x34, 0x97, 0x43, 0x79, 0x09, 0x26, 0x57, 0xa7, 0xce, 0x1a,
-  0x8e, 0x74, 0x9d, 0xe6, 0x99, 0x37, 0x76, 0x33, 0xb9, 0x6e, 0x2a, 0xc6, 0x4f, 0x22, 0xc6, 0x43,
-  0x3c, 0x1f, 0x31, 0x1e, 0x46, 0x2b, 0x3c, 0x25, 0x28, 0xa5, 0xd0, 0x95, 0x51, 0x6e, 0x6c, 0xac,
-  0x05, 0x60, 0x70, 0x38, 0xc7, 0x6f, 0x5b, 0x3f, 0xe7, 0x54, 0x90, 0xc4, 0xd8, 0x88, 0x52, 0x61,
-  0x84, 0x05, 0x33, 0x6a, 0xb6, 0x03, 0xbd, 0x22, 0x72, 0x3e, 0x40, 0x29, 0xb4, 0x2b, 0xdb, 0xda,
-  0x3f, 0xbd, 0xda, 0x57, 0x16, 0x87, 0xe5, 0xcb, 0x13, 0xd9, 0xb3, 0xb6, 0xb5, 0x37, 0x2e, 0x26,
-  0x8c, 0xe0, 0x37, 0x3b, 0xf6, 0xe3, 0x4b, 0x82, 0x84, 0x11, 0xd0, 0x0e, 0xd1, 0x0e, 0xb4, 0x42,
-  0x29, 0x45, 0x31, 0x88, 0xb8, 0x7e, 0x46, 0x9a, 0xb9, 0x33, 0xa7, 0xc6, 0xb9, 0xf4, 0x45, 0x37,
-  0x5f, 0x17, 0x84, 0xda, 0x2a, 0x45, 0xa5, 0x5c, 0xa1, 0x71, 0x8a, 0x89, 0x56, 0xcc, 0xad, 0xff,
-  0xf3, 0xb8, 0x42, 0xb4, 0xf3, 0xd3, 0x13, 0xf7, 0x1d, 0x38, 0x74, 0x8c, 0xa4, 0xd1, 0xa4, 0x3c,
-  0xc5, 0xbe, 0x03, 0x87, 0xd9, 0xbc, 0xbb, 0x73, 0xcc, 0x2a, 0xac, 0x5b, 0xb5, 0x84, 0x27, 0xee,
-  0x6a, 0x21, 0x88, 0x22, 0xca, 0xa5, 0x22, 0x44, 0x15, 0x5c, 0x50, 0xc1, 0x05, 0x65, 0x6c, 0x10,
-  0x10, 0x94, 0x8b, 0xdc, 0xb1, 0xa4, 0x09, 0xc6, 0xbc, 0xdb, 0xf9, 0xe5, 0x00, 0x29, 0xad, 0x70,
-  0x41, 0x99, 0xbe, 0xc1, 0x41, 0xae, 0x9f, 0x33, 0xe5, 0xc3, 0xa4, 0xef, 0xb7, 0x5f, 0x50, 0x88,
-  0x22, 0xc7, 0x95, 0xbf, 0xdb, 0xbe, 0xeb, 0x96, 0xec, 0xd0, 0x00, 0x65, 0x26, 0x93, 0xf2, 0x93,
-  0x18, 0xe3, 0xd8, 0xf4, 0xca, 0xdf, 0x19, 0x29, 0x16, 0x79, 0xf0, 0xe6, 0x85, 0x00, 0xfc, 0x62,
-  0x59, 0x33, 0x35, 0x35, 0x35, 0x3c, 0xb5, 0x6d, 0x0f, 0x41, 0xa9, 0x84, 0xe7, 0xbb, 0x58, 0x5c,
-  0xa2, 0x32, 0xcd, 0xf5, 0x75, 0x2c, 0x6b, 0x6a, 0x88, 0xb7, 0xac, 0x2f, 0xc7, 0x9e, 0x93, 0xfd,
-  0x0c, 0x97, 0x4b, 0xe4, 0x83, 0x00, 0x15, 0x16, 0xb9, 0x75, 0x71, 0xf3, 0xcb, 0xc4, 0x27, 0xf2,
-  0xfc, 0x08, 0xfc, 0xf3, 0xc0, 0xd1, 0x75, 0xfb, 0xda, 0xdb, 0xd3, 0x49, 0x4f, 0x31, 0x5a, 0x2e,
-  0x73, 0xa6, 0x50, 0xa0, 0xa7, 0x50, 0xa0, 0x6f, 0x24, 0xc7, 0xaf, 0xb6, 0xbc, 0xc9, 0x86, 0xcd,
-  0x3b, 0x88, 0x6c, 0x04, 0xc0, 0xaa, 0xf9, 0x33, 0x79, 0xe8, 0xf6, 0xeb, 0xe8, 0x1a, 0x2d, 0x72,
-  0x6a, 0x24, 0x4f, 0xd7, 0x48, 0x9e, 0xc3, 0xc3, 0x39, 0x56, 0x5f, 0x3b, 0x0b, 0xdf, 0xc4, 0x53,
-  0xfe, 0xf1, 0x5f, 0x47, 0x39, 0xd4, 0xdb, 0x4f, 0x7f, 0xb1, 0xc0, 0xe8, 0x70, 0x8e, 0xd5, 0x0b,
-  0xaf, 0xea, 0x6a, 0xba, 0x6c, 0xda, 0xdf, 0xc6, 0x93, 0xe2, 0xcc, 0x9f, 0x76, 0xbc, 0xb7, 0xb6,
-  0x98, 0xcf, 0x63, 0xa4, 0x06, 0xa2, 0x31, 0xd9, 0x8c, 0x2c, 0x68, 0x0f, 0x31, 0x1e, 0xcf, 0xfe,
-  0x75, 0x2f, 0x03, 0x43, 0x39, 0x5e, 0x58, 0x7f, 0x27, 0xd5, 0x29, 0x9f, 0x9b, 0xe6, 0x37, 0x90,
-  0xf0, 0x85, 0xee, 0xa1, 0x1c, 0x18, 0xc3, 0xa4, 0xaa, 0x34, 0x2d, 0x4d, 0xf5, 0x00, 0xf4, 0xe4,
-  0x0a, 0x6c, 0xde, 0xfb, 0x19, 0x5a, 0x22, 0x74, 0x25, 0x20, 0x99, 0x50, 0x6c, 0x58, 0x79, 0xf5,
-  0x36, 0x60, 0xf0, 0x82, 0x00, 0xbd, 0x43, 0x23, 0xb7, 0x1d, 0xec, 0xee, 0x6f, 0x9c, 0x33, 0xa7,
-  0x11, 0xa3, 0x0d, 0xa2, 0x14, 0x4e, 0x69, 0x44, 0x6b, 0x9c, 0x68, 0x50, 0x0a, 0x2b, 0x9a, 0x3d,
-  0x9d, 0xa7, 0xe8, 0x3a, 0x33, 0xc4, 0xbc, 0x86, 0x69, 0xd4, 0xfa, 0x9a, 0x69, 0x2a, 0xe0, 0x74,
-  0x58, 0x21, 0x2c, 0x95, 0xb8, 0x63, 0x7e, 0x3d, 0x0d, 0x93, 0xd2, 0x00, 0x6c, 0xdb, 0xbb, 0x9f,
-  0xbe, 0x6c, 0x96, 0xaa, 0xaa, 0x34, 0x85, 0x62, 0x91, 0x65, 0x0b, 0x9a, 0x2a, 0x8b, 0x2e, 0xbf,
-  0x64, 0xcb, 0x05, 0x8b, 0x91, 0x73, 0x8e, 0xba, 0xea, 0xd4, 0x03, 0x3b, 0x37, 0x3d, 0x8c, 0x56,
-  0x8a, 0x6f, 0x5d, 0x51, 0xbf, 0x75, 0x61, 0x75, 0x28, 0x11, 0x6a, 0xd2, 0x49, 0x00, 0x8e, 0xf5,
-  0x0e, 0x70, 0xb2, 0x77, 0x00, 0xdf, 0x3a, 0xb4, 0x75, 0xdc, 0xbf, 0x72, 0x51, 0x9c, 0x4b, 0x91,
-  0xe5, 0xb5, 0x8f, 0x3a, 0xf1, 0xb0, 0xe8, 0x4a, 0x09, 0x37, 0x92, 0x67, 0xcd, 0x0f, 0x67, 0xb7,
-  0x2a, 0xe1, 0xc0, 0xb9, 0x53, 0x3f, 0xf4, 0xe8, 0x4b, 0x3c, 0xf7, 0xf4, 0x7a, 0x8c, 0xb5, 0x76,
-  0xa9, 0x67, 0xf4, 0x0d, 0x97, 0x64, 0xd2, 0xdf, 0x59, 0xc6, 0x4a, 0x95, 0x90, 0x27, 0xb7, 0xfe,
-  0x83, 0xbe, 0x9e, 0x3e, 0x30, 0x86, 0x96, 0x1f, 0xcc, 0x65, 0xe9, 0x55, 0xb3, 0x00, 0xd8, 0xd5,
-  0x71, 0x84, 0xf7, 0x3f, 0x3f, 0x86, 0x36, 0x9a, 0x5c, 0x2e, 0xe0, 0xe7, 0x4b, 0x9b, 0xbf, 0xb9,
-  0x67, 0xf9, 0xfc, 0xc7, 0xcf, 0xfd, 0xff, 0x97, 0x8f, 0xbc, 0xc8, 0x1f, 0x7e, 0xbf, 0x2d, 0x06,
-  0xd0, 0x5a, 0x2f, 0x07, 0x46, 0x80, 0xf0, 0xbb, 0x2c, 0x1e, 0x45, 0x96, 0xad, 0xef, 0xee, 0xa3,
-  0xbb, 0xe7, 0x1b, 0x7e, 0xb2, 0xa8, 0x99, 0xa0, 0x1c, 0xb2, 0xe1, 0xf6, 0x15, 0x18, 0x1d, 0x27,
-  0xdf, 0x91, 0xd3, 0xfd, 0x2c, 0x9f, 0x33, 0x43, 0xa6, 0xd6, 0xd6, 0x84, 0x3f, 0x5d, 0xd8, 0xd4,
-  0xbe, 0xfe, 0x96, 0x65, 0x8f, 0x01, 0x9f, 0x04, 0x41, 0xc8, 0xf3, 0x9b, 0x77, 0xf0, 0xc1, 0x47,
-  0x07, 0x79, 0xed, 0x8d, 0x36, 0x98, 0x54, 0x15, 0x1f, 0xee, 0xec, 0x68, 0x90, 0x99, 0x9e, 0x36,
-  0x75, 0x71, 0x19, 0xc0, 0x01, 0x72, 0x11, 0xb4, 0x5e, 0x80, 0x00, 0x38, 0xdd, 0xda, 0xb6, 0x9f,
-  0x5f, 0x3f, 0xf3, 0x2a, 0x3d, 0x03, 0xc3, 0x74, 0x1e, 0xfc, 0x0a, 0xac, 0x43, 0x55, 0xa7, 0xe2,
-  0xea, 0xf8, 0xf5, 0x9b, 0x98, 0xb5, 0x3b, 0xb3, 0xc5, 0xcb, 0x32, 0xe6, 0x24, 0x40, 0x68, 0x1d,
-  0xf3, 0xea, 0x7c, 0x66, 0x56, 0x1b, 0x6e, 0x98, 0x99, 0x66, 0x56, 0x5a, 0x78, 0xeb, 0x9d, 0x8f,
-  0xe9, 0xec, 0x3c, 0x01, 0x5a, 0x91, 0xc9, 0xa4, 0xf1, 0x13, 0x1e, 0x83, 0x83, 0x79, 0x10, 0x41,
-  0x24, 0x26, 0xb6, 0xf6, 0xbf, 0xb9, 0xa2, 0x24, 0xae, 0x09, 0x0e, 0xc7, 0xae, 0xdd, 0x1d, 0xbc,
-  0xbb, 0xb7, 0x83, 0x28, 0x5f, 0x80, 0x84, 0x41, 0xaa, 0x52, 0x28, 0xe0, 0xdc, 0xc7, 0x90, 0x4c,
-  0xbc, 0x8c, 0x26, 0x00, 0xfe, 0xef, 0x01, 0xfe, 0x33, 0x00, 0x06, 0x3c, 0x35, 0x30, 0xad, 0xb0,
-  0x66, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+  0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x03, 0x00, 0x00, 0x00, 0x44, 0xA4, 0x8A,
+  0xC6, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72,
+  0x65, 0x00, 0x41, 0x64, 0x6F, 0x62, 0x65, 0x20, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x52, 0x65, 0x61,
+  0x64, 0x79, 0x71, 0xC9, 0x65, 0x3C, 0x00, 0x00, 0x00, 0x33, 0x50, 0x4C, 0x54, 0x45, 0x81, 0x91,
+  0xA5, 0x13, 0x31, 0x56, 0xEF, 0xF1, 0xF4, 0x62, 0x76, 0x8F, 0xA0, 0xAC, 0xBB, 0xD0, 0xD6, 0xDD,
+  0xDF, 0xE3, 0xE8, 0x32, 0x4C, 0x6D, 0x90, 0x9E, 0xB0, 0x52, 0x68, 0x83, 0xC0, 0xC8, 0xD2, 0x23,
+  0x3F, 0x62, 0xB0, 0xBA, 0xC7, 0x72, 0x84, 0x9A, 0x42, 0x5A, 0x78, 0x03, 0x23, 0x4B, 0xFF, 0xFF,
+  0xFF, 0x79, 0x3E, 0x8C, 0x82, 0x00, 0x00, 0x00, 0x11, 0x74, 0x52, 0x4E, 0x53, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x25, 0xAD,
+  0x99, 0x62, 0x00, 0x00, 0x00, 0xC2, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xDC, 0x93, 0xDD, 0x16,
+  0x84, 0x20, 0x08, 0x84, 0x11, 0xCD, 0xB4, 0x1F, 0xE5, 0xFD, 0x9F, 0x76, 0x19, 0xB4, 0xAD, 0x73,
+  0x36, 0xDB, 0xFB, 0xB8, 0x19, 0xCB, 0x4F, 0x18, 0xC8, 0x48, 0xFE, 0x04, 0xBD, 0x09, 0x88, 0x94,
+  0xCB, 0x7D, 0x34, 0x20, 0xD4, 0x51, 0x38, 0x03, 0x96, 0xE1, 0x7E, 0x25, 0x03, 0x32, 0x56, 0xD3,
+  0xD8, 0x43, 0xD4, 0xFD, 0xF0, 0x64, 0x72, 0xAF, 0x75, 0x7E, 0xEC, 0xC2, 0x69, 0x01, 0x91, 0x74,
+  0xA9, 0xAC, 0xFC, 0x04, 0x2D, 0x06, 0xA0, 0x85, 0x5D, 0x64, 0xBB, 0x5A, 0x13, 0xF1, 0xD0, 0x64,
+  0x40, 0xD1, 0xD5, 0xCA, 0x0A, 0xBA, 0x2F, 0xC0, 0xC2, 0x5D, 0x15, 0xB0, 0x5C, 0xD5, 0x6B, 0xA9,
+  0xE9, 0x20, 0x7C, 0x2F, 0xE8, 0xCD, 0x83, 0xEF, 0x2F, 0xF9, 0x24, 0x16, 0x91, 0xB5, 0xAB, 0x10,
+  0x1F, 0xC7, 0x66, 0xEE, 0xCE, 0x60, 0x71, 0xE9, 0xAA, 0xC0, 0x69, 0x1E, 0x84, 0xA5, 0x0B, 0x6D,
+  0x74, 0x6D, 0x36, 0xB4, 0x9E, 0xDE, 0x73, 0x2B, 0xED, 0xD8, 0x46, 0x07, 0x05, 0x70, 0x89, 0x4D,
+  0x1F, 0x9B, 0x35, 0x08, 0x5A, 0xFF, 0xBD, 0x0F, 0xC8, 0x17, 0x6D, 0x74, 0xD5, 0xC5, 0x1B, 0xC0,
+  0xB7, 0xE9, 0x61, 0x74, 0x2E, 0xDC, 0xDC, 0x28, 0xC2, 0x0D, 0xD1, 0xAF, 0xBA, 0x95, 0x9C, 0xE2,
+  0x1B, 0xFF, 0x8B, 0x71, 0x7C, 0x04, 0x18, 0x00, 0x62, 0x78, 0x3A, 0x66, 0xFB, 0x38, 0xB6, 0x2E,
+  0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 0x2A, 0x00, 0x00, 0x78,
+  0x99, 0xB2, 0x3C, 0xB9, 0x24, 0x39, 0x45, 0x81, 0x5B, 0x08, 0x2D, 0x71, 0x07, 0x57, 0x57, 0x2E,
+  0x1E, 0x28, 0xCE, 0x49, 0x17, 0x2B, 0x14, 0x36, 0x61, 0x02, 0x61, 0x9A, 0x40, 0x2E, 0xC2, 0x79,
+  0x99, 0x19, 0x32, 0x81, 0x34, 0x0F, 0xE0, 0xF3, 0xCC, 0x00, 0x00, 0xA0, 0x91, 0x15, 0x11, 0xE0,
+  0x83, 0xF3, 0xFD, 0x78, 0xCE, 0x0E, 0xAE, 0xCE, 0xCE, 0x36, 0x8E, 0xB6, 0x0E, 0x5F, 0x2D, 0xEA,
+  0xBF, 0x06, 0xFF, 0x22, 0x62, 0x62, 0xE3, 0xFE, 0xE5, 0xCF, 0xAB, 0x70, 0x40, 0x00, 0x00, 0xE1,
+  0x74, 0x7E, 0xD1, 0xFE, 0x2C, 0x2F, 0xB3, 0x1A, 0x80, 0x3B, 0x06, 0x80, 0x6D, 0xFE, 0xA2, 0x25,
+  0xEE, 0x04, 0x68, 0x5E, 0x0B, 0xA0, 0x75, 0xF7, 0x8B, 0x66, 0xB2, 0x0F, 0x40, 0xB5, 0x00, 0xA0,
+  0xE9, 0xDA, 0x57, 0xF3, 0x70, 0xF8, 0x7E, 0x3C, 0x3C, 0x45, 0xA1, 0x90, 0xB9, 0xD9, 0xD9, 0xE5,
+  0xE4, 0xE4, 0xD8, 0x4A, 0xC4, 0x42, 0x5B, 0x61, 0xCA, 0x57, 0x7D, 0xFE, 0x67, 0xC2, 0x5F, 0xC0,
+  0x57, 0xFD, 0x6C, 0xF9, 0x7E, 0x3C, 0xFC, 0xF7, 0xF5, 0xE0, 0xBE, 0xE2, 0x24, 0x81, 0x32, 0x5D,
+  0x81, 0x47, 0x04, 0xF8, 0xE0, 0xC2, 0xCC, 0xF4, 0x4C, 0xA5, 0x1C, 0xCF, 0x92, 0x09, 0x84, 0x62,
+  0xDC, 0xE6, 0x8F, 0x47, 0xFC, 0xB7, 0x0B, 0xFF, 0xFC, 0x1D, 0xD3, 0x22, 0xC4, 0x49, 0x62, 0xB9,
+  0x58, 0x2A, 0x14, 0xE3, 0x51, 0x12, 0x71, 0x8E, 0x44, 0x9A, 0x8C, 0xF3, 0x32, 0xA5, 0x22, 0x89,
+  0x42, 0x92, 0x29, 0xC5, 0x25, 0xD2, 0xFF, 0x64, 0xE2, 0xDF, 0x2C, 0xFB, 0x03, 0x3E, 0xDF, 0x35,
+  0x00, 0xB0, 0x6A, 0x3E, 0x01, 0x7B, 0x91, 0x2D, 0xA8, 0x5D, 0x63, 0x03, 0xF6, 0x4B, 0x27, 0x10,
+  0x58, 0x74, 0xC0, 0xE2, 0xF7, 0x00, 0x00, 0xF2, 0xBB, 0x6F, 0xC1, 0xD4, 0x28, 0x08, 0x03, 0x80,
+  0x68, 0x83, 0xE1, 0xCF, 0x77, 0xFF, 0xEF, 0x3F, 0xFD, 0x47, 0xA0, 0x25, 0x00, 0x80, 0x66, 0x49,
+  0x92, 0x71, 0x00, 0x00, 0x5E, 0x44, 0x24, 0x2E, 0x54, 0xCA, 0xB3, 0x3F, 0xC7, 0x08, 0x00, 0x00,
+  0x44, 0xA0, 0x81, 0x2A, 0xB0, 0x41, 0x1B, 0xF4, 0xC1, 0x18, 0x2C, 0xC0, 0x06, 0x1C, 0xC1, 0x05,
+  0xDC, 0xC1, 0x0B, 0xFC, 0x60, 0x36, 0x84, 0x42, 0x24, 0xC4, 0xC2, 0x42, 0x10, 0x42, 0x0A, 0x64,
+  0x80, 0x1C, 0x72, 0x60, 0x29, 0xAC, 0x82, 0x42, 0x28, 0x86, 0xCD, 0xB0, 0x1D, 0x2A, 0x60, 0x2F,
+  0xD4, 0x40, 0x1D, 0x34, 0xC0, 0x51, 0x68, 0x86, 0x93, 0x70, 0x0E, 0x2E, 0xC2, 0x55, 0xB8, 0x0E,
+  0x3D, 0x70, 0x0F, 0xFA, 0x61, 0x08, 0x9E, 0xC1, 0x28, 0xBC, 0x81, 0x09, 0x04, 0x41, 0xC8, 0x08,
+  0x13, 0x61, 0x21, 0xDA, 0x88, 0x01, 0x62, 0x8A, 0x58, 0x23, 0x8E, 0x08, 0x17, 0x99, 0x85, 0xF8,
+  0x21, 0xC1, 0x48, 0x04, 0x12, 0x8B, 0x24, 0x20, 0xC9, 0x88, 0x14, 0x51, 0x22, 0x4B, 0x91, 0x35,
+  0x48, 0x31, 0x52, 0x8A, 0x54, 0x20, 0x55, 0x48, 0x1D, 0xF2, 0x3D, 0x72, 0x02, 0x39, 0x87, 0x5C,
+  0x46, 0xBA, 0x91, 0x3B, 0xC8, 0x00, 0x32, 0x82, 0xFC, 0x86, 0xBC, 0x47, 0x31, 0x94, 0x81, 0xB2,
+  0x51, 0x3D, 0xD4, 0x0C, 0xB5, 0x43, 0xB9, 0xA8, 0x37, 0x1A, 0x84, 0x46, 0xA2, 0x0B, 0xD0, 0x64,
+  0x74, 0x31, 0x9A, 0x8F, 0x16, 0xA0, 0x9B, 0xD0, 0x72, 0xB4, 0x1A, 0x3D, 0x8C, 0x36, 0xA1, 0xE7,
+  0xD0, 0xAB, 0x68, 0x0F, 0xDA, 0x8F, 0x3E, 0x43, 0xC7, 0x30, 0xC0, 0xE8, 0x18, 0x07, 0x33, 0xC4,
+  0x6C, 0x30, 0x2E, 0xC6, 0xC3, 0x42, 0xB1, 0x38, 0x2C, 0x09, 0x93, 0x63, 0xCB, 0xB1, 0x22, 0xAC,
+  0x0C, 0xAB, 0xC6, 0x1A, 0xB0, 0x56, 0xAC, 0x03, 0xBB, 0x89, 0xF5, 0x63, 0xCF, 0xB1, 0x77, 0x04,
+  0x12, 0x81, 0x45, 0xC0, 0x09, 0x36, 0x04, 0x77, 0x42, 0x20, 0x61, 0x1E, 0x41, 0x48, 0x58, 0x4C,
+  0x58, 0x4E, 0xD8, 0x48, 0xA8, 0x20, 0x1C, 0x24, 0x34, 0x11, 0xDA, 0x09, 0x37, 0x09, 0x03, 0x84,
+  0x51, 0xC2, 0x27, 0x22, 0x93, 0xA8, 0x4B, 0xB4, 0x26, 0xBA, 0x11, 0xF9, 0xC4, 0x18, 0x62, 0x32,
+  0x31, 0x87, 0x58, 0x48, 0x2C, 0x23, 0xD6, 0x12, 0x8F, 0x13, 0x2F, 0x10, 0x7B, 0x88, 0x43, 0xC4,
+  0x37, 0x24, 0x12, 0x89, 0x43, 0x32, 0x27, 0xB9, 0x90, 0x02, 0x49, 0xB1, 0xA4, 0x54, 0xD2, 0x12,
+  0xD2, 0x46, 0xD2, 0x6E, 0x52, 0x23, 0xE9, 0x2C, 0xA9, 0x9B, 0x34, 0x48, 0x1A, 0x23, 0x93, 0xC9,
+  0xDA, 0x64, 0x6B, 0xB2, 0x07, 0x39, 0x94, 0x2C, 0x20, 0x2B, 0xC8, 0x85, 0xE4, 0x9D, 0xE4, 0xC3,
+  0xE4, 0x33, 0xE4, 0x1B, 0xE4, 0x21, 0xF2, 0x5B, 0x0A, 0x9D, 0x62, 0x40, 0x71, 0xA4, 0xF8, 0x53,
+  0xE2, 0x28, 0x52, 0xCA, 0x6A, 0x4A, 0x19, 0xE5, 0x10, 0xE5, 0x34, 0xE5, 0x06, 0x65, 0x98, 0x32,
+  0x41, 0x55, 0xA3, 0x9A, 0x52, 0xDD, 0xA8, 0xA1, 0x54, 0x11, 0x35, 0x8F, 0x5A, 0x42, 0xAD, 0xA1,
+  0xB6, 0x52, 0xAF, 0x51, 0x87, 0xA8, 0x13, 0x34, 0x75, 0x9A, 0x39, 0xCD, 0x83, 0x16, 0x49, 0x4B,
+  0xA5, 0xAD, 0xA2, 0x95, 0xD3, 0x1A, 0x68, 0x17, 0x68, 0xF7, 0x69, 0xAF, 0xE8, 0x74, 0xBA, 0x11,
+  0xDD, 0x95, 0x1E, 0x4E, 0x97, 0xD0, 0x57, 0xD2, 0xCB, 0xE9, 0x47, 0xE8, 0x97, 0xE8, 0x03, 0xF4,
+  0x77, 0x0C, 0x0D, 0x86, 0x15, 0x83, 0xC7, 0x88, 0x67, 0x28, 0x19, 0x9B, 0x18, 0x07, 0x18, 0x67,
+  0x19, 0x77, 0x18, 0xAF, 0x98, 0x4C, 0xA6, 0x19, 0xD3, 0x8B, 0x19, 0xC7, 0x54, 0x30, 0x37, 0x31,
+  0xEB, 0x98, 0xE7, 0x99, 0x0F, 0x99, 0x6F, 0x55, 0x58, 0x2A, 0xB6, 0x2A, 0x7C, 0x15, 0x91, 0xCA,
+  0x0A, 0x95, 0x4A, 0x95, 0x26, 0x95, 0x1B, 0x2A, 0x2F, 0x54, 0xA9, 0xAA, 0xA6, 0xAA, 0xDE, 0xAA,
+  0x0B, 0x55, 0xF3, 0x55, 0xCB, 0x54, 0x8F, 0xA9, 0x5E, 0x53, 0x7D, 0xAE, 0x46, 0x55, 0x33, 0x53,
+  0xE3, 0xA9, 0x09, 0xD4, 0x96, 0xAB, 0x55, 0xAA, 0x9D, 0x50, 0xEB, 0x53, 0x1B, 0x53, 0x67, 0xA9,
+  0x3B, 0xA8, 0x87, 0xAA, 0x67, 0xA8, 0x6F, 0x54, 0x3F, 0xA4, 0x7E, 0x59, 0xFD, 0x89, 0x06, 0x59,
+  0xC3, 0x4C, 0xC3, 0x4F, 0x43, 0xA4, 0x51, 0xA0, 0xB1, 0x5F, 0xE3, 0xBC, 0xC6, 0x20, 0x0B, 0x63,
+  0x19, 0xB3, 0x78, 0x2C, 0x21, 0x6B, 0x0D, 0xAB, 0x86, 0x75, 0x81, 0x35, 0xC4, 0x26, 0xB1, 0xCD,
+  0xD9, 0x7C, 0x76, 0x2A, 0xBB, 0x98, 0xFD, 0x1D, 0xBB, 0x8B, 0x3D, 0xAA, 0xA9, 0xA1, 0x39, 0x43,
+  0x33, 0x4A, 0x33, 0x57, 0xB3, 0x52, 0xF3, 0x94, 0x66, 0x3F, 0x07, 0xE3, 0x98, 0x71, 0xF8, 0x9C,
+  0x74, 0x4E, 0x09, 0xE7, 0x28, 0xA7, 0x97, 0xF3, 0x7E, 0x8A, 0xDE, 0x14, 0xEF, 0x29, 0xE2, 0x29,
+  0x1B, 0xA6, 0x34, 0x4C, 0xB9, 0x31, 0x65, 0x5C, 0x6B, 0xAA, 0x96, 0x97, 0x96, 0x58, 0xAB, 0x48,
+  0xAB, 0x51, 0xAB, 0x47, 0xEB, 0xBD, 0x36, 0xAE, 0xED, 0xA7, 0x9D, 0xA6, 0xBD, 0x45, 0xBB, 0x59,
+  0xFB, 0x81, 0x0E, 0x41, 0xC7, 0x4A, 0x27, 0x5C, 0x27, 0x47, 0x67, 0x8F, 0xCE, 0x05, 0x9D, 0xE7,
+  0x53, 0xD9, 0x53, 0xDD, 0xA7, 0x0A, 0xA7, 0x16, 0x4D, 0x3D, 0x3A, 0xF5, 0xAE, 0x2E, 0xAA, 0x6B,
+  0xA5, 0x1B, 0xA1, 0xBB, 0x44, 0x77, 0xBF, 0x6E, 0xA7, 0xEE, 0x98, 0x9E, 0xBE, 0x5E, 0x80, 0x9E,
+  0x4C, 0x6F, 0xA7, 0xDE, 0x79, 0xBD, 0xE7, 0xFA, 0x1C, 0x7D, 0x2F, 0xFD, 0x54, 0xFD, 0x6D, 0xFA,
+  0xA7, 0xF5, 0x47, 0x0C, 0x58, 0x06, 0xB3, 0x0C, 0x24, 0x06, 0xDB, 0x0C, 0xCE, 0x18, 0x3C, 0xC5,
+  0x35, 0x71, 0x6F, 0x3C, 0x1D, 0x2F, 0xC7, 0xDB, 0xF1, 0x51, 0x43, 0x5D, 0xC3, 0x40, 0x43, 0xA5,
+  0x61, 0x95, 0x61, 0x97, 0xE1, 0x84, 0x91, 0xB9, 0xD1, 0x3C, 0xA3, 0xD5, 0x46, 0x8D, 0x46, 0x0F,
+  0x8C, 0x69, 0xC6, 0x5C, 0xE3, 0x24, 0xE3, 0x6D, 0xC6, 0x6D, 0xC6, 0xA3, 0x26, 0x06, 0x26, 0x21,
+  0x26, 0x4B, 0x4D, 0xEA, 0x4D, 0xEE, 0x9A, 0x52, 0x4D, 0xB9, 0xA6, 0x29, 0xA6, 0x3B, 0x4C, 0x3B,
+  0x4C, 0xC7, 0xCD, 0xCC, 0xCD, 0xA2, 0xCD, 0xD6, 0x99, 0x35, 0x9B, 0x3D, 0x31, 0xD7, 0x32, 0xE7,
+  0x9B, 0xE7, 0x9B, 0xD7, 0x9B, 0xDF, 0xB7, 0x60, 0x5A, 0x78, 0x5A, 0x2C, 0xB6, 0xA8, 0xB6, 0xB8,
+  0x65, 0x49, 0xB2, 0xE4, 0x5A, 0xA6, 0x59, 0xEE, 0xB6, 0xBC, 0x6E, 0x85, 0x5A, 0x39, 0x59, 0xA5,
+  0x58, 0x55, 0x5A, 0x5D, 0xB3, 0x46, 0xAD, 0x9D, 0xAD, 0x25, 0xD6, 0xBB, 0xAD, 0xBB, 0xA7, 0x11,
+  0xA7, 0xB9, 0x4E, 0x93, 0x4E, 0xAB, 0x9E, 0xD6, 0x67, 0xC3, 0xB0, 0xF1, 0xB6, 0xC9, 0xB6, 0xA9,
+  0xB7, 0x19, 0xB0, 0xE5, 0xD8, 0x06, 0xDB, 0xAE, 0xB6, 0x6D, 0xB6, 0x7D, 0x61, 0x67, 0x62, 0x17,
+  0x67, 0xB7, 0xC5, 0xAE, 0xC3, 0xEE, 0x93, 0xBD, 0x93, 0x7D, 0xBA, 0x7D, 0x8D, 0xFD, 0x3D, 0x07,
+  0x0D, 0x87, 0xD9, 0x0E, 0xAB, 0x1D, 0x5A, 0x1D, 0x7E, 0x73, 0xB4, 0x72, 0x14, 0x3A, 0x56, 0x3A,
+  0xDE, 0x9A, 0xCE, 0x9C, 0xEE, 0x3F, 0x7D, 0xC5, 0xF4, 0x96, 0xE9, 0x2F, 0x67, 0x58, 0xCF, 0x10,
+  0xCF, 0xD8, 0x33, 0xE3, 0xB6, 0x13, 0xCB, 0x29, 0xC4, 0x69, 0x9D, 0x53, 0x9B, 0xD3, 0x47, 0x67,
+  0x17, 0x67, 0xB9, 0x73, 0x83, 0xF3, 0x88, 0x8B, 0x89, 0x4B, 0x82, 0xCB, 0x2E, 0x97, 0x3E, 0x2E,
+  0x9B, 0x1B, 0xC6, 0xDD, 0xC8, 0xBD, 0xE4, 0x4A, 0x74, 0xF5, 0x71, 0x5D, 0xE1, 0x7A, 0xD2, 0xF5,
+  0x9D, 0x9B, 0xB3, 0x9B, 0xC2, 0xED, 0xA8, 0xDB, 0xAF, 0xEE, 0x36, 0xEE, 0x69, 0xEE, 0x87, 0xDC,
+  0x9F, 0xCC, 0x34, 0x9F, 0x29, 0x9E, 0x59, 0x33, 0x73, 0xD0, 0xC3, 0xC8, 0x43, 0xE0, 0x51, 0xE5,
+  0xD1, 0x3F, 0x0B, 0x9F, 0x95, 0x30, 0x6B, 0xDF, 0xAC, 0x7E, 0x4F, 0x43, 0x4F, 0x81, 0x67, 0xB5,
+  0xE7, 0x23, 0x2F, 0x63, 0x2F, 0x91, 0x57, 0xAD, 0xD7, 0xB0, 0xB7, 0xA5, 0x77, 0xAA, 0xF7, 0x61,
+  0xEF, 0x17, 0x3E, 0xF6, 0x3E, 0x72, 0x9F, 0xE3, 0x3E, 0xE3, 0x3C, 0x37, 0xDE, 0x32, 0xDE, 0x59,
+  0x5F, 0xCC, 0x37, 0xC0, 0xB7, 0xC8, 0xB7, 0xCB, 0x4F, 0xC3, 0x6F, 0x9E, 0x5F, 0x85, 0xDF, 0x43,
+  0x7F, 0x23, 0xFF, 0x64, 0xFF, 0x7A, 0xFF, 0xD1, 0x00, 0xA7, 0x80, 0x25, 0x01, 0x67, 0x03, 0x89,
+  0x81, 0x41, 0x81, 0x5B, 0x02, 0xFB, 0xF8, 0x7A, 0x7C, 0x21, 0xBF, 0x8E, 0x3F, 0x3A, 0xDB, 0x65,
+  0xF6, 0xB2, 0xD9, 0xED, 0x41, 0x8C, 0xA0, 0xB9, 0x41, 0x15, 0x41, 0x8F, 0x82, 0xAD, 0x82, 0xE5,
+  0xC1, 0xAD, 0x21, 0x68, 0xC8, 0xEC, 0x90, 0xAD, 0x21, 0xF7, 0xE7, 0x98, 0xCE, 0x91, 0xCE, 0x69,
+  0x0E, 0x85, 0x50, 0x7E, 0xE8, 0xD6, 0xD0, 0x07, 0x61, 0xE6, 0x61, 0x8B, 0xC3, 0x7E, 0x0C, 0x27,
+  0x85, 0x87, 0x85, 0x57, 0x86, 0x3F, 0x8E, 0x70, 0x88, 0x58, 0x1A, 0xD1, 0x31, 0x97, 0x35, 0x77,
+  0xD1, 0xDC, 0x43, 0x73, 0xDF, 0x44, 0xFA, 0x44, 0x96, 0x44, 0xDE, 0x9B, 0x67, 0x31, 0x4F, 0x39,
+  0xAF, 0x2D, 0x4A, 0x35, 0x2A, 0x3E, 0xAA, 0x2E, 0x6A, 0x3C, 0xDA, 0x37, 0xBA, 0x34, 0xBA, 0x3F,
+  0xC6, 0x2E, 0x66, 0x59, 0xCC, 0xD5, 0x58, 0x9D, 0x58, 0x49, 0x6C, 0x4B, 0x1C, 0x39, 0x2E, 0x2A,
+  0xAE, 0x36, 0x6E, 0x6C, 0xBE, 0xDF, 0xFC, 0xED, 0xF3, 0x87, 0xE2, 0x9D, 0xE2, 0x0B, 0xE3, 0x7B,
+  0x17, 0x98, 0x2F, 0xC8, 0x5D, 0x70, 0x79, 0xA1, 0xCE, 0xC2, 0xF4, 0x85, 0xA7, 0x16, 0xA9, 0x2E,
+  0x12, 0x2C, 0x3A, 0x96, 0x40, 0x4C, 0x88, 0x4E, 0x38, 0x94, 0xF0, 0x41, 0x10, 0x2A, 0xA8, 0x16,
+  0x8C, 0x25, 0xF2, 0x13, 0x77, 0x25, 0x8E, 0x0A, 0x79, 0xC2, 0x1D, 0xC2, 0x67, 0x22, 0x2F, 0xD1,
+  0x36, 0xD1, 0x88, 0xD8, 0x43, 0x5C, 0x2A, 0x1E, 0x4E, 0xF2, 0x48, 0x2A, 0x4D, 0x7A, 0x92, 0xEC,
+  0x91, 0xBC, 0x35, 0x79, 0x24, 0xC5, 0x33, 0xA5, 0x2C, 0xE5, 0xB9, 0x84, 0x27, 0xA9, 0x90, 0xBC,
+  0x4C, 0x0D, 0x4C, 0xDD, 0x9B, 0x3A, 0x9E, 0x16, 0x9A, 0x76, 0x20, 0x6D, 0x32, 0x3D, 0x3A, 0xBD,
+  0x31, 0x83, 0x92, 0x91, 0x90, 0x71, 0x42, 0xAA, 0x21, 0x4D, 0x93, 0xB6, 0x67, 0xEA, 0x67, 0xE6,
+  0x66, 0x76, 0xCB, 0xAC, 0x65, 0x85, 0xB2, 0xFE, 0xC5, 0x6E, 0x8B, 0xB7, 0x2F, 0x1E, 0x95, 0x07,
+  0xC9, 0x6B, 0xB3, 0x90, 0xAC, 0x05, 0x59, 0x2D, 0x0A, 0xB6, 0x42, 0xA6, 0xE8, 0x54, 0x5A, 0x28,
+  0xD7, 0x2A, 0x07, 0xB2, 0x67, 0x65, 0x57, 0x66, 0xBF, 0xCD, 0x89, 0xCA, 0x39, 0x96, 0xAB, 0x9E,
+  0x2B, 0xCD, 0xED, 0xCC, 0xB3, 0xCA, 0xDB, 0x90, 0x37, 0x9C, 0xEF, 0x9F, 0xFF, 0xED, 0x12, 0xC2,
+  0x12, 0xE1, 0x92, 0xB6, 0xA5, 0x86, 0x4B, 0x57, 0x2D, 0x1D, 0x58, 0xE6, 0xBD, 0xAC, 0x6A, 0x39,
+  0xB2, 0x3C, 0x71, 0x79, 0xDB, 0x0A, 0xE3, 0x15, 0x05, 0x2B, 0x86, 0x56, 0x06, 0xAC, 0x3C, 0xB8,
+  0x8A, 0xB6, 0x2A, 0x6D, 0xD5, 0x4F, 0xAB, 0xED, 0x57, 0x97, 0xAE, 0x7E, 0xBD, 0x26, 0x7A, 0x4D,
+  0x6B, 0x81, 0x5E, 0xC1, 0xCA, 0x82, 0xC1, 0xB5, 0x01, 0x6B, 0xEB, 0x0B, 0x55, 0x0A, 0xE5, 0x85,
+  0x7D, 0xEB, 0xDC, 0xD7, 0xED, 0x5D, 0x4F, 0x58, 0x2F, 0x59, 0xDF, 0xB5, 0x61, 0xFA, 0x86, 0x9D,
+  0x1B, 0x3E, 0x15, 0x89, 0x8A, 0xAE, 0x14, 0xDB, 0x17, 0x97, 0x15, 0x7F, 0xD8, 0x28, 0xDC, 0x78,
+  0xE5, 0x1B, 0x87, 0x6F, 0xCA, 0xBF, 0x99, 0xDC, 0x94, 0xB4, 0xA9, 0xAB, 0xC4, 0xB9, 0x64, 0xCF,
+  0x66, 0xD2, 0x66, 0xE9, 0xE6, 0xDE, 0x2D, 0x9E, 0x5B, 0x0E, 0x96, 0xAA, 0x97, 0xE6, 0x97, 0x0E,
+  0x6E, 0x0D, 0xD9, 0xDA, 0xB4, 0x0D, 0xDF, 0x56, 0xB4, 0xED, 0xF5, 0xF6, 0x45, 0xDB, 0x2F, 0x97,
+  0xCD, 0x28, 0xDB, 0xBB, 0x83, 0xB6, 0x43, 0xB9, 0xA3, 0xBF, 0x3C, 0xB8, 0xBC, 0x65, 0xA7, 0xC9,
+  0xCE, 0xCD, 0x3B, 0x3F, 0x54, 0xA4, 0x54, 0xF4, 0x54, 0xFA, 0x54, 0x36, 0xEE, 0xD2, 0xDD, 0xB5,
+  0x61, 0xD7, 0xF8, 0x6E, 0xD1, 0xEE, 0x1B, 0x7B, 0xBC, 0xF6, 0x34, 0xEC, 0xD5, 0xDB, 0x5B, 0xBC,
+  0xF7, 0xFD, 0x3E, 0xC9, 0xBE, 0xDB, 0x55, 0x01, 0x55, 0x4D, 0xD5, 0x66, 0xD5, 0x65, 0xFB, 0x49,
+  0xFB, 0xB3, 0xF7, 0x3F, 0xAE, 0x89, 0xAA, 0xE9, 0xF8, 0x96, 0xFB, 0x6D, 0x5D, 0xAD, 0x4E, 0x6D,
+  0x71, 0xED, 0xC7, 0x03, 0xD2, 0x03, 0xFD, 0x07, 0x23, 0x0E, 0xB6, 0xD7, 0xB9, 0xD4, 0xD5, 0x1D,
+  0xD2, 0x3D, 0x54, 0x52, 0x8F, 0xD6, 0x2B, 0xEB, 0x47, 0x0E, 0xC7, 0x1F, 0xBE, 0xFE, 0x9D, 0xEF,
+  0x77, 0x2D, 0x0D, 0x36, 0x0D, 0x55, 0x8D, 0x9C, 0xC6, 0xE2, 0x23, 0x70, 0x44, 0x79, 0xE4, 0xE9,
+  0xF7, 0x09, 0xDF, 0xF7, 0x1E, 0x0D, 0x3A, 0xDA, 0x76, 0x8C, 0x7B, 0xAC, 0xE1, 0x07, 0xD3, 0x1F,
+  0x76, 0x1D, 0x67, 0x1D, 0x2F, 0x6A, 0x42, 0x9A, 0xF2, 0x9A, 0x46, 0x9B, 0x53, 0x9A, 0xFB, 0x5B,
+  0x62, 0x5B, 0xBA, 0x4F, 0xCC, 0x3E, 0xD1, 0xD6, 0xEA, 0xDE, 0x7A, 0xFC, 0x47, 0xDB, 0x1F, 0x0F,
+  0x9C, 0x34, 0x3C, 0x59, 0x79, 0x4A, 0xF3, 0x54, 0xC9, 0x69, 0xDA, 0xE9, 0x82, 0xD3, 0x93, 0x67,
+  0xF2, 0xCF, 0x8C, 0x9D, 0x95, 0x9D, 0x7D, 0x7E, 0x2E, 0xF9, 0xDC, 0x60, 0xDB, 0xA2, 0xB6, 0x7B,
+  0xE7, 0x63, 0xCE, 0xDF, 0x6A, 0x0F, 0x6F, 0xEF, 0xBA, 0x10, 0x74, 0xE1, 0xD2, 0x45, 0xFF, 0x8B,
+  0xE7, 0x3B, 0xBC, 0x3B, 0xCE, 0x5C, 0xF2, 0xB8, 0x74, 0xF2, 0xB2, 0xDB, 0xE5, 0x13, 0x57, 0xB8,
+  0x57, 0x9A, 0xAF, 0x3A, 0x5F, 0x6D, 0xEA, 0x74, 0xEA, 0x3C, 0xFE, 0x93, 0xD3, 0x4F, 0xC7, 0xBB,
+  0x9C, 0xBB, 0x9A, 0xAE, 0xB9, 0x5C, 0x6B, 0xB9, 0xEE, 0x7A, 0xBD, 0xB5, 0x7B, 0x66, 0xF7, 0xE9,
+  0x1B, 0x9E, 0x37, 0xCE, 0xDD, 0xF4, 0xBD, 0x79, 0xF1, 0x16, 0xFF, 0xD6, 0xD5, 0x9E, 0x39, 0x3D,
+  0xDD, 0xBD, 0xF3, 0x7A, 0x6F, 0xF7, 0xC5, 0xF7, 0xF5, 0xDF, 0x16, 0xDD, 0x7E, 0x72, 0x27, 0xFD,
+  0xCE, 0xCB, 0xBB, 0xD9, 0x77, 0x27, 0xEE, 0xAD, 0xBC, 0x4F, 0xBC, 0x5F, 0xF4, 0x40, 0xED, 0x41,
+  0xD9, 0x43, 0xDD, 0x87, 0xD5, 0x3F, 0x5B, 0xFE, 0xDC, 0xD8, 0xEF, 0xDC, 0x7F, 0x6A, 0xC0, 0x77,
+  0xA0, 0xF3, 0xD1, 0xDC, 0x47, 0xF7, 0x06, 0x85, 0x83, 0xCF, 0xFE, 0x91, 0xF5, 0x8F, 0x0F, 0x43,
+  0x05, 0x8F, 0x99, 0x8F, 0xCB, 0x86, 0x0D, 0x86, 0xEB, 0x9E, 0x38, 0x3E, 0x39, 0x39, 0xE2, 0x3F,
+  0x72, 0xFD, 0xE9, 0xFC, 0xA7, 0x43, 0xCF, 0x64, 0xCF, 0x26, 0x9E, 0x17, 0xFE, 0xA2, 0xFE, 0xCB,
+  0xAE, 0x17, 0x16, 0x2F, 0x7E, 0xF8, 0xD5, 0xEB, 0xD7, 0xCE, 0xD1, 0x98, 0xD1, 0xA1, 0x97, 0xF2,
+  0x97, 0x93, 0xBF, 0x6D, 0x7C, 0xA5, 0xFD, 0xEA, 0xC0, 0xEB, 0x19, 0xAF, 0xDB, 0xC6, 0xC2, 0xC6,
+  0x1E, 0xBE, 0xC9, 0x78, 0x33, 0x31, 0x5E, 0xF4, 0x56, 0xFB, 0xED, 0xC1, 0x77, 0xDC, 0x77, 0x1D,
+  0xEF, 0xA3, 0xDF, 0x0F, 0x4F, 0xE4, 0x7C, 0x20, 0x7F, 0x28, 0xFF, 0x68, 0xF9, 0xB1, 0xF5, 0x53,
+  0xD0, 0xA7, 0xFB, 0x93, 0x19, 0x93, 0x93, 0xFF, 0x04, 0x03, 0x98, 0xF3, 0xFC, 0x63, 0x33, 0x2D,
+  0xDB, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4D, 0x00, 0x00, 0x7A, 0x25, 0x00, 0x00, 0x80,
+  0x83, 0x00, 0x00, 0xF9, 0xFF, 0x00, 0x00, 0x80, 0xE9, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xEA,
+  0x60, 0x00, 0x00, 0x3A, 0x98, 0x00, 0x00, 0x17, 0x6F, 0x92, 0x5F, 0xC5, 0x46, 0x00, 0x00, 0x05,
+  0x49, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xEC, 0x97, 0x5B, 0x8C, 0x55, 0xD5, 0x19, 0xC7, 0x7F,
+  0xDF, 0x5A, 0x6B, 0x9F, 0x7D, 0xCE, 0x99, 0x39, 0x03, 0x33, 0x82, 0x30, 0xE0, 0x08, 0x4E, 0x90,
+  0x71, 0x20, 0x58, 0x8B, 0x80, 0x90, 0x82, 0x63, 0xD1, 0x52, 0x2F, 0x68, 0x52, 0xDB, 0x10, 0x43,
+  0x22, 0x89, 0x97, 0xC8, 0x8B, 0x55, 0x1E, 0x9A, 0xF0, 0xA0, 0xC6, 0x4B, 0x7C, 0xA0, 0x4D, 0x5A,
+  0xAB, 0xA9, 0x46, 0x93, 0xDA, 0x42, 0x43, 0x8C, 0x41, 0x25, 0xAD, 0x86, 0x96, 0x91, 0xE8, 0x08,
+  0x58, 0xB5, 0x53, 0xC4, 0x51, 0xC1, 0x91, 0xAB, 0x30, 0x83, 0x9C, 0xB9, 0xE0, 0x5C, 0xCE, 0x99,
+  0x39, 0xB7, 0xBD, 0xF7, 0x5A, 0x7D, 0xD8, 0x13, 0x8A, 0x81, 0x69, 0x7C, 0x20, 0xF1, 0xA1, 0xB3,
+  0x92, 0x9D, 0xB5, 0x92, 0x2F, 0x7B, 0xAD, 0xDF, 0xF7, 0xAD, 0x6F, 0xFD, 0xBF, 0xB5, 0xC4, 0x39,
+  0xC7, 0xF7, 0xD9, 0x14, 0xDF, 0x73, 0x9B, 0x00, 0x98, 0x00, 0x98, 0x00, 0x30, 0xFF, 0xCB, 0x98,
+  0x1D, 0xC8, 0xDD, 0xDD, 0xDA, 0x71, 0x7C, 0x7D, 0xD7, 0xE0, 0xE8, 0x6C, 0x94, 0x11, 0xA5, 0xB5,
+  0x43, 0x69, 0xB4, 0x12, 0x8C, 0x08, 0x5A, 0x2B, 0xB4, 0x08, 0x5A, 0x0B, 0x5A, 0x04, 0xA5, 0x00,
+  0x04, 0x6B, 0xC1, 0xE2, 0x88, 0x2C, 0x58, 0x17, 0xF7, 0x91, 0x03, 0x67, 0x2D, 0xB8, 0x88, 0x72,
+  0x25, 0x50, 0x0B, 0x67, 0x4F, 0xE9, 0x5E, 0x7D, 0xCD, 0x15, 0xD7, 0x8D, 0x0B, 0xD0, 0xDE, 0x79,
+  0x7C, 0xD3, 0xC6, 0x2D, 0xBB, 0x36, 0x66, 0x0B, 0x0E, 0x4C, 0x92, 0x00, 0x05, 0x9E, 0x8F, 0x78,
+  0x49, 0x7C, 0xA3, 0x48, 0x7B, 0x0A, 0xDF, 0xD3, 0xF8, 0x9E, 0x26, 0x69, 0x84, 0xA4, 0xA7, 0x48,
+  0x68, 0x85, 0x73, 0x8E, 0x52, 0x68, 0xE3, 0x2F, 0x70, 0x94, 0x03, 0x4B, 0x29, 0x88, 0x28, 0x86,
+  0x96, 0x30, 0x08, 0xB1, 0x41, 0x89, 0x62, 0x7E, 0x98, 0x17, 0xEF, 0x6D, 0xF9, 0x60, 0xDC, 0x08,
+  0x8C, 0x16, 0x4B, 0x3F, 0x7A, 0xF2, 0x2F, 0xAD, 0x1B, 0xFB, 0xF3, 0x21, 0x09, 0x2F, 0x41, 0x7D,
+  0x46, 0x58, 0xD4, 0x78, 0x29, 0x99, 0x64, 0x02, 0x27, 0x0A, 0x11, 0x50, 0x12, 0x7B, 0x2D, 0x2A,
+  0x1E, 0x2B, 0x01, 0x85, 0x80, 0x80, 0x75, 0xB1, 0xE7, 0x8E, 0x78, 0xEC, 0x1C, 0x58, 0xC6, 0xFA,
+  0x28, 0x24, 0xE5, 0xCD, 0x70, 0x37, 0x2D, 0xB8, 0xE2, 0x85, 0x71, 0x01, 0xDA, 0x3E, 0x3B, 0x76,
+  0xDF, 0xF1, 0xBE, 0x1C, 0x26, 0x95, 0xE2, 0xC7, 0xCD, 0xF5, 0x3C, 0xB6, 0xA6, 0x85, 0x29, 0xB5,
+  0x93, 0x2E, 0xE6, 0xD6, 0x77, 0x00, 0xBB, 0x2F, 0x08, 0xE0, 0xA0, 0xE1, 0xAD, 0xF6, 0x43, 0x3F,
+  0x8B, 0xA2, 0x88, 0xCB, 0xEB, 0x6A, 0x78, 0x7A, 0xDD, 0xCD, 0x64, 0x52, 0x89, 0x8B, 0x9D, 0x7B,
+  0x2F, 0x3B, 0xE7, 0x22, 0x11, 0x39, 0x1F, 0xE0, 0x50, 0x76, 0x78, 0x4D, 0x7B, 0xE7, 0x89, 0xC9,
+  0x4A, 0x60, 0xC9, 0xBC, 0xC6, 0xB3, 0x8B, 0xFF, 0xFB, 0xC8, 0x29, 0xDA, 0xBE, 0xE8, 0xC6, 0x4F,
+  0x24, 0x50, 0x5A, 0x83, 0xD2, 0x28, 0xA5, 0x11, 0xA5, 0xC6, 0x12, 0x50, 0x10, 0x11, 0x02, 0x6B,
+  0x59, 0x39, 0x77, 0x3A, 0x4D, 0xD3, 0xE3, 0x88, 0xBD, 0xFD, 0xC9, 0x51, 0xF6, 0x77, 0x0D, 0x90,
+  0x4A, 0x25, 0x89, 0x1C, 0x2C, 0x6E, 0xBC, 0xF4, 0xCC, 0x8A, 0x2B, 0xA7, 0xBF, 0x3E, 0xDE, 0x29,
+  0xF0, 0x5B, 0x3F, 0x3E, 0xBC, 0x6E, 0x34, 0x97, 0x43, 0x79, 0x09, 0x26, 0x57, 0xA7, 0xCE, 0x1A,
+  0x8E, 0x74, 0x9D, 0xE6, 0x99, 0x37, 0x76, 0x33, 0xB9, 0x6E, 0x2A, 0xC6, 0x4F, 0x22, 0xC6, 0x43,
+  0x3C, 0x1F, 0x31, 0x1E, 0x46, 0x2B, 0x3C, 0x25, 0x28, 0xA5, 0xD0, 0x95, 0x51, 0x6E, 0x6C, 0xAC,
+  0x05, 0x60, 0x70, 0x38, 0xC7, 0x6F, 0x5B, 0x3F, 0xE7, 0x54, 0x90, 0xC4, 0xD8, 0x88, 0x52, 0x61,
+  0x84, 0x05, 0x33, 0x6A, 0xB6, 0x03, 0xBD, 0x22, 0x72, 0x3E, 0x40, 0x29, 0xB4, 0x2B, 0xDB, 0xDA,
+  0x3F, 0xBD, 0xDA, 0x57, 0x16, 0x87, 0xE5, 0xCB, 0x13, 0xD9, 0xB3, 0xB6, 0xB5, 0x37, 0x2E, 0x26,
+  0x8C, 0xE0, 0x37, 0x3B, 0xF6, 0xE3, 0x4B, 0x82, 0x84, 0x11, 0xD0, 0x0E, 0xD1, 0x0E, 0xB4, 0x42,
+  0x29, 0x45, 0x31, 0x88, 0xB8, 0x7E, 0x46, 0x9A, 0xB9, 0x33, 0xA7, 0xC6, 0xB9, 0xF4, 0x45, 0x37,
+  0x5F, 0x17, 0x84, 0xDA, 0x2A, 0x45, 0xA5, 0x5C, 0xA1, 0x71, 0x8A, 0x89, 0x56, 0xCC, 0xAD, 0xFF,
+  0xF3, 0xB8, 0x42, 0xB4, 0xF3, 0xD3, 0x13, 0xF7, 0x1D, 0x38, 0x74, 0x8C, 0xA4, 0xD1, 0xA4, 0x3C,
+  0xC5, 0xBE, 0x03, 0x87, 0xD9, 0xBC, 0xBB, 0x73, 0xCC, 0x2A, 0xAC, 0x5B, 0xB5, 0x84, 0x27, 0xEE,
+  0x6A, 0x21, 0x88, 0x22, 0xCA, 0xA5, 0x22, 0x44, 0x15, 0x5C, 0x50, 0xC1, 0x05, 0x65, 0x6C, 0x10,
+  0x10, 0x94, 0x8B, 0xDC, 0xB1, 0xA4, 0x09, 0xC6, 0xBC, 0xDB, 0xF9, 0xE5, 0x00, 0x29, 0xAD, 0x70,
+  0x41, 0x99, 0xBE, 0xC1, 0x41, 0xAE, 0x9F, 0x33, 0xE5, 0xC3, 0xA4, 0xEF, 0xB7, 0x5F, 0x50, 0x88,
+  0x22, 0xC7, 0x95, 0xBF, 0xDB, 0xBE, 0xEB, 0x96, 0xEC, 0xD0, 0x00, 0x65, 0x26, 0x93, 0xF2, 0x93,
+  0x18, 0xE3, 0xD8, 0xF4, 0xCA, 0xDF, 0x19, 0x29, 0x16, 0x79, 0xF0, 0xE6, 0x85, 0x00, 0xFC, 0x62,
+  0x59, 0x33, 0x35, 0x35, 0x35, 0x3C, 0xB5, 0x6D, 0x0F, 0x41, 0xA9, 0x84, 0xE7, 0xBB, 0x58, 0x5C,
+  0xA2, 0x32, 0xCD, 0xF5, 0x75, 0x2C, 0x6B, 0x6A, 0x88, 0xB7, 0xAC, 0x2F, 0xC7, 0x9E, 0x93, 0xFD,
+  0x0C, 0x97, 0x4B, 0xE4, 0x83, 0x00, 0x15, 0x16, 0xB9, 0x75, 0x71, 0xF3, 0xCB, 0xC4, 0x27, 0xF2,
+  0xFC, 0x08, 0xFC, 0xF3, 0xC0, 0xD1, 0x75, 0xFB, 0xDA, 0xDB, 0xD3, 0x49, 0x4F, 0x31, 0x5A, 0x2E,
+  0x73, 0xA6, 0x50, 0xA0, 0xA7, 0x50, 0xA0, 0x6F, 0x24, 0xC7, 0xAF, 0xB6, 0xBC, 0xC9, 0x86, 0xCD,
+  0x3B, 0x88, 0x6C, 0x04, 0xC0, 0xAA, 0xF9, 0x33, 0x79, 0xE8, 0xF6, 0xEB, 0xE8, 0x1A, 0x2D, 0x72,
+  0x6A, 0x24, 0x4F, 0xD7, 0x48, 0x9E, 0xC3, 0xC3, 0x39, 0x56, 0x5F, 0x3B, 0x0B, 0xDF, 0xC4, 0x53,
+  0xFE, 0xF1, 0x5F, 0x47, 0x39, 0xD4, 0xDB, 0x4F, 0x7F, 0xB1, 0xC0, 0xE8, 0x70, 0x8E, 0xD5, 0x0B,
+  0xAF, 0xEA, 0x6A, 0xBA, 0x6C, 0xDA, 0xDF, 0xC6, 0x93, 0xE2, 0xCC, 0x9F, 0x76, 0xBC, 0xB7, 0xB6,
+  0x98, 0xCF, 0x63, 0xA4, 0x06, 0xA2, 0x31, 0xD9, 0x8C, 0x2C, 0x68, 0x0F, 0x31, 0x1E, 0xCF, 0xFE,
+  0x75, 0x2F, 0x03, 0x43, 0x39, 0x5E, 0x58, 0x7F, 0x27, 0xD5, 0x29, 0x9F, 0x9B, 0xE6, 0x37, 0x90,
+  0xF0, 0x85, 0xEE, 0xA1, 0x1C, 0x18, 0xC3, 0xA4, 0xAA, 0x34, 0x2D, 0x4D, 0xF5, 0x00, 0xF4, 0xE4,
+  0x0A, 0x6C, 0xDE, 0xFB, 0x19, 0x5A, 0x22, 0x74, 0x25, 0x20, 0x99, 0x50, 0x6C, 0x58, 0x79, 0xF5,
+  0x36, 0x60, 0xF0, 0x82, 0x00, 0xBD, 0x43, 0x23, 0xB7, 0x1D, 0xEC, 0xEE, 0x6F, 0x9C, 0x33, 0xA7,
+  0x11, 0xA3, 0x0D, 0xA2, 0x14, 0x4E, 0x69, 0x44, 0x6B, 0x9C, 0x68, 0x50, 0x0A, 0x2B, 0x9A, 0x3D,
+  0x9D, 0xA7, 0xE8, 0x3A, 0x33, 0xC4, 0xBC, 0x86, 0x69, 0xD4, 0xFA, 0x9A, 0x69, 0x2A, 0xE0, 0x74,
+  0x58, 0x21, 0x2C, 0x95, 0xB8, 0x63, 0x7E, 0x3D, 0x0D, 0x93, 0xD2, 0x00, 0x6C, 0xDB, 0xBB, 0x9F,
+  0xBE, 0x6C, 0x96, 0xAA, 0xAA, 0x34, 0x85, 0x62, 0x91, 0x65, 0x0B, 0x9A, 0x2A, 0x8B, 0x2E, 0xBF,
+  0x64, 0xCB, 0x05, 0x8B, 0x91, 0x73, 0x8E, 0xBA, 0xEA, 0xD4, 0x03, 0x3B, 0x37, 0x3D, 0x8C, 0x56,
+  0x8A, 0x6F, 0x5D, 0x51, 0xBF, 0x75, 0x61, 0x75, 0x28, 0x11, 0x6A, 0xD2, 0x49, 0x00, 0x8E, 0xF5,
+  0x0E, 0x70, 0xB2, 0x77, 0x00, 0xDF, 0x3A, 0xB4, 0x75, 0xDC, 0xBF, 0x72, 0x51, 0x9C, 0x4B, 0x91,
+  0xE5, 0xB5, 0x8F, 0x3A, 0xF1, 0xB0, 0xE8, 0x4A, 0x09, 0x37, 0x92, 0x67, 0xCD, 0x0F, 0x67, 0xB7,
+  0x2A, 0xE1, 0xC0, 0xB9, 0x53, 0x3F, 0xF4, 0xE8, 0x4B, 0x3C, 0xF7, 0xF4, 0x7A, 0x8C, 0xB5, 0x76,
+  0xA9, 0x67, 0xF4, 0x0D, 0x97, 0x64, 0xD2, 0xDF, 0x59, 0xC6, 0x4A, 0x95, 0x90, 0x27, 0xB7, 0xFE,
+  0x83, 0xBE, 0x9E, 0x3E, 0x30, 0x86, 0x96, 0x1F, 0xCC, 0x65, 0xE9, 0x55, 0xB3, 0x00, 0xD8, 0xD5,
+  0x71, 0x84, 0xF7, 0x3F, 0x3F, 0x86, 0x36, 0x9A, 0x5C, 0x2E, 0xE0, 0xE7, 0x4B, 0x9B, 0xBF, 0xB9,
+  0x67, 0xF9, 0xFC, 0xC7, 0xCF, 0xFD, 0xFF, 0x97, 0x8F, 0xBC, 0xC8, 0x1F, 0x7E, 0xBF, 0x2D, 0x06,
+  0xD0, 0x5A, 0x2F, 0x07, 0x46, 0x80, 0xF0, 0xBB, 0x2C, 0x1E, 0x45, 0x96, 0xAD, 0xEF, 0xEE, 0xA3,
+  0xBB, 0xE7, 0x1B, 0x7E, 0xB2, 0xA8, 0x99, 0xA0, 0x1C, 0xB2, 0xE1, 0xF6, 0x15, 0x18, 0x1D, 0x27,
+  0xDF, 0x91, 0xD3, 0xFD, 0x2C, 0x9F, 0x33, 0x43, 0xA6, 0xD6, 0xD6, 0x84, 0x3F, 0x5D, 0xD8, 0xD4,
+  0xBE, 0xFE, 0x96, 0x65, 0x8F, 0x01, 0x9F, 0x04, 0x41, 0xC8, 0xF3, 0x9B, 0x77, 0xF0, 0xC1, 0x47,
+  0x07, 0x79, 0xED, 0x8D, 0x36, 0x98, 0x54, 0x15, 0x1F, 0xEE, 0xEC, 0x68, 0x90, 0x99, 0x9E, 0x36,
+  0x75, 0x71, 0x19, 0xC0, 0x01, 0x72, 0x11, 0xB4, 0x5E, 0x80, 0x00, 0x38, 0xDD, 0xDA, 0xB6, 0x9F,
+  0x5F, 0x3F, 0xF3, 0x2A, 0x3D, 0x03, 0xC3, 0x74, 0x1E, 0xFC, 0x0A, 0xAC, 0x43, 0x55, 0xA7, 0xE2,
+  0xEA, 0xF8, 0xF5, 0x9B, 0x98, 0xB5, 0x3B, 0xB3, 0xC5, 0xCB, 0x32, 0xE6, 0x24, 0x40, 0x68, 0x1D,
+  0xF3, 0xEA, 0x7C, 0x66, 0x56, 0x1B, 0x6E, 0x98, 0x99, 0x66, 0x56, 0x5A, 0x78, 0xEB, 0x9D, 0x8F,
+  0xE9, 0xEC, 0x3C, 0x01, 0x5A, 0x91, 0xC9, 0xA4, 0xF1, 0x13, 0x1E, 0x83, 0x83, 0x79, 0x10, 0x41,
+  0x24, 0x26, 0xB6, 0xF6, 0xBF, 0xB9, 0xA2, 0x24, 0xAE, 0x09, 0x0E, 0xC7, 0xAE, 0xDD, 0x1D, 0xBC,
+  0xBB, 0xB7, 0x83, 0x28, 0x5F, 0x80, 0x84, 0x41, 0xAA, 0x52, 0x28, 0xE0, 0xDC, 0xC7, 0x90, 0x4C,
+  0xBC, 0x8C, 0x26, 0x00, 0xFE, 0xEF, 0x01, 0xFE, 0x33, 0x00, 0x06, 0x3C, 0x35, 0x30, 0xAD, 0xB0,
+  0x66, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
 };
 
-const unsigned long favicon_buff_size = sizeof(favicon_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page favicon resources, 4126 bytes (not compressed) */
+const web_res_t favicon_res =
+{
+  favicon_buff,
+  sizeof(favicon_buff),
+  NULL,
+  0U,
+  "\"c9a37d7e5f2cba47\"",
+  NULL
+};
@@ -16,9 +16,12 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
 /* Web page font resources buffer */
-const char font_buff[] =
+static const char font_buff[] =
 {
   0x77, 0x4F, 0x46, 0x32, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x39, 0xAC, 0x00, 0x0D, 0x00, 0x00,
   0x00, 0x03, 0x1E, 0xEC, 0x00, 0x01, 0x39, 0x52, 0x01, 0x4B, 0x85, 0x60, 0x00, 0x00, 0x00, 0x00,
@@ -5041,4 +5044,14 @@ const char font_buff[] =
   0x8C, 0x55, 0x13, 0x6C, 0xC9, 0xC5, 0x9D, 0x40, 0xF1, 0x07, 0x05, 0x00
 };
 
-const unsigned long font_buff_size = sizeof(font_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page font resources, 80300 bytes (not compressed) */
+const web_res_t font_res =
+{
+  font_buff,
+  sizeof(font_buff),
+  NULL,
+  0U,
+  "\"6b555920e358f8a2\"",
+  NULL
+};
@@ -16,150 +16,92 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page html resources buffer */
-const char html_buff[] =
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Web page html resources buffer, gzip content-encoding */
+static const char html_buff_gz[] =
 {
-  0x3C, 0x21, 0x64, 0x6F, 0x63, 0x74, 0x79, 0x70, 0x65, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x3C,
-  0x68, 0x74, 0x6D, 0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x20, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D, 0x73, 0x63,
-  0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x66, 0x66, 0x22, 0x3E, 0x3C, 0x68, 0x65,
-  0x61, 0x64, 0x3E, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74,
-  0x3D, 0x22, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x2F, 0x3E, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20,
-  0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x20,
-  0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x64,
-  0x65, 0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x69, 0x6E, 0x69, 0x74,
-  0x69, 0x61, 0x6C, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2C, 0x73, 0x68, 0x72, 0x69,
-  0x6E, 0x6B, 0x2D, 0x74, 0x6F, 0x2D, 0x66, 0x69, 0x74, 0x3D, 0x6E, 0x6F, 0x22, 0x2F, 0x3E, 0x3C,
-  0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x74, 0x68, 0x65, 0x6D, 0x65,
-  0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D,
-  0x22, 0x23, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2F, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B,
-  0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74, 0x22, 0x20,
-  0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2E, 0x2F, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74,
-  0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x2F, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65,
-  0x6C, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x73, 0x3D, 0x22,
-  0x37, 0x36, 0x78, 0x37, 0x36, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x69, 0x6D, 0x61,
-  0x67, 0x65, 0x2F, 0x70, 0x6E, 0x67, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2E, 0x2F,
-  0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x2F, 0x3E, 0x3C, 0x74,
-  0x69, 0x74, 0x6C, 0x65, 0x3E, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x20, 0x57, 0x65, 0x62,
-  0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x44, 0x65, 0x6D, 0x6F, 0x3C, 0x2F, 0x74, 0x69, 0x74,
-  0x6C, 0x65, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2E,
-  0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x63, 0x73, 0x73, 0x2F, 0x63, 0x68, 0x75, 0x6E,
-  0x6B, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C,
-  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x68, 0x72,
-  0x65, 0x66, 0x3D, 0x22, 0x2E, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x63, 0x73, 0x73,
-  0x2F, 0x6D, 0x61, 0x69, 0x6E, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22,
-  0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x68, 0x65,
-  0x61, 0x64, 0x3E, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x3C, 0x6E, 0x6F, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x3E, 0x59, 0x6F, 0x75, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65,
-  0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x4A, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
-  0x20, 0x74, 0x6F, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70,
-  0x2E, 0x3C, 0x2F, 0x6E, 0x6F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x3C, 0x64, 0x69, 0x76,
-  0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x6F, 0x6F, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-  0x3E, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-  0x28, 0x72, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6E, 0x2C, 0x61, 0x2C,
-  0x6C, 0x3D, 0x72, 0x5B, 0x30, 0x5D, 0x2C, 0x63, 0x3D, 0x72, 0x5B, 0x31, 0x5D, 0x2C, 0x66, 0x3D,
-  0x72, 0x5B, 0x32, 0x5D, 0x2C, 0x70, 0x3D, 0x30, 0x2C, 0x73, 0x3D, 0x5B, 0x5D, 0x3B, 0x70, 0x3C,
-  0x6C, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x70, 0x2B, 0x2B, 0x29, 0x61, 0x3D, 0x6C,
-  0x5B, 0x70, 0x5D, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F,
-  0x74, 0x79, 0x70, 0x65, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65,
-  0x72, 0x74, 0x79, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6F, 0x2C, 0x61, 0x29, 0x26, 0x26, 0x6F,
-  0x5B, 0x61, 0x5D, 0x26, 0x26, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6F, 0x5B, 0x61, 0x5D,
-  0x5B, 0x30, 0x5D, 0x29, 0x2C, 0x6F, 0x5B, 0x61, 0x5D, 0x3D, 0x30, 0x3B, 0x66, 0x6F, 0x72, 0x28,
-  0x6E, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x29, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x72,
-  0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72,
-  0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x63, 0x2C, 0x6E, 0x29,
-  0x26, 0x26, 0x28, 0x65, 0x5B, 0x6E, 0x5D, 0x3D, 0x63, 0x5B, 0x6E, 0x5D, 0x29, 0x3B, 0x66, 0x6F,
-  0x72, 0x28, 0x69, 0x26, 0x26, 0x69, 0x28, 0x72, 0x29, 0x3B, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67,
-  0x74, 0x68, 0x3B, 0x29, 0x73, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x28, 0x29, 0x3B,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x2E, 0x61, 0x70,
-  0x70, 0x6C, 0x79, 0x28, 0x75, 0x2C, 0x66, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2C, 0x74, 0x28, 0x29,
-  0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x28, 0x29, 0x7B, 0x66, 0x6F,
-  0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x72, 0x3D, 0x30, 0x3B, 0x72, 0x3C, 0x75, 0x2E,
-  0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x72, 0x2B, 0x2B, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28,
-  0x76, 0x61, 0x72, 0x20, 0x74, 0x3D, 0x75, 0x5B, 0x72, 0x5D, 0x2C, 0x6E, 0x3D, 0x21, 0x30, 0x2C,
-  0x6C, 0x3D, 0x31, 0x3B, 0x6C, 0x3C, 0x74, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x6C,
-  0x2B, 0x2B, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x74, 0x5B, 0x6C, 0x5D, 0x3B, 0x30,
-  0x21, 0x3D, 0x3D, 0x6F, 0x5B, 0x63, 0x5D, 0x26, 0x26, 0x28, 0x6E, 0x3D, 0x21, 0x31, 0x29, 0x7D,
-  0x6E, 0x26, 0x26, 0x28, 0x75, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x72, 0x2D, 0x2D,
-  0x2C, 0x31, 0x29, 0x2C, 0x65, 0x3D, 0x61, 0x28, 0x61, 0x2E, 0x73, 0x3D, 0x74, 0x5B, 0x30, 0x5D,
-  0x29, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 0x76, 0x61, 0x72, 0x20,
-  0x6E, 0x3D, 0x7B, 0x7D, 0x2C, 0x6F, 0x3D, 0x7B, 0x31, 0x3A, 0x30, 0x7D, 0x2C, 0x75, 0x3D, 0x5B,
-  0x5D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x28, 0x72, 0x29, 0x7B,
-  0x69, 0x66, 0x28, 0x6E, 0x5B, 0x72, 0x5D, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E,
-  0x5B, 0x72, 0x5D, 0x2E, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x3B, 0x76, 0x61, 0x72, 0x20,
-  0x74, 0x3D, 0x6E, 0x5B, 0x72, 0x5D, 0x3D, 0x7B, 0x69, 0x3A, 0x72, 0x2C, 0x6C, 0x3A, 0x21, 0x31,
-  0x2C, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x3A, 0x7B, 0x7D, 0x7D, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x65, 0x5B, 0x72, 0x5D, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x2E,
-  0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x2C, 0x74, 0x2C, 0x74, 0x2E, 0x65, 0x78, 0x70, 0x6F,
-  0x72, 0x74, 0x73, 0x2C, 0x61, 0x29, 0x2C, 0x74, 0x2E, 0x6C, 0x3D, 0x21, 0x30, 0x2C, 0x74, 0x2E,
-  0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x7D, 0x61, 0x2E, 0x6D, 0x3D, 0x65, 0x2C, 0x61, 0x2E,
-  0x63, 0x3D, 0x6E, 0x2C, 0x61, 0x2E, 0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-  0x28, 0x65, 0x2C, 0x72, 0x2C, 0x74, 0x29, 0x7B, 0x61, 0x2E, 0x6F, 0x28, 0x65, 0x2C, 0x72, 0x29,
-  0x7C, 0x7C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x50,
-  0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x65, 0x2C, 0x72, 0x2C, 0x7B, 0x65, 0x6E, 0x75,
-  0x6D, 0x65, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x67, 0x65, 0x74, 0x3A, 0x74,
-  0x7D, 0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x72, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-  0x28, 0x65, 0x29, 0x7B, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x22, 0x21,
-  0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x26, 0x26,
-  0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54,
-  0x61, 0x67, 0x26, 0x26, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E,
-  0x65, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x65, 0x2C, 0x53, 0x79, 0x6D, 0x62,
-  0x6F, 0x6C, 0x2E, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x67, 0x2C, 0x7B,
-  0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x22, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x22, 0x7D, 0x29,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x50, 0x72,
-  0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x65, 0x2C, 0x22, 0x5F, 0x5F, 0x65, 0x73, 0x4D, 0x6F,
-  0x64, 0x75, 0x6C, 0x65, 0x22, 0x2C, 0x7B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x21, 0x30, 0x7D,
-  0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x74, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28,
-  0x65, 0x2C, 0x72, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x31, 0x26, 0x72, 0x26, 0x26, 0x28, 0x65, 0x3D,
-  0x61, 0x28, 0x65, 0x29, 0x29, 0x2C, 0x38, 0x26, 0x72, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-  0x20, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x34, 0x26, 0x72, 0x26, 0x26, 0x22, 0x6F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x26, 0x26, 0x65,
-  0x26, 0x26, 0x65, 0x2E, 0x5F, 0x5F, 0x65, 0x73, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x29, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3D, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x28, 0x6E, 0x75, 0x6C, 0x6C,
-  0x29, 0x3B, 0x69, 0x66, 0x28, 0x61, 0x2E, 0x72, 0x28, 0x74, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74,
-  0x79, 0x28, 0x74, 0x2C, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x2C, 0x7B, 0x65,
-  0x6E, 0x75, 0x6D, 0x65, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x76, 0x61, 0x6C,
-  0x75, 0x65, 0x3A, 0x65, 0x7D, 0x29, 0x2C, 0x32, 0x26, 0x72, 0x26, 0x26, 0x22, 0x73, 0x74, 0x72,
-  0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x29, 0x66,
-  0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x29, 0x61, 0x2E,
-  0x64, 0x28, 0x74, 0x2C, 0x6E, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x72,
-  0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x5B, 0x72, 0x5D, 0x7D, 0x2E, 0x62,
-  0x69, 0x6E, 0x64, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x6E, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x74, 0x7D, 0x2C, 0x61, 0x2E, 0x6E, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-  0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x72, 0x3D, 0x65, 0x26, 0x26,
-  0x65, 0x2E, 0x5F, 0x5F, 0x65, 0x73, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x3F, 0x66, 0x75, 0x6E,
-  0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65,
-  0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 0x3B, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x64, 0x28, 0x72, 0x2C, 0x22, 0x61, 0x22, 0x2C,
-  0x72, 0x29, 0x2C, 0x72, 0x7D, 0x2C, 0x61, 0x2E, 0x6F, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x65, 0x2C, 0x72, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E,
-  0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2E, 0x63,
-  0x61, 0x6C, 0x6C, 0x28, 0x65, 0x2C, 0x72, 0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x70, 0x3D, 0x22, 0x2E,
-  0x2F, 0x22, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6C, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x22, 0x77,
-  0x65, 0x62, 0x70, 0x61, 0x63, 0x6B, 0x4A, 0x73, 0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61, 0x63, 0x6B,
-  0x2D, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2D, 0x72, 0x65, 0x61, 0x63, 0x74,
-  0x22, 0x5D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x22, 0x77, 0x65, 0x62, 0x70, 0x61, 0x63, 0x6B,
-  0x4A, 0x73, 0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61, 0x63, 0x6B, 0x2D, 0x64, 0x61, 0x73, 0x68, 0x62,
-  0x6F, 0x61, 0x72, 0x64, 0x2D, 0x72, 0x65, 0x61, 0x63, 0x74, 0x22, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D,
-  0x2C, 0x63, 0x3D, 0x6C, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x28, 0x6C,
-  0x29, 0x3B, 0x6C, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x3D, 0x72, 0x2C, 0x6C, 0x3D, 0x6C, 0x2E, 0x73,
-  0x6C, 0x69, 0x63, 0x65, 0x28, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x66,
-  0x3D, 0x30, 0x3B, 0x66, 0x3C, 0x6C, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x66, 0x2B,
-  0x2B, 0x29, 0x72, 0x28, 0x6C, 0x5B, 0x66, 0x5D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3D,
-  0x63, 0x3B, 0x74, 0x28, 0x29, 0x7D, 0x28, 0x5B, 0x5D, 0x29, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x3E, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-  0x2E, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x6A, 0x73, 0x2F, 0x63, 0x68, 0x75, 0x6E,
-  0x6B, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x3C,
-  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x2E, 0x2F, 0x73, 0x74,
-  0x61, 0x74, 0x69, 0x63, 0x2F, 0x6A, 0x73, 0x2F, 0x6D, 0x61, 0x69, 0x6E, 0x2E, 0x6A, 0x73, 0x22,
-  0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
-  0x3E, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x56, 0x6D, 0x6F, 0xDB, 0x36,
+  0x10, 0xFE, 0x2B, 0x32, 0x07, 0x08, 0x12, 0x4A, 0xD3, 0x76, 0xB6, 0xB5, 0x85, 0x2D, 0x7A, 0x5F,
+  0xF6, 0xA9, 0x40, 0xD1, 0x01, 0xE9, 0x30, 0x0C, 0x86, 0x51, 0xD0, 0xD2, 0xC9, 0x62, 0x42, 0x93,
+  0x02, 0x49, 0x39, 0x75, 0x1D, 0xFD, 0xF7, 0x1D, 0x25, 0x4B, 0x4E, 0xB2, 0x05, 0x8B, 0x61, 0x98,
+  0x2F, 0x77, 0xF7, 0xF0, 0xEE, 0x9E, 0xE3, 0xD1, 0xD9, 0xA4, 0x30, 0xB9, 0x3F, 0xD5, 0x10, 0x55,
+  0xFE, 0xA0, 0xD6, 0x59, 0xF8, 0x8D, 0x94, 0xD0, 0x7B, 0x4E, 0x40, 0x93, 0x28, 0x57, 0xC2, 0x39,
+  0x4E, 0x6A, 0xB0, 0x25, 0xE4, 0x7E, 0xEA, 0x72, 0x6B, 0x94, 0xDA, 0x09, 0x3B, 0x35, 0x65, 0x49,
+  0x50, 0x1B, 0x44, 0xB1, 0xCE, 0x0E, 0xE0, 0x45, 0x94, 0x57, 0xC2, 0x3A, 0xF0, 0x9C, 0x34, 0xBE,
+  0x9C, 0x7E, 0x24, 0xB3, 0xCB, 0xB6, 0x16, 0x07, 0xE0, 0xE4, 0x28, 0xE1, 0xA1, 0x36, 0xD6, 0x23,
+  0xA0, 0xD1, 0x1E, 0x34, 0xAA, 0x3D, 0xC8, 0xC2, 0x57, 0xBC, 0x80, 0xA3, 0xCC, 0x61, 0xDA, 0x2D,
+  0xA8, 0xD4, 0xD2, 0x4B, 0xA1, 0xF0, 0x14, 0xA1, 0x80, 0x2F, 0xA8, 0xAB, 0xAC, 0xD4, 0xF7, 0x53,
+  0x6F, 0xA6, 0xA5, 0xF4, 0x5C, 0x9B, 0x17, 0xA0, 0xBE, 0x82, 0x03, 0x4C, 0x73, 0xA3, 0x8C, 0x7D,
+  0x82, 0xFB, 0xD3, 0xBC, 0xFB, 0x04, 0x5D, 0x85, 0xD6, 0x91, 0x05, 0xC5, 0xC9, 0x41, 0x68, 0x59,
+  0x82, 0xC3, 0xF3, 0x2B, 0x0B, 0x25, 0x27, 0x6C, 0x36, 0xEC, 0xB0, 0x3B, 0x67, 0xF4, 0x73, 0x65,
+  0x89, 0x58, 0x24, 0x72, 0xF2, 0x07, 0x60, 0xE4, 0x1F, 0xDE, 0x7F, 0xFF, 0xF0, 0x9E, 0x44, 0x21,
+  0x43, 0x28, 0x39, 0x88, 0x3D, 0xCC, 0x6A, 0xBD, 0xBF, 0xE2, 0x94, 0xE2, 0x18, 0xF4, 0x59, 0xD8,
+  0x44, 0x14, 0x2F, 0xBD, 0x82, 0xF5, 0xED, 0xD7, 0xCF, 0x3F, 0xDF, 0xFC, 0xF9, 0x6B, 0xF4, 0x17,
+  0xEC, 0x1C, 0xD8, 0x23, 0xD8, 0xE8, 0x77, 0x38, 0x98, 0x6C, 0xD6, 0x4B, 0xFB, 0xA3, 0x06, 0x00,
+  0xE7, 0x85, 0x97, 0xF9, 0x2C, 0x77, 0x6E, 0x96, 0x57, 0x8D, 0xBE, 0x67, 0x38, 0x23, 0xBD, 0x23,
+  0xCE, 0x9F, 0x14, 0xB8, 0x0A, 0xC0, 0x93, 0xD7, 0x8D, 0x0E, 0x42, 0xEA, 0xD7, 0x6C, 0x66, 0x3D,
+  0x3F, 0x3B, 0x53, 0x9C, 0xD6, 0x99, 0x36, 0xC8, 0x9E, 0xAC, 0xFD, 0xFA, 0x6F, 0xD3, 0x44, 0x1A,
+  0xA0, 0x88, 0xBC, 0x89, 0x40, 0x8B, 0x9D, 0x82, 0xE8, 0x93, 0x38, 0x8A, 0xDB, 0x4E, 0x1A, 0x36,
+  0x6D, 0xA3, 0x23, 0x5F, 0x49, 0x17, 0x89, 0xBA, 0x66, 0xD9, 0x6C, 0x34, 0xCC, 0x0A, 0x79, 0x8C,
+  0x64, 0xC1, 0x89, 0x35, 0xA6, 0x83, 0xC7, 0xF5, 0x3A, 0xBB, 0x08, 0x27, 0x65, 0xA3, 0x73, 0x2F,
+  0x8D, 0x4E, 0x20, 0x3D, 0x0F, 0xF3, 0xC8, 0x26, 0x16, 0x57, 0xC6, 0x26, 0x47, 0x61, 0x23, 0x4D,
+  0x05, 0x55, 0xDC, 0x6E, 0xE6, 0x5B, 0x9A, 0xE3, 0xB0, 0xD8, 0xD2, 0x12, 0x87, 0x9B, 0x2D, 0xAD,
+  0xF9, 0x9C, 0x3A, 0xBE, 0xD9, 0xAE, 0xEA, 0x4C, 0x31, 0x05, 0x7A, 0xEF, 0xAB, 0x55, 0xFD, 0xEE,
+  0x5D, 0x2A, 0xB8, 0xDA, 0xD4, 0x5B, 0xFA, 0x65, 0x77, 0x87, 0xC5, 0xC7, 0x6A, 0x6B, 0xBC, 0x09,
+  0x44, 0xB0, 0x4A, 0xB8, 0x2F, 0x0F, 0xFA, 0x0F, 0x6B, 0xB0, 0x2E, 0xFD, 0x89, 0x61, 0xB9, 0xA8,
+  0xC4, 0x50, 0x91, 0xC6, 0xB1, 0xD9, 0x88, 0x6D, 0x1C, 0x3B, 0x56, 0x37, 0xAE, 0x4A, 0xC2, 0x02,
+  0x0F, 0x4B, 0x69, 0x98, 0xF0, 0xF9, 0x2A, 0xF8, 0xA1, 0x23, 0xA9, 0xA3, 0x3C, 0x7D, 0x13, 0x64,
+  0x4E, 0x35, 0x42, 0x26, 0xB0, 0xD1, 0x5B, 0x9E, 0xE3, 0x4F, 0xDA, 0x21, 0xC8, 0x38, 0x96, 0x18,
+  0xD5, 0xCA, 0x0D, 0x9E, 0xA6, 0x8E, 0xB9, 0x4A, 0x96, 0x3E, 0x49, 0x93, 0x74, 0x65, 0xC1, 0x37,
+  0x56, 0x47, 0x4D, 0xE7, 0x01, 0xC3, 0x04, 0xAA, 0x53, 0xD2, 0xD0, 0xF2, 0xF1, 0x71, 0x83, 0x7E,
+  0xA0, 0x4A, 0x3B, 0xA6, 0x06, 0x17, 0x63, 0x66, 0x80, 0x5A, 0xF4, 0xCF, 0x66, 0xCD, 0x80, 0x69,
+  0x31, 0xFA, 0x51, 0xEA, 0x79, 0xB3, 0xB1, 0x5B, 0xAA, 0xF9, 0x64, 0x8E, 0xF9, 0x5B, 0xAC, 0x54,
+  0xE6, 0x07, 0x3D, 0x15, 0xF4, 0x82, 0x4E, 0xCE, 0xFD, 0x46, 0x6D, 0x57, 0xF3, 0x09, 0xE7, 0x66,
+  0x93, 0x63, 0x0E, 0x12, 0x54, 0x5F, 0xA4, 0xAD, 0xC6, 0x59, 0xC3, 0x5C, 0xAD, 0xF0, 0x9A, 0x25,
+  0x76, 0x3A, 0xA5, 0x8B, 0x94, 0x02, 0x17, 0x89, 0x60, 0x0E, 0x2D, 0x30, 0x39, 0x69, 0x7B, 0x71,
+  0x19, 0xDA, 0x8E, 0x23, 0x7E, 0x6E, 0xA9, 0xE1, 0xE7, 0xC5, 0x72, 0xDE, 0xD2, 0x26, 0x70, 0x32,
+  0x3A, 0x2C, 0x02, 0x97, 0xB2, 0x4C, 0x34, 0x3A, 0x93, 0x5E, 0x8C, 0xC2, 0x9C, 0xC1, 0xF7, 0x70,
+  0xB7, 0xDD, 0xAA, 0xF7, 0x35, 0x6C, 0xF1, 0xB3, 0x5C, 0x5A, 0xAA, 0x96, 0x93, 0x05, 0xBD, 0x08,
+  0x97, 0xE7, 0xB6, 0x1D, 0x92, 0x03, 0xC1, 0xA8, 0xCB, 0xB0, 0x1F, 0x6C, 0xA9, 0xA7, 0xD7, 0xB9,
+  0xC0, 0x4C, 0x31, 0x15, 0xA2, 0x1D, 0xF7, 0x5A, 0xC1, 0x0E, 0x1C, 0xA8, 0x60, 0x39, 0xC7, 0x2A,
+  0x62, 0x05, 0xBF, 0x56, 0x1B, 0xB5, 0xD4, 0xA7, 0x67, 0xC1, 0x4C, 0x98, 0xA6, 0x8F, 0x8F, 0x17,
+  0x6A, 0x0B, 0x28, 0xA5, 0x86, 0x81, 0xD0, 0x4E, 0xED, 0x0C, 0xBA, 0x39, 0x80, 0x0D, 0x15, 0xBF,
+  0x44, 0xF0, 0x3D, 0xF8, 0xA5, 0x6F, 0xD3, 0x16, 0xF1, 0x2C, 0x7F, 0x5A, 0xBD, 0xA4, 0xD1, 0xBD,
+  0x75, 0x41, 0x26, 0x3C, 0x54, 0x87, 0x29, 0xA3, 0xDB, 0xD3, 0x61, 0x67, 0x54, 0x1C, 0xF7, 0x23,
+  0xF3, 0xE6, 0xD6, 0x63, 0x73, 0xDA, 0x7F, 0x15, 0xFB, 0x38, 0x7E, 0xED, 0xC4, 0x7F, 0xEB, 0x52,
+  0xE4, 0x4A, 0x35, 0xB0, 0x24, 0x9F, 0x4D, 0xD1, 0x28, 0x20, 0x6D, 0x4A, 0x5F, 0x33, 0x26, 0xDF,
+  0xBE, 0x81, 0xBB, 0xA8, 0x0D, 0x66, 0x93, 0x79, 0xEF, 0xAE, 0x7F, 0x16, 0x7E, 0x47, 0xCA, 0x22,
+  0xB6, 0xA1, 0x54, 0x91, 0x59, 0x48, 0x53, 0xFA, 0x31, 0xB6, 0x03, 0x43, 0xB0, 0x42, 0xE9, 0x2F,
+  0x41, 0x4A, 0x4C, 0x77, 0x14, 0xE1, 0x43, 0x4C, 0x10, 0xC7, 0xE1, 0xCB, 0xAE, 0x27, 0x5D, 0x8D,
+  0x7A, 0x2E, 0x2F, 0xCE, 0xE5, 0x16, 0x84, 0x87, 0x44, 0x37, 0x4A, 0xA5, 0x01, 0x0E, 0x13, 0x96,
+  0xF8, 0xD7, 0x5C, 0xF7, 0x94, 0xE0, 0x8E, 0x68, 0x94, 0x27, 0x2F, 0x33, 0xDE, 0x47, 0x01, 0x18,
+  0xF5, 0x4D, 0xE7, 0x90, 0xEB, 0xF2, 0x72, 0x4D, 0x32, 0xA4, 0x63, 0xAB, 0x08, 0xD7, 0x14, 0x52,
+  0x64, 0x1A, 0xF1, 0x34, 0x1D, 0xC3, 0xC5, 0x60, 0x9F, 0x14, 0x51, 0xCB, 0x76, 0x52, 0x17, 0x9D,
+  0x5F, 0x78, 0x55, 0xC7, 0xCB, 0xE7, 0x43, 0x8E, 0xF4, 0x33, 0x4A, 0x03, 0xA6, 0xE5, 0x2F, 0xA2,
+  0xFD, 0x6D, 0xD4, 0xB8, 0xA2, 0xB2, 0x8B, 0xEF, 0xED, 0xF2, 0x3F, 0x84, 0x63, 0x05, 0x07, 0xBF,
+  0x2C, 0x25, 0x82, 0x60, 0xF6, 0xA9, 0x0D, 0xC7, 0x99, 0x17, 0x94, 0x5C, 0x14, 0xDF, 0xD4, 0x67,
+  0x82, 0x41, 0xC0, 0xA8, 0x43, 0x6B, 0x27, 0x5D, 0xEA, 0x15, 0x0F, 0x0D, 0x78, 0x43, 0x1E, 0x60,
+  0x57, 0x8B, 0xFC, 0xFE, 0x13, 0x3E, 0x52, 0xF5, 0x4E, 0xE1, 0x6C, 0x5A, 0x08, 0x57, 0xED, 0x8C,
+  0xB0, 0xC5, 0x14, 0x49, 0x41, 0x36, 0xB7, 0x6F, 0xD7, 0x0C, 0x4D, 0x08, 0x3B, 0xAF, 0xEA, 0x7B,
+  0x53, 0x97, 0x3A, 0xE4, 0xB3, 0x5F, 0x72, 0xBC, 0xAE, 0x28, 0x71, 0x5D, 0x9F, 0xE8, 0x1B, 0x5D,
+  0xF0, 0xA3, 0x0C, 0x6D, 0xF3, 0xDA, 0x94, 0x4B, 0x6C, 0x37, 0x36, 0x51, 0x9B, 0x12, 0x7B, 0x61,
+  0x10, 0x4B, 0x9E, 0xAF, 0x42, 0x53, 0x4B, 0xB0, 0xBB, 0x65, 0xB3, 0xE1, 0x99, 0xE8, 0xC7, 0xC8,
+  0xD9, 0xFC, 0xC9, 0x5B, 0x75, 0x37, 0xBC, 0x6F, 0x77, 0x2E, 0x3C, 0x1D, 0xFF, 0xA7, 0xDB, 0x3D,
+  0x6B, 0xCF, 0x55, 0x67, 0xFD, 0x3B, 0x36, 0xEB, 0xFE, 0xA8, 0xFC, 0x03, 0xF6, 0x45, 0xE5, 0x11,
+  0xB8, 0x08, 0x00, 0x00
 };
 
-const unsigned long html_buff_size = sizeof(html_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page html resources, 2232 bytes (gzip 1092 bytes) */
+const web_res_t html_res =
+{
+  NULL,
+  0U,
+  html_buff_gz,
+  sizeof(html_buff_gz),
+  NULL,
+  "\"a85765cbe4486126-gz\""
+};
@@ -16,9 +16,12 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page html image buffer */
-const char image_buff[] =
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Web page image resources buffer */
+static const char image_buff[] =
 {
   0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
   0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x14, 0x0E, 0x0F, 0x12, 0x0F, 0x0D, 0x14,
@@ -33362,4 +33365,14 @@ const char image_buff[] =
   0xCA, 0xA4, 0xDE, 0x79, 0x79, 0x00, 0x33, 0x5D, 0xA1, 0x36, 0xD8, 0x00, 0x19, 0x69, 0xFF, 0xD9
 };
 
-const unsigned long image_buff_size = sizeof(image_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page image resources, 533440 bytes (not compressed) */
+const web_res_t image_res =
+{
+  image_buff,
+  sizeof(image_buff),
+  NULL,
+  0U,
+  "\"4a5c6f4ddacc4077\"",
+  NULL
+};
@@ -16,1941 +16,513 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page main java script resources buffer */
-const char js_main_buff[] =
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Web page main java script resources buffer, gzip content-encoding */
+static const char js_main_buff_gz[] =
 {
-  0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x22, 0x77, 0x65, 0x62, 0x70, 0x61, 0x63, 0x6B, 0x4A, 0x73,
-  0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61, 0x63, 0x6B, 0x2D, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61,
-  0x72, 0x64, 0x2D, 0x72, 0x65, 0x61, 0x63, 0x74, 0x22, 0x5D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B,
-  0x22, 0x77, 0x65, 0x62, 0x70, 0x61, 0x63, 0x6B, 0x4A, 0x73, 0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61,
-  0x63, 0x6B, 0x2D, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2D, 0x72, 0x65, 0x61,
-  0x63, 0x74, 0x22, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x5B,
-  0x5B, 0x30, 0x5D, 0x2C, 0x7B, 0x31, 0x39, 0x35, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-  0x6E, 0x28, 0x65, 0x2C, 0x74, 0x2C, 0x61, 0x29, 0x7B, 0x22, 0x75, 0x73, 0x65, 0x20, 0x73, 0x74,
-  0x72, 0x69, 0x63, 0x74, 0x22, 0x3B, 0x61, 0x2E, 0x72, 0x28, 0x74, 0x29, 0x3B, 0x76, 0x61, 0x72,
-  0x20, 0x72, 0x3D, 0x61, 0x28, 0x37, 0x37, 0x29, 0x2C, 0x6F, 0x3D, 0x61, 0x28, 0x32, 0x29, 0x2C,
-  0x6E, 0x3D, 0x61, 0x2E, 0x6E, 0x28, 0x6F, 0x29, 0x2C, 0x73, 0x3D, 0x61, 0x28, 0x33, 0x30, 0x29,
-  0x2C, 0x69, 0x3D, 0x61, 0x2E, 0x6E, 0x28, 0x73, 0x29, 0x2C, 0x63, 0x3D, 0x61, 0x28, 0x31, 0x37,
-  0x29, 0x2C, 0x64, 0x3D, 0x61, 0x28, 0x38, 0x29, 0x2C, 0x6C, 0x3D, 0x28, 0x61, 0x28, 0x38, 0x33,
-  0x29, 0x2C, 0x61, 0x28, 0x38, 0x34, 0x29, 0x2C, 0x61, 0x28, 0x38, 0x35, 0x29, 0x2C, 0x61, 0x28,
-  0x38, 0x36, 0x29, 0x2C, 0x61, 0x28, 0x39, 0x29, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-  0x62, 0x3D, 0x22, 0x22, 0x2C, 0x6A, 0x3D, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2D, 0x63, 0x6F,
-  0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x2C, 0x68, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x6F, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x29,
-  0x28, 0x7B, 0x74, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x62, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65,
-  0x54, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x7D, 0x7D, 0x29, 0x3B, 0x76,
-  0x61, 0x72, 0x20, 0x70, 0x3D, 0x61, 0x28, 0x30, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x20, 0x75, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x29, 0x28, 0x62, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C,
-  0x2E, 0x61, 0x29, 0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C,
-  0x6E, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74,
-  0x29, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x28, 0x72,
-  0x29, 0x7B, 0x63, 0x61, 0x73, 0x65, 0x20, 0x6A, 0x3A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-  0x74, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
-  0x65, 0x6E, 0x74, 0x22, 0x29, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x63, 0x61, 0x73, 0x65,
-  0x20, 0x62, 0x3A, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-  0x65, 0x6E, 0x74, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69,
-  0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65,
-  0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x5B, 0x72,
-  0x5D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x68, 0x2E, 0x50, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x72, 0x2C, 0x7B, 0x76, 0x61, 0x6C,
-  0x75, 0x65, 0x3A, 0x7B, 0x74, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x72, 0x2C, 0x63, 0x68, 0x61, 0x6E,
-  0x67, 0x65, 0x54, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-  0x28, 0x65, 0x29, 0x7B, 0x6E, 0x28, 0x65, 0x29, 0x7D, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x65, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x7D, 0x29,
-  0x7D, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x3D, 0x22, 0x62, 0x6C, 0x75, 0x65, 0x22, 0x2C,
-  0x66, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74,
-  0x65, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x29, 0x28, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x6D, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x65,
-  0x3D, 0x3E, 0x7B, 0x7D, 0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-  0x67, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x28,
-  0x6D, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29,
-  0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x6E, 0x3D, 0x61,
-  0x5B, 0x31, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x66, 0x2E, 0x50, 0x72, 0x6F, 0x76, 0x69,
-  0x64, 0x65, 0x72, 0x2C, 0x7B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x72, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x6E, 0x28, 0x65, 0x29,
-  0x7D, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x65, 0x2E, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x7D, 0x29, 0x7D, 0x76, 0x61, 0x72, 0x20, 0x78, 0x3D, 0x61,
-  0x28, 0x32, 0x30, 0x29, 0x2C, 0x4F, 0x3D, 0x61, 0x28, 0x35, 0x29, 0x2C, 0x41, 0x3D, 0x61, 0x2E,
-  0x6E, 0x28, 0x4F, 0x29, 0x2C, 0x76, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x36, 0x29, 0x2C, 0x43, 0x3D,
-  0x61, 0x28, 0x31, 0x39, 0x37, 0x29, 0x2C, 0x79, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x38, 0x29, 0x2C,
-  0x4E, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x39, 0x29, 0x2C, 0x77, 0x3D, 0x61, 0x28, 0x32, 0x31, 0x31,
-  0x29, 0x2C, 0x53, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x30, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6B,
-  0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E,
-  0x73, 0x74, 0x20, 0x74, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x21, 0x31, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C,
-  0x2E, 0x61, 0x29, 0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C,
-  0x6F, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x72,
-  0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x63,
-  0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x3D, 0x69, 0x5B, 0x31, 0x5D, 0x3B, 0x6E, 0x2E, 0x61,
-  0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E,
-  0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74,
-  0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65,
-  0x22, 0x2C, 0x62, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B,
-  0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65,
-  0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x72, 0x65, 0x73, 0x69,
-  0x7A, 0x65, 0x22, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x29, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-  0x20, 0x62, 0x3D, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x69,
-  0x6E, 0x6E, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3C, 0x39, 0x39, 0x33, 0x26, 0x26, 0x72,
-  0x3F, 0x64, 0x28, 0x22, 0x62, 0x67, 0x2D, 0x77, 0x68, 0x69, 0x74, 0x65, 0x22, 0x29, 0x3A, 0x64,
-  0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61,
-  0x72, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46,
-  0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x76, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41,
-  0x28, 0x29, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x61, 0x62, 0x73, 0x6F, 0x6C,
-  0x75, 0x74, 0x65, 0x22, 0x2C, 0x63, 0x29, 0x2C, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x3A, 0x22,
-  0x6C, 0x67, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x43, 0x2E, 0x61, 0x2C,
-  0x7B, 0x66, 0x6C, 0x75, 0x69, 0x64, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x77, 0x72, 0x61, 0x70,
-  0x70, 0x65, 0x72, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69,
-  0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28,
-  0x29, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65,
-  0x20, 0x64, 0x2D, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x22, 0x2C, 0x7B, 0x74, 0x6F, 0x67, 0x67,
-  0x6C, 0x65, 0x64, 0x3A, 0x65, 0x2E, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x4F, 0x70, 0x65,
-  0x6E, 0x65, 0x64, 0x7D, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x79, 0x2E,
-  0x61, 0x2C, 0x7B, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74, 0x6F, 0x67,
-  0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67,
-  0x67, 0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72, 0x20, 0x62, 0x61, 0x72, 0x31, 0x22, 0x7D, 0x29,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22,
-  0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72,
-  0x2D, 0x62, 0x61, 0x72, 0x20, 0x62, 0x61, 0x72, 0x32, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E,
-  0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61,
-  0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72,
-  0x20, 0x62, 0x61, 0x72, 0x33, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x4E, 0x2E, 0x61, 0x2C,
-  0x7B, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x3D, 0x3E, 0x65, 0x2E, 0x70, 0x72,
-  0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x65, 0x2E, 0x62, 0x72, 0x61, 0x6E, 0x64, 0x54,
-  0x65, 0x78, 0x74, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x79, 0x2E, 0x61, 0x2C, 0x7B, 0x6F, 0x6E, 0x43,
-  0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x64, 0x28, 0x72, 0x3F, 0x22, 0x6E,
-  0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E,
-  0x74, 0x22, 0x3A, 0x22, 0x62, 0x67, 0x2D, 0x77, 0x68, 0x69, 0x74, 0x65, 0x22, 0x29, 0x2C, 0x6F,
-  0x28, 0x21, 0x72, 0x29, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73,
-  0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A,
-  0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72, 0x2D,
-  0x62, 0x61, 0x72, 0x20, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x6B, 0x65, 0x62, 0x61, 0x62,
-  0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67,
-  0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72, 0x20, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x6B,
-  0x65, 0x62, 0x61, 0x62, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D,
-  0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72, 0x20, 0x6E, 0x61, 0x76, 0x62,
-  0x61, 0x72, 0x2D, 0x6B, 0x65, 0x62, 0x61, 0x62, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x77, 0x2E, 0x61,
-  0x2C, 0x7B, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x3A, 0x21, 0x30, 0x2C, 0x69, 0x73, 0x4F, 0x70,
-  0x65, 0x6E, 0x3A, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x53, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x3A, 0x21, 0x30, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x61, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x65, 0x78,
-  0x74, 0x20, 0x6D, 0x78, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x62, 0x2D, 0x30, 0x20, 0x68,
-  0x31, 0x22, 0x2C, 0x68, 0x72, 0x65, 0x66, 0x3A, 0x22, 0x2E, 0x2F, 0x20, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x31, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x20, 0x57, 0x65, 0x62,
-  0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x44, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61,
-  0x74, 0x69, 0x6F, 0x6E, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29,
-  0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x42, 0x2C, 0x48, 0x3D, 0x61, 0x28,
-  0x32, 0x30, 0x31, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x54, 0x28,
-  0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x64, 0x2E, 0x67, 0x29, 0x28, 0x29, 0x2C, 0x61, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75,
-  0x73, 0x65, 0x52, 0x65, 0x66, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x3B, 0x6E, 0x2E, 0x61, 0x2E,
-  0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x28,
-  0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F,
-  0x72, 0x6D, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22,
-  0x29, 0x3E, 0x2D, 0x31, 0x26, 0x26, 0x28, 0x42, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x78, 0x2E, 0x61,
-  0x28, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x73, 0x75, 0x70, 0x70,
-  0x72, 0x65, 0x73, 0x73, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x58, 0x3A, 0x21, 0x30, 0x2C, 0x73,
-  0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x59, 0x3A, 0x21,
-  0x31, 0x7D, 0x29, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B,
-  0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F,
-  0x72, 0x6D, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22,
-  0x29, 0x3E, 0x2D, 0x31, 0x26, 0x26, 0x42, 0x2E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x28,
-  0x29, 0x7D, 0x29, 0x29, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x3D, 0x65, 0x2E,
-  0x72, 0x6F, 0x75, 0x74, 0x65, 0x73, 0x2C, 0x6F, 0x3D, 0x65, 0x2E, 0x6C, 0x6F, 0x67, 0x6F, 0x3B,
-  0x6C, 0x65, 0x74, 0x20, 0x73, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x69, 0x3D, 0x6E, 0x75, 0x6C,
-  0x6C, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21,
-  0x3D, 0x3D, 0x6F, 0x26, 0x26, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x6F,
-  0x2E, 0x6F, 0x75, 0x74, 0x74, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x3F, 0x28, 0x73, 0x3D, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x61, 0x22,
-  0x2C, 0x7B, 0x68, 0x72, 0x65, 0x66, 0x3A, 0x6F, 0x2E, 0x6F, 0x75, 0x74, 0x74, 0x65, 0x72, 0x4C,
-  0x69, 0x6E, 0x6B, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73,
-  0x69, 0x6D, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2D,
-  0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x22, 0x2C, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x22,
-  0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A,
-  0x65, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x69, 0x6D,
-  0x67, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x69, 0x6D, 0x67, 0x22, 0x2C,
-  0x7B, 0x73, 0x72, 0x63, 0x3A, 0x6F, 0x2E, 0x69, 0x6D, 0x67, 0x53, 0x72, 0x63, 0x2C, 0x61, 0x6C,
-  0x74, 0x3A, 0x22, 0x53, 0x54, 0x5F, 0x6C, 0x6F, 0x67, 0x6F, 0x5F, 0x32, 0x30, 0x32, 0x30, 0x22,
-  0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x61, 0x22, 0x2C, 0x7B, 0x68, 0x72, 0x65, 0x66,
-  0x3A, 0x6F, 0x2E, 0x6F, 0x75, 0x74, 0x74, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x2C, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x2D,
-  0x74, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C,
-  0x22, 0x2C, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B,
-  0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74, 0x6F, 0x67, 0x67,
-  0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x6F, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x7D, 0x29, 0x29, 0x3A, 0x28, 0x73, 0x3D,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x63, 0x2E,
-  0x62, 0x2C, 0x7B, 0x74, 0x6F, 0x3A, 0x6F, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x4C, 0x69, 0x6E,
-  0x6B, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x6D,
-  0x70, 0x6C, 0x65, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x6E, 0x6F,
-  0x72, 0x6D, 0x61, 0x6C, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E,
-  0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73,
-  0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x69, 0x6D, 0x67, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x69, 0x6D, 0x67, 0x22, 0x2C, 0x7B, 0x73,
-  0x72, 0x63, 0x3A, 0x6F, 0x2E, 0x69, 0x6D, 0x67, 0x53, 0x72, 0x63, 0x2C, 0x61, 0x6C, 0x74, 0x3A,
-  0x22, 0x53, 0x54, 0x5F, 0x6C, 0x6F, 0x67, 0x6F, 0x5F, 0x32, 0x30, 0x32, 0x30, 0x22, 0x7D, 0x29,
-  0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x63, 0x2E, 0x62, 0x2C, 0x7B, 0x74, 0x6F, 0x3A, 0x6F, 0x2E, 0x69,
-  0x6E, 0x6E, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61,
-  0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20,
-  0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x22, 0x2C, 0x6F, 0x6E, 0x43,
-  0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64,
-  0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x6F, 0x2E,
-  0x74, 0x65, 0x78, 0x74, 0x7D, 0x29, 0x29, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x66, 0x2E, 0x43, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65,
-  0x72, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x28, 0x7B, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x6F, 0x7D, 0x29, 0x3D, 0x3E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72,
-  0x22, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x6F, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70,
-  0x65, 0x72, 0x22, 0x2C, 0x72, 0x65, 0x66, 0x3A, 0x61, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x73, 0x7C, 0x7C, 0x6E, 0x75,
-  0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x69, 0x3F, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6C, 0x6F, 0x67, 0x6F, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x73, 0x2C, 0x69, 0x5D, 0x7D, 0x29, 0x3A, 0x6E,
-  0x75, 0x6C, 0x6C, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x53, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x5B, 0x72, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x28, 0x28, 0x61, 0x2C, 0x72, 0x29, 0x3D, 0x3E,
-  0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73,
-  0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x6F, 0x3D, 0x61, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x2C,
-  0x28, 0x74, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x3D, 0x3D, 0x6F, 0x3F,
-  0x22, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x3A, 0x22, 0x22, 0x29, 0x2B, 0x28, 0x61, 0x2E,
-  0x70, 0x72, 0x6F, 0x3F, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x72, 0x6F,
-  0x22, 0x3A, 0x22, 0x22, 0x29, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x63,
-  0x2E, 0x63, 0x2C, 0x7B, 0x74, 0x6F, 0x3A, 0x61, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x2B,
-  0x61, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x69, 0x6E, 0x6B, 0x22, 0x2C, 0x61, 0x63, 0x74, 0x69,
-  0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x61, 0x63, 0x74,
-  0x69, 0x76, 0x65, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74,
-  0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x61, 0x2E, 0x69, 0x63, 0x6F, 0x6E, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x70, 0x22, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x61, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x2C, 0x72, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x7D, 0x29,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A,
-  0x22, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x72, 0x6F, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x48, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x70, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x65, 0x6C,
-  0x65, 0x63, 0x74, 0x72, 0x6F, 0x6E, 0x69, 0x63, 0x73, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29,
-  0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x54, 0x2E, 0x64, 0x65, 0x66,
-  0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x6F, 0x70, 0x73, 0x3D, 0x7B, 0x72, 0x74, 0x6C, 0x41, 0x63,
-  0x74, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x31, 0x2C, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x73, 0x3A, 0x5B,
-  0x7B, 0x7D, 0x5D, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x4C, 0x3D, 0x54, 0x2C, 0x52, 0x3D, 0x61,
-  0x28, 0x32, 0x30, 0x32, 0x29, 0x2C, 0x57, 0x3D, 0x61, 0x28, 0x32, 0x31, 0x32, 0x29, 0x2C, 0x71,
-  0x3D, 0x61, 0x28, 0x32, 0x30, 0x33, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x44, 0x3D, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-  0x74, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x21,
-  0x31, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29,
-  0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x6F, 0x3D, 0x61,
-  0x5B, 0x31, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x66, 0x69, 0x78, 0x65, 0x64,
-  0x2D, 0x70, 0x6C, 0x75, 0x67, 0x69, 0x6E, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x52, 0x2E, 0x61, 0x2C, 0x7B, 0x69, 0x73, 0x4F, 0x70, 0x65, 0x6E, 0x3A, 0x72, 0x2C, 0x74,
-  0x6F, 0x67, 0x67, 0x6C, 0x65, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x6F, 0x28, 0x21, 0x72, 0x29,
-  0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x57, 0x2E, 0x61, 0x2C, 0x7B, 0x74,
-  0x61, 0x67, 0x3A, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x66, 0x61, 0x20, 0x66, 0x61, 0x2D, 0x63, 0x6F, 0x67, 0x20, 0x66, 0x61, 0x2D, 0x32, 0x78, 0x22,
-  0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x73, 0x29, 0x28, 0x22, 0x75, 0x6C, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x22, 0x64, 0x72, 0x6F, 0x70, 0x64, 0x6F, 0x77, 0x6E, 0x2D, 0x6D, 0x65,
-  0x6E, 0x75, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x42, 0x41, 0x43, 0x4B, 0x47, 0x52,
-  0x4F, 0x55, 0x4E, 0x44, 0x20, 0x4D, 0x4F, 0x44, 0x45, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x61, 0x64, 0x6A, 0x75,
-  0x73, 0x74, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2D, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x65, 0x78,
-  0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2D, 0x63,
-  0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x68, 0x2E,
-  0x43, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0x72, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x28, 0x7B, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x54, 0x68, 0x65, 0x6D, 0x65,
-  0x3A, 0x65, 0x7D, 0x29, 0x3D, 0x3E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x73, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6C, 0x6F,
-  0x72, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x22, 0x4C, 0x49, 0x47, 0x48, 0x54, 0x20, 0x4D, 0x4F, 0x44, 0x45, 0x22, 0x7D, 0x29,
-  0x2C, 0x22, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x71, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2D, 0x62, 0x61, 0x64, 0x67, 0x65, 0x20, 0x6D,
-  0x72, 0x2D, 0x32, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D,
-  0x3E, 0x65, 0x28, 0x6A, 0x29, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x71, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x64, 0x61, 0x72, 0x6B, 0x2D, 0x62,
-  0x61, 0x64, 0x67, 0x65, 0x20, 0x6D, 0x6C, 0x2D, 0x32, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69,
-  0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x65, 0x28, 0x62, 0x29, 0x7D, 0x29, 0x2C, 0x22, 0x20,
-  0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x44, 0x41, 0x52, 0x4B, 0x20, 0x4D,
-  0x4F, 0x44, 0x45, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x22, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x50, 0x3D, 0x61, 0x2E, 0x70,
-  0x2B, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x2F, 0x46,
-  0x4C, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x2E, 0x6A, 0x70, 0x67, 0x22, 0x2C, 0x46, 0x3D,
-  0x61, 0x28, 0x32, 0x30, 0x34, 0x29, 0x2C, 0x45, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x35, 0x29, 0x2C,
-  0x58, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x36, 0x29, 0x2C, 0x56, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x37,
-  0x29, 0x2C, 0x47, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x38, 0x29, 0x2C, 0x4D, 0x3D, 0x61, 0x28, 0x32,
-  0x30, 0x39, 0x29, 0x2C, 0x7A, 0x3D, 0x61, 0x28, 0x32, 0x31, 0x30, 0x29, 0x3B, 0x76, 0x61, 0x72,
-  0x20, 0x55, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
-  0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22,
-  0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22,
-  0x68, 0x33, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74,
-  0x65, 0x78, 0x74, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x20, 0x70, 0x72, 0x6F,
-  0x64, 0x75, 0x63, 0x74, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x4D, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C,
-  0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x22, 0x34,
-  0x30, 0x72, 0x65, 0x6D, 0x22, 0x7D, 0x2C, 0x73, 0x72, 0x63, 0x3A, 0x50, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x7A, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22,
-  0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32,
-  0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6F,
-  0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x70,
-  0x6F, 0x77, 0x65, 0x72, 0x2D, 0x73, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x69, 0x63, 0x72,
-  0x6F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x62, 0x61,
-  0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x41, 0x72, 0x6D, 0x5C, 0x78, 0x61, 0x65, 0x20, 0x22,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22,
-  0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43, 0x6F, 0x72, 0x74, 0x65, 0x78, 0x5C,
-  0x78, 0x61, 0x65, 0x2D, 0x4D, 0x33, 0x33, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x74, 0x6F, 0x20,
-  0x6D, 0x65, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x64, 0x65,
-  0x6D, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x2F, 0x70, 0x65,
-  0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
-  0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x6D, 0x61, 0x72, 0x74,
-  0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x69,
-  0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x65, 0x61, 0x72, 0x61, 0x62, 0x6C,
-  0x65, 0x73, 0x2C, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x64,
-  0x69, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x73, 0x2C, 0x20, 0x68, 0x6F,
-  0x6D, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61,
-  0x6E, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x6C, 0x20, 0x73, 0x65,
-  0x6E, 0x73, 0x6F, 0x72, 0x73, 0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x4F, 0x66, 0x66, 0x65, 0x72,
-  0x69, 0x6E, 0x67, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x32, 0x20, 0x4D, 0x62, 0x79, 0x74,
-  0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x46, 0x6C, 0x61, 0x73, 0x68, 0x20, 0x28, 0x64, 0x75, 0x61,
-  0x6C, 0x20, 0x62, 0x61, 0x6E, 0x6B, 0x29, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x61,
-  0x6E, 0x64, 0x20, 0x37, 0x38, 0x36, 0x20, 0x4B, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66,
-  0x20, 0x53, 0x52, 0x41, 0x4D, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E,
-  0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C,
-  0x22, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x69, 0x63, 0x72,
-  0x6F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x20, 0x74, 0x61, 0x6B,
-  0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x74,
-  0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C,
-  0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x54, 0x68, 0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22,
-  0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C, 0x22,
-  0x20, 0x6F, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20,
-  0x70, 0x6F, 0x72, 0x74, 0x66, 0x6F, 0x6C, 0x69, 0x6F, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x38,
-  0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x28, 0x66, 0x72, 0x6F, 0x6D, 0x20,
-  0x34, 0x38, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x36, 0x39, 0x20, 0x70, 0x69, 0x6E, 0x73, 0x29, 0x20,
-  0x61, 0x6E, 0x64, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x75, 0x70, 0x20,
-  0x74, 0x6F, 0x20, 0x31, 0x32, 0x35, 0x5C, 0x78, 0x62, 0x30, 0x43, 0x20, 0x61, 0x6D, 0x62, 0x69,
-  0x65, 0x6E, 0x74, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2E,
-  0x22, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B,
-  0x6D, 0x64, 0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28,
-  0x58, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56, 0x2E, 0x61,
-  0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D,
-  0x31, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74,
-  0x61, 0x67, 0x3A, 0x22, 0x68, 0x33, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x22, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35,
-  0x20, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x7D,
-  0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x73, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x22, 0x68, 0x33, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x65, 0x31, 0x34, 0x65, 0x63, 0x61, 0x22, 0x7D,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x44, 0x65, 0x6D, 0x6F, 0x6E,
-  0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4F, 0x76, 0x65, 0x72, 0x76, 0x69, 0x65,
-  0x77, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x54, 0x68, 0x69, 0x73, 0x20, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x73,
-  0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20,
-  0x6F, 0x66, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65,
-  0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32,
-  0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D,
-  0x33, 0x32, 0x43, 0x75, 0x62, 0x65, 0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x66, 0x69,
-  0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x49, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x73,
-  0x20, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4D, 0x58, 0x5F, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x74,
-  0x6F, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x61, 0x20, 0x48, 0x54, 0x54, 0x50,
-  0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20,
-  0x53, 0x54, 0x4D, 0x33, 0x32, 0x20, 0x43, 0x75, 0x62, 0x65, 0x20, 0x48, 0x41, 0x4C, 0x2E, 0x20,
-  0x54, 0x68, 0x65, 0x20, 0x4D, 0x58, 0x5F, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6D, 0x6F, 0x64, 0x75,
-  0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x57, 0x65, 0x62, 0x20, 0x62, 0x72, 0x6F,
-  0x77, 0x73, 0x65, 0x72, 0x20, 0x28, 0x47, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x20, 0x43, 0x68, 0x72,
-  0x6F, 0x6D, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x61, 0x73, 0x65,
-  0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x77, 0x65, 0x62, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65,
-  0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x65, 0x62, 0x20, 0x70, 0x61, 0x67, 0x65,
-  0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x50, 0x43, 0x20, 0x61, 0x6E, 0x64,
-  0x20, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x54, 0x68,
-  0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A,
-  0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22,
-  0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x42, 0x2D, 0x55, 0x35,
-  0x38, 0x35, 0x49, 0x2D, 0x49, 0x4F, 0x54, 0x30, 0x32, 0x41, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20,
-  0x62, 0x6F, 0x61, 0x72, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x54, 0x54,
-  0x50, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20,
-  0x49, 0x54, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x57, 0x65, 0x62, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63,
-  0x65, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x65, 0x61,
-  0x63, 0x68, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
-  0x74, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B,
-  0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66,
-  0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x22, 0x42, 0x2D, 0x55, 0x35, 0x38, 0x35, 0x49, 0x2D, 0x49, 0x4F, 0x54, 0x30, 0x32, 0x41,
-  0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61,
-  0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x72,
-  0x65, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x20,
-  0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64,
-  0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E,
-  0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22,
-  0x75, 0x6C, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x6D, 0x62, 0x2D, 0x34, 0x20, 0x68, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32,
-  0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x38, 0x29, 0x22, 0x7D, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x57, 0x65, 0x62, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75,
-  0x65, 0x73, 0x74, 0x73, 0x20, 0x28, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2C,
-  0x20, 0x43, 0x53, 0x53, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x4A, 0x53, 0x20, 0x66,
-  0x69, 0x6C, 0x65, 0x73, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x2E, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22,
-  0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32,
-  0x35, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x38, 0x29, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x73, 0x20, 0x76, 0x61, 0x6C,
-  0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x28, 0x54, 0x65,
-  0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
-  0x2C, 0x20, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
-  0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x76,
-  0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x2E, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x33, 0x22,
-  0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D,
-  0x31, 0x22, 0x2C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x65, 0x31, 0x34, 0x65, 0x63, 0x61, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x44, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69,
-  0x6F, 0x6E, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34,
-  0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62,
-  0x2D, 0x31, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x49,
-  0x74, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x73, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65,
-  0x63, 0x65, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x20,
-  0x72, 0x65, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x65,
-  0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x73, 0x20,
-  0x6F, 0x6E, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65,
-  0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32,
-  0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x42, 0x2D, 0x55,
-  0x35, 0x38, 0x35, 0x49, 0x2D, 0x49, 0x4F, 0x54, 0x30, 0x32, 0x41, 0x22, 0x7D, 0x29, 0x2C, 0x22,
-  0x20, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x72, 0x65, 0x65, 0x20,
-  0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
-  0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3A, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x6F, 0x6C, 0x22, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x75, 0x63,
-  0x63, 0x65, 0x73, 0x73, 0x20, 0x68, 0x34, 0x20, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x20, 0x54, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61,
-  0x74, 0x75, 0x72, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x22, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34,
-  0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61,
-  0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20,
-  0x69, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-  0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x54, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
-  0x72, 0x65, 0x20, 0x6D, 0x65, 0x6E, 0x75, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x70,
-  0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x64,
-  0x65, 0x20, 0x62, 0x61, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x66,
-  0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2E, 0x20,
-  0x54, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61,
-  0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74,
-  0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
-  0x72, 0x65, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
-  0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69,
-  0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20,
-  0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64,
-  0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E,
-  0x65, 0x6C, 0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74,
-  0x61, 0x20, 0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67,
-  0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D,
-  0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x68, 0x34, 0x20, 0x6D, 0x62, 0x2D, 0x31, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x20, 0x50, 0x72, 0x65, 0x73,
-  0x73, 0x75, 0x72, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x22, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34,
-  0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x63, 0x71, 0x75,
-  0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20,
-  0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67,
-  0x20, 0x6F, 0x6E, 0x20, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x6E,
-  0x75, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20,
-  0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x62, 0x61, 0x72, 0x20,
-  0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x64, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66,
-  0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73,
-  0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79,
-  0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63,
-  0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
-  0x61, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x62, 0x75, 0x74,
-  0x74, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74,
-  0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C, 0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20,
-  0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x22,
-  0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x68,
-  0x34, 0x20, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x22, 0x20, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65, 0x6E, 0x73,
-  0x6F, 0x72, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
-  0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x6D, 0x69, 0x64, 0x69,
-  0x74, 0x79, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63,
-  0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x48, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x20, 0x6D, 0x65, 0x6E, 0x75, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61,
-  0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69,
-  0x64, 0x65, 0x20, 0x62, 0x61, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65,
-  0x66, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2E,
-  0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-  0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61,
-  0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x68, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79,
-  0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
-  0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67,
-  0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 0x6F, 0x6E,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73,
-  0x74, 0x6F, 0x70, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C,
-  0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
-  0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x77,
-  0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65, 0x20, 0x70,
-  0x65, 0x72, 0x69, 0x6F, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69,
-  0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x68, 0x79,
-  0x73, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x71, 0x75, 0x61, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x6D,
-  0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x69, 0x73, 0x20, 0x31, 0x20, 0x73, 0x65, 0x63,
-  0x6F, 0x6E, 0x64, 0x2E, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x5D,
-  0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x51, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x29, 0x2C,
-  0x49, 0x3D, 0x28, 0x61, 0x28, 0x34, 0x36, 0x29, 0x2C, 0x61, 0x28, 0x37, 0x35, 0x29, 0x29, 0x3B,
-  0x76, 0x61, 0x72, 0x20, 0x4B, 0x2C, 0x5F, 0x3D, 0x5B, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22,
-  0x2F, 0x68, 0x6F, 0x6D, 0x65, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x48, 0x6F, 0x6D,
-  0x65, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x5C, 0x75, 0x30, 0x36,
-  0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x31, 0x5C, 0x75,
-  0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x38, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x32,
-  0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66, 0x61, 0x73, 0x20, 0x66, 0x61, 0x2D, 0x68,
-  0x6F, 0x6D, 0x65, 0x22, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3A, 0x55,
-  0x2C, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x22,
-  0x7D, 0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72,
-  0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x54, 0x65, 0x6D,
-  0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x5C, 0x75, 0x30, 0x36, 0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C,
-  0x75, 0x30, 0x36, 0x33, 0x31, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34,
-  0x38, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x32, 0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66,
-  0x61, 0x73, 0x20, 0x66, 0x61, 0x2D, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
-  0x65, 0x2D, 0x6C, 0x6F, 0x77, 0x22, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74,
-  0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x74, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x6C, 0x65, 0x74, 0x20, 0x61, 0x3D, 0x7B, 0x69,
-  0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74,
-  0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28,
-  0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65,
-  0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30,
-  0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E,
-  0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29,
-  0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28,
-  0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32,
-  0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
-  0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B,
-  0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65,
-  0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35,
-  0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F,
-  0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75,
-  0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A,
-  0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69,
-  0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65,
-  0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E,
-  0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74,
-  0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66,
-  0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E,
-  0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F,
-  0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64,
-  0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65,
-  0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76,
-  0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78,
-  0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61,
-  0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73,
-  0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31,
-  0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72,
-  0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E,
-  0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A,
-  0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39,
-  0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B,
-  0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C,
-  0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x32, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21,
-  0x31, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D,
-  0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22,
-  0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65,
-  0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C,
-  0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72,
-  0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74,
-  0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32,
-  0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72,
-  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30,
-  0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53,
-  0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A,
-  0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C,
-  0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32,
-  0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
-  0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63,
-  0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64,
-  0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F,
-  0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35,
-  0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64,
-  0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64,
-  0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A,
-  0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72,
-  0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65,
-  0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65,
-  0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67,
-  0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A,
-  0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F,
-  0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73,
-  0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B,
-  0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61,
-  0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74,
-  0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64,
-  0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72,
-  0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30,
-  0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65,
-  0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D,
-  0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29,
-  0x7B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x65, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65,
-  0x71, 0x75, 0x65, 0x73, 0x74, 0x3B, 0x65, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-  0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x34, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x61, 0x64,
-  0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x26, 0x26, 0x32, 0x30, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E,
-  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x26, 0x26, 0x28, 0x74, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x73,
-  0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x7D, 0x2C, 0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x22,
-  0x47, 0x45, 0x54, 0x22, 0x2C, 0x22, 0x52, 0x65, 0x61, 0x64, 0x5F, 0x54, 0x65, 0x6D, 0x70, 0x65,
-  0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x65, 0x2E, 0x73, 0x65,
-  0x6E, 0x64, 0x28, 0x29, 0x7D, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x64,
-  0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28,
-  0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x64,
-  0x61, 0x74, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x78, 0x3A, 0x44, 0x61, 0x74, 0x65,
-  0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x2C, 0x79, 0x3A, 0x74, 0x7D, 0x29, 0x7D, 0x29, 0x29, 0x7D,
-  0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C,
-  0x73, 0x74, 0x6F, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65,
-  0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74,
-  0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E,
-  0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33,
-  0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28,
-  0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22,
-  0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70,
-  0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C,
-  0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65,
-  0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63,
-  0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62,
-  0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38,
-  0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68,
-  0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D,
-  0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65,
-  0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66,
-  0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35,
-  0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48,
-  0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F,
-  0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32,
-  0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69,
-  0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42,
-  0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F,
-  0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61,
-  0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74,
-  0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70,
-  0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65,
-  0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C,
-  0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35,
-  0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F,
-  0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62,
-  0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61,
-  0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E,
-  0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63,
-  0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65,
-  0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69,
-  0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41,
-  0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74,
-  0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65,
-  0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31,
-  0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65,
-  0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61,
-  0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73,
-  0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61,
-  0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B,
-  0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22,
-  0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x35, 0x30, 0x30, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A,
-  0x21, 0x30, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69,
-  0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
-  0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52,
-  0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28,
-  0x65, 0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65,
-  0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x7D, 0x3B, 0x63, 0x6F,
-  0x6E, 0x73, 0x74, 0x20, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x22, 0x29, 0x2C,
-  0x6F, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x72, 0x2C,
-  0x31, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61,
-  0x29, 0x28, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x3D,
-  0x69, 0x5B, 0x31, 0x5D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B, 0x64, 0x28, 0x65, 0x29, 0x7D,
-  0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74,
-  0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-  0x6E, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x78, 0x73,
-  0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x58, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x61,
-  0x72, 0x64, 0x2D, 0x63, 0x68, 0x61, 0x72, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x56, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C,
-  0x65, 0x66, 0x74, 0x22, 0x2C, 0x73, 0x6D, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68, 0x32, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x65, 0x6D, 0x70, 0x65,
-  0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x68, 0x61, 0x72,
-  0x74, 0x2D, 0x61, 0x72, 0x65, 0x61, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x51,
-  0x2E, 0x4C, 0x69, 0x6E, 0x65, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x61, 0x5B, 0x6F, 0x5D,
-  0x2C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x61, 0x5B, 0x63, 0x5D, 0x7D, 0x29, 0x7D,
-  0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22,
-  0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2D, 0x62, 0x75, 0x74,
-  0x74, 0x6F, 0x6E, 0x73, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x6C, 0x2D, 0x61, 0x75, 0x74,
-  0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63,
-  0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x6D, 0x64, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68,
-  0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43, 0x6F, 0x6E,
-  0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6C, 0x67, 0x3A,
-  0x22, 0x38, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64,
-  0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C,
-  0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74,
-  0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D,
-  0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28,
-  0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x22,
-  0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x7D, 0x29,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45,
-  0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69,
-  0x76, 0x65, 0x3A, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22,
-  0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28,
-  0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74,
-  0x6F, 0x70, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D,
-  0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C,
-  0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x22, 0x7D,
-  0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72,
-  0x65, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72,
-  0x65, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x5C, 0x75, 0x30, 0x36,
-  0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x31, 0x5C, 0x75,
-  0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x38, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x32,
-  0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66, 0x61, 0x73, 0x20, 0x66, 0x61, 0x2D, 0x74,
-  0x61, 0x63, 0x68, 0x6F, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x2D, 0x61, 0x6C, 0x74, 0x22, 0x2C, 0x63,
-  0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-  0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3B,
-  0x6C, 0x65, 0x74, 0x20, 0x61, 0x3D, 0x7B, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61,
-  0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74,
-  0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65,
-  0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34,
-  0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34,
-  0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28,
-  0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C,
-  0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C,
-  0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61,
-  0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42,
-  0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61,
-  0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67,
-  0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38,
-  0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F,
-  0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E,
-  0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74,
-  0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73,
-  0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x69,
-  0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E,
-  0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A,
-  0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C,
-  0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A,
-  0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-  0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22,
-  0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E,
-  0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C,
-  0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69,
-  0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74,
-  0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72,
-  0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61,
-  0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72,
-  0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67,
-  0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72,
-  0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30,
-  0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22,
-  0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C,
-  0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65,
-  0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-  0x3A, 0x32, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33,
-  0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x31, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F,
-  0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A,
-  0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69,
-  0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65,
-  0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D,
-  0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65,
-  0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F,
-  0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74,
-  0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74,
-  0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61,
-  0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39,
-  0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64,
-  0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21,
-  0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61,
-  0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68,
-  0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61,
-  0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23,
-  0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72,
-  0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66,
-  0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69,
-  0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48,
-  0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34,
-  0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61,
-  0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74,
-  0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21,
-  0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
-  0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B,
-  0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46,
-  0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C,
-  0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23,
-  0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67,
-  0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D,
-  0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E,
-  0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
-  0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65,
-  0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C,
-  0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50,
-  0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72,
-  0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72,
-  0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D,
-  0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78,
-  0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61,
-  0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
-  0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C,
-  0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69,
-  0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22,
-  0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D,
-  0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E,
-  0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x58,
-  0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x3B, 0x65, 0x2E,
-  0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E,
-  0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x34, 0x3D,
-  0x3D, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x26, 0x26,
-  0x32, 0x30, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x26, 0x26,
-  0x28, 0x74, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x7D, 0x2C,
-  0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x22, 0x52, 0x65,
-  0x61, 0x64, 0x5F, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x21, 0x30, 0x29,
-  0x2C, 0x65, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x29, 0x7D, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x64,
-  0x61, 0x74, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72,
-  0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65,
-  0x29, 0x7B, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x78,
-  0x3A, 0x44, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x2C, 0x79, 0x3A, 0x74, 0x7D,
-  0x29, 0x7D, 0x29, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65,
-  0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F,
-  0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74,
-  0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74,
-  0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61,
-  0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39,
-  0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64,
-  0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21,
-  0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61,
-  0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68,
-  0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61,
-  0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23,
-  0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72,
-  0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66,
-  0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69,
-  0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48,
-  0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34,
-  0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F,
-  0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61,
-  0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31,
-  0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
-  0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62,
-  0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F,
-  0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62,
-  0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36,
-  0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A,
-  0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F,
-  0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74,
-  0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F,
-  0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73,
-  0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65,
-  0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65,
-  0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69,
-  0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62,
-  0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30,
-  0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C,
-  0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41,
-  0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C,
-  0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34,
-  0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x35, 0x30, 0x30, 0x2C, 0x70,
-  0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64,
-  0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73,
-  0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65,
-  0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63,
-  0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28,
-  0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D,
-  0x7D, 0x7D, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75,
-  0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61,
-  0x74, 0x61, 0x22, 0x29, 0x2C, 0x6F, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E,
-  0x61, 0x29, 0x28, 0x72, 0x2C, 0x31, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61,
-  0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F,
-  0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x5B,
-  0x30, 0x5D, 0x2C, 0x64, 0x3D, 0x69, 0x5B, 0x31, 0x5D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B,
-  0x64, 0x28, 0x65, 0x29, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61,
-  0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64,
-  0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E,
-  0x61, 0x2C, 0x7B, 0x78, 0x73, 0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x63, 0x68, 0x61, 0x72, 0x74, 0x22, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45,
-  0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74,
-  0x65, 0x78, 0x74, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x73, 0x6D, 0x3A, 0x22, 0x36, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67,
-  0x3A, 0x22, 0x68, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22,
-  0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76,
-  0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x68,
-  0x61, 0x72, 0x74, 0x2D, 0x61, 0x72, 0x65, 0x61, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x51, 0x2E, 0x4C, 0x69, 0x6E, 0x65, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x61, 0x5B,
-  0x6F, 0x5D, 0x2C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x61, 0x5B, 0x63, 0x5D, 0x7D,
-  0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64,
-  0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x58, 0x2E, 0x61,
-  0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2D, 0x62,
-  0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x6C, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x78, 0x74,
-  0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x6D, 0x64, 0x3A, 0x22, 0x36, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A,
-  0x22, 0x68, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43,
-  0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C, 0x22, 0x7D, 0x29, 0x7D,
-  0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78,
-  0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6C,
-  0x67, 0x3A, 0x22, 0x38, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B,
-  0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E,
-  0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61,
-  0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22,
-  0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D,
-  0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E,
-  0x62, 0x28, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22,
-  0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x61, 0x72,
-  0x74, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22,
-  0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21,
-  0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B,
-  0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74,
-  0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22,
-  0x53, 0x74, 0x6F, 0x70, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29,
-  0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29,
-  0x7D, 0x2C, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E,
-  0x22, 0x7D, 0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x68, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x48, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x5C, 0x75,
-  0x30, 0x36, 0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x31,
-  0x5C, 0x75, 0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x38, 0x5C, 0x75, 0x30, 0x36,
-  0x33, 0x32, 0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66, 0x61, 0x73, 0x20, 0x66, 0x61,
-  0x2D, 0x74, 0x69, 0x6E, 0x74, 0x22, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74,
-  0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x74, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x6C, 0x65, 0x74, 0x20, 0x61, 0x3D, 0x7B, 0x69,
-  0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74,
-  0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28,
-  0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65,
-  0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30,
-  0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E,
-  0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29,
-  0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28,
-  0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32,
-  0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
-  0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B,
-  0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65,
-  0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35,
-  0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F,
-  0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75,
-  0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A,
-  0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69,
-  0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65,
-  0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E,
-  0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74,
-  0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66,
-  0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E,
-  0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F,
-  0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64,
-  0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65,
-  0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76,
-  0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78,
-  0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61,
-  0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73,
-  0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31,
-  0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72,
-  0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E,
-  0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A,
-  0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39,
-  0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B,
-  0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C,
-  0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x32, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21,
-  0x31, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D,
-  0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22,
-  0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65,
-  0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C,
-  0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72,
-  0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74,
-  0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32,
-  0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72,
-  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30,
-  0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53,
-  0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A,
-  0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C,
-  0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32,
-  0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
-  0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63,
-  0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64,
-  0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F,
-  0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35,
-  0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64,
-  0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64,
-  0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A,
-  0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72,
-  0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65,
-  0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65,
-  0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67,
-  0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A,
-  0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F,
-  0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73,
-  0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B,
-  0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61,
-  0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74,
-  0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64,
-  0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72,
-  0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30,
-  0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65,
-  0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D,
-  0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29,
-  0x7B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x65, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65,
-  0x71, 0x75, 0x65, 0x73, 0x74, 0x3B, 0x65, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-  0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x34, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x61, 0x64,
-  0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x26, 0x26, 0x32, 0x30, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E,
-  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x26, 0x26, 0x28, 0x74, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x73,
-  0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x7D, 0x2C, 0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x22,
-  0x47, 0x45, 0x54, 0x22, 0x2C, 0x22, 0x52, 0x65, 0x61, 0x64, 0x5F, 0x48, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x65, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28,
-  0x29, 0x7D, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61,
-  0x73, 0x65, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61,
-  0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x78, 0x3A, 0x44, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x6F,
-  0x77, 0x28, 0x29, 0x2C, 0x79, 0x3A, 0x74, 0x7D, 0x29, 0x7D, 0x29, 0x29, 0x7D, 0x2C, 0x64, 0x65,
-  0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F,
-  0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74,
-  0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32,
-  0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72,
-  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30,
-  0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53,
-  0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A,
-  0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C,
-  0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32,
-  0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
-  0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
-  0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74,
-  0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A,
-  0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F,
-  0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22,
-  0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79,
-  0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69,
-  0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72,
-  0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65,
-  0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A,
-  0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73,
-  0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65,
-  0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B,
-  0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30,
-  0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C,
-  0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70,
-  0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66,
-  0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39,
-  0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79,
-  0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75,
-  0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65,
-  0x73, 0x68, 0x3A, 0x35, 0x30, 0x30, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30, 0x2C,
-  0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A,
-  0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C,
-  0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72,
-  0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B,
-  0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79,
-  0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x7D, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-  0x20, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28,
-  0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x22, 0x29, 0x2C, 0x6F, 0x3D, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x72, 0x2C, 0x31, 0x29, 0x5B,
-  0x30, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29,
-  0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x73,
-  0x2C, 0x32, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x3D, 0x69, 0x5B, 0x31,
-  0x5D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B, 0x64, 0x28, 0x65, 0x29, 0x7D, 0x3B, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x78, 0x73, 0x3A, 0x22, 0x31,
-  0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D,
-  0x63, 0x68, 0x61, 0x72, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56,
-  0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73,
-  0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x65, 0x66, 0x74,
-  0x22, 0x2C, 0x73, 0x6D, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68, 0x32, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79,
-  0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2D, 0x61, 0x72, 0x65, 0x61,
-  0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x51, 0x2E, 0x4C, 0x69, 0x6E, 0x65, 0x2C,
-  0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x61, 0x5B, 0x6F, 0x5D, 0x2C, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x73, 0x3A, 0x61, 0x5B, 0x63, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29,
-  0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64,
-  0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2D, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61,
-  0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x6C, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22,
-  0x2C, 0x6D, 0x64, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47,
-  0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70,
-  0x61, 0x6E, 0x65, 0x6C, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72,
-  0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6C, 0x67, 0x3A, 0x22, 0x38, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
-  0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22,
-  0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B,
-  0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70,
-  0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C,
-  0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74,
-  0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61,
-  0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64,
-  0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C,
-  0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74,
-  0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29,
-  0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22,
-  0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x6F, 0x70, 0x22, 0x7D, 0x29, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74,
-  0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x22, 0x7D, 0x5D, 0x3B, 0x76, 0x61, 0x72, 0x20,
-  0x59, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F,
-  0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x64, 0x2E, 0x67,
-  0x29, 0x28, 0x29, 0x2C, 0x61, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x52, 0x65, 0x66,
-  0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x2C, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x31, 0x21, 0x3D, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-  0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-  0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E,
-  0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6F, 0x70, 0x65, 0x6E, 0x22,
-  0x29, 0x29, 0x2C, 0x6F, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29,
-  0x28, 0x72, 0x2C, 0x32, 0x29, 0x2C, 0x73, 0x3D, 0x6F, 0x5B, 0x30, 0x5D, 0x2C, 0x69, 0x3D, 0x6F,
-  0x5B, 0x31, 0x5D, 0x3B, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63,
-  0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x69, 0x66, 0x28, 0x6E, 0x61, 0x76, 0x69, 0x67,
-  0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x69, 0x6E,
-  0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22, 0x29, 0x3E, 0x2D, 0x31, 0x29,
-  0x7B, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-  0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x2B, 0x3D, 0x22, 0x20, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D, 0x73,
-  0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x6E, 0x22, 0x2C, 0x64, 0x6F, 0x63,
-  0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C,
-  0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E,
-  0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D,
-  0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x66, 0x66, 0x22, 0x29, 0x2C,
-  0x4B, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x78, 0x2E, 0x61, 0x28, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72,
-  0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x73, 0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x53, 0x63, 0x72,
-  0x6F, 0x6C, 0x6C, 0x58, 0x3A, 0x21, 0x30, 0x7D, 0x29, 0x3B, 0x6C, 0x65, 0x74, 0x20, 0x65, 0x3D,
-  0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
-  0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x2E, 0x74, 0x61, 0x62, 0x6C,
-  0x65, 0x2D, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x22, 0x29, 0x3B, 0x66,
-  0x6F, 0x72, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x30, 0x3B, 0x74, 0x3C, 0x65, 0x2E, 0x6C,
-  0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x74, 0x2B, 0x2B, 0x29, 0x4B, 0x3D, 0x6E, 0x65, 0x77, 0x20,
-  0x78, 0x2E, 0x61, 0x28, 0x65, 0x5B, 0x74, 0x5D, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-  0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6E, 0x61, 0x76, 0x69,
-  0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x69,
-  0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22, 0x29, 0x3E, 0x2D, 0x31,
-  0x26, 0x26, 0x28, 0x4B, 0x2E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x28, 0x29, 0x2C, 0x64,
-  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-  0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73,
-  0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D, 0x73,
-  0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x66, 0x66, 0x22, 0x29, 0x2C, 0x64,
-  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-  0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73,
-  0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63,
-  0x74, 0x2D, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x6E, 0x22, 0x29,
-  0x29, 0x7D, 0x7D, 0x29, 0x29, 0x2C, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66,
-  0x65, 0x63, 0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x69, 0x66, 0x28, 0x6E, 0x61, 0x76,
-  0x69, 0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E,
-  0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22, 0x29, 0x3E, 0x2D,
-  0x31, 0x29, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x65, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-  0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41,
-  0x6C, 0x6C, 0x28, 0x22, 0x2E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x65, 0x73, 0x70, 0x6F,
-  0x6E, 0x73, 0x69, 0x76, 0x65, 0x22, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x6C, 0x65, 0x74, 0x20,
-  0x74, 0x3D, 0x30, 0x3B, 0x74, 0x3C, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x74,
-  0x2B, 0x2B, 0x29, 0x4B, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x78, 0x2E, 0x61, 0x28, 0x65, 0x5B, 0x74,
-  0x5D, 0x29, 0x7D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75,
-  0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x63, 0x72, 0x6F,
-  0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x30, 0x2C, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-  0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-  0x74, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x30, 0x2C, 0x61, 0x2E,
-  0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72,
-  0x65, 0x6E, 0x74, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x30, 0x29,
-  0x7D, 0x29, 0x2C, 0x5B, 0x74, 0x5D, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x3D,
-  0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F,
-  0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x28, 0x22,
-  0x6E, 0x61, 0x76, 0x2D, 0x6F, 0x70, 0x65, 0x6E, 0x22, 0x29, 0x2C, 0x69, 0x28, 0x21, 0x73, 0x29,
-  0x7D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x6C, 0x65, 0x74, 0x20,
-  0x61, 0x3D, 0x30, 0x3B, 0x61, 0x3C, 0x5F, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x61,
-  0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x2D, 0x31, 0x21, 0x3D, 0x3D, 0x74, 0x2E, 0x70, 0x61, 0x74,
-  0x68, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x5F, 0x5B,
-  0x61, 0x5D, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x2B, 0x5F, 0x5B, 0x61, 0x5D, 0x2E, 0x70,
-  0x61, 0x74, 0x68, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x5F, 0x5B, 0x61, 0x5D,
-  0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x42, 0x72, 0x61,
-  0x6E, 0x64, 0x22, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x66, 0x2E, 0x43, 0x6F, 0x6E, 0x73,
-  0x75, 0x6D, 0x65, 0x72, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x28,
-  0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x65, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x43,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x72, 0x7D, 0x29, 0x3D, 0x3E, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x6E, 0x2E, 0x61, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65,
-  0x72, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x4C, 0x2C, 0x7B, 0x72, 0x6F,
-  0x75, 0x74, 0x65, 0x73, 0x3A, 0x5F, 0x2C, 0x6C, 0x6F, 0x67, 0x6F, 0x3A, 0x7B, 0x6F, 0x75, 0x74,
-  0x74, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x3A, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F,
-  0x2F, 0x77, 0x77, 0x77, 0x2E, 0x73, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x22, 0x2C, 0x69, 0x6D,
-  0x67, 0x53, 0x72, 0x63, 0x3A, 0x22, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x69, 0x6D, 0x61, 0x67, 0x65,
-  0x2F, 0x70, 0x6E, 0x67, 0x3B, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2C, 0x69, 0x56, 0x42, 0x4F,
-  0x52, 0x77, 0x30, 0x4B, 0x47, 0x67, 0x6F, 0x41, 0x41, 0x41, 0x41, 0x4E, 0x53, 0x55, 0x68, 0x45,
-  0x55, 0x67, 0x41, 0x41, 0x41, 0x54, 0x38, 0x41, 0x41, 0x41, 0x44, 0x53, 0x43, 0x41, 0x59, 0x41,
-  0x41, 0x41, 0x41, 0x38, 0x43, 0x38, 0x64, 0x44, 0x41, 0x41, 0x41, 0x41, 0x47, 0x58, 0x52, 0x46,
-  0x57, 0x48, 0x52, 0x54, 0x62, 0x32, 0x5A, 0x30, 0x64, 0x32, 0x46, 0x79, 0x5A, 0x51, 0x42, 0x42,
-  0x5A, 0x47, 0x39, 0x69, 0x5A, 0x53, 0x42, 0x4A, 0x62, 0x57, 0x46, 0x6E, 0x5A, 0x56, 0x4A, 0x6C,
-  0x59, 0x57, 0x52, 0x35, 0x63, 0x63, 0x6C, 0x6C, 0x50, 0x41, 0x41, 0x41, 0x43, 0x69, 0x5A, 0x4A,
-  0x52, 0x45, 0x46, 0x55, 0x65, 0x4E, 0x72, 0x73, 0x33, 0x65, 0x31, 0x78, 0x31, 0x45, 0x6F, 0x57,
-  0x42, 0x6D, 0x44, 0x35, 0x46, 0x67, 0x47, 0x59, 0x44, 0x4F, 0x77, 0x49, 0x31, 0x6B, 0x53, 0x77,
-  0x34, 0x77, 0x78, 0x4D, 0x42, 0x41, 0x77, 0x52, 0x59, 0x43, 0x4C, 0x41, 0x52, 0x41, 0x42, 0x45,
-  0x34, 0x43, 0x45, 0x43, 0x7A, 0x30, 0x62, 0x67, 0x49, 0x51, 0x4B, 0x38, 0x45, 0x65, 0x41, 0x4D,
-  0x37, 0x41, 0x79, 0x38, 0x30, 0x6B, 0x56, 0x51, 0x46, 0x4D, 0x56, 0x79, 0x52, 0x31, 0x69, 0x6E,
-  0x76, 0x2F, 0x51, 0x38, 0x56, 0x56, 0x4F, 0x75, 0x34, 0x6F, 0x64, 0x78, 0x53, 0x7A, 0x50, 0x76,
-  0x6E, 0x4B, 0x4E, 0x57, 0x74, 0x37, 0x6F, 0x4F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x6F, 0x48, 0x67, 0x48, 0x44, 0x6B, 0x45, 0x64, 0x48, 0x68, 0x34, 0x65,
-  0x6A, 0x76, 0x6F, 0x66, 0x71, 0x2F, 0x34, 0x31, 0x2F, 0x50, 0x7A, 0x33, 0x2B, 0x4D, 0x38, 0x72,
-  0x52, 0x34, 0x61, 0x4D, 0x33, 0x68, 0x34, 0x63, 0x48, 0x46, 0x77, 0x49, 0x50, 0x79, 0x49, 0x43,
-  0x62, 0x77, 0x69, 0x33, 0x46, 0x7A, 0x2B, 0x45, 0x48, 0x70, 0x51, 0x56, 0x49, 0x4C, 0x31, 0x61,
-  0x2F, 0x2F, 0x59, 0x6E, 0x54, 0x6C, 0x39, 0x78, 0x67, 0x58, 0x66, 0x59, 0x2F, 0x31, 0x6A, 0x33,
-  0x72, 0x31, 0x63, 0x43, 0x6A, 0x38, 0x4C, 0x64, 0x31, 0x76, 0x7A, 0x48, 0x43, 0x37, 0x2B, 0x79,
-  0x67, 0x75, 0x39, 0x69, 0x44, 0x4C, 0x31, 0x44, 0x52, 0x34, 0x4D, 0x4B, 0x66, 0x4B, 0x79, 0x36,
-  0x61, 0x6E, 0x58, 0x2B, 0x69, 0x6D, 0x6C, 0x76, 0x4C, 0x31, 0x56, 0x36, 0x56, 0x4F, 0x61, 0x34,
-  0x37, 0x33, 0x71, 0x72, 0x72, 0x66, 0x37, 0x2B, 0x63, 0x76, 0x36, 0x79, 0x42, 0x39, 0x2B, 0x37,
-  0x2F, 0x73, 0x65, 0x31, 0x34, 0x4B, 0x4D, 0x79, 0x6D, 0x35, 0x71, 0x44, 0x54, 0x39, 0x75, 0x62,
-  0x4E, 0x2F, 0x51, 0x4F, 0x78, 0x39, 0x41, 0x37, 0x63, 0x54, 0x54, 0x51, 0x38, 0x6D, 0x70, 0x37,
-  0x6C, 0x78, 0x4A, 0x38, 0x4A, 0x32, 0x50, 0x77, 0x75, 0x62, 0x5A, 0x48, 0x6A, 0x57, 0x37, 0x37,
-  0x71, 0x75, 0x2B, 0x34, 0x39, 0x6B, 0x46, 0x6F, 0x65, 0x77, 0x55, 0x66, 0x54, 0x50, 0x57, 0x32,
-  0x68, 0x55, 0x47, 0x6F, 0x2F, 0x41, 0x51, 0x66, 0x54, 0x48, 0x48, 0x66, 0x66, 0x5A, 0x33, 0x6F,
-  0x75, 0x46, 0x66, 0x35, 0x73, 0x57, 0x2F, 0x77, 0x44, 0x59, 0x46, 0x33, 0x4A, 0x66, 0x69, 0x6F,
-  0x33, 0x4C, 0x61, 0x46, 0x34, 0x42, 0x4E, 0x2B, 0x61, 0x51, 0x33, 0x42, 0x64, 0x2B, 0x51, 0x77,
-  0x55, 0x4C, 0x6B, 0x50, 0x72, 0x51, 0x78, 0x45, 0x2B, 0x4B, 0x57, 0x70, 0x2B, 0x69, 0x34, 0x36,
-  0x36, 0x33, 0x43, 0x70, 0x33, 0x36, 0x36, 0x76, 0x2B, 0x6D, 0x36, 0x45, 0x48, 0x2F, 0x73, 0x47,
-  0x33, 0x31, 0x44, 0x74, 0x76, 0x58, 0x45, 0x6B, 0x61, 0x4D, 0x44, 0x48, 0x6C, 0x67, 0x5A, 0x6A,
-  0x77, 0x69, 0x4D, 0x2B, 0x2F, 0x4B, 0x35, 0x56, 0x66, 0x54, 0x54, 0x67, 0x76, 0x71, 0x2F, 0x36,
-  0x6E, 0x72, 0x59, 0x30, 0x49, 0x4A, 0x56, 0x66, 0x62, 0x50, 0x43, 0x74, 0x42, 0x42, 0x2B, 0x4E,
-  0x2B, 0x4E, 0x44, 0x61, 0x67, 0x4B, 0x7A, 0x77, 0x69, 0x46, 0x56, 0x69, 0x75, 0x7A, 0x74, 0x63,
-  0x73, 0x37, 0x6C, 0x33, 0x61, 0x70, 0x68, 0x53, 0x39, 0x66, 0x57, 0x76, 0x39, 0x38, 0x4B, 0x50,
-  0x47, 0x71, 0x71, 0x2B, 0x34, 0x63, 0x32, 0x36, 0x36, 0x31, 0x2F, 0x2F, 0x48, 0x58, 0x2F, 0x65,
-  0x31, 0x72, 0x34, 0x4F, 0x45, 0x34, 0x52, 0x66, 0x50, 0x56, 0x35, 0x6B, 0x43, 0x4C, 0x78, 0x74,
-  0x2F, 0x2F, 0x72, 0x59, 0x42, 0x39, 0x33, 0x4F, 0x34, 0x51, 0x64, 0x79, 0x56, 0x48, 0x32, 0x48,
-  0x44, 0x2B, 0x6C, 0x38, 0x36, 0x56, 0x2F, 0x72, 0x38, 0x53, 0x5A, 0x71, 0x67, 0x4B, 0x7A, 0x68,
-  0x64, 0x35, 0x45, 0x67, 0x39, 0x4F, 0x37, 0x36, 0x31, 0x37, 0x6D, 0x6A, 0x44, 0x5A, 0x51, 0x55,
-  0x66, 0x6C, 0x2B, 0x43, 0x67, 0x2B, 0x39, 0x4B, 0x70, 0x51, 0x65, 0x55, 0x46, 0x6E, 0x78, 0x6E,
-  0x77, 0x63, 0x47, 0x6E, 0x32, 0x67, 0x4F, 0x4B, 0x44, 0x4C, 0x2F, 0x72, 0x77, 0x44, 0x5A, 0x33,
-  0x35, 0x51, 0x67, 0x44, 0x4A, 0x51, 0x62, 0x66, 0x55, 0x57, 0x44, 0x77, 0x32, 0x66, 0x45, 0x5A,
-  0x5A, 0x6D, 0x53, 0x46, 0x78, 0x37, 0x78, 0x65, 0x42, 0x66, 0x33, 0x65, 0x30, 0x35, 0x59, 0x57,
-  0x6C, 0x41, 0x50, 0x74, 0x56, 0x58, 0x35, 0x33, 0x41, 0x56, 0x58, 0x66, 0x32, 0x70, 0x45, 0x46,
-  0x53, 0x67, 0x36, 0x2B, 0x64, 0x63, 0x53, 0x73, 0x72, 0x69, 0x4D, 0x4C, 0x6C, 0x42, 0x35, 0x2B,
-  0x6E, 0x77, 0x4F, 0x75, 0x38, 0x37, 0x6D, 0x64, 0x42, 0x53, 0x67, 0x36, 0x2B, 0x45, 0x36, 0x30,
-  0x75, 0x38, 0x41, 0x53, 0x77, 0x2B, 0x39, 0x79, 0x35, 0x75, 0x43, 0x37, 0x64, 0x6C, 0x53, 0x42,
-  0x30, 0x6F, 0x4D, 0x76, 0x59, 0x68, 0x33, 0x76, 0x6D, 0x53, 0x4D, 0x4C, 0x73, 0x64, 0x7A, 0x71,
-  0x38, 0x6E, 0x68, 0x7A, 0x74, 0x36, 0x66, 0x44, 0x39, 0x6C, 0x4E, 0x62, 0x68, 0x78, 0x57, 0x45,
-  0x58, 0x2B, 0x6E, 0x6D, 0x76, 0x72, 0x66, 0x76, 0x67, 0x30, 0x4D, 0x4B, 0x77, 0x71, 0x2F, 0x30,
-  0x6C, 0x6E, 0x64, 0x6F, 0x54, 0x34, 0x39, 0x6D, 0x2F, 0x72, 0x57, 0x71, 0x50, 0x68, 0x42, 0x2B,
-  0x78, 0x5A, 0x74, 0x37, 0x77, 0x39, 0x49, 0x62, 0x4F, 0x79, 0x36, 0x44, 0x38, 0x43, 0x75, 0x39,
-  0x36, 0x68, 0x73, 0x71, 0x76, 0x72, 0x6B, 0x6E, 0x4A, 0x6E, 0x61, 0x4F, 0x4C, 0x41, 0x69, 0x2F,
-  0x30, 0x6B, 0x57, 0x73, 0x34, 0x2F, 0x33, 0x6B, 0x73, 0x45, 0x49, 0x61, 0x6E, 0x74, 0x76, 0x37,
-  0x35, 0x35, 0x58, 0x66, 0x58, 0x66, 0x39, 0x6A, 0x37, 0x68, 0x55, 0x59, 0x78, 0x31, 0x46, 0x74,
-  0x37, 0x33, 0x68, 0x39, 0x63, 0x6E, 0x69, 0x61, 0x6E, 0x4E, 0x31, 0x68, 0x70, 0x68, 0x76, 0x4F,
-  0x79, 0x57, 0x6D, 0x44, 0x35, 0x32, 0x59, 0x59, 0x7A, 0x37, 0x4E, 0x2B, 0x58, 0x49, 0x74, 0x38,
-  0x6D, 0x70, 0x2F, 0x4B, 0x37, 0x38, 0x2F, 0x65, 0x72, 0x4F, 0x75, 0x41, 0x34, 0x4F, 0x73, 0x43,
-  0x50, 0x31, 0x79, 0x58, 0x2F, 0x59, 0x38, 0x72, 0x77, 0x66, 0x66, 0x48, 0x6A, 0x72, 0x72, 0x35,
-  0x62, 0x32, 0x6E, 0x36, 0x38, 0x62, 0x32, 0x55, 0x36, 0x39, 0x79, 0x45, 0x6A, 0x55, 0x76, 0x34,
-  0x74, 0x53, 0x76, 0x69, 0x79, 0x57, 0x77, 0x33, 0x51, 0x52, 0x2B, 0x75, 0x38, 0x79, 0x57, 0x2F,
-  0x77, 0x55, 0x73, 0x2B, 0x50, 0x2B, 0x50, 0x61, 0x37, 0x58, 0x65, 0x5A, 0x78, 0x37, 0x55, 0x54,
-  0x66, 0x75, 0x7A, 0x37, 0x68, 0x68, 0x32, 0x2B, 0x6F, 0x56, 0x63, 0x42, 0x76, 0x7A, 0x71, 0x71,
-  0x39, 0x58, 0x6A, 0x6C, 0x72, 0x44, 0x32, 0x2B, 0x50, 0x51, 0x79, 0x36, 0x38, 0x54, 0x79, 0x6B,
-  0x67, 0x35, 0x67, 0x34, 0x72, 0x73, 0x58, 0x75, 0x45, 0x79, 0x6E, 0x38, 0x47, 0x67, 0x36, 0x54,
-  0x63, 0x55, 0x62, 0x36, 0x79, 0x43, 0x6C, 0x37, 0x74, 0x49, 0x2B, 0x4E, 0x76, 0x70, 0x66, 0x65,
-  0x4C, 0x76, 0x6D, 0x6B, 0x43, 0x72, 0x2F, 0x70, 0x62, 0x55, 0x70, 0x4E, 0x36, 0x32, 0x35, 0x74,
-  0x69, 0x54, 0x57, 0x50, 0x54, 0x63, 0x42, 0x37, 0x61, 0x5A, 0x58, 0x35, 0x69, 0x2B, 0x6E, 0x62,
-  0x51, 0x2B, 0x36, 0x46, 0x48, 0x31, 0x57, 0x30, 0x4B, 0x5A, 0x4F, 0x4D, 0x4C, 0x63, 0x32, 0x39,
-  0x30, 0x2F, 0x61, 0x34, 0x34, 0x41, 0x75, 0x61, 0x69, 0x48, 0x71, 0x52, 0x65, 0x56, 0x7A, 0x62,
-  0x70, 0x63, 0x37, 0x79, 0x43, 0x72, 0x2F, 0x47, 0x57, 0x39, 0x34, 0x66, 0x57, 0x43, 0x74, 0x63,
-  0x57, 0x4D, 0x73, 0x37, 0x58, 0x6F, 0x35, 0x59, 0x65, 0x31, 0x38, 0x49, 0x76, 0x31, 0x70, 0x61,
-  0x33, 0x75, 0x67, 0x32, 0x5A, 0x52, 0x58, 0x30, 0x65, 0x39, 0x39, 0x33, 0x51, 0x54, 0x50, 0x4A,
-  0x43, 0x7A, 0x42, 0x4D, 0x43, 0x4F, 0x79, 0x43, 0x4F, 0x6F, 0x69, 0x63, 0x64, 0x68, 0x36, 0x49,
-  0x4A, 0x66, 0x78, 0x61, 0x72, 0x2F, 0x71, 0x36, 0x73, 0x62, 0x55, 0x35, 0x46, 0x59, 0x42, 0x2F,
-  0x4A, 0x47, 0x70, 0x43, 0x49, 0x48, 0x66, 0x4C, 0x2B, 0x39, 0x47, 0x70, 0x74, 0x63, 0x4A, 0x6A,
-  0x53, 0x70, 0x76, 0x79, 0x4A, 0x63, 0x46, 0x2F, 0x64, 0x52, 0x70, 0x55, 0x61, 0x58, 0x79, 0x62,
-  0x72, 0x42, 0x6C, 0x32, 0x69, 0x48, 0x61, 0x6A, 0x38, 0x33, 0x36, 0x47, 0x4C, 0x34, 0x33, 0x6A,
-  0x75, 0x61, 0x2B, 0x4C, 0x6A, 0x54, 0x63, 0x31, 0x58, 0x2B, 0x59, 0x63, 0x56, 0x7A, 0x2B, 0x6D,
-  0x70, 0x30, 0x36, 0x76, 0x79, 0x71, 0x2B, 0x30, 0x4E, 0x69, 0x55, 0x73, 0x6D, 0x49, 0x59, 0x50,
-  0x63, 0x66, 0x39, 0x36, 0x31, 0x67, 0x58, 0x4D, 0x58, 0x44, 0x59, 0x71, 0x61, 0x6B, 0x49, 0x67,
-  0x64, 0x39, 0x58, 0x6E, 0x47, 0x72, 0x44, 0x4B, 0x62, 0x39, 0x4B, 0x33, 0x64, 0x63, 0x51, 0x36,
-  0x33, 0x76, 0x2F, 0x33, 0x67, 0x58, 0x75, 0x65, 0x59, 0x44, 0x79, 0x58, 0x6E, 0x56, 0x55, 0x66,
-  0x2F, 0x32, 0x54, 0x32, 0x64, 0x64, 0x59, 0x4A, 0x4F, 0x34, 0x69, 0x6B, 0x34, 0x31, 0x4C, 0x35,
-  0x74, 0x52, 0x74, 0x38, 0x36, 0x79, 0x37, 0x64, 0x37, 0x53, 0x31, 0x6E, 0x4B, 0x52, 0x35, 0x58,
-  0x32, 0x62, 0x2F, 0x35, 0x58, 0x36, 0x6F, 0x41, 0x66, 0x32, 0x73, 0x58, 0x46, 0x42, 0x43, 0x35,
-  0x72, 0x78, 0x74, 0x76, 0x42, 0x5A, 0x2F, 0x77, 0x4B, 0x37, 0x6C, 0x4E, 0x53, 0x58, 0x49, 0x54,
-  0x39, 0x52, 0x69, 0x41, 0x62, 0x35, 0x33, 0x65, 0x58, 0x34, 0x71, 0x34, 0x76, 0x65, 0x57, 0x77,
-  0x67, 0x47, 0x72, 0x62, 0x52, 0x49, 0x65, 0x32, 0x74, 0x2B, 0x67, 0x32, 0x5A, 0x61, 0x67, 0x36,
-  0x54, 0x68, 0x4E, 0x58, 0x74, 0x70, 0x66, 0x4F, 0x39, 0x6E, 0x63, 0x68, 0x45, 0x77, 0x49, 0x46,
-  0x48, 0x4F, 0x66, 0x68, 0x74, 0x70, 0x31, 0x6A, 0x70, 0x31, 0x66, 0x6C, 0x74, 0x36, 0x38, 0x33,
-  0x47, 0x66, 0x37, 0x50, 0x31, 0x62, 0x68, 0x35, 0x51, 0x70, 0x70, 0x76, 0x76, 0x34, 0x4F, 0x44,
-  0x6F, 0x66, 0x31, 0x39, 0x36, 0x56, 0x52, 0x2F, 0x46, 0x7A, 0x55, 0x68, 0x38, 0x4B, 0x72, 0x52,
-  0x63, 0x61, 0x6E, 0x38, 0x47, 0x71, 0x7A, 0x36, 0x44, 0x73, 0x65, 0x71, 0x4C, 0x38, 0x64, 0x79,
-  0x74, 0x69, 0x51, 0x54, 0x48, 0x37, 0x2B, 0x6F, 0x54, 0x4E, 0x35, 0x31, 0x31, 0x67, 0x4E, 0x48,
-  0x54, 0x48, 0x53, 0x73, 0x75, 0x71, 0x2B, 0x33, 0x47, 0x65, 0x58, 0x30, 0x64, 0x4F, 0x6E, 0x4C,
-  0x32, 0x56, 0x52, 0x2B, 0x2B, 0x7A, 0x76, 0x4C, 0x47, 0x41, 0x52, 0x6E, 0x34, 0x77, 0x63, 0x6D,
-  0x33, 0x62, 0x66, 0x67, 0x31, 0x77, 0x70, 0x77, 0x61, 0x4C, 0x65, 0x58, 0x2F, 0x41, 0x48, 0x5A,
-  0x4E, 0x72, 0x71, 0x4F, 0x64, 0x79, 0x50, 0x34, 0x56, 0x48, 0x35, 0x54, 0x76, 0x71, 0x32, 0x48,
-  0x71, 0x75, 0x38, 0x6F, 0x34, 0x35, 0x2B, 0x51, 0x35, 0x52, 0x72, 0x4E, 0x32, 0x48, 0x4A, 0x66,
-  0x4C, 0x37, 0x51, 0x43, 0x6E, 0x50, 0x30, 0x6D, 0x38, 0x37, 0x47, 0x44, 0x75, 0x4D, 0x73, 0x38,
-  0x72, 0x6D, 0x65, 0x57, 0x73, 0x36, 0x6E, 0x38, 0x70, 0x72, 0x51, 0x70, 0x52, 0x35, 0x6E, 0x2F,
-  0x6A, 0x4B, 0x50, 0x2B, 0x37, 0x30, 0x69, 0x2B, 0x79, 0x2B, 0x2F, 0x34, 0x49, 0x56, 0x6C, 0x69,
-  0x42, 0x64, 0x6A, 0x71, 0x4F, 0x74, 0x34, 0x62, 0x77, 0x53, 0x66, 0x38, 0x61, 0x6D, 0x70, 0x54,
-  0x76, 0x6A, 0x6B, 0x66, 0x72, 0x38, 0x58, 0x6C, 0x43, 0x4D, 0x42, 0x68, 0x4E, 0x63, 0x69, 0x53,
-  0x50, 0x6A, 0x51, 0x6D, 0x4F, 0x72, 0x53, 0x39, 0x69, 0x36, 0x2F, 0x36, 0x68, 0x6F, 0x72, 0x76,
-  0x53, 0x32, 0x46, 0x2F, 0x31, 0x76, 0x4F, 0x67, 0x62, 0x64, 0x54, 0x33, 0x61, 0x64, 0x6D, 0x57,
-  0x73, 0x68, 0x37, 0x34, 0x61, 0x63, 0x41, 0x36, 0x33, 0x75, 0x47, 0x36, 0x38, 0x56, 0x58, 0x47,
-  0x4D, 0x56, 0x6E, 0x48, 0x71, 0x2F, 0x4B, 0x72, 0x71, 0x6B, 0x33, 0x35, 0x6C, 0x61, 0x74, 0x4D,
-  0x46, 0x65, 0x42, 0x53, 0x64, 0x6F, 0x54, 0x5A, 0x4E, 0x4C, 0x71, 0x4F, 0x64, 0x2B, 0x50, 0x6A,
-  0x72, 0x50, 0x4B, 0x62, 0x38, 0x6D, 0x32, 0x64, 0x65, 0x36, 0x4C, 0x6A, 0x64, 0x31, 0x36, 0x4F,
-  0x73, 0x37, 0x49, 0x35, 0x4B, 0x73, 0x44, 0x68, 0x42, 0x74, 0x32, 0x7A, 0x52, 0x6B, 0x2F, 0x37,
-  0x37, 0x42, 0x4D, 0x43, 0x31, 0x76, 0x47, 0x71, 0x2F, 0x47, 0x6F, 0x4C, 0x76, 0x6E, 0x56, 0x58,
-  0x39, 0x67, 0x4E, 0x2F, 0x4C, 0x6E, 0x4E, 0x56, 0x67, 0x4F, 0x4E, 0x39, 0x68, 0x79, 0x31, 0x57,
-  0x45, 0x6C, 0x45, 0x54, 0x41, 0x72, 0x6D, 0x76, 0x39, 0x65, 0x30, 0x45, 0x6E, 0x2F, 0x43, 0x72,
-  0x71, 0x55, 0x33, 0x5A, 0x4E, 0x77, 0x44, 0x50, 0x73, 0x37, 0x51, 0x4A, 0x62, 0x57, 0x36, 0x49,
-  0x45, 0x44, 0x55, 0x68, 0x73, 0x47, 0x35, 0x30, 0x58, 0x4E, 0x72, 0x65, 0x42, 0x71, 0x75, 0x2B,
-  0x45, 0x74, 0x71, 0x55, 0x4B, 0x54, 0x5A, 0x6A, 0x47, 0x4F, 0x55, 0x34, 0x56, 0x73, 0x4D, 0x74,
-  0x4F, 0x4F, 0x63, 0x4E, 0x6E, 0x48, 0x62, 0x72, 0x65, 0x46, 0x56, 0x2B, 0x64, 0x50, 0x56, 0x74,
-  0x55, 0x37, 0x38, 0x65, 0x39, 0x2B, 0x58, 0x4C, 0x55, 0x51, 0x47, 0x2B, 0x37, 0x74, 0x70, 0x59,
-  0x44, 0x78, 0x78, 0x56, 0x78, 0x64, 0x71, 0x6D, 0x58, 0x75, 0x56, 0x58, 0x54, 0x64, 0x57, 0x58,
-  0x63, 0x78, 0x31, 0x76, 0x7A, 0x52, 0x56, 0x67, 0x37, 0x67, 0x72, 0x6E, 0x73, 0x53, 0x4C, 0x57,
-  0x38, 0x51, 0x36, 0x33, 0x42, 0x58, 0x33, 0x4F, 0x50, 0x43, 0x37, 0x72, 0x65, 0x46, 0x56, 0x2B,
-  0x65, 0x38, 0x75, 0x35, 0x6A, 0x6E, 0x65, 0x4F, 0x43, 0x76, 0x41, 0x36, 0x78, 0x53, 0x61, 0x6F,
-  0x76, 0x36, 0x67, 0x41, 0x4E, 0x78, 0x56, 0x58, 0x67, 0x4E, 0x74, 0x47, 0x4E, 0x79, 0x79, 0x31,
-  0x6A, 0x6C, 0x66, 0x34, 0x4E, 0x64, 0x33, 0x79, 0x2F, 0x6D, 0x7A, 0x56, 0x76, 0x33, 0x49, 0x47,
-  0x59, 0x49, 0x33, 0x4C, 0x34, 0x61, 0x49, 0x32, 0x4C, 0x44, 0x31, 0x72, 0x62, 0x56, 0x7A, 0x43,
-  0x72, 0x39, 0x32, 0x57, 0x64, 0x77, 0x69, 0x4F, 0x46, 0x6C, 0x59, 0x77, 0x6E, 0x47, 0x51, 0x4D,
-  0x77, 0x46, 0x31, 0x6C, 0x41, 0x58, 0x67, 0x62, 0x74, 0x47, 0x4A, 0x6D, 0x6E, 0x62, 0x6D, 0x44,
-  0x69, 0x46, 0x71, 0x66, 0x4C, 0x50, 0x77, 0x61, 0x39, 0x61, 0x4B, 0x68, 0x73, 0x65, 0x51, 0x4D,
-  0x77, 0x4A, 0x6F, 0x32, 0x52, 0x49, 0x69, 0x71, 0x6A, 0x6E, 0x4A, 0x33, 0x45, 0x42, 0x35, 0x4C,
-  0x4D, 0x4F, 0x55, 0x39, 0x75, 0x2F, 0x43, 0x71, 0x72, 0x34, 0x54, 0x74, 0x68, 0x69, 0x4C, 0x38,
-  0x76, 0x53, 0x77, 0x74, 0x78, 0x32, 0x34, 0x65, 0x6C, 0x55, 0x79, 0x43, 0x52, 0x4B, 0x7A, 0x6A,
-  0x2F, 0x66, 0x76, 0x53, 0x51, 0x2B, 0x5A, 0x7A, 0x66, 0x75, 0x78, 0x36, 0x6E, 0x38, 0x70, 0x76,
-  0x58, 0x2B, 0x65, 0x4E, 0x6A, 0x75, 0x74, 0x77, 0x72, 0x41, 0x43, 0x54, 0x74, 0x2F, 0x50, 0x6A,
-  0x4E, 0x63, 0x44, 0x33, 0x42, 0x52, 0x2B, 0x62, 0x56, 0x74, 0x66, 0x78, 0x62, 0x67, 0x57, 0x66,
-  0x79, 0x6D, 0x2F, 0x4B, 0x74, 0x33, 0x58, 0x4A, 0x36, 0x33, 0x68, 0x72, 0x72, 0x77, 0x41, 0x2F,
-  0x64, 0x32, 0x56, 0x65, 0x53, 0x34, 0x33, 0x59, 0x73, 0x48, 0x52, 0x34, 0x44, 0x31, 0x6E, 0x48,
-  0x71, 0x2F, 0x4B, 0x72, 0x4A, 0x76, 0x6A, 0x4F, 0x47, 0x67, 0x2B, 0x2B, 0x48, 0x79, 0x76, 0x41,
-  0x48, 0x44, 0x4F, 0x51, 0x72, 0x77, 0x73, 0x38, 0x48, 0x6A, 0x65, 0x4E, 0x62, 0x6C, 0x68, 0x71,
-  0x48, 0x61, 0x2F, 0x77, 0x6D, 0x2B, 0x54, 0x56, 0x51, 0x73, 0x59, 0x35, 0x42, 0x47, 0x44, 0x79,
-  0x4C, 0x62, 0x48, 0x47, 0x6B, 0x4E, 0x6B, 0x55, 0x64, 0x69, 0x79, 0x69, 0x31, 0x72, 0x74, 0x61,
-  0x30, 0x61, 0x48, 0x74, 0x72, 0x61, 0x62, 0x71, 0x4B, 0x36, 0x46, 0x4E, 0x79, 0x53, 0x48, 0x70,
-  0x6C, 0x6C, 0x69, 0x46, 0x72, 0x5A, 0x77, 0x4A, 0x6D, 0x52, 0x43, 0x77, 0x6A, 0x6C, 0x66, 0x6C,
-  0x70, 0x2B, 0x71, 0x72, 0x51, 0x39, 0x49, 0x74, 0x73, 0x63, 0x61, 0x67, 0x4B, 0x61, 0x58, 0x36,
-  0x32, 0x7A, 0x59, 0x36, 0x30, 0x61, 0x48, 0x71, 0x55, 0x2F, 0x6C, 0x4E, 0x2B, 0x72, 0x61, 0x2B,
-  0x36, 0x35, 0x62, 0x39, 0x66, 0x4E, 0x72, 0x33, 0x34, 0x2B, 0x59, 0x45, 0x53, 0x36, 0x71, 0x79,
-  0x49, 0x39, 0x62, 0x78, 0x6C, 0x6A, 0x41, 0x32, 0x45, 0x78, 0x30, 0x71, 0x76, 0x30, 0x6C, 0x74,
-  0x79, 0x74, 0x49, 0x66, 0x7A, 0x48, 0x32, 0x65, 0x61, 0x6B, 0x65, 0x59, 0x38, 0x59, 0x4F, 0x35,
-  0x7A, 0x54, 0x7A, 0x65, 0x58, 0x61, 0x50, 0x72, 0x65, 0x4C, 0x65, 0x43, 0x54, 0x2F, 0x68, 0x70,
-  0x65, 0x61, 0x64, 0x4C, 0x75, 0x53, 0x58, 0x57, 0x66, 0x31, 0x70, 0x72, 0x44, 0x63, 0x66, 0x72,
-  0x6D, 0x65, 0x76, 0x4D, 0x34, 0x37, 0x4A, 0x68, 0x71, 0x62, 0x5A, 0x33, 0x37, 0x7A, 0x64, 0x73,
-  0x43, 0x64, 0x73, 0x4E, 0x6C, 0x57, 0x62, 0x54, 0x76, 0x31, 0x35, 0x48, 0x33, 0x69, 0x43, 0x62,
-  0x65, 0x53, 0x56, 0x4E, 0x79, 0x49, 0x53, 0x41, 0x69, 0x51, 0x36, 0x56, 0x6E, 0x36, 0x71, 0x76,
-  0x67, 0x51, 0x71, 0x77, 0x43, 0x31, 0x34, 0x50, 0x50, 0x41, 0x62, 0x72, 0x72, 0x70, 0x57, 0x71,
-  0x72, 0x35, 0x44, 0x33, 0x6B, 0x71, 0x70, 0x50, 0x2B, 0x46, 0x58, 0x56, 0x70, 0x70, 0x51, 0x71,
-  0x78, 0x59, 0x59, 0x49, 0x6E, 0x7A, 0x4A, 0x57, 0x74, 0x6E, 0x4F, 0x2F, 0x6C, 0x31, 0x5A, 0x64,
-  0x33, 0x74, 0x55, 0x72, 0x4A, 0x63, 0x32, 0x69, 0x43, 0x37, 0x39, 0x4B, 0x4B, 0x68, 0x7A, 0x79,
-  0x42, 0x57, 0x43, 0x4F, 0x5A, 0x2F, 0x39, 0x47, 0x54, 0x51, 0x68, 0x59, 0x78, 0x79, 0x76, 0x38,
-  0x74, 0x4C, 0x77, 0x4E, 0x42, 0x75, 0x42, 0x56, 0x59, 0x4C, 0x56, 0x53, 0x66, 0x57, 0x74, 0x6F,
-  0x6F, 0x6B, 0x50, 0x34, 0x31, 0x64, 0x62, 0x79, 0x4C, 0x6D, 0x45, 0x64, 0x37, 0x31, 0x78, 0x57,
-  0x59, 0x31, 0x74, 0x58, 0x65, 0x2B, 0x56, 0x33, 0x32, 0x2B, 0x67, 0x36, 0x33, 0x70, 0x73, 0x63,
-  0x47, 0x31, 0x55, 0x49, 0x76, 0x33, 0x71, 0x39, 0x63, 0x4B, 0x72, 0x7A, 0x48, 0x71, 0x38, 0x4D,
-  0x62, 0x56, 0x70, 0x55, 0x64, 0x57, 0x53, 0x69, 0x6F, 0x78, 0x48, 0x4E, 0x33, 0x2B, 0x71, 0x79,
-  0x34, 0x48, 0x57, 0x38, 0x6A, 0x7A, 0x48, 0x63, 0x46, 0x48, 0x77, 0x61, 0x63, 0x43, 0x34, 0x65,
-  0x45, 0x76, 0x33, 0x39, 0x55, 0x65, 0x74, 0x34, 0x7A, 0x77, 0x49, 0x76, 0x43, 0x2B, 0x77, 0x31,
-  0x72, 0x6F, 0x6A, 0x6E, 0x44, 0x4B, 0x76, 0x38, 0x32, 0x75, 0x56, 0x61, 0x33, 0x2F, 0x4B, 0x30,
-  0x75, 0x6F, 0x35, 0x33, 0x34, 0x39, 0x51, 0x4B, 0x76, 0x79, 0x6E, 0x57, 0x54, 0x76, 0x4E, 0x6B,
-  0x45, 0x53, 0x73, 0x69, 0x56, 0x6A, 0x57, 0x33, 0x68, 0x6D, 0x4D, 0x48, 0x6B, 0x66, 0x76, 0x4A,
-  0x62, 0x46, 0x70, 0x65, 0x34, 0x54, 0x66, 0x70, 0x41, 0x33, 0x66, 0x6F, 0x4E, 0x45, 0x39, 0x79,
-  0x6B, 0x33, 0x4C, 0x62, 0x71, 0x36, 0x43, 0x57, 0x50, 0x57, 0x4A, 0x43, 0x77, 0x44, 0x70, 0x65,
-  0x34, 0x56, 0x66, 0x58, 0x42, 0x37, 0x6D, 0x72, 0x37, 0x33, 0x6D, 0x79, 0x75, 0x51, 0x7A, 0x48,
-  0x61, 0x58, 0x6A, 0x36, 0x31, 0x32, 0x6E, 0x51, 0x37, 0x30, 0x39, 0x56, 0x2B, 0x55, 0x57, 0x74,
-  0x36, 0x4D, 0x6A, 0x64, 0x51, 0x64, 0x69, 0x36, 0x61, 0x6D, 0x5A, 0x50, 0x57, 0x68, 0x37, 0x63,
-  0x63, 0x4E, 0x32, 0x6E, 0x72, 0x2F, 0x36, 0x47, 0x39, 0x59, 0x38, 0x6E, 0x54, 0x76, 0x55, 0x2F,
-  0x48, 0x71, 0x74, 0x64, 0x38, 0x48, 0x2F, 0x78, 0x72, 0x78, 0x51, 0x42, 0x48, 0x6C, 0x47, 0x31,
-  0x46, 0x72, 0x41, 0x54, 0x55, 0x4E, 0x52, 0x7A, 0x68, 0x6F, 0x56, 0x66, 0x36, 0x77, 0x48, 0x59,
-  0x35, 0x56, 0x74, 0x58, 0x53, 0x74, 0x72, 0x4B, 0x4C, 0x36, 0x70, 0x64, 0x7A, 0x7A, 0x33, 0x52,
-  0x34, 0x56, 0x70, 0x66, 0x52, 0x44, 0x59, 0x34, 0x42, 0x45, 0x52, 0x4C, 0x75, 0x4A, 0x74, 0x4F,
-  0x78, 0x49, 0x61, 0x6C, 0x4A, 0x65, 0x77, 0x45, 0x39, 0x4E, 0x52, 0x79, 0x74, 0x76, 0x6E, 0x39,
-  0x35, 0x52, 0x43, 0x51, 0x51, 0x49, 0x72, 0x4B, 0x61, 0x64, 0x76, 0x6F, 0x68, 0x71, 0x55, 0x62,
-  0x77, 0x61, 0x66, 0x79, 0x6F, 0x39, 0x37, 0x4B, 0x4C, 0x38, 0x58, 0x7A, 0x6B, 0x5A, 0x2F, 0x50,
-  0x66, 0x56, 0x32, 0x73, 0x6B, 0x41, 0x63, 0x77, 0x32, 0x61, 0x5A, 0x65, 0x35, 0x55, 0x65, 0x6C,
-  0x77, 0x62, 0x64, 0x4B, 0x45, 0x48, 0x78, 0x52, 0x45, 0x77, 0x4C, 0x72, 0x7A, 0x4D, 0x47, 0x33,
-  0x45, 0x58, 0x7A, 0x43, 0x6A, 0x33, 0x71, 0x6C, 0x61, 0x42, 0x74, 0x62, 0x58, 0x63, 0x66, 0x37,
-  0x31, 0x74, 0x74, 0x48, 0x2B, 0x46, 0x46, 0x6E, 0x31, 0x54, 0x64, 0x55, 0x66, 0x43, 0x6C, 0x57,
-  0x52, 0x57, 0x77, 0x71, 0x72, 0x56, 0x68, 0x2F, 0x47, 0x33, 0x79, 0x71, 0x50, 0x75, 0x46, 0x48,
-  0x76, 0x56, 0x49, 0x38, 0x34, 0x79, 0x4A, 0x71, 0x51, 0x69, 0x42, 0x6E, 0x31, 0x54, 0x65, 0x45,
-  0x33, 0x6E, 0x74, 0x76, 0x6E, 0x31, 0x67, 0x6D, 0x50, 0x49, 0x69, 0x71, 0x2B, 0x6F, 0x62, 0x4B,
-  0x36, 0x54, 0x72, 0x42, 0x66, 0x33, 0x55, 0x36, 0x39, 0x77, 0x33, 0x61, 0x42, 0x65, 0x77, 0x45,
-  0x39, 0x4D, 0x79, 0x65, 0x66, 0x53, 0x6F, 0x2F, 0x36, 0x67, 0x79, 0x2B, 0x77, 0x30, 0x52, 0x56,
-  0x33, 0x30, 0x32, 0x44, 0x47, 0x35, 0x61, 0x2B, 0x46, 0x48, 0x7A, 0x43, 0x6A, 0x33, 0x71, 0x39,
-  0x36, 0x39, 0x4A, 0x63, 0x4C, 0x34, 0x75, 0x61, 0x36, 0x4D, 0x69, 0x31, 0x6F, 0x6D, 0x4E, 0x54,
-  0x2B, 0x61, 0x59, 0x53, 0x73, 0x4F, 0x69, 0x71, 0x62, 0x33, 0x67, 0x59, 0x65, 0x67, 0x70, 0x33,
-  0x45, 0x51, 0x39, 0x62, 0x53, 0x76, 0x6A, 0x33, 0x2F, 0x2B, 0x7A, 0x53, 0x75, 0x77, 0x66, 0x71,
-  0x44, 0x62, 0x36, 0x54, 0x68, 0x47, 0x48, 0x78, 0x4C, 0x6D, 0x67, 0x4D, 0x31, 0x34, 0x49, 0x50,
-  0x6D, 0x42, 0x70, 0x38, 0x64, 0x77, 0x6B, 0x44, 0x34, 0x79, 0x68, 0x67, 0x44, 0x45, 0x63, 0x5A,
-  0x67, 0x75, 0x2F, 0x63, 0x75, 0x79, 0x65, 0x50, 0x4A, 0x77, 0x34, 0x42, 0x63, 0x77, 0x52, 0x66,
-  0x39, 0x33, 0x56, 0x6D, 0x4E, 0x39, 0x56, 0x71, 0x69, 0x46, 0x33, 0x51, 0x50, 0x58, 0x42, 0x76,
-  0x45, 0x68, 0x36, 0x32, 0x34, 0x66, 0x61, 0x63, 0x35, 0x77, 0x6D, 0x32, 0x45, 0x67, 0x4F, 0x43,
-  0x67, 0x75, 0x38, 0x73, 0x63, 0x63, 0x58, 0x33, 0x4D, 0x44, 0x35, 0x49, 0x61, 0x4F, 0x35, 0x78,
-  0x48, 0x43, 0x59, 0x63, 0x78, 0x31, 0x58, 0x67, 0x77, 0x2B, 0x47, 0x42, 0x42, 0x4D, 0x46, 0x33,
-  0x6B, 0x61, 0x46, 0x4E, 0x2F, 0x42, 0x49, 0x30, 0x6C, 0x68, 0x51, 0x54, 0x48, 0x5A, 0x38, 0x54,
-  0x50, 0x38, 0x73, 0x45, 0x6D, 0x44, 0x6B, 0x6F, 0x6A, 0x6A, 0x4A, 0x4E, 0x44, 0x41, 0x77, 0x75,
-  0x67, 0x73, 0x62, 0x30, 0x4F, 0x66, 0x42, 0x76, 0x76, 0x68, 0x35, 0x33, 0x67, 0x77, 0x59, 0x71,
-  0x44, 0x62, 0x33, 0x44, 0x54, 0x4E, 0x58, 0x65, 0x39, 0x36, 0x6F, 0x76, 0x71, 0x6C, 0x30, 0x4D,
-  0x2B, 0x6C, 0x76, 0x66, 0x6A, 0x64, 0x64, 0x44, 0x4B, 0x5A, 0x41, 0x4A, 0x44, 0x2F, 0x59, 0x4E,
-  0x68, 0x39, 0x53, 0x54, 0x47, 0x6A, 0x2F, 0x62, 0x64, 0x56, 0x39, 0x58, 0x50, 0x39, 0x77, 0x48,
-  0x2F, 0x76, 0x37, 0x48, 0x74, 0x4B, 0x54, 0x44, 0x71, 0x6F, 0x7A, 0x62, 0x2F, 0x76, 0x57, 0x70,
-  0x69, 0x33, 0x75, 0x43, 0x48, 0x44, 0x4F, 0x79, 0x74, 0x70, 0x63, 0x70, 0x41, 0x62, 0x6A, 0x4B,
-  0x39, 0x46, 0x2F, 0x66, 0x70, 0x74, 0x6A, 0x68, 0x35, 0x41, 0x2F, 0x48, 0x64, 0x32, 0x4F, 0x6E,
-  0x5A, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43,
-  0x2F, 0x45, 0x2B, 0x41, 0x41, 0x51, 0x44, 0x6D, 0x55, 0x39, 0x4B, 0x6E, 0x57, 0x39, 0x2F, 0x31,
-  0x4E, 0x51, 0x41, 0x41, 0x41, 0x41, 0x42, 0x4A, 0x52, 0x55, 0x35, 0x45, 0x72, 0x6B, 0x4A, 0x67,
-  0x67, 0x67, 0x3D, 0x3D, 0x22, 0x7D, 0x2C, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64,
-  0x65, 0x62, 0x61, 0x72, 0x3A, 0x63, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x61, 0x69, 0x6E, 0x2D, 0x70,
-  0x61, 0x6E, 0x65, 0x6C, 0x22, 0x2C, 0x72, 0x65, 0x66, 0x3A, 0x61, 0x2C, 0x64, 0x61, 0x74, 0x61,
-  0x3A, 0x65, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x6B, 0x2C, 0x7B, 0x62, 0x72,
-  0x61, 0x6E, 0x64, 0x54, 0x65, 0x78, 0x74, 0x3A, 0x62, 0x28, 0x74, 0x2E, 0x70, 0x61, 0x74, 0x68,
-  0x6E, 0x61, 0x6D, 0x65, 0x29, 0x2C, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65,
-  0x62, 0x61, 0x72, 0x3A, 0x63, 0x2C, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x4F, 0x70, 0x65,
-  0x6E, 0x65, 0x64, 0x3A, 0x73, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x64, 0x2E, 0x64, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x28, 0x6F, 0x3D, 0x5F, 0x2C, 0x6F, 0x2E, 0x6D, 0x61, 0x70,
-  0x28, 0x28, 0x28, 0x65, 0x2C, 0x74, 0x29, 0x3D, 0x3E, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E,
-  0x22, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3F, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x64, 0x2E, 0x62, 0x2C, 0x7B,
-  0x70, 0x61, 0x74, 0x68, 0x3A, 0x65, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x2B, 0x65, 0x2E,
-  0x70, 0x61, 0x74, 0x68, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3A, 0x65,
-  0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x7D, 0x2C, 0x74, 0x29, 0x3A, 0x6E,
-  0x75, 0x6C, 0x6C, 0x29, 0x29, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x64, 0x2E, 0x61, 0x2C, 0x7B, 0x66, 0x72, 0x6F, 0x6D, 0x3A, 0x22,
-  0x2A, 0x22, 0x2C, 0x74, 0x6F, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x2F, 0x68, 0x6F,
-  0x6D, 0x65, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x44, 0x2C, 0x7B,
-  0x62, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x65, 0x2C, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-  0x42, 0x67, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x72, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x3B, 0x76,
-  0x61, 0x72, 0x20, 0x6F, 0x7D, 0x7D, 0x29, 0x7D, 0x3B, 0x69, 0x2E, 0x61, 0x2E, 0x72, 0x65, 0x6E,
-  0x64, 0x65, 0x72, 0x28, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x75, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x67, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x63, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x64, 0x2E, 0x64, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x64, 0x2E, 0x62, 0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69,
-  0x6E, 0x22, 0x2C, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x3A, 0x65, 0x3D, 0x3E, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x59, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x72, 0x2E, 0x61, 0x29, 0x28, 0x7B, 0x7D, 0x2C, 0x65, 0x29, 0x29, 0x7D,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x64, 0x2E, 0x61, 0x2C, 0x7B, 0x66, 0x72, 0x6F, 0x6D, 0x3A, 0x22, 0x2F, 0x22, 0x2C, 0x74, 0x6F,
-  0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x2F, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61,
-  0x72, 0x64, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x64,
-  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-  0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 0x6F, 0x6F, 0x74, 0x22, 0x29, 0x29, 0x7D,
-  0x2C, 0x38, 0x33, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x2C, 0x74,
-  0x2C, 0x61, 0x29, 0x7B, 0x7D, 0x2C, 0x38, 0x34, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-  0x6E, 0x28, 0x65, 0x2C, 0x74, 0x2C, 0x61, 0x29, 0x7B, 0x7D, 0x2C, 0x38, 0x35, 0x3A, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x2C, 0x74, 0x2C, 0x61, 0x29, 0x7B, 0x7D, 0x7D,
-  0x2C, 0x5B, 0x5B, 0x31, 0x39, 0x35, 0x2C, 0x31, 0x2C, 0x32, 0x5D, 0x5D, 0x5D, 0x29, 0x3B
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x7D, 0x09, 0x73, 0xE2, 0x48,
+  0xB2, 0xF0, 0x5F, 0x61, 0xF4, 0x45, 0x4C, 0xC0, 0x27, 0x19, 0x21, 0x24, 0xCE, 0x5E, 0xEF, 0x04,
+  0x37, 0x98, 0xFB, 0x06, 0xF7, 0x3A, 0x3A, 0x74, 0x94, 0x84, 0x40, 0x48, 0xA2, 0x24, 0x24, 0xC0,
+  0xEB, 0xFF, 0xFE, 0xB2, 0x24, 0xB0, 0xC1, 0x36, 0xDD, 0x9E, 0xED, 0x9E, 0xF7, 0xF6, 0xED, 0xF3,
+  0x74, 0x0C, 0x08, 0xA9, 0x2A, 0x2B, 0x33, 0x2B, 0xEF, 0x2A, 0x97, 0xA2, 0xEE, 0x42, 0x77, 0xBE,
+  0x52, 0x3E, 0x92, 0x6C, 0x51, 0x5E, 0xDD, 0x39, 0x96, 0x69, 0x4B, 0x06, 0x5C, 0xDD, 0x28, 0xA2,
+  0xB3, 0x90, 0x2C, 0x11, 0x2B, 0x37, 0x18, 0x89, 0xB2, 0x4B, 0x3D, 0xDC, 0x7E, 0xB8, 0xE5, 0x3F,
+  0xFF, 0xF9, 0xF5, 0x21, 0x16, 0xB7, 0xB7, 0xCE, 0x22, 0xFA, 0xF5, 0x6B, 0xE2, 0x81, 0x79, 0xE4,
+  0x72, 0xA9, 0xBC, 0xBA, 0x35, 0x65, 0x57, 0xB7, 0xCC, 0x28, 0x62, 0x5C, 0x46, 0x8C, 0x3D, 0x52,
+  0x5B, 0x07, 0x45, 0x1C, 0x17, 0xEB, 0xD0, 0xE3, 0x8B, 0x18, 0xC7, 0x51, 0x37, 0xF6, 0xC5, 0x13,
+  0x71, 0x04, 0xDF, 0x8A, 0xD1, 0x4C, 0x26, 0xC6, 0x58, 0xF0, 0x9D, 0x8C, 0x31, 0xE6, 0xAD, 0x18,
+  0x37, 0xA3, 0x56, 0x8C, 0x71, 0xE0, 0x37, 0x9F, 0x88, 0x31, 0x7A, 0x70, 0xC3, 0x89, 0x31, 0x32,
+  0xDC, 0xE0, 0xA0, 0xA1, 0x02, 0xDF, 0xD9, 0x18, 0x63, 0xDC, 0x46, 0xE1, 0x9B, 0x8F, 0x31, 0xF0,
+  0x29, 0x04, 0x9F, 0xA9, 0xE0, 0x33, 0x4D, 0x3E, 0x73, 0xB1, 0xD8, 0x17, 0xD9, 0x32, 0x1D, 0x37,
+  0x22, 0xDD, 0x52, 0x14, 0xB3, 0xBC, 0xA5, 0xFC, 0x85, 0xEE, 0xA2, 0x1B, 0xB8, 0xE7, 0x22, 0xD3,
+  0xA5, 0x98, 0xC5, 0x6D, 0x57, 0x5A, 0x22, 0xD9, 0x8D, 0x5A, 0x71, 0x19, 0xA8, 0x70, 0x51, 0x89,
+  0x3C, 0xD9, 0xB9, 0xB1, 0xE8, 0xA3, 0xBB, 0x40, 0x6B, 0x94, 0x97, 0x18, 0x79, 0x21, 0x9A, 0x1A,
+  0x1A, 0x05, 0xBF, 0xA2, 0xB1, 0xDB, 0xBF, 0x3F, 0x3E, 0x3D, 0x85, 0x18, 0xDB, 0x80, 0x40, 0x22,
+  0xF6, 0xE5, 0x44, 0x60, 0x64, 0x1B, 0x45, 0xB1, 0xC7, 0x70, 0x34, 0xF7, 0x05, 0x2C, 0x90, 0x3B,
+  0x74, 0x01, 0x70, 0x2C, 0x2A, 0x01, 0x46, 0xA7, 0xFB, 0x46, 0x5C, 0x8C, 0x45, 0x5D, 0x06, 0x08,
+  0x05, 0xBA, 0x09, 0xAF, 0x80, 0xDE, 0xAF, 0xDC, 0xC3, 0x17, 0x8C, 0xDC, 0x2D, 0x36, 0x23, 0xE7,
+  0xBD, 0x2B, 0xAA, 0x0A, 0xD7, 0xB1, 0x68, 0x34, 0x18, 0xDC, 0xF1, 0x75, 0x57, 0x5E, 0x44, 0x31,
+  0x8C, 0x24, 0x02, 0x23, 0x97, 0x79, 0xC5, 0x92, 0xB7, 0x6B, 0xA0, 0x25, 0x2E, 0x59, 0xCA, 0x3E,
+  0x2E, 0x1B, 0xA2, 0xE3, 0xB4, 0x74, 0xC7, 0x8D, 0x8B, 0x8A, 0x12, 0x7D, 0x45, 0x6D, 0xEC, 0x8B,
+  0x04, 0x34, 0xAE, 0xBE, 0x04, 0x3D, 0xA5, 0xBC, 0x82, 0x54, 0x71, 0x6B, 0xB8, 0x57, 0x21, 0x60,
+  0xB4, 0xB6, 0x3C, 0xF4, 0x06, 0x08, 0x90, 0xCF, 0x7C, 0xC5, 0x0F, 0x31, 0xE6, 0x88, 0xA4, 0x1D,
+  0x5F, 0x3A, 0xBB, 0x58, 0x74, 0x11, 0xEF, 0x61, 0xCB, 0xD3, 0x15, 0x84, 0x99, 0x47, 0x4F, 0x34,
+  0xB6, 0x28, 0x7F, 0xE4, 0x20, 0xBE, 0xE0, 0xE0, 0x8B, 0x38, 0xC4, 0x1E, 0xC9, 0xC7, 0xD3, 0x13,
+  0x3C, 0xD6, 0x0D, 0x05, 0x23, 0x33, 0x8F, 0xE2, 0xA7, 0xCB, 0xA7, 0xD8, 0x53, 0xC8, 0xC8, 0xF5,
+  0x2D, 0x25, 0x01, 0x2C, 0x8A, 0x51, 0xAF, 0x4F, 0x94, 0x6C, 0x19, 0x16, 0xCE, 0xAF, 0x8F, 0xC3,
+  0x94, 0x82, 0x5F, 0xE8, 0x38, 0x4F, 0xCF, 0x93, 0xA3, 0xFD, 0x60, 0x72, 0xD6, 0x7F, 0x7A, 0x72,
+  0x8E, 0x74, 0xAB, 0x6F, 0xE9, 0x0E, 0x11, 0xC2, 0x17, 0x08, 0x7D, 0x98, 0x6E, 0x22, 0x59, 0x3B,
+  0xA2, 0x03, 0x20, 0xF3, 0x5D, 0xF8, 0x06, 0x69, 0x2E, 0x04, 0xA2, 0xDF, 0x8D, 0x31, 0x1E, 0x11,
+  0xFD, 0x1C, 0x48, 0x76, 0x29, 0xB8, 0x00, 0x25, 0xD8, 0x07, 0x17, 0xA0, 0x06, 0x9D, 0xE0, 0x22,
+  0x17, 0x63, 0x7C, 0xD2, 0x97, 0xE3, 0x62, 0xCC, 0x30, 0x00, 0x92, 0x08, 0x65, 0x75, 0x75, 0x7B,
+  0x8E, 0xC0, 0x89, 0x0F, 0x66, 0x5C, 0x7C, 0x66, 0x41, 0xF4, 0x37, 0xEE, 0x7B, 0x2C, 0xB0, 0x02,
+  0x16, 0x80, 0x36, 0x5E, 0xF4, 0xA1, 0x4C, 0xD1, 0x93, 0x44, 0x7C, 0xE3, 0x62, 0xD1, 0x74, 0x6C,
+  0x11, 0x07, 0x02, 0x02, 0xAA, 0x7A, 0x0E, 0xC5, 0x21, 0x50, 0xE4, 0x5B, 0x9D, 0x40, 0x51, 0xE0,
+  0x0B, 0x18, 0x79, 0x84, 0x11, 0x4A, 0x76, 0x28, 0xD8, 0x51, 0x5F, 0x37, 0x15, 0xCB, 0x27, 0x62,
+  0x5B, 0xF1, 0x00, 0x0C, 0x91, 0x40, 0x64, 0x22, 0x1C, 0xA5, 0x30, 0x72, 0xF4, 0x03, 0x48, 0x00,
+  0xA8, 0xCF, 0x33, 0x0D, 0xB1, 0xC7, 0x63, 0xF3, 0x50, 0x46, 0xAF, 0xF6, 0x78, 0x8A, 0x9D, 0x19,
+  0x80, 0x40, 0x7F, 0x8E, 0xFD, 0x74, 0x13, 0x5A, 0x4E, 0x75, 0xC5, 0x5D, 0xFC, 0x2D, 0x97, 0xE3,
+  0x7F, 0xFF, 0x1D, 0xFF, 0x01, 0xDA, 0x22, 0x69, 0x37, 0x81, 0xAC, 0x53, 0xB1, 0xBC, 0xF2, 0x3E,
+  0x69, 0x4F, 0xEF, 0xCB, 0x80, 0x1D, 0xAF, 0x62, 0x51, 0x23, 0x3A, 0xC4, 0x3C, 0x3E, 0xCF, 0xEA,
+  0x65, 0x13, 0x2F, 0x2E, 0xC2, 0x33, 0xA2, 0x5B, 0x1D, 0x11, 0xD4, 0xA0, 0x10, 0x8D, 0x3D, 0x8F,
+  0x20, 0x4A, 0x8E, 0x65, 0x6C, 0x61, 0x58, 0x46, 0x8E, 0x31, 0x68, 0x67, 0x8B, 0xA6, 0x92, 0xA7,
+  0x0C, 0x8D, 0x62, 0xDE, 0x05, 0xE5, 0xC4, 0xA2, 0x25, 0x02, 0x4B, 0x35, 0xB6, 0xBA, 0x92, 0xFF,
+  0x2D, 0xF1, 0xD2, 0xEA, 0xEB, 0xAB, 0x66, 0x94, 0xA2, 0x7B, 0xD4, 0xF9, 0xA0, 0xA7, 0x01, 0x7D,
+  0x2C, 0xDA, 0x36, 0xC2, 0xD4, 0x95, 0xAE, 0xEF, 0xF4, 0x3C, 0x47, 0xD7, 0xB5, 0x34, 0xCD, 0x40,
+  0x11, 0xE5, 0x46, 0x37, 0x0D, 0xDD, 0x04, 0xAC, 0x1F, 0xC3, 0x3B, 0x0A, 0xC8, 0xB1, 0x03, 0x7A,
+  0x00, 0x6D, 0xBA, 0x36, 0x4C, 0x84, 0x02, 0x76, 0xE2, 0x1A, 0x05, 0x7B, 0x42, 0x81, 0x65, 0x96,
+  0x0C, 0x5D, 0x5E, 0x41, 0xB7, 0x10, 0xC0, 0x30, 0xEC, 0x7C, 0x1D, 0x2B, 0x98, 0x06, 0xF3, 0x5D,
+  0x82, 0xC2, 0xFE, 0xF8, 0x06, 0xAE, 0x23, 0xF0, 0x3F, 0x47, 0x3D, 0xBD, 0xB6, 0x4E, 0x1F, 0xEE,
+  0x9B, 0xFC, 0x89, 0xBE, 0x3C, 0xF4, 0x7D, 0x00, 0x15, 0x7E, 0x0D, 0xA0, 0x73, 0x41, 0xED, 0xED,
+  0xDF, 0x51, 0xDC, 0xC6, 0x88, 0x88, 0x6C, 0x39, 0xB4, 0xC0, 0xD1, 0xD8, 0xB9, 0x2D, 0x90, 0x40,
+  0xE0, 0x94, 0x11, 0x98, 0xB6, 0x00, 0x18, 0xF3, 0x3D, 0xCE, 0x05, 0x12, 0xAD, 0x44, 0xF1, 0x1F,
+  0xEF, 0x09, 0x6B, 0xFE, 0x4C, 0x9E, 0x19, 0x2B, 0xFA, 0x1B, 0x8E, 0x3D, 0xFD, 0x24, 0x6B, 0x8F,
+  0xB7, 0x56, 0x30, 0x4B, 0xD2, 0xBF, 0xCA, 0xA6, 0xBF, 0x00, 0xC6, 0xC3, 0x1B, 0x30, 0x3E, 0x61,
+  0x52, 0xD8, 0x8A, 0x68, 0x88, 0xEE, 0x10, 0x81, 0xCC, 0x63, 0xE6, 0x8A, 0x6E, 0x0E, 0x2F, 0x75,
+  0x93, 0x5A, 0xEF, 0x6E, 0xC4, 0xAD, 0x6B, 0x51, 0xCC, 0x0B, 0x88, 0x2B, 0x3D, 0x29, 0xF1, 0x7D,
+  0x64, 0x61, 0xF6, 0x22, 0x47, 0x28, 0x91, 0xB5, 0x74, 0x93, 0x88, 0x2C, 0x38, 0x88, 0x35, 0x30,
+  0x52, 0xF3, 0x54, 0x9C, 0x8D, 0x50, 0x57, 0xC1, 0x91, 0x66, 0x2F, 0x16, 0x84, 0x1A, 0x8E, 0xDA,
+  0x7C, 0x72, 0x9C, 0x8A, 0x4C, 0x91, 0xE4, 0x20, 0xEC, 0x21, 0x1C, 0x29, 0x83, 0xBD, 0x03, 0x6B,
+  0x86, 0x45, 0x62, 0x06, 0x29, 0x22, 0x6B, 0xE4, 0xDF, 0xC3, 0xF1, 0x22, 0x30, 0xF5, 0x45, 0xA6,
+  0x1E, 0x58, 0x7E, 0xEE, 0xCC, 0xFB, 0x8D, 0xDE, 0xF1, 0x7E, 0x4A, 0x5C, 0x8B, 0x45, 0x89, 0xC9,
+  0x3F, 0x5A, 0xE3, 0x01, 0x52, 0xA3, 0xE6, 0xD6, 0x30, 0x62, 0xEF, 0x9A, 0x67, 0xA0, 0x4C, 0xD7,
+  0x44, 0xD7, 0xC2, 0x71, 0xDB, 0x10, 0x5D, 0xD5, 0xC2, 0x6B, 0xB0, 0xA1, 0x0A, 0xDA, 0x75, 0xD5,
+  0x28, 0x35, 0xD5, 0x4D, 0x2A, 0xF6, 0xF7, 0x1B, 0xEE, 0xF7, 0xDF, 0xA3, 0xC5, 0x5B, 0x13, 0xF9,
+  0x91, 0x5D, 0x5C, 0x8C, 0x8A, 0x71, 0x79, 0x8B, 0x71, 0x60, 0x12, 0x9D, 0xAD, 0x0D, 0x02, 0xEF,
+  0x38, 0x43, 0x19, 0x5B, 0x86, 0x31, 0x23, 0xFC, 0xBC, 0xBC, 0x35, 0xCF, 0xFF, 0xC6, 0x81, 0xA9,
+  0x3E, 0xB7, 0xEF, 0x1F, 0x1B, 0xAF, 0x18, 0x57, 0x10, 0x70, 0xC3, 0xDA, 0x47, 0xCF, 0x4D, 0x3D,
+  0xBE, 0x45, 0x71, 0x6C, 0x81, 0x45, 0x75, 0xC0, 0x6D, 0xA1, 0xB8, 0x61, 0x69, 0xD6, 0x17, 0x03,
+  0xB9, 0x11, 0x70, 0x5E, 0x40, 0x1F, 0xB8, 0x27, 0xF2, 0x75, 0xB2, 0xE4, 0x9E, 0xA5, 0x2B, 0x91,
+  0xC4, 0x6F, 0xB7, 0xB7, 0x16, 0xA0, 0xFF, 0xF2, 0x23, 0x0E, 0xFD, 0x5D, 0x84, 0x5B, 0xBA, 0xB9,
+  0xFA, 0x23, 0xEA, 0xDC, 0xBE, 0x33, 0xED, 0xC1, 0x74, 0x9E, 0xB7, 0x63, 0xCE, 0x04, 0xC1, 0xD1,
+  0xD7, 0xB6, 0x81, 0x42, 0x41, 0x20, 0xE3, 0xDF, 0x98, 0x40, 0x81, 0x68, 0x50, 0x8C, 0x2B, 0x62,
+  0x0D, 0xB9, 0x79, 0xEA, 0x1B, 0xC4, 0xD0, 0xE6, 0x8A, 0x62, 0x7E, 0x68, 0x04, 0x7F, 0x60, 0x99,
+  0xA9, 0x00, 0xBA, 0xBE, 0xD6, 0xAE, 0x0B, 0x55, 0xF0, 0xF0, 0xD1, 0xC1, 0x32, 0x60, 0x0B, 0xD7,
+  0x43, 0x2C, 0x33, 0x22, 0x84, 0x7D, 0x20, 0x5D, 0xDF, 0x48, 0xE7, 0x6F, 0xC9, 0x44, 0x32, 0x71,
+  0x14, 0xA5, 0x17, 0xD7, 0xFD, 0x3F, 0x40, 0xA9, 0x15, 0x77, 0x03, 0xAB, 0x17, 0xCB, 0xBF, 0x61,
+  0xB8, 0x1C, 0x97, 0x88, 0x9B, 0x21, 0x04, 0x10, 0xC7, 0xFD, 0x61, 0x1C, 0xFE, 0xCD, 0xB9, 0xFB,
+  0x97, 0x91, 0xF5, 0xCC, 0xCA, 0xD7, 0x96, 0x51, 0x8D, 0x43, 0xDC, 0xEC, 0x40, 0xB8, 0x8F, 0xCF,
+  0xEC, 0xCC, 0x29, 0x84, 0xB6, 0x9E, 0x40, 0xD3, 0x7F, 0xC4, 0x91, 0xA3, 0x8B, 0xA7, 0x18, 0x45,
+  0x74, 0xC5, 0xBC, 0x75, 0xD5, 0xC5, 0x5F, 0xED, 0xF9, 0x12, 0x7E, 0x10, 0xB1, 0x12, 0xCF, 0x7C,
+  0x12, 0x51, 0x4B, 0xD0, 0x3D, 0xE7, 0x9F, 0xFF, 0x3C, 0x5E, 0xE9, 0x7F, 0xFC, 0x10, 0x28, 0xE1,
+  0xCB, 0x79, 0x20, 0xE3, 0x30, 0x3A, 0x58, 0xC3, 0x7C, 0xA0, 0xE8, 0xAF, 0x3A, 0x87, 0x66, 0xFE,
+  0xB9, 0x25, 0x8E, 0xAF, 0x45, 0x1B, 0xAC, 0x9B, 0xC8, 0x60, 0xE2, 0x46, 0x8F, 0xE6, 0x00, 0x32,
+  0x52, 0xA4, 0xE8, 0x18, 0xFA, 0xFD, 0x41, 0x60, 0xBC, 0x9E, 0x6D, 0x43, 0xBF, 0x18, 0x3E, 0x0A,
+  0x61, 0x71, 0xDC, 0x16, 0xDD, 0x05, 0x13, 0x75, 0x83, 0x6F, 0x13, 0xEE, 0xDE, 0x82, 0xF9, 0xF8,
+  0x83, 0x82, 0x8C, 0x58, 0xF7, 0x10, 0x78, 0x61, 0x2A, 0x46, 0x83, 0x31, 0xB4, 0x31, 0xDC, 0x8B,
+  0x84, 0x37, 0x6F, 0xE0, 0x47, 0xF0, 0xE0, 0x7A, 0x80, 0x24, 0xC7, 0xE5, 0x40, 0x32, 0xC4, 0xB8,
+  0x21, 0xEE, 0x41, 0xF1, 0xE8, 0xE3, 0x30, 0x97, 0xBE, 0xE6, 0x06, 0x02, 0x30, 0xD0, 0xAC, 0x10,
+  0x6A, 0xE9, 0xE5, 0xD1, 0x71, 0x6C, 0xE6, 0x4F, 0x47, 0x58, 0x97, 0xD4, 0x89, 0x71, 0x1D, 0x0C,
+  0xEA, 0x5B, 0x27, 0x6D, 0x9F, 0x3B, 0x29, 0x48, 0x4D, 0xA0, 0x6D, 0xE8, 0x83, 0x80, 0x93, 0x81,
+  0x0B, 0xB2, 0x9E, 0xDE, 0x08, 0xDE, 0x6B, 0xCE, 0x51, 0x67, 0xAC, 0xB8, 0xA6, 0x5B, 0xF5, 0x8B,
+  0x09, 0x7B, 0x0F, 0x89, 0x17, 0x70, 0x44, 0xDE, 0x6F, 0x64, 0x70, 0x37, 0x17, 0x71, 0x2D, 0xF1,
+  0xA0, 0x3A, 0xB8, 0x18, 0x64, 0x40, 0x57, 0x6C, 0x99, 0xBA, 0xEC, 0x50, 0xCF, 0x2E, 0xF3, 0xE4,
+  0x35, 0x47, 0xF1, 0x63, 0x26, 0x0C, 0x89, 0x9C, 0xED, 0xDC, 0x3E, 0x62, 0xD7, 0x28, 0x04, 0xC8,
+  0x81, 0x57, 0x62, 0x42, 0x3F, 0x92, 0xFF, 0xFA, 0xF8, 0xF4, 0x10, 0xBA, 0xD7, 0xD6, 0xED, 0x88,
+  0x19, 0x04, 0x0E, 0x16, 0xD2, 0x9A, 0x69, 0x90, 0x6C, 0xC1, 0xC5, 0x26, 0xB8, 0xC3, 0x87, 0xE4,
+  0x97, 0x7F, 0x4D, 0xB2, 0xF5, 0x7E, 0xAE, 0xF1, 0x56, 0x05, 0x54, 0x7D, 0x87, 0x94, 0x1B, 0xDB,
+  0xD8, 0x6A, 0xE0, 0x17, 0xAF, 0x4A, 0xD4, 0x80, 0x30, 0xF3, 0x39, 0x12, 0x0A, 0xE5, 0x21, 0x0C,
+  0x20, 0x7F, 0x10, 0x1B, 0x4E, 0x49, 0x47, 0x57, 0xD4, 0xF2, 0xE1, 0xC8, 0x57, 0xED, 0xE0, 0x2B,
+  0xA4, 0xC4, 0x88, 0x2A, 0xDE, 0xC8, 0x96, 0x46, 0xBE, 0x92, 0x3B, 0xEA, 0x4D, 0x58, 0x4C, 0xB4,
+  0x79, 0x6B, 0x5C, 0x76, 0x52, 0x60, 0x02, 0x20, 0x3B, 0x33, 0x6F, 0x20, 0x95, 0xDA, 0x46, 0x9C,
+  0x85, 0xE5, 0x7F, 0x27, 0x47, 0x79, 0x2D, 0x50, 0x0B, 0x24, 0x42, 0x12, 0x7E, 0xE3, 0xEA, 0xAE,
+  0x81, 0xCE, 0x45, 0xA0, 0x58, 0x28, 0x35, 0x6B, 0x83, 0xEE, 0xB8, 0x53, 0x8E, 0xB4, 0xBB, 0xE5,
+  0xCA, 0x3B, 0x41, 0xE7, 0x1B, 0xD1, 0x54, 0x96, 0x5B, 0xC7, 0x25, 0xE9, 0x9C, 0x43, 0x34, 0x0C,
+  0x45, 0xCE, 0x84, 0x2B, 0x12, 0x98, 0xCA, 0x9B, 0x30, 0xB5, 0xBF, 0xCA, 0x8D, 0xC5, 0x15, 0x33,
+  0x7B, 0x56, 0x08, 0x41, 0xAF, 0x8D, 0xAD, 0x73, 0x25, 0x8F, 0xFC, 0x71, 0xA8, 0x1E, 0xA2, 0x64,
+  0x88, 0x12, 0x32, 0xCE, 0x09, 0x6F, 0x35, 0x6A, 0xF5, 0xD1, 0x33, 0xCD, 0x14, 0x84, 0x9D, 0x97,
+  0x90, 0x36, 0xAF, 0xC2, 0x5E, 0x43, 0xD7, 0x16, 0x2E, 0x04, 0xD8, 0x8A, 0x86, 0x22, 0x6B, 0x7C,
+  0x93, 0x7C, 0xB1, 0x1F, 0x44, 0x4C, 0x50, 0x74, 0x19, 0xFB, 0x10, 0x18, 0x45, 0xC4, 0xAB, 0x13,
+  0x14, 0xE3, 0x2D, 0x14, 0xE9, 0x7D, 0x28, 0x1F, 0x27, 0xAB, 0x5C, 0x18, 0x34, 0xCF, 0xA9, 0x7A,
+  0x78, 0xA5, 0xD0, 0x4C, 0x8F, 0xD8, 0x64, 0x9A, 0x72, 0x40, 0xD1, 0x74, 0x99, 0x5D, 0x83, 0x39,
+  0x17, 0xD9, 0x6A, 0xEB, 0x18, 0x4B, 0xC7, 0x97, 0x36, 0xF8, 0xEB, 0x6A, 0xA0, 0xAE, 0x42, 0x8C,
+  0xA9, 0x04, 0x17, 0xA9, 0x18, 0x33, 0x0B, 0x2E, 0xD2, 0x31, 0x66, 0x12, 0x5C, 0x64, 0x62, 0x4C,
+  0x2D, 0xB8, 0xC8, 0xC6, 0x98, 0x76, 0x70, 0x91, 0x8B, 0x31, 0x87, 0x40, 0xDB, 0x8F, 0x15, 0x95,
+  0xF1, 0x85, 0x92, 0xFF, 0xAB, 0x65, 0x81, 0xB7, 0xDA, 0xFC, 0x5C, 0x9A, 0xBC, 0xA6, 0xC8, 0xD5,
+  0x4B, 0x37, 0x76, 0x09, 0xAF, 0x42, 0x1E, 0xAE, 0x95, 0x3C, 0xC5, 0x25, 0xAF, 0x43, 0x98, 0x7D,
+  0x0F, 0xC2, 0xE4, 0x75, 0x32, 0x24, 0xDD, 0x70, 0x57, 0xE5, 0xBC, 0xF6, 0x6C, 0x1B, 0x16, 0x3C,
+  0xC5, 0xBC, 0x36, 0xC7, 0xBA, 0xA9, 0x5E, 0x37, 0xEE, 0x14, 0x89, 0xDB, 0x4D, 0xED, 0xDD, 0x7C,
+  0x07, 0x9C, 0x82, 0xB2, 0x95, 0xDD, 0x53, 0xD8, 0x74, 0xD9, 0xB1, 0xFD, 0x2E, 0x82, 0x8E, 0xBB,
+  0x07, 0x7B, 0xF6, 0xB8, 0x40, 0x44, 0x88, 0xF3, 0x94, 0x90, 0xC0, 0x68, 0x4D, 0x3D, 0x31, 0x24,
+  0x2E, 0xEB, 0xBD, 0xB5, 0x3C, 0x87, 0xEB, 0x1C, 0x20, 0x76, 0x69, 0x21, 0x9C, 0xA3, 0xF5, 0x95,
+  0x02, 0x8D, 0xBD, 0x2A, 0xB0, 0xC7, 0x81, 0xC3, 0x08, 0x8A, 0xFA, 0x7F, 0xAA, 0x9A, 0x55, 0x32,
+  0x49, 0xEA, 0x89, 0x79, 0x43, 0x55, 0x28, 0xAE, 0x90, 0xC7, 0xE9, 0xC8, 0x89, 0x58, 0x90, 0x5B,
+  0x61, 0x27, 0x22, 0x2A, 0x9E, 0x68, 0xCA, 0x48, 0x89, 0xD8, 0x96, 0x0F, 0xB6, 0xCB, 0x81, 0xA4,
+  0xC7, 0xD4, 0x22, 0x6B, 0xE2, 0xB2, 0x88, 0x1C, 0x90, 0xDC, 0x08, 0x9A, 0x31, 0x11, 0x49, 0x74,
+  0xA0, 0x11, 0x24, 0x72, 0x05, 0xBC, 0xFE, 0xC7, 0x4E, 0xFC, 0x19, 0x6C, 0x4A, 0x16, 0x86, 0xC9,
+  0x21, 0x40, 0x6E, 0xDA, 0x3C, 0x1F, 0x22, 0x45, 0xB2, 0x54, 0x04, 0x09, 0x92, 0x0B, 0x74, 0xAE,
+  0x2D, 0xF0, 0x56, 0x0A, 0x5A, 0x8B, 0xA6, 0x42, 0x70, 0x09, 0x10, 0x63, 0x21, 0x5C, 0x23, 0x29,
+  0x18, 0xC1, 0x35, 0x82, 0xD1, 0x66, 0x0B, 0x01, 0x52, 0x60, 0x1E, 0x23, 0x70, 0x37, 0xE2, 0xAC,
+  0x45, 0xEC, 0x46, 0x20, 0xA6, 0x03, 0x2D, 0x0F, 0xF2, 0x52, 0x40, 0x58, 0x37, 0x65, 0x63, 0x1B,
+  0x00, 0xF0, 0x91, 0x88, 0x45, 0xC9, 0x80, 0x5C, 0x2C, 0x02, 0x50, 0x1C, 0xCB, 0x14, 0x8D, 0x08,
+  0xD1, 0x49, 0x19, 0xBE, 0x15, 0xE4, 0xE9, 0x32, 0x79, 0xB2, 0xB0, 0xD6, 0x28, 0x42, 0xB2, 0xE5,
+  0x75, 0x00, 0x80, 0x89, 0xC0, 0xE8, 0x00, 0x43, 0xD9, 0x92, 0x85, 0x02, 0x68, 0xE8, 0x20, 0xD3,
+  0xB1, 0xB0, 0x13, 0xA7, 0xDE, 0xA9, 0x88, 0xBC, 0x99, 0xAD, 0x2E, 0xE1, 0x2D, 0x19, 0x7A, 0x6B,
+  0x13, 0xCA, 0x92, 0x91, 0xB6, 0xB4, 0x77, 0x03, 0x9E, 0x47, 0xAA, 0x20, 0x36, 0x8B, 0x48, 0x54,
+  0xD9, 0x02, 0x4C, 0x09, 0xB2, 0x92, 0x18, 0xA0, 0xB2, 0xB6, 0xF0, 0x3E, 0x18, 0x2F, 0x93, 0x4D,
+  0x47, 0x9A, 0xCF, 0x4D, 0x87, 0x83, 0x42, 0x9B, 0x09, 0x38, 0xF2, 0xAB, 0x67, 0xFE, 0xCD, 0xFC,
+  0x46, 0x5C, 0x71, 0x05, 0x4F, 0xCE, 0x99, 0x0C, 0x78, 0x93, 0xA1, 0xCD, 0x20, 0xF4, 0x47, 0x1E,
+  0x32, 0x3E, 0x46, 0xFA, 0x2F, 0x14, 0xD4, 0x93, 0x84, 0x46, 0x0C, 0x92, 0xC7, 0x81, 0x1C, 0x60,
+  0xC8, 0xC2, 0x0D, 0xDD, 0x8A, 0xF8, 0xBA, 0xBB, 0x88, 0x64, 0x23, 0x64, 0x31, 0x48, 0xD4, 0x00,
+  0xED, 0xA8, 0x8A, 0xAD, 0x75, 0x44, 0xC8, 0x12, 0x9C, 0xB9, 0x74, 0x2E, 0x62, 0xEB, 0xA6, 0x13,
+  0x0B, 0x18, 0x4A, 0x92, 0x7C, 0xE8, 0xE6, 0x1C, 0x27, 0x82, 0x4B, 0xA6, 0xFE, 0xB1, 0x93, 0x12,
+  0xA5, 0x88, 0xB8, 0x96, 0x74, 0x90, 0x1E, 0x70, 0xAB, 0x6B, 0xA0, 0x59, 0x04, 0xCB, 0x89, 0x02,
+  0xF2, 0x1E, 0xDE, 0x2F, 0x9F, 0xFD, 0x67, 0xD8, 0x34, 0xE5, 0x9D, 0xCA, 0xCD, 0x9F, 0x30, 0x4B,
+  0x64, 0xB2, 0x79, 0xEA, 0xBA, 0xE1, 0x3B, 0x4D, 0x2B, 0xE2, 0x04, 0x24, 0x8B, 0x17, 0xD3, 0x7A,
+  0x51, 0x33, 0x8A, 0x74, 0x3D, 0x84, 0x3D, 0x1D, 0xF9, 0xD4, 0x87, 0xC4, 0x49, 0x77, 0x2E, 0x11,
+  0x8F, 0xC0, 0x0D, 0x9B, 0xA8, 0x3B, 0x88, 0xF1, 0x4F, 0x0A, 0x5A, 0x69, 0x2B, 0xA1, 0x93, 0xB0,
+  0xA9, 0x3A, 0x5E, 0xFB, 0x22, 0x88, 0x41, 0xA4, 0xE1, 0x06, 0x71, 0x9F, 0x03, 0x26, 0xC1, 0x27,
+  0x42, 0x43, 0x56, 0x0B, 0x89, 0x26, 0xB4, 0x67, 0xDF, 0xA6, 0x7A, 0x55, 0x07, 0xF3, 0xA4, 0x6C,
+  0x8D, 0x40, 0x3F, 0x8E, 0xEA, 0x02, 0x12, 0x5A, 0x1F, 0x8D, 0x7A, 0x81, 0x59, 0x42, 0x0E, 0x11,
+  0x36, 0x87, 0xE8, 0x7E, 0x30, 0x44, 0x84, 0x8C, 0x11, 0xA9, 0x17, 0x5A, 0xF1, 0xC8, 0xE8, 0x2D,
+  0x0C, 0x22, 0xA2, 0x22, 0xA9, 0xAD, 0x45, 0x24, 0x0C, 0x23, 0x42, 0x6C, 0x17, 0xAD, 0x59, 0x16,
+  0xA9, 0x6D, 0x97, 0x16, 0x98, 0x18, 0x24, 0xDD, 0x8C, 0x90, 0xB5, 0xCF, 0x08, 0x59, 0x2F, 0x03,
+  0x89, 0xC6, 0x88, 0x60, 0xA3, 0x90, 0xB1, 0xC3, 0x25, 0x28, 0xE8, 0xED, 0x43, 0xEF, 0xB0, 0x34,
+  0x47, 0x86, 0x80, 0xB6, 0xE4, 0x86, 0x0D, 0x7A, 0xF1, 0x22, 0xFC, 0xBD, 0x52, 0x30, 0x92, 0xBD,
+  0xB0, 0x4C, 0x02, 0x00, 0x9E, 0x85, 0xD8, 0xFC, 0xEB, 0xEC, 0x2B, 0xDE, 0x8C, 0x53, 0xD9, 0x54,
+  0xE3, 0xA6, 0xD1, 0x1D, 0x25, 0x92, 0x85, 0x90, 0x83, 0xC1, 0x42, 0x2C, 0x99, 0x1D, 0xC2, 0xAC,
+  0x80, 0x21, 0xC7, 0x8A, 0xE1, 0x89, 0x88, 0x8B, 0x69, 0x04, 0x3E, 0x8F, 0x22, 0xC4, 0x02, 0x89,
+  0xA0, 0xAC, 0x41, 0x97, 0xE9, 0x09, 0x6F, 0x8C, 0x1C, 0x6B, 0x8B, 0xC1, 0x2A, 0x13, 0xA3, 0x0B,
+  0x66, 0x5D, 0x25, 0x41, 0x2F, 0x12, 0xE5, 0x45, 0x44, 0x36, 0x02, 0xAD, 0x3D, 0x31, 0xFA, 0x2F,
+  0xA5, 0x82, 0x78, 0x0C, 0xC2, 0x68, 0x05, 0xC9, 0x96, 0x02, 0x57, 0x84, 0xDF, 0x21, 0x1B, 0xC3,
+  0xC5, 0x36, 0x82, 0xA6, 0x0D, 0xF4, 0x00, 0x9A, 0xA2, 0x2C, 0x5B, 0x38, 0x70, 0x35, 0xD0, 0x5E,
+  0x34, 0xF7, 0x6F, 0xF0, 0x7C, 0xD7, 0x72, 0xBE, 0x4E, 0x3D, 0x40, 0x99, 0x84, 0x08, 0x91, 0xFF,
+  0xEF, 0xE7, 0x1B, 0x97, 0x64, 0x61, 0x4D, 0x82, 0x88, 0x30, 0x95, 0x62, 0x22, 0x2F, 0x1F, 0x89,
+  0x78, 0x36, 0x76, 0x41, 0xE7, 0x1B, 0xCE, 0xBE, 0x88, 0x6A, 0xB4, 0x3E, 0x6A, 0xB7, 0x82, 0x87,
+  0x4C, 0xA4, 0x34, 0x1C, 0x82, 0x1A, 0x04, 0x7E, 0xF2, 0xEE, 0x78, 0x15, 0x89, 0xC7, 0xE3, 0xB1,
+  0xF8, 0xB5, 0x84, 0xE5, 0x5F, 0x40, 0x65, 0x18, 0xBA, 0xD1, 0x48, 0xB0, 0x4E, 0xE9, 0x9C, 0xE1,
+  0x31, 0x7A, 0xB1, 0xC4, 0xC7, 0x87, 0x4C, 0xA4, 0x47, 0xEA, 0xB3, 0x2F, 0x37, 0x02, 0xEE, 0xD7,
+  0xB7, 0x6B, 0x5D, 0xD1, 0xDD, 0xFD, 0xF1, 0x5E, 0x80, 0xDC, 0xDB, 0xF2, 0xFB, 0x2F, 0xB2, 0x54,
+  0xA5, 0x63, 0x24, 0x7C, 0xD5, 0x50, 0x5D, 0x35, 0xE8, 0x5F, 0x29, 0x30, 0x23, 0x24, 0xEF, 0xD6,
+  0x09, 0x75, 0x60, 0xAA, 0x30, 0x92, 0x91, 0x1E, 0xC4, 0x56, 0xA4, 0x6A, 0x45, 0x74, 0x02, 0x04,
+  0xCA, 0x88, 0xB8, 0x3A, 0x68, 0x79, 0xE0, 0xBE, 0xD0, 0x5A, 0x42, 0x8A, 0x02, 0xCA, 0x7D, 0x8C,
+  0x34, 0x48, 0xAC, 0xF5, 0x17, 0x88, 0xF6, 0x5B, 0x59, 0x7C, 0x63, 0x75, 0xC1, 0xE8, 0x62, 0x84,
+  0x9E, 0xF1, 0x78, 0xB6, 0x3A, 0x27, 0x3D, 0x3E, 0x8B, 0xB3, 0x22, 0xF9, 0xF7, 0x78, 0x63, 0x19,
+  0xD4, 0x77, 0x9C, 0xC8, 0xEB, 0x5C, 0x37, 0x70, 0x6A, 0xCE, 0x56, 0x06, 0x85, 0x07, 0x9B, 0x2B,
+  0x44, 0x5E, 0x71, 0x92, 0x8A, 0x9C, 0x8B, 0x46, 0x88, 0x14, 0xF5, 0x01, 0x12, 0x50, 0xE4, 0x58,
+  0xC0, 0x27, 0x68, 0x1E, 0x83, 0x99, 0x33, 0x77, 0x0F, 0x4A, 0x0B, 0x41, 0xA4, 0xA3, 0x07, 0x8F,
+  0x03, 0xE5, 0x20, 0x16, 0x8A, 0x18, 0x48, 0x29, 0xD0, 0x5F, 0x79, 0x45, 0xE6, 0x8A, 0x2C, 0x5C,
+  0x9C, 0xF5, 0x09, 0x8A, 0x02, 0xFE, 0x42, 0x07, 0x53, 0x44, 0x0A, 0x88, 0x22, 0x70, 0x27, 0x60,
+  0x0A, 0xE0, 0x45, 0x2C, 0x02, 0x59, 0x19, 0xB2, 0xC2, 0xDF, 0x06, 0x52, 0x03, 0x0F, 0x15, 0x30,
+  0xCC, 0x7E, 0xB6, 0xB8, 0x41, 0xC9, 0x29, 0x44, 0x89, 0x08, 0x33, 0x69, 0xA9, 0xA0, 0xB3, 0x9B,
+  0xA4, 0xC7, 0x15, 0x1C, 0xDF, 0x43, 0x8F, 0x98, 0x20, 0x14, 0x14, 0x8A, 0x8C, 0xFD, 0x69, 0x64,
+  0x48, 0x3A, 0x71, 0x68, 0xA8, 0x1C, 0xD7, 0xB2, 0x23, 0xD2, 0xD6, 0x75, 0x41, 0x0C, 0x4F, 0x78,
+  0x1E, 0x63, 0x3E, 0x40, 0xC9, 0x44, 0x10, 0x80, 0x22, 0x83, 0xF8, 0x38, 0x82, 0x05, 0x11, 0x4A,
+  0x79, 0x0B, 0xF6, 0x1A, 0x86, 0xC1, 0xA2, 0x1F, 0xC4, 0xCD, 0xE1, 0x42, 0xF5, 0x07, 0xCA, 0x15,
+  0x3F, 0x9C, 0xC2, 0x67, 0x4D, 0xFE, 0xB9, 0xF9, 0xB3, 0x4F, 0x60, 0x3E, 0x3A, 0x79, 0xCF, 0xE3,
+  0xFE, 0x77, 0xCC, 0xDC, 0xBB, 0xD8, 0xFD, 0xAF, 0x9E, 0xB6, 0x67, 0x63, 0xFB, 0x73, 0xD3, 0xB6,
+  0x38, 0x81, 0xF9, 0xE8, 0xB4, 0x3D, 0x8F, 0xFB, 0xDF, 0x31, 0x6D, 0xEF, 0x62, 0xF7, 0x3F, 0x39,
+  0x6D, 0x0F, 0x1F, 0x62, 0x33, 0x18, 0x09, 0xDD, 0x52, 0x08, 0x01, 0xE7, 0x78, 0xC3, 0xCF, 0x20,
+  0x52, 0xB2, 0x17, 0x7B, 0x27, 0x48, 0x70, 0x37, 0x5B, 0xD1, 0x74, 0x43, 0x56, 0x8A, 0x44, 0x38,
+  0x83, 0xD8, 0x86, 0x83, 0x09, 0x05, 0xDC, 0x94, 0xE3, 0x68, 0x0F, 0xE7, 0x2B, 0xB8, 0x4C, 0x3F,
+  0xD8, 0xC7, 0x13, 0x63, 0x1A, 0x64, 0x5B, 0x9B, 0x10, 0x6C, 0x62, 0xCB, 0xA4, 0x62, 0x61, 0xC9,
+  0xA9, 0xC9, 0x7C, 0xBB, 0xFD, 0xFA, 0x48, 0xD6, 0x01, 0xF2, 0x14, 0x4B, 0x52, 0x66, 0xB2, 0x42,
+  0x4D, 0x44, 0xA9, 0x1E, 0x5C, 0x63, 0xD7, 0x08, 0x25, 0xEB, 0x1F, 0xDB, 0x44, 0x3A, 0x99, 0x21,
+  0x9F, 0x82, 0x40, 0x3E, 0x79, 0x2E, 0xB8, 0x4E, 0x05, 0x9F, 0xD9, 0xE0, 0x0E, 0x64, 0x52, 0xA4,
+  0xB6, 0x4F, 0xEA, 0xB4, 0x0E, 0xA9, 0xD0, 0x86, 0xD0, 0x64, 0x6B, 0x0D, 0x41, 0x15, 0xF8, 0xDC,
+  0xFC, 0x98, 0x09, 0xD7, 0x1D, 0x60, 0x20, 0x51, 0x59, 0xEB, 0x90, 0xB0, 0x30, 0xA7, 0x81, 0xCF,
+  0x4C, 0xE4, 0x69, 0xFC, 0xD1, 0xF9, 0xAD, 0x9F, 0x41, 0xE3, 0x0C, 0xF6, 0x8D, 0x11, 0x54, 0x7F,
+  0x9F, 0x31, 0x3A, 0xAF, 0xB6, 0x11, 0x66, 0xB8, 0xE1, 0x2A, 0x2E, 0x59, 0xD7, 0x15, 0x6F, 0x1F,
+  0x75, 0xC5, 0x40, 0xDF, 0x82, 0x15, 0x29, 0xB2, 0xF3, 0x8B, 0xDC, 0x74, 0x6F, 0x51, 0x5C, 0x43,
+  0xEE, 0x71, 0x9B, 0x58, 0x94, 0x4A, 0x2A, 0x54, 0xEC, 0xB8, 0x75, 0xAC, 0xA5, 0x9B, 0x20, 0xCC,
+  0x35, 0x2C, 0x2A, 0x24, 0x50, 0x8C, 0x26, 0x98, 0x24, 0x9F, 0x60, 0x12, 0x4C, 0x2A, 0x11, 0x3B,
+  0x95, 0xDC, 0x83, 0xED, 0x73, 0xC1, 0xC6, 0xAD, 0x21, 0x08, 0x56, 0x94, 0x63, 0x8E, 0xF1, 0x55,
+  0x8E, 0xE1, 0x04, 0x68, 0x2E, 0x64, 0x99, 0x44, 0x3C, 0x19, 0xA3, 0x62, 0xCC, 0xAB, 0x86, 0x71,
+  0xE1, 0xBD, 0x96, 0x89, 0x77, 0x5A, 0x26, 0xDE, 0x69, 0x48, 0x9A, 0x3D, 0x12, 0x22, 0x1C, 0xE4,
+  0x92, 0x25, 0x07, 0x08, 0x02, 0x0D, 0xB2, 0x58, 0x2E, 0x41, 0xAA, 0xAD, 0x61, 0x6B, 0x6B, 0x86,
+  0xFD, 0xF3, 0x2E, 0x23, 0x41, 0xC4, 0x8B, 0x70, 0xE9, 0x18, 0x81, 0x70, 0x6A, 0x16, 0xA9, 0x60,
+  0x3B, 0xC2, 0xBB, 0xC1, 0xAE, 0xA6, 0x7C, 0xF2, 0xF8, 0xAB, 0x2C, 0x3A, 0x8B, 0xFC, 0xD7, 0x87,
+  0xB3, 0x5F, 0x5D, 0x55, 0x05, 0xF8, 0xF9, 0x04, 0x63, 0x5B, 0xBA, 0xE9, 0x16, 0x5F, 0xC1, 0x7E,
+  0x81, 0x16, 0x3E, 0x3E, 0x1F, 0xE8, 0x39, 0xC6, 0x3C, 0xFD, 0x0F, 0x18, 0x87, 0xCD, 0xEA, 0x16,
+  0xA4, 0x1A, 0x1F, 0x02, 0x75, 0xC4, 0x2E, 0x71, 0xD6, 0x6F, 0x00, 0xF3, 0xB0, 0x75, 0xF2, 0xC2,
+  0x39, 0xA8, 0xB3, 0xB6, 0x5C, 0x2A, 0x7C, 0xF0, 0xDC, 0x2C, 0x98, 0xE6, 0xAF, 0x0F, 0x4F, 0x0F,
+  0x4F, 0x4F, 0x4C, 0x30, 0xEF, 0x96, 0x4D, 0x04, 0x23, 0xFF, 0xB8, 0x86, 0x6C, 0x86, 0x64, 0x34,
+  0x85, 0xC0, 0x52, 0x0C, 0x88, 0x8D, 0x21, 0x4B, 0x38, 0x06, 0xD2, 0x90, 0xA9, 0xE4, 0x1F, 0x15,
+  0xDD, 0xB1, 0x41, 0xAA, 0xC9, 0x5E, 0x03, 0xC6, 0xB5, 0x2C, 0xC3, 0xD5, 0x6D, 0x27, 0xFF, 0x28,
+  0xBD, 0xC1, 0x5A, 0x4D, 0x91, 0x7F, 0x14, 0x13, 0xAC, 0x24, 0x54, 0x41, 0x7E, 0x4E, 0x0F, 0x78,
+  0x9E, 0x27, 0x4C, 0x56, 0xF6, 0xE7, 0x37, 0xD3, 0xE9, 0x74, 0x78, 0x73, 0x68, 0x8B, 0x32, 0x98,
+  0x12, 0x40, 0x70, 0xD7, 0x83, 0xA9, 0x26, 0x97, 0x5C, 0x92, 0x81, 0x5C, 0x93, 0xAC, 0xD5, 0x81,
+  0xBC, 0x41, 0xA4, 0x0D, 0xD2, 0x4E, 0xD6, 0x10, 0x40, 0xFD, 0x43, 0xFE, 0x87, 0x66, 0xE3, 0xE5,
+  0xF1, 0x13, 0x73, 0x4C, 0x6B, 0x82, 0xC5, 0xA7, 0x04, 0xE3, 0x80, 0x0D, 0x41, 0x80, 0xE3, 0xBE,
+  0xB0, 0x0B, 0xD6, 0xA0, 0xC0, 0xE2, 0xF6, 0x10, 0x26, 0x0B, 0x11, 0x60, 0x62, 0xF3, 0x5C, 0x3C,
+  0xCD, 0x68, 0x58, 0x57, 0x88, 0x38, 0x43, 0x23, 0x62, 0xCA, 0x42, 0xBE, 0x11, 0xA2, 0x2F, 0xD2,
+  0x82, 0x57, 0xC2, 0xC8, 0x1C, 0x10, 0xB6, 0x48, 0xAF, 0x23, 0x0D, 0xE7, 0xBB, 0x86, 0x80, 0x35,
+  0x60, 0x70, 0x01, 0x9C, 0x7A, 0x46, 0x63, 0x4E, 0x24, 0xFF, 0xA8, 0xA7, 0xA7, 0x07, 0x66, 0x77,
+  0x44, 0xC5, 0xDD, 0xDB, 0x40, 0x17, 0x89, 0xA2, 0x49, 0x10, 0x4D, 0x31, 0xCA, 0x36, 0x8C, 0xDA,
+  0xF3, 0x49, 0x24, 0x90, 0x85, 0x5D, 0x20, 0x04, 0xA6, 0x0E, 0xF1, 0x8C, 0x2D, 0x42, 0xF8, 0x4A,
+  0x30, 0x72, 0x5D, 0x23, 0x1F, 0xEE, 0xAF, 0x60, 0x48, 0x97, 0xFC, 0xE3, 0xD6, 0xD4, 0xC1, 0xBE,
+  0x84, 0xB6, 0x30, 0x20, 0x3D, 0x84, 0x95, 0x7F, 0xB4, 0xCC, 0xC1, 0x11, 0xC0, 0xB9, 0xD2, 0xA3,
+  0x38, 0xDC, 0x42, 0x6E, 0x14, 0x8C, 0xA4, 0x82, 0xC8, 0x3C, 0x26, 0x11, 0xFF, 0x14, 0x08, 0x41,
+  0xE0, 0x06, 0x3E, 0xB5, 0xFF, 0xFF, 0x9E, 0xF6, 0x87, 0x13, 0xFF, 0xA9, 0xFE, 0xFF, 0x46, 0xEA,
+  0x2F, 0xBC, 0xAF, 0xFE, 0x89, 0x9F, 0x56, 0xFF, 0xDF, 0xCE, 0x36, 0x87, 0x11, 0xFF, 0x8F, 0x82,
+  0x9D, 0x66, 0xB3, 0x76, 0xAB, 0xEE, 0xBA, 0xF6, 0x20, 0xAC, 0x64, 0x7C, 0x41, 0x71, 0xCB, 0x04,
+  0x40, 0xCA, 0x9E, 0x2C, 0xFE, 0xA1, 0x70, 0xB9, 0xF5, 0xF6, 0xAC, 0xA3, 0x70, 0x7B, 0x4B, 0xF6,
+  0x86, 0x91, 0x16, 0xC1, 0x3A, 0xFC, 0xEF, 0xBF, 0x27, 0x13, 0x89, 0xE0, 0x1E, 0xE9, 0xB0, 0x75,
+  0x7E, 0xFF, 0x3D, 0xEA, 0x06, 0x0D, 0xC2, 0xE2, 0x12, 0x98, 0x1A, 0x80, 0x68, 0x23, 0x33, 0x4A,
+  0xD5, 0x2A, 0x23, 0x8A, 0xA1, 0x06, 0xD0, 0xF3, 0xDB, 0x45, 0xB4, 0xF3, 0x5B, 0x22, 0x06, 0x6D,
+  0x20, 0x42, 0x57, 0xC0, 0x30, 0x45, 0xC9, 0x35, 0x11, 0xD0, 0xF8, 0x49, 0x8F, 0xE3, 0xAA, 0x85,
+  0x2B, 0x10, 0x12, 0x46, 0xA3, 0x97, 0xA6, 0x2C, 0x68, 0x14, 0xFC, 0xA5, 0xC4, 0xE3, 0x2E, 0x5F,
+  0x06, 0x4C, 0xE2, 0xA6, 0xE5, 0x43, 0xF7, 0x7D, 0xDE, 0x25, 0x71, 0xE0, 0x7B, 0x36, 0xCE, 0xB2,
+  0x3F, 0x4D, 0xDC, 0xFF, 0x45, 0x13, 0x07, 0xF3, 0xFE, 0x69, 0xE1, 0xFE, 0x4D, 0x2D, 0x5C, 0x2A,
+  0x91, 0xF8, 0x75, 0x16, 0xEE, 0x6A, 0x80, 0xF3, 0xF4, 0xBC, 0xAF, 0xF5, 0xF2, 0x8F, 0x2F, 0x9E,
+  0x93, 0x1E, 0xB2, 0xC1, 0xFB, 0x62, 0x33, 0x11, 0x66, 0xB8, 0x18, 0xD9, 0x48, 0xE4, 0xBC, 0xD7,
+  0x23, 0x94, 0xA6, 0x0F, 0xFC, 0x9D, 0x06, 0x23, 0xDD, 0xA2, 0x60, 0x83, 0x39, 0xFA, 0x89, 0x3F,
+  0x7C, 0xF8, 0x4B, 0x76, 0x38, 0xEC, 0x9C, 0x8F, 0xAC, 0x06, 0x9E, 0x0D, 0x49, 0xFE, 0x4A, 0x0D,
+  0xDC, 0x01, 0x76, 0xAF, 0x17, 0xF8, 0x27, 0xDF, 0xD9, 0x6D, 0x56, 0xFD, 0xCE, 0xB3, 0xCA, 0xAB,
+  0xB1, 0x82, 0xBA, 0x0E, 0x29, 0x88, 0x50, 0x8C, 0xB3, 0xCE, 0x53, 0xE9, 0x8F, 0x2C, 0x34, 0x9E,
+  0x93, 0x72, 0x91, 0x4D, 0x9F, 0x76, 0x78, 0xBF, 0x2A, 0x49, 0x1C, 0xBE, 0xB7, 0x33, 0xEE, 0x2D,
+  0xC3, 0x09, 0xE1, 0x37, 0x20, 0xFE, 0xE2, 0x55, 0x5C, 0xFA, 0x71, 0xA2, 0x2E, 0xA1, 0x71, 0xCE,
+  0x8B, 0x5F, 0xAD, 0x07, 0x26, 0x94, 0x12, 0x07, 0x7E, 0xC8, 0x0F, 0x67, 0xBB, 0xCC, 0xFF, 0xF4,
+  0xDA, 0xEC, 0xEB, 0xA5, 0xD9, 0x8F, 0x12, 0xF2, 0xEE, 0x6E, 0x4F, 0x30, 0x6F, 0x32, 0x72, 0x6E,
+  0x8E, 0x85, 0x9E, 0xEB, 0x73, 0xF9, 0x67, 0xE6, 0x6B, 0x6D, 0x1C, 0xF7, 0xE9, 0xE3, 0xF0, 0xFB,
+  0x62, 0x27, 0x21, 0x21, 0xED, 0x43, 0x33, 0x78, 0xBE, 0x72, 0x44, 0x95, 0xCE, 0x2B, 0x4F, 0xEF,
+  0xEF, 0x62, 0xF9, 0x53, 0x18, 0xEE, 0x2E, 0x30, 0xA4, 0x18, 0x03, 0x46, 0xCC, 0xFE, 0xEC, 0x0E,
+  0x21, 0xE1, 0x2A, 0x59, 0x0D, 0xD2, 0x44, 0x32, 0x2C, 0x79, 0x15, 0xFC, 0xE9, 0x43, 0x68, 0x23,
+  0x8F, 0x0B, 0xDF, 0x17, 0x7F, 0x12, 0xF4, 0x18, 0x6E, 0xE2, 0xCC, 0x53, 0xE7, 0x81, 0x38, 0x05,
+  0xF1, 0x94, 0x0C, 0xF4, 0x9E, 0x6F, 0xFB, 0x92, 0xA2, 0x97, 0x4D, 0x62, 0xE7, 0x8B, 0x52, 0xE4,
+  0x01, 0xF5, 0x3D, 0xD9, 0x12, 0xA8, 0xEF, 0x3D, 0xFB, 0x95, 0x54, 0x3C, 0xFB, 0xDA, 0xAB, 0x44,
+  0xBC, 0xB4, 0xB8, 0xA4, 0xC1, 0xB2, 0xA9, 0xB3, 0x3A, 0xDE, 0xC3, 0xEB, 0xBF, 0xCC, 0xB8, 0x5E,
+  0x4E, 0x3B, 0xD5, 0xAD, 0x4F, 0xB5, 0xB4, 0xDE, 0xF3, 0xEF, 0x9F, 0x2A, 0xA4, 0x41, 0xCC, 0x69,
+  0xAD, 0x11, 0xC8, 0xF0, 0x0D, 0x38, 0x9D, 0xCF, 0x3A, 0xDA, 0x67, 0x98, 0xF9, 0x59, 0x47, 0xFB,
+  0xAC, 0xA3, 0x7D, 0xD6, 0xD1, 0x3E, 0xB5, 0xFF, 0xB3, 0x8E, 0xF6, 0x59, 0x47, 0xFB, 0xF7, 0xA8,
+  0xA3, 0xBD, 0x44, 0x3A, 0x9F, 0x45, 0xB4, 0x4F, 0xFB, 0xF6, 0x59, 0x44, 0xFB, 0x2C, 0xA2, 0x7D,
+  0x16, 0xD1, 0x3E, 0x8B, 0x68, 0xBF, 0xA8, 0x88, 0xF6, 0xEC, 0x5C, 0x3E, 0x2B, 0x68, 0x9F, 0x15,
+  0xB4, 0xCF, 0x0A, 0xDA, 0x7F, 0x72, 0x05, 0xED, 0xB4, 0x85, 0xF0, 0x79, 0x37, 0xDC, 0xF3, 0xEF,
+  0x9F, 0xAA, 0xA0, 0xE9, 0xE6, 0x67, 0xDD, 0xEC, 0x33, 0xB2, 0xFC, 0xAC, 0x9B, 0x7D, 0xD6, 0xCD,
+  0x3E, 0xEB, 0x66, 0x9F, 0xDA, 0xFF, 0x59, 0x37, 0xFB, 0xAC, 0x9B, 0xFD, 0x9B, 0xD4, 0xCD, 0x5E,
+  0xE2, 0x9B, 0xCF, 0xBA, 0xD9, 0xA7, 0x7D, 0xFB, 0xAC, 0x9B, 0x7D, 0xD6, 0xCD, 0x3E, 0xEB, 0x66,
+  0x9F, 0x75, 0xB3, 0x5F, 0x54, 0x37, 0x7B, 0x76, 0x2E, 0x9F, 0x75, 0xB3, 0xCF, 0xBA, 0xD9, 0x67,
+  0xDD, 0xEC, 0x3F, 0xB0, 0x6E, 0xF6, 0x10, 0xFC, 0x2D, 0xE9, 0xFC, 0xDD, 0x33, 0x0A, 0x7F, 0x74,
+  0x34, 0x30, 0xF3, 0xCA, 0x0B, 0xDC, 0x70, 0xBF, 0xDD, 0xDE, 0x3E, 0xBF, 0x3F, 0xE0, 0x74, 0x51,
+  0x31, 0x82, 0xD3, 0xA1, 0xE2, 0xCF, 0xC4, 0xBE, 0x1C, 0xDD, 0x4B, 0x0E, 0xAD, 0x24, 0x01, 0x2D,
+  0x39, 0xFB, 0xF2, 0xB5, 0xD7, 0x48, 0x92, 0x97, 0x3D, 0x58, 0xC4, 0x03, 0xE8, 0xF0, 0xF5, 0xFE,
+  0x31, 0xF1, 0x8F, 0xBA, 0xFA, 0xA1, 0xA3, 0x88, 0x63, 0x8F, 0x3F, 0xC6, 0x8A, 0xBE, 0xA5, 0x82,
+  0x43, 0x64, 0x00, 0xF8, 0x8D, 0x13, 0x9C, 0x43, 0x4C, 0x4E, 0x27, 0x05, 0xFE, 0x32, 0xDF, 0xEF,
+  0x7B, 0xF1, 0x72, 0x84, 0x77, 0x00, 0xA8, 0x2A, 0xCC, 0x50, 0xF3, 0x63, 0x07, 0x21, 0x3F, 0xC5,
+  0x82, 0x0A, 0x22, 0x7A, 0x61, 0x22, 0x24, 0x12, 0x78, 0x3F, 0x0C, 0x0E, 0xAC, 0xB4, 0x70, 0xC1,
+  0x30, 0xA2, 0x54, 0xDC, 0x25, 0xA7, 0xA1, 0xDC, 0xBC, 0x04, 0x2F, 0x54, 0xEC, 0x0B, 0x50, 0x1D,
+  0x0D, 0xE3, 0xF0, 0xC4, 0x17, 0xF7, 0x6F, 0x28, 0x6E, 0x20, 0x53, 0x73, 0x17, 0x5F, 0x5C, 0x9A,
+  0x8E, 0xBD, 0x8C, 0x8C, 0xBE, 0xBA, 0x0F, 0xB1, 0xA7, 0xA3, 0xEF, 0xFC, 0xD3, 0x67, 0x2B, 0x47,
+  0x9B, 0x2F, 0x87, 0x2B, 0x7F, 0x84, 0x23, 0xC1, 0x0B, 0x27, 0xAE, 0xB1, 0xE3, 0xE7, 0x38, 0x4A,
+  0xC4, 0xE5, 0x89, 0x9C, 0x29, 0xFA, 0x53, 0x12, 0xF1, 0x57, 0x33, 0xFA, 0x2A, 0x8D, 0x21, 0x25,
+  0x23, 0xCB, 0xBE, 0x4D, 0xBC, 0x30, 0x22, 0xBC, 0x09, 0x71, 0xEC, 0x7B, 0xAD, 0x9E, 0x65, 0x06,
+  0xA6, 0xE1, 0xF9, 0xFA, 0xBC, 0x05, 0xB1, 0x59, 0x64, 0xD0, 0x63, 0x70, 0x26, 0x87, 0x2F, 0x37,
+  0xF8, 0x00, 0x97, 0xC3, 0x83, 0x3F, 0xCF, 0x15, 0x91, 0xD1, 0xA3, 0xBF, 0x39, 0x60, 0x27, 0xC2,
+  0x78, 0xEB, 0x44, 0xAF, 0x08, 0xF4, 0x8A, 0x7F, 0xFB, 0x76, 0xA2, 0x57, 0x04, 0x7A, 0x81, 0xD1,
+  0x81, 0xBE, 0xBF, 0x9C, 0x74, 0xFB, 0xCC, 0xE5, 0x6F, 0x5F, 0xC5, 0x87, 0xD3, 0x49, 0xB5, 0xC1,
+  0x35, 0x69, 0x11, 0x8B, 0x1D, 0x45, 0x2F, 0xB8, 0x43, 0xDA, 0x1F, 0xE3, 0x38, 0xAA, 0x48, 0x8E,
+  0xB8, 0xA7, 0x9E, 0xAE, 0xBD, 0x50, 0xE3, 0x3B, 0x47, 0x14, 0xA3, 0x8B, 0x97, 0x6A, 0xE0, 0xA7,
+  0xB3, 0x93, 0x7B, 0x5F, 0xB9, 0x22, 0x22, 0x2A, 0x3F, 0x3A, 0x4D, 0xF3, 0x5D, 0x4F, 0xFF, 0xC3,
+  0xB7, 0x23, 0xB4, 0x98, 0xC7, 0xE3, 0xA9, 0xB0, 0xDF, 0x18, 0x72, 0xFC, 0x30, 0x84, 0xD4, 0xCF,
+  0x27, 0x63, 0x83, 0x3F, 0x76, 0x5D, 0x48, 0x7C, 0x58, 0xD6, 0xF7, 0x7D, 0x48, 0xEA, 0xE3, 0xB2,
+  0xB5, 0x66, 0x21, 0x31, 0x09, 0x0E, 0x86, 0x26, 0x67, 0x63, 0x42, 0x90, 0xA3, 0xAF, 0x21, 0xBF,
+  0x60, 0x6D, 0x53, 0xFB, 0x42, 0x8E, 0xF5, 0x4B, 0x0B, 0x8C, 0x3E, 0x29, 0x76, 0x07, 0x7E, 0xA2,
+  0x59, 0xD3, 0xAC, 0x02, 0xFC, 0xD7, 0x19, 0x8E, 0x17, 0x95, 0xB1, 0x06, 0x57, 0xA3, 0x2C, 0x7C,
+  0x94, 0x87, 0xA5, 0xC2, 0x9C, 0xDC, 0xCF, 0x96, 0xB2, 0x4A, 0x99, 0x5C, 0xD4, 0x66, 0x83, 0xEA,
+  0xB4, 0x3E, 0x18, 0x49, 0xC9, 0xFB, 0x84, 0x92, 0xAC, 0xEE, 0xEF, 0xFB, 0xC5, 0xE2, 0x7D, 0x2D,
+  0xA7, 0xDF, 0x0F, 0x8B, 0x77, 0xD2, 0xB4, 0x6A, 0xDE, 0x4F, 0xEE, 0x8C, 0xF9, 0x74, 0x90, 0x92,
+  0x65, 0xC3, 0xE8, 0x41, 0xFB, 0x92, 0x7E, 0x7F, 0x37, 0xA8, 0x54, 0xC7, 0xA8, 0x83, 0x1D, 0x1E,
+  0x71, 0x3B, 0xAE, 0x62, 0x4D, 0x8B, 0xEB, 0x72, 0xAA, 0xAA, 0xD5, 0xE6, 0xE5, 0xAE, 0xDF, 0xE0,
+  0x56, 0x43, 0x5F, 0xF0, 0x77, 0xED, 0x62, 0xC1, 0x1F, 0xCC, 0x4B, 0xAD, 0xC2, 0xA0, 0x50, 0xAC,
+  0x08, 0xA5, 0x4A, 0xE9, 0x90, 0x90, 0xB4, 0x46, 0xBF, 0x99, 0xAD, 0xA0, 0x42, 0x3B, 0x53, 0xD8,
+  0x67, 0x13, 0xAB, 0x49, 0xBF, 0xDA, 0x9E, 0xEC, 0x07, 0x9C, 0x6E, 0x7A, 0x6C, 0x3F, 0x3B, 0x99,
+  0x74, 0xB7, 0x82, 0xA5, 0xEC, 0x86, 0x87, 0x9E, 0x67, 0x36, 0x3B, 0x53, 0x37, 0x63, 0x75, 0x0B,
+  0xBF, 0xF0, 0x3F, 0xAB, 0xAE, 0xD5, 0xCB, 0xAB, 0x8A, 0x52, 0x5F, 0x08, 0x68, 0xE9, 0x59, 0xEA,
+  0x86, 0x15, 0x38, 0xB6, 0x77, 0xE0, 0xE9, 0x76, 0x16, 0x0F, 0x04, 0xB1, 0xCD, 0x2F, 0x04, 0xB9,
+  0x5E, 0xF5, 0x1B, 0xBD, 0x7D, 0xA3, 0x24, 0xF9, 0x3A, 0x5F, 0x3D, 0xD0, 0x95, 0xBA, 0xDD, 0x9F,
+  0x34, 0x5A, 0x9C, 0xC8, 0xB2, 0x73, 0x73, 0x64, 0xE4, 0x76, 0xDA, 0x4C, 0x9D, 0xB3, 0xDC, 0x92,
+  0xC7, 0x9C, 0x5C, 0x5A, 0x66, 0x5B, 0x0A, 0xE7, 0x1D, 0xEA, 0xA5, 0x0C, 0xBD, 0xD7, 0xB6, 0x39,
+  0xBD, 0xDC, 0xE2, 0xCA, 0x03, 0xA1, 0xDD, 0x54, 0x9B, 0xFB, 0xB4, 0x68, 0xCE, 0x68, 0x7D, 0x6D,
+  0x78, 0x2D, 0x6E, 0x92, 0x9E, 0x74, 0x45, 0x21, 0xC3, 0x6F, 0x30, 0x56, 0x33, 0xB4, 0xEC, 0xA5,
+  0xF7, 0xC5, 0x1C, 0x9D, 0x61, 0x1D, 0xC4, 0x09, 0xCD, 0xF6, 0x7E, 0x9D, 0xDA, 0x94, 0x47, 0xB9,
+  0xAD, 0xD4, 0x61, 0xFB, 0xDD, 0x5D, 0xAE, 0x90, 0x91, 0x47, 0xA3, 0x7E, 0x76, 0x6D, 0x67, 0x8C,
+  0xDD, 0x5D, 0xF6, 0x2E, 0xD9, 0xF3, 0xB7, 0xD2, 0x7D, 0x7D, 0x39, 0xCD, 0x64, 0x36, 0x5B, 0x5A,
+  0xC8, 0xAD, 0xAA, 0x16, 0xF2, 0xC7, 0xEA, 0xA8, 0x37, 0x4D, 0x2E, 0xC6, 0x35, 0x8B, 0x2D, 0xF4,
+  0xD5, 0x51, 0xBD, 0xAE, 0xAA, 0xF7, 0xBC, 0xB5, 0xAD, 0xAA, 0x29, 0x67, 0xCA, 0xFA, 0xE5, 0x79,
+  0x95, 0xBF, 0x53, 0x75, 0x8B, 0x6F, 0x89, 0x55, 0xA1, 0xD8, 0xA1, 0xC5, 0x3E, 0x5F, 0x54, 0xE8,
+  0xBE, 0x3F, 0x6E, 0xAD, 0x7A, 0xB8, 0xBF, 0xAB, 0xD0, 0xCD, 0xA9, 0x4D, 0xEB, 0x42, 0x3A, 0xCD,
+  0x97, 0x6C, 0x3E, 0x9D, 0xF6, 0xE8, 0x75, 0xBA, 0x52, 0x67, 0x9D, 0x1A, 0xCF, 0x95, 0x5D, 0x6F,
+  0x56, 0x59, 0x89, 0xED, 0x72, 0xDD, 0xD0, 0xEE, 0x97, 0xBE, 0xDE, 0xA6, 0xD9, 0x66, 0x6A, 0xA2,
+  0x8E, 0x46, 0x9A, 0xB7, 0x61, 0xD3, 0x26, 0x9E, 0x27, 0x1A, 0x77, 0x13, 0x55, 0xEA, 0x95, 0xDC,
+  0x62, 0x91, 0xEE, 0xD0, 0x9D, 0xB2, 0xA8, 0x35, 0x0F, 0xBE, 0x5E, 0x9D, 0xE8, 0xDB, 0x83, 0x2B,
+  0x3B, 0x19, 0x83, 0x17, 0xED, 0xC5, 0x30, 0xA7, 0x4E, 0xBD, 0x5C, 0xB6, 0xD9, 0xAB, 0x6D, 0x36,
+  0xB4, 0x20, 0x27, 0xD3, 0x69, 0x8E, 0x65, 0xEB, 0x33, 0x16, 0x71, 0x58, 0xE8, 0x56, 0x84, 0x81,
+  0xDA, 0x9B, 0xA4, 0x56, 0xA5, 0xD6, 0xCE, 0x65, 0x59, 0x3C, 0x2F, 0xE6, 0xF8, 0xAE, 0xD0, 0x57,
+  0xF6, 0x93, 0x7A, 0xB2, 0x5E, 0xA6, 0x8D, 0x6C, 0x7A, 0xC2, 0xE2, 0xEC, 0xF0, 0x7E, 0x03, 0x70,
+  0x17, 0x4A, 0xAA, 0xA2, 0xE5, 0xBA, 0x99, 0x34, 0x97, 0x59, 0x2F, 0xCB, 0xF7, 0xFD, 0xB1, 0x6A,
+  0xD0, 0x25, 0x8D, 0xCE, 0x35, 0xED, 0x3E, 0x1A, 0x57, 0xCD, 0x9D, 0xE9, 0xCB, 0x35, 0x33, 0xA9,
+  0x75, 0x9B, 0xE5, 0x16, 0x8B, 0xFD, 0xF2, 0x3D, 0x9F, 0xEA, 0x6B, 0xE5, 0xBB, 0xBE, 0xA4, 0x8E,
+  0xA7, 0x65, 0x3F, 0xA9, 0x56, 0xEE, 0xEF, 0xD7, 0xC3, 0xEA, 0x2E, 0xB3, 0x43, 0x45, 0x95, 0x47,
+  0x89, 0xD4, 0x7C, 0x6A, 0x14, 0x7A, 0xEE, 0x64, 0x96, 0xE2, 0x0B, 0x93, 0x99, 0x9A, 0xB4, 0x2B,
+  0xD5, 0xA1, 0x96, 0xA6, 0x15, 0x79, 0xE8, 0x60, 0xBD, 0xDD, 0x32, 0x8A, 0x29, 0xDA, 0xF4, 0xBB,
+  0xDB, 0x6C, 0x66, 0xAD, 0x14, 0xC9, 0x83, 0x4A, 0x3A, 0xB1, 0xCD, 0x16, 0x86, 0x3E, 0x9D, 0xDB,
+  0xA7, 0xB6, 0xA5, 0x8C, 0x62, 0x0C, 0x8B, 0x09, 0xAB, 0xED, 0xCD, 0x17, 0xBC, 0xB7, 0x1E, 0xB6,
+  0x5B, 0x8E, 0x72, 0xD8, 0x64, 0xCD, 0xC5, 0xC1, 0x4D, 0xAB, 0xE5, 0x9C, 0xD1, 0x91, 0x16, 0xBB,
+  0x69, 0x65, 0x46, 0x9B, 0x6B, 0x0F, 0xAB, 0x9E, 0x96, 0x68, 0x37, 0xFD, 0x0D, 0x9B, 0x30, 0x4C,
+  0xC5, 0x1A, 0x09, 0xB9, 0x35, 0x8B, 0xA7, 0x9B, 0xDE, 0xA2, 0x48, 0xEF, 0xEE, 0xDD, 0x8C, 0x9F,
+  0x6B, 0x48, 0xDD, 0x7D, 0xBA, 0x9C, 0x2D, 0x6D, 0x73, 0xE9, 0x85, 0xB3, 0xF1, 0xF0, 0xCA, 0xBC,
+  0x33, 0xC5, 0x6E, 0xAB, 0xA0, 0xB3, 0x89, 0xD5, 0xD4, 0x11, 0x58, 0x7E, 0xE5, 0x54, 0x1A, 0xA2,
+  0xE9, 0x7A, 0x99, 0x54, 0x6A, 0xA6, 0xCE, 0xD4, 0xDC, 0x32, 0xB3, 0x18, 0xCF, 0x77, 0x5C, 0xD5,
+  0xCD, 0xF0, 0x8B, 0x9C, 0x6C, 0xEA, 0xA2, 0xD9, 0xE1, 0x16, 0xF6, 0xC2, 0xEB, 0xEE, 0xA7, 0xA0,
+  0x70, 0xC9, 0xF9, 0xFC, 0x90, 0xE9, 0xD0, 0xB3, 0x86, 0x0B, 0x22, 0xC3, 0x36, 0x33, 0x59, 0x16,
+  0xE1, 0xEE, 0xB6, 0x20, 0x74, 0x9D, 0x52, 0x8F, 0xDB, 0xCF, 0xD8, 0x79, 0x16, 0xFB, 0xAA, 0x5A,
+  0x5F, 0x62, 0x9C, 0x92, 0x92, 0x66, 0x3A, 0x2B, 0x25, 0xC7, 0xE9, 0xDC, 0xBE, 0xB2, 0x1C, 0x7B,
+  0x82, 0x3B, 0xF4, 0xF4, 0xFD, 0xD4, 0xE7, 0xFB, 0x03, 0x7A, 0x9B, 0xDD, 0x83, 0xE0, 0x8C, 0x1D,
+  0xBA, 0x47, 0xF7, 0xC4, 0xCC, 0x0C, 0xDD, 0xEF, 0x32, 0xE3, 0x91, 0xBA, 0x3D, 0x64, 0x16, 0x8B,
+  0x24, 0x6D, 0x4D, 0xE4, 0xA2, 0x77, 0xD8, 0x6C, 0x72, 0xB3, 0xA5, 0x81, 0xCB, 0x49, 0xBA, 0xD7,
+  0xDF, 0xA7, 0xB3, 0xA3, 0xFD, 0x4A, 0x4B, 0x69, 0x02, 0x76, 0x66, 0xDB, 0xCA, 0xDE, 0xCC, 0xD6,
+  0xB4, 0xF4, 0x48, 0x1E, 0x4B, 0xE9, 0x7D, 0xC9, 0xC8, 0xB8, 0x0D, 0xBA, 0xE3, 0xD9, 0x2A, 0x6A,
+  0x79, 0xEB, 0x55, 0x09, 0xB3, 0xB6, 0x34, 0xB6, 0x3B, 0xE9, 0x64, 0xCA, 0xD5, 0x47, 0xD3, 0xDE,
+  0x48, 0x2E, 0x66, 0xC4, 0xFB, 0x59, 0x4A, 0xA7, 0x4D, 0xA9, 0x4F, 0xA7, 0xAB, 0x75, 0x6E, 0x9A,
+  0x68, 0xDE, 0x77, 0xDB, 0x2D, 0x39, 0x99, 0x4B, 0xB0, 0xA2, 0x20, 0x14, 0xB6, 0xA2, 0x5E, 0xDF,
+  0x0C, 0xD0, 0xE4, 0x20, 0xD9, 0x72, 0x66, 0x0F, 0xFD, 0x6B, 0xD3, 0x9C, 0xA0, 0x4E, 0x4B, 0xAE,
+  0x3C, 0x6D, 0x3B, 0x99, 0x99, 0x95, 0x9A, 0x23, 0x2E, 0xDB, 0xF0, 0x38, 0x5B, 0xE4, 0xB7, 0x5A,
+  0xF2, 0x7E, 0x30, 0x4B, 0xA0, 0x5C, 0x8E, 0xEF, 0x8F, 0x7A, 0x77, 0xA5, 0x43, 0xB1, 0x5D, 0xEA,
+  0xEE, 0x4B, 0x5D, 0x4B, 0x97, 0x95, 0x45, 0xBA, 0x71, 0xA7, 0xEE, 0x44, 0xCC, 0x6E, 0xD2, 0x8E,
+  0x34, 0x4E, 0x55, 0xE7, 0x45, 0xF6, 0xAE, 0x66, 0x97, 0x1A, 0x75, 0xB5, 0x45, 0xE7, 0x6A, 0xB6,
+  0x2B, 0xDF, 0x2D, 0x87, 0xB6, 0xB7, 0xBF, 0x93, 0xAB, 0xAC, 0x32, 0xB0, 0xC7, 0xE2, 0x6C, 0x2F,
+  0xE1, 0xA2, 0x91, 0xD4, 0xEB, 0xE2, 0x32, 0xCB, 0xA7, 0x6B, 0x2D, 0x81, 0x5F, 0x6E, 0x45, 0xBA,
+  0xB5, 0x1C, 0xC9, 0xDC, 0x8C, 0x9E, 0xCB, 0x93, 0x03, 0xBD, 0xB6, 0x13, 0x69, 0x6F, 0xBF, 0xA1,
+  0x13, 0x1D, 0x7D, 0xEC, 0xAC, 0x1B, 0xF3, 0x9E, 0xAC, 0xE6, 0xD2, 0x9C, 0x36, 0x6B, 0xCF, 0xCA,
+  0xF3, 0x8D, 0xB8, 0x6A, 0x68, 0x4A, 0x6E, 0x66, 0xD6, 0x70, 0xB9, 0x29, 0xE5, 0x9A, 0xBC, 0x22,
+  0xF7, 0xD3, 0xBC, 0xC7, 0xF2, 0xDA, 0x6C, 0x8B, 0xE6, 0xE5, 0xFD, 0xCC, 0x9C, 0x8C, 0x55, 0x36,
+  0x39, 0x4A, 0x2A, 0xCA, 0xFC, 0xAE, 0x2B, 0xE8, 0x2B, 0x81, 0x6B, 0xA5, 0xDC, 0x81, 0x9B, 0x4D,
+  0xEF, 0x33, 0x4A, 0x66, 0xC8, 0x99, 0xCD, 0x41, 0x6A, 0x96, 0x94, 0xD8, 0xD4, 0x2C, 0x6D, 0x15,
+  0xD4, 0xA4, 0x33, 0xAB, 0x16, 0x4B, 0x29, 0xBC, 0x73, 0xBD, 0xE2, 0x3D, 0xEB, 0x37, 0x33, 0x46,
+  0x67, 0x38, 0x6B, 0x8C, 0x72, 0x03, 0xBD, 0x20, 0xA5, 0x78, 0x34, 0x13, 0x36, 0x82, 0x87, 0xA6,
+  0xBE, 0x56, 0xC3, 0xD2, 0xA0, 0x81, 0x92, 0x2E, 0x0D, 0x7C, 0x10, 0x61, 0x02, 0x16, 0x9D, 0x99,
+  0x6B, 0xAB, 0xDD, 0x9C, 0x29, 0x2F, 0x2A, 0x7E, 0xA3, 0x5A, 0xEF, 0xAA, 0x0B, 0xD7, 0xE6, 0x96,
+  0x36, 0xA7, 0x1A, 0x6E, 0x3A, 0xCB, 0xD7, 0xD4, 0x4C, 0x8F, 0x93, 0x16, 0xA9, 0xBE, 0x6D, 0x7B,
+  0x9E, 0xD0, 0x2D, 0x5B, 0x2A, 0x97, 0x4B, 0x4F, 0x06, 0x6C, 0xF5, 0x30, 0x5E, 0x64, 0x9B, 0x78,
+  0x20, 0x8B, 0x30, 0x8F, 0x9B, 0x43, 0xBA, 0xEC, 0xA0, 0x4D, 0x2B, 0xAB, 0xEC, 0x5D, 0xBD, 0x3F,
+  0xAA, 0x67, 0x68, 0x6B, 0xD4, 0x49, 0x71, 0x9C, 0xD6, 0xA9, 0x8F, 0xEA, 0x43, 0x67, 0xBB, 0xA1,
+  0xF9, 0x1A, 0x9A, 0x25, 0x94, 0xAE, 0xD9, 0x4A, 0x4E, 0x06, 0x34, 0x7D, 0xF0, 0x5A, 0xB5, 0xC2,
+  0xC0, 0x14, 0x7C, 0x79, 0xCD, 0x4B, 0xAA, 0xC6, 0xF9, 0xB6, 0x2F, 0xB6, 0xD0, 0x8C, 0x2D, 0xD4,
+  0xEF, 0x3B, 0x78, 0xD3, 0x55, 0xF6, 0x3D, 0x61, 0x52, 0x4F, 0x8D, 0xBC, 0x4D, 0xB2, 0xBE, 0xD9,
+  0x66, 0x2D, 0x21, 0x45, 0xF7, 0x53, 0x03, 0xDC, 0x49, 0xD6, 0xEF, 0xD4, 0x56, 0xA6, 0x5F, 0x32,
+  0x7B, 0x89, 0x75, 0x36, 0x53, 0x2B, 0x6F, 0xDB, 0x4E, 0x16, 0xAF, 0xD1, 0xD4, 0x49, 0x9B, 0x59,
+  0x1B, 0xF7, 0xED, 0x41, 0xCA, 0x64, 0x97, 0xCD, 0x1E, 0x9D, 0x49, 0xE8, 0xF4, 0x9E, 0x66, 0x85,
+  0xC6, 0xC4, 0xD0, 0x8B, 0xCA, 0x72, 0xD3, 0x75, 0x05, 0xC9, 0x1F, 0xAA, 0x59, 0x71, 0x6D, 0x8F,
+  0xBC, 0xE5, 0x4A, 0xC5, 0xD9, 0x99, 0x51, 0x6A, 0x17, 0x17, 0x1D, 0x59, 0x1F, 0xF6, 0x96, 0xFD,
+  0x75, 0x17, 0x0F, 0x73, 0x7A, 0x9A, 0x4D, 0x2F, 0x2C, 0xEC, 0x0D, 0x93, 0x55, 0x96, 0xF3, 0xBA,
+  0x9A, 0xA4, 0x8C, 0x78, 0x48, 0x54, 0xA6, 0xCE, 0x22, 0x23, 0x88, 0x72, 0x21, 0xCD, 0x6F, 0x6B,
+  0xE9, 0xEC, 0x64, 0x56, 0x6B, 0x4F, 0xCC, 0xFA, 0x86, 0x6D, 0xE2, 0xCD, 0x8A, 0x4F, 0x41, 0x8C,
+  0xD7, 0xAE, 0xA2, 0xE2, 0x10, 0x34, 0xF6, 0xBE, 0xD3, 0x02, 0xBC, 0xE9, 0xDE, 0x12, 0xF7, 0x9A,
+  0x52, 0x76, 0x9D, 0x54, 0x50, 0xBA, 0xB5, 0x54, 0xB8, 0x74, 0xD7, 0xC9, 0x34, 0x52, 0x4D, 0xA7,
+  0xBC, 0x28, 0xBA, 0xC9, 0xC3, 0x60, 0xC5, 0x66, 0x32, 0x20, 0x6E, 0x9C, 0x57, 0xDB, 0xB0, 0x35,
+  0xAB, 0xE5, 0x99, 0x93, 0x59, 0x4E, 0xEB, 0xB0, 0x2D, 0xB3, 0x33, 0xD1, 0xBA, 0x9D, 0xDC, 0x62,
+  0xCF, 0x4D, 0x2B, 0x46, 0x65, 0x54, 0xC0, 0x6B, 0x2F, 0x87, 0x12, 0x15, 0x93, 0x2D, 0xE1, 0xCD,
+  0x98, 0xBF, 0xEF, 0xF8, 0xE5, 0x9E, 0x93, 0xE9, 0x83, 0x4F, 0x4D, 0x37, 0x2A, 0xE5, 0xF1, 0xC2,
+  0xA9, 0xA5, 0x12, 0xB3, 0x0E, 0x46, 0x45, 0x30, 0xEE, 0x15, 0x77, 0x33, 0x6E, 0x8E, 0xEE, 0x97,
+  0xB5, 0xEE, 0x58, 0x98, 0x38, 0x6D, 0xB7, 0xDB, 0x95, 0x3B, 0x66, 0x5D, 0xC2, 0xA8, 0x3A, 0xA1,
+  0x95, 0xDE, 0xC4, 0x1D, 0x67, 0xB2, 0x28, 0x47, 0xCF, 0x5A, 0xE3, 0x7E, 0x8D, 0xCE, 0xB8, 0xF6,
+  0xBC, 0xBC, 0xDB, 0x4D, 0x76, 0xCA, 0x66, 0x3D, 0xDB, 0x4E, 0x66, 0x23, 0x65, 0x3A, 0x93, 0x77,
+  0xE0, 0x89, 0x06, 0x13, 0x2D, 0xA3, 0x61, 0xD3, 0x19, 0xB6, 0xA6, 0x59, 0x10, 0xC1, 0xE2, 0x8C,
+  0xEF, 0xF6, 0x4A, 0x99, 0x00, 0x06, 0xCA, 0x6E, 0x53, 0x4B, 0x13, 0x75, 0x4B, 0x5E, 0x21, 0xBD,
+  0x1B, 0x8A, 0x96, 0x97, 0xD6, 0x0A, 0x9D, 0xDD, 0x64, 0xA6, 0x75, 0xDC, 0x5A, 0x67, 0xBF, 0xE7,
+  0x96, 0x86, 0x2A, 0x74, 0x14, 0x7E, 0xCF, 0xAE, 0x0F, 0x13, 0x8F, 0x6F, 0xD4, 0xE6, 0x0D, 0xBE,
+  0x25, 0x88, 0x8D, 0x64, 0xAB, 0xCC, 0x61, 0x69, 0x72, 0x28, 0xE1, 0x5C, 0x72, 0xAA, 0xF8, 0x7A,
+  0xB7, 0x6A, 0xCC, 0x7D, 0xB3, 0xD6, 0x6F, 0xFB, 0x55, 0xCE, 0x28, 0xCC, 0x34, 0xC9, 0xAD, 0xDD,
+  0xAD, 0x4D, 0x69, 0x5D, 0xD6, 0xAB, 0x1B, 0xB5, 0xD5, 0xF3, 0xC5, 0x9C, 0xD8, 0x5C, 0x38, 0x08,
+  0x9E, 0xDF, 0x59, 0xC9, 0x41, 0x43, 0xDF, 0x2C, 0xCD, 0x3B, 0xBE, 0x52, 0x4C, 0xB5, 0xDA, 0xDD,
+  0x71, 0x6E, 0xCB, 0x96, 0x36, 0x58, 0x18, 0xB9, 0x0B, 0xBD, 0x95, 0xF5, 0x86, 0xBE, 0xBB, 0x4B,
+  0x0A, 0xC8, 0x18, 0xEF, 0x4B, 0x83, 0xE6, 0x61, 0xC9, 0xAA, 0xDE, 0xB0, 0x4F, 0xDF, 0x1F, 0xD4,
+  0xED, 0x8E, 0x48, 0x81, 0x37, 0xA3, 0x51, 0x67, 0xB9, 0x75, 0x7D, 0x5C, 0x28, 0x8D, 0x5C, 0xB6,
+  0xB7, 0xEC, 0xC8, 0x65, 0xBE, 0x38, 0xA0, 0xA5, 0x89, 0xAB, 0xEE, 0x24, 0x6D, 0xAA, 0xEE, 0xD7,
+  0x6C, 0xD3, 0xE5, 0x67, 0x77, 0x69, 0x7E, 0x81, 0xB1, 0x5F, 0x60, 0x95, 0xE4, 0x04, 0x0D, 0x05,
+  0x7E, 0xEE, 0xD4, 0x07, 0x42, 0x99, 0x0B, 0xE7, 0xF6, 0xCE, 0x5B, 0x76, 0x6B, 0x1A, 0x4D, 0xD7,
+  0xF7, 0x5E, 0xA1, 0x5E, 0xEE, 0xF6, 0xB1, 0xEF, 0x64, 0xEB, 0x4B, 0xD4, 0x91, 0x8C, 0xC5, 0xA6,
+  0x2E, 0xB2, 0xFE, 0x9A, 0x1E, 0x4D, 0xFA, 0xCE, 0x3C, 0x55, 0xAC, 0x95, 0xF7, 0x2D, 0xA9, 0x5E,
+  0x5B, 0x75, 0x56, 0x63, 0x45, 0xDF, 0xEB, 0x1C, 0x76, 0xC5, 0x84, 0x58, 0x77, 0xB1, 0x28, 0x6D,
+  0x9A, 0xE9, 0x6A, 0x67, 0x3F, 0xAC, 0xDB, 0x10, 0x5A, 0x57, 0xF1, 0xBD, 0x7F, 0xB7, 0x1E, 0x94,
+  0x7C, 0xE0, 0x95, 0x61, 0xD3, 0x1B, 0xDC, 0xCF, 0x35, 0x5C, 0x47, 0x06, 0x37, 0x28, 0xCE, 0xD2,
+  0xC9, 0xC3, 0x3C, 0x0D, 0x7D, 0x36, 0x63, 0xD6, 0xE8, 0xD0, 0x58, 0xA4, 0xD3, 0x29, 0x29, 0xA7,
+  0x76, 0x30, 0x2F, 0xD0, 0xF3, 0xCA, 0x30, 0xBD, 0xD9, 0x37, 0x72, 0xD2, 0xCE, 0x58, 0x16, 0x92,
+  0x95, 0x5D, 0x62, 0xE3, 0x25, 0x0C, 0x77, 0xEF, 0x36, 0xD4, 0x43, 0x3D, 0x89, 0xC4, 0x15, 0x9A,
+  0x67, 0xE7, 0xDD, 0xD4, 0x61, 0x74, 0x40, 0x33, 0xB1, 0x87, 0x51, 0x0B, 0x95, 0x46, 0xEC, 0xC2,
+  0x46, 0xA2, 0xD2, 0xDA, 0x0E, 0x67, 0x53, 0x95, 0xB3, 0x71, 0x59, 0x56, 0x41, 0x3D, 0xBC, 0xB6,
+  0x90, 0xB9, 0x5B, 0x6C, 0xA4, 0x7B, 0x3E, 0x73, 0x50, 0x9C, 0x92, 0xE2, 0x74, 0x8C, 0xA9, 0x34,
+  0xF2, 0xB8, 0x54, 0x9D, 0xD7, 0x4B, 0x12, 0x1A, 0x4E, 0x3A, 0xFB, 0xC6, 0xB0, 0xA0, 0xF7, 0xD3,
+  0x13, 0x33, 0xBD, 0xF1, 0xB4, 0xFE, 0xC6, 0x2F, 0x71, 0x42, 0xAF, 0x57, 0x90, 0x30, 0xB6, 0xA7,
+  0x1B, 0x9C, 0x2A, 0xF3, 0xAB, 0x8D, 0xDD, 0xA3, 0xAB, 0xB3, 0x89, 0x6D, 0xF7, 0x37, 0xBB, 0xF9,
+  0xBC, 0x61, 0x1E, 0xEE, 0xA6, 0xAE, 0xD9, 0x65, 0x0D, 0xEE, 0x5E, 0xE1, 0xDD, 0x31, 0xBE, 0x93,
+  0x93, 0x7A, 0x29, 0x93, 0x6B, 0x36, 0x17, 0x87, 0x7D, 0x71, 0x5A, 0xEA, 0xDE, 0xB3, 0xB9, 0xDA,
+  0xA8, 0xBF, 0x98, 0xEF, 0xF6, 0x5E, 0xD6, 0x6D, 0xF9, 0x9D, 0xE2, 0xB6, 0x38, 0x99, 0xB7, 0x26,
+  0x43, 0x75, 0xEA, 0x5A, 0xD6, 0xAA, 0x27, 0x70, 0x8A, 0xB4, 0x6F, 0xAD, 0x2B, 0x4A, 0x86, 0xDB,
+  0x4D, 0xE7, 0x9C, 0x3B, 0x43, 0xF4, 0x84, 0x4F, 0xD2, 0x5A, 0x9A, 0xB7, 0x1D, 0xB9, 0xC6, 0x8D,
+  0x1B, 0x1E, 0xBF, 0xC9, 0xC9, 0x4D, 0x7C, 0xA8, 0x6F, 0xB2, 0x6D, 0x69, 0x62, 0x8F, 0x95, 0xE9,
+  0x50, 0xB7, 0x76, 0xF5, 0x0E, 0x4F, 0x6F, 0xF6, 0x42, 0x7D, 0x9A, 0x5D, 0x1E, 0xEA, 0x72, 0xB5,
+  0xEE, 0x8B, 0x72, 0x49, 0x40, 0x15, 0x8F, 0xCF, 0x8D, 0x91, 0x2B, 0x1C, 0xFC, 0x86, 0x57, 0xA2,
+  0x7D, 0x0E, 0x5B, 0x4B, 0xB3, 0xDC, 0xF4, 0xB2, 0xC9, 0xED, 0x44, 0xE4, 0xD9, 0x66, 0x62, 0x6B,
+  0xA5, 0x78, 0x21, 0xD7, 0x6F, 0x7A, 0x7B, 0x73, 0x3A, 0xF2, 0x3A, 0xAB, 0xCA, 0xD0, 0xD1, 0x27,
+  0xCB, 0x29, 0xBF, 0x58, 0xB7, 0xEB, 0x2B, 0xD5, 0xBB, 0x93, 0xAA, 0x36, 0x12, 0x46, 0xAA, 0x5D,
+  0xE0, 0x55, 0xAB, 0x53, 0xC9, 0xED, 0x57, 0x7C, 0x4B, 0xDA, 0xA4, 0x4B, 0xD3, 0xDE, 0xF4, 0xAE,
+  0xE4, 0x97, 0xE1, 0xD9, 0x44, 0x9D, 0x15, 0x33, 0x6B, 0x9C, 0xE1, 0xD7, 0xFB, 0x6D, 0xFF, 0x50,
+  0x17, 0x67, 0xCB, 0x34, 0x97, 0x34, 0xFB, 0x99, 0x44, 0x6E, 0x42, 0x8F, 0xA7, 0x6E, 0xBA, 0xBD,
+  0x54, 0xFA, 0x8A, 0x9E, 0x16, 0xD7, 0xF7, 0xBD, 0xE9, 0x22, 0x23, 0xCB, 0x9D, 0xA4, 0x89, 0xD9,
+  0x74, 0x2D, 0x37, 0xCF, 0x9A, 0x23, 0x6F, 0xCC, 0xD6, 0x37, 0xAE, 0x92, 0xAD, 0xB3, 0x3B, 0xBC,
+  0xEB, 0x17, 0xEB, 0x46, 0x8D, 0xAB, 0xE2, 0xC2, 0x68, 0xDC, 0x19, 0x1C, 0x16, 0xD6, 0x44, 0x4D,
+  0xFB, 0xF5, 0x79, 0x6A, 0xE2, 0xCE, 0x86, 0x2E, 0x6E, 0xB6, 0xD2, 0xB6, 0x72, 0x38, 0xF0, 0x03,
+  0x61, 0x62, 0xAB, 0x83, 0xF2, 0x5C, 0x28, 0x56, 0x06, 0xAD, 0xED, 0x9D, 0xDB, 0xDD, 0x35, 0x44,
+  0xE3, 0x0E, 0xF9, 0x95, 0x5C, 0x67, 0xB0, 0x77, 0x3D, 0x33, 0x97, 0x1A, 0x94, 0xFA, 0xFD, 0x06,
+  0x6E, 0x8A, 0x8A, 0x67, 0x2D, 0x36, 0x63, 0xC9, 0x17, 0xD5, 0xBD, 0x95, 0xCB, 0x34, 0x5B, 0xD9,
+  0xD9, 0x61, 0x75, 0xCF, 0xF6, 0xD4, 0x49, 0xD2, 0x59, 0x15, 0x64, 0x3F, 0x29, 0xDE, 0xA3, 0xD4,
+  0x18, 0x19, 0xBE, 0xA4, 0x34, 0x2B, 0xF5, 0xDD, 0xA0, 0xE2, 0xB7, 0xF0, 0xA1, 0x5D, 0xE3, 0x2B,
+  0xB3, 0x43, 0x69, 0xC9, 0x6F, 0x0C, 0xB1, 0xE8, 0x4A, 0x33, 0x59, 0xCD, 0x70, 0xAE, 0x5B, 0xA7,
+  0xAB, 0x55, 0x93, 0x1B, 0x29, 0x63, 0xB5, 0x64, 0x4C, 0x07, 0x53, 0x7F, 0x83, 0x27, 0x0B, 0xB6,
+  0xC6, 0xEF, 0x37, 0xBD, 0x6D, 0xB5, 0xEE, 0x4D, 0x1A, 0x59, 0x61, 0x7F, 0xB7, 0xE9, 0xEB, 0x45,
+  0x68, 0x83, 0x2A, 0x3C, 0x04, 0x19, 0x26, 0xA7, 0xAD, 0x7B, 0xA0, 0xA3, 0xB4, 0x25, 0x35, 0xD3,
+  0x23, 0x0C, 0xA1, 0x12, 0x84, 0x07, 0x3E, 0x2F, 0x16, 0x09, 0x9E, 0xED, 0x3D, 0x52, 0x87, 0x16,
+  0x9B, 0xD6, 0xF6, 0xB4, 0x9F, 0x18, 0x4C, 0xF8, 0x44, 0xB2, 0x5C, 0x4B, 0x89, 0x74, 0xB5, 0x1E,
+  0x8C, 0x9B, 0x4B, 0xE7, 0xEE, 0xE4, 0x96, 0xB0, 0x15, 0xD3, 0x6D, 0x9D, 0xB3, 0xD6, 0x9D, 0x11,
+  0x2D, 0xCE, 0x87, 0x4E, 0x57, 0xDF, 0x48, 0xBC, 0x36, 0x47, 0x9A, 0xCD, 0x57, 0xFA, 0x39, 0x69,
+  0xE8, 0x2D, 0x79, 0x96, 0x3E, 0x0C, 0xB7, 0xBE, 0xBA, 0x29, 0x4B, 0xE0, 0xA2, 0x6A, 0xF5, 0x5D,
+  0x6B, 0xAD, 0xB5, 0x39, 0xA1, 0xD1, 0x5B, 0x17, 0xED, 0xAC, 0xE2, 0xAF, 0xCA, 0xC2, 0x7E, 0xA1,
+  0x95, 0x2B, 0xF2, 0xBD, 0xB6, 0x65, 0xE5, 0xED, 0x1E, 0xF5, 0xEE, 0x7C, 0xA1, 0x28, 0xFB, 0x03,
+  0x35, 0xC7, 0x4F, 0xD6, 0x9D, 0xDC, 0x64, 0xA3, 0x57, 0xF9, 0x7E, 0x6F, 0x56, 0xF4, 0x2A, 0x8B,
+  0x74, 0x52, 0x50, 0x45, 0x39, 0xE5, 0xAF, 0x93, 0x15, 0xAD, 0x5B, 0xD2, 0xB6, 0x59, 0x47, 0x96,
+  0x67, 0x7C, 0xBB, 0x9C, 0x6A, 0x88, 0xDD, 0xD4, 0xAE, 0x5E, 0x9A, 0x83, 0x09, 0x9C, 0x69, 0x3E,
+  0x5D, 0x2B, 0x16, 0xDB, 0x55, 0x7E, 0x25, 0x56, 0x3B, 0x6C, 0xB1, 0x91, 0x30, 0x16, 0xE0, 0xC7,
+  0xEE, 0xB3, 0xA3, 0x5E, 0xD6, 0xA9, 0xAC, 0xCB, 0x2B, 0x6B, 0xB9, 0xBC, 0xEB, 0x94, 0x0B, 0xFE,
+  0x56, 0x73, 0xA4, 0x44, 0x57, 0x2D, 0x7A, 0xDE, 0x22, 0xC5, 0x6B, 0xFE, 0x1C, 0xF0, 0xE3, 0xCB,
+  0xA3, 0xCE, 0x0C, 0xE5, 0xD2, 0x96, 0xB7, 0x31, 0x12, 0x6D, 0xDA, 0xF0, 0xD4, 0xA5, 0xA2, 0x94,
+  0x9B, 0xF7, 0x85, 0xBB, 0x32, 0x3B, 0xEF, 0x2C, 0x72, 0xC3, 0x51, 0x6D, 0xC9, 0x4A, 0xCA, 0x24,
+  0x37, 0xEB, 0xE5, 0xFC, 0x3A, 0xEB, 0x65, 0xEA, 0x6E, 0x73, 0x54, 0xDE, 0x58, 0x07, 0x89, 0xF5,
+  0xA6, 0xB6, 0xCE, 0x6F, 0x4B, 0x60, 0x63, 0xF6, 0xAE, 0x2D, 0xDB, 0x05, 0x69, 0xD9, 0xCC, 0x55,
+  0x59, 0xD5, 0x76, 0x97, 0x8B, 0x54, 0x81, 0xAD, 0x2B, 0xC9, 0xAE, 0x79, 0xDF, 0xFF, 0x95, 0x99,
+  0x4C, 0xA9, 0xC4, 0x56, 0xE8, 0x42, 0xA1, 0x5F, 0x5E, 0x8F, 0x73, 0x4D, 0x73, 0x9A, 0x63, 0xB9,
+  0x4E, 0x00, 0xBF, 0x78, 0x37, 0x18, 0xA7, 0x2A, 0x78, 0x75, 0xA7, 0x69, 0xDA, 0xED, 0x2D, 0x59,
+  0x1E, 0x3A, 0x7F, 0x4F, 0x4B, 0x5E, 0x7E, 0xE7, 0x78, 0xCF, 0x37, 0xF9, 0x2A, 0x59, 0x97, 0xBB,
+  0x09, 0xEB, 0xBD, 0xC7, 0x37, 0xEA, 0x84, 0x2B, 0xB5, 0x57, 0xF3, 0xD7, 0x15, 0xF3, 0xF8, 0xFC,
+  0x8E, 0xB9, 0xBC, 0x74, 0xF6, 0xE2, 0x9A, 0xD8, 0xEB, 0xE1, 0x99, 0x8B, 0xF7, 0xF9, 0xE5, 0x9D,
+  0xB7, 0xE8, 0x28, 0x71, 0xE5, 0x3C, 0xB9, 0x8E, 0x5A, 0xB7, 0xDF, 0x18, 0xEB, 0xF8, 0x62, 0x1D,
+  0xC4, 0xB8, 0x90, 0x9E, 0x9F, 0xEA, 0x8E, 0xC1, 0x2A, 0x77, 0x58, 0x22, 0xF8, 0xE3, 0x12, 0x1F,
+  0x85, 0xBC, 0x05, 0x29, 0xD8, 0xCB, 0x77, 0x6A, 0x40, 0xA3, 0xE3, 0xDB, 0x6E, 0x9E, 0x77, 0xDF,
+  0xA1, 0xF8, 0xF3, 0x35, 0x30, 0x29, 0x7C, 0xBF, 0xCF, 0xDB, 0xB7, 0x1B, 0x29, 0xC1, 0x8B, 0x11,
+  0xB1, 0xB5, 0xCE, 0x53, 0xFF, 0x9F, 0x02, 0x62, 0x4E, 0x45, 0xCF, 0xF0, 0xB0, 0xBC, 0xD3, 0x69,
+  0x7B, 0x6F, 0x4F, 0xF8, 0x2B, 0x03, 0x47, 0xB4, 0xE3, 0x8B, 0x43, 0x99, 0x05, 0xB0, 0xC6, 0x40,
+  0x45, 0x2D, 0x2C, 0xBF, 0xE2, 0xA0, 0xFD, 0xF1, 0xAD, 0x36, 0xE4, 0x15, 0x6B, 0x7A, 0x9C, 0xBC,
+  0x22, 0xC8, 0x54, 0x10, 0x8E, 0x5E, 0x02, 0xD9, 0x5E, 0xAD, 0xAA, 0x6B, 0x57, 0x9F, 0xC8, 0xDF,
+  0x5B, 0x84, 0x78, 0xC5, 0xDB, 0x6B, 0x4C, 0x3B, 0x31, 0x98, 0x09, 0xB1, 0x22, 0x4B, 0xF4, 0x97,
+  0x4D, 0xE7, 0x27, 0x6A, 0x31, 0xA9, 0xB3, 0x3E, 0x3E, 0x31, 0x28, 0xF6, 0xB6, 0xE4, 0x7D, 0xC6,
+  0x3A, 0xF6, 0x82, 0x75, 0xCF, 0x6F, 0xF9, 0xA5, 0xCE, 0x8A, 0xCB, 0x2F, 0x65, 0x2C, 0x0D, 0x9D,
+  0x8A, 0x4C, 0xC5, 0x7D, 0x43, 0x89, 0x52, 0xD8, 0xB2, 0x5C, 0x52, 0xAD, 0x63, 0xB2, 0xFC, 0x9B,
+  0x57, 0xFF, 0xC2, 0x4D, 0xE1, 0xBD, 0x9B, 0x6F, 0x5F, 0x12, 0xFC, 0xF4, 0xC4, 0x7C, 0xFD, 0xCA,
+  0xE5, 0x52, 0x0C, 0xC7, 0x24, 0x1F, 0x1E, 0x1E, 0x62, 0x5F, 0xFE, 0x0B, 0xF7, 0xA5, 0x34, 0x28,
+  0xAF, 0x78, 0x00, 0x00
 };
 
-const unsigned long js_main_buff_size = sizeof(js_main_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page main java script resources, 30895 bytes (gzip 7828 bytes) */
+const web_res_t js_main_res =
+{
+  NULL,
+  0U,
+  js_main_buff_gz,
+  sizeof(js_main_buff_gz),
+  NULL,
+  "\"79579538fa211468-gz\""
+};
@@ -2,7 +2,7 @@
   **********************************************************************************************************************
   * @file    js_main_res.h
   * @author  MCD Application Team
-  * @brief   This file implements the web page main java script resources
+  * @brief   header file for js_main_res.c
   **********************************************************************************************************************
   * @attention
   *
@@ -21,1939 +21,7 @@
 #define JS_MAIN_RES_H
 
 /* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page main java script resources buffer */
-static const char js_main_buff[] =
-{
-  0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x22, 0x77, 0x65, 0x62, 0x70, 0x61, 0x63, 0x6B, 0x4A, 0x73,
-  0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61, 0x63, 0x6B, 0x2D, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61,
-  0x72, 0x64, 0x2D, 0x72, 0x65, 0x61, 0x63, 0x74, 0x22, 0x5D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B,
-  0x22, 0x77, 0x65, 0x62, 0x70, 0x61, 0x63, 0x6B, 0x4A, 0x73, 0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61,
-  0x63, 0x6B, 0x2D, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2D, 0x72, 0x65, 0x61,
-  0x63, 0x74, 0x22, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x5B,
-  0x5B, 0x30, 0x5D, 0x2C, 0x7B, 0x31, 0x39, 0x35, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-  0x6E, 0x28, 0x65, 0x2C, 0x74, 0x2C, 0x61, 0x29, 0x7B, 0x22, 0x75, 0x73, 0x65, 0x20, 0x73, 0x74,
-  0x72, 0x69, 0x63, 0x74, 0x22, 0x3B, 0x61, 0x2E, 0x72, 0x28, 0x74, 0x29, 0x3B, 0x76, 0x61, 0x72,
-  0x20, 0x72, 0x3D, 0x61, 0x28, 0x37, 0x37, 0x29, 0x2C, 0x6F, 0x3D, 0x61, 0x28, 0x32, 0x29, 0x2C,
-  0x6E, 0x3D, 0x61, 0x2E, 0x6E, 0x28, 0x6F, 0x29, 0x2C, 0x73, 0x3D, 0x61, 0x28, 0x33, 0x30, 0x29,
-  0x2C, 0x69, 0x3D, 0x61, 0x2E, 0x6E, 0x28, 0x73, 0x29, 0x2C, 0x63, 0x3D, 0x61, 0x28, 0x31, 0x37,
-  0x29, 0x2C, 0x64, 0x3D, 0x61, 0x28, 0x38, 0x29, 0x2C, 0x6C, 0x3D, 0x28, 0x61, 0x28, 0x38, 0x33,
-  0x29, 0x2C, 0x61, 0x28, 0x38, 0x34, 0x29, 0x2C, 0x61, 0x28, 0x38, 0x35, 0x29, 0x2C, 0x61, 0x28,
-  0x38, 0x36, 0x29, 0x2C, 0x61, 0x28, 0x39, 0x29, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-  0x62, 0x3D, 0x22, 0x22, 0x2C, 0x6A, 0x3D, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2D, 0x63, 0x6F,
-  0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x2C, 0x68, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x6F, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x29,
-  0x28, 0x7B, 0x74, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x62, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65,
-  0x54, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x7D, 0x7D, 0x29, 0x3B, 0x76,
-  0x61, 0x72, 0x20, 0x70, 0x3D, 0x61, 0x28, 0x30, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x20, 0x75, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x29, 0x28, 0x62, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C,
-  0x2E, 0x61, 0x29, 0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C,
-  0x6E, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74,
-  0x29, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x28, 0x72,
-  0x29, 0x7B, 0x63, 0x61, 0x73, 0x65, 0x20, 0x6A, 0x3A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-  0x74, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2D, 0x63, 0x6F, 0x6E, 0x74,
-  0x65, 0x6E, 0x74, 0x22, 0x29, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x63, 0x61, 0x73, 0x65,
-  0x20, 0x62, 0x3A, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-  0x65, 0x6E, 0x74, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69,
-  0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x77, 0x68, 0x69, 0x74, 0x65,
-  0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x5B, 0x72,
-  0x5D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x68, 0x2E, 0x50, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x72, 0x2C, 0x7B, 0x76, 0x61, 0x6C,
-  0x75, 0x65, 0x3A, 0x7B, 0x74, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x72, 0x2C, 0x63, 0x68, 0x61, 0x6E,
-  0x67, 0x65, 0x54, 0x68, 0x65, 0x6D, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-  0x28, 0x65, 0x29, 0x7B, 0x6E, 0x28, 0x65, 0x29, 0x7D, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x65, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x7D, 0x29,
-  0x7D, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x3D, 0x22, 0x62, 0x6C, 0x75, 0x65, 0x22, 0x2C,
-  0x66, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74,
-  0x65, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x29, 0x28, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x6D, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x65,
-  0x3D, 0x3E, 0x7B, 0x7D, 0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-  0x67, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x6F, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x28,
-  0x6D, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29,
-  0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x6E, 0x3D, 0x61,
-  0x5B, 0x31, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x66, 0x2E, 0x50, 0x72, 0x6F, 0x76, 0x69,
-  0x64, 0x65, 0x72, 0x2C, 0x7B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x72, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x6E, 0x28, 0x65, 0x29,
-  0x7D, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x65, 0x2E, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x7D, 0x29, 0x7D, 0x76, 0x61, 0x72, 0x20, 0x78, 0x3D, 0x61,
-  0x28, 0x32, 0x30, 0x29, 0x2C, 0x4F, 0x3D, 0x61, 0x28, 0x35, 0x29, 0x2C, 0x41, 0x3D, 0x61, 0x2E,
-  0x6E, 0x28, 0x4F, 0x29, 0x2C, 0x76, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x36, 0x29, 0x2C, 0x43, 0x3D,
-  0x61, 0x28, 0x31, 0x39, 0x37, 0x29, 0x2C, 0x79, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x38, 0x29, 0x2C,
-  0x4E, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x39, 0x29, 0x2C, 0x77, 0x3D, 0x61, 0x28, 0x32, 0x31, 0x31,
-  0x29, 0x2C, 0x53, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x30, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6B,
-  0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E,
-  0x73, 0x74, 0x20, 0x74, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x21, 0x31, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C,
-  0x2E, 0x61, 0x29, 0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C,
-  0x6F, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x72,
-  0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x63,
-  0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x3D, 0x69, 0x5B, 0x31, 0x5D, 0x3B, 0x6E, 0x2E, 0x61,
-  0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E,
-  0x28, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74,
-  0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65,
-  0x22, 0x2C, 0x62, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B,
-  0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65,
-  0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x72, 0x65, 0x73, 0x69,
-  0x7A, 0x65, 0x22, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x29, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-  0x20, 0x62, 0x3D, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x69,
-  0x6E, 0x6E, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3C, 0x39, 0x39, 0x33, 0x26, 0x26, 0x72,
-  0x3F, 0x64, 0x28, 0x22, 0x62, 0x67, 0x2D, 0x77, 0x68, 0x69, 0x74, 0x65, 0x22, 0x29, 0x3A, 0x64,
-  0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61,
-  0x72, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46,
-  0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x76, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41,
-  0x28, 0x29, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x61, 0x62, 0x73, 0x6F, 0x6C,
-  0x75, 0x74, 0x65, 0x22, 0x2C, 0x63, 0x29, 0x2C, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x3A, 0x22,
-  0x6C, 0x67, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x43, 0x2E, 0x61, 0x2C,
-  0x7B, 0x66, 0x6C, 0x75, 0x69, 0x64, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x77, 0x72, 0x61, 0x70,
-  0x70, 0x65, 0x72, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69,
-  0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28,
-  0x29, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65,
-  0x20, 0x64, 0x2D, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x22, 0x2C, 0x7B, 0x74, 0x6F, 0x67, 0x67,
-  0x6C, 0x65, 0x64, 0x3A, 0x65, 0x2E, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x4F, 0x70, 0x65,
-  0x6E, 0x65, 0x64, 0x7D, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x79, 0x2E,
-  0x61, 0x2C, 0x7B, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74, 0x6F, 0x67,
-  0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67,
-  0x67, 0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72, 0x20, 0x62, 0x61, 0x72, 0x31, 0x22, 0x7D, 0x29,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22,
-  0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72,
-  0x2D, 0x62, 0x61, 0x72, 0x20, 0x62, 0x61, 0x72, 0x32, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E,
-  0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61,
-  0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72,
-  0x20, 0x62, 0x61, 0x72, 0x33, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x4E, 0x2E, 0x61, 0x2C,
-  0x7B, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x3D, 0x3E, 0x65, 0x2E, 0x70, 0x72,
-  0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x65, 0x2E, 0x62, 0x72, 0x61, 0x6E, 0x64, 0x54,
-  0x65, 0x78, 0x74, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x79, 0x2E, 0x61, 0x2C, 0x7B, 0x6F, 0x6E, 0x43,
-  0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x64, 0x28, 0x72, 0x3F, 0x22, 0x6E,
-  0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E,
-  0x74, 0x22, 0x3A, 0x22, 0x62, 0x67, 0x2D, 0x77, 0x68, 0x69, 0x74, 0x65, 0x22, 0x29, 0x2C, 0x6F,
-  0x28, 0x21, 0x72, 0x29, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73,
-  0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A,
-  0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72, 0x2D,
-  0x62, 0x61, 0x72, 0x20, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x6B, 0x65, 0x62, 0x61, 0x62,
-  0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x6F, 0x67, 0x67,
-  0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72, 0x20, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x6B,
-  0x65, 0x62, 0x61, 0x62, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D,
-  0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x72, 0x2D, 0x62, 0x61, 0x72, 0x20, 0x6E, 0x61, 0x76, 0x62,
-  0x61, 0x72, 0x2D, 0x6B, 0x65, 0x62, 0x61, 0x62, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x77, 0x2E, 0x61,
-  0x2C, 0x7B, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x3A, 0x21, 0x30, 0x2C, 0x69, 0x73, 0x4F, 0x70,
-  0x65, 0x6E, 0x3A, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x53, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x3A, 0x21, 0x30, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x61, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6E, 0x61, 0x76, 0x62, 0x61, 0x72, 0x2D, 0x74, 0x65, 0x78,
-  0x74, 0x20, 0x6D, 0x78, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x62, 0x2D, 0x30, 0x20, 0x68,
-  0x31, 0x22, 0x2C, 0x68, 0x72, 0x65, 0x66, 0x3A, 0x22, 0x2E, 0x2F, 0x20, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x31, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x20, 0x57, 0x65, 0x62,
-  0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x44, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61,
-  0x74, 0x69, 0x6F, 0x6E, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29,
-  0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x42, 0x2C, 0x48, 0x3D, 0x61, 0x28,
-  0x32, 0x30, 0x31, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x54, 0x28,
-  0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x64, 0x2E, 0x67, 0x29, 0x28, 0x29, 0x2C, 0x61, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75,
-  0x73, 0x65, 0x52, 0x65, 0x66, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x3B, 0x6E, 0x2E, 0x61, 0x2E,
-  0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63, 0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x28,
-  0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F,
-  0x72, 0x6D, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22,
-  0x29, 0x3E, 0x2D, 0x31, 0x26, 0x26, 0x28, 0x42, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x78, 0x2E, 0x61,
-  0x28, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x73, 0x75, 0x70, 0x70,
-  0x72, 0x65, 0x73, 0x73, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x58, 0x3A, 0x21, 0x30, 0x2C, 0x73,
-  0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x59, 0x3A, 0x21,
-  0x31, 0x7D, 0x29, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B,
-  0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F,
-  0x72, 0x6D, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22,
-  0x29, 0x3E, 0x2D, 0x31, 0x26, 0x26, 0x42, 0x2E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x28,
-  0x29, 0x7D, 0x29, 0x29, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x3D, 0x65, 0x2E,
-  0x72, 0x6F, 0x75, 0x74, 0x65, 0x73, 0x2C, 0x6F, 0x3D, 0x65, 0x2E, 0x6C, 0x6F, 0x67, 0x6F, 0x3B,
-  0x6C, 0x65, 0x74, 0x20, 0x73, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x69, 0x3D, 0x6E, 0x75, 0x6C,
-  0x6C, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21,
-  0x3D, 0x3D, 0x6F, 0x26, 0x26, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x6F,
-  0x2E, 0x6F, 0x75, 0x74, 0x74, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x3F, 0x28, 0x73, 0x3D, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x61, 0x22,
-  0x2C, 0x7B, 0x68, 0x72, 0x65, 0x66, 0x3A, 0x6F, 0x2E, 0x6F, 0x75, 0x74, 0x74, 0x65, 0x72, 0x4C,
-  0x69, 0x6E, 0x6B, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73,
-  0x69, 0x6D, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2D,
-  0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x22, 0x2C, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x22,
-  0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A,
-  0x65, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x69, 0x6D,
-  0x67, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x69, 0x6D, 0x67, 0x22, 0x2C,
-  0x7B, 0x73, 0x72, 0x63, 0x3A, 0x6F, 0x2E, 0x69, 0x6D, 0x67, 0x53, 0x72, 0x63, 0x2C, 0x61, 0x6C,
-  0x74, 0x3A, 0x22, 0x53, 0x54, 0x5F, 0x6C, 0x6F, 0x67, 0x6F, 0x5F, 0x32, 0x30, 0x32, 0x30, 0x22,
-  0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x61, 0x22, 0x2C, 0x7B, 0x68, 0x72, 0x65, 0x66,
-  0x3A, 0x6F, 0x2E, 0x6F, 0x75, 0x74, 0x74, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x2C, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x2D,
-  0x74, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C,
-  0x22, 0x2C, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B,
-  0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74, 0x6F, 0x67, 0x67,
-  0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x6F, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x7D, 0x29, 0x29, 0x3A, 0x28, 0x73, 0x3D,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x63, 0x2E,
-  0x62, 0x2C, 0x7B, 0x74, 0x6F, 0x3A, 0x6F, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x4C, 0x69, 0x6E,
-  0x6B, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x6D,
-  0x70, 0x6C, 0x65, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x6E, 0x6F,
-  0x72, 0x6D, 0x61, 0x6C, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E,
-  0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73,
-  0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x69, 0x6D, 0x67, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x69, 0x6D, 0x67, 0x22, 0x2C, 0x7B, 0x73,
-  0x72, 0x63, 0x3A, 0x6F, 0x2E, 0x69, 0x6D, 0x67, 0x53, 0x72, 0x63, 0x2C, 0x61, 0x6C, 0x74, 0x3A,
-  0x22, 0x53, 0x54, 0x5F, 0x6C, 0x6F, 0x67, 0x6F, 0x5F, 0x32, 0x30, 0x32, 0x30, 0x22, 0x7D, 0x29,
-  0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x63, 0x2E, 0x62, 0x2C, 0x7B, 0x74, 0x6F, 0x3A, 0x6F, 0x2E, 0x69,
-  0x6E, 0x6E, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61,
-  0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x20,
-  0x6C, 0x6F, 0x67, 0x6F, 0x2D, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x22, 0x2C, 0x6F, 0x6E, 0x43,
-  0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64,
-  0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x6F, 0x2E,
-  0x74, 0x65, 0x78, 0x74, 0x7D, 0x29, 0x29, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x66, 0x2E, 0x43, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65,
-  0x72, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x28, 0x7B, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x6F, 0x7D, 0x29, 0x3D, 0x3E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72,
-  0x22, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x6F, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2D, 0x77, 0x72, 0x61, 0x70, 0x70,
-  0x65, 0x72, 0x22, 0x2C, 0x72, 0x65, 0x66, 0x3A, 0x61, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x73, 0x7C, 0x7C, 0x6E, 0x75,
-  0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x69, 0x3F, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6C, 0x6F, 0x67, 0x6F, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x73, 0x2C, 0x69, 0x5D, 0x7D, 0x29, 0x3A, 0x6E,
-  0x75, 0x6C, 0x6C, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x53, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x5B, 0x72, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x28, 0x28, 0x61, 0x2C, 0x72, 0x29, 0x3D, 0x3E,
-  0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73,
-  0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x28, 0x6F, 0x3D, 0x61, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x2C,
-  0x28, 0x74, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x3D, 0x3D, 0x6F, 0x3F,
-  0x22, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x3A, 0x22, 0x22, 0x29, 0x2B, 0x28, 0x61, 0x2E,
-  0x70, 0x72, 0x6F, 0x3F, 0x22, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x72, 0x6F,
-  0x22, 0x3A, 0x22, 0x22, 0x29, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x63,
-  0x2E, 0x63, 0x2C, 0x7B, 0x74, 0x6F, 0x3A, 0x61, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x2B,
-  0x61, 0x2E, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x69, 0x6E, 0x6B, 0x22, 0x2C, 0x61, 0x63, 0x74, 0x69,
-  0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x61, 0x63, 0x74,
-  0x69, 0x76, 0x65, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x65, 0x2E, 0x74,
-  0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x61, 0x2E, 0x69, 0x63, 0x6F, 0x6E, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x70, 0x22, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x61, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x2C, 0x72, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x7D, 0x29,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A,
-  0x22, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x72, 0x6F, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x48, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x70, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x65, 0x6C,
-  0x65, 0x63, 0x74, 0x72, 0x6F, 0x6E, 0x69, 0x63, 0x73, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29,
-  0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x54, 0x2E, 0x64, 0x65, 0x66,
-  0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x6F, 0x70, 0x73, 0x3D, 0x7B, 0x72, 0x74, 0x6C, 0x41, 0x63,
-  0x74, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x31, 0x2C, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x73, 0x3A, 0x5B,
-  0x7B, 0x7D, 0x5D, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x4C, 0x3D, 0x54, 0x2C, 0x52, 0x3D, 0x61,
-  0x28, 0x32, 0x30, 0x32, 0x29, 0x2C, 0x57, 0x3D, 0x61, 0x28, 0x32, 0x31, 0x32, 0x29, 0x2C, 0x71,
-  0x3D, 0x61, 0x28, 0x32, 0x30, 0x33, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x44, 0x3D, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
-  0x74, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x21,
-  0x31, 0x29, 0x2C, 0x61, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29,
-  0x28, 0x74, 0x2C, 0x32, 0x29, 0x2C, 0x72, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x6F, 0x3D, 0x61,
-  0x5B, 0x31, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x66, 0x69, 0x78, 0x65, 0x64,
-  0x2D, 0x70, 0x6C, 0x75, 0x67, 0x69, 0x6E, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x52, 0x2E, 0x61, 0x2C, 0x7B, 0x69, 0x73, 0x4F, 0x70, 0x65, 0x6E, 0x3A, 0x72, 0x2C, 0x74,
-  0x6F, 0x67, 0x67, 0x6C, 0x65, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x6F, 0x28, 0x21, 0x72, 0x29,
-  0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x57, 0x2E, 0x61, 0x2C, 0x7B, 0x74,
-  0x61, 0x67, 0x3A, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x66, 0x61, 0x20, 0x66, 0x61, 0x2D, 0x63, 0x6F, 0x67, 0x20, 0x66, 0x61, 0x2D, 0x32, 0x78, 0x22,
-  0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x73, 0x29, 0x28, 0x22, 0x75, 0x6C, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x3A, 0x22, 0x64, 0x72, 0x6F, 0x70, 0x64, 0x6F, 0x77, 0x6E, 0x2D, 0x6D, 0x65,
-  0x6E, 0x75, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x42, 0x41, 0x43, 0x4B, 0x47, 0x52,
-  0x4F, 0x55, 0x4E, 0x44, 0x20, 0x4D, 0x4F, 0x44, 0x45, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x61, 0x64, 0x6A, 0x75,
-  0x73, 0x74, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2D, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x74, 0x65, 0x78,
-  0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2D, 0x63,
-  0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x68, 0x2E,
-  0x43, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0x72, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x28, 0x7B, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x54, 0x68, 0x65, 0x6D, 0x65,
-  0x3A, 0x65, 0x7D, 0x29, 0x3D, 0x3E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x73, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6C, 0x6F,
-  0x72, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x22, 0x4C, 0x49, 0x47, 0x48, 0x54, 0x20, 0x4D, 0x4F, 0x44, 0x45, 0x22, 0x7D, 0x29,
-  0x2C, 0x22, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x71, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2D, 0x62, 0x61, 0x64, 0x67, 0x65, 0x20, 0x6D,
-  0x72, 0x2D, 0x32, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D,
-  0x3E, 0x65, 0x28, 0x6A, 0x29, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x71, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x64, 0x61, 0x72, 0x6B, 0x2D, 0x62,
-  0x61, 0x64, 0x67, 0x65, 0x20, 0x6D, 0x6C, 0x2D, 0x32, 0x22, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69,
-  0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x65, 0x28, 0x62, 0x29, 0x7D, 0x29, 0x2C, 0x22, 0x20,
-  0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x44, 0x41, 0x52, 0x4B, 0x20, 0x4D,
-  0x4F, 0x44, 0x45, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x22, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x50, 0x3D, 0x61, 0x2E, 0x70,
-  0x2B, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x2F, 0x46,
-  0x4C, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x2E, 0x6A, 0x70, 0x67, 0x22, 0x2C, 0x46, 0x3D,
-  0x61, 0x28, 0x32, 0x30, 0x34, 0x29, 0x2C, 0x45, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x35, 0x29, 0x2C,
-  0x58, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x36, 0x29, 0x2C, 0x56, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x37,
-  0x29, 0x2C, 0x47, 0x3D, 0x61, 0x28, 0x32, 0x30, 0x38, 0x29, 0x2C, 0x4D, 0x3D, 0x61, 0x28, 0x32,
-  0x30, 0x39, 0x29, 0x2C, 0x7A, 0x3D, 0x61, 0x28, 0x32, 0x31, 0x30, 0x29, 0x3B, 0x76, 0x61, 0x72,
-  0x20, 0x55, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
-  0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22,
-  0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22,
-  0x68, 0x33, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74,
-  0x65, 0x78, 0x74, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x20, 0x70, 0x72, 0x6F,
-  0x64, 0x75, 0x63, 0x74, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x4D, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C,
-  0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x22, 0x34,
-  0x30, 0x72, 0x65, 0x6D, 0x22, 0x7D, 0x2C, 0x73, 0x72, 0x63, 0x3A, 0x50, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x7A, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22,
-  0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32,
-  0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6F,
-  0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x64, 0x76, 0x61, 0x6E, 0x63, 0x65, 0x64, 0x20, 0x70,
-  0x6F, 0x77, 0x65, 0x72, 0x2D, 0x73, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x69, 0x63, 0x72,
-  0x6F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x62, 0x61,
-  0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x41, 0x72, 0x6D, 0x5C, 0x78, 0x61, 0x65, 0x20, 0x22,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22,
-  0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43, 0x6F, 0x72, 0x74, 0x65, 0x78, 0x5C,
-  0x78, 0x61, 0x65, 0x2D, 0x4D, 0x33, 0x33, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x74, 0x6F, 0x20,
-  0x6D, 0x65, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x64, 0x65,
-  0x6D, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x2F, 0x70, 0x65,
-  0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
-  0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x6D, 0x61, 0x72, 0x74,
-  0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x20, 0x69,
-  0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x65, 0x61, 0x72, 0x61, 0x62, 0x6C,
-  0x65, 0x73, 0x2C, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x64,
-  0x69, 0x63, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x73, 0x2C, 0x20, 0x68, 0x6F,
-  0x6D, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61,
-  0x6E, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x6C, 0x20, 0x73, 0x65,
-  0x6E, 0x73, 0x6F, 0x72, 0x73, 0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x4F, 0x66, 0x66, 0x65, 0x72,
-  0x69, 0x6E, 0x67, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x32, 0x20, 0x4D, 0x62, 0x79, 0x74,
-  0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x46, 0x6C, 0x61, 0x73, 0x68, 0x20, 0x28, 0x64, 0x75, 0x61,
-  0x6C, 0x20, 0x62, 0x61, 0x6E, 0x6B, 0x29, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x61,
-  0x6E, 0x64, 0x20, 0x37, 0x38, 0x36, 0x20, 0x4B, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66,
-  0x20, 0x53, 0x52, 0x41, 0x4D, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E,
-  0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C,
-  0x22, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x69, 0x63, 0x72,
-  0x6F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x73, 0x20, 0x74, 0x61, 0x6B,
-  0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x74,
-  0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C,
-  0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x54, 0x68, 0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22,
-  0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C, 0x22,
-  0x20, 0x6F, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20,
-  0x70, 0x6F, 0x72, 0x74, 0x66, 0x6F, 0x6C, 0x69, 0x6F, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x38,
-  0x20, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x73, 0x20, 0x28, 0x66, 0x72, 0x6F, 0x6D, 0x20,
-  0x34, 0x38, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x36, 0x39, 0x20, 0x70, 0x69, 0x6E, 0x73, 0x29, 0x20,
-  0x61, 0x6E, 0x64, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x75, 0x70, 0x20,
-  0x74, 0x6F, 0x20, 0x31, 0x32, 0x35, 0x5C, 0x78, 0x62, 0x30, 0x43, 0x20, 0x61, 0x6D, 0x62, 0x69,
-  0x65, 0x6E, 0x74, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2E,
-  0x22, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B,
-  0x6D, 0x64, 0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28,
-  0x58, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56, 0x2E, 0x61,
-  0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D,
-  0x31, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74,
-  0x61, 0x67, 0x3A, 0x22, 0x68, 0x33, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x22, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35,
-  0x20, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x7D,
-  0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x73, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x22, 0x68, 0x33, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x65, 0x31, 0x34, 0x65, 0x63, 0x61, 0x22, 0x7D,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x44, 0x65, 0x6D, 0x6F, 0x6E,
-  0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4F, 0x76, 0x65, 0x72, 0x76, 0x69, 0x65,
-  0x77, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x54, 0x68, 0x69, 0x73, 0x20, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x73,
-  0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20,
-  0x6F, 0x66, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65,
-  0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32,
-  0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x54, 0x4D,
-  0x33, 0x32, 0x43, 0x75, 0x62, 0x65, 0x55, 0x35, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x66, 0x69,
-  0x72, 0x6D, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 0x49, 0x74, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x73,
-  0x20, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x4D, 0x58, 0x5F, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x74,
-  0x6F, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x61, 0x20, 0x48, 0x54, 0x54, 0x50,
-  0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20,
-  0x53, 0x54, 0x4D, 0x33, 0x32, 0x20, 0x43, 0x75, 0x62, 0x65, 0x20, 0x48, 0x41, 0x4C, 0x2E, 0x20,
-  0x54, 0x68, 0x65, 0x20, 0x4D, 0x58, 0x5F, 0x57, 0x69, 0x46, 0x69, 0x20, 0x6D, 0x6F, 0x64, 0x75,
-  0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x57, 0x65, 0x62, 0x20, 0x62, 0x72, 0x6F,
-  0x77, 0x73, 0x65, 0x72, 0x20, 0x28, 0x47, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x20, 0x43, 0x68, 0x72,
-  0x6F, 0x6D, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x63, 0x61, 0x73, 0x65,
-  0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x77, 0x65, 0x62, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65,
-  0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x65, 0x62, 0x20, 0x70, 0x61, 0x67, 0x65,
-  0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x50, 0x43, 0x20, 0x61, 0x6E, 0x64,
-  0x20, 0x70, 0x68, 0x6F, 0x6E, 0x65, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x54, 0x68,
-  0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A,
-  0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32, 0x22,
-  0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x42, 0x2D, 0x55, 0x35,
-  0x38, 0x35, 0x49, 0x2D, 0x49, 0x4F, 0x54, 0x30, 0x32, 0x41, 0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20,
-  0x62, 0x6F, 0x61, 0x72, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x54, 0x54,
-  0x50, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73,
-  0x20, 0x64, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20,
-  0x49, 0x54, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
-  0x57, 0x65, 0x62, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63,
-  0x65, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x65, 0x61,
-  0x63, 0x68, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
-  0x74, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B,
-  0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66,
-  0x66, 0x38, 0x64, 0x37, 0x32, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x22, 0x42, 0x2D, 0x55, 0x35, 0x38, 0x35, 0x49, 0x2D, 0x49, 0x4F, 0x54, 0x30, 0x32, 0x41,
-  0x22, 0x7D, 0x29, 0x2C, 0x22, 0x20, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61,
-  0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x72,
-  0x65, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x20,
-  0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64,
-  0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E,
-  0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22,
-  0x75, 0x6C, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x6D, 0x62, 0x2D, 0x34, 0x20, 0x68, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32,
-  0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x38, 0x29, 0x22, 0x7D, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x57, 0x65, 0x62, 0x20, 0x70, 0x61,
-  0x67, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75,
-  0x65, 0x73, 0x74, 0x73, 0x20, 0x28, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2C,
-  0x20, 0x43, 0x53, 0x53, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x4A, 0x53, 0x20, 0x66,
-  0x69, 0x6C, 0x65, 0x73, 0x20, 0x2E, 0x2E, 0x2E, 0x29, 0x2E, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22,
-  0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32,
-  0x35, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x38, 0x29, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x73, 0x20, 0x76, 0x61, 0x6C,
-  0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x28, 0x54, 0x65,
-  0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
-  0x2C, 0x20, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
-  0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x76,
-  0x61, 0x6C, 0x75, 0x65, 0x73, 0x29, 0x2E, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x33, 0x22,
-  0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62, 0x2D,
-  0x31, 0x22, 0x2C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x65, 0x31, 0x34, 0x65, 0x63, 0x61, 0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x22, 0x44, 0x65, 0x6D, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x61, 0x74, 0x69,
-  0x6F, 0x6E, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x68, 0x34,
-  0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x62,
-  0x2D, 0x31, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x22, 0x49,
-  0x74, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x73, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65,
-  0x63, 0x65, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x20,
-  0x72, 0x65, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x65,
-  0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x73, 0x20,
-  0x6F, 0x6E, 0x20, 0x22, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x22, 0x73, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x7B, 0x73, 0x74, 0x79, 0x6C, 0x65,
-  0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x66, 0x38, 0x64, 0x37, 0x32,
-  0x22, 0x7D, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x42, 0x2D, 0x55,
-  0x35, 0x38, 0x35, 0x49, 0x2D, 0x49, 0x4F, 0x54, 0x30, 0x32, 0x41, 0x22, 0x7D, 0x29, 0x2C, 0x22,
-  0x20, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2E, 0x22, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x72, 0x65, 0x65, 0x20,
-  0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
-  0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61,
-  0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3A, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x6F, 0x6C, 0x22, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x75, 0x63,
-  0x63, 0x65, 0x73, 0x73, 0x20, 0x68, 0x34, 0x20, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x20, 0x54, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61,
-  0x74, 0x75, 0x72, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x22, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34,
-  0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61,
-  0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20,
-  0x69, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-  0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x54, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
-  0x72, 0x65, 0x20, 0x6D, 0x65, 0x6E, 0x75, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x70,
-  0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x64,
-  0x65, 0x20, 0x62, 0x61, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x66,
-  0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2E, 0x20,
-  0x54, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61,
-  0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74,
-  0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
-  0x72, 0x65, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
-  0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69,
-  0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20,
-  0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64,
-  0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E,
-  0x65, 0x6C, 0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74,
-  0x61, 0x20, 0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67,
-  0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D,
-  0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x68, 0x34, 0x20, 0x6D, 0x62, 0x2D, 0x31, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x20, 0x50, 0x72, 0x65, 0x73,
-  0x73, 0x75, 0x72, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x22, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34,
-  0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65,
-  0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x63, 0x71, 0x75,
-  0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20,
-  0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67,
-  0x20, 0x6F, 0x6E, 0x20, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x6E,
-  0x75, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20,
-  0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x62, 0x61, 0x72, 0x20,
-  0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74,
-  0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x64, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66,
-  0x20, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73,
-  0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79,
-  0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63,
-  0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
-  0x61, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x62, 0x75, 0x74,
-  0x74, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74,
-  0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C, 0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20,
-  0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20,
-  0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x22,
-  0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x22, 0x6C, 0x69, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x68,
-  0x34, 0x20, 0x6D, 0x62, 0x2D, 0x31, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x22, 0x20, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65, 0x6E, 0x73,
-  0x6F, 0x72, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x76, 0x69, 0x67, 0x61, 0x74, 0x69,
-  0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x6D, 0x69, 0x64, 0x69,
-  0x74, 0x79, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70,
-  0x61, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63,
-  0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x48, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x20, 0x6D, 0x65, 0x6E, 0x75, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61,
-  0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69,
-  0x64, 0x65, 0x20, 0x62, 0x61, 0x72, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65,
-  0x66, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x2E,
-  0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-  0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61,
-  0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x68, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79,
-  0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
-  0x64, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x69, 0x6E, 0x67,
-  0x20, 0x72, 0x65, 0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 0x6F, 0x6E,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73,
-  0x74, 0x6F, 0x70, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C,
-  0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
-  0x63, 0x75, 0x72, 0x76, 0x65, 0x73, 0x20, 0x64, 0x72, 0x61, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x77,
-  0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x68, 0x34, 0x22, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x68, 0x65, 0x20, 0x70,
-  0x65, 0x72, 0x69, 0x6F, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73, 0x69,
-  0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x68, 0x79,
-  0x73, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x71, 0x75, 0x61, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x6D,
-  0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x69, 0x73, 0x20, 0x31, 0x20, 0x73, 0x65, 0x63,
-  0x6F, 0x6E, 0x64, 0x2E, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x5D,
-  0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x51, 0x3D, 0x61, 0x28, 0x31, 0x39, 0x29, 0x2C,
-  0x49, 0x3D, 0x28, 0x61, 0x28, 0x34, 0x36, 0x29, 0x2C, 0x61, 0x28, 0x37, 0x35, 0x29, 0x29, 0x3B,
-  0x76, 0x61, 0x72, 0x20, 0x4B, 0x2C, 0x5F, 0x3D, 0x5B, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22,
-  0x2F, 0x68, 0x6F, 0x6D, 0x65, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x48, 0x6F, 0x6D,
-  0x65, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x5C, 0x75, 0x30, 0x36,
-  0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x31, 0x5C, 0x75,
-  0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x38, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x32,
-  0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66, 0x61, 0x73, 0x20, 0x66, 0x61, 0x2D, 0x68,
-  0x6F, 0x6D, 0x65, 0x22, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3A, 0x55,
-  0x2C, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x22,
-  0x7D, 0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72,
-  0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x54, 0x65, 0x6D,
-  0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x5C, 0x75, 0x30, 0x36, 0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C,
-  0x75, 0x30, 0x36, 0x33, 0x31, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34,
-  0x38, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x32, 0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66,
-  0x61, 0x73, 0x20, 0x66, 0x61, 0x2D, 0x74, 0x65, 0x6D, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72,
-  0x65, 0x2D, 0x6C, 0x6F, 0x77, 0x22, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74,
-  0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x74, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x6C, 0x65, 0x74, 0x20, 0x61, 0x3D, 0x7B, 0x69,
-  0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74,
-  0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28,
-  0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65,
-  0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30,
-  0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E,
-  0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29,
-  0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28,
-  0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32,
-  0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
-  0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B,
-  0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65,
-  0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35,
-  0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F,
-  0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75,
-  0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A,
-  0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69,
-  0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65,
-  0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E,
-  0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74,
-  0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66,
-  0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E,
-  0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F,
-  0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64,
-  0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65,
-  0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76,
-  0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78,
-  0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61,
-  0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73,
-  0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31,
-  0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72,
-  0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E,
-  0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A,
-  0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39,
-  0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B,
-  0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C,
-  0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x32, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21,
-  0x31, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D,
-  0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22,
-  0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65,
-  0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C,
-  0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72,
-  0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74,
-  0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32,
-  0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72,
-  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30,
-  0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53,
-  0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A,
-  0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C,
-  0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32,
-  0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
-  0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63,
-  0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64,
-  0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F,
-  0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35,
-  0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64,
-  0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64,
-  0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A,
-  0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72,
-  0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65,
-  0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65,
-  0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67,
-  0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A,
-  0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F,
-  0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73,
-  0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B,
-  0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61,
-  0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74,
-  0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64,
-  0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72,
-  0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30,
-  0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65,
-  0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D,
-  0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29,
-  0x7B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x65, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65,
-  0x71, 0x75, 0x65, 0x73, 0x74, 0x3B, 0x65, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-  0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x34, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x61, 0x64,
-  0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x26, 0x26, 0x32, 0x30, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E,
-  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x26, 0x26, 0x28, 0x74, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x73,
-  0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x7D, 0x2C, 0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x22,
-  0x47, 0x45, 0x54, 0x22, 0x2C, 0x22, 0x52, 0x65, 0x61, 0x64, 0x5F, 0x54, 0x65, 0x6D, 0x70, 0x65,
-  0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x65, 0x2E, 0x73, 0x65,
-  0x6E, 0x64, 0x28, 0x29, 0x7D, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x64,
-  0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28,
-  0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x64,
-  0x61, 0x74, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x78, 0x3A, 0x44, 0x61, 0x74, 0x65,
-  0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x2C, 0x79, 0x3A, 0x74, 0x7D, 0x29, 0x7D, 0x29, 0x29, 0x7D,
-  0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C,
-  0x73, 0x74, 0x6F, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65,
-  0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74,
-  0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E,
-  0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33,
-  0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28,
-  0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22,
-  0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70,
-  0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C,
-  0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65,
-  0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63,
-  0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62,
-  0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38,
-  0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68,
-  0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D,
-  0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65,
-  0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66,
-  0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35,
-  0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48,
-  0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F,
-  0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32,
-  0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69,
-  0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42,
-  0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F,
-  0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61,
-  0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74,
-  0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70,
-  0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65,
-  0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C,
-  0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35,
-  0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F,
-  0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62,
-  0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61,
-  0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E,
-  0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63,
-  0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65,
-  0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69,
-  0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41,
-  0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74,
-  0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65,
-  0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31,
-  0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65,
-  0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61,
-  0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73,
-  0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61,
-  0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B,
-  0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22,
-  0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x35, 0x30, 0x30, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A,
-  0x21, 0x30, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69,
-  0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
-  0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52,
-  0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28,
-  0x65, 0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65,
-  0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x7D, 0x3B, 0x63, 0x6F,
-  0x6E, 0x73, 0x74, 0x20, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x22, 0x29, 0x2C,
-  0x6F, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x72, 0x2C,
-  0x31, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61,
-  0x29, 0x28, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x3D,
-  0x69, 0x5B, 0x31, 0x5D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B, 0x64, 0x28, 0x65, 0x29, 0x7D,
-  0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74,
-  0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-  0x6E, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x78, 0x73,
-  0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x58, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x61,
-  0x72, 0x64, 0x2D, 0x63, 0x68, 0x61, 0x72, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x56, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C,
-  0x65, 0x66, 0x74, 0x22, 0x2C, 0x73, 0x6D, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68, 0x32, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x54, 0x65, 0x6D, 0x70, 0x65,
-  0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x68, 0x61, 0x72,
-  0x74, 0x2D, 0x61, 0x72, 0x65, 0x61, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x51,
-  0x2E, 0x4C, 0x69, 0x6E, 0x65, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x61, 0x5B, 0x6F, 0x5D,
-  0x2C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x61, 0x5B, 0x63, 0x5D, 0x7D, 0x29, 0x7D,
-  0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22,
-  0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2D, 0x62, 0x75, 0x74,
-  0x74, 0x6F, 0x6E, 0x73, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x6C, 0x2D, 0x61, 0x75, 0x74,
-  0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63,
-  0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x6D, 0x64, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68,
-  0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43, 0x6F, 0x6E,
-  0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6C, 0x67, 0x3A,
-  0x22, 0x38, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64,
-  0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C,
-  0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74,
-  0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D,
-  0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28,
-  0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x22,
-  0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x7D, 0x29,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45,
-  0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69,
-  0x76, 0x65, 0x3A, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22,
-  0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28,
-  0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74,
-  0x6F, 0x70, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D,
-  0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C,
-  0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x22, 0x7D,
-  0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x70, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72,
-  0x65, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72,
-  0x65, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x5C, 0x75, 0x30, 0x36,
-  0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x31, 0x5C, 0x75,
-  0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x38, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x32,
-  0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66, 0x61, 0x73, 0x20, 0x66, 0x61, 0x2D, 0x74,
-  0x61, 0x63, 0x68, 0x6F, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x2D, 0x61, 0x6C, 0x74, 0x22, 0x2C, 0x63,
-  0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-  0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3B,
-  0x6C, 0x65, 0x74, 0x20, 0x61, 0x3D, 0x7B, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61,
-  0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74,
-  0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65,
-  0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34,
-  0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34,
-  0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28,
-  0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C,
-  0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C,
-  0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61,
-  0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42,
-  0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61,
-  0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67,
-  0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38,
-  0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F,
-  0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E,
-  0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74,
-  0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73,
-  0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x69,
-  0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E,
-  0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A,
-  0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C,
-  0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A,
-  0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-  0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22,
-  0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E,
-  0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C,
-  0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69,
-  0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74,
-  0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72,
-  0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61,
-  0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72,
-  0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67,
-  0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72,
-  0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30,
-  0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22,
-  0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C,
-  0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65,
-  0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-  0x3A, 0x32, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33,
-  0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x31, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F,
-  0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A,
-  0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69,
-  0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65,
-  0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D,
-  0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65,
-  0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F,
-  0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74,
-  0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74,
-  0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61,
-  0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39,
-  0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64,
-  0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21,
-  0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61,
-  0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68,
-  0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61,
-  0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23,
-  0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72,
-  0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66,
-  0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69,
-  0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48,
-  0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34,
-  0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61,
-  0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74,
-  0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21,
-  0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
-  0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B,
-  0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46,
-  0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C,
-  0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23,
-  0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67,
-  0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D,
-  0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E,
-  0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
-  0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65,
-  0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C,
-  0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50,
-  0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72,
-  0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72,
-  0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D,
-  0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78,
-  0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61,
-  0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
-  0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C,
-  0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69,
-  0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22,
-  0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D,
-  0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E,
-  0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x58,
-  0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x3B, 0x65, 0x2E,
-  0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E,
-  0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x34, 0x3D,
-  0x3D, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x26, 0x26,
-  0x32, 0x30, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x26, 0x26,
-  0x28, 0x74, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x7D, 0x2C,
-  0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x22, 0x52, 0x65,
-  0x61, 0x64, 0x5F, 0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x2C, 0x21, 0x30, 0x29,
-  0x2C, 0x65, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x29, 0x7D, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x64,
-  0x61, 0x74, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72,
-  0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65,
-  0x29, 0x7B, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x78,
-  0x3A, 0x44, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x2C, 0x79, 0x3A, 0x74, 0x7D,
-  0x29, 0x7D, 0x29, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65,
-  0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F,
-  0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74,
-  0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74,
-  0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61,
-  0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39,
-  0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64,
-  0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21,
-  0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
-  0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61,
-  0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68,
-  0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61,
-  0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23,
-  0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72,
-  0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66,
-  0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69,
-  0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48,
-  0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34,
-  0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F,
-  0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61,
-  0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31,
-  0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
-  0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62,
-  0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22,
-  0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F,
-  0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62,
-  0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36,
-  0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A,
-  0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F,
-  0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74,
-  0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F,
-  0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73,
-  0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65,
-  0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65,
-  0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69,
-  0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62,
-  0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30,
-  0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C,
-  0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41,
-  0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C,
-  0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34,
-  0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x35, 0x30, 0x30, 0x2C, 0x70,
-  0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64,
-  0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73,
-  0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65,
-  0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63,
-  0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28,
-  0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D,
-  0x7D, 0x7D, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75,
-  0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61,
-  0x74, 0x61, 0x22, 0x29, 0x2C, 0x6F, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E,
-  0x61, 0x29, 0x28, 0x72, 0x2C, 0x31, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61,
-  0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F,
-  0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x5B,
-  0x30, 0x5D, 0x2C, 0x64, 0x3D, 0x69, 0x5B, 0x31, 0x5D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B,
-  0x64, 0x28, 0x65, 0x29, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61,
-  0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64,
-  0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E,
-  0x61, 0x2C, 0x7B, 0x78, 0x73, 0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D,
-  0x65, 0x3A, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x63, 0x68, 0x61, 0x72, 0x74, 0x22, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45,
-  0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74,
-  0x65, 0x78, 0x74, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x73, 0x6D, 0x3A, 0x22, 0x36, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67,
-  0x3A, 0x22, 0x68, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22,
-  0x50, 0x72, 0x65, 0x73, 0x73, 0x75, 0x72, 0x65, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76,
-  0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x68,
-  0x61, 0x72, 0x74, 0x2D, 0x61, 0x72, 0x65, 0x61, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x51, 0x2E, 0x4C, 0x69, 0x6E, 0x65, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x61, 0x5B,
-  0x6F, 0x5D, 0x2C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x61, 0x5B, 0x63, 0x5D, 0x7D,
-  0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64,
-  0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x58, 0x2E, 0x61,
-  0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2D, 0x62,
-  0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C,
-  0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x6C, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x78, 0x74,
-  0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22, 0x2C, 0x6D, 0x64, 0x3A, 0x22, 0x36, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A,
-  0x22, 0x68, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43,
-  0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x6E, 0x65, 0x6C, 0x22, 0x7D, 0x29, 0x7D,
-  0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78,
-  0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6C,
-  0x67, 0x3A, 0x22, 0x38, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E,
-  0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B,
-  0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E,
-  0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61,
-  0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22,
-  0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D,
-  0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E,
-  0x62, 0x28, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22,
-  0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x61, 0x72,
-  0x74, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22,
-  0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21,
-  0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63,
-  0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B,
-  0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74,
-  0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22,
-  0x53, 0x74, 0x6F, 0x70, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29,
-  0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29,
-  0x7D, 0x2C, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E,
-  0x22, 0x7D, 0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x68, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x22, 0x2C, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x48, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x22, 0x2C, 0x72, 0x74, 0x6C, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x5C, 0x75,
-  0x30, 0x36, 0x32, 0x37, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x34, 0x5C, 0x75, 0x30, 0x36, 0x33, 0x31,
-  0x5C, 0x75, 0x30, 0x36, 0x34, 0x35, 0x5C, 0x75, 0x30, 0x36, 0x34, 0x38, 0x5C, 0x75, 0x30, 0x36,
-  0x33, 0x32, 0x22, 0x2C, 0x69, 0x63, 0x6F, 0x6E, 0x3A, 0x22, 0x66, 0x61, 0x73, 0x20, 0x66, 0x61,
-  0x2D, 0x74, 0x69, 0x6E, 0x74, 0x22, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74,
-  0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x74, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x6C, 0x65, 0x74, 0x20, 0x61, 0x3D, 0x7B, 0x69,
-  0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74,
-  0x20, 0x74, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28,
-  0x22, 0x32, 0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65,
-  0x61, 0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30,
-  0x2C, 0x30, 0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E,
-  0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22,
-  0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C,
-  0x30, 0x2E, 0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32,
-  0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29,
-  0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28,
-  0x30, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32,
-  0x34, 0x38, 0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74,
-  0x73, 0x3A, 0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B,
-  0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65,
-  0x66, 0x31, 0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A,
-  0x32, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35,
-  0x2C, 0x32, 0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F,
-  0x76, 0x65, 0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75,
-  0x73, 0x3A, 0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69,
-  0x6E, 0x74, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A,
-  0x5B, 0x5D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69,
-  0x6F, 0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65,
-  0x63, 0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E,
-  0x64, 0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74,
-  0x6F, 0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
-  0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66,
-  0x35, 0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E,
-  0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F,
-  0x64, 0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64,
-  0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65,
-  0x61, 0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74,
-  0x3A, 0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76,
-  0x65, 0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78,
-  0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61,
-  0x67, 0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73,
-  0x3A, 0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C,
-  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31,
-  0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72,
-  0x6F, 0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E,
-  0x73, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A,
-  0x7B, 0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39,
-  0x61, 0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B,
-  0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C,
-  0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x32, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21,
-  0x31, 0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D,
-  0x65, 0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22,
-  0x7D, 0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65,
-  0x29, 0x7B, 0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C,
-  0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72,
-  0x74, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74,
-  0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32,
-  0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72,
-  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30,
-  0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53,
-  0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A,
-  0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C,
-  0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32,
-  0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
-  0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63,
-  0x74, 0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64,
-  0x3A, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F,
-  0x6F, 0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
-  0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35,
-  0x22, 0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64,
-  0x79, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64,
-  0x69, 0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61,
-  0x72, 0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A,
-  0x30, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72,
-  0x65, 0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65,
-  0x3A, 0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65,
-  0x73, 0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67,
-  0x65, 0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A,
-  0x7B, 0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34,
-  0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F,
-  0x4C, 0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73,
-  0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B,
-  0x66, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61,
-  0x39, 0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74,
-  0x79, 0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64,
-  0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72,
-  0x65, 0x73, 0x68, 0x3A, 0x31, 0x65, 0x33, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30,
-  0x2C, 0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65,
-  0x3A, 0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D,
-  0x2C, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66,
-  0x72, 0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29,
-  0x7B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72,
-  0x20, 0x65, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65,
-  0x71, 0x75, 0x65, 0x73, 0x74, 0x3B, 0x65, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-  0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x34, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x61, 0x64,
-  0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x26, 0x26, 0x32, 0x30, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E,
-  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x26, 0x26, 0x28, 0x74, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x73,
-  0x70, 0x6F, 0x6E, 0x73, 0x65, 0x29, 0x7D, 0x2C, 0x65, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x22,
-  0x47, 0x45, 0x54, 0x22, 0x2C, 0x22, 0x52, 0x65, 0x61, 0x64, 0x5F, 0x48, 0x75, 0x6D, 0x69, 0x64,
-  0x69, 0x74, 0x79, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x65, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28,
-  0x29, 0x7D, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61,
-  0x73, 0x65, 0x74, 0x73, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61,
-  0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x78, 0x3A, 0x44, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x6F,
-  0x77, 0x28, 0x29, 0x2C, 0x79, 0x3A, 0x74, 0x7D, 0x29, 0x7D, 0x29, 0x29, 0x7D, 0x2C, 0x64, 0x65,
-  0x6C, 0x61, 0x79, 0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F,
-  0x70, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x65, 0x3D, 0x3E, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x74,
-  0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x22, 0x32,
-  0x64, 0x22, 0x29, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4C, 0x69, 0x6E, 0x65, 0x61, 0x72,
-  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x30, 0x2C, 0x32, 0x33, 0x30, 0x2C, 0x30,
-  0x2C, 0x35, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x2E, 0x61, 0x64,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x31, 0x2C, 0x22, 0x72, 0x67,
-  0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E,
-  0x32, 0x29, 0x22, 0x29, 0x2C, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53,
-  0x74, 0x6F, 0x70, 0x28, 0x2E, 0x34, 0x2C, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C,
-  0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x74,
-  0x2E, 0x61, 0x64, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x30, 0x2C,
-  0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30, 0x2C, 0x32, 0x34, 0x38,
-  0x2C, 0x30, 0x29, 0x22, 0x29, 0x2C, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x73, 0x3A,
-  0x5B, 0x7B, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
-  0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x74, 0x2C, 0x62, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31,
-  0x22, 0x2C, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x2C,
-  0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x3A, 0x5B, 0x5D, 0x2C, 0x62, 0x6F,
-  0x72, 0x64, 0x65, 0x72, 0x44, 0x61, 0x73, 0x68, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C,
-  0x70, 0x6F, 0x69, 0x6E, 0x74, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x32, 0x35, 0x35, 0x2C, 0x32,
-  0x35, 0x35, 0x2C, 0x30, 0x29, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65,
-  0x72, 0x42, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72,
-  0x3A, 0x22, 0x23, 0x31, 0x66, 0x38, 0x65, 0x66, 0x31, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x32, 0x30, 0x2C, 0x70,
-  0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
-  0x34, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x48, 0x6F, 0x76, 0x65, 0x72, 0x42, 0x6F, 0x72, 0x64,
-  0x65, 0x72, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 0x35, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-  0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x34, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x5B, 0x5D,
-  0x7D, 0x5D, 0x7D, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
-  0x3A, 0x7B, 0x6D, 0x61, 0x69, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x41, 0x73, 0x70, 0x65, 0x63, 0x74,
-  0x52, 0x61, 0x74, 0x69, 0x6F, 0x3A, 0x21, 0x31, 0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A,
-  0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x74, 0x6F, 0x6F,
-  0x6C, 0x74, 0x69, 0x70, 0x73, 0x3A, 0x7B, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
-  0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35, 0x22,
-  0x2C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x46, 0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x23, 0x33, 0x33, 0x33, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79, 0x46, 0x6F, 0x6E, 0x74, 0x43,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x36, 0x36, 0x36, 0x22, 0x2C, 0x62, 0x6F, 0x64, 0x79,
-  0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x34, 0x2C, 0x78, 0x50, 0x61, 0x64, 0x64, 0x69,
-  0x6E, 0x67, 0x3A, 0x31, 0x32, 0x2C, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72,
-  0x65, 0x73, 0x74, 0x22, 0x2C, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x3A, 0x30,
-  0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x6E, 0x65, 0x61, 0x72, 0x65,
-  0x73, 0x74, 0x22, 0x7D, 0x2C, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x3A,
-  0x21, 0x30, 0x2C, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x73, 0x3A, 0x7B, 0x79, 0x41, 0x78, 0x65, 0x73,
-  0x3A, 0x5B, 0x7B, 0x62, 0x61, 0x72, 0x50, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x61, 0x67, 0x65,
-  0x3A, 0x31, 0x2E, 0x36, 0x2C, 0x67, 0x72, 0x69, 0x64, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x3A, 0x7B,
-  0x64, 0x72, 0x61, 0x77, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x21, 0x31, 0x2C, 0x63, 0x6F,
-  0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x39, 0x2C, 0x31, 0x34, 0x30,
-  0x2C, 0x32, 0x34, 0x38, 0x2C, 0x30, 0x2E, 0x30, 0x29, 0x22, 0x2C, 0x7A, 0x65, 0x72, 0x6F, 0x4C,
-  0x69, 0x6E, 0x65, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70,
-  0x61, 0x72, 0x65, 0x6E, 0x74, 0x22, 0x7D, 0x2C, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x3A, 0x7B, 0x66,
-  0x6F, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x23, 0x39, 0x61, 0x39, 0x61, 0x39,
-  0x61, 0x22, 0x7D, 0x7D, 0x5D, 0x2C, 0x78, 0x41, 0x78, 0x65, 0x73, 0x3A, 0x5B, 0x7B, 0x74, 0x79,
-  0x70, 0x65, 0x3A, 0x22, 0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x22, 0x2C, 0x64, 0x75,
-  0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x34, 0x65, 0x34, 0x2C, 0x72, 0x65, 0x66, 0x72, 0x65,
-  0x73, 0x68, 0x3A, 0x35, 0x30, 0x30, 0x2C, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3A, 0x21, 0x30, 0x2C,
-  0x74, 0x74, 0x6C, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x69, 0x6D, 0x65, 0x3A,
-  0x7B, 0x75, 0x6E, 0x69, 0x74, 0x3A, 0x22, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x22, 0x7D, 0x2C,
-  0x72, 0x65, 0x61, 0x6C, 0x74, 0x69, 0x6D, 0x65, 0x3A, 0x7B, 0x6F, 0x6E, 0x52, 0x65, 0x66, 0x72,
-  0x65, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B,
-  0x65, 0x2E, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x61, 0x79,
-  0x3A, 0x32, 0x65, 0x33, 0x7D, 0x7D, 0x5D, 0x7D, 0x7D, 0x7D, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-  0x20, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x28,
-  0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x22, 0x29, 0x2C, 0x6F, 0x3D, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x72, 0x2C, 0x31, 0x29, 0x5B,
-  0x30, 0x5D, 0x2C, 0x73, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x22, 0x69, 0x64, 0x6C, 0x65, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29,
-  0x2C, 0x69, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29, 0x28, 0x73,
-  0x2C, 0x32, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x3D, 0x69, 0x5B, 0x31,
-  0x5D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B, 0x64, 0x28, 0x65, 0x29, 0x7D, 0x3B, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x70, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61,
-  0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22,
-  0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x78, 0x73, 0x3A, 0x22, 0x31,
-  0x32, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B,
-  0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D,
-  0x63, 0x68, 0x61, 0x72, 0x74, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A,
-  0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x56,
-  0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73,
-  0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x6C, 0x65, 0x66, 0x74,
-  0x22, 0x2C, 0x73, 0x6D, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65,
-  0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x47, 0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68, 0x32, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x48, 0x75, 0x6D, 0x69, 0x64, 0x69, 0x74, 0x79,
-  0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2D, 0x61, 0x72, 0x65, 0x61,
-  0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x51, 0x2E, 0x4C, 0x69, 0x6E, 0x65, 0x2C,
-  0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x61, 0x5B, 0x6F, 0x5D, 0x2C, 0x6F, 0x70, 0x74, 0x69, 0x6F,
-  0x6E, 0x73, 0x3A, 0x61, 0x5B, 0x63, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29,
-  0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x31, 0x32, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x58, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29,
-  0x28, 0x7A, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64,
-  0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22,
-  0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2D, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x22, 0x2C,
-  0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-  0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A,
-  0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61,
-  0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x6C, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72, 0x2D, 0x61,
-  0x75, 0x74, 0x6F, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x22,
-  0x2C, 0x6D, 0x64, 0x3A, 0x22, 0x36, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x47,
-  0x2E, 0x61, 0x2C, 0x7B, 0x74, 0x61, 0x67, 0x3A, 0x22, 0x68, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69,
-  0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x70,
-  0x61, 0x6E, 0x65, 0x6C, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x6C, 0x61, 0x73, 0x73,
-  0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x78, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x6D, 0x72,
-  0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x6C, 0x67, 0x3A, 0x22, 0x38, 0x22, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x46, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73,
-  0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C, 0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
-  0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22,
-  0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B,
-  0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x6F, 0x70,
-  0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x2C, 0x6F, 0x6E, 0x43, 0x6C,
-  0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74,
-  0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72,
-  0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x22, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61,
-  0x2C, 0x7B, 0x6D, 0x64, 0x3A, 0x22, 0x34, 0x22, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-  0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x45, 0x2E, 0x61, 0x2C, 0x7B, 0x6D, 0x64,
-  0x3A, 0x22, 0x34, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x49, 0x2E, 0x61, 0x2C,
-  0x7B, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
-  0x22, 0x69, 0x6E, 0x66, 0x6F, 0x22, 0x2C, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65,
-  0x3A, 0x41, 0x28, 0x29, 0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x22, 0x73, 0x74,
-  0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7D, 0x29,
-  0x2C, 0x6F, 0x6E, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x28, 0x29, 0x3D, 0x3E, 0x62, 0x28, 0x22,
-  0x73, 0x74, 0x6F, 0x70, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2C, 0x63, 0x68,
-  0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x22, 0x53, 0x74, 0x6F, 0x70, 0x22, 0x7D, 0x29, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D,
-  0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74,
-  0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x22, 0x7D, 0x5D, 0x3B, 0x76, 0x61, 0x72, 0x20,
-  0x59, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x63, 0x6F,
-  0x6E, 0x73, 0x74, 0x20, 0x74, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x64, 0x2E, 0x67,
-  0x29, 0x28, 0x29, 0x2C, 0x61, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x52, 0x65, 0x66,
-  0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x2C, 0x72, 0x3D, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x31, 0x21, 0x3D, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-  0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-  0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E,
-  0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6F, 0x70, 0x65, 0x6E, 0x22,
-  0x29, 0x29, 0x2C, 0x6F, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6C, 0x2E, 0x61, 0x29,
-  0x28, 0x72, 0x2C, 0x32, 0x29, 0x2C, 0x73, 0x3D, 0x6F, 0x5B, 0x30, 0x5D, 0x2C, 0x69, 0x3D, 0x6F,
-  0x5B, 0x31, 0x5D, 0x3B, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66, 0x65, 0x63,
-  0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x69, 0x66, 0x28, 0x6E, 0x61, 0x76, 0x69, 0x67,
-  0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x69, 0x6E,
-  0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22, 0x29, 0x3E, 0x2D, 0x31, 0x29,
-  0x7B, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-  0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E,
-  0x61, 0x6D, 0x65, 0x2B, 0x3D, 0x22, 0x20, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D, 0x73,
-  0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x6E, 0x22, 0x2C, 0x64, 0x6F, 0x63,
-  0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C,
-  0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E,
-  0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D,
-  0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x66, 0x66, 0x22, 0x29, 0x2C,
-  0x4B, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x78, 0x2E, 0x61, 0x28, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72,
-  0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x73, 0x75, 0x70, 0x70, 0x72, 0x65, 0x73, 0x73, 0x53, 0x63, 0x72,
-  0x6F, 0x6C, 0x6C, 0x58, 0x3A, 0x21, 0x30, 0x7D, 0x29, 0x3B, 0x6C, 0x65, 0x74, 0x20, 0x65, 0x3D,
-  0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65,
-  0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x2E, 0x74, 0x61, 0x62, 0x6C,
-  0x65, 0x2D, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x69, 0x76, 0x65, 0x22, 0x29, 0x3B, 0x66,
-  0x6F, 0x72, 0x28, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x3D, 0x30, 0x3B, 0x74, 0x3C, 0x65, 0x2E, 0x6C,
-  0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x74, 0x2B, 0x2B, 0x29, 0x4B, 0x3D, 0x6E, 0x65, 0x77, 0x20,
-  0x78, 0x2E, 0x61, 0x28, 0x65, 0x5B, 0x74, 0x5D, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-  0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6E, 0x61, 0x76, 0x69,
-  0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x69,
-  0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22, 0x29, 0x3E, 0x2D, 0x31,
-  0x26, 0x26, 0x28, 0x4B, 0x2E, 0x64, 0x65, 0x73, 0x74, 0x72, 0x6F, 0x79, 0x28, 0x29, 0x2C, 0x64,
-  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-  0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73,
-  0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D, 0x73,
-  0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x66, 0x66, 0x22, 0x29, 0x2C, 0x64,
-  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-  0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73,
-  0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63,
-  0x74, 0x2D, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x6E, 0x22, 0x29,
-  0x29, 0x7D, 0x7D, 0x29, 0x29, 0x2C, 0x6E, 0x2E, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x45, 0x66, 0x66,
-  0x65, 0x63, 0x74, 0x28, 0x28, 0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x69, 0x66, 0x28, 0x6E, 0x61, 0x76,
-  0x69, 0x67, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x2E,
-  0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x57, 0x69, 0x6E, 0x22, 0x29, 0x3E, 0x2D,
-  0x31, 0x29, 0x7B, 0x6C, 0x65, 0x74, 0x20, 0x65, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-  0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41,
-  0x6C, 0x6C, 0x28, 0x22, 0x2E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2D, 0x72, 0x65, 0x73, 0x70, 0x6F,
-  0x6E, 0x73, 0x69, 0x76, 0x65, 0x22, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x6C, 0x65, 0x74, 0x20,
-  0x74, 0x3D, 0x30, 0x3B, 0x74, 0x3C, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x74,
-  0x2B, 0x2B, 0x29, 0x4B, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x78, 0x2E, 0x61, 0x28, 0x65, 0x5B, 0x74,
-  0x5D, 0x29, 0x7D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75,
-  0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x63, 0x72, 0x6F,
-  0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x30, 0x2C, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-  0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-  0x74, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x30, 0x2C, 0x61, 0x2E,
-  0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72,
-  0x65, 0x6E, 0x74, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x30, 0x29,
-  0x7D, 0x29, 0x2C, 0x5B, 0x74, 0x5D, 0x29, 0x3B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x3D,
-  0x28, 0x29, 0x3D, 0x3E, 0x7B, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F,
-  0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C,
-  0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x28, 0x22,
-  0x6E, 0x61, 0x76, 0x2D, 0x6F, 0x70, 0x65, 0x6E, 0x22, 0x29, 0x2C, 0x69, 0x28, 0x21, 0x73, 0x29,
-  0x7D, 0x2C, 0x62, 0x3D, 0x65, 0x3D, 0x3E, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x6C, 0x65, 0x74, 0x20,
-  0x61, 0x3D, 0x30, 0x3B, 0x61, 0x3C, 0x5F, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x61,
-  0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x2D, 0x31, 0x21, 0x3D, 0x3D, 0x74, 0x2E, 0x70, 0x61, 0x74,
-  0x68, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x5F, 0x5B,
-  0x61, 0x5D, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x2B, 0x5F, 0x5B, 0x61, 0x5D, 0x2E, 0x70,
-  0x61, 0x74, 0x68, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x5F, 0x5B, 0x61, 0x5D,
-  0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x42, 0x72, 0x61,
-  0x6E, 0x64, 0x22, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x66, 0x2E, 0x43, 0x6F, 0x6E, 0x73,
-  0x75, 0x6D, 0x65, 0x72, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x28,
-  0x7B, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x65, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x43,
-  0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x72, 0x7D, 0x29, 0x3D, 0x3E, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6E, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29,
-  0x28, 0x6E, 0x2E, 0x61, 0x2E, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65,
-  0x72, 0x22, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x4C, 0x2C, 0x7B, 0x72, 0x6F,
-  0x75, 0x74, 0x65, 0x73, 0x3A, 0x5F, 0x2C, 0x6C, 0x6F, 0x67, 0x6F, 0x3A, 0x7B, 0x6F, 0x75, 0x74,
-  0x74, 0x65, 0x72, 0x4C, 0x69, 0x6E, 0x6B, 0x3A, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F,
-  0x2F, 0x77, 0x77, 0x77, 0x2E, 0x73, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x22, 0x2C, 0x69, 0x6D,
-  0x67, 0x53, 0x72, 0x63, 0x3A, 0x22, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x69, 0x6D, 0x61, 0x67, 0x65,
-  0x2F, 0x70, 0x6E, 0x67, 0x3B, 0x62, 0x61, 0x73, 0x65, 0x36, 0x34, 0x2C, 0x69, 0x56, 0x42, 0x4F,
-  0x52, 0x77, 0x30, 0x4B, 0x47, 0x67, 0x6F, 0x41, 0x41, 0x41, 0x41, 0x4E, 0x53, 0x55, 0x68, 0x45,
-  0x55, 0x67, 0x41, 0x41, 0x41, 0x54, 0x38, 0x41, 0x41, 0x41, 0x44, 0x53, 0x43, 0x41, 0x59, 0x41,
-  0x41, 0x41, 0x41, 0x38, 0x43, 0x38, 0x64, 0x44, 0x41, 0x41, 0x41, 0x41, 0x47, 0x58, 0x52, 0x46,
-  0x57, 0x48, 0x52, 0x54, 0x62, 0x32, 0x5A, 0x30, 0x64, 0x32, 0x46, 0x79, 0x5A, 0x51, 0x42, 0x42,
-  0x5A, 0x47, 0x39, 0x69, 0x5A, 0x53, 0x42, 0x4A, 0x62, 0x57, 0x46, 0x6E, 0x5A, 0x56, 0x4A, 0x6C,
-  0x59, 0x57, 0x52, 0x35, 0x63, 0x63, 0x6C, 0x6C, 0x50, 0x41, 0x41, 0x41, 0x43, 0x69, 0x5A, 0x4A,
-  0x52, 0x45, 0x46, 0x55, 0x65, 0x4E, 0x72, 0x73, 0x33, 0x65, 0x31, 0x78, 0x31, 0x45, 0x6F, 0x57,
-  0x42, 0x6D, 0x44, 0x35, 0x46, 0x67, 0x47, 0x59, 0x44, 0x4F, 0x77, 0x49, 0x31, 0x6B, 0x53, 0x77,
-  0x34, 0x77, 0x78, 0x4D, 0x42, 0x41, 0x77, 0x52, 0x59, 0x43, 0x4C, 0x41, 0x52, 0x41, 0x42, 0x45,
-  0x34, 0x43, 0x45, 0x43, 0x7A, 0x30, 0x62, 0x67, 0x49, 0x51, 0x4B, 0x38, 0x45, 0x65, 0x41, 0x4D,
-  0x37, 0x41, 0x79, 0x38, 0x30, 0x6B, 0x56, 0x51, 0x46, 0x4D, 0x56, 0x79, 0x52, 0x31, 0x69, 0x6E,
-  0x76, 0x2F, 0x51, 0x38, 0x56, 0x56, 0x4F, 0x75, 0x34, 0x6F, 0x64, 0x78, 0x53, 0x7A, 0x50, 0x76,
-  0x6E, 0x4B, 0x4E, 0x57, 0x74, 0x37, 0x6F, 0x4F, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x6F, 0x48, 0x67, 0x48, 0x44, 0x6B, 0x45, 0x64, 0x48, 0x68, 0x34, 0x65,
-  0x6A, 0x76, 0x6F, 0x66, 0x71, 0x2F, 0x34, 0x31, 0x2F, 0x50, 0x7A, 0x33, 0x2B, 0x4D, 0x38, 0x72,
-  0x52, 0x34, 0x61, 0x4D, 0x33, 0x68, 0x34, 0x63, 0x48, 0x46, 0x77, 0x49, 0x50, 0x79, 0x49, 0x43,
-  0x62, 0x77, 0x69, 0x33, 0x46, 0x7A, 0x2B, 0x45, 0x48, 0x70, 0x51, 0x56, 0x49, 0x4C, 0x31, 0x61,
-  0x2F, 0x2F, 0x59, 0x6E, 0x54, 0x6C, 0x39, 0x78, 0x67, 0x58, 0x66, 0x59, 0x2F, 0x31, 0x6A, 0x33,
-  0x72, 0x31, 0x63, 0x43, 0x6A, 0x38, 0x4C, 0x64, 0x31, 0x76, 0x7A, 0x48, 0x43, 0x37, 0x2B, 0x79,
-  0x67, 0x75, 0x39, 0x69, 0x44, 0x4C, 0x31, 0x44, 0x52, 0x34, 0x4D, 0x4B, 0x66, 0x4B, 0x79, 0x36,
-  0x61, 0x6E, 0x58, 0x2B, 0x69, 0x6D, 0x6C, 0x76, 0x4C, 0x31, 0x56, 0x36, 0x56, 0x4F, 0x61, 0x34,
-  0x37, 0x33, 0x71, 0x72, 0x72, 0x66, 0x37, 0x2B, 0x63, 0x76, 0x36, 0x79, 0x42, 0x39, 0x2B, 0x37,
-  0x2F, 0x73, 0x65, 0x31, 0x34, 0x4B, 0x4D, 0x79, 0x6D, 0x35, 0x71, 0x44, 0x54, 0x39, 0x75, 0x62,
-  0x4E, 0x2F, 0x51, 0x4F, 0x78, 0x39, 0x41, 0x37, 0x63, 0x54, 0x54, 0x51, 0x38, 0x6D, 0x70, 0x37,
-  0x6C, 0x78, 0x4A, 0x38, 0x4A, 0x32, 0x50, 0x77, 0x75, 0x62, 0x5A, 0x48, 0x6A, 0x57, 0x37, 0x37,
-  0x71, 0x75, 0x2B, 0x34, 0x39, 0x6B, 0x46, 0x6F, 0x65, 0x77, 0x55, 0x66, 0x54, 0x50, 0x57, 0x32,
-  0x68, 0x55, 0x47, 0x6F, 0x2F, 0x41, 0x51, 0x66, 0x54, 0x48, 0x48, 0x66, 0x66, 0x5A, 0x33, 0x6F,
-  0x75, 0x46, 0x66, 0x35, 0x73, 0x57, 0x2F, 0x77, 0x44, 0x59, 0x46, 0x33, 0x4A, 0x66, 0x69, 0x6F,
-  0x33, 0x4C, 0x61, 0x46, 0x34, 0x42, 0x4E, 0x2B, 0x61, 0x51, 0x33, 0x42, 0x64, 0x2B, 0x51, 0x77,
-  0x55, 0x4C, 0x6B, 0x50, 0x72, 0x51, 0x78, 0x45, 0x2B, 0x4B, 0x57, 0x70, 0x2B, 0x69, 0x34, 0x36,
-  0x36, 0x33, 0x43, 0x70, 0x33, 0x36, 0x36, 0x76, 0x2B, 0x6D, 0x36, 0x45, 0x48, 0x2F, 0x73, 0x47,
-  0x33, 0x31, 0x44, 0x74, 0x76, 0x58, 0x45, 0x6B, 0x61, 0x4D, 0x44, 0x48, 0x6C, 0x67, 0x5A, 0x6A,
-  0x77, 0x69, 0x4D, 0x2B, 0x2F, 0x4B, 0x35, 0x56, 0x66, 0x54, 0x54, 0x67, 0x76, 0x71, 0x2F, 0x36,
-  0x6E, 0x72, 0x59, 0x30, 0x49, 0x4A, 0x56, 0x66, 0x62, 0x50, 0x43, 0x74, 0x42, 0x42, 0x2B, 0x4E,
-  0x2B, 0x4E, 0x44, 0x61, 0x67, 0x4B, 0x7A, 0x77, 0x69, 0x46, 0x56, 0x69, 0x75, 0x7A, 0x74, 0x63,
-  0x73, 0x37, 0x6C, 0x33, 0x61, 0x70, 0x68, 0x53, 0x39, 0x66, 0x57, 0x76, 0x39, 0x38, 0x4B, 0x50,
-  0x47, 0x71, 0x71, 0x2B, 0x34, 0x63, 0x32, 0x36, 0x36, 0x31, 0x2F, 0x2F, 0x48, 0x58, 0x2F, 0x65,
-  0x31, 0x72, 0x34, 0x4F, 0x45, 0x34, 0x52, 0x66, 0x50, 0x56, 0x35, 0x6B, 0x43, 0x4C, 0x78, 0x74,
-  0x2F, 0x2F, 0x72, 0x59, 0x42, 0x39, 0x33, 0x4F, 0x34, 0x51, 0x64, 0x79, 0x56, 0x48, 0x32, 0x48,
-  0x44, 0x2B, 0x6C, 0x38, 0x36, 0x56, 0x2F, 0x72, 0x38, 0x53, 0x5A, 0x71, 0x67, 0x4B, 0x7A, 0x68,
-  0x64, 0x35, 0x45, 0x67, 0x39, 0x4F, 0x37, 0x36, 0x31, 0x37, 0x6D, 0x6A, 0x44, 0x5A, 0x51, 0x55,
-  0x66, 0x6C, 0x2B, 0x43, 0x67, 0x2B, 0x39, 0x4B, 0x70, 0x51, 0x65, 0x55, 0x46, 0x6E, 0x78, 0x6E,
-  0x77, 0x63, 0x47, 0x6E, 0x32, 0x67, 0x4F, 0x4B, 0x44, 0x4C, 0x2F, 0x72, 0x77, 0x44, 0x5A, 0x33,
-  0x35, 0x51, 0x67, 0x44, 0x4A, 0x51, 0x62, 0x66, 0x55, 0x57, 0x44, 0x77, 0x32, 0x66, 0x45, 0x5A,
-  0x5A, 0x6D, 0x53, 0x46, 0x78, 0x37, 0x78, 0x65, 0x42, 0x66, 0x33, 0x65, 0x30, 0x35, 0x59, 0x57,
-  0x6C, 0x41, 0x50, 0x74, 0x56, 0x58, 0x35, 0x33, 0x41, 0x56, 0x58, 0x66, 0x32, 0x70, 0x45, 0x46,
-  0x53, 0x67, 0x36, 0x2B, 0x64, 0x63, 0x53, 0x73, 0x72, 0x69, 0x4D, 0x4C, 0x6C, 0x42, 0x35, 0x2B,
-  0x6E, 0x77, 0x4F, 0x75, 0x38, 0x37, 0x6D, 0x64, 0x42, 0x53, 0x67, 0x36, 0x2B, 0x45, 0x36, 0x30,
-  0x75, 0x38, 0x41, 0x53, 0x77, 0x2B, 0x39, 0x79, 0x35, 0x75, 0x43, 0x37, 0x64, 0x6C, 0x53, 0x42,
-  0x30, 0x6F, 0x4D, 0x76, 0x59, 0x68, 0x33, 0x76, 0x6D, 0x53, 0x4D, 0x4C, 0x73, 0x64, 0x7A, 0x71,
-  0x38, 0x6E, 0x68, 0x7A, 0x74, 0x36, 0x66, 0x44, 0x39, 0x6C, 0x4E, 0x62, 0x68, 0x78, 0x57, 0x45,
-  0x58, 0x2B, 0x6E, 0x6D, 0x76, 0x72, 0x66, 0x76, 0x67, 0x30, 0x4D, 0x4B, 0x77, 0x71, 0x2F, 0x30,
-  0x6C, 0x6E, 0x64, 0x6F, 0x54, 0x34, 0x39, 0x6D, 0x2F, 0x72, 0x57, 0x71, 0x50, 0x68, 0x42, 0x2B,
-  0x78, 0x5A, 0x74, 0x37, 0x77, 0x39, 0x49, 0x62, 0x4F, 0x79, 0x36, 0x44, 0x38, 0x43, 0x75, 0x39,
-  0x36, 0x68, 0x73, 0x71, 0x76, 0x72, 0x6B, 0x6E, 0x4A, 0x6E, 0x61, 0x4F, 0x4C, 0x41, 0x69, 0x2F,
-  0x30, 0x6B, 0x57, 0x73, 0x34, 0x2F, 0x33, 0x6B, 0x73, 0x45, 0x49, 0x61, 0x6E, 0x74, 0x76, 0x37,
-  0x35, 0x35, 0x58, 0x66, 0x58, 0x66, 0x39, 0x6A, 0x37, 0x68, 0x55, 0x59, 0x78, 0x31, 0x46, 0x74,
-  0x37, 0x33, 0x68, 0x39, 0x63, 0x6E, 0x69, 0x61, 0x6E, 0x4E, 0x31, 0x68, 0x70, 0x68, 0x76, 0x4F,
-  0x79, 0x57, 0x6D, 0x44, 0x35, 0x32, 0x59, 0x59, 0x7A, 0x37, 0x4E, 0x2B, 0x58, 0x49, 0x74, 0x38,
-  0x6D, 0x70, 0x2F, 0x4B, 0x37, 0x38, 0x2F, 0x65, 0x72, 0x4F, 0x75, 0x41, 0x34, 0x4F, 0x73, 0x43,
-  0x50, 0x31, 0x79, 0x58, 0x2F, 0x59, 0x38, 0x72, 0x77, 0x66, 0x66, 0x48, 0x6A, 0x72, 0x72, 0x35,
-  0x62, 0x32, 0x6E, 0x36, 0x38, 0x62, 0x32, 0x55, 0x36, 0x39, 0x79, 0x45, 0x6A, 0x55, 0x76, 0x34,
-  0x74, 0x53, 0x76, 0x69, 0x79, 0x57, 0x77, 0x33, 0x51, 0x52, 0x2B, 0x75, 0x38, 0x79, 0x57, 0x2F,
-  0x77, 0x55, 0x73, 0x2B, 0x50, 0x2B, 0x50, 0x61, 0x37, 0x58, 0x65, 0x5A, 0x78, 0x37, 0x55, 0x54,
-  0x66, 0x75, 0x7A, 0x37, 0x68, 0x68, 0x32, 0x2B, 0x6F, 0x56, 0x63, 0x42, 0x76, 0x7A, 0x71, 0x71,
-  0x39, 0x58, 0x6A, 0x6C, 0x72, 0x44, 0x32, 0x2B, 0x50, 0x51, 0x79, 0x36, 0x38, 0x54, 0x79, 0x6B,
-  0x67, 0x35, 0x67, 0x34, 0x72, 0x73, 0x58, 0x75, 0x45, 0x79, 0x6E, 0x38, 0x47, 0x67, 0x36, 0x54,
-  0x63, 0x55, 0x62, 0x36, 0x79, 0x43, 0x6C, 0x37, 0x74, 0x49, 0x2B, 0x4E, 0x76, 0x70, 0x66, 0x65,
-  0x4C, 0x76, 0x6D, 0x6B, 0x43, 0x72, 0x2F, 0x70, 0x62, 0x55, 0x70, 0x4E, 0x36, 0x32, 0x35, 0x74,
-  0x69, 0x54, 0x57, 0x50, 0x54, 0x63, 0x42, 0x37, 0x61, 0x5A, 0x58, 0x35, 0x69, 0x2B, 0x6E, 0x62,
-  0x51, 0x2B, 0x36, 0x46, 0x48, 0x31, 0x57, 0x30, 0x4B, 0x5A, 0x4F, 0x4D, 0x4C, 0x63, 0x32, 0x39,
-  0x30, 0x2F, 0x61, 0x34, 0x34, 0x41, 0x75, 0x61, 0x69, 0x48, 0x71, 0x52, 0x65, 0x56, 0x7A, 0x62,
-  0x70, 0x63, 0x37, 0x79, 0x43, 0x72, 0x2F, 0x47, 0x57, 0x39, 0x34, 0x66, 0x57, 0x43, 0x74, 0x63,
-  0x57, 0x4D, 0x73, 0x37, 0x58, 0x6F, 0x35, 0x59, 0x65, 0x31, 0x38, 0x49, 0x76, 0x31, 0x70, 0x61,
-  0x33, 0x75, 0x67, 0x32, 0x5A, 0x52, 0x58, 0x30, 0x65, 0x39, 0x39, 0x33, 0x51, 0x54, 0x50, 0x4A,
-  0x43, 0x7A, 0x42, 0x4D, 0x43, 0x4F, 0x79, 0x43, 0x4F, 0x6F, 0x69, 0x63, 0x64, 0x68, 0x36, 0x49,
-  0x4A, 0x66, 0x78, 0x61, 0x72, 0x2F, 0x71, 0x36, 0x73, 0x62, 0x55, 0x35, 0x46, 0x59, 0x42, 0x2F,
-  0x4A, 0x47, 0x70, 0x43, 0x49, 0x48, 0x66, 0x4C, 0x2B, 0x39, 0x47, 0x70, 0x74, 0x63, 0x4A, 0x6A,
-  0x53, 0x70, 0x76, 0x79, 0x4A, 0x63, 0x46, 0x2F, 0x64, 0x52, 0x70, 0x55, 0x61, 0x58, 0x79, 0x62,
-  0x72, 0x42, 0x6C, 0x32, 0x69, 0x48, 0x61, 0x6A, 0x38, 0x33, 0x36, 0x47, 0x4C, 0x34, 0x33, 0x6A,
-  0x75, 0x61, 0x2B, 0x4C, 0x6A, 0x54, 0x63, 0x31, 0x58, 0x2B, 0x59, 0x63, 0x56, 0x7A, 0x2B, 0x6D,
-  0x70, 0x30, 0x36, 0x76, 0x79, 0x71, 0x2B, 0x30, 0x4E, 0x69, 0x55, 0x73, 0x6D, 0x49, 0x59, 0x50,
-  0x63, 0x66, 0x39, 0x36, 0x31, 0x67, 0x58, 0x4D, 0x58, 0x44, 0x59, 0x71, 0x61, 0x6B, 0x49, 0x67,
-  0x64, 0x39, 0x58, 0x6E, 0x47, 0x72, 0x44, 0x4B, 0x62, 0x39, 0x4B, 0x33, 0x64, 0x63, 0x51, 0x36,
-  0x33, 0x76, 0x2F, 0x33, 0x67, 0x58, 0x75, 0x65, 0x59, 0x44, 0x79, 0x58, 0x6E, 0x56, 0x55, 0x66,
-  0x2F, 0x32, 0x54, 0x32, 0x64, 0x64, 0x59, 0x4A, 0x4F, 0x34, 0x69, 0x6B, 0x34, 0x31, 0x4C, 0x35,
-  0x74, 0x52, 0x74, 0x38, 0x36, 0x79, 0x37, 0x64, 0x37, 0x53, 0x31, 0x6E, 0x4B, 0x52, 0x35, 0x58,
-  0x32, 0x62, 0x2F, 0x35, 0x58, 0x36, 0x6F, 0x41, 0x66, 0x32, 0x73, 0x58, 0x46, 0x42, 0x43, 0x35,
-  0x72, 0x78, 0x74, 0x76, 0x42, 0x5A, 0x2F, 0x77, 0x4B, 0x37, 0x6C, 0x4E, 0x53, 0x58, 0x49, 0x54,
-  0x39, 0x52, 0x69, 0x41, 0x62, 0x35, 0x33, 0x65, 0x58, 0x34, 0x71, 0x34, 0x76, 0x65, 0x57, 0x77,
-  0x67, 0x47, 0x72, 0x62, 0x52, 0x49, 0x65, 0x32, 0x74, 0x2B, 0x67, 0x32, 0x5A, 0x61, 0x67, 0x36,
-  0x54, 0x68, 0x4E, 0x58, 0x74, 0x70, 0x66, 0x4F, 0x39, 0x6E, 0x63, 0x68, 0x45, 0x77, 0x49, 0x46,
-  0x48, 0x4F, 0x66, 0x68, 0x74, 0x70, 0x31, 0x6A, 0x70, 0x31, 0x66, 0x6C, 0x74, 0x36, 0x38, 0x33,
-  0x47, 0x66, 0x37, 0x50, 0x31, 0x62, 0x68, 0x35, 0x51, 0x70, 0x70, 0x76, 0x76, 0x34, 0x4F, 0x44,
-  0x6F, 0x66, 0x31, 0x39, 0x36, 0x56, 0x52, 0x2F, 0x46, 0x7A, 0x55, 0x68, 0x38, 0x4B, 0x72, 0x52,
-  0x63, 0x61, 0x6E, 0x38, 0x47, 0x71, 0x7A, 0x36, 0x44, 0x73, 0x65, 0x71, 0x4C, 0x38, 0x64, 0x79,
-  0x74, 0x69, 0x51, 0x54, 0x48, 0x37, 0x2B, 0x6F, 0x54, 0x4E, 0x35, 0x31, 0x31, 0x67, 0x4E, 0x48,
-  0x54, 0x48, 0x53, 0x73, 0x75, 0x71, 0x2B, 0x33, 0x47, 0x65, 0x58, 0x30, 0x64, 0x4F, 0x6E, 0x4C,
-  0x32, 0x56, 0x52, 0x2B, 0x2B, 0x7A, 0x76, 0x4C, 0x47, 0x41, 0x52, 0x6E, 0x34, 0x77, 0x63, 0x6D,
-  0x33, 0x62, 0x66, 0x67, 0x31, 0x77, 0x70, 0x77, 0x61, 0x4C, 0x65, 0x58, 0x2F, 0x41, 0x48, 0x5A,
-  0x4E, 0x72, 0x71, 0x4F, 0x64, 0x79, 0x50, 0x34, 0x56, 0x48, 0x35, 0x54, 0x76, 0x71, 0x32, 0x48,
-  0x71, 0x75, 0x38, 0x6F, 0x34, 0x35, 0x2B, 0x51, 0x35, 0x52, 0x72, 0x4E, 0x32, 0x48, 0x4A, 0x66,
-  0x4C, 0x37, 0x51, 0x43, 0x6E, 0x50, 0x30, 0x6D, 0x38, 0x37, 0x47, 0x44, 0x75, 0x4D, 0x73, 0x38,
-  0x72, 0x6D, 0x65, 0x57, 0x73, 0x36, 0x6E, 0x38, 0x70, 0x72, 0x51, 0x70, 0x52, 0x35, 0x6E, 0x2F,
-  0x6A, 0x4B, 0x50, 0x2B, 0x37, 0x30, 0x69, 0x2B, 0x79, 0x2B, 0x2F, 0x34, 0x49, 0x56, 0x6C, 0x69,
-  0x42, 0x64, 0x6A, 0x71, 0x4F, 0x74, 0x34, 0x62, 0x77, 0x53, 0x66, 0x38, 0x61, 0x6D, 0x70, 0x54,
-  0x76, 0x6A, 0x6B, 0x66, 0x72, 0x38, 0x58, 0x6C, 0x43, 0x4D, 0x42, 0x68, 0x4E, 0x63, 0x69, 0x53,
-  0x50, 0x6A, 0x51, 0x6D, 0x4F, 0x72, 0x53, 0x39, 0x69, 0x36, 0x2F, 0x36, 0x68, 0x6F, 0x72, 0x76,
-  0x53, 0x32, 0x46, 0x2F, 0x31, 0x76, 0x4F, 0x67, 0x62, 0x64, 0x54, 0x33, 0x61, 0x64, 0x6D, 0x57,
-  0x73, 0x68, 0x37, 0x34, 0x61, 0x63, 0x41, 0x36, 0x33, 0x75, 0x47, 0x36, 0x38, 0x56, 0x58, 0x47,
-  0x4D, 0x56, 0x6E, 0x48, 0x71, 0x2F, 0x4B, 0x72, 0x71, 0x6B, 0x33, 0x35, 0x6C, 0x61, 0x74, 0x4D,
-  0x46, 0x65, 0x42, 0x53, 0x64, 0x6F, 0x54, 0x5A, 0x4E, 0x4C, 0x71, 0x4F, 0x64, 0x2B, 0x50, 0x6A,
-  0x72, 0x50, 0x4B, 0x62, 0x38, 0x6D, 0x32, 0x64, 0x65, 0x36, 0x4C, 0x6A, 0x64, 0x31, 0x36, 0x4F,
-  0x73, 0x37, 0x49, 0x35, 0x4B, 0x73, 0x44, 0x68, 0x42, 0x74, 0x32, 0x7A, 0x52, 0x6B, 0x2F, 0x37,
-  0x37, 0x42, 0x4D, 0x43, 0x31, 0x76, 0x47, 0x71, 0x2F, 0x47, 0x6F, 0x4C, 0x76, 0x6E, 0x56, 0x58,
-  0x39, 0x67, 0x4E, 0x2F, 0x4C, 0x6E, 0x4E, 0x56, 0x67, 0x4F, 0x4E, 0x39, 0x68, 0x79, 0x31, 0x57,
-  0x45, 0x6C, 0x45, 0x54, 0x41, 0x72, 0x6D, 0x76, 0x39, 0x65, 0x30, 0x45, 0x6E, 0x2F, 0x43, 0x72,
-  0x71, 0x55, 0x33, 0x5A, 0x4E, 0x77, 0x44, 0x50, 0x73, 0x37, 0x51, 0x4A, 0x62, 0x57, 0x36, 0x49,
-  0x45, 0x44, 0x55, 0x68, 0x73, 0x47, 0x35, 0x30, 0x58, 0x4E, 0x72, 0x65, 0x42, 0x71, 0x75, 0x2B,
-  0x45, 0x74, 0x71, 0x55, 0x4B, 0x54, 0x5A, 0x6A, 0x47, 0x4F, 0x55, 0x34, 0x56, 0x73, 0x4D, 0x74,
-  0x4F, 0x4F, 0x63, 0x4E, 0x6E, 0x48, 0x62, 0x72, 0x65, 0x46, 0x56, 0x2B, 0x64, 0x50, 0x56, 0x74,
-  0x55, 0x37, 0x38, 0x65, 0x39, 0x2B, 0x58, 0x4C, 0x55, 0x51, 0x47, 0x2B, 0x37, 0x74, 0x70, 0x59,
-  0x44, 0x78, 0x78, 0x56, 0x78, 0x64, 0x71, 0x6D, 0x58, 0x75, 0x56, 0x58, 0x54, 0x64, 0x57, 0x58,
-  0x63, 0x78, 0x31, 0x76, 0x7A, 0x52, 0x56, 0x67, 0x37, 0x67, 0x72, 0x6E, 0x73, 0x53, 0x4C, 0x57,
-  0x38, 0x51, 0x36, 0x33, 0x42, 0x58, 0x33, 0x4F, 0x50, 0x43, 0x37, 0x72, 0x65, 0x46, 0x56, 0x2B,
-  0x65, 0x38, 0x75, 0x35, 0x6A, 0x6E, 0x65, 0x4F, 0x43, 0x76, 0x41, 0x36, 0x78, 0x53, 0x61, 0x6F,
-  0x76, 0x36, 0x67, 0x41, 0x4E, 0x78, 0x56, 0x58, 0x67, 0x4E, 0x74, 0x47, 0x4E, 0x79, 0x79, 0x31,
-  0x6A, 0x6C, 0x66, 0x34, 0x4E, 0x64, 0x33, 0x79, 0x2F, 0x6D, 0x7A, 0x56, 0x76, 0x33, 0x49, 0x47,
-  0x59, 0x49, 0x33, 0x4C, 0x34, 0x61, 0x49, 0x32, 0x4C, 0x44, 0x31, 0x72, 0x62, 0x56, 0x7A, 0x43,
-  0x72, 0x39, 0x32, 0x57, 0x64, 0x77, 0x69, 0x4F, 0x46, 0x6C, 0x59, 0x77, 0x6E, 0x47, 0x51, 0x4D,
-  0x77, 0x46, 0x31, 0x6C, 0x41, 0x58, 0x67, 0x62, 0x74, 0x47, 0x4A, 0x6D, 0x6E, 0x62, 0x6D, 0x44,
-  0x69, 0x46, 0x71, 0x66, 0x4C, 0x50, 0x77, 0x61, 0x39, 0x61, 0x4B, 0x68, 0x73, 0x65, 0x51, 0x4D,
-  0x77, 0x4A, 0x6F, 0x32, 0x52, 0x49, 0x69, 0x71, 0x6A, 0x6E, 0x4A, 0x33, 0x45, 0x42, 0x35, 0x4C,
-  0x4D, 0x4F, 0x55, 0x39, 0x75, 0x2F, 0x43, 0x71, 0x72, 0x34, 0x54, 0x74, 0x68, 0x69, 0x4C, 0x38,
-  0x76, 0x53, 0x77, 0x74, 0x78, 0x32, 0x34, 0x65, 0x6C, 0x55, 0x79, 0x43, 0x52, 0x4B, 0x7A, 0x6A,
-  0x2F, 0x66, 0x76, 0x53, 0x51, 0x2B, 0x5A, 0x7A, 0x66, 0x75, 0x78, 0x36, 0x6E, 0x38, 0x70, 0x76,
-  0x58, 0x2B, 0x65, 0x4E, 0x6A, 0x75, 0x74, 0x77, 0x72, 0x41, 0x43, 0x54, 0x74, 0x2F, 0x50, 0x6A,
-  0x4E, 0x63, 0x44, 0x33, 0x42, 0x52, 0x2B, 0x62, 0x56, 0x74, 0x66, 0x78, 0x62, 0x67, 0x57, 0x66,
-  0x79, 0x6D, 0x2F, 0x4B, 0x74, 0x33, 0x58, 0x4A, 0x36, 0x33, 0x68, 0x72, 0x72, 0x77, 0x41, 0x2F,
-  0x64, 0x32, 0x56, 0x65, 0x53, 0x34, 0x33, 0x59, 0x73, 0x48, 0x52, 0x34, 0x44, 0x31, 0x6E, 0x48,
-  0x71, 0x2F, 0x4B, 0x72, 0x4A, 0x76, 0x6A, 0x4F, 0x47, 0x67, 0x2B, 0x2B, 0x48, 0x79, 0x76, 0x41,
-  0x48, 0x44, 0x4F, 0x51, 0x72, 0x77, 0x73, 0x38, 0x48, 0x6A, 0x65, 0x4E, 0x62, 0x6C, 0x68, 0x71,
-  0x48, 0x61, 0x2F, 0x77, 0x6D, 0x2B, 0x54, 0x56, 0x51, 0x73, 0x59, 0x35, 0x42, 0x47, 0x44, 0x79,
-  0x4C, 0x62, 0x48, 0x47, 0x6B, 0x4E, 0x6B, 0x55, 0x64, 0x69, 0x79, 0x69, 0x31, 0x72, 0x74, 0x61,
-  0x30, 0x61, 0x48, 0x74, 0x72, 0x61, 0x62, 0x71, 0x4B, 0x36, 0x46, 0x4E, 0x79, 0x53, 0x48, 0x70,
-  0x6C, 0x6C, 0x69, 0x46, 0x72, 0x5A, 0x77, 0x4A, 0x6D, 0x52, 0x43, 0x77, 0x6A, 0x6C, 0x66, 0x6C,
-  0x70, 0x2B, 0x71, 0x72, 0x51, 0x39, 0x49, 0x74, 0x73, 0x63, 0x61, 0x67, 0x4B, 0x61, 0x58, 0x36,
-  0x32, 0x7A, 0x59, 0x36, 0x30, 0x61, 0x48, 0x71, 0x55, 0x2F, 0x6C, 0x4E, 0x2B, 0x72, 0x61, 0x2B,
-  0x36, 0x35, 0x62, 0x39, 0x66, 0x4E, 0x72, 0x33, 0x34, 0x2B, 0x59, 0x45, 0x53, 0x36, 0x71, 0x79,
-  0x49, 0x39, 0x62, 0x78, 0x6C, 0x6A, 0x41, 0x32, 0x45, 0x78, 0x30, 0x71, 0x76, 0x30, 0x6C, 0x74,
-  0x79, 0x74, 0x49, 0x66, 0x7A, 0x48, 0x32, 0x65, 0x61, 0x6B, 0x65, 0x59, 0x38, 0x59, 0x4F, 0x35,
-  0x7A, 0x54, 0x7A, 0x65, 0x58, 0x61, 0x50, 0x72, 0x65, 0x4C, 0x65, 0x43, 0x54, 0x2F, 0x68, 0x70,
-  0x65, 0x61, 0x64, 0x4C, 0x75, 0x53, 0x58, 0x57, 0x66, 0x31, 0x70, 0x72, 0x44, 0x63, 0x66, 0x72,
-  0x6D, 0x65, 0x76, 0x4D, 0x34, 0x37, 0x4A, 0x68, 0x71, 0x62, 0x5A, 0x33, 0x37, 0x7A, 0x64, 0x73,
-  0x43, 0x64, 0x73, 0x4E, 0x6C, 0x57, 0x62, 0x54, 0x76, 0x31, 0x35, 0x48, 0x33, 0x69, 0x43, 0x62,
-  0x65, 0x53, 0x56, 0x4E, 0x79, 0x49, 0x53, 0x41, 0x69, 0x51, 0x36, 0x56, 0x6E, 0x36, 0x71, 0x76,
-  0x67, 0x51, 0x71, 0x77, 0x43, 0x31, 0x34, 0x50, 0x50, 0x41, 0x62, 0x72, 0x72, 0x70, 0x57, 0x71,
-  0x72, 0x35, 0x44, 0x33, 0x6B, 0x71, 0x70, 0x50, 0x2B, 0x46, 0x58, 0x56, 0x70, 0x70, 0x51, 0x71,
-  0x78, 0x59, 0x59, 0x49, 0x6E, 0x7A, 0x4A, 0x57, 0x74, 0x6E, 0x4F, 0x2F, 0x6C, 0x31, 0x5A, 0x64,
-  0x33, 0x74, 0x55, 0x72, 0x4A, 0x63, 0x32, 0x69, 0x43, 0x37, 0x39, 0x4B, 0x4B, 0x68, 0x7A, 0x79,
-  0x42, 0x57, 0x43, 0x4F, 0x5A, 0x2F, 0x39, 0x47, 0x54, 0x51, 0x68, 0x59, 0x78, 0x79, 0x76, 0x38,
-  0x74, 0x4C, 0x77, 0x4E, 0x42, 0x75, 0x42, 0x56, 0x59, 0x4C, 0x56, 0x53, 0x66, 0x57, 0x74, 0x6F,
-  0x6F, 0x6B, 0x50, 0x34, 0x31, 0x64, 0x62, 0x79, 0x4C, 0x6D, 0x45, 0x64, 0x37, 0x31, 0x78, 0x57,
-  0x59, 0x31, 0x74, 0x58, 0x65, 0x2B, 0x56, 0x33, 0x32, 0x2B, 0x67, 0x36, 0x33, 0x70, 0x73, 0x63,
-  0x47, 0x31, 0x55, 0x49, 0x76, 0x33, 0x71, 0x39, 0x63, 0x4B, 0x72, 0x7A, 0x48, 0x71, 0x38, 0x4D,
-  0x62, 0x56, 0x70, 0x55, 0x64, 0x57, 0x53, 0x69, 0x6F, 0x78, 0x48, 0x4E, 0x33, 0x2B, 0x71, 0x79,
-  0x34, 0x48, 0x57, 0x38, 0x6A, 0x7A, 0x48, 0x63, 0x46, 0x48, 0x77, 0x61, 0x63, 0x43, 0x34, 0x65,
-  0x45, 0x76, 0x33, 0x39, 0x55, 0x65, 0x74, 0x34, 0x7A, 0x77, 0x49, 0x76, 0x43, 0x2B, 0x77, 0x31,
-  0x72, 0x6F, 0x6A, 0x6E, 0x44, 0x4B, 0x76, 0x38, 0x32, 0x75, 0x56, 0x61, 0x33, 0x2F, 0x4B, 0x30,
-  0x75, 0x6F, 0x35, 0x33, 0x34, 0x39, 0x51, 0x4B, 0x76, 0x79, 0x6E, 0x57, 0x54, 0x76, 0x4E, 0x6B,
-  0x45, 0x53, 0x73, 0x69, 0x56, 0x6A, 0x57, 0x33, 0x68, 0x6D, 0x4D, 0x48, 0x6B, 0x66, 0x76, 0x4A,
-  0x62, 0x46, 0x70, 0x65, 0x34, 0x54, 0x66, 0x70, 0x41, 0x33, 0x66, 0x6F, 0x4E, 0x45, 0x39, 0x79,
-  0x6B, 0x33, 0x4C, 0x62, 0x71, 0x36, 0x43, 0x57, 0x50, 0x57, 0x4A, 0x43, 0x77, 0x44, 0x70, 0x65,
-  0x34, 0x56, 0x66, 0x58, 0x42, 0x37, 0x6D, 0x72, 0x37, 0x33, 0x6D, 0x79, 0x75, 0x51, 0x7A, 0x48,
-  0x61, 0x58, 0x6A, 0x36, 0x31, 0x32, 0x6E, 0x51, 0x37, 0x30, 0x39, 0x56, 0x2B, 0x55, 0x57, 0x74,
-  0x36, 0x4D, 0x6A, 0x64, 0x51, 0x64, 0x69, 0x36, 0x61, 0x6D, 0x5A, 0x50, 0x57, 0x68, 0x37, 0x63,
-  0x63, 0x4E, 0x32, 0x6E, 0x72, 0x2F, 0x36, 0x47, 0x39, 0x59, 0x38, 0x6E, 0x54, 0x76, 0x55, 0x2F,
-  0x48, 0x71, 0x74, 0x64, 0x38, 0x48, 0x2F, 0x78, 0x72, 0x78, 0x51, 0x42, 0x48, 0x6C, 0x47, 0x31,
-  0x46, 0x72, 0x41, 0x54, 0x55, 0x4E, 0x52, 0x7A, 0x68, 0x6F, 0x56, 0x66, 0x36, 0x77, 0x48, 0x59,
-  0x35, 0x56, 0x74, 0x58, 0x53, 0x74, 0x72, 0x4B, 0x4C, 0x36, 0x70, 0x64, 0x7A, 0x7A, 0x33, 0x52,
-  0x34, 0x56, 0x70, 0x66, 0x52, 0x44, 0x59, 0x34, 0x42, 0x45, 0x52, 0x4C, 0x75, 0x4A, 0x74, 0x4F,
-  0x78, 0x49, 0x61, 0x6C, 0x4A, 0x65, 0x77, 0x45, 0x39, 0x4E, 0x52, 0x79, 0x74, 0x76, 0x6E, 0x39,
-  0x35, 0x52, 0x43, 0x51, 0x51, 0x49, 0x72, 0x4B, 0x61, 0x64, 0x76, 0x6F, 0x68, 0x71, 0x55, 0x62,
-  0x77, 0x61, 0x66, 0x79, 0x6F, 0x39, 0x37, 0x4B, 0x4C, 0x38, 0x58, 0x7A, 0x6B, 0x5A, 0x2F, 0x50,
-  0x66, 0x56, 0x32, 0x73, 0x6B, 0x41, 0x63, 0x77, 0x32, 0x61, 0x5A, 0x65, 0x35, 0x55, 0x65, 0x6C,
-  0x77, 0x62, 0x64, 0x4B, 0x45, 0x48, 0x78, 0x52, 0x45, 0x77, 0x4C, 0x72, 0x7A, 0x4D, 0x47, 0x33,
-  0x45, 0x58, 0x7A, 0x43, 0x6A, 0x33, 0x71, 0x6C, 0x61, 0x42, 0x74, 0x62, 0x58, 0x63, 0x66, 0x37,
-  0x31, 0x74, 0x74, 0x48, 0x2B, 0x46, 0x46, 0x6E, 0x31, 0x54, 0x64, 0x55, 0x66, 0x43, 0x6C, 0x57,
-  0x52, 0x57, 0x77, 0x71, 0x72, 0x56, 0x68, 0x2F, 0x47, 0x33, 0x79, 0x71, 0x50, 0x75, 0x46, 0x48,
-  0x76, 0x56, 0x49, 0x38, 0x34, 0x79, 0x4A, 0x71, 0x51, 0x69, 0x42, 0x6E, 0x31, 0x54, 0x65, 0x45,
-  0x33, 0x6E, 0x74, 0x76, 0x6E, 0x31, 0x67, 0x6D, 0x50, 0x49, 0x69, 0x71, 0x2B, 0x6F, 0x62, 0x4B,
-  0x36, 0x54, 0x72, 0x42, 0x66, 0x33, 0x55, 0x36, 0x39, 0x77, 0x33, 0x61, 0x42, 0x65, 0x77, 0x45,
-  0x39, 0x4D, 0x79, 0x65, 0x66, 0x53, 0x6F, 0x2F, 0x36, 0x67, 0x79, 0x2B, 0x77, 0x30, 0x52, 0x56,
-  0x33, 0x30, 0x32, 0x44, 0x47, 0x35, 0x61, 0x2B, 0x46, 0x48, 0x7A, 0x43, 0x6A, 0x33, 0x71, 0x39,
-  0x36, 0x39, 0x4A, 0x63, 0x4C, 0x34, 0x75, 0x61, 0x36, 0x4D, 0x69, 0x31, 0x6F, 0x6D, 0x4E, 0x54,
-  0x2B, 0x61, 0x59, 0x53, 0x73, 0x4F, 0x69, 0x71, 0x62, 0x33, 0x67, 0x59, 0x65, 0x67, 0x70, 0x33,
-  0x45, 0x51, 0x39, 0x62, 0x53, 0x76, 0x6A, 0x33, 0x2F, 0x2B, 0x7A, 0x53, 0x75, 0x77, 0x66, 0x71,
-  0x44, 0x62, 0x36, 0x54, 0x68, 0x47, 0x48, 0x78, 0x4C, 0x6D, 0x67, 0x4D, 0x31, 0x34, 0x49, 0x50,
-  0x6D, 0x42, 0x70, 0x38, 0x64, 0x77, 0x6B, 0x44, 0x34, 0x79, 0x68, 0x67, 0x44, 0x45, 0x63, 0x5A,
-  0x67, 0x75, 0x2F, 0x63, 0x75, 0x79, 0x65, 0x50, 0x4A, 0x77, 0x34, 0x42, 0x63, 0x77, 0x52, 0x66,
-  0x39, 0x33, 0x56, 0x6D, 0x4E, 0x39, 0x56, 0x71, 0x69, 0x46, 0x33, 0x51, 0x50, 0x58, 0x42, 0x76,
-  0x45, 0x68, 0x36, 0x32, 0x34, 0x66, 0x61, 0x63, 0x35, 0x77, 0x6D, 0x32, 0x45, 0x67, 0x4F, 0x43,
-  0x67, 0x75, 0x38, 0x73, 0x63, 0x63, 0x58, 0x33, 0x4D, 0x44, 0x35, 0x49, 0x61, 0x4F, 0x35, 0x78,
-  0x48, 0x43, 0x59, 0x63, 0x78, 0x31, 0x58, 0x67, 0x77, 0x2B, 0x47, 0x42, 0x42, 0x4D, 0x46, 0x33,
-  0x6B, 0x61, 0x46, 0x4E, 0x2F, 0x42, 0x49, 0x30, 0x6C, 0x68, 0x51, 0x54, 0x48, 0x5A, 0x38, 0x54,
-  0x50, 0x38, 0x73, 0x45, 0x6D, 0x44, 0x6B, 0x6F, 0x6A, 0x6A, 0x4A, 0x4E, 0x44, 0x41, 0x77, 0x75,
-  0x67, 0x73, 0x62, 0x30, 0x4F, 0x66, 0x42, 0x76, 0x76, 0x68, 0x35, 0x33, 0x67, 0x77, 0x59, 0x71,
-  0x44, 0x62, 0x33, 0x44, 0x54, 0x4E, 0x58, 0x65, 0x39, 0x36, 0x6F, 0x76, 0x71, 0x6C, 0x30, 0x4D,
-  0x2B, 0x6C, 0x76, 0x66, 0x6A, 0x64, 0x64, 0x44, 0x4B, 0x5A, 0x41, 0x4A, 0x44, 0x2F, 0x59, 0x4E,
-  0x68, 0x39, 0x53, 0x54, 0x47, 0x6A, 0x2F, 0x62, 0x64, 0x56, 0x39, 0x58, 0x50, 0x39, 0x77, 0x48,
-  0x2F, 0x76, 0x37, 0x48, 0x74, 0x4B, 0x54, 0x44, 0x71, 0x6F, 0x7A, 0x62, 0x2F, 0x76, 0x57, 0x70,
-  0x69, 0x33, 0x75, 0x43, 0x48, 0x44, 0x4F, 0x79, 0x74, 0x70, 0x63, 0x70, 0x41, 0x62, 0x6A, 0x4B,
-  0x39, 0x46, 0x2F, 0x66, 0x70, 0x74, 0x6A, 0x68, 0x35, 0x41, 0x2F, 0x48, 0x64, 0x32, 0x4F, 0x6E,
-  0x5A, 0x51, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
-  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x43, 0x43,
-  0x2F, 0x45, 0x2B, 0x41, 0x41, 0x51, 0x44, 0x6D, 0x55, 0x39, 0x4B, 0x6E, 0x57, 0x39, 0x2F, 0x31,
-  0x4E, 0x51, 0x41, 0x41, 0x41, 0x41, 0x42, 0x4A, 0x52, 0x55, 0x35, 0x45, 0x72, 0x6B, 0x4A, 0x67,
-  0x67, 0x67, 0x3D, 0x3D, 0x22, 0x7D, 0x2C, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64,
-  0x65, 0x62, 0x61, 0x72, 0x3A, 0x63, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28,
-  0x70, 0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x2C, 0x7B, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x22, 0x6D, 0x61, 0x69, 0x6E, 0x2D, 0x70,
-  0x61, 0x6E, 0x65, 0x6C, 0x22, 0x2C, 0x72, 0x65, 0x66, 0x3A, 0x61, 0x2C, 0x64, 0x61, 0x74, 0x61,
-  0x3A, 0x65, 0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x6B, 0x2C, 0x7B, 0x62, 0x72,
-  0x61, 0x6E, 0x64, 0x54, 0x65, 0x78, 0x74, 0x3A, 0x62, 0x28, 0x74, 0x2E, 0x70, 0x61, 0x74, 0x68,
-  0x6E, 0x61, 0x6D, 0x65, 0x29, 0x2C, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x53, 0x69, 0x64, 0x65,
-  0x62, 0x61, 0x72, 0x3A, 0x63, 0x2C, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72, 0x4F, 0x70, 0x65,
-  0x6E, 0x65, 0x64, 0x3A, 0x73, 0x7D, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x73, 0x29, 0x28, 0x64, 0x2E, 0x64, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C,
-  0x64, 0x72, 0x65, 0x6E, 0x3A, 0x5B, 0x28, 0x6F, 0x3D, 0x5F, 0x2C, 0x6F, 0x2E, 0x6D, 0x61, 0x70,
-  0x28, 0x28, 0x28, 0x65, 0x2C, 0x74, 0x29, 0x3D, 0x3E, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E,
-  0x22, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3F, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x64, 0x2E, 0x62, 0x2C, 0x7B,
-  0x70, 0x61, 0x74, 0x68, 0x3A, 0x65, 0x2E, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x2B, 0x65, 0x2E,
-  0x70, 0x61, 0x74, 0x68, 0x2C, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3A, 0x65,
-  0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x7D, 0x2C, 0x74, 0x29, 0x3A, 0x6E,
-  0x75, 0x6C, 0x6C, 0x29, 0x29, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E,
-  0x6A, 0x73, 0x78, 0x29, 0x28, 0x64, 0x2E, 0x61, 0x2C, 0x7B, 0x66, 0x72, 0x6F, 0x6D, 0x3A, 0x22,
-  0x2A, 0x22, 0x2C, 0x74, 0x6F, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x2F, 0x68, 0x6F,
-  0x6D, 0x65, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x2C, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x44, 0x2C, 0x7B,
-  0x62, 0x67, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x65, 0x2C, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
-  0x42, 0x67, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x72, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x3B, 0x76,
-  0x61, 0x72, 0x20, 0x6F, 0x7D, 0x7D, 0x29, 0x7D, 0x3B, 0x69, 0x2E, 0x61, 0x2E, 0x72, 0x65, 0x6E,
-  0x64, 0x65, 0x72, 0x28, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x29, 0x28, 0x75, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x67, 0x2C, 0x7B, 0x63,
-  0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70,
-  0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x63, 0x2E, 0x61, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64,
-  0x72, 0x65, 0x6E, 0x3A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78,
-  0x73, 0x29, 0x28, 0x64, 0x2E, 0x64, 0x2C, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E,
-  0x3A, 0x5B, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x64, 0x2E, 0x62, 0x2C, 0x7B, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69,
-  0x6E, 0x22, 0x2C, 0x72, 0x65, 0x6E, 0x64, 0x65, 0x72, 0x3A, 0x65, 0x3D, 0x3E, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28, 0x59, 0x2C, 0x4F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x28, 0x72, 0x2E, 0x61, 0x29, 0x28, 0x7B, 0x7D, 0x2C, 0x65, 0x29, 0x29, 0x7D,
-  0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2E, 0x6A, 0x73, 0x78, 0x29, 0x28,
-  0x64, 0x2E, 0x61, 0x2C, 0x7B, 0x66, 0x72, 0x6F, 0x6D, 0x3A, 0x22, 0x2F, 0x22, 0x2C, 0x74, 0x6F,
-  0x3A, 0x22, 0x2F, 0x61, 0x64, 0x6D, 0x69, 0x6E, 0x2F, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61,
-  0x72, 0x64, 0x22, 0x7D, 0x29, 0x5D, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x64,
-  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-  0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x72, 0x6F, 0x6F, 0x74, 0x22, 0x29, 0x29, 0x7D,
-  0x2C, 0x38, 0x33, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x2C, 0x74,
-  0x2C, 0x61, 0x29, 0x7B, 0x7D, 0x2C, 0x38, 0x34, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
-  0x6E, 0x28, 0x65, 0x2C, 0x74, 0x2C, 0x61, 0x29, 0x7B, 0x7D, 0x2C, 0x38, 0x35, 0x3A, 0x66, 0x75,
-  0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x2C, 0x74, 0x2C, 0x61, 0x29, 0x7B, 0x7D, 0x7D,
-  0x2C, 0x5B, 0x5B, 0x31, 0x39, 0x35, 0x2C, 0x31, 0x2C, 0x32, 0x5D, 0x5D, 0x5D, 0x29, 0x3B
-};
+/* Web page main java script resources */
+extern const web_res_t js_main_res;
+
 #endif /* JS_MAIN_RES_H */
@@ -16,30 +16,37 @@
   **********************************************************************************************************************
   */
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page json resources buffer */
-const char json_buff[] =
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "res.h"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Web page json resources buffer, gzip content-encoding */
+static const char json_buff_gz[] =
 {
-  0x7B, 0x0A, 0x20, 0x20, 0x22, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x22,
-  0x3A, 0x20, 0x22, 0x52, 0x65, 0x61, 0x63, 0x74, 0x20, 0x41, 0x70, 0x70, 0x22, 0x2C, 0x0A, 0x20,
-  0x20, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
-  0x20, 0x52, 0x65, 0x61, 0x63, 0x74, 0x20, 0x41, 0x70, 0x70, 0x20, 0x53, 0x61, 0x6D, 0x70, 0x6C,
-  0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B,
-  0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x72,
-  0x63, 0x22, 0x3A, 0x20, 0x22, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67,
-  0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x69, 0x7A, 0x65, 0x73, 0x22,
-  0x3A, 0x20, 0x22, 0x36, 0x34, 0x78, 0x36, 0x34, 0x20, 0x33, 0x32, 0x78, 0x33, 0x32, 0x20, 0x32,
-  0x34, 0x78, 0x32, 0x34, 0x20, 0x31, 0x36, 0x78, 0x31, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x69, 0x6D, 0x61, 0x67,
-  0x65, 0x2F, 0x70, 0x6E, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x5D,
-  0x2C, 0x0A, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x75, 0x72, 0x6C, 0x22, 0x3A,
-  0x20, 0x22, 0x2E, 0x2F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x2C,
-  0x0A, 0x20, 0x20, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x3A, 0x20, 0x22, 0x73,
-  0x74, 0x61, 0x6E, 0x64, 0x61, 0x6C, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x74,
-  0x68, 0x65, 0x6D, 0x65, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x3A, 0x20, 0x22, 0x23, 0x30,
-  0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x62, 0x61, 0x63, 0x6B, 0x67,
-  0x72, 0x6F, 0x75, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x3A, 0x20, 0x22, 0x23,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x0A, 0x7D
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4D, 0x8E, 0xCF, 0x6E, 0xC2, 0x30,
+  0x0C, 0x87, 0xEF, 0x3C, 0x85, 0x15, 0xAE, 0x53, 0x19, 0xA5, 0xEA, 0x61, 0x37, 0xC4, 0x1B, 0xB0,
+  0x23, 0x42, 0xC8, 0x4B, 0x4D, 0x1B, 0x91, 0x7F, 0x4A, 0x03, 0x0A, 0x20, 0xDE, 0x9D, 0x38, 0x85,
+  0x6D, 0x3E, 0x58, 0x4A, 0xBE, 0xCF, 0xF6, 0xEF, 0x3E, 0x03, 0x10, 0xE3, 0xE0, 0x42, 0x3C, 0x58,
+  0x34, 0x24, 0xBE, 0x40, 0x6C, 0x09, 0x65, 0x84, 0xB5, 0xF7, 0xE2, 0x83, 0xE1, 0xFB, 0x7B, 0x13,
+  0x08, 0x23, 0xC1, 0x2F, 0x85, 0x6F, 0x34, 0x5E, 0xD3, 0x24, 0x29, 0xE9, 0xEC, 0x98, 0xAD, 0x5D,
+  0x7E, 0x00, 0xDC, 0x4B, 0xE7, 0xC5, 0x41, 0xF2, 0xE8, 0x11, 0x2F, 0x2C, 0x54, 0xDE, 0xF6, 0x45,
+  0x9F, 0x98, 0xBA, 0x11, 0x8F, 0x88, 0xB6, 0x49, 0x6D, 0x03, 0xAB, 0x3A, 0xAD, 0x6A, 0xA8, 0x9B,
+  0x54, 0x37, 0xB0, 0x6C, 0xD3, 0xB2, 0xFD, 0x33, 0xE3, 0xD5, 0x97, 0x04, 0xCA, 0x60, 0x4F, 0x0B,
+  0x5E, 0x52, 0xC8, 0x23, 0xF7, 0x7D, 0xB9, 0x3E, 0x46, 0xCC, 0xF9, 0xCF, 0x41, 0xB3, 0x55, 0x2D,
+  0x94, 0xED, 0x28, 0x55, 0x43, 0x34, 0x7A, 0x0A, 0xD7, 0xA9, 0xD1, 0x6B, 0xBC, 0x32, 0xCC, 0xA6,
+  0xED, 0x50, 0x3B, 0xFB, 0xCA, 0x1D, 0x07, 0x32, 0x74, 0x90, 0x4E, 0xBB, 0xC0, 0x78, 0xFE, 0x59,
+  0x6A, 0x62, 0x3F, 0x28, 0x4F, 0x7D, 0x70, 0x67, 0xDB, 0xFD, 0x13, 0x8E, 0xA5, 0xC4, 0xEC, 0xF1,
+  0x04, 0xBD, 0xC7, 0xB9, 0x72, 0x39, 0x01, 0x00, 0x00
 };
 
-const unsigned long json_buff_size = sizeof(json_buff);
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Web page json resources, 313 bytes (gzip 217 bytes) */
+const web_res_t json_res =
+{
+  NULL,
+  0U,
+  json_buff_gz,
+  sizeof(json_buff_gz),
+  NULL,
+  "\"14e8d1fc8527abd7-gz\""
+};
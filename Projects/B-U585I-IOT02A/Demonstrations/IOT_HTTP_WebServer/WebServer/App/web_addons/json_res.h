@@ -2,7 +2,7 @@
   **********************************************************************************************************************
   * @file    json_res.h
   * @author  MCD Application Team
-  * @brief   This file implements the web page json resources
+  * @brief   header file for json_res.c
   **********************************************************************************************************************
   * @attention
   *
@@ -21,29 +21,7 @@
 #define JSON_RES_H
 
 /* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page json resources buffer */
-static const char json_buff[] =
-{
-  0x7B, 0x0A, 0x20, 0x20, 0x22, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x22,
-  0x3A, 0x20, 0x22, 0x52, 0x65, 0x61, 0x63, 0x74, 0x20, 0x41, 0x70, 0x70, 0x22, 0x2C, 0x0A, 0x20,
-  0x20, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
-  0x20, 0x52, 0x65, 0x61, 0x63, 0x74, 0x20, 0x41, 0x70, 0x70, 0x20, 0x53, 0x61, 0x6D, 0x70, 0x6C,
-  0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x73, 0x22, 0x3A, 0x20, 0x5B,
-  0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x72,
-  0x63, 0x22, 0x3A, 0x20, 0x22, 0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67,
-  0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x69, 0x7A, 0x65, 0x73, 0x22,
-  0x3A, 0x20, 0x22, 0x36, 0x34, 0x78, 0x36, 0x34, 0x20, 0x33, 0x32, 0x78, 0x33, 0x32, 0x20, 0x32,
-  0x34, 0x78, 0x32, 0x34, 0x20, 0x31, 0x36, 0x78, 0x31, 0x36, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3A, 0x20, 0x22, 0x69, 0x6D, 0x61, 0x67,
-  0x65, 0x2F, 0x70, 0x6E, 0x67, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x5D,
-  0x2C, 0x0A, 0x20, 0x20, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0x75, 0x72, 0x6C, 0x22, 0x3A,
-  0x20, 0x22, 0x2E, 0x2F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x2C,
-  0x0A, 0x20, 0x20, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x3A, 0x20, 0x22, 0x73,
-  0x74, 0x61, 0x6E, 0x64, 0x61, 0x6C, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x74,
-  0x68, 0x65, 0x6D, 0x65, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x3A, 0x20, 0x22, 0x23, 0x30,
-  0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x22, 0x62, 0x61, 0x63, 0x6B, 0x67,
-  0x72, 0x6F, 0x75, 0x6E, 0x64, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x3A, 0x20, 0x22, 0x23,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x0A, 0x7D
-};
+/* Web page json resources */
+extern const web_res_t json_res;
 
 #endif /* JSON_RES_H */
@@ -20,41 +20,35 @@
 #ifndef RES_H
 #define RES_H
 
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page main css resources buffer */
-extern const char     css_main_buff[];
-extern const uint32_t css_main_buff_size;
-
-/* Web page shunk css resources buffer */
-extern const char     css_shunk_buff[];
-extern const uint32_t css_shunk_buff_size;
-
-/* Web page favicon resources buffer */
-extern const char     favicon_buff[];
-extern const uint32_t favicon_buff_size;
-
-/* Web page font resources buffer */
-extern const char     font_buff[];
-extern const uint32_t font_buff_size;
-
-/* Web page html resources buffer */
-extern const char     html_buff[];
-extern const uint32_t html_buff_size;
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
 
-/* Web page html image buffer */
-extern const char     image_buff[];
-extern const uint32_t image_buff_size;
-
-/* Web page main java script resources buffer */
-extern const char     js_main_buff[];
-extern const uint32_t js_main_buff_size;
-
-/* Web page shunk java script resources buffer */
-extern const char     js_shunk_buff[];
-extern const uint32_t js_shunk_buff_size;
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Web resource, generated by res_packer.py
+  *         A representation is NULL when it is not stored: the identity one for compressed resources (unless packed
+  *         with --keep-identity), the gzip one when compression does not pay off.
+  */
+typedef struct
+{
+  const char *buff;       /* Identity representation */
+  uint32_t   size;
+  const char *gzip_buff;  /* gzip content-encoding representation */
+  uint32_t   gzip_size;
+  const char *etag;       /* Quoted strong entity tag of the identity representation */
+  const char *gzip_etag;  /* Quoted strong entity tag of the gzip representation */
+} web_res_t;
 
-/* Web page json resources buffer */
-extern const char     json_buff[];
-extern const uint32_t json_buff_size;
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+#include "css_main_res.h"
+#include "css_shunk_res.h"
+#include "favicon_res.h"
+#include "font_res.h"
+#include "html_res.h"
+#include "image_res.h"
+#include "js_main_res.h"
+#include "js_shunk_res.h"
+#include "json_res.h"
 
 #endif /* RES_H */
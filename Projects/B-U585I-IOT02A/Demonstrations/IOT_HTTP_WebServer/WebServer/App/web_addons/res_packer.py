@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    res_packer.py
+#  @author  MCD Application Team
+#  @brief   Web resources packer, generates the *_res.c / *_res.h files of the web server from the Fs directory
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+Each resource is stored as a web_res_t descriptor (see res.h):
+ - a gzip representation, when compression saves at least MIN_GAIN_PERCENT of the size,
+ - the identity representation, only when not compressed or when --keep-identity is given: the clients which do not
+   accept gzip otherwise get 406 Not Acceptable for the compressed resources,
+ - a strong entity tag per representation, derived from the SHA-256 of the content.
+
+The default input is the Fs directory of the demonstration. The license banners of the HTML, CSS and JS files and
+their source map references are not served: they are stripped before packing, as in the original embedded copies.
+
+Usage: python res_packer.py [--fs <Fs directory>] [--out <web_addons directory>] [--keep-identity]
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+
+# Symbol, description, path in the Fs directory, text resource
+RESOURCES = [
+    ("html",      "html",                "index.html",                      True),
+    ("css_main",  "main css",            "static/css/main.css",             True),
+    ("css_shunk", "shunk css",           "static/css/chunk.css",            True),
+    ("js_main",   "main java script",    "static/js/main.js",               True),
+    ("js_shunk",  "shunk java script",   "static/js/chunk.js",              True),
+    ("favicon",   "favicon",             "favicon.png",                     False),
+    ("font",      "font",                "static/media/fa-solid-900.woff2", False),
+    ("image",     "image",               "static/media/FLSTM32U5.jpg",      False),
+    ("json",      "json",                "manifest.json",                   True),
+]
+
+# Leading license banners (/*! ... */ or <!-- ... -->) and trailing source map references of the text resources
+BANNER = re.compile(rb"\A(?:/\*!.*?\*/\n?|<!--.*?-->\n?)+", re.S)
+SOURCE_MAP = re.compile(rb"\n(?:/\*# sourceMappingURL=[^\n]*\*/|//# sourceMappingURL=[^\n]*)\Z")
+
+MIN_GAIN_PERCENT = 10
+ETAG_HASH_LEN = 16
+
+LICENSE = """/**
+  **********************************************************************************************************************
+  * @file    {file}
+  * @author  MCD Application Team
+  * @brief   {brief}
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+"""
+
+
+def section(title):
+    prefix = "/* %s " % title
+    return prefix + "-" * (120 - len(prefix) - 2) + "*/\n"
+
+
+def c_array(name, data):
+    lines = ["static const char %s[] =" % name, "{"]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02X" % b for b in data[i:i + 16])
+        lines.append("  " + chunk + ("," if i + 16 < len(data) else ""))
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def etag(data, suffix=""):
+    return "\\\"%s%s\\\"" % (hashlib.sha256(data).hexdigest()[:ETAG_HASH_LEN], suffix)
+
+
+def strip(data):
+    return SOURCE_MAP.sub(b"", BANNER.sub(b"", data)).rstrip(b"\n")
+
+
+def pack(symbol, desc, data, keep_identity):
+    # mtime=0 makes the output reproducible
+    gz = gzip.compress(data, compresslevel=9, mtime=0)
+    use_gzip = len(gz) * 100 <= len(data) * (100 - MIN_GAIN_PERCENT)
+    use_identity = keep_identity or not use_gzip
+
+    src = LICENSE.format(file="%s_res.c" % symbol, brief="This file implements the web page %s resources" % desc)
+    src += "\n" + section("Includes")
+    src += "#include \"res.h\"\n\n"
+    src += section("Private variables")
+    fields = []
+    if use_identity:
+        src += "/* Web page %s resources buffer */\n" % desc
+        src += c_array("%s_buff" % symbol, data) + "\n"
+        fields += ["%s_buff" % symbol, "sizeof(%s_buff)" % symbol]
+    else:
+        fields += ["NULL", "0U"]
+    if use_gzip:
+        src += "/* Web page %s resources buffer, gzip content-encoding */\n" % desc
+        src += c_array("%s_buff_gz" % symbol, gz) + "\n"
+        fields += ["%s_buff_gz" % symbol, "sizeof(%s_buff_gz)" % symbol]
+    else:
+        fields += ["NULL", "0U"]
+    fields += ["\"%s\"" % etag(data) if use_identity else "NULL",
+               "\"%s\"" % etag(data, "-gz") if use_gzip else "NULL"]
+
+    src += section("Exported variables")
+    src += "/* Web page %s resources, %u bytes (%s) */\n" % (
+        desc, len(data), ("gzip %u bytes" % len(gz)) if use_gzip else "not compressed")
+    src += "const web_res_t %s_res =\n{\n" % symbol
+    src += ",\n".join("  " + f for f in fields) + "\n};\n"
+
+    guard = "%s_RES_H" % symbol.upper()
+    hdr = LICENSE.format(file="%s_res.h" % symbol, brief="header file for %s_res.c" % symbol)
+    hdr += "\n" + section("Define to prevent recursive inclusion")
+    hdr += "#ifndef %s\n#define %s\n\n" % (guard, guard)
+    hdr += section("Exported variables")
+    hdr += "/* Web page %s resources */\n" % desc
+    hdr += "extern const web_res_t %s_res;\n\n" % symbol
+    hdr += "#endif /* %s */\n" % guard
+    return src, hdr, (len(data) if use_identity else 0) + (len(gz) if use_gzip else 0)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="Pack the web server resources")
+    parser.add_argument("--fs", default=os.path.join(here, "..", "..", "..", "Fs"), help="web resources directory")
+    parser.add_argument("--out", default=here, help="output directory")
+    parser.add_argument("--keep-identity", action="store_true",
+                        help="also store the identity representation of the compressed resources, for the clients "
+                             "which do not accept gzip, at the cost of flash")
+    args = parser.parse_args()
+
+    total = 0
+    for symbol, desc, path, text in RESOURCES:
+        with open(os.path.join(args.fs, path), "rb") as f:
+            data = f.read()
+        if text:
+            data = strip(data)
+        src, hdr, stored = pack(symbol, desc, data, args.keep_identity)
+        with open(os.path.join(args.out, "%s_res.c" % symbol), "w", newline="\n") as f:
+            f.write(src)
+        with open(os.path.join(args.out, "%s_res.h" % symbol), "w", newline="\n") as f:
+            f.write(hdr)
+        total += stored
+        print("%-10s %8u bytes, %8u bytes stored" % (symbol, len(data), stored))
+    print("%-10s %8s        %8u bytes stored" % ("total", "", total))
+
+
+if __name__ == "__main__":
+    main()
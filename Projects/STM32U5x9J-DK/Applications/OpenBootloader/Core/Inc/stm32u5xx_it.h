@@ -38,6 +38,7 @@ void UsageFault_Handler(void);
 void DebugMon_Handler(void);
 
 void SPI3_IRQHandler(void);
+void FLASH_IRQHandler(void);
 void TIM6_IRQHandler(void);
 void OTG_HS_IRQHandler(void);
 
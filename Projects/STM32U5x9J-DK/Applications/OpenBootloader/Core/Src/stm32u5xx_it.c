@@ -22,6 +22,7 @@
 #include "main.h"
 #include "stm32u5xx_it.h"
 #include "spi_interface.h"
+#include "flash_interface.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -123,6 +124,16 @@ void SPI3_IRQHandler(void)
   OPENBL_SPI_IRQHandler();
 }
 
+#if (OPENBL_FLASH_PIPELINE == 1U)
+/**
+  * @brief This function handles FLASH non-secure global interrupt.
+  */
+void FLASH_IRQHandler(void)
+{
+  OPENBL_FLASH_IRQHandler();
+}
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+
 /**
   * @brief This function handles TIM6 global interrupt.
   */
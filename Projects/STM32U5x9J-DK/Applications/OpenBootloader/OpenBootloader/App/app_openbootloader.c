@@ -103,6 +103,9 @@ static OPENBL_OpsTypeDef IWDG_Ops =
 uint16_t SpecialCmdList[SPECIAL_CMD_MAX_NUMBER] =
 {
   SPECIAL_CMD_DEFAULT
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  , SPECIAL_CMD_DOWNLOAD_STATS
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
 };
 
 uint16_t ExtendedSpecialCmdList[EXTENDED_SPECIAL_CMD_MAX_NUMBER] =
@@ -26,12 +26,14 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include "common_interface.h"
+#include "openbootloader_conf.h"
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
 #define FLASH_BUSY_STATE_ENABLED       0xAAAA0000U
 #define FLASH_BUSY_STATE_DISABLED      0x0000DDDDU
 #define PROGRAM_TIMEOUT                0x00FFFFFFU
+#define FLASH_STATISTICS_SIZE          24U  /* Size of the download statistics report */
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
@@ -48,6 +50,14 @@ ErrorStatus OPENBL_FLASH_SetWriteProtection(FunctionalState State, uint8_t *pLis
 uint32_t OPENBL_FLASH_GetReadOutProtectionLevel(void);
 void OPENBL_Enable_BusyState_Flag(void);
 void OPENBL_Disable_BusyState_Flag(void);
+void OPENBL_FLASH_Flush(void);
+void OPENBL_FLASH_SetSynchronousWrite(void);
+#if (OPENBL_FLASH_PIPELINE == 1U)
+void OPENBL_FLASH_IRQHandler(void);
+#endif /* (OPENBL_FLASH_PIPELINE == 1U) */
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+uint32_t OPENBL_FLASH_GetStatistics(uint8_t *pData);
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
 
 #ifdef __cplusplus
 }
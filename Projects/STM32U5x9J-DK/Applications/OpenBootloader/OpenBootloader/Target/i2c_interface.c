@@ -392,6 +392,12 @@ __attribute__((section(".ramfunc"))) void OPENBL_I2C_SendBusyByte(void)
   */
 void OPENBL_I2C_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 {
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint8_t statistics[FLASH_STATISTICS_SIZE];
+  uint32_t length;
+  uint32_t index;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
   switch (pSpecialCmd->OpCode)
   {
     case SPECIAL_CMD_DEFAULT:
@@ -429,6 +435,36 @@ void OPENBL_I2C_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 
       break;
 
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    case SPECIAL_CMD_DOWNLOAD_STATS:
+      if (pSpecialCmd->CmdType == OPENBL_SPECIAL_CMD)
+      {
+        length = OPENBL_FLASH_GetStatistics(statistics);
+
+        /* Send data size */
+        OPENBL_I2C_SendByte((uint8_t)(length >> 8U));
+        OPENBL_I2C_SendByte((uint8_t)length);
+
+        /* Wait for address to match */
+        OPENBL_I2C_WaitAddress();
+
+        /* Send the download statistics */
+        for (index = 0U; index < length; index++)
+        {
+          OPENBL_I2C_SendByte(statistics[index]);
+        }
+
+        /* Wait for address to match */
+        OPENBL_I2C_WaitAddress();
+
+        /* Send NULL status size */
+        OPENBL_I2C_SendByte(0x00U);
+        OPENBL_I2C_SendByte(0x00U);
+      }
+
+      break;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
     default:
       break;
   }
@@ -47,6 +47,14 @@ extern "C" {
 #define USARTx_RX_GPIO_PORT               GPIOA
 #define USARTx_ALTERNATE                  GPIO_AF7_USART1
 
+#define USARTx_RX_DMA                     0U  /* 1: USARTx reception through a circular GPDMA buffer */
+#define USARTx_RX_BUFFER_SIZE             1024U
+#define USARTx_DMA_CHANNEL                GPDMA1_Channel0
+#define USARTx_DMA_REQUEST                GPDMA1_REQUEST_USART1_RX
+#define USARTx_DMA_CLK_ENABLE()           __HAL_RCC_GPDMA1_CLK_ENABLE()
+#define USARTx_DMA_DEINIT()               do { __HAL_RCC_GPDMA1_FORCE_RESET(); \
+                                               __HAL_RCC_GPDMA1_RELEASE_RESET(); } while(0)
+
 /*-------------------------- Definitions for I2C -----------------------------*/
 #define I2Cx                              I2C1
 #define I2Cx_CLK_ENABLE()                 __HAL_RCC_I2C1_CLK_ENABLE()
@@ -101,6 +109,14 @@ extern "C" {
 #define SPIx_SCK_PIN_PORT                 GPIOG
 #define SPIx_NSS_PIN                      GPIO_PIN_15
 #define SPIx_NSS_PIN_PORT                 GPIOG
+#define SPIx_RX_DMA                       0U  /* 1: SPIx reception through a circular GPDMA buffer */
+#define SPIx_RX_BUFFER_SIZE               1024U
+#define SPIx_DMA_CHANNEL                  GPDMA1_Channel1
+#define SPIx_DMA_REQUEST                  GPDMA1_REQUEST_SPI3_RX
+#define SPIx_DMA_CLK_ENABLE()             __HAL_RCC_GPDMA1_CLK_ENABLE()
+#define SPIx_DMA_DEINIT()                 do { __HAL_RCC_GPDMA1_FORCE_RESET(); \
+                                               __HAL_RCC_GPDMA1_RELEASE_RESET(); } while(0)
+
 #define SPIx_ALTERNATE                    GPIO_AF6_SPI3
 
 #ifdef __cplusplus
@@ -24,6 +24,7 @@
 #include "openbl_mem.h"
 
 #include "app_openbootloader.h"
+#include "flash_interface.h"
 #include "optionbytes_interface.h"
 
 /* Private typedef -----------------------------------------------------------*/
@@ -78,6 +79,9 @@ uint8_t OPENBL_OB_Read(uint32_t Address)
   */
 void OPENBL_OB_Write(uint32_t Address, uint8_t *pData, uint32_t DataLength)
 {
+  /* Wait for the end of the FLASH programming */
+  OPENBL_FLASH_Flush();
+
   /* Unlock the FLASH & Option Bytes Registers access */
   if (HAL_FLASH_Unlock() != HAL_OK)
   {
@@ -27,6 +27,7 @@
 #include "app_openbootloader.h"
 #include "spi_interface.h"
 #include "iwdg_interface.h"
+#include "flash_interface.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -39,6 +40,15 @@
 static __IO uint8_t SpiRxNotEmpty = 0U;
 static uint8_t SpiDetected        = 0U;
 
+#if (SPIx_RX_DMA == 1U)
+static DMA_HandleTypeDef SpiDmaHandle;
+static DMA_NodeTypeDef SpiDmaNode;
+static DMA_QListTypeDef SpiDmaQueue;
+static uint8_t SpiRxBuffer[SPIx_RX_BUFFER_SIZE];
+static uint32_t SpiRxIndex = 0U;
+static uint8_t SpiDmaStarted = 0U;
+#endif /* (SPIx_RX_DMA == 1U) */
+
 /* Exported variables --------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static void OPENBL_SPI_Init(void);
@@ -47,6 +57,14 @@ __ramfunc void OPENBL_SPI_ClearFlag_OVR(void);
 #else
 __attribute__((section(".ramfunc"))) void OPENBL_SPI_ClearFlag_OVR(void);
 #endif /* (__ICCARM__) */
+#if (SPIx_RX_DMA == 1U)
+static void OPENBL_SPI_DMA_Init(void);
+#if defined (__ICCARM__)
+__ramfunc static uint8_t OPENBL_SPI_DMA_ReadByte(void);
+#else
+__attribute__((section(".ramfunc"))) static uint8_t OPENBL_SPI_DMA_ReadByte(void);
+#endif /* (__ICCARM__) */
+#endif /* (SPIx_RX_DMA == 1U) */
 
 /* Private functions ---------------------------------------------------------*/
 
@@ -96,6 +114,111 @@ static void OPENBL_SPI_Init(void)
   LL_SPI_Enable(SPIx);
 }
 
+#if (SPIx_RX_DMA == 1U)
+/**
+  * @brief  This function is used to start the SPIx reception in a circular buffer through GPDMA.
+  *         The bytes received while the CPU is stalled by a FLASH operation are not lost.
+  * @retval None.
+  */
+static void OPENBL_SPI_DMA_Init(void)
+{
+  DMA_NodeConfTypeDef node_config = {0U};
+
+  SPIx_DMA_CLK_ENABLE();
+
+  /* Single node looping on itself: SPIx RXDR to the circular reception buffer */
+  node_config.NodeType                            = DMA_GPDMA_LINEAR_NODE;
+  node_config.Init.Request                        = SPIx_DMA_REQUEST;
+  node_config.Init.BlkHWRequest                   = DMA_BREQ_SINGLE_BURST;
+  node_config.Init.Direction                      = DMA_PERIPH_TO_MEMORY;
+  node_config.Init.SrcInc                         = DMA_SINC_FIXED;
+  node_config.Init.DestInc                        = DMA_DINC_INCREMENTED;
+  node_config.Init.SrcDataWidth                   = DMA_SRC_DATAWIDTH_BYTE;
+  node_config.Init.DestDataWidth                  = DMA_DEST_DATAWIDTH_BYTE;
+  node_config.Init.SrcBurstLength                 = 1U;
+  node_config.Init.DestBurstLength                = 1U;
+  node_config.Init.Priority                       = DMA_HIGH_PRIORITY;
+  node_config.Init.TransferEventMode              = DMA_TCEM_BLOCK_TRANSFER;
+  node_config.Init.TransferAllocatedPort          = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+  node_config.DataHandlingConfig.DataExchange     = DMA_EXCHANGE_NONE;
+  node_config.DataHandlingConfig.DataAlignment    = DMA_DATA_RIGHTALIGN_ZEROPADDED;
+  node_config.TriggerConfig.TriggerPolarity       = DMA_TRIG_POLARITY_MASKED;
+  node_config.SrcAddress                          = (uint32_t)&(SPIx->RXDR);
+  node_config.DstAddress                          = (uint32_t)SpiRxBuffer;
+  node_config.DataSize                            = SPIx_RX_BUFFER_SIZE;
+
+  if (HAL_DMAEx_List_BuildNode(&node_config, &SpiDmaNode) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_InsertNode_Tail(&SpiDmaQueue, &SpiDmaNode) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_SetCircularMode(&SpiDmaQueue) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  SpiDmaHandle.Instance                         = SPIx_DMA_CHANNEL;
+  SpiDmaHandle.InitLinkedList.Priority          = DMA_HIGH_PRIORITY;
+  SpiDmaHandle.InitLinkedList.LinkStepMode      = DMA_LSM_FULL_EXECUTION;
+  SpiDmaHandle.InitLinkedList.LinkAllocatedPort = DMA_LINK_ALLOCATED_PORT1;
+  SpiDmaHandle.InitLinkedList.TransferEventMode = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+  SpiDmaHandle.InitLinkedList.LinkedListMode    = DMA_LINKEDLIST_CIRCULAR;
+
+  if (HAL_DMAEx_List_Init(&SpiDmaHandle) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_LinkQ(&SpiDmaHandle, &SpiDmaQueue) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (HAL_DMAEx_List_Start(&SpiDmaHandle) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* The SPIx configuration registers are write protected while SPIx is enabled */
+  LL_SPI_Disable(SPIx);
+  LL_SPI_EnableDMAReq_RX(SPIx);
+  LL_SPI_Enable(SPIx);
+
+  SpiRxIndex    = 0U;
+  SpiDmaStarted = 1U;
+}
+
+/**
+  * @brief  This function is used to read one byte from the SPIx GPDMA reception buffer.
+  * @retval Returns the read byte.
+  */
+#if defined (__ICCARM__)
+__ramfunc static uint8_t OPENBL_SPI_DMA_ReadByte(void)
+#else
+__attribute__((section(".ramfunc"))) static uint8_t OPENBL_SPI_DMA_ReadByte(void)
+#endif /* (__ICCARM__) */
+{
+  uint8_t data;
+
+  /* Wait until the GPDMA has written beyond the read index */
+  while (((SPIx_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&SpiDmaHandle)) % SPIx_RX_BUFFER_SIZE) == SpiRxIndex)
+  {
+    /* Refresh IWDG: reload counter */
+    IWDG->KR = IWDG_KEY_RELOAD;
+  }
+
+  data       = SpiRxBuffer[SpiRxIndex];
+  SpiRxIndex = (SpiRxIndex + 1U) % SPIx_RX_BUFFER_SIZE;
+
+  return data;
+}
+#endif /* (SPIx_RX_DMA == 1U) */
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -188,9 +311,17 @@ uint8_t OPENBL_SPI_ProtocolDetection(void)
     {
       SpiDetected = 1U;
 
+#if (SPIx_RX_DMA == 1U)
+      /* The next bytes are received through GPDMA */
+      OPENBL_SPI_DMA_Init();
+#else
       /* Enable the interrupt of Rx not empty buffer */
       LL_SPI_EnableIT_RXP(SPIx);
 
+      /* The RX FIFO cannot hold a write packet while the CPU is stalled by a FLASH operation */
+      OPENBL_FLASH_SetSynchronousWrite();
+#endif /* (SPIx_RX_DMA == 1U) */
+
       /* Send synchronization byte */
       OPENBL_SPI_SendByte(SYNC_BYTE);
 
@@ -247,21 +378,30 @@ __attribute__((section(".ramfunc"))) uint8_t OPENBL_SPI_ReadByte(void)
 {
   uint8_t data;
 
-  /* Wait until SPIx Rx buffer not empty interrupt */
-  while (SpiRxNotEmpty == 0U)
+#if (SPIx_RX_DMA == 1U)
+  if (SpiDmaStarted != 0U)
   {
-    /* Refresh IWDG: reload counter */
-    IWDG->KR = IWDG_KEY_RELOAD;
+    data = OPENBL_SPI_DMA_ReadByte();
   }
+  else
+#endif /* (SPIx_RX_DMA == 1U) */
+  {
+    /* Wait until SPIx Rx buffer not empty interrupt */
+    while (SpiRxNotEmpty == 0U)
+    {
+      /* Refresh IWDG: reload counter */
+      IWDG->KR = IWDG_KEY_RELOAD;
+    }
 
-  /* Reset the RX not empty token */
-  SpiRxNotEmpty = 0U;
+    /* Reset the RX not empty token */
+    SpiRxNotEmpty = 0U;
 
-  /* Read the SPIx data register */
-  data = (uint8_t) SPIx->RXDR;
+    /* Read the SPIx data register */
+    data = (uint8_t) SPIx->RXDR;
 
-  /* Enable the interrupt of Rx not empty buffer */
-  SPIx->IER |= SPI_IER_RXPIE;
+    /* Enable the interrupt of Rx not empty buffer */
+    SPIx->IER |= SPI_IER_RXPIE;
+  }
 
   return data;
 }
@@ -277,24 +417,37 @@ __ramfunc void OPENBL_SPI_SendBusyByte(void)
 __attribute__((section(".ramfunc"))) void OPENBL_SPI_SendBusyByte(void)
 #endif /* (__ICCARM__) */
 {
-  /* Wait until SPIx Rx buffer not empty interrupt */
-  while (SpiRxNotEmpty == 0U)
+#if (SPIx_RX_DMA == 1U)
+  if (SpiDmaStarted != 0U)
   {
-    /* Refresh IWDG: reload counter */
-    IWDG->KR = IWDG_KEY_RELOAD;
+    /* Wait for the host byte, the GPDMA prevents the overrun */
+    (void)OPENBL_SPI_DMA_ReadByte();
+
+    /* Transmit the busy byte */
+    *((__IO uint8_t *)&SPIx->TXDR) = SPI_BUSY_BYTE;
   }
+  else
+#endif /* (SPIx_RX_DMA == 1U) */
+  {
+    /* Wait until SPIx Rx buffer not empty interrupt */
+    while (SpiRxNotEmpty == 0U)
+    {
+      /* Refresh IWDG: reload counter */
+      IWDG->KR = IWDG_KEY_RELOAD;
+    }
 
-  /* Reset the RX not empty token */
-  SpiRxNotEmpty = 0U;
+    /* Reset the RX not empty token */
+    SpiRxNotEmpty = 0U;
 
-  /* Transmit the busy byte */
-  *((__IO uint8_t *)&SPIx->TXDR) = SPI_BUSY_BYTE;
+    /* Transmit the busy byte */
+    *((__IO uint8_t *)&SPIx->TXDR) = SPI_BUSY_BYTE;
 
-  /* Read bytes from the host to avoid the overrun */
-  OPENBL_SPI_ClearFlag_OVR();
+    /* Read bytes from the host to avoid the overrun */
+    OPENBL_SPI_ClearFlag_OVR();
 
-  /* Enable the interrupt of Rx not empty buffer */
-  SPIx->IER |= SPI_IER_RXPIE;
+    /* Enable the interrupt of Rx not empty buffer */
+    SPIx->IER |= SPI_IER_RXPIE;
+  }
 }
 
 /**
@@ -425,6 +578,12 @@ __attribute__((section(".ramfunc"))) void OPENBL_SPI_ClearFlag_OVR(void)
   */
 void OPENBL_SPI_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 {
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+  uint8_t statistics[FLASH_STATISTICS_SIZE];
+  uint32_t length;
+  uint32_t index;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
   switch (pSpecialCmd->OpCode)
   {
     case SPECIAL_CMD_DEFAULT:
@@ -459,6 +618,30 @@ void OPENBL_SPI_SpecialCommandProcess(OPENBL_SpecialCmdTypeDef *pSpecialCmd)
 
       break;
 
+#if (OPENBL_DOWNLOAD_STATISTICS == 1U)
+    case SPECIAL_CMD_DOWNLOAD_STATS:
+      if (pSpecialCmd->CmdType == OPENBL_SPECIAL_CMD)
+      {
+        length = OPENBL_FLASH_GetStatistics(statistics);
+
+        /* Send data size */
+        OPENBL_SPI_SendByte((uint8_t)(length >> 8U));
+        OPENBL_SPI_SendByte((uint8_t)length);
+
+        /* Send the download statistics */
+        for (index = 0U; index < length; index++)
+        {
+          OPENBL_SPI_SendByte(statistics[index]);
+        }
+
+        /* Send NULL status size */
+        OPENBL_SPI_SendByte(0x00U);
+        OPENBL_SPI_SendByte(0x00U);
+      }
+
+      break;
+#endif /* (OPENBL_DOWNLOAD_STATISTICS == 1U) */
+
     default:
       break;
   }
@@ -39,6 +39,12 @@ typedef struct
 } ux_dfu_downloadInfotypeDef;
 
 /* Exported constants --------------------------------------------------------*/
+/* DFU download write-behind: a download block is copied in one of DFU_MEDIA_BUFFER_NUMBER buffers and the host
+   gets dfuDNLOAD_IDLE while it is programmed, dfuDNBUSY is only reported when all the buffers are used or while
+   a special command waits for the pending blocks. bwPollTimeout is computed from the pending FLASH operations. */
+#define DFU_MEDIA_WRITE_BEHIND            0U
+#define DFU_MEDIA_BUFFER_NUMBER           3U    /* Number of download buffers (USBD_DFU_XFER_SIZE bytes each) */
+
 /* Exported macro ------------------------------------------------------------*/
 
 /* Special Commands with Download Request */
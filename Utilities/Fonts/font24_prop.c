@@ -0,0 +1,477 @@
+/**
+  ******************************************************************************
+  * @file    font24_prop.c
+  * @author  MCD Application Team
+  * @brief   This file provides the proportional font Font24_Prop (sFONT_AA format) for the
+  *          stm32_lcd utility, generated by Utilities/PC_Software/LCD_FontConv from font24.c
+  *          with : python lcd_fontconv.py bitmap ../../Fonts/font24.c --name Font24_Prop --spacing 1
+  *          The glyphs of font24.c being 1-bpp, the coverages are 0 or 15 : not anti-aliased.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2014-2019 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+static const uint8_t Font24_Prop_Data[] =
+{
+  /* @0 '!' */
+  0x5A, 0x85, 0x0F, 0x00, 0xF0, 0x05, 0x45,
+  /* @7 '"' */
+  0x42, 0x01, 0x45, 0x01, 0x45, 0x01, 0x42, 0x81, 0x0F, 0x03, 0x83, 0xF0, 0x0F, 0x03, 0x83, 0xF0,
+  0x0F, 0x03, 0x83, 0xF0, 0x0F, 0x03, 0x81, 0xF0,
+  /* @31 '#' */
+  0x02, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41,
+  0x04, 0x41, 0x01, 0x41, 0x01, 0x55, 0x02, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x02, 0x55,
+  0x01, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41,
+  0x04, 0x41, 0x01, 0x41, 0x02,
+  /* @84 '$' */
+  0x03, 0x41, 0x06, 0x41, 0x04, 0x43, 0x83, 0x0F, 0xF0, 0x49, 0x03, 0x44, 0x03, 0x45, 0x06, 0x44,
+  0x04, 0x45, 0x05, 0x45, 0x04, 0x44, 0x03, 0x44, 0x02, 0x4A, 0x83, 0x0F, 0xF0, 0x43, 0x05, 0x41,
+  0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x02,
+  /* @123 '%' */
+  0x01, 0x43, 0x04, 0x45, 0x02, 0x42, 0x01, 0x42, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x01, 0x42, 0x01, 0x42, 0x02, 0x48, 0x01, 0x45, 0x01, 0x48, 0x02, 0x42, 0x01, 0x42, 0x01, 0x41,
+  0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x42, 0x01, 0x42, 0x02, 0x45, 0x04, 0x43, 0x01,
+  /* @170 '&' */
+  0x02, 0x45, 0x03, 0x46, 0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x08, 0x41, 0x09, 0x41, 0x08, 0x42,
+  0x06, 0x44, 0x01, 0x45, 0x00, 0x48, 0x02, 0x43, 0x01, 0x41, 0x03, 0x42, 0x02, 0x49, 0x01, 0x44,
+  0x00, 0x42,
+  /* @204 "'" */
+  0x48, 0x8B, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  /* @212 '(' */
+  0x03, 0x41, 0x02, 0x42, 0x01, 0x42, 0x01, 0x43, 0x01, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42,
+  0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42,
+  0x03, 0x42, 0x03, 0x41,
+  /* @248 ')' */
+  0x41, 0x03, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x02,
+  0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x42, 0x01, 0x43, 0x01, 0x42, 0x01,
+  0x42, 0x02, 0x41, 0x03,
+  /* @284 '*' */
+  0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x42, 0x83, 0x0F, 0xF0, 0x4C, 0x01, 0x45, 0x04, 0x43,
+  0x05, 0x43, 0x04, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x01,
+  /* @311 '+' */
+  0x04, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04, 0x57, 0x04, 0x41, 0x09, 0x41,
+  0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04,
+  /* @334 ',' */
+  0x01, 0x42, 0x01, 0x41, 0x01, 0x42, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02,
+  /* @349 '-' */
+  0x53,
+  /* @350 '.' */
+  0x4B,
+  /* @351 '/' */
+  0x07, 0x41, 0x07, 0x41, 0x06, 0x42, 0x06, 0x41, 0x06, 0x42, 0x06, 0x41, 0x07, 0x41, 0x06, 0x41,
+  0x07, 0x41, 0x06, 0x41, 0x07, 0x41, 0x06, 0x41, 0x07, 0x41, 0x06, 0x41, 0x07, 0x41, 0x06, 0x42,
+  0x06, 0x41, 0x06, 0x42, 0x06, 0x41, 0x07, 0x41, 0x07,
+  /* @392 '0' */
+  0x02, 0x43, 0x04, 0x45, 0x02, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x00, 0x41, 0x05, 0x43,
+  0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x41, 0x00, 0x41, 0x03, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x02, 0x45, 0x04, 0x43, 0x02,
+  /* @433 '1' */
+  0x04, 0x40, 0x05, 0x43, 0x03, 0x45, 0x03, 0x42, 0x00, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x53,
+  /* @463 '2' */
+  0x02, 0x44, 0x03, 0x48, 0x00, 0x42, 0x04, 0x41, 0x00, 0x41, 0x06, 0x43, 0x06, 0x41, 0x08, 0x41,
+  0x07, 0x41, 0x07, 0x41, 0x06, 0x42, 0x06, 0x42, 0x06, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x55,
+  /* @495 '3' */
+  0x02, 0x43, 0x03, 0x46, 0x02, 0x41, 0x02, 0x42, 0x07, 0x41, 0x07, 0x41, 0x06, 0x41, 0x04, 0x43,
+  0x05, 0x44, 0x07, 0x42, 0x08, 0x41, 0x07, 0x41, 0x07, 0x43, 0x04, 0x4B, 0x01, 0x45, 0x02,
+  /* @526 '4' */
+  0x05, 0x42, 0x06, 0x43, 0x06, 0x43, 0x05, 0x41, 0x00, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41,
+  0x01, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x01, 0x41,
+  0x04, 0x41, 0x01, 0x55, 0x06, 0x41, 0x05, 0x46, 0x03, 0x46,
+  /* @568 '5' */
+  0x00, 0x48, 0x01, 0x48, 0x01, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x43, 0x03, 0x48,
+  0x01, 0x42, 0x03, 0x41, 0x09, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x43, 0x05, 0x41, 0x00, 0x49,
+  0x02, 0x45, 0x02,
+  /* @603 '6' */
+  0x04, 0x44, 0x02, 0x46, 0x01, 0x42, 0x05, 0x42, 0x06, 0x41, 0x06, 0x41, 0x07, 0x41, 0x00, 0x43,
+  0x02, 0x48, 0x00, 0x42, 0x03, 0x41, 0x00, 0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x41, 0x00, 0x41,
+  0x03, 0x42, 0x00, 0x47, 0x03, 0x44, 0x01,
+  /* @642 '7' */
+  0x55, 0x05, 0x43, 0x04, 0x42, 0x06, 0x41, 0x07, 0x41, 0x06, 0x42, 0x06, 0x41, 0x07, 0x41, 0x06,
+  0x42, 0x06, 0x41, 0x07, 0x41, 0x06, 0x42, 0x06, 0x41, 0x07, 0x41, 0x03,
+  /* @670 '8' */
+  0x01, 0x45, 0x02, 0x47, 0x00, 0x42, 0x03, 0x44, 0x05, 0x43, 0x05, 0x41, 0x00, 0x41, 0x03, 0x41,
+  0x02, 0x45, 0x03, 0x45, 0x02, 0x41, 0x03, 0x41, 0x00, 0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x44,
+  0x03, 0x42, 0x00, 0x47, 0x02, 0x45, 0x01,
+  /* @709 '9' */
+  0x01, 0x44, 0x03, 0x47, 0x00, 0x42, 0x03, 0x41, 0x00, 0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x41,
+  0x00, 0x41, 0x03, 0x42, 0x00, 0x48, 0x02, 0x43, 0x00, 0x41, 0x07, 0x41, 0x06, 0x41, 0x06, 0x42,
+  0x05, 0x42, 0x01, 0x46, 0x02, 0x44, 0x04,
+  /* @748 ':' */
+  0x4B, 0x13, 0x4B,
+  /* @751 ';' */
+  0x01, 0x43, 0x01, 0x43, 0x01, 0x43, 0x19, 0x42, 0x01, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41,
+  0x03, 0x40, 0x04,
+  /* @770 '<' */
+  0x0A, 0x42, 0x09, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x0B, 0x43,
+  0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0A, 0x42,
+  /* @796 '=' */
+  0x59, 0x19, 0x59,
+  /* @799 '>' */
+  0x42, 0x0A, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x07, 0x43, 0x07,
+  0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x09, 0x42, 0x0A,
+  /* @825 '?' */
+  0x01, 0x44, 0x02, 0x46, 0x00, 0x41, 0x03, 0x44, 0x04, 0x43, 0x04, 0x41, 0x05, 0x42, 0x04, 0x42,
+  0x03, 0x43, 0x04, 0x42, 0x05, 0x41, 0x17, 0x42, 0x05, 0x42, 0x03,
+  /* @852 '@' */
+  0x02, 0x44, 0x03, 0x46, 0x01, 0x42, 0x02, 0x42, 0x00, 0x41, 0x04, 0x43, 0x03, 0x45, 0x02, 0x46,
+  0x01, 0x42, 0x00, 0x43, 0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x43,
+  0x02, 0x46, 0x03, 0x45, 0x08, 0x41, 0x07, 0x42, 0x03, 0x41, 0x01, 0x47, 0x02, 0x44, 0x01,
+  /* @899 'A' */
+  0x02, 0x45, 0x09, 0x46, 0x0C, 0x42, 0x0B, 0x41, 0x00, 0x41, 0x0A, 0x41, 0x00, 0x41, 0x09, 0x41,
+  0x02, 0x41, 0x08, 0x41, 0x02, 0x41, 0x07, 0x41, 0x03, 0x41, 0x07, 0x48, 0x05, 0x49, 0x05, 0x41,
+  0x06, 0x41, 0x03, 0x41, 0x07, 0x41, 0x01, 0x45, 0x02, 0x4C, 0x02, 0x46,
+  /* @943 'B' */
+  0x49, 0x02, 0x4A, 0x03, 0x41, 0x04, 0x42, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x41, 0x02,
+  0x41, 0x04, 0x42, 0x02, 0x48, 0x03, 0x49, 0x02, 0x41, 0x05, 0x42, 0x01, 0x41, 0x06, 0x41, 0x01,
+  0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x4D, 0x00, 0x4A, 0x01,
+  /* @985 'C' */
+  0x03, 0x44, 0x00, 0x41, 0x01, 0x49, 0x00, 0x42, 0x04, 0x42, 0x00, 0x41, 0x06, 0x43, 0x07, 0x43,
+  0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x0A, 0x41, 0x06, 0x41, 0x00, 0x42, 0x04, 0x42,
+  0x01, 0x48, 0x04, 0x45, 0x01,
+  /* @1022 'D' */
+  0x48, 0x03, 0x4A, 0x03, 0x41, 0x04, 0x42, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x06, 0x41, 0x01,
+  0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01,
+  0x41, 0x06, 0x41, 0x01, 0x41, 0x05, 0x41, 0x02, 0x41, 0x04, 0x42, 0x00, 0x4A, 0x01, 0x49, 0x02,
+  /* @1070 'E' */
+  0x57, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x05, 0x59,
+  /* @1111 'F' */
+  0x57, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+  0x41, 0x01, 0x41, 0x05, 0x45, 0x05, 0x45, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x05,
+  0x41, 0x09, 0x41, 0x07, 0x47, 0x03, 0x47, 0x03,
+  /* @1151 'G' */
+  0x03, 0x44, 0x00, 0x41, 0x02, 0x49, 0x01, 0x42, 0x04, 0x42, 0x01, 0x41, 0x06, 0x41, 0x00, 0x41,
+  0x07, 0x41, 0x00, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x03, 0x48, 0x03, 0x48, 0x07, 0x41, 0x00, 0x42,
+  0x06, 0x41, 0x01, 0x42, 0x04, 0x42, 0x02, 0x49, 0x04, 0x45, 0x02,
+  /* @1194 'H' */
+  0x45, 0x01, 0x4B, 0x01, 0x45, 0x01, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x49, 0x03, 0x49, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x01, 0x45, 0x01, 0x4B, 0x01, 0x45,
+  /* @1241 'I' */
+  0x53, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07,
+  0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x53,
+  /* @1264 'J' */
+  0x02, 0x49, 0x02, 0x49, 0x07, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x02, 0x41,
+  0x05, 0x41, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41,
+  0x04, 0x41, 0x03, 0x48, 0x05, 0x44, 0x05,
+  /* @1303 'K' */
+  0x46, 0x01, 0x44, 0x00, 0x46, 0x01, 0x44, 0x02, 0x41, 0x04, 0x41, 0x05, 0x41, 0x03, 0x41, 0x06,
+  0x41, 0x02, 0x41, 0x07, 0x41, 0x01, 0x41, 0x08, 0x41, 0x00, 0x42, 0x08, 0x46, 0x07, 0x42, 0x01,
+  0x42, 0x06, 0x41, 0x03, 0x42, 0x05, 0x41, 0x04, 0x41, 0x05, 0x41, 0x04, 0x42, 0x02, 0x46, 0x02,
+  0x4B, 0x02, 0x44,
+  /* @1354 'L' */
+  0x47, 0x04, 0x47, 0x07, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A,
+  0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x5B,
+  /* @1385 'M' */
+  0x43, 0x07, 0x48, 0x05, 0x44, 0x01, 0x42, 0x05, 0x42, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+  0x43, 0x03, 0x41, 0x89, 0x0F, 0xF0, 0x0F, 0xF0, 0xFF, 0x03, 0x41, 0x89, 0x0F, 0xF0, 0x0F, 0xF0,
+  0xFF, 0x03, 0x41, 0x01, 0x43, 0x01, 0x41, 0x03, 0x41, 0x01, 0x43, 0x01, 0x41, 0x03, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x03, 0x41, 0x07, 0x41, 0x03, 0x41, 0x07, 0x41, 0x01, 0x46, 0x01, 0x4D, 0x01,
+  0x46,
+  /* @1450 'N' */
+  0x43, 0x02, 0x4A, 0x02, 0x46, 0x01, 0x42, 0x04, 0x41, 0x03, 0x43, 0x03, 0x41, 0x03, 0x44, 0x02,
+  0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x03, 0x41, 0x00, 0x42, 0x01, 0x41, 0x03, 0x41, 0x01,
+  0x42, 0x00, 0x41, 0x03, 0x41, 0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x02, 0x44, 0x03, 0x41, 0x03,
+  0x43, 0x03, 0x41, 0x04, 0x42, 0x01, 0x46, 0x02, 0x41, 0x01, 0x46, 0x02, 0x41, 0x01,
+  /* @1512 'O' */
+  0x03, 0x43, 0x05, 0x47, 0x02, 0x42, 0x03, 0x42, 0x01, 0x41, 0x05, 0x41, 0x00, 0x42, 0x05, 0x44,
+  0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x44, 0x05, 0x42, 0x00, 0x41, 0x05, 0x41, 0x01, 0x42,
+  0x03, 0x42, 0x02, 0x47, 0x05, 0x43, 0x03,
+  /* @1551 'P' */
+  0x49, 0x01, 0x4A, 0x02, 0x41, 0x04, 0x42, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01,
+  0x41, 0x05, 0x41, 0x01, 0x41, 0x04, 0x41, 0x02, 0x48, 0x02, 0x46, 0x04, 0x41, 0x09, 0x41, 0x09,
+  0x41, 0x07, 0x47, 0x03, 0x47, 0x03,
+  /* @1589 'Q' */
+  0x03, 0x43, 0x05, 0x47, 0x02, 0x42, 0x03, 0x42, 0x01, 0x41, 0x05, 0x41, 0x00, 0x42, 0x05, 0x44,
+  0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x44, 0x05, 0x42, 0x00, 0x41, 0x05, 0x41, 0x01, 0x42,
+  0x03, 0x42, 0x02, 0x47, 0x04, 0x44, 0x06, 0x44, 0x01, 0x41, 0x01, 0x49, 0x01, 0x41, 0x03, 0x42,
+  0x00,
+  /* @1638 'R' */
+  0x49, 0x03, 0x4A, 0x04, 0x41, 0x04, 0x42, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03,
+  0x41, 0x04, 0x42, 0x03, 0x48, 0x04, 0x46, 0x06, 0x41, 0x02, 0x42, 0x05, 0x41, 0x03, 0x42, 0x04,
+  0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x42, 0x01, 0x46, 0x02, 0x4A, 0x03, 0x42,
+  /* @1683 'S' */
+  0x01, 0x44, 0x83, 0x0F, 0xF0, 0x4B, 0x03, 0x44, 0x05, 0x43, 0x05, 0x45, 0x06, 0x45, 0x05, 0x45,
+  0x06, 0x45, 0x05, 0x43, 0x05, 0x44, 0x03, 0x4B, 0x83, 0x0F, 0xF0, 0x44, 0x01,
+  /* @1712 'T' */
+  0x59, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02,
+  0x41, 0x04, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x06, 0x47, 0x03,
+  0x47, 0x01,
+  /* @1746 'U' */
+  0x45, 0x01, 0x4B, 0x01, 0x45, 0x01, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x04, 0x41, 0x03, 0x41, 0x05, 0x47, 0x07,
+  0x43, 0x04,
+  /* @1796 'V' */
+  0x46, 0x00, 0x4D, 0x00, 0x46, 0x01, 0x41, 0x06, 0x41, 0x04, 0x41, 0x04, 0x41, 0x05, 0x41, 0x04,
+  0x41, 0x05, 0x41, 0x04, 0x41, 0x06, 0x41, 0x02, 0x41, 0x07, 0x41, 0x02, 0x41, 0x08, 0x41, 0x00,
+  0x41, 0x09, 0x41, 0x00, 0x41, 0x09, 0x41, 0x00, 0x41, 0x0A, 0x42, 0x0B, 0x42, 0x0C, 0x40, 0x06,
+  /* @1844 'W' */
+  0x46, 0x02, 0x4D, 0x02, 0x46, 0x01, 0x41, 0x08, 0x41, 0x03, 0x41, 0x08, 0x41, 0x03, 0x41, 0x03,
+  0x40, 0x03, 0x41, 0x04, 0x41, 0x01, 0x42, 0x01, 0x41, 0x05, 0x41, 0x01, 0x42, 0x01, 0x41, 0x05,
+  0x41, 0x89, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0x04, 0x41, 0x89, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0x04,
+  0x43, 0x01, 0x44, 0x06, 0x42, 0x02, 0x42, 0x07, 0x42, 0x02, 0x42, 0x07, 0x41, 0x04, 0x41, 0x07,
+  0x41, 0x04, 0x41, 0x03,
+  /* @1912 'X' */
+  0x45, 0x01, 0x4B, 0x01, 0x45, 0x01, 0x41, 0x05, 0x41, 0x04, 0x41, 0x03, 0x41, 0x06, 0x41, 0x01,
+  0x41, 0x08, 0x43, 0x0A, 0x41, 0x0B, 0x41, 0x0A, 0x43, 0x08, 0x41, 0x01, 0x41, 0x06, 0x41, 0x03,
+  0x41, 0x04, 0x41, 0x05, 0x41, 0x01, 0x45, 0x01, 0x4B, 0x01, 0x45,
+  /* @1955 'Y' */
+  0x44, 0x02, 0x4A, 0x02, 0x45, 0x01, 0x41, 0x05, 0x41, 0x04, 0x41, 0x03, 0x41, 0x06, 0x41, 0x01,
+  0x41, 0x07, 0x41, 0x01, 0x41, 0x08, 0x43, 0x0A, 0x41, 0x0B, 0x41, 0x0B, 0x41, 0x0B, 0x41, 0x0B,
+  0x41, 0x08, 0x47, 0x05, 0x47, 0x02,
+  /* @1993 'Z' */
+  0x00, 0x49, 0x00, 0x49, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x04, 0x41, 0x01, 0x41, 0x03, 0x41,
+  0x02, 0x41, 0x02, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x41, 0x01, 0x41, 0x04, 0x41,
+  0x00, 0x41, 0x05, 0x43, 0x06, 0x57,
+  /* @2031 '[' */
+  0x4B, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x49,
+  /* @2060 '\\' */
+  0x41, 0x07, 0x41, 0x07, 0x42, 0x07, 0x41, 0x07, 0x42, 0x07, 0x41, 0x07, 0x41, 0x08, 0x41, 0x07,
+  0x41, 0x08, 0x41, 0x07, 0x41, 0x08, 0x41, 0x07, 0x41, 0x08, 0x41, 0x07, 0x41, 0x07, 0x42, 0x07,
+  0x41, 0x07, 0x42, 0x07, 0x41, 0x07, 0x41,
+  /* @2099 ']' */
+  0x49, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x4B,
+  /* @2128 '^' */
+  0x04, 0x40, 0x08, 0x42, 0x06, 0x44, 0x04, 0x42, 0x00, 0x42, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41,
+  0x04, 0x41, 0x00, 0x41, 0x06, 0x42, 0x08, 0x40,
+  /* @2152 '_' */
+  0x5F,
+  /* @2153 '`' */
+  0x41, 0x02, 0x42, 0x03, 0x42, 0x02, 0x41,
+  /* @2160 'a' */
+  0x01, 0x45, 0x04, 0x47, 0x0A, 0x41, 0x09, 0x41, 0x04, 0x46, 0x02, 0x48, 0x01, 0x42, 0x04, 0x41,
+  0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x04, 0x42, 0x02, 0x4A, 0x01, 0x44, 0x00, 0x43,
+  /* @2190 'b' */
+  0x43, 0x08, 0x43, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x00, 0x44, 0x04, 0x49, 0x02, 0x42, 0x04,
+  0x41, 0x02, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06,
+  0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x42, 0x04, 0x41, 0x00, 0x4B, 0x00, 0x43, 0x00, 0x44, 0x02,
+  /* @2238 'c' */
+  0x03, 0x44, 0x00, 0x41, 0x01, 0x49, 0x00, 0x42, 0x04, 0x45, 0x06, 0x43, 0x07, 0x43, 0x09, 0x41,
+  0x09, 0x42, 0x06, 0x41, 0x00, 0x42, 0x04, 0x42, 0x01, 0x48, 0x04, 0x45, 0x01,
+  /* @2267 'd' */
+  0x06, 0x43, 0x08, 0x43, 0x0A, 0x41, 0x0A, 0x41, 0x04, 0x44, 0x00, 0x41, 0x02, 0x49, 0x02, 0x41,
+  0x04, 0x42, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41,
+  0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x02, 0x41, 0x04, 0x42, 0x02, 0x4B, 0x02, 0x44, 0x00, 0x43,
+  /* @2315 'e' */
+  0x02, 0x45, 0x03, 0x49, 0x01, 0x41, 0x05, 0x41, 0x00, 0x41, 0x07, 0x5B, 0x09, 0x41, 0x0A, 0x41,
+  0x06, 0x41, 0x00, 0x4A, 0x02, 0x46, 0x01,
+  /* @2338 'f' */
+  0x04, 0x46, 0x03, 0x47, 0x02, 0x41, 0x09, 0x41, 0x06, 0x4A, 0x00, 0x4A, 0x03, 0x41, 0x09, 0x41,
+  0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x06, 0x49, 0x01, 0x49, 0x01,
+  /* @2369 'g' */
+  0x02, 0x44, 0x00, 0x43, 0x00, 0x4B, 0x00, 0x41, 0x04, 0x42, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41,
+  0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x02, 0x41,
+  0x04, 0x42, 0x02, 0x49, 0x04, 0x44, 0x00, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x09, 0x42, 0x03, 0x47,
+  0x04, 0x45, 0x04,
+  /* @2420 'h' */
+  0x43, 0x09, 0x43, 0x0B, 0x41, 0x0B, 0x41, 0x0B, 0x41, 0x00, 0x44, 0x05, 0x48, 0x04, 0x42, 0x03,
+  0x42, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x01, 0x45, 0x01, 0x4B, 0x01, 0x45,
+  /* @2467 'i' */
+  0x04, 0x41, 0x09, 0x41, 0x1D, 0x45, 0x05, 0x45, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41,
+  0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04, 0x57,
+  /* @2491 'j' */
+  0x04, 0x41, 0x06, 0x41, 0x13, 0x51, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+  0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x05, 0x4A, 0x00, 0x45,
+  0x02,
+  /* @2524 'k' */
+  0x43, 0x07, 0x43, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x01, 0x44, 0x02, 0x41, 0x01, 0x44, 0x02,
+  0x41, 0x01, 0x41, 0x05, 0x41, 0x00, 0x41, 0x06, 0x44, 0x06, 0x43, 0x07, 0x44, 0x06, 0x41, 0x00,
+  0x42, 0x05, 0x41, 0x01, 0x42, 0x02, 0x43, 0x02, 0x48, 0x02, 0x44,
+  /* @2567 'l' */
+  0x00, 0x45, 0x05, 0x45, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41,
+  0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04, 0x57,
+  /* @2595 'm' */
+  0x43, 0x00, 0x42, 0x00, 0x43, 0x02, 0x4D, 0x03, 0x42, 0x01, 0x42, 0x01, 0x41, 0x03, 0x41, 0x02,
+  0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x03,
+  0x41, 0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02,
+  0x41, 0x01, 0x45, 0x00, 0x43, 0x00, 0x49, 0x00, 0x43, 0x00, 0x43,
+  /* @2654 'n' */
+  0x43, 0x00, 0x44, 0x03, 0x4A, 0x04, 0x42, 0x03, 0x42, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05,
+  0x41, 0x01, 0x45, 0x01, 0x4B, 0x01, 0x45,
+  /* @2693 'o' */
+  0x03, 0x43, 0x05, 0x47, 0x02, 0x42, 0x03, 0x42, 0x00, 0x42, 0x05, 0x44, 0x07, 0x43, 0x07, 0x43,
+  0x07, 0x44, 0x05, 0x42, 0x00, 0x42, 0x03, 0x42, 0x02, 0x47, 0x05, 0x43, 0x03,
+  /* @2722 'p' */
+  0x43, 0x00, 0x44, 0x02, 0x4B, 0x02, 0x42, 0x04, 0x41, 0x02, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06,
+  0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x42, 0x04,
+  0x41, 0x02, 0x49, 0x02, 0x41, 0x00, 0x44, 0x04, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x08, 0x46, 0x05,
+  0x46, 0x05,
+  /* @2772 'q' */
+  0x02, 0x44, 0x00, 0x43, 0x00, 0x4B, 0x00, 0x41, 0x04, 0x42, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41,
+  0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x01, 0x41, 0x06, 0x41, 0x02, 0x41,
+  0x04, 0x42, 0x02, 0x49, 0x04, 0x44, 0x00, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x07, 0x46,
+  0x05, 0x46,
+  /* @2822 'r' */
+  0x44, 0x01, 0x43, 0x00, 0x44, 0x00, 0x45, 0x02, 0x44, 0x01, 0x41, 0x02, 0x42, 0x08, 0x41, 0x09,
+  0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x06, 0x49, 0x01, 0x49, 0x01,
+  /* @2850 's' */
+  0x01, 0x47, 0x00, 0x4A, 0x05, 0x43, 0x05, 0x47, 0x04, 0x47, 0x05, 0x46, 0x05, 0x43, 0x04, 0x4B,
+  0x00, 0x47, 0x01,
+  /* @2869 't' */
+  0x01, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x07, 0x49, 0x01, 0x49, 0x03, 0x41, 0x09, 0x41,
+  0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x04, 0x42, 0x02, 0x48, 0x03, 0x45,
+  0x01,
+  /* @2902 'u' */
+  0x43, 0x03, 0x43, 0x01, 0x43, 0x03, 0x43, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03,
+  0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x03,
+  0x41, 0x04, 0x42, 0x04, 0x4A, 0x03, 0x44, 0x00, 0x43,
+  /* @2943 'v' */
+  0x44, 0x03, 0x49, 0x03, 0x44, 0x01, 0x41, 0x05, 0x41, 0x03, 0x41, 0x05, 0x41, 0x04, 0x41, 0x03,
+  0x41, 0x05, 0x41, 0x03, 0x41, 0x06, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x45, 0x08,
+  0x43, 0x09, 0x43, 0x04,
+  /* @2979 'w' */
+  0x43, 0x04, 0x47, 0x04, 0x43, 0x00, 0x41, 0x02, 0x40, 0x02, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01,
+  0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x41, 0x02, 0x41, 0x87, 0x0F, 0x0F, 0x0F, 0xF0, 0x02, 0x43,
+  0x00, 0x43, 0x03, 0x43, 0x00, 0x43, 0x03, 0x42, 0x02, 0x41, 0x05, 0x41, 0x02, 0x41, 0x05, 0x41,
+  0x02, 0x41, 0x02,
+  /* @3030 'x' */
+  0x44, 0x01, 0x49, 0x01, 0x44, 0x01, 0x41, 0x03, 0x41, 0x04, 0x41, 0x01, 0x41, 0x06, 0x43, 0x08,
+  0x41, 0x08, 0x43, 0x06, 0x41, 0x01, 0x41, 0x04, 0x41, 0x03, 0x41, 0x01, 0x44, 0x01, 0x49, 0x01,
+  0x44,
+  /* @3063 'y' */
+  0x45, 0x03, 0x4A, 0x03, 0x44, 0x01, 0x41, 0x06, 0x41, 0x04, 0x41, 0x04, 0x41, 0x05, 0x41, 0x04,
+  0x41, 0x06, 0x41, 0x02, 0x41, 0x07, 0x41, 0x02, 0x41, 0x08, 0x41, 0x00, 0x41, 0x09, 0x44, 0x0A,
+  0x42, 0x0C, 0x41, 0x0B, 0x41, 0x0C, 0x41, 0x0B, 0x41, 0x08, 0x47, 0x06, 0x47, 0x05,
+  /* @3109 'z' */
+  0x55, 0x04, 0x41, 0x00, 0x41, 0x03, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x03,
+  0x41, 0x00, 0x41, 0x04, 0x55,
+  /* @3130 '{' */
+  0x02, 0x42, 0x01, 0x43, 0x01, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+  0x02, 0x42, 0x01, 0x42, 0x03, 0x42, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+  0x03, 0x43, 0x02, 0x42,
+  /* @3166 '|' */
+  0x63,
+  /* @3167 '}' */
+  0x42, 0x02, 0x43, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+  0x42, 0x03, 0x42, 0x01, 0x42, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01,
+  0x43, 0x01, 0x42, 0x02,
+  /* @3203 '~' */
+  0x01, 0x42, 0x06, 0x44, 0x02, 0x44, 0x00, 0x42, 0x00, 0x44, 0x02, 0x44, 0x06, 0x42, 0x01,
+};
+
+static const sGLYPH_AA Font24_Prop_Glyphs[] =
+{
+  /* Offset, Width, Height, OffsetX, OffsetY, Advance */
+  {     0,   0,   0,   0,   0,   9 }, /* ' ' */
+  {     0,   3,  15,   1,   2,   5 }, /* '!' */
+  {     7,   8,   7,   1,   3,  10 }, /* '"' */
+  {    31,  11,  16,   1,   2,  13 }, /* '#' */
+  {    84,   9,  19,   1,   1,  11 }, /* '$' */
+  {   123,  10,  15,   1,   2,  12 }, /* '%' */
+  {   170,  11,  13,   1,   4,  13 }, /* '&' */
+  {   204,   3,   7,   1,   3,   5 }, /* "'" */
+  {   212,   6,  18,   1,   2,   8 }, /* '(' */
+  {   248,   6,  18,   1,   2,   8 }, /* ')' */
+  {   284,  10,  10,   1,   2,  12 }, /* '*' */
+  {   311,  12,  12,   1,   4,  14 }, /* '+' */
+  {   334,   5,   7,   1,  14,   7 }, /* ',' */
+  {   349,  10,   2,   1,   9,  12 }, /* '-' */
+  {   350,   4,   3,   1,  14,   6 }, /* '.' */
+  {   351,  10,  20,   1,   0,  12 }, /* '/' */
+  {   392,  10,  15,   1,   2,  12 }, /* '0' */
+  {   433,  10,  15,   1,   2,  12 }, /* '1' */
+  {   463,  11,  15,   1,   2,  13 }, /* '2' */
+  {   495,  10,  15,   1,   2,  12 }, /* '3' */
+  {   526,  11,  15,   1,   2,  13 }, /* '4' */
+  {   568,  11,  15,   1,   2,  13 }, /* '5' */
+  {   603,  10,  15,   1,   2,  12 }, /* '6' */
+  {   642,  10,  15,   1,   2,  12 }, /* '7' */
+  {   670,  10,  15,   1,   2,  12 }, /* '8' */
+  {   709,  10,  15,   1,   2,  12 }, /* '9' */
+  {   748,   4,  11,   1,   6,   6 }, /* ':' */
+  {   751,   6,  13,   1,   6,   8 }, /* ';' */
+  {   770,  14,  13,   1,   4,  16 }, /* '<' */
+  {   796,  13,   6,   1,   7,  15 }, /* '=' */
+  {   799,  14,  13,   1,   4,  16 }, /* '>' */
+  {   825,   9,  14,   1,   3,  11 }, /* '?' */
+  {   852,  10,  17,   1,   2,  12 }, /* '@' */
+  {   899,  16,  14,   1,   3,  18 }, /* 'A' */
+  {   943,  13,  14,   1,   3,  15 }, /* 'B' */
+  {   985,  12,  14,   1,   3,  14 }, /* 'C' */
+  {  1022,  13,  14,   1,   3,  15 }, /* 'D' */
+  {  1070,  12,  14,   1,   3,  14 }, /* 'E' */
+  {  1111,  12,  14,   1,   3,  14 }, /* 'F' */
+  {  1151,  13,  14,   1,   3,  15 }, /* 'G' */
+  {  1194,  14,  14,   1,   3,  16 }, /* 'H' */
+  {  1241,  10,  14,   1,   3,  12 }, /* 'I' */
+  {  1264,  13,  14,   1,   3,  15 }, /* 'J' */
+  {  1303,  15,  14,   1,   3,  17 }, /* 'K' */
+  {  1354,  13,  14,   1,   3,  15 }, /* 'L' */
+  {  1385,  16,  14,   1,   3,  18 }, /* 'M' */
+  {  1450,  14,  14,   1,   3,  16 }, /* 'N' */
+  {  1512,  12,  14,   1,   3,  14 }, /* 'O' */
+  {  1551,  12,  14,   1,   3,  14 }, /* 'P' */
+  {  1589,  12,  17,   1,   3,  14 }, /* 'Q' */
+  {  1638,  14,  14,   1,   3,  16 }, /* 'R' */
+  {  1683,  10,  14,   1,   3,  12 }, /* 'S' */
+  {  1712,  12,  14,   1,   3,  14 }, /* 'T' */
+  {  1746,  14,  14,   1,   3,  16 }, /* 'U' */
+  {  1796,  15,  14,   1,   3,  17 }, /* 'V' */
+  {  1844,  17,  14,   1,   3,  19 }, /* 'W' */
+  {  1912,  14,  14,   1,   3,  16 }, /* 'X' */
+  {  1955,  14,  14,   1,   3,  16 }, /* 'Y' */
+  {  1993,  11,  14,   1,   3,  13 }, /* 'Z' */
+  {  2031,   5,  18,   1,   2,   7 }, /* '[' */
+  {  2060,  10,  20,   1,   0,  12 }, /* '\\' */
+  {  2099,   5,  18,   1,   2,   7 }, /* ']' */
+  {  2128,  11,   8,   1,   1,  13 }, /* '^' */
+  {  2152,  16,   2,   1,  22,  18 }, /* '_' */
+  {  2153,   5,   4,   1,   1,   7 }, /* '`' */
+  {  2160,  12,  11,   1,   6,  14 }, /* 'a' */
+  {  2190,  13,  15,   1,   2,  15 }, /* 'b' */
+  {  2238,  12,  11,   1,   6,  14 }, /* 'c' */
+  {  2267,  13,  15,   1,   2,  15 }, /* 'd' */
+  {  2315,  12,  11,   1,   6,  14 }, /* 'e' */
+  {  2338,  12,  15,   1,   2,  14 }, /* 'f' */
+  {  2369,  13,  16,   1,   6,  15 }, /* 'g' */
+  {  2420,  14,  15,   1,   2,  16 }, /* 'h' */
+  {  2467,  12,  15,   1,   2,  14 }, /* 'i' */
+  {  2491,   9,  20,   1,   2,  11 }, /* 'j' */
+  {  2524,  12,  15,   1,   2,  14 }, /* 'k' */
+  {  2567,  12,  15,   1,   2,  14 }, /* 'l' */
+  {  2595,  16,  11,   1,   6,  18 }, /* 'm' */
+  {  2654,  14,  11,   1,   6,  16 }, /* 'n' */
+  {  2693,  12,  11,   1,   6,  14 }, /* 'o' */
+  {  2722,  13,  16,   1,   6,  15 }, /* 'p' */
+  {  2772,  13,  16,   1,   6,  15 }, /* 'q' */
+  {  2822,  12,  11,   1,   6,  14 }, /* 'r' */
+  {  2850,  10,  11,   1,   6,  12 }, /* 's' */
+  {  2869,  12,  15,   1,   2,  14 }, /* 't' */
+  {  2902,  14,  11,   1,   6,  16 }, /* 'u' */
+  {  2943,  14,  11,   1,   6,  16 }, /* 'v' */
+  {  2979,  13,  11,   1,   6,  15 }, /* 'w' */
+  {  3030,  12,  11,   1,   6,  14 }, /* 'x' */
+  {  3063,  15,  16,   1,   6,  17 }, /* 'y' */
+  {  3109,  10,  11,   1,   6,  12 }, /* 'z' */
+  {  3130,   6,  18,   1,   2,   8 }, /* '{' */
+  {  3166,   2,  18,   1,   2,   4 }, /* '|' */
+  {  3167,   6,  18,   1,   2,   8 }, /* '}' */
+  {  3203,  11,   5,   1,   8,  13 }, /* '~' */
+};
+
+const sFONT_AA Font24_Prop =
+{
+  Font24_Prop_Data,
+  Font24_Prop_Glyphs,
+  32,  /* FirstChar */
+  95,  /* CharCount */
+  24,  /* Height */
+};
@@ -54,11 +54,41 @@ typedef struct _tFont
   uint16_t Height;
 } sFONT;
 
+/**
+  * @brief  Anti-aliased glyph: 4-bpp coverage bitmap RLE-compressed, rows after rows, in codes
+  *         00LLLLLL : L+1 pixels (1 to 64) of coverage 0
+  *         01LLLLLL : L+1 pixels (1 to 64) of coverage 15
+  *         10LLLLLL : L+1 pixels (1 to 64) whose coverages follow, 2 per byte, high nibble first
+  */
+typedef struct _tGlyphAA
+{
+  uint32_t Offset;  /*!< Offset of the glyph RLE data in the font data */
+  uint8_t  Width;   /*!< Bitmap width */
+  uint8_t  Height;  /*!< Bitmap height */
+  int8_t   OffsetX; /*!< Bitmap X position in the character cell */
+  int8_t   OffsetY; /*!< Bitmap Y position from the top of the character cell */
+  uint8_t  Advance; /*!< Character cell width */
+} sGLYPH_AA;
+
+/**
+  * @brief  Anti-aliased proportional font, generated by Utilities/PC_Software/LCD_FontConv
+  */
+typedef struct _tFontAA
+{
+  const uint8_t   *Data;      /*!< RLE data of the glyphs */
+  const sGLYPH_AA *Glyphs;    /*!< Glyphs of the characters FirstChar to FirstChar + CharCount - 1 */
+  uint16_t         FirstChar;
+  uint16_t         CharCount;
+  uint16_t         Height;    /*!< Character cell height */
+} sFONT_AA;
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
+
+extern const sFONT_AA Font24_Prop;
 /**
   * @}
   */
@@ -64,6 +64,10 @@
             respectively to 0 or 1.
           - Enable or disable the encoding pre-processing functions (RGB to YCbCr conversion functions) by setting the define USE_JPEG_ENCODER 
             respectively to 0 or 1.
+          - Enable or disable the DSP extension SIMD instructions in the YCbCr 4:2:0, 4:2:2 and 4:4:4 to RGB conversion
+            functions by setting the define USE_JPEG_DSP respectively to 1 or 0. Four pixels are converted at once with
+            saturating halfword arithmetic (__SADD16/__USAT16) instead of the CLAMP Look Up Table, the output is identical.
+            This setting is ignored when the core does not implement the DSP extension (__ARM_FEATURE_DSP).
  
     [..]For Decoding:
       - First, function "JPEG_InitColorTables" should be called to initialize the YCbCr to RGB color
@@ -79,6 +83,17 @@
         Then each time an integer number of MCUs are available (from the HW JPEG output), user
         can call the retrieved function to convert these HW JPEG output data to RGB888 or
         ARGB8888 pixel stored to the specified destination buffer.
+
+      - To display a thumbnail or a part of the image, user can call the utility function
+        "JPEG_GetDecodeScaledColorConvertFunc" instead, with a JPEG_OutputConfTypeDef structure giving :
+          - the region of interest (ROI) of the image to be converted, the MCUs outside of it are skipped,
+          - the output scale : 1/1, 1/2, 1/4 or 1/8, each output pixel being the average of the
+            corresponding 1x1, 2x2, 4x4 or 8x8 image pixels (8x8 is the block DC value),
+          - the destination frame buffer line stride in bytes, allowing to write directly to a
+            display frame buffer.
+        The retrieved function writes the ROI top left pixel at the destination buffer address and
+        the output size is returned in the OutputWidth and OutputHeight fields.
+        YCbCr and GrayScale color spaces are supported.
     
     [..]For Encoding:
       - First, function "JPEG_InitColorTables" should be called to initialize the YCbCr/RGB color
@@ -128,6 +143,13 @@ typedef struct __JPEG_MCU_RGB_ConvertorTypeDef
   uint32_t ScaledWidth;
   
   uint32_t MCU_Total_Nb;
+
+  uint32_t ROI_X0;
+  uint32_t ROI_Y0;
+  uint32_t ROI_X1;
+  uint32_t ROI_Y1;
+  uint32_t ScaleShift;
+  uint32_t OutputStride;
   
   uint16_t *Y_MCU_LUT;  
   uint16_t *Cb_MCU_LUT;  
@@ -198,6 +220,11 @@ typedef struct __JPEG_MCU_RGB_ConvertorTypeDef
 
 #endif /* JPEG_RGB_FORMAT */
 
+#if !defined(USE_JPEG_DSP) || !defined(__ARM_FEATURE_DSP) || (__ARM_FEATURE_DSP == 0)
+  #undef  USE_JPEG_DSP
+  #define USE_JPEG_DSP             0       /* DSP extension not available : Look Up Table based conversion */
+#endif /* USE_JPEG_DSP */
+
 /**
 * @}
 */ 
@@ -393,6 +420,12 @@ static uint32_t JPEG_MCU_YCCK_ARGB_ConvertBlocks(uint8_t *pInBuffer,
                                       uint32_t BlockIndex,
                                       uint32_t DataCount,
                                       uint32_t *ConvertedDataCount);
+
+static uint32_t JPEG_MCU_Scaled_ARGB_ConvertBlocks(uint8_t *pInBuffer, 
+                                      uint8_t *pOutBuffer, 
+                                      uint32_t BlockIndex,
+                                      uint32_t DataCount,
+                                      uint32_t *ConvertedDataCount);
 static void JPEG_InitPostProcColorTables(void);
 #endif /* USE_JPEG_DECODER == 1 */
 
@@ -1086,6 +1119,133 @@ HAL_StatusTypeDef JPEG_GetEncodeColorConvertFunc(JPEG_ConfTypeDef *pJpegInfo, JP
 #endif /* USE_JPEG_ENCODER == 1 */
 
 #if (USE_JPEG_DECODER == 1)
+#if (USE_JPEG_DSP == 1)
+/**
+  * @brief  Get the RGB chrominance contributions of two chroma samples, packed in halfwords
+  * @param  pChrom  : pointer to the first Cb sample, the Cr sample being 64 bytes further.
+  * @param  Step    : distance in bytes between the two chroma samples.
+  * @param  c_red   : Red contributions, first sample in the bottom halfword.
+  * @param  c_green : Green contributions, first sample in the bottom halfword.
+  * @param  c_blue  : Blue contributions, first sample in the bottom halfword.
+  * @retval None
+  */
+static __INLINE void JPEG_DSP_GetChroma(const uint8_t *pChrom,
+                                        uint32_t Step,
+                                        uint32_t *c_red,
+                                        uint32_t *c_green,
+                                        uint32_t *c_blue)
+{
+  uint32_t cbcomp0, cbcomp1, crcomp0, crcomp1;
+
+  cbcomp0 = pChrom[0];
+  cbcomp1 = pChrom[Step];
+  crcomp0 = pChrom[64];
+  crcomp1 = pChrom[64 + Step];
+
+  *c_red   = __PKHBT((uint32_t)CR_RED_LUT[crcomp0], (uint32_t)CR_RED_LUT[crcomp1], 16);
+  *c_blue  = __PKHBT((uint32_t)CB_BLUE_LUT[cbcomp0], (uint32_t)CB_BLUE_LUT[cbcomp1], 16);
+  *c_green = __PKHBT((uint32_t)((CR_GREEN_LUT[crcomp0] + CB_GREEN_LUT[cbcomp0]) >> 16),
+                     (uint32_t)((CR_GREEN_LUT[crcomp1] + CB_GREEN_LUT[cbcomp1]) >> 16), 16);
+}
+
+/**
+  * @brief  Convert four consecutive luminance samples to RGB pixels
+  * @note   Pixels 0 and 2 (even) and pixels 1 and 3 (odd) are computed in pairs, one pixel per halfword.
+  *         The sum of a luminance and a chrominance contribution is within [-256, 511] and is saturated to
+  *         [0, 255] by __USAT16, as done by the CLAMP Look Up Table.
+  * @param  pOutAddr     : pointer to output RGB888/ARGB8888/RGB565 first pixel.
+  * @param  LumSamples   : four luminance samples, first sample in the least significant byte.
+  * @param  c_red_even   : Red contributions of pixels 0 and 2.
+  * @param  c_green_even : Green contributions of pixels 0 and 2.
+  * @param  c_blue_even  : Blue contributions of pixels 0 and 2.
+  * @param  c_red_odd    : Red contributions of pixels 1 and 3.
+  * @param  c_green_odd  : Green contributions of pixels 1 and 3.
+  * @param  c_blue_odd   : Blue contributions of pixels 1 and 3.
+  * @retval None
+  */
+static __INLINE void JPEG_DSP_Convert4Pixels(uint8_t *pOutAddr,
+                                             uint32_t LumSamples,
+                                             uint32_t c_red_even,
+                                             uint32_t c_green_even,
+                                             uint32_t c_blue_even,
+                                             uint32_t c_red_odd,
+                                             uint32_t c_green_odd,
+                                             uint32_t c_blue_odd)
+{
+  uint32_t ycomp_even, ycomp_odd;
+  uint32_t red_even, green_even, blue_even;
+  uint32_t red_odd, green_odd, blue_odd;
+
+  ycomp_even = __UXTB16(LumSamples);
+  ycomp_odd  = __UXTB16(__ROR(LumSamples, 8));
+
+  red_even   = __USAT16(__SADD16(ycomp_even, c_red_even), 8);
+  green_even = __USAT16(__SADD16(ycomp_even, c_green_even), 8);
+  blue_even  = __USAT16(__SADD16(ycomp_even, c_blue_even), 8);
+
+  red_odd    = __USAT16(__SADD16(ycomp_odd, c_red_odd), 8);
+  green_odd  = __USAT16(__SADD16(ycomp_odd, c_green_odd), 8);
+  blue_odd   = __USAT16(__SADD16(ycomp_odd, c_blue_odd), 8);
+
+#if (JPEG_RGB_FORMAT == JPEG_ARGB8888)
+  {
+    uint32_t low_even, low_odd, high_even, high_odd;
+
+    /* Build the two lower bytes of each pixel in its halfword, then insert the upper color byte */
+#if (JPEG_SWAP_RB == 0)
+    low_even  = blue_even | (green_even << 8);
+    low_odd   = blue_odd  | (green_odd  << 8);
+    high_even = red_even;
+    high_odd  = red_odd;
+#else
+    low_even  = red_even | (green_even << 8);
+    low_odd   = red_odd  | (green_odd  << 8);
+    high_even = blue_even;
+    high_odd  = blue_odd;
+#endif /* JPEG_SWAP_RB */
+
+    *(__IO uint32_t *)pOutAddr        = __PKHBT(low_even, high_even, 16);
+    *(__IO uint32_t *)(pOutAddr + 4)  = __PKHBT(low_odd, high_odd, 16);
+    *(__IO uint32_t *)(pOutAddr + 8)  = __PKHTB(high_even, low_even, 16);
+    *(__IO uint32_t *)(pOutAddr + 12) = __PKHTB(high_odd, low_odd, 16);
+  }
+#elif (JPEG_RGB_FORMAT == JPEG_RGB888)
+
+  pOutAddr[JPEG_RED_OFFSET/8]       = (uint8_t)red_even;
+  pOutAddr[JPEG_GREEN_OFFSET/8]     = (uint8_t)green_even;
+  pOutAddr[JPEG_BLUE_OFFSET/8]      = (uint8_t)blue_even;
+
+  pOutAddr[3 + JPEG_RED_OFFSET/8]   = (uint8_t)red_odd;
+  pOutAddr[3 + JPEG_GREEN_OFFSET/8] = (uint8_t)green_odd;
+  pOutAddr[3 + JPEG_BLUE_OFFSET/8]  = (uint8_t)blue_odd;
+
+  pOutAddr[6 + JPEG_RED_OFFSET/8]   = (uint8_t)(red_even >> 16);
+  pOutAddr[6 + JPEG_GREEN_OFFSET/8] = (uint8_t)(green_even >> 16);
+  pOutAddr[6 + JPEG_BLUE_OFFSET/8]  = (uint8_t)(blue_even >> 16);
+
+  pOutAddr[9 + JPEG_RED_OFFSET/8]   = (uint8_t)(red_odd >> 16);
+  pOutAddr[9 + JPEG_GREEN_OFFSET/8] = (uint8_t)(green_odd >> 16);
+  pOutAddr[9 + JPEG_BLUE_OFFSET/8]  = (uint8_t)(blue_odd >> 16);
+
+#elif (JPEG_RGB_FORMAT == JPEG_RGB565)
+  {
+    uint32_t pixels_even, pixels_odd;
+
+    pixels_even = (((red_even   >> 3) & 0x001F001FU) << JPEG_RED_OFFSET)   | \
+                  (((green_even >> 2) & 0x003F003FU) << JPEG_GREEN_OFFSET) | \
+                  (((blue_even  >> 3) & 0x001F001FU) << JPEG_BLUE_OFFSET);
+
+    pixels_odd  = (((red_odd   >> 3) & 0x001F001FU) << JPEG_RED_OFFSET)   | \
+                  (((green_odd >> 2) & 0x003F003FU) << JPEG_GREEN_OFFSET) | \
+                  (((blue_odd  >> 3) & 0x001F001FU) << JPEG_BLUE_OFFSET);
+
+    *(__IO uint32_t *)pOutAddr       = __PKHBT(pixels_even, pixels_odd, 16);
+    *(__IO uint32_t *)(pOutAddr + 4) = __PKHTB(pixels_odd, pixels_even, 16);
+  }
+#endif /* JPEG_RGB_FORMAT */
+}
+#endif /* USE_JPEG_DSP == 1 */
+
 /**
   * @brief  Convert YCbCr 4:2:0 blocks to RGB pixels  
   * @param  pInBuffer  : pointer to input YCbCr blocks buffer.
@@ -1106,9 +1266,13 @@ static uint32_t JPEG_MCU_YCbCr420_ARGB_ConvertBlocks(uint8_t *pInBuffer,
   uint32_t i,j,k, currentMCU, xRef,yRef;
 
   uint32_t refline;
+#if (USE_JPEG_DSP == 1)
+  uint32_t c_red, c_blue, c_green;
+#else
   int32_t ycomp, crcomp, cbcomp;
 
   int32_t c_red, c_blue, c_green;
+#endif /* USE_JPEG_DSP */
   
   uint8_t *pOutAddr, *pOutAddr2;
   uint8_t *pChrom, *pLum;
@@ -1145,6 +1309,23 @@ static uint32_t JPEG_MCU_YCbCr420_ARGB_ConvertBlocks(uint8_t *pInBuffer,
         
         for(k= 0; k<2; k++)
         {
+#if (USE_JPEG_DSP == 1)
+          for(j=0; j < 8; j+=4)
+          {
+            /* Two chroma samples for four pixels of the two lines */
+            JPEG_DSP_GetChroma(pChrom, 1, &c_red, &c_green, &c_blue);
+
+            JPEG_DSP_Convert4Pixels(pOutAddr, __UNALIGNED_UINT32_READ(pLum + j),
+                                    c_red, c_green, c_blue, c_red, c_green, c_blue);
+            JPEG_DSP_Convert4Pixels(pOutAddr2, __UNALIGNED_UINT32_READ(pLum + j + 8),
+                                    c_red, c_green, c_blue, c_red, c_green, c_blue);
+
+            pOutAddr += JPEG_BYTES_PER_PIXEL * 4;
+            pOutAddr2 += JPEG_BYTES_PER_PIXEL * 4;
+
+            pChrom += 2;
+          }
+#else
           for(j=0; j < 8; j+=2)
           {           
             cbcomp = (int32_t)(*(pChrom));
@@ -1257,6 +1438,7 @@ static uint32_t JPEG_MCU_YCbCr420_ARGB_ConvertBlocks(uint8_t *pInBuffer,
           
             pChrom++;
           }
+#endif /* USE_JPEG_DSP */
           pLum += 64;                      
         }
 
@@ -1290,9 +1472,13 @@ static uint32_t JPEG_MCU_YCbCr422_ARGB_ConvertBlocks(uint8_t *pInBuffer,
   uint32_t i,j,k, currentMCU, xRef,yRef;
 
   uint32_t refline;
+#if (USE_JPEG_DSP == 1)
+  uint32_t c_red, c_blue, c_green;
+#else
   int32_t ycomp, crcomp, cbcomp;
 
   int32_t c_red, c_blue, c_green;
+#endif /* USE_JPEG_DSP */
   
   uint8_t *pOutAddr;
   uint8_t *pChrom, *pLum;
@@ -1323,6 +1509,20 @@ static uint32_t JPEG_MCU_YCbCr422_ARGB_ConvertBlocks(uint8_t *pInBuffer,
         
         for(k= 0; k<2; k++)
         {
+#if (USE_JPEG_DSP == 1)
+          for(j=0; j < 8; j+=4)
+          {
+            /* Two chroma samples for four pixels */
+            JPEG_DSP_GetChroma(pChrom, 1, &c_red, &c_green, &c_blue);
+
+            JPEG_DSP_Convert4Pixels(pOutAddr, __UNALIGNED_UINT32_READ(pLum + j),
+                                    c_red, c_green, c_blue, c_red, c_green, c_blue);
+
+            pOutAddr += JPEG_BYTES_PER_PIXEL * 4;
+
+            pChrom += 2;
+          }
+#else
           for(j=0; j < 8; j+=2)
           {           
             cbcomp = (int32_t)(*(pChrom));
@@ -1388,6 +1588,7 @@ static uint32_t JPEG_MCU_YCbCr422_ARGB_ConvertBlocks(uint8_t *pInBuffer,
           
             pChrom++;
           }
+#endif /* USE_JPEG_DSP */
           pLum += 64;                      
         }
         
@@ -1421,9 +1622,14 @@ static uint32_t JPEG_MCU_YCbCr444_ARGB_ConvertBlocks(uint8_t *pInBuffer,
   uint32_t i,j, currentMCU, xRef,yRef;
 
   uint32_t refline;
+#if (USE_JPEG_DSP == 1)
+  uint32_t c_red, c_blue, c_green;
+  uint32_t c_red_odd, c_blue_odd, c_green_odd;
+#else
   int32_t ycomp, crcomp, cbcomp;
   
   int32_t c_red, c_blue, c_green;
+#endif /* USE_JPEG_DSP */
   
   uint8_t *pOutAddr;
   uint8_t *pChrom, *pLum;
@@ -1453,7 +1659,21 @@ static uint32_t JPEG_MCU_YCbCr444_ARGB_ConvertBlocks(uint8_t *pInBuffer,
       {
         pOutAddr = pOutBuffer+ refline;
         
+#if (USE_JPEG_DSP == 1)
+          for(j=0; j < 8; j+=4)
+          {
+            /* Chroma samples 0 and 2 for the even pixels, 1 and 3 for the odd pixels */
+            JPEG_DSP_GetChroma(pChrom, 2, &c_red, &c_green, &c_blue);
+            JPEG_DSP_GetChroma(pChrom + 1, 2, &c_red_odd, &c_green_odd, &c_blue_odd);
 
+            JPEG_DSP_Convert4Pixels(pOutAddr, __UNALIGNED_UINT32_READ(pLum + j),
+                                    c_red, c_green, c_blue, c_red_odd, c_green_odd, c_blue_odd);
+
+            pOutAddr += JPEG_BYTES_PER_PIXEL * 4;
+
+            pChrom += 4;
+          }
+#else
           for(j=0; j < 8; j++)
           {           
             cbcomp = (int32_t)(*pChrom);
@@ -1496,6 +1716,7 @@ static uint32_t JPEG_MCU_YCbCr444_ARGB_ConvertBlocks(uint8_t *pInBuffer,
           
             pChrom++;
           }
+#endif /* USE_JPEG_DSP */
           pLum += 8;
 
         refline += JPEG_ConvertorParams.ScaledWidth;          
@@ -1677,6 +1898,168 @@ static uint32_t JPEG_MCU_YCCK_ARGB_ConvertBlocks(uint8_t *pInBuffer,
   return numberMCU;
 }
 
+/**
+  * @brief  Convert YCbCr or Y Gray blocks to the scaled RGB pixels of the region of interest
+  * @note   Each output pixel is the average of the scale x scale image pixels it covers. As the
+  *         region of interest origin is aligned on the scale, these pixels never overlap two blocks.
+  * @param  pInBuffer  : pointer to input YCbCr or Y blocks buffer.
+  * @param  pOutBuffer : pointer to output RGB888/ARGB8888/RGB565 region of interest top left pixel.
+  * @param  BlockIndex : index of the input buffer first block in the final image.
+  * @param  DataCount  : number of bytes in the input buffer .
+  * @param  ConvertedDataCount  : number of converted bytes from input buffer.  
+  * @retval Number of blocks converted from YCbCr to RGB 
+  */
+static uint32_t JPEG_MCU_Scaled_ARGB_ConvertBlocks(uint8_t *pInBuffer, 
+                                      uint8_t *pOutBuffer, 
+                                      uint32_t BlockIndex,
+                                      uint32_t DataCount,
+                                      uint32_t *ConvertedDataCount)
+{
+  uint32_t numberMCU, currentMCU, hMCU;
+  uint32_t xMCU, yMCU, xStart, xEnd, yStart, yEnd;
+  uint32_t x, y, i, j, scale;
+  uint32_t hShift, vShift, cwShift, chShift, cWidth, cHeight;
+  uint32_t lumOffset, chromOffset;
+  uint32_t ySum, cbSum, crSum;
+  int32_t ycomp, crcomp, cbcomp;
+  int32_t c_red, c_blue, c_green;
+  uint32_t red, green, blue;
+  
+  uint8_t *pOutAddr;
+  uint8_t *pChrom;
+  
+  numberMCU = DataCount / JPEG_ConvertorParams.BlockSize;
+  currentMCU = BlockIndex;
+  *ConvertedDataCount = numberMCU * JPEG_ConvertorParams.BlockSize;
+
+  hMCU = JPEG_ConvertorParams.WidthExtend / JPEG_ConvertorParams.H_factor;
+  scale = 1UL << JPEG_ConvertorParams.ScaleShift;
+
+  /* Chroma sub-sampling : 1 for 16 pixels wide or high MCUs, 0 otherwise */
+  hShift = JPEG_ConvertorParams.H_factor >> 4;
+  vShift = JPEG_ConvertorParams.V_factor >> 4;
+
+  /* Number of chroma samples averaged for an output pixel */
+  cwShift = (JPEG_ConvertorParams.ScaleShift > hShift) ? (JPEG_ConvertorParams.ScaleShift - hShift) : 0;
+  chShift = (JPEG_ConvertorParams.ScaleShift > vShift) ? (JPEG_ConvertorParams.ScaleShift - vShift) : 0;
+  cWidth  = 1UL << cwShift;
+  cHeight = 1UL << chShift;
+
+  /* Chroma blocks follow the luminance blocks */
+  pChrom = pInBuffer + ((JPEG_ConvertorParams.H_factor * JPEG_ConvertorParams.V_factor));
+
+  while(currentMCU < (numberMCU + BlockIndex))
+  {
+    xMCU = (currentMCU % hMCU) * JPEG_ConvertorParams.H_factor;
+    yMCU = (currentMCU / hMCU) * JPEG_ConvertorParams.V_factor;
+
+    currentMCU++;
+
+    /* Intersection of the MCU with the region of interest */
+    xStart = (xMCU > JPEG_ConvertorParams.ROI_X0) ? xMCU : JPEG_ConvertorParams.ROI_X0;
+    yStart = (yMCU > JPEG_ConvertorParams.ROI_Y0) ? yMCU : JPEG_ConvertorParams.ROI_Y0;
+    xEnd = xMCU + JPEG_ConvertorParams.H_factor;
+    yEnd = yMCU + JPEG_ConvertorParams.V_factor;
+    if(xEnd > JPEG_ConvertorParams.ROI_X1)
+    {
+      xEnd = JPEG_ConvertorParams.ROI_X1;
+    }
+    if(yEnd > JPEG_ConvertorParams.ROI_Y1)
+    {
+      yEnd = JPEG_ConvertorParams.ROI_Y1;
+    }
+
+    /* MCU outside of the region of interest : skip it */
+    if((xStart < xEnd) && (yStart < yEnd))
+    {
+      for(y = yStart; y < yEnd; y += scale)
+      {
+        pOutAddr = pOutBuffer + \
+                   (((y - JPEG_ConvertorParams.ROI_Y0) >> JPEG_ConvertorParams.ScaleShift) * JPEG_ConvertorParams.OutputStride) + \
+                   (((xStart - JPEG_ConvertorParams.ROI_X0) >> JPEG_ConvertorParams.ScaleShift) * JPEG_BYTES_PER_PIXEL);
+
+        for(x = xStart; x < xEnd; x += scale)
+        {
+          /* Luminance : the scale x scale pixels are in the same 8x8 block */
+          lumOffset = (((((y - yMCU) >> 3) * (JPEG_ConvertorParams.H_factor >> 3)) + ((x - xMCU) >> 3)) * 64) + \
+                      (((y - yMCU) & 7) * 8) + ((x - xMCU) & 7);
+          ySum = 0;
+          for(i = 0; i < scale; i++)
+          {
+            for(j = 0; j < scale; j++)
+            {
+              ySum += pInBuffer[lumOffset + j];
+            }
+            lumOffset += 8;
+          }
+          ycomp = (int32_t)((ySum + ((scale * scale) >> 1)) >> (2 * JPEG_ConvertorParams.ScaleShift));
+
+          if(JPEG_ConvertorParams.ColorSpace == JPEG_GRAYSCALE_COLORSPACE)
+          {
+            red   = (uint32_t)ycomp;
+            green = (uint32_t)ycomp;
+            blue  = (uint32_t)ycomp;
+          }
+          else
+          {
+            /* Chrominance : average of the chroma samples covering the same pixels */
+            chromOffset = (((y - yMCU) >> vShift) * 8) + ((x - xMCU) >> hShift);
+            cbSum = 0;
+            crSum = 0;
+            for(i = 0; i < cHeight; i++)
+            {
+              for(j = 0; j < cWidth; j++)
+              {
+                cbSum += pChrom[chromOffset + j];
+                crSum += pChrom[chromOffset + j + 64];
+              }
+              chromOffset += 8;
+            }
+            cbcomp = (int32_t)((cbSum + ((cWidth * cHeight) >> 1)) >> (cwShift + chShift));
+            crcomp = (int32_t)((crSum + ((cWidth * cHeight) >> 1)) >> (cwShift + chShift));
+
+            c_blue  = (int32_t)(*(CB_BLUE_LUT + cbcomp));
+            c_red   = (int32_t)(*(CR_RED_LUT + crcomp));
+            c_green = ((int32_t)(*(CR_GREEN_LUT + crcomp)) + (int32_t)(*(CB_GREEN_LUT + cbcomp))) >> 16;
+
+            red   = CLAMP(ycomp + c_red);
+            green = CLAMP(ycomp + c_green);
+            blue  = CLAMP(ycomp + c_blue);
+          }
+
+#if (JPEG_RGB_FORMAT == JPEG_ARGB8888)
+
+          *(__IO uint32_t *)pOutAddr = 
+            (red << JPEG_RED_OFFSET)     | \
+            (green << JPEG_GREEN_OFFSET) | \
+            (blue << JPEG_BLUE_OFFSET);
+
+#elif (JPEG_RGB_FORMAT == JPEG_RGB888)
+
+          pOutAddr[JPEG_RED_OFFSET/8] = (uint8_t)red;
+          pOutAddr[JPEG_GREEN_OFFSET/8] = (uint8_t)green;
+          pOutAddr[JPEG_BLUE_OFFSET/8] = (uint8_t)blue;
+
+#elif (JPEG_RGB_FORMAT == JPEG_RGB565)
+
+          *(__IO uint16_t *)pOutAddr = 
+            ((red >> 3) << JPEG_RED_OFFSET)     | \
+            ((green >> 2) << JPEG_GREEN_OFFSET) | \
+            ((blue >> 3) << JPEG_BLUE_OFFSET);
+
+#endif /* JPEG_RGB_FORMAT */
+
+          pOutAddr += JPEG_BYTES_PER_PIXEL;
+        }
+      }
+    }
+
+    pInBuffer += JPEG_ConvertorParams.BlockSize;
+    pChrom += JPEG_ConvertorParams.BlockSize;
+  }
+  return numberMCU;
+}
+
 /**
   * @brief  Retrieve Decoding YCbCr to RGB color conversion function and block number  
   * @param  pJpegInfo  : JPEG_ConfTypeDef that contains the JPEG image information.
@@ -1789,6 +2172,100 @@ HAL_StatusTypeDef JPEG_GetDecodeColorConvertFunc(JPEG_ConfTypeDef *pJpegInfo, JP
   return HAL_OK;
 }
 
+/**
+  * @brief  Retrieve Decoding YCbCr to RGB color conversion function of a scaled region of interest and block number
+  * @param  pJpegInfo   : JPEG_ConfTypeDef that contains the JPEG image information.
+  *                       These info are available in the HAL callback "HAL_JPEG_InfoReadyCallback".
+  * @param  pOutputConf : pointer to JPEG_OutputConfTypeDef giving the region of interest, the scale and the
+  *                       destination line stride. Its OutputWidth and OutputHeight fields are updated with
+  *                       the destination size in pixels.
+  * @param  pFunction   : pointer to JPEG_YCbCrToRGB_Convert_Function , used to Retrieve the color conversion function.
+  * @param ImageNbMCUs  : pointer to uint32_t, used to Retrieve the total number of MCU blocks in the jpeg image.  
+  * @retval HAL status : HAL_OK or HAL_ERROR.
+  */
+HAL_StatusTypeDef JPEG_GetDecodeScaledColorConvertFunc(JPEG_ConfTypeDef *pJpegInfo, JPEG_OutputConfTypeDef *pOutputConf, JPEG_YCbCrToRGB_Convert_Function *pFunction, uint32_t *ImageNbMCUs)
+{
+  uint32_t scaleShift, roiX1, roiY1;
+
+  if(pOutputConf->Scale > JPEG_SCALE_1_8)
+  {
+    return HAL_ERROR;
+  }
+  scaleShift = pOutputConf->Scale;
+
+  if(JPEG_GetDecodeColorConvertFunc(pJpegInfo, pFunction, ImageNbMCUs) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if(JPEG_ConvertorParams.ColorSpace == JPEG_YCBCR_COLORSPACE)
+  {
+    if(JPEG_ConvertorParams.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+    {
+      JPEG_ConvertorParams.BlockSize = YCBCR_420_BLOCK_SIZE;
+    }
+    else if(JPEG_ConvertorParams.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+    {
+      JPEG_ConvertorParams.BlockSize = YCBCR_422_BLOCK_SIZE;
+    }
+    else /*4:4:4*/
+    {
+      JPEG_ConvertorParams.BlockSize = YCBCR_444_BLOCK_SIZE;
+    }
+  }
+  else if(JPEG_ConvertorParams.ColorSpace == JPEG_GRAYSCALE_COLORSPACE)
+  {
+    JPEG_ConvertorParams.BlockSize = GRAY_444_BLOCK_SIZE;
+  }
+  else
+  {
+    return HAL_ERROR; /* Color space Not supported*/
+  }
+
+  /* Region of interest origin aligned on the scale, end clipped to the image */
+  JPEG_ConvertorParams.ROI_X0 = (pOutputConf->ROI_X >> scaleShift) << scaleShift;
+  JPEG_ConvertorParams.ROI_Y0 = (pOutputConf->ROI_Y >> scaleShift) << scaleShift;
+  if((JPEG_ConvertorParams.ROI_X0 >= JPEG_ConvertorParams.ImageWidth) || \
+     (JPEG_ConvertorParams.ROI_Y0 >= JPEG_ConvertorParams.ImageHeight))
+  {
+    return HAL_ERROR;
+  }
+
+  roiX1 = JPEG_ConvertorParams.ImageWidth;
+  if((pOutputConf->ROI_Width != 0) && ((pOutputConf->ROI_X + pOutputConf->ROI_Width) < roiX1))
+  {
+    roiX1 = pOutputConf->ROI_X + pOutputConf->ROI_Width;
+  }
+  roiY1 = JPEG_ConvertorParams.ImageHeight;
+  if((pOutputConf->ROI_Height != 0) && ((pOutputConf->ROI_Y + pOutputConf->ROI_Height) < roiY1))
+  {
+    roiY1 = pOutputConf->ROI_Y + pOutputConf->ROI_Height;
+  }
+  JPEG_ConvertorParams.ROI_X1 = roiX1;
+  JPEG_ConvertorParams.ROI_Y1 = roiY1;
+  JPEG_ConvertorParams.ScaleShift = scaleShift;
+
+  pOutputConf->OutputWidth  = (roiX1 - JPEG_ConvertorParams.ROI_X0 + (1UL << scaleShift) - 1) >> scaleShift;
+  pOutputConf->OutputHeight = (roiY1 - JPEG_ConvertorParams.ROI_Y0 + (1UL << scaleShift) - 1) >> scaleShift;
+
+  if(pOutputConf->OutputStride == 0)
+  {
+    JPEG_ConvertorParams.OutputStride = pOutputConf->OutputWidth * JPEG_BYTES_PER_PIXEL;
+  }
+  else if(pOutputConf->OutputStride < (pOutputConf->OutputWidth * JPEG_BYTES_PER_PIXEL))
+  {
+    return HAL_ERROR;
+  }
+  else
+  {
+    JPEG_ConvertorParams.OutputStride = pOutputConf->OutputStride;
+  }
+
+  *pFunction = JPEG_MCU_Scaled_ARGB_ConvertBlocks;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Initializes the YCbCr -> RGB colors conversion Look Up Tables  
   * @param  None
@@ -34,6 +34,12 @@
 /** @defgroup JPEG_Exported_Defines JPEG Exported Defines
   * @{
   */
+#if (USE_JPEG_DECODER == 1)
+#define JPEG_SCALE_1_1           0  /* Output at image size                         */
+#define JPEG_SCALE_1_2           1  /* Output at 1/2 of the image size, 2x2 average */
+#define JPEG_SCALE_1_4           2  /* Output at 1/4 of the image size, 4x4 average */
+#define JPEG_SCALE_1_8           3  /* Output at 1/8 of the image size, block DC    */
+#endif
 /**
 * @}
 */
@@ -47,6 +53,18 @@ typedef   uint32_t (* JPEG_YCbCrToRGB_Convert_Function)(uint8_t *pInBuffer,
                                       uint32_t BlockIndex,
                                       uint32_t DataCount,
                                       uint32_t *ConvertedDataCount );
+
+typedef struct
+{
+  uint32_t ROI_X;         /* Region of interest left column in the image, rounded down to the scale        */
+  uint32_t ROI_Y;         /* Region of interest top line in the image, rounded down to the scale           */
+  uint32_t ROI_Width;     /* Region of interest width in image pixels, 0 up to the image right edge        */
+  uint32_t ROI_Height;    /* Region of interest height in image pixels, 0 up to the image bottom edge      */
+  uint32_t Scale;         /* Output scale : JPEG_SCALE_1_1, JPEG_SCALE_1_2, JPEG_SCALE_1_4 or JPEG_SCALE_1_8 */
+  uint32_t OutputStride;  /* Destination line stride in bytes, 0 for OutputWidth * bytes per pixel         */
+  uint32_t OutputWidth;   /* Destination width in pixels, set by JPEG_GetDecodeScaledColorConvertFunc      */
+  uint32_t OutputHeight;  /* Destination height in pixels, set by JPEG_GetDecodeScaledColorConvertFunc     */
+}JPEG_OutputConfTypeDef;
 #endif
 
 #if (USE_JPEG_ENCODER == 1)                                      
@@ -81,6 +99,7 @@ void JPEG_InitColorTables(void);
 
 #if (USE_JPEG_DECODER == 1)
 HAL_StatusTypeDef JPEG_GetDecodeColorConvertFunc(JPEG_ConfTypeDef *pJpegInfo, JPEG_YCbCrToRGB_Convert_Function *pFunction, uint32_t *ImageNbMCUs);
+HAL_StatusTypeDef JPEG_GetDecodeScaledColorConvertFunc(JPEG_ConfTypeDef *pJpegInfo, JPEG_OutputConfTypeDef *pOutputConf, JPEG_YCbCrToRGB_Convert_Function *pFunction, uint32_t *ImageNbMCUs);
 #endif
 
 #if (USE_JPEG_ENCODER == 1)
@@ -56,6 +56,9 @@
 #define JPEG_RGB_FORMAT      JPEG_ARGB8888  /* Select RGB format: ARGB8888, RGB888, RBG_565 */
 #define JPEG_SWAP_RB         0  /* Change color order to BGR */
 
+#define USE_JPEG_DSP         0  /* Set to 1 to use the DSP extension SIMD instructions in the decoding post-processing
+                                   functions, ignored when the core does not implement the DSP extension */
+
 /**
 * @}
 */
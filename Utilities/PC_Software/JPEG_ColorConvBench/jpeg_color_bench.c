@@ -0,0 +1,410 @@
+/**
+  ******************************************************************************
+  * @file    jpeg_color_bench.c
+  * @author  MCD Application Team
+  * @brief   Bit-exactness check and timing of the JPEG utilities YCbCr to RGB
+  *          conversion against a portable per-pixel reference (host build)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * The utilities are included so that the reference uses the same chroma Look Up Tables (JPEG_InitColorTables) as the
+ * converted MCUs: the reference only differs by its pixel walk (one pixel at a time, image coordinates) and by its
+ * range limiting (compare instead of the CLAMP Look Up Table).
+ */
+#include "jpeg_utils.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_WIDTH             640U
+#define BENCH_HEIGHT            480U
+#define BENCH_DEFAULT_ROUNDS    50U
+
+#define BENCH_MAX_BLOCK_SIZE    YCBCR_420_BLOCK_SIZE
+
+#define BENCH_STRIDE_PAD        5U      /* Pixels added to the destination lines of the stride checks */
+#define BENCH_CHUNK_MCUS        7U      /* MCUs per call of the scaled conversion, as a decoder feeding its output
+                                           buffer : the calls start at any MCU of a line */
+#define BENCH_FILL              0xA5U   /* Destination bytes that are not pixels of the region of interest */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char *name;
+  uint32_t   subsampling;
+  uint32_t   mcu_width;
+  uint32_t   mcu_height;
+  uint32_t   block_size;
+} bench_sampling_t;
+
+typedef struct
+{
+  const char *name;
+  uint32_t   roi_x;
+  uint32_t   roi_y;
+  uint32_t   roi_width;
+  uint32_t   roi_height;
+  uint32_t   padded;      /* Destination stride larger than the region of interest width */
+} bench_roi_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const bench_sampling_t bench_samplings[] =
+{
+  {"4:2:0", JPEG_420_SUBSAMPLING, 16U, 16U, YCBCR_420_BLOCK_SIZE},
+  {"4:2:2", JPEG_422_SUBSAMPLING, 16U,  8U, YCBCR_422_BLOCK_SIZE},
+  {"4:4:4", JPEG_444_SUBSAMPLING,  8U,  8U, YCBCR_444_BLOCK_SIZE},
+};
+
+/* Regions of interest of the scaled conversion : the edges not on the MCUs nor on the scale */
+static const bench_roi_t bench_rois[] =
+{
+  {"image",     0U,   0U,   0U,   0U, 0U},
+  {"inside",   37U,  21U, 293U, 205U, 1U},
+  {"to edges", 603U, 459U,   0U,   0U, 1U},
+  {"clipped", 600U, 440U, 100U, 100U, 0U},
+  {"1 pixel",   5U,   3U,   1U,   1U, 1U},
+};
+
+static uint8_t bench_mcus[(BENCH_WIDTH / 8U) * (BENCH_HEIGHT / 8U) * BENCH_MAX_BLOCK_SIZE];
+static uint8_t bench_out[BENCH_WIDTH * BENCH_HEIGHT * JPEG_BYTES_PER_PIXEL];
+static uint8_t bench_ref[BENCH_WIDTH * BENCH_HEIGHT * JPEG_BYTES_PER_PIXEL];
+static uint8_t bench_scaled_out[(BENCH_WIDTH + BENCH_STRIDE_PAD) * BENCH_HEIGHT * JPEG_BYTES_PER_PIXEL];
+static uint8_t bench_scaled_ref[(BENCH_WIDTH + BENCH_STRIDE_PAD) * BENCH_HEIGHT * JPEG_BYTES_PER_PIXEL];
+
+/* Private functions ---------------------------------------------------------*/
+static uint64_t bench_now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t bench_limit(int32_t value)
+{
+  return (uint32_t)((value < 0) ? 0 : ((value > 255) ? 255 : value));
+}
+
+/**
+  * @brief  Write one pixel in the configured JPEG_RGB_FORMAT
+  */
+static void bench_put_pixel(uint8_t *p_pixel, uint32_t red, uint32_t green, uint32_t blue)
+{
+#if (JPEG_RGB_FORMAT == JPEG_ARGB8888)
+  uint32_t value = (red << JPEG_RED_OFFSET) | (green << JPEG_GREEN_OFFSET) | (blue << JPEG_BLUE_OFFSET);
+
+  memcpy(p_pixel, &value, sizeof(value));
+#elif (JPEG_RGB_FORMAT == JPEG_RGB888)
+  p_pixel[JPEG_RED_OFFSET / 8] = (uint8_t)red;
+  p_pixel[JPEG_GREEN_OFFSET / 8] = (uint8_t)green;
+  p_pixel[JPEG_BLUE_OFFSET / 8] = (uint8_t)blue;
+#else
+  uint16_t value = (uint16_t)(((red >> 3) << JPEG_RED_OFFSET) | ((green >> 2) << JPEG_GREEN_OFFSET) |
+                              ((blue >> 3) << JPEG_BLUE_OFFSET));
+
+  memcpy(p_pixel, &value, sizeof(value));
+#endif /* JPEG_RGB_FORMAT */
+}
+
+/**
+  * @brief  Portable reference : locate the luminance and chroma samples of an image pixel in its MCU
+  */
+static void bench_samples(const bench_sampling_t *p_sampling, const uint8_t *p_mcus, uint32_t x, uint32_t y,
+                          uint32_t *p_y, uint32_t *p_cb, uint32_t *p_cr)
+{
+  const uint32_t mcu_per_line = BENCH_WIDTH / p_sampling->mcu_width;
+  const uint32_t h_factor = p_sampling->mcu_width / 8U;   /* chroma horizontal subsampling */
+  const uint32_t v_factor = p_sampling->mcu_height / 8U;  /* chroma vertical subsampling */
+  const uint8_t *p_mcu = p_mcus + (((y / p_sampling->mcu_height) * mcu_per_line) + (x / p_sampling->mcu_width)) *
+                         p_sampling->block_size;
+  const uint32_t u = x % p_sampling->mcu_width;
+  const uint32_t v = y % p_sampling->mcu_height;
+  const uint32_t luma_block = ((v / 8U) * h_factor) + (u / 8U);
+  const uint32_t chroma = ((v / v_factor) * 8U) + (u / h_factor);
+
+  *p_y = p_mcu[(luma_block * 64U) + ((v % 8U) * 8U) + (u % 8U)];
+  *p_cb = p_mcu[(h_factor * v_factor * 64U) + chroma];
+  *p_cr = p_mcu[(h_factor * v_factor * 64U) + 64U + chroma];
+}
+
+/**
+  * @brief  Portable reference : convert the samples of a pixel and write it
+  */
+static void bench_convert(uint8_t *p_pixel, uint32_t ycomp, uint32_t cbcomp, uint32_t crcomp)
+{
+  bench_put_pixel(p_pixel,
+                  bench_limit((int32_t)ycomp + CR_RED_LUT[crcomp]),
+                  bench_limit((int32_t)ycomp + ((CR_GREEN_LUT[crcomp] + CB_GREEN_LUT[cbcomp]) >> 16)),
+                  bench_limit((int32_t)ycomp + CB_BLUE_LUT[cbcomp]));
+}
+
+/**
+  * @brief  Portable reference : convert the MCUs of a whole image one pixel at a time, locating the luminance and
+  *         chroma samples of each pixel from its image coordinates
+  */
+static void bench_reference(const bench_sampling_t *p_sampling, const uint8_t *p_mcus, uint8_t *p_out)
+{
+  uint32_t ycomp;
+  uint32_t cbcomp;
+  uint32_t crcomp;
+  uint32_t x;
+  uint32_t y;
+
+  for (y = 0U; y < BENCH_HEIGHT; y++)
+  {
+    for (x = 0U; x < BENCH_WIDTH; x++)
+    {
+      bench_samples(p_sampling, p_mcus, x, y, &ycomp, &cbcomp, &crcomp);
+      bench_convert(&p_out[((y * BENCH_WIDTH) + x) * JPEG_BYTES_PER_PIXEL], ycomp, cbcomp, crcomp);
+    }
+  }
+}
+
+/**
+  * @brief  Portable reference of the scaled conversion : each destination pixel averages, with rounding, the luminance
+  *         and the chroma samples of the scale x scale image pixels from the region of interest origin rounded down to
+  *         the scale. The destination covers the region of interest clipped to the image, the last column and line
+  *         averaging the pixels of the MCU beyond the region of interest.
+  */
+static void bench_scaled_reference(const bench_sampling_t *p_sampling, const uint8_t *p_mcus, const bench_roi_t *p_roi,
+                                   uint32_t scale_shift, uint32_t stride, uint8_t *p_out, uint32_t *p_width,
+                                   uint32_t *p_height)
+{
+  const uint32_t scale = 1UL << scale_shift;
+  const uint32_t x0 = (p_roi->roi_x / scale) * scale;
+  const uint32_t y0 = (p_roi->roi_y / scale) * scale;
+  uint32_t x1 = BENCH_WIDTH;
+  uint32_t y1 = BENCH_HEIGHT;
+  uint32_t ycomp;
+  uint32_t cbcomp;
+  uint32_t crcomp;
+  uint32_t out_x;
+  uint32_t out_y;
+  uint32_t i;
+  uint32_t j;
+
+  if ((p_roi->roi_width != 0U) && ((p_roi->roi_x + p_roi->roi_width) < x1))
+  {
+    x1 = p_roi->roi_x + p_roi->roi_width;
+  }
+  if ((p_roi->roi_height != 0U) && ((p_roi->roi_y + p_roi->roi_height) < y1))
+  {
+    y1 = p_roi->roi_y + p_roi->roi_height;
+  }
+  *p_width = (x1 - x0 + scale - 1U) / scale;
+  *p_height = (y1 - y0 + scale - 1U) / scale;
+
+  for (out_y = 0U; out_y < *p_height; out_y++)
+  {
+    for (out_x = 0U; out_x < *p_width; out_x++)
+    {
+      uint32_t ysum = 0U;
+      uint32_t cbsum = 0U;
+      uint32_t crsum = 0U;
+
+      /* The chroma average over the pixels equals the average of the distinct chroma samples they cover */
+      for (i = 0U; i < scale; i++)
+      {
+        for (j = 0U; j < scale; j++)
+        {
+          bench_samples(p_sampling, p_mcus, x0 + (out_x * scale) + j, y0 + (out_y * scale) + i, &ycomp, &cbcomp,
+                        &crcomp);
+          ysum += ycomp;
+          cbsum += cbcomp;
+          crsum += crcomp;
+        }
+      }
+      bench_convert(&p_out[(out_y * stride) + (out_x * JPEG_BYTES_PER_PIXEL)],
+                    (ysum + ((scale * scale) / 2U)) / (scale * scale),
+                    (cbsum + ((scale * scale) / 2U)) / (scale * scale),
+                    (crsum + ((scale * scale) / 2U)) / (scale * scale));
+    }
+  }
+}
+
+/**
+  * @brief  Check the scaled conversion of a sampling : identity with the unscaled conversion at 1/1, then every
+  *         scale and region of interest against the reference, the destination bytes around the region of interest
+  *         being left untouched
+  * @retval Number of failures
+  */
+static uint32_t bench_scaled(const bench_sampling_t *p_sampling, uint32_t mcu_number)
+{
+  static const char *const scale_names[] = {"1/1", "1/2", "1/4", "1/8"};
+  JPEG_ConfTypeDef conf = {JPEG_YCBCR_COLORSPACE, p_sampling->subsampling, BENCH_HEIGHT, BENCH_WIDTH, 0U};
+  JPEG_OutputConfTypeDef output;
+  JPEG_YCbCrToRGB_Convert_Function convert;
+  uint32_t scaled_mcu_number;
+  uint32_t converted;
+  uint32_t failures = 0U;
+  uint32_t scale_shift;
+  uint32_t idx;
+  uint32_t mcu;
+
+  /* 1/1 on the whole image : the output of the unscaled conversion, still in bench_out */
+  (void)memset(&output, 0, sizeof(output));
+  output.Scale = JPEG_SCALE_1_1;
+  if ((JPEG_GetDecodeScaledColorConvertFunc(&conf, &output, &convert, &scaled_mcu_number) != HAL_OK)
+      || (scaled_mcu_number != mcu_number) || (output.OutputWidth != BENCH_WIDTH)
+      || (output.OutputHeight != BENCH_HEIGHT))
+  {
+    printf("%-6s identity    : CONFIGURATION ERROR\n", p_sampling->name);
+    return 1U;
+  }
+  (void)convert(bench_mcus, bench_scaled_out, 0U, mcu_number * p_sampling->block_size, &converted);
+  if ((converted != (mcu_number * p_sampling->block_size))
+      || (memcmp(bench_scaled_out, bench_out, sizeof(bench_out)) != 0))
+  {
+    failures++;
+  }
+  printf("%-6s identity    : scale 1/1 %s the unscaled conversion\n", p_sampling->name,
+         (failures == 0U) ? "identical to" : "MISMATCH with");
+
+  for (scale_shift = JPEG_SCALE_1_1; scale_shift <= JPEG_SCALE_1_8; scale_shift++)
+  {
+    printf("%-6s scale %-5s :", p_sampling->name, scale_names[scale_shift]);
+    for (idx = 0U; idx < (sizeof(bench_rois) / sizeof(bench_rois[0])); idx++)
+    {
+      const bench_roi_t *p_roi = &bench_rois[idx];
+      uint32_t width;
+      uint32_t height;
+      uint32_t stride;
+      int exact;
+
+      /* Size of the reference, then the stride of the checks */
+      (void)memset(bench_scaled_ref, (int)BENCH_FILL, sizeof(bench_scaled_ref));
+      bench_scaled_reference(p_sampling, bench_mcus, p_roi, scale_shift, 0U, bench_scaled_ref, &width, &height);
+      stride = (width + ((p_roi->padded != 0U) ? BENCH_STRIDE_PAD : 0U)) * JPEG_BYTES_PER_PIXEL;
+      (void)memset(bench_scaled_ref, (int)BENCH_FILL, sizeof(bench_scaled_ref));
+      bench_scaled_reference(p_sampling, bench_mcus, p_roi, scale_shift, stride, bench_scaled_ref, &width, &height);
+
+      output.ROI_X = p_roi->roi_x;
+      output.ROI_Y = p_roi->roi_y;
+      output.ROI_Width = p_roi->roi_width;
+      output.ROI_Height = p_roi->roi_height;
+      output.Scale = scale_shift;
+      output.OutputStride = (p_roi->padded != 0U) ? stride : 0U;
+      if ((JPEG_GetDecodeScaledColorConvertFunc(&conf, &output, &convert, &scaled_mcu_number) != HAL_OK)
+          || (output.OutputWidth != width) || (output.OutputHeight != height))
+      {
+        printf("%s %s CONFIGURATION ERROR", (idx == 0U) ? "" : ",", p_roi->name);
+        failures++;
+        continue;
+      }
+
+      (void)memset(bench_scaled_out, (int)BENCH_FILL, sizeof(bench_scaled_out));
+      for (mcu = 0U; mcu < scaled_mcu_number; mcu += BENCH_CHUNK_MCUS)
+      {
+        const uint32_t count = ((scaled_mcu_number - mcu) < BENCH_CHUNK_MCUS) ? (scaled_mcu_number - mcu) :
+                               BENCH_CHUNK_MCUS;
+
+        (void)convert(&bench_mcus[mcu * p_sampling->block_size], bench_scaled_out, mcu,
+                      count * p_sampling->block_size, &converted);
+      }
+
+      exact = (memcmp(bench_scaled_out, bench_scaled_ref, sizeof(bench_scaled_out)) == 0);
+      if (!exact)
+      {
+        failures++;
+      }
+      printf("%s %s %ux%u%s %s", (idx == 0U) ? "" : ",", p_roi->name, width, height,
+             (p_roi->padded != 0U) ? " padded" : "", exact ? "ok" : "MISMATCH");
+    }
+    printf("\n");
+  }
+
+  return failures;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  const uint32_t rounds = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_DEFAULT_ROUNDS;
+  uint32_t failures = 0U;
+  uint32_t idx;
+
+  if (rounds == 0U)
+  {
+    fprintf(stderr, "usage: %s [ROUNDS]\n", argv[0]);
+    return 2;
+  }
+
+  JPEG_InitColorTables();
+
+  /* Random samples cover the saturation of every component, on both sides */
+  srand(1U);
+  for (idx = 0U; idx < sizeof(bench_mcus); idx++)
+  {
+    bench_mcus[idx] = (uint8_t)rand();
+  }
+
+  printf("JPEG YCbCr to RGB, %ux%u, JPEG_RGB_FORMAT %d, JPEG_SWAP_RB %d, %s conversion\n", BENCH_WIDTH, BENCH_HEIGHT,
+         JPEG_RGB_FORMAT, JPEG_SWAP_RB, (USE_JPEG_DSP == 1) ? "DSP extension" : "Look Up Table");
+  printf("%-6s %14s %14s %8s  %s\n", "", "reference us", "utilities us", "speedup", "output");
+
+  for (idx = 0U; idx < (sizeof(bench_samplings) / sizeof(bench_samplings[0])); idx++)
+  {
+    const bench_sampling_t *p_sampling = &bench_samplings[idx];
+    JPEG_ConfTypeDef conf = {JPEG_YCBCR_COLORSPACE, p_sampling->subsampling, BENCH_HEIGHT, BENCH_WIDTH, 0U};
+    JPEG_YCbCrToRGB_Convert_Function convert;
+    uint32_t mcu_number;
+    uint32_t converted;
+    uint64_t ref_ns = UINT64_MAX;
+    uint64_t lib_ns = UINT64_MAX;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t round;
+    int exact;
+
+    if (JPEG_GetDecodeColorConvertFunc(&conf, &convert, &mcu_number) != HAL_OK)
+    {
+      printf("%-6s not supported\n", p_sampling->name);
+      failures++;
+      continue;
+    }
+
+    /* Best of the rounds, the buffers being written entirely at each round */
+    for (round = 0U; round < rounds; round++)
+    {
+      start = bench_now_ns();
+      bench_reference(p_sampling, bench_mcus, bench_ref);
+      elapsed = bench_now_ns() - start;
+      ref_ns = (elapsed < ref_ns) ? elapsed : ref_ns;
+
+      start = bench_now_ns();
+      (void)convert(bench_mcus, bench_out, 0U, mcu_number * p_sampling->block_size, &converted);
+      elapsed = bench_now_ns() - start;
+      lib_ns = (elapsed < lib_ns) ? elapsed : lib_ns;
+    }
+
+    exact = (memcmp(bench_out, bench_ref, sizeof(bench_out)) == 0);
+    if (!exact)
+    {
+      failures++;
+    }
+
+    printf("%-6s %14.1f %14.1f %7.2fx  %s\n", p_sampling->name, (double)ref_ns / 1000.0, (double)lib_ns / 1000.0,
+           (double)ref_ns / (double)lib_ns, exact ? "bit-exact" : "MISMATCH");
+
+    failures += bench_scaled(p_sampling, mcu_number);
+  }
+
+  printf("%s\n", (failures == 0U) ? "PASSED" : "FAILED");
+
+  return (failures == 0U) ? 0 : 1;
+}
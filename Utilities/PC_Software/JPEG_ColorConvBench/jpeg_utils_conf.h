@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    jpeg_utils_conf.h
+  * @author  MCD Application Team
+  * @brief   JPEG utilities configuration of the color conversion benchmark
+  *          (host build)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __JPEG_UTILS_CONF_H__
+#define __JPEG_UTILS_CONF_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Host stand-ins of the HAL JPEG definitions used by the utilities ----------*/
+#define __IO                     volatile
+#define __INLINE                 inline
+
+typedef enum
+{
+  HAL_OK    = 0x00U,
+  HAL_ERROR = 0x01U
+} HAL_StatusTypeDef;
+
+typedef struct
+{
+  uint32_t ColorSpace;
+  uint32_t ChromaSubsampling;
+  uint32_t ImageHeight;
+  uint32_t ImageWidth;
+  uint32_t ImageQuality;
+} JPEG_ConfTypeDef;
+
+#define JPEG_GRAYSCALE_COLORSPACE  0x00000000U
+#define JPEG_YCBCR_COLORSPACE      0x00000010U
+#define JPEG_CMYK_COLORSPACE       0x00000030U
+
+#define JPEG_444_SUBSAMPLING       0x00000000U
+#define JPEG_420_SUBSAMPLING       0x00000001U
+#define JPEG_422_SUBSAMPLING       0x00000002U
+
+/* Exported constants --------------------------------------------------------*/
+#define JPEG_ARGB8888            0  /* ARGB8888 Color Format */
+#define JPEG_RGB888              1  /* RGB888 Color Format   */
+#define JPEG_RGB565              2  /* RGB565 Color Format   */
+
+#define USE_JPEG_DECODER     1
+#define USE_JPEG_ENCODER     0
+
+/* JPEG_RGB_FORMAT, JPEG_SWAP_RB and USE_JPEG_DSP are set by the Makefile */
+#ifndef JPEG_RGB_FORMAT
+#define JPEG_RGB_FORMAT      JPEG_ARGB8888
+#endif /* JPEG_RGB_FORMAT */
+#ifndef JPEG_SWAP_RB
+#define JPEG_SWAP_RB         0
+#endif /* JPEG_SWAP_RB */
+#ifndef USE_JPEG_DSP
+#define USE_JPEG_DSP         0
+#endif /* USE_JPEG_DSP */
+
+#if (USE_JPEG_DSP == 1) && !defined(__arm__)
+/* Host emulation of the CMSIS DSP extension intrinsics used by jpeg_utils.c,
+   following the Armv8-M instruction descriptions */
+#ifndef __ARM_FEATURE_DSP
+#define __ARM_FEATURE_DSP    1
+#endif /* __ARM_FEATURE_DSP */
+
+static inline uint32_t __SADD16(uint32_t op1, uint32_t op2)
+{
+  uint32_t lo = (uint16_t)((int16_t)op1 + (int16_t)op2);
+  uint32_t hi = (uint16_t)((int16_t)(op1 >> 16) + (int16_t)(op2 >> 16));
+
+  return lo | (hi << 16);
+}
+
+static inline uint32_t __usat_half(int16_t val, uint32_t sat)
+{
+  int32_t max = (int32_t)((1UL << sat) - 1UL);
+
+  return (uint32_t)((val < 0) ? 0 : ((val > max) ? max : val));
+}
+
+#define __USAT16(ARG1, ARG2)  (__usat_half((int16_t)(ARG1), (ARG2)) | \
+                               (__usat_half((int16_t)((ARG1) >> 16), (ARG2)) << 16))
+
+static inline uint32_t __UXTB16(uint32_t op1)
+{
+  return op1 & 0x00FF00FFUL;
+}
+
+static inline uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32U;
+  return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+#define __PKHBT(ARG1, ARG2, ARG3)  ((((uint32_t)(ARG1)) & 0x0000FFFFUL) | \
+                                    ((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL))
+#define __PKHTB(ARG1, ARG2, ARG3)  ((((uint32_t)(ARG1)) & 0xFFFF0000UL) | \
+                                    ((((uint32_t)(ARG2)) >> (ARG3)) & 0x0000FFFFUL))
+
+static inline uint32_t __UNALIGNED_UINT32_READ(const void *addr)
+{
+  uint32_t val;
+
+  __builtin_memcpy(&val, addr, sizeof(val));
+  return val;
+}
+#endif /* USE_JPEG_DSP == 1 && !__arm__ */
+
+#endif /* __JPEG_UTILS_CONF_H__ */
@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    lcd_fontconv.py
+#  @author  MCD Application Team
+#  @brief   Anti-aliased proportional font generator for the stm32_lcd utility (sFONT_AA)
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2023 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+Generates the C source of an anti-aliased proportional font (sFONT_AA, Utilities/Fonts/fonts.h) displayed by
+UTIL_LCD_DisplayAAStringAt() when UTIL_LCD_AA_FONT_ENABLE is set to 1 in stm32_lcd.h.
+
+Each glyph is the 4-bpp coverage bitmap of its ink box, placed in a character cell of the glyph advance by the font
+height, and RLE-compressed rows after rows in codes :
+ - 00LLLLLL : L+1 pixels (1 to 64) of coverage 0,
+ - 01LLLLLL : L+1 pixels (1 to 64) of coverage 15,
+ - 10LLLLLL : L+1 pixels (1 to 64) whose coverages follow, 2 per byte, high nibble first.
+The codes of each glyph are chosen to give the smallest data.
+
+Sources :
+ - ttf    : TrueType/OpenType font rendered with Pillow at the given pixel size,
+ - bitmap : 1-bpp font of Utilities/Fonts (font8.c ... font24.c), cropped to proportional glyphs.
+
+Usage: python lcd_fontconv.py ttf FONT.ttf --size SIZE --name NAME [--first CODE] [--last CODE] [-o FILE]
+       python lcd_fontconv.py bitmap FONT.c --name NAME [--spacing PIXELS] [-o FILE]
+       python lcd_fontconv.py preview FILE --text TEXT
+"""
+
+import argparse
+import re
+import sys
+
+GLYPH_ENTRY_SIZE = 12          # sizeof(sGLYPH_AA)
+FONT_ENTRY_SIZE = 16           # sizeof(sFONT_AA)
+
+
+class FontError(Exception):
+    pass
+
+
+class Glyph:
+    def __init__(self, code, width, height, offset_x, offset_y, advance, pixels):
+        self.code = code
+        self.width = width
+        self.height = height
+        self.offset_x = offset_x
+        self.offset_y = offset_y
+        self.advance = advance
+        self.pixels = pixels               # width x height coverages 0..15, rows after rows
+        self.offset = 0
+
+
+def crop(glyph, cell_height):
+    """Clips the glyph to its character cell and removes the empty border rows and columns."""
+    rows = [glyph.pixels[y * glyph.width:(y + 1) * glyph.width] for y in range(glyph.height)]
+    x0, y0 = max(0, -glyph.offset_x), max(0, -glyph.offset_y)
+    x1 = min(glyph.width, glyph.advance - glyph.offset_x)
+    y1 = min(glyph.height, cell_height - glyph.offset_y)
+    rows = [row[x0:x1] for row in rows[y0:y1]] if (x1 > x0 and y1 > y0) else []
+    offset_x, offset_y = glyph.offset_x + x0, glyph.offset_y + y0
+    while rows and not any(rows[0]):
+        rows.pop(0)
+        offset_y += 1
+    while rows and not any(rows[-1]):
+        rows.pop()
+    while rows and not any(row[0] for row in rows):
+        rows = [row[1:] for row in rows]
+        offset_x += 1
+    while rows and not any(row[-1] for row in rows):
+        rows = [row[:-1] for row in rows]
+    if not rows:
+        return Glyph(glyph.code, 0, 0, 0, 0, glyph.advance, [])
+    if len(rows[0]) > 255 or len(rows) > 255 or glyph.advance > 255:
+        raise FontError("glyph %r larger than 255 pixels" % chr(glyph.code))
+    return Glyph(glyph.code, len(rows[0]), len(rows), offset_x, offset_y, glyph.advance,
+                 [value for row in rows for value in row])
+
+
+def rle_encode(pixels):
+    """Shortest encoding of the coverages, by dynamic programming on the number of pixels encoded."""
+    size = [0] + [None] * len(pixels)
+    code = [None] * (len(pixels) + 1)
+    for end in range(1, len(pixels) + 1):
+        for length in range(1, min(end, 64) + 1):
+            cost = size[end - length] + 1 + (length + 1) // 2
+            if size[end] is None or cost < size[end]:
+                size[end], code[end] = cost, (False, length)
+        value = pixels[end - 1]
+        if value in (0, 15):
+            length = 1
+            while length <= min(end, 64) and pixels[end - length] == value:
+                if size[end - length] + 1 < size[end]:
+                    size[end], code[end] = size[end - length] + 1, (True, length)
+                length += 1
+    codes = []
+    end = len(pixels)
+    while end:
+        codes.append(code[end])
+        end -= code[end][1]
+    data = bytearray()
+    start = 0
+    for run, length in reversed(codes):
+        chunk = pixels[start:start + length]
+        if run:
+            data.append((0x40 if chunk[0] == 15 else 0x00) | (length - 1))
+        else:
+            data.append(0x80 | (length - 1))
+            chunk = chunk + [0] * (length & 1)
+            data.extend((chunk[i] << 4) | chunk[i + 1] for i in range(0, length, 2))
+        start += length
+    return bytes(data)
+
+
+def rle_decode(data, offset, count):
+    """Reference of AAFontDecode() in stm32_lcd.c."""
+    pixels = []
+    while len(pixels) < count:
+        code = data[offset]
+        offset += 1
+        length = (code & 0x3F) + 1
+        if (code & 0xC0) == 0x80:
+            for index in range(length):
+                pixels.append(data[offset + index // 2] >> 4 if index % 2 == 0 else data[offset + index // 2] & 0x0F)
+            offset += (length + 1) // 2
+        else:
+            pixels += [15 if (code & 0xC0) == 0x40 else 0] * length
+    return pixels[:count]
+
+
+def from_ttf(path, size, first, last):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        raise FontError("Pillow is required by the ttf command")
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    glyphs = []
+    for code in range(first, last + 1):
+        char = chr(code)
+        advance = int(round(font.getlength(char)))
+        x0, y0, x1, y1 = font.getbbox(char)
+        width, rows = max(x1 - x0, 0), max(y1 - y0, 0)
+        pixels = []
+        if width and rows:
+            image = Image.new("L", (width, rows), 0)
+            ImageDraw.Draw(image).text((-x0, -y0), char, font=font, fill=255)
+            data = image.tobytes()
+            pixels = [(value * 15 + 127) // 255 for value in data]
+        glyphs.append(crop(Glyph(code, width, rows, x0, y0, advance, pixels), height))
+    return glyphs, height
+
+
+def from_bitmap(path, spacing):
+    with open(path) as f:
+        source = f.read()
+    table = re.search(r"_Table\s*\[\s*\]\s*=\s*\{(.*?)\};", source, re.S)
+    font = re.search(r"sFONT\s+\w+\s*=\s*\{\s*\w+\s*,\s*(\d+)\s*,(?:\s*/\*.*?\*/)?\s*(\d+)", source, re.S)
+    if table is None or font is None:
+        raise FontError("%s is not a 1-bpp sFONT source" % path)
+    data = [int(value, 16) for value in re.findall(r"0x([0-9A-Fa-f]{2})", re.sub(r"//.*", "", table.group(1)))]
+    width, height = int(font.group(1)), int(font.group(2))
+    row_bytes = (width + 7) // 8
+    glyph_bytes = row_bytes * height
+    glyphs = []
+    for index in range(len(data) // glyph_bytes):
+        pixels = []
+        for y in range(height):
+            line = 0
+            for byte in data[index * glyph_bytes + y * row_bytes:index * glyph_bytes + (y + 1) * row_bytes]:
+                line = (line << 8) | byte
+            pixels += [15 if line & (1 << (row_bytes * 8 - 1 - x)) else 0 for x in range(width)]
+        glyph = crop(Glyph(0x20 + index, width, height, 0, 0, width, pixels), height)
+        if glyph.width:
+            # Proportional advance : ink width and spacing on each side
+            glyph.advance = glyph.width + 2 * spacing
+            glyph.offset_x = spacing
+        else:
+            glyph.advance = (width + 1) // 2
+        glyphs.append(glyph)
+    return glyphs, height, len(data)
+
+
+def generate(glyphs, height, name):
+    data = bytearray()
+    for glyph in glyphs:
+        glyph.offset = len(data)
+        data += rle_encode(glyph.pixels)
+    lines = ["/**",
+             "  ******************************************************************************",
+             "  * @file    %s.c" % name.lower(),
+             "  * @author  MCD Application Team",
+             "  * @brief   This file provides the font %s (sFONT_AA format) for the stm32_lcd utility," % name,
+             "  *          generated by Utilities/PC_Software/LCD_FontConv.",
+             "  ******************************************************************************",
+             "  */",
+             "",
+             "/* Includes ------------------------------------------------------------------*/",
+             '#include "fonts.h"',
+             "",
+             "static const uint8_t %s_Data[] =" % name,
+             "{"]
+    for glyph in glyphs:
+        chunk = data[glyph.offset:glyph.offset + len(rle_encode(glyph.pixels))]
+        if chunk:
+            lines.append("  /* @%u %r */" % (glyph.offset, chr(glyph.code)))
+            for start in range(0, len(chunk), 16):
+                lines.append("  " + " ".join("0x%02X," % value for value in chunk[start:start + 16]))
+    if not data:
+        lines.append("  0x00")
+    lines += ["};", "",
+              "static const sGLYPH_AA %s_Glyphs[] =" % name,
+              "{",
+              "  /* Offset, Width, Height, OffsetX, OffsetY, Advance */"]
+    for glyph in glyphs:
+        lines.append("  { %5u, %3u, %3u, %3d, %3d, %3u }, /* %r */"
+                     % (glyph.offset, glyph.width, glyph.height, glyph.offset_x, glyph.offset_y, glyph.advance,
+                        chr(glyph.code)))
+    lines += ["};", "",
+              "const sFONT_AA %s =" % name,
+              "{",
+              "  %s_Data," % name,
+              "  %s_Glyphs," % name,
+              "  %u,  /* FirstChar */" % glyphs[0].code,
+              "  %u,  /* CharCount */" % len(glyphs),
+              "  %u,  /* Height */" % height,
+              "};", ""]
+    return "\n".join(lines), len(data)
+
+
+def report(glyphs, height, rle_size, bitmap_size=None):
+    count = len(glyphs)
+    total = rle_size + count * GLYPH_ENTRY_SIZE + FONT_ENTRY_SIZE
+    raw = sum((glyph.width * glyph.height + 1) // 2 for glyph in glyphs) + count * GLYPH_ENTRY_SIZE
+    cell = max(glyph.advance for glyph in glyphs)
+    mono = count * ((cell + 1) // 2) * height
+    print("%u glyphs, height %u, advance %u to %u" % (count, height, min(glyph.advance for glyph in glyphs), cell),
+          file=sys.stderr)
+    print("  flash : %u bytes (RLE data %u, glyph table %u)" % (total, rle_size, count * GLYPH_ENTRY_SIZE),
+          file=sys.stderr)
+    print("          4-bpp ink boxes uncompressed %u, 4-bpp monospaced cells %u" % (raw, mono), file=sys.stderr)
+    if bitmap_size is not None:
+        print("          1-bpp source table %u" % bitmap_size, file=sys.stderr)
+
+
+def parse_generated(path):
+    with open(path) as f:
+        source = f.read()
+    data_block = re.search(r"_Data\[\]\s*=\s*\{(.*?)\};", source, re.S)
+    glyph_block = re.search(r"_Glyphs\[\]\s*=\s*\{(.*?)\};", source, re.S)
+    font_block = re.search(r"sFONT_AA\s+\w+\s*=\s*\{(.*?)\};", source, re.S)
+    if data_block is None or glyph_block is None or font_block is None:
+        raise FontError("%s is not a generated sFONT_AA source" % path)
+    data = bytes(int(value, 16) for value in re.findall(r"0x([0-9A-Fa-f]{2})",
+                                                       re.sub(r"/\*.*?\*/", "", data_block.group(1))))
+    entries = re.findall(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+),\s*(\d+)\s*\}", glyph_block.group(1))
+    first, count, height = [int(value) for value in
+                            re.findall(r"(\d+),\s*/\*", font_block.group(1))[:3]]
+    glyphs = {}
+    for index, entry in enumerate(entries[:count]):
+        offset, width, rows, offset_x, offset_y, advance = [int(value) for value in entry]
+        glyph = Glyph(first + index, width, rows, offset_x, offset_y, advance,
+                      rle_decode(data, offset, width * rows))
+        glyphs[glyph.code] = glyph
+    return glyphs, height
+
+
+def preview(path, text):
+    """Renders the text as the character cells expanded by AAFontExpand() in stm32_lcd.c."""
+    glyphs, height = parse_generated(path)
+    shades = " .:-=+*#%@"
+    lines = [""] * height
+    for char in text:
+        glyph = glyphs.get(ord(char))
+        if glyph is None:
+            continue
+        for y in range(height):
+            row = [0] * glyph.advance
+            glyph_row = y - glyph.offset_y
+            if 0 <= glyph_row < glyph.height:
+                for x in range(glyph.width):
+                    cell_x = glyph.offset_x + x
+                    if 0 <= cell_x < glyph.advance:
+                        row[cell_x] = glyph.pixels[glyph_row * glyph.width + x]
+            lines[y] += "".join(shades[value * (len(shades) - 1) // 15] for value in row)
+    print("\n".join(line.rstrip() for line in lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Anti-aliased proportional font generator for stm32_lcd")
+    commands = parser.add_subparsers(dest="command")
+    cmd = commands.add_parser("ttf", help="generate a font from a TrueType/OpenType font (Pillow)")
+    cmd.add_argument("font", help="font file")
+    cmd.add_argument("--size", type=int, required=True, help="font size in pixels")
+    cmd.add_argument("--name", required=True, help="C name of the font, e.g. Font16_AA")
+    cmd.add_argument("--first", type=lambda x: int(x, 0), default=0x20, help="first character, default 0x20")
+    cmd.add_argument("--last", type=lambda x: int(x, 0), default=0x7E, help="last character, default 0x7E")
+    cmd.add_argument("-o", "--output", help="output file, default NAME.c")
+    cmd = commands.add_parser("bitmap", help="generate a proportional font from a 1-bpp font of Utilities/Fonts")
+    cmd.add_argument("font", help="font source, e.g. ../../Fonts/font24.c")
+    cmd.add_argument("--name", required=True, help="C name of the font, e.g. Font24_Prop")
+    cmd.add_argument("--spacing", type=int, default=1, help="pixels on each side of the glyphs, default 1")
+    cmd.add_argument("-o", "--output", help="output file, default NAME.c")
+    cmd = commands.add_parser("preview", help="display a text with a generated font")
+    cmd.add_argument("file", help="generated font source")
+    cmd.add_argument("--text", default="Hello STM32", help="text to display")
+    args = parser.parse_args()
+    if args.command is None:
+        parser.error("a command is required")
+
+    try:
+        if args.command == "preview":
+            preview(args.file, args.text)
+            return 0
+        bitmap_size = None
+        if args.command == "ttf":
+            if args.first > args.last or args.last > 0xFF:
+                raise FontError("characters 0x00 to 0xFF only")
+            glyphs, height = from_ttf(args.font, args.size, args.first, args.last)
+        else:
+            glyphs, height, bitmap_size = from_bitmap(args.font, args.spacing)
+        source, rle_size = generate(glyphs, height, args.name)
+        output = args.output if args.output else args.name.lower() + ".c"
+        with open(output, "w") as f:
+            f.write(source)
+        print("%s :" % output, file=sys.stderr)
+        report(glyphs, height, rle_size, bitmap_size)
+    except (OSError, ValueError, FontError) as error:
+        print("error : %s" % error, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,662 @@
+/**
+  ******************************************************************************
+  * @file    lpbam_hal_host.c
+  * @author  MCD Application Team
+  * @brief   Host model of the HAL_DMAEx_List_* services used by the LPBAM
+  *          utility and of the peripheral register map.
+  *          The nodes are formatted as the GPDMA / LPDMA channel loads them :
+  *          static nodes hold all their registers and are linked with all the
+  *          update bits set, dynamic nodes only hold the registers that differ
+  *          from the previous executed node.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "stm32u5xx_hal.h"
+
+/* Node register offsets in the static format */
+#define NODE_CTR1_OFFSET            0U
+#define NODE_CTR2_OFFSET            1U
+#define NODE_CBR1_OFFSET            2U
+#define NODE_CSAR_OFFSET            3U
+#define NODE_CDAR_OFFSET            4U
+#define NODE_CTR3_OFFSET            5U
+#define NODE_CBR2_OFFSET            6U
+#define NODE_TYPE_MASK              0x00FFU
+#define NODE_REGISTER_NUMBER        8U
+
+#define QUEUE_MAX_NODES             1024U
+
+/* Register map reachable by the queue : the DMA can only address 32-bit addresses, the program is linked without PIE */
+Host_Periph_TypeDef host_periph;
+
+/* CLLR update bits, in the order the channel loads the registers */
+static const uint32_t cllr_update[NODE_REGISTER_NUMBER] =
+{
+  DMA_CLLR_UT1, DMA_CLLR_UT2, DMA_CLLR_UB1, DMA_CLLR_USA, DMA_CLLR_UDA, DMA_CLLR_UT3, DMA_CLLR_UB2, DMA_CLLR_ULL
+};
+
+static uint32_t NodeCllrIdx(DMA_NodeTypeDef const *pNode)
+{
+  return (pNode->NodeInfo & NODE_CLLR_IDX) >> NODE_CLLR_IDX_POS;
+}
+
+static uint32_t NodeIs2D(DMA_NodeTypeDef const *pNode)
+{
+  return ((pNode->NodeInfo & DMA_CHANNEL_TYPE_2D_ADDR) != 0U) ? 1U : 0U;
+}
+
+/* Update bits loading all the registers of a node */
+static uint32_t NodeFullMask(DMA_NodeTypeDef const *pNode)
+{
+  uint32_t mask = DMA_CLLR_UT1 | DMA_CLLR_UT2 | DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_UDA | DMA_CLLR_ULL;
+
+  if (NodeIs2D(pNode) != 0U)
+  {
+    mask |= DMA_CLLR_UT3 | DMA_CLLR_UB2;
+  }
+
+  return mask;
+}
+
+static uint32_t NodeLink(DMA_NodeTypeDef const *pNode)
+{
+  return ((uint32_t)(uintptr_t)pNode & DMA_CLLR_LA) | NodeFullMask(pNode);
+}
+
+static DMA_NodeTypeDef *NodeNext(DMA_QListTypeDef const *pQList, DMA_NodeTypeDef const *pNode)
+{
+  uint32_t cllr = pNode->LinkRegisters[NodeCllrIdx(pNode)];
+
+  if ((cllr & DMA_CLLR_LA) == 0U)
+  {
+    return NULL;
+  }
+
+  return (DMA_NodeTypeDef *)(uintptr_t)(((uint32_t)(uintptr_t)pQList->Head & DMA_CLBAR_LBA) | (cllr & DMA_CLLR_LA));
+}
+
+/* Node at a position of the queue, following the links from the head */
+static DMA_NodeTypeDef *QueueNode(DMA_QListTypeDef const *pQList, uint32_t Index)
+{
+  DMA_NodeTypeDef *p_node = pQList->Head;
+
+  while ((p_node != NULL) && (Index > 0U))
+  {
+    p_node = NodeNext(pQList, p_node);
+    Index--;
+  }
+
+  return p_node;
+}
+
+static uint32_t QueueFind(DMA_QListTypeDef const *pQList, DMA_NodeTypeDef const *pNode, uint32_t *pIndex)
+{
+  DMA_NodeTypeDef const *p_node = pQList->Head;
+  uint32_t idx;
+
+  for (idx = 0U; (idx < pQList->NodeNumber) && (p_node != NULL); idx++)
+  {
+    if (p_node == pNode)
+    {
+      *pIndex = idx;
+      return 1U;
+    }
+    p_node = NodeNext(pQList, p_node);
+  }
+
+  return 0U;
+}
+
+/* All the nodes of a queue share the link base address and the node type */
+static HAL_StatusTypeDef QueueCheckNode(DMA_QListTypeDef const *pQList, DMA_NodeTypeDef const *pNode)
+{
+  if (((uintptr_t)pNode > 0xFFFFFFFFU) || (((uintptr_t)pNode & 3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pQList->Head != NULL)
+  {
+    if ((((uint32_t)(uintptr_t)pQList->Head ^ (uint32_t)(uintptr_t)pNode) & DMA_CLBAR_LBA) != 0U)
+    {
+      return HAL_ERROR;
+    }
+
+    if (((pQList->Head->NodeInfo ^ pNode->NodeInfo) & NODE_TYPE_MASK) != 0U)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_BuildNode(DMA_NodeConfTypeDef const *const pNodeConfig,
+                                           DMA_NodeTypeDef *const pNode)
+{
+  uint32_t cllr_idx = NODE_CLLR_LINEAR_DEFAULT_OFFSET;
+  uint32_t *p_regs;
+
+  if ((pNodeConfig == NULL) || (pNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pNodeConfig->NodeType != DMA_GPDMA_LINEAR_NODE) && (pNodeConfig->NodeType != DMA_GPDMA_2D_NODE) &&
+      (pNodeConfig->NodeType != DMA_LPDMA_LINEAR_NODE))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pNodeConfig->DataSize == 0U) || (pNodeConfig->DataSize > DMA_CBR1_BNDT))
+  {
+    return HAL_ERROR;
+  }
+
+  p_regs = pNode->LinkRegisters;
+  (void)memset(p_regs, 0, sizeof(pNode->LinkRegisters));
+
+  /* CTR1 : increments, data widths, packing and bursts */
+  p_regs[NODE_CTR1_OFFSET] = pNodeConfig->Init.SrcInc | pNodeConfig->Init.DestInc | pNodeConfig->Init.SrcDataWidth |
+                             pNodeConfig->Init.DestDataWidth | pNodeConfig->Init.TransferAllocatedPort |
+                             pNodeConfig->DataHandlingConfig.DataAlignment;
+  if ((pNodeConfig->NodeType & DMA_CHANNEL_TYPE_GPDMA) != 0U)
+  {
+    if (pNodeConfig->Init.SrcBurstLength > 0U)
+    {
+      p_regs[NODE_CTR1_OFFSET] |= ((pNodeConfig->Init.SrcBurstLength - 1U) << DMA_CTR1_SBL_1_Pos) & DMA_CTR1_SBL_1;
+    }
+    if (pNodeConfig->Init.DestBurstLength > 0U)
+    {
+      p_regs[NODE_CTR1_OFFSET] |= ((pNodeConfig->Init.DestBurstLength - 1U) << DMA_CTR1_DBL_1_Pos) & DMA_CTR1_DBL_1;
+    }
+    p_regs[NODE_CTR1_OFFSET] |= pNodeConfig->DataHandlingConfig.DataExchange;
+  }
+
+  /* CTR2 : request, direction, trigger and transfer event */
+  p_regs[NODE_CTR2_OFFSET] = pNodeConfig->Init.TransferEventMode | pNodeConfig->Init.BlkHWRequest |
+                             (pNodeConfig->Init.Request & (DMA_CTR2_REQSEL | DMA_CTR2_SWREQ));
+  if (pNodeConfig->Init.Direction == DMA_MEMORY_TO_MEMORY)
+  {
+    p_regs[NODE_CTR2_OFFSET] |= DMA_CTR2_SWREQ;
+  }
+  else if (pNodeConfig->Init.Direction == DMA_MEMORY_TO_PERIPH)
+  {
+    p_regs[NODE_CTR2_OFFSET] |= DMA_CTR2_DREQ;
+  }
+  else
+  {
+    /* Peripheral to memory */
+  }
+  if (pNodeConfig->TriggerConfig.TriggerPolarity != DMA_TRIG_POLARITY_MASKED)
+  {
+    p_regs[NODE_CTR2_OFFSET] |= pNodeConfig->TriggerConfig.TriggerMode | pNodeConfig->TriggerConfig.TriggerPolarity |
+                                ((pNodeConfig->TriggerConfig.TriggerSelection << DMA_CTR2_TRIGSEL_Pos) &
+                                 DMA_CTR2_TRIGSEL);
+  }
+
+  /* CBR1 : block size, addresses */
+  p_regs[NODE_CBR1_OFFSET] = pNodeConfig->DataSize & DMA_CBR1_BNDT;
+  p_regs[NODE_CSAR_OFFSET] = pNodeConfig->SrcAddress;
+  p_regs[NODE_CDAR_OFFSET] = pNodeConfig->DstAddress;
+
+  if (pNodeConfig->NodeType == DMA_GPDMA_2D_NODE)
+  {
+    if (pNodeConfig->RepeatBlockConfig.RepeatCount > 0U)
+    {
+      p_regs[NODE_CBR1_OFFSET] |= ((pNodeConfig->RepeatBlockConfig.RepeatCount - 1U) << DMA_CBR1_BRC_Pos) &
+                                  DMA_CBR1_BRC;
+    }
+    p_regs[NODE_CTR3_OFFSET] = (((uint32_t)pNodeConfig->RepeatBlockConfig.DestAddrOffset & 0x1FFFU) << 16U) |
+                               ((uint32_t)pNodeConfig->RepeatBlockConfig.SrcAddrOffset & 0x1FFFU);
+    p_regs[NODE_CBR2_OFFSET] = (((uint32_t)pNodeConfig->RepeatBlockConfig.BlkDestAddrOffset & 0xFFFFU) << 16U) |
+                               ((uint32_t)pNodeConfig->RepeatBlockConfig.BlkSrcAddrOffset & 0xFFFFU);
+    cllr_idx = NODE_CLLR_2D_DEFAULT_OFFSET;
+  }
+
+  /* Not linked yet */
+  p_regs[cllr_idx] = 0U;
+  pNode->NodeInfo  = pNodeConfig->NodeType | (cllr_idx << NODE_CLLR_IDX_POS);
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_GetNodeConfig(DMA_NodeConfTypeDef *const pNodeConfig,
+                                               DMA_NodeTypeDef const *const pNode)
+{
+  uint32_t const *p_regs;
+
+  if ((pNodeConfig == NULL) || (pNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  p_regs = pNode->LinkRegisters;
+  (void)memset(pNodeConfig, 0, sizeof(*pNodeConfig));
+
+  pNodeConfig->NodeType                        = pNode->NodeInfo & NODE_TYPE_MASK;
+  pNodeConfig->Init.SrcInc                     = p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_SINC;
+  pNodeConfig->Init.DestInc                    = p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_DINC;
+  pNodeConfig->Init.SrcDataWidth               = p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_SDW_LOG2;
+  pNodeConfig->Init.DestDataWidth              = p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_DDW_LOG2;
+  pNodeConfig->Init.TransferAllocatedPort      = p_regs[NODE_CTR1_OFFSET] & (DMA_CTR1_SAP | DMA_CTR1_DAP);
+  pNodeConfig->DataHandlingConfig.DataAlignment = p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_PAM;
+  pNodeConfig->DataHandlingConfig.DataExchange = p_regs[NODE_CTR1_OFFSET] & (DMA_CTR1_SBX | DMA_CTR1_DBX |
+                                                                             DMA_CTR1_DHX);
+  pNodeConfig->Init.SrcBurstLength  = ((p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_SBL_1) >> DMA_CTR1_SBL_1_Pos) + 1U;
+  pNodeConfig->Init.DestBurstLength = ((p_regs[NODE_CTR1_OFFSET] & DMA_CTR1_DBL_1) >> DMA_CTR1_DBL_1_Pos) + 1U;
+
+  pNodeConfig->Init.TransferEventMode = p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_TCEM;
+  pNodeConfig->Init.BlkHWRequest      = p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_BREQ;
+  if ((p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_SWREQ) != 0U)
+  {
+    pNodeConfig->Init.Request   = DMA_REQUEST_SW;
+    pNodeConfig->Init.Direction = DMA_MEMORY_TO_MEMORY;
+  }
+  else
+  {
+    pNodeConfig->Init.Request   = p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_REQSEL;
+    pNodeConfig->Init.Direction = ((p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_DREQ) != 0U) ? DMA_MEMORY_TO_PERIPH :
+                                  DMA_PERIPH_TO_MEMORY;
+  }
+  pNodeConfig->TriggerConfig.TriggerPolarity  = p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_TRIGPOL;
+  pNodeConfig->TriggerConfig.TriggerMode      = p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_TRIGM;
+  pNodeConfig->TriggerConfig.TriggerSelection = (p_regs[NODE_CTR2_OFFSET] & DMA_CTR2_TRIGSEL) >>
+                                                DMA_CTR2_TRIGSEL_Pos;
+
+  pNodeConfig->DataSize   = p_regs[NODE_CBR1_OFFSET] & DMA_CBR1_BNDT;
+  pNodeConfig->SrcAddress = p_regs[NODE_CSAR_OFFSET];
+  pNodeConfig->DstAddress = p_regs[NODE_CDAR_OFFSET];
+
+  if (NodeIs2D(pNode) != 0U)
+  {
+    pNodeConfig->RepeatBlockConfig.RepeatCount       = ((p_regs[NODE_CBR1_OFFSET] & DMA_CBR1_BRC) >>
+                                                        DMA_CBR1_BRC_Pos) + 1U;
+    pNodeConfig->RepeatBlockConfig.SrcAddrOffset     = (int32_t)(p_regs[NODE_CTR3_OFFSET] & 0x1FFFU);
+    pNodeConfig->RepeatBlockConfig.DestAddrOffset    = (int32_t)((p_regs[NODE_CTR3_OFFSET] >> 16U) & 0x1FFFU);
+    pNodeConfig->RepeatBlockConfig.BlkSrcAddrOffset  = (int32_t)(p_regs[NODE_CBR2_OFFSET] & 0xFFFFU);
+    pNodeConfig->RepeatBlockConfig.BlkDestAddrOffset = (int32_t)(p_regs[NODE_CBR2_OFFSET] >> 16U);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pPrevNode,
+                                            DMA_NodeTypeDef *const pNewNode)
+{
+  DMA_NodeTypeDef *p_last;
+  uint32_t idx;
+
+  if ((pQList == NULL) || (pNewNode == NULL) || (pQList->Type != QUEUE_TYPE_STATIC) ||
+      (pQList->NodeNumber >= QUEUE_MAX_NODES) || (QueueCheckNode(pQList, pNewNode) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pPrevNode == NULL)
+  {
+    /* New head : a circular queue starting at the head now loops from its last node to the same first node */
+    pNewNode->LinkRegisters[NodeCllrIdx(pNewNode)] = (pQList->Head != NULL) ? NodeLink(pQList->Head) : 0U;
+    pQList->Head = pNewNode;
+  }
+  else
+  {
+    if (QueueFind(pQList, pPrevNode, &idx) == 0U)
+    {
+      return HAL_ERROR;
+    }
+
+    pNewNode->LinkRegisters[NodeCllrIdx(pNewNode)] = pPrevNode->LinkRegisters[NodeCllrIdx(pPrevNode)];
+    pPrevNode->LinkRegisters[NodeCllrIdx(pPrevNode)] = NodeLink(pNewNode);
+  }
+
+  pQList->NodeNumber++;
+
+  /* Keep the loop closed on the first circular node */
+  if ((pQList->FirstCircularNode != NULL) && (pPrevNode == NULL))
+  {
+    p_last = QueueNode(pQList, pQList->NodeNumber - 1U);
+    p_last->LinkRegisters[NodeCllrIdx(p_last)] = NodeLink(pQList->FirstCircularNode);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pNewNode)
+{
+  if ((pQList == NULL) || (pNewNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pQList->NodeNumber == 0U)
+  {
+    if ((pQList->Type != QUEUE_TYPE_STATIC) || (QueueCheckNode(pQList, pNewNode) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+
+    pNewNode->LinkRegisters[NodeCllrIdx(pNewNode)] = 0U;
+    pQList->Head       = pNewNode;
+    pQList->NodeNumber = 1U;
+
+    return HAL_OK;
+  }
+
+  return HAL_DMAEx_List_InsertNode(pQList, QueueNode(pQList, pQList->NodeNumber - 1U), pNewNode);
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pNode)
+{
+  DMA_NodeTypeDef *p_prev;
+  DMA_NodeTypeDef *p_last;
+  uint32_t idx;
+
+  if ((pQList == NULL) || (pNode == NULL) || (pQList->Type != QUEUE_TYPE_STATIC) ||
+      (QueueFind(pQList, pNode, &idx) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pQList->NodeNumber == 1U)
+  {
+    pQList->Head              = NULL;
+    pQList->FirstCircularNode = NULL;
+  }
+  else if (idx == 0U)
+  {
+    pQList->Head = NodeNext(pQList, pNode);
+  }
+  else
+  {
+    p_prev = QueueNode(pQList, idx - 1U);
+    p_prev->LinkRegisters[NodeCllrIdx(p_prev)] = pNode->LinkRegisters[NodeCllrIdx(pNode)];
+  }
+
+  pQList->NodeNumber--;
+  pNode->LinkRegisters[NodeCllrIdx(pNode)] = 0U;
+
+  /* The loop restarts on the node following the removed first circular node */
+  if ((pQList->FirstCircularNode == pNode) && (pQList->NodeNumber > 0U))
+  {
+    pQList->FirstCircularNode = QueueNode(pQList, (idx < pQList->NodeNumber) ? idx : 0U);
+    p_last = QueueNode(pQList, pQList->NodeNumber - 1U);
+    p_last->LinkRegisters[NodeCllrIdx(p_last)] = NodeLink(pQList->FirstCircularNode);
+  }
+  else if ((pQList->FirstCircularNode != NULL) && (idx == 0U))
+  {
+    /* Removing a head that is not in the loop : the loop is unchanged */
+  }
+  else
+  {
+    /* Nothing else to update */
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularModeConfig(DMA_QListTypeDef *const pQList,
+                                                       DMA_NodeTypeDef *const pFirstCircularNode)
+{
+  DMA_NodeTypeDef *p_last;
+  uint32_t idx;
+
+  if ((pQList == NULL) || (pFirstCircularNode == NULL) || (pQList->NodeNumber == 0U) ||
+      (QueueFind(pQList, pFirstCircularNode, &idx) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  p_last = QueueNode(pQList, pQList->NodeNumber - 1U);
+  p_last->LinkRegisters[NodeCllrIdx(p_last)] = NodeLink(pFirstCircularNode);
+  pQList->FirstCircularNode = pFirstCircularNode;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularMode(DMA_QListTypeDef *const pQList)
+{
+  if (pQList == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_DMAEx_List_SetCircularModeConfig(pQList, pQList->Head);
+}
+
+/* Registers of each node in execution order, as loaded by the channel : nodes[idx * 8 + register] */
+static uint32_t *QueueUnpack(DMA_QListTypeDef const *pQList)
+{
+  DMA_NodeTypeDef const *p_node = pQList->Head;
+  uint32_t *p_regs;
+  uint32_t *p_cur;
+  uint32_t mask;
+  uint32_t word;
+  uint32_t idx;
+  uint32_t reg;
+
+  p_regs = calloc(pQList->NodeNumber * NODE_REGISTER_NUMBER, sizeof(uint32_t));
+  if (p_regs == NULL)
+  {
+    return NULL;
+  }
+
+  /* The head is loaded with all its registers when the channel starts */
+  mask = NodeFullMask(p_node);
+  for (idx = 0U; idx < pQList->NodeNumber; idx++)
+  {
+    p_cur = &p_regs[idx * NODE_REGISTER_NUMBER];
+    if (idx > 0U)
+    {
+      (void)memcpy(p_cur, p_cur - NODE_REGISTER_NUMBER, NODE_REGISTER_NUMBER * sizeof(uint32_t));
+    }
+
+    word = 0U;
+    for (reg = 0U; reg < NODE_REGISTER_NUMBER; reg++)
+    {
+      if ((mask & cllr_update[reg]) != 0U)
+      {
+        p_cur[reg] = p_node->LinkRegisters[word];
+        word++;
+      }
+    }
+
+    mask   = p_cur[NODE_REGISTER_NUMBER - 1U] & ~DMA_CLLR_LA;
+    p_node = NodeNext(pQList, p_node);
+    if ((p_node == NULL) && ((idx + 1U) < pQList->NodeNumber))
+    {
+      free(p_regs);
+      return NULL;
+    }
+  }
+
+  return p_regs;
+}
+
+/* Update bits loading the registers of a node that differ from the previous executed node */
+static uint32_t NodeDiffMask(uint32_t const *pCur, uint32_t const *pPrev, DMA_NodeTypeDef const *pNode)
+{
+  /* CBR1 is always reloaded as BNDT is consumed by the transfer */
+  uint32_t mask = DMA_CLLR_UB1 | DMA_CLLR_ULL;
+
+  if (pCur[NODE_CTR1_OFFSET] != pPrev[NODE_CTR1_OFFSET])
+  {
+    mask |= DMA_CLLR_UT1;
+  }
+  if (pCur[NODE_CTR2_OFFSET] != pPrev[NODE_CTR2_OFFSET])
+  {
+    mask |= DMA_CLLR_UT2;
+  }
+
+  /* CSAR and CDAR are left incremented by the previous transfer */
+  if ((pCur[NODE_CSAR_OFFSET] != pPrev[NODE_CSAR_OFFSET]) || ((pPrev[NODE_CTR1_OFFSET] & DMA_CTR1_SINC) != 0U))
+  {
+    mask |= DMA_CLLR_USA;
+  }
+  if ((pCur[NODE_CDAR_OFFSET] != pPrev[NODE_CDAR_OFFSET]) || ((pPrev[NODE_CTR1_OFFSET] & DMA_CTR1_DINC) != 0U))
+  {
+    mask |= DMA_CLLR_UDA;
+  }
+
+  if (NodeIs2D(pNode) != 0U)
+  {
+    if (pCur[NODE_CTR3_OFFSET] != pPrev[NODE_CTR3_OFFSET])
+    {
+      mask |= DMA_CLLR_UT3;
+    }
+    if (pCur[NODE_CBR2_OFFSET] != pPrev[NODE_CBR2_OFFSET])
+    {
+      mask |= DMA_CLLR_UB2;
+    }
+  }
+
+  return mask;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_ConvertQToDynamic(DMA_QListTypeDef *const pQList)
+{
+  DMA_NodeTypeDef *p_node;
+  DMA_NodeTypeDef *p_next;
+  uint32_t *p_regs;
+  uint32_t *p_cur;
+  uint32_t mask;
+  uint32_t word;
+  uint32_t idx;
+  uint32_t reg;
+
+  if ((pQList == NULL) || (pQList->NodeNumber == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pQList->Type == QUEUE_TYPE_DYNAMIC)
+  {
+    return HAL_OK;
+  }
+
+  p_regs = QueueUnpack(pQList);
+  if (p_regs == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Link each node with the registers differing from the previous executed node. The head and the first circular
+     node are reached from two different nodes and are kept with all their registers. */
+  p_node = pQList->Head;
+  for (idx = 0U; idx < pQList->NodeNumber; idx++)
+  {
+    p_cur  = &p_regs[idx * NODE_REGISTER_NUMBER];
+    p_next = NodeNext(pQList, p_node);
+
+    if (p_next != NULL)
+    {
+      if ((p_next == pQList->Head) || (p_next == pQList->FirstCircularNode))
+      {
+        mask = NodeFullMask(p_next);
+      }
+      else
+      {
+        mask = NodeDiffMask(p_cur + NODE_REGISTER_NUMBER, p_cur, p_next);
+      }
+      p_cur[NODE_REGISTER_NUMBER - 1U] = (p_cur[NODE_REGISTER_NUMBER - 1U] & DMA_CLLR_LA) | mask;
+    }
+    p_node = p_next;
+  }
+
+  /* Pack the nodes */
+  p_node = pQList->Head;
+  mask   = NodeFullMask(p_node);
+  for (idx = 0U; idx < pQList->NodeNumber; idx++)
+  {
+    p_cur  = &p_regs[idx * NODE_REGISTER_NUMBER];
+    p_next = NodeNext(pQList, p_node);
+
+    (void)memset(p_node->LinkRegisters, 0, sizeof(p_node->LinkRegisters));
+    word = 0U;
+    for (reg = 0U; reg < NODE_REGISTER_NUMBER; reg++)
+    {
+      if ((mask & cllr_update[reg]) != 0U)
+      {
+        p_node->LinkRegisters[word] = p_cur[reg];
+        word++;
+      }
+    }
+    p_node->NodeInfo = (p_node->NodeInfo & ~NODE_CLLR_IDX) | ((word - 1U) << NODE_CLLR_IDX_POS);
+
+    mask   = p_cur[NODE_REGISTER_NUMBER - 1U] & ~DMA_CLLR_LA;
+    p_node = p_next;
+  }
+
+  free(p_regs);
+  pQList->Type = QUEUE_TYPE_DYNAMIC;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_ConvertQToStatic(DMA_QListTypeDef *const pQList)
+{
+  DMA_NodeTypeDef *p_node;
+  uint32_t *p_regs;
+  uint32_t *p_cur;
+  uint32_t cllr_idx;
+  uint32_t idx;
+
+  if ((pQList == NULL) || (pQList->NodeNumber == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pQList->Type == QUEUE_TYPE_STATIC)
+  {
+    return HAL_OK;
+  }
+
+  p_regs = QueueUnpack(pQList);
+  if (p_regs == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Nodes are linked in execution order : the links are rebuilt from the unpacked addresses */
+  p_node = pQList->Head;
+  for (idx = 0U; idx < pQList->NodeNumber; idx++)
+  {
+    p_cur    = &p_regs[idx * NODE_REGISTER_NUMBER];
+    cllr_idx = (NodeIs2D(p_node) != 0U) ? NODE_CLLR_2D_DEFAULT_OFFSET : NODE_CLLR_LINEAR_DEFAULT_OFFSET;
+
+    (void)memcpy(p_node->LinkRegisters, p_cur, cllr_idx * sizeof(uint32_t));
+    p_node->LinkRegisters[cllr_idx] = p_cur[NODE_REGISTER_NUMBER - 1U] & DMA_CLLR_LA;
+    p_node->NodeInfo = (p_node->NodeInfo & ~NODE_CLLR_IDX) | (cllr_idx << NODE_CLLR_IDX_POS);
+    p_node = NodeNext(pQList, p_node);
+  }
+
+  /* Set the update bits once all the nodes are formatted */
+  p_node = pQList->Head;
+  for (idx = 0U; idx < pQList->NodeNumber; idx++)
+  {
+    DMA_NodeTypeDef *p_next = NodeNext(pQList, p_node);
+
+    if (p_next != NULL)
+    {
+      p_node->LinkRegisters[NodeCllrIdx(p_node)] = NodeLink(p_next);
+    }
+    p_node = p_next;
+  }
+
+  free(p_regs);
+  pQList->Type = QUEUE_TYPE_STATIC;
+
+  return HAL_OK;
+}
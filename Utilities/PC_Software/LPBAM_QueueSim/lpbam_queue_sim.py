@@ -0,0 +1,380 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    lpbam_queue_sim.py
+#  @author  MCD Application Team
+#  @brief   LPBAM queue simulator, replays a DMA linked-list queue from a memory dump and estimates the Stop 2 residency
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+The queue is read from a binary dump of the memory holding the LPBAM descriptors and buffers (.LPBAM_Section), taken
+after the queue is built and linked, for instance with GDB:
+    dump binary memory lpbam.bin 0x28000000 0x28004000
+Either the DMA_QListTypeDef variable (--queue) or the head node (--head) address is given.
+
+The linked-list items are replayed as the GPDMA / LPDMA channel does:
+ - the head node is loaded with all its registers, each next item is loaded with the registers selected by the
+   update bits of the current CLLR (UT1, UT2, UB1, USA, UDA, UT3, UB2, ULL), so static and dynamic queues are handled,
+ - BNDT bytes are transferred from CSAR to CDAR, by single transfers of the source data width; CSAR / CDAR are left
+   incremented as by the hardware,
+ - the transfers to or from addresses outside of the dumps hit a mocked register map (see --reg),
+ - an item with LA = 0 ends the queue, an item linking to an already executed item starts a new iteration.
+
+For each iteration, the register writes, the transfers, the trigger and request waits and the transfer complete
+events are reported. The timing model then estimates the time spent with the DMA running (kernel clock on), the time
+the system stays in Stop 2 waiting for triggers and requests, and the average current. The cycle counts and currents
+are indicative defaults, set them from the product datasheet for the application conditions.
+
+Usage: python lpbam_queue_sim.py --dump lpbam.bin@0x28000000 (--queue ADDR | --head ADDR) [--iterations N]
+                                 [--reg ADDR=VALUE]... [--trigger-period SEL=US]... [--request-period SEL=US]...
+                                 [--tc-wakeup] [--json]
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+NODE_SIZE = 36                # sizeof(DMA_NodeTypeDef) : LinkRegisters[8] + NodeInfo
+NODE_INFO_OFFSET = 32
+NODE_TYPE_2D = 0x02           # DMA_CHANNEL_TYPE_2D_ADDR bit of NodeInfo
+
+# CLLR update bits, in the order the channel loads the registers
+CLLR_UPDATES = [("CTR1", 31), ("CTR2", 30), ("CBR1", 29), ("CSAR", 28), ("CDAR", 27), ("CTR3", 26), ("CBR2", 25),
+                ("CLLR", 16)]
+CLLR_LA = 0x0000FFFC
+LBA_MASK = 0xFFFF0000
+
+# Peripherals reachable by the LPBAM sub-system (non-secure aliases, secure aliases are folded)
+PERIPHERALS = [
+    (0x40020000, 0x1000, "GPDMA1"),
+    (0x42020000, 0x2400, "GPIO"),
+    (0x46000400, 0x0400, "SYSCFG"),
+    (0x46002000, 0x0400, "SPI3"),
+    (0x46002400, 0x0400, "LPUART1"),
+    (0x46002800, 0x0400, "I2C3"),
+    (0x46004400, 0x0400, "LPTIM1"),
+    (0x46004800, 0x0400, "LPTIM3"),
+    (0x46004C00, 0x0400, "LPTIM4"),
+    (0x46005000, 0x0400, "OPAMP"),
+    (0x46005400, 0x0400, "COMP"),
+    (0x46007400, 0x0400, "VREFBUF"),
+    (0x46020000, 0x0400, "LPGPIO1"),
+    (0x46021000, 0x0400, "ADC4"),
+    (0x46021800, 0x0400, "DAC1"),
+    (0x46025000, 0x1000, "LPDMA1"),
+]
+DMA_CHANNEL_REGS = {0x00: "CLBAR", 0x0C: "CFCR", 0x10: "CSR", 0x14: "CCR", 0x40: "CTR1", 0x44: "CTR2", 0x48: "CBR1",
+                    0x4C: "CSAR", 0x50: "CDAR", 0x54: "CTR3", 0x58: "CBR2", 0x7C: "CLLR"}
+
+
+def register_name(address):
+    if (address & 0xF0000000) == 0x50000000:
+        address -= 0x10000000
+    for base, size, name in PERIPHERALS:
+        if base <= address < base + size:
+            offset = address - base
+            if name in ("GPDMA1", "LPDMA1") and offset >= 0x50:
+                channel, reg = divmod(offset - 0x50, 0x80)
+                if reg in DMA_CHANNEL_REGS:
+                    return "%s_CH%u.%s" % (name, channel, DMA_CHANNEL_REGS[reg])
+            return "%s+0x%03X" % (name, offset)
+    return "0x%08X" % address
+
+
+class SimError(Exception):
+    pass
+
+
+class Memory:
+    """Dumped memory regions backed by bytearrays, any other address is a mocked 32-bit register."""
+
+    def __init__(self, regs):
+        self.regions = []
+        self.regs = dict(regs)
+
+    def add_region(self, base, data):
+        self.regions.append((base, bytearray(data)))
+
+    def region(self, address, size):
+        for base, data in self.regions:
+            if base <= address and address + size <= base + len(data):
+                return base, data
+        return None, None
+
+    def read(self, address, size):
+        base, data = self.region(address, size)
+        if data is not None:
+            return int.from_bytes(data[address - base:address - base + size], "little")
+        value = self.regs.get(address & ~3, 0)
+        return (value >> ((address & 3) * 8)) & ((1 << (size * 8)) - 1)
+
+    def write(self, address, size, value):
+        """Write memory, return True when the address is a mocked register."""
+        base, data = self.region(address, size)
+        if data is not None:
+            data[address - base:address - base + size] = value.to_bytes(size, "little")
+            return False
+        word = address & ~3
+        shift = (address & 3) * 8
+        mask = ((1 << (size * 8)) - 1) << shift
+        self.regs[word] = (self.regs.get(word, 0) & ~mask) | ((value << shift) & mask)
+        return True
+
+    def word(self, address):
+        base, data = self.region(address, 4)
+        if data is None:
+            raise SimError("address 0x%08X is not in the dumped memory" % address)
+        return struct.unpack_from("<I", data, address - base)[0]
+
+
+class Iteration:
+    def __init__(self, index):
+        self.index = index
+        self.nodes = 0
+        self.words = 0
+        self.transfers = 0
+        self.bytes = 0
+        self.writes = []
+        self.trigger_waits = {}
+        self.request_waits = {}
+        self.tc_events = 0
+
+    def as_dict(self):
+        return {
+            "iteration": self.index, "nodes": self.nodes, "loaded_words": self.words, "transfers": self.transfers,
+            "bytes": self.bytes, "trigger_waits": self.trigger_waits, "request_waits": self.request_waits,
+            "tc_events": self.tc_events,
+            "writes": [{"address": "0x%08X" % a, "register": register_name(a), "value": "0x%08X" % v}
+                       for a, v in self.writes],
+        }
+
+
+class Channel:
+    def __init__(self, memory, head, max_nodes):
+        self.memory = memory
+        self.head = head
+        self.max_nodes = max_nodes
+        self.regs = dict.fromkeys([name for name, _ in CLLR_UPDATES], 0)
+        self.visited = set()
+
+    def load(self, address, updates):
+        """Load the linked-list item at address with the registers selected by the update bits."""
+        loaded = 0
+        for name, bit in CLLR_UPDATES:
+            if updates & (1 << bit):
+                self.regs[name] = self.memory.word(address + loaded * 4)
+                loaded += 1
+        return loaded
+
+    def transfer(self, it):
+        ctr1, ctr2, cbr1 = self.regs["CTR1"], self.regs["CTR2"], self.regs["CBR1"]
+        bndt = cbr1 & 0xFFFF
+        repeat = ((cbr1 >> 16) & 0x7FF) + 1
+        src_width = 1 << (ctr1 & 0x3)
+        dst_width = 1 << ((ctr1 >> 16) & 0x3)
+        src_inc = bool(ctr1 & (1 << 3))
+        dst_inc = bool(ctr1 & (1 << 19))
+        swreq = bool(ctr2 & (1 << 9))
+        reqsel = ctr2 & 0x7F
+        trigsel = (ctr2 >> 16) & 0x3F
+        trigpol = (ctr2 >> 24) & 0x3
+        trigm = (ctr2 >> 14) & 0x3
+        tcem = (ctr2 >> 30) & 0x3
+
+        if trigpol != 0 and trigm in (0, 1):
+            self.wait(it.trigger_waits, trigsel)
+        if bndt == 0:
+            return tcem, trigpol, trigm, trigsel
+
+        singles = bndt // src_width
+        for _ in range(repeat):
+            for _ in range(singles):
+                if trigpol != 0 and trigm == 3:
+                    self.wait(it.trigger_waits, trigsel)
+                if not swreq:
+                    self.wait(it.request_waits, reqsel)
+                value = self.memory.read(self.regs["CSAR"], src_width)
+                # Right aligned, left truncated or zero padded
+                value &= (1 << (dst_width * 8)) - 1
+                if self.memory.write(self.regs["CDAR"], dst_width, value):
+                    it.writes.append((self.regs["CDAR"], self.memory.regs[self.regs["CDAR"] & ~3]))
+                it.transfers += 1
+                it.bytes += src_width
+                if src_inc:
+                    self.regs["CSAR"] = (self.regs["CSAR"] + src_width) & 0xFFFFFFFF
+                if dst_inc:
+                    self.regs["CDAR"] = (self.regs["CDAR"] + dst_width) & 0xFFFFFFFF
+        self.regs["CBR1"] &= ~0xFFFF
+        if tcem == 0:
+            it.tc_events += repeat
+        elif tcem in (1, 2):
+            it.tc_events += 1
+        return tcem, trigpol, trigm, trigsel
+
+    @staticmethod
+    def wait(counters, selection):
+        counters[selection] = counters.get(selection, 0) + 1
+
+    def run(self, iterations):
+        node_info = self.memory.word(self.head + NODE_INFO_OFFSET)
+        updates = sum(1 << bit for name, bit in CLLR_UPDATES
+                      if not (name in ("CTR3", "CBR2") and not node_info & NODE_TYPE_2D))
+        address = self.head
+        base = self.head & LBA_MASK
+        loop = None
+        results = []
+        it = Iteration(0)
+        executed = 0
+        while True:
+            if address in self.visited:
+                # Linking back to an executed item : the queue is circular, start a new iteration
+                loop = address
+                results.append(it)
+                if len(results) == iterations:
+                    break
+                it = Iteration(len(results))
+                self.visited = set()
+            self.visited.add(address)
+            it.nodes += 1
+            it.words += self.load(address, updates)
+            tcem, trigpol, trigm, trigsel = self.transfer(it)
+            executed += 1
+            if executed > self.max_nodes:
+                raise SimError("more than %u items executed without iteration end" % self.max_nodes)
+            cllr = self.regs["CLLR"]
+            if trigpol != 0 and trigm == 2:
+                self.wait(it.trigger_waits, trigsel)
+            if (cllr & CLLR_LA) == 0:
+                if tcem == 3:
+                    it.tc_events += 1
+                results.append(it)
+                break
+            address = base | (cllr & CLLR_LA)
+            updates = cllr & ~CLLR_LA & 0xFFFF0000
+        return results, loop
+
+
+def parse_assignments(values, what):
+    result = {}
+    for value in values or []:
+        key, sep, val = value.partition("=")
+        if not sep:
+            raise SimError("%s must be given as KEY=VALUE : %s" % (what, value))
+        result[int(key, 0)] = float(val) if what != "--reg" else int(val, 0)
+    return result
+
+
+def estimate(it, args, trigger_periods, request_periods):
+    active_cycles = it.words * args.load_cycles + it.transfers * args.transfer_cycles
+    active_us = active_cycles / args.clock_mhz
+    wait_us = sum(trigger_periods.get(sel, 0.0) * n for sel, n in it.trigger_waits.items())
+    wait_us += sum(request_periods.get(sel, 0.0) * n for sel, n in it.request_waits.items())
+    wakeups = it.tc_events if args.tc_wakeup else 0
+    run_us = wakeups * args.wakeup_us
+    total_us = active_us + wait_us + run_us
+    stop2_us = max(total_us - active_us - run_us, 0.0)
+    current = 0.0
+    if total_us > 0:
+        current = (stop2_us * args.stop2_ua + active_us * (args.stop2_ua + args.dma_ua) + run_us * args.run_ua) / total_us
+    missing = sorted(["trigger %u" % s for s in it.trigger_waits if s not in trigger_periods] +
+                     ["request %u" % s for s in it.request_waits if s not in request_periods])
+    return {"active_us": active_us, "wait_us": wait_us, "cpu_wakeups": wakeups, "cpu_run_us": run_us,
+            "iteration_us": total_us, "stop2_us": stop2_us,
+            "stop2_ratio": stop2_us / total_us if total_us > 0 else 0.0,
+            "average_ua": current, "unknown_periods": missing}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="LPBAM linked-list queue simulator")
+    parser.add_argument("--dump", action="append", required=True, metavar="FILE@ADDR",
+                        help="binary memory dump and its base address, may be repeated")
+    start = parser.add_mutually_exclusive_group(required=True)
+    start.add_argument("--queue", type=lambda v: int(v, 0), help="address of the DMA_QListTypeDef variable")
+    start.add_argument("--head", type=lambda v: int(v, 0), help="address of the queue head node")
+    parser.add_argument("--iterations", type=int, default=2, help="iterations replayed for circular queues")
+    parser.add_argument("--max-nodes", type=int, default=100000, help="executed items limit")
+    parser.add_argument("--reg", action="append", metavar="ADDR=VALUE", help="mocked register value")
+    parser.add_argument("--trigger-period", action="append", metavar="SEL=US",
+                        help="time between two events of a trigger selection, in us")
+    parser.add_argument("--request-period", action="append", metavar="SEL=US",
+                        help="time between two requests of a request selection, in us")
+    parser.add_argument("--clock-mhz", type=float, default=16.0, help="DMA clock in Stop 2 (HSI16)")
+    parser.add_argument("--load-cycles", type=float, default=4.0, help="cycles per loaded item register")
+    parser.add_argument("--transfer-cycles", type=float, default=8.0, help="cycles per single transfer")
+    parser.add_argument("--tc-wakeup", action="store_true", help="the transfer complete interrupt wakes up the CPU")
+    parser.add_argument("--wakeup-us", type=float, default=50.0, help="CPU run time per wakeup, in us")
+    parser.add_argument("--stop2-ua", type=float, default=4.0, help="Stop 2 current, in uA")
+    parser.add_argument("--dma-ua", type=float, default=150.0, help="additional current when the DMA runs, in uA")
+    parser.add_argument("--run-ua", type=float, default=3000.0, help="current when the CPU runs, in uA")
+    parser.add_argument("--json", action="store_true", help="JSON report")
+    args = parser.parse_args()
+
+    try:
+        memory = Memory(parse_assignments(args.reg, "--reg"))
+        for dump in args.dump:
+            path, sep, addr = dump.rpartition("@")
+            if not sep:
+                raise SimError("--dump must be given as FILE@ADDR : %s" % dump)
+            with open(path, "rb") as f:
+                memory.add_region(int(addr, 0), f.read())
+        trigger_periods = parse_assignments(args.trigger_period, "--trigger-period")
+        request_periods = parse_assignments(args.request_period, "--request-period")
+
+        queue = None
+        head = args.head
+        if args.queue is not None:
+            head = memory.word(args.queue)
+            queue = {"head": head, "first_circular": memory.word(args.queue + 4),
+                     "node_number": memory.word(args.queue + 8)}
+            if head == 0:
+                raise SimError("empty queue")
+        results, loop = Channel(memory, head, args.max_nodes).run(args.iterations)
+    except (OSError, ValueError, SimError) as error:
+        sys.exit("error: %s" % error)
+
+    report = {"head": "0x%08X" % head, "circular": loop is not None,
+              "loop": "0x%08X" % loop if loop is not None else None,
+              "iterations": [dict(it.as_dict(), estimate=estimate(it, args, trigger_periods, request_periods))
+                             for it in results]}
+    if queue is not None:
+        report["queue"] = {"node_number": queue["node_number"], "node_memory": queue["node_number"] * NODE_SIZE,
+                           "first_circular": "0x%08X" % queue["first_circular"]}
+
+    if args.json:
+        print(json.dumps(report, indent=2))
+        return
+
+    print("head         0x%08X%s" % (head, ("  circular from 0x%08X" % loop) if loop is not None else ""))
+    if queue is not None:
+        print("queue        %u nodes, %u bytes" % (queue["node_number"], queue["node_number"] * NODE_SIZE))
+    for it, entry in zip(results, report["iterations"]):
+        est = entry["estimate"]
+        print("iteration %u" % it.index)
+        print("  items      %u (%u words loaded)" % (it.nodes, it.words))
+        print("  transfers  %u (%u bytes), %u register writes, %u TC events" % (
+            it.transfers, it.bytes, len(it.writes), it.tc_events))
+        for address, value in it.writes:
+            print("    %-22s <- 0x%08X" % (register_name(address), value))
+        for sel, count in sorted(it.trigger_waits.items()):
+            print("  trigger    sel %-3u %u waits" % (sel, count))
+        for sel, count in sorted(it.request_waits.items()):
+            print("  request    sel %-3u %u waits" % (sel, count))
+        print("  time       %.1f us : DMA %.1f us, Stop 2 %.1f us (%.1f %%), CPU %u wakeups %.1f us" % (
+            est["iteration_us"], est["active_us"], est["stop2_us"], est["stop2_ratio"] * 100,
+            est["cpu_wakeups"], est["cpu_run_us"]))
+        print("  current    %.1f uA average" % est["average_ua"])
+        if est["unknown_periods"]:
+            print("  note       no period given for %s" % ", ".join(est["unknown_periods"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,441 @@
+/**
+  ******************************************************************************
+  * @file    lpbam_queue_test.c
+  * @author  MCD Application Team
+  * @brief   Reference scenarios of the LPBAM utility built on the host : the
+  *          queues are built by the advanced APIs, replayed in-process and
+  *          checked for the peripheral register writes, the transfer counts,
+  *          the trigger and request waits and the Stop 2 estimate.
+  *          Usage : lpbam_queue_test [-v]
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "stm32_lpbam.h"
+#include "lpbam_replay.h"
+
+#define ITERATIONS                  3U
+
+#define CHECK(COND, ...)                                                        \
+  do                                                                            \
+  {                                                                             \
+    if (!(COND))                                                                \
+    {                                                                           \
+      (void)printf("  FAIL line %d : ", __LINE__);                              \
+      (void)printf(__VA_ARGS__);                                                \
+      (void)printf("\n");                                                       \
+      failures++;                                                               \
+    }                                                                           \
+  } while (0)
+
+/* LPBAM memory section : the nodes of a queue share the upper 16 bits of their addresses */
+static struct
+{
+  uint32_t                         Reserved[4];  /* CLLR.LA = 0 ends a list : no node at the section base */
+  LPBAM_LPTIM_PWMFullDesc_t        Pwm[3];
+  LPBAM_GPIO_WritePinFullDesc_t    Pin[2];
+  LPBAM_GPIO_WritePinSeqFullDesc_t PinSeq;
+  uint32_t                         PinStates[4];
+} lpbam_section __attribute__((aligned(0x10000)));
+
+static DMA_QListTypeDef            queue;
+static LPBAM_REPLAY_Iteration_t    results[ITERATIONS];
+static LPBAM_REPLAY_Memory_t const memory = {1U, {{&lpbam_section, sizeof(lpbam_section)}}};
+static const LPBAM_DMAListInfo_t   dma_list_info = {LPBAM_LINEAR_ADDRESSING_Q, LPDMA1};
+static uint32_t                    verbose;
+static uint32_t                    failures;
+
+/* PWM step of a scenario */
+typedef struct
+{
+  LPTIM_TypeDef                *pInstance;
+  LPBAM_LPTIM_PWMFullAdvConf_t Config;
+} PwmStep_t;
+
+static void ResetQueue(void)
+{
+  (void)memset(&queue, 0, sizeof(queue));
+  (void)memset(&lpbam_section, 0, sizeof(lpbam_section));
+  (void)memset(&host_periph, 0, sizeof(host_periph));
+}
+
+static LPBAM_Status_t BuildPwmStep(void const *const pContext, void *const pDescriptor, DMA_QListTypeDef *const pQueue)
+{
+  PwmStep_t const *p_step = (PwmStep_t const *)pContext;
+
+  return ADV_LPBAM_LPTIM_PWM_SetFullQ(p_step->pInstance, LPBAM_LPTIM_CHANNEL_1, &dma_list_info, &p_step->Config,
+                                      (LPBAM_LPTIM_PWMFullDesc_t *)pDescriptor, pQueue);
+}
+
+static void Report(char const *pName, uint32_t IterationNumber, LPBAM_REPLAY_Model_t const *pModel)
+{
+  LPBAM_REPLAY_Estimate_t est;
+  uint32_t idx;
+  uint32_t sel;
+
+  if (verbose == 0U)
+  {
+    return;
+  }
+
+  (void)printf("  %s : %u nodes\n", pName, (unsigned int)queue.NodeNumber);
+  for (idx = 0U; idx < IterationNumber; idx++)
+  {
+    LPBAM_REPLAY_Iteration_t const *p_it = &results[idx];
+
+    (void)printf("    iteration %u : %u items, %u words, %u transfers, %u TC events\n", (unsigned int)idx,
+                 (unsigned int)p_it->Nodes, (unsigned int)p_it->Words, (unsigned int)p_it->Transfers,
+                 (unsigned int)p_it->TcEvents);
+    for (sel = 0U; (sel < p_it->WriteNumber) && (sel < LPBAM_REPLAY_MAX_WRITES); sel++)
+    {
+      (void)printf("      %-16s <- 0x%08X\n", LPBAM_REPLAY_RegisterName(p_it->Writes[sel].Address),
+                   (unsigned int)p_it->Writes[sel].Value);
+    }
+    for (sel = 0U; sel < LPBAM_REPLAY_TRIGGERS; sel++)
+    {
+      if (p_it->TriggerWaits[sel] != 0U)
+      {
+        (void)printf("      trigger sel %u : %u waits\n", (unsigned int)sel, (unsigned int)p_it->TriggerWaits[sel]);
+      }
+    }
+    for (sel = 0U; sel < LPBAM_REPLAY_REQUESTS; sel++)
+    {
+      if (p_it->RequestWaits[sel] != 0U)
+      {
+        (void)printf("      request sel %u : %u waits\n", (unsigned int)sel, (unsigned int)p_it->RequestWaits[sel]);
+      }
+    }
+    if (pModel != NULL)
+    {
+      LPBAM_REPLAY_Estimate(p_it, pModel, &est);
+      (void)printf("      %.1f us : DMA %.2f us, Stop 2 %.1f us (%.2f %%), %.3f uA average\n", est.IterationUs,
+                   est.ActiveUs, est.Stop2Us, est.Stop2Ratio * 100.0, est.AverageuA);
+    }
+  }
+}
+
+static uint32_t CheckWrites(LPBAM_REPLAY_Iteration_t const *pIt, LPBAM_REPLAY_Write_t const *pExpected,
+                            uint32_t Number)
+{
+  uint32_t idx;
+
+  if (pIt->WriteNumber != Number)
+  {
+    return 0U;
+  }
+
+  for (idx = 0U; idx < Number; idx++)
+  {
+    if ((pIt->Writes[idx].Address != pExpected[idx].Address) || (pIt->Writes[idx].Value != pExpected[idx].Value))
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+static uint32_t Near(double Value, double Expected)
+{
+  return (fabs(Value - Expected) < 1e-6) ? 1U : 0U;
+}
+
+/* Circular PWM update : the period waits for the LPTIM1 update event request, the pulse follows by software */
+static void ScenarioPwmCircular(void)
+{
+  const LPBAM_LPTIM_PWMFullAdvConf_t pwm = {100U, ENABLE, 50U, ENABLE, 0U, DISABLE};
+  const LPBAM_REPLAY_Write_t expected[] =
+  {
+    {(uint32_t)(uintptr_t)&LPTIM1->ARR, 100U}, {(uint32_t)(uintptr_t)&LPTIM1->CCR1, 50U}
+  };
+  LPBAM_REPLAY_Model_t model;
+  LPBAM_REPLAY_Estimate_t est;
+  uint32_t iterations;
+  uint32_t circular;
+  uint32_t idx;
+
+  (void)printf("pwm_circular\n");
+  ResetQueue();
+
+  CHECK(ADV_LPBAM_LPTIM_PWM_SetFullQ(LPTIM1, LPBAM_LPTIM_CHANNEL_1, &dma_list_info, &pwm, &lpbam_section.Pwm[0],
+                                     &queue) == LPBAM_OK, "PWM queue build");
+  CHECK(ADV_LPBAM_Q_SetCircularMode(&lpbam_section.Pwm[0], LPBAM_LPTIM_PWM_FULLQ_CONFIG_NODE, &queue) == LPBAM_OK,
+        "circular mode");
+  CHECK(LPBAM_REPLAY_Run(&queue, &memory, ITERATIONS, results, &iterations, &circular) == 0, "replay");
+  CHECK((iterations == ITERATIONS) && (circular == 1U), "%u iterations, circular %u", (unsigned int)iterations,
+        (unsigned int)circular);
+
+  for (idx = 0U; idx < iterations; idx++)
+  {
+    CHECK(results[idx].Nodes == 2U, "iteration %u : %u items", (unsigned int)idx, (unsigned int)results[idx].Nodes);
+    CHECK(results[idx].Words == 12U, "iteration %u : %u words", (unsigned int)idx, (unsigned int)results[idx].Words);
+    CHECK(results[idx].Transfers == 2U, "iteration %u : %u transfers", (unsigned int)idx,
+          (unsigned int)results[idx].Transfers);
+    CHECK(CheckWrites(&results[idx], expected, 2U) != 0U, "iteration %u : ARR / CCR1 writes", (unsigned int)idx);
+    CHECK(results[idx].RequestWaits[LPDMA1_REQUEST_LPTIM1_UE] == 1U, "iteration %u : LPTIM1 UE request waits",
+          (unsigned int)idx);
+    CHECK(results[idx].TcEvents == 0U, "iteration %u : TC events of a circular queue", (unsigned int)idx);
+  }
+
+  /* 1 ms PWM period : (12 words x 4 + 2 transfers x 8) cycles at 16 MHz = 4 us of DMA activity per period */
+  LPBAM_REPLAY_DefaultModel(&model);
+  model.RequestPeriodUs[LPDMA1_REQUEST_LPTIM1_UE] = 1000.0;
+  LPBAM_REPLAY_Estimate(&results[1], &model, &est);
+  CHECK(Near(est.ActiveUs, 4.0) && Near(est.WaitUs, 1000.0) && Near(est.Stop2Us, 1000.0),
+        "estimate %.3f / %.3f / %.3f us", est.ActiveUs, est.WaitUs, est.Stop2Us);
+  CHECK(Near(est.AverageuA, ((1000.0 * 4.0) + (4.0 * 154.0)) / 1004.0), "average current %.6f uA", est.AverageuA);
+  Report("pwm_circular", iterations, &model);
+}
+
+/* Linear GPIO sequence paced by the LPTIM1 channel 1 trigger, the transfer complete wakes up the CPU */
+static void ScenarioGpioTriggered(void)
+{
+  const LPBAM_COMMON_TrigAdvConf_t trigger =
+  {
+    {LPBAM_DMA_TRIGM_SINGLE_BURST_TRANSFER, LPBAM_DMA_TRIG_POLARITY_RISING, LPBAM_LPDMA1_TRIGGER_LPTIM1_CH1}
+  };
+  LPBAM_GPIO_PinSeqFullAdvConf_t seq;
+  LPBAM_REPLAY_Write_t expected[4];
+  LPBAM_REPLAY_Model_t model;
+  LPBAM_REPLAY_Estimate_t est;
+  uint32_t iterations;
+  uint32_t circular;
+  uint32_t idx;
+
+  (void)printf("gpio_triggered\n");
+  ResetQueue();
+
+  for (idx = 0U; idx < 4U; idx++)
+  {
+    lpbam_section.PinStates[idx] = ((idx % 2U) == 0U) ? LPBAM_GPIO_PIN_0 : ((uint32_t)LPBAM_GPIO_PIN_0 << 16U);
+    expected[idx].Address        = (uint32_t)(uintptr_t)&LPGPIO1->BSRR;
+    expected[idx].Value          = lpbam_section.PinStates[idx];
+  }
+  seq.Pin   = LPBAM_GPIO_PIN_0;
+  seq.pData = lpbam_section.PinStates;
+  seq.Size  = 4U;
+
+  CHECK(ADV_LPBAM_GPIO_WritePinSequence_SetFullQ(LPGPIO1, &dma_list_info, &seq, &lpbam_section.PinSeq, &queue) ==
+        LPBAM_OK, "GPIO sequence queue build");
+  CHECK(ADV_LPBAM_Q_SetTriggerConfig(&trigger, LPBAM_GPIO_WRITEPINSEQ_FULLQ_DATA_NODE, &lpbam_section.PinSeq) ==
+        LPBAM_OK, "trigger configuration");
+  CHECK(LPBAM_REPLAY_Run(&queue, &memory, ITERATIONS, results, &iterations, &circular) == 0, "replay");
+  CHECK((iterations == 1U) && (circular == 0U), "%u iterations, circular %u", (unsigned int)iterations,
+        (unsigned int)circular);
+  CHECK((results[0].Nodes == 1U) && (results[0].Words == 6U) && (results[0].Transfers == 4U),
+        "%u items, %u words, %u transfers", (unsigned int)results[0].Nodes, (unsigned int)results[0].Words,
+        (unsigned int)results[0].Transfers);
+  CHECK(CheckWrites(&results[0], expected, 4U) != 0U, "LPGPIO1 BSRR writes");
+  CHECK(results[0].TriggerWaits[LPBAM_LPDMA1_TRIGGER_LPTIM1_CH1] == 4U, "%u LPTIM1 CH1 trigger waits",
+        (unsigned int)results[0].TriggerWaits[LPBAM_LPDMA1_TRIGGER_LPTIM1_CH1]);
+  CHECK(results[0].TcEvents == 1U, "%u TC events", (unsigned int)results[0].TcEvents);
+
+  /* 500 us trigger period, one CPU wakeup at the end of the sequence */
+  LPBAM_REPLAY_DefaultModel(&model);
+  model.TriggerPeriodUs[LPBAM_LPDMA1_TRIGGER_LPTIM1_CH1] = 500.0;
+  model.TcWakeup = 1U;
+  LPBAM_REPLAY_Estimate(&results[0], &model, &est);
+  CHECK(Near(est.ActiveUs, 3.5) && Near(est.WaitUs, 2000.0) && (est.CpuWakeups == 1U) && Near(est.CpuRunUs, 50.0),
+        "estimate %.3f / %.3f us, %u wakeups", est.ActiveUs, est.WaitUs, (unsigned int)est.CpuWakeups);
+  CHECK(Near(est.Stop2Ratio, 2000.0 / 2053.5), "Stop 2 ratio %.6f", est.Stop2Ratio);
+  Report("gpio_triggered", iterations, &model);
+}
+
+/* A dynamic queue replays the same register writes with fewer loaded words */
+static void ScenarioDynamicQueue(void)
+{
+  const LPBAM_LPTIM_PWMFullAdvConf_t pwm = {200U, ENABLE, 20U, ENABLE, 0U, DISABLE};
+  const LPBAM_GPIO_WritePinFullAdvConf_t pin_set   = {LPBAM_GPIO_PIN_0, LPBAM_GPIO_PIN_SET};
+  const LPBAM_GPIO_WritePinFullAdvConf_t pin_reset = {LPBAM_GPIO_PIN_0, LPBAM_GPIO_PIN_RESET};
+  static LPBAM_REPLAY_Iteration_t static_results[ITERATIONS];
+  static uint8_t static_section[sizeof(lpbam_section)];
+  uint32_t iterations;
+  uint32_t circular;
+  uint32_t idx;
+
+  (void)printf("dynamic_queue\n");
+  ResetQueue();
+
+  CHECK(ADV_LPBAM_GPIO_WritePin_SetFullQ(LPGPIO1, &dma_list_info, &pin_set, &lpbam_section.Pin[0], &queue) ==
+        LPBAM_OK, "pin set queue build");
+  CHECK(ADV_LPBAM_LPTIM_PWM_SetFullQ(LPTIM1, LPBAM_LPTIM_CHANNEL_1, &dma_list_info, &pwm, &lpbam_section.Pwm[0],
+                                     &queue) == LPBAM_OK, "PWM queue build");
+  CHECK(ADV_LPBAM_GPIO_WritePin_SetFullQ(LPGPIO1, &dma_list_info, &pin_reset, &lpbam_section.Pin[1], &queue) ==
+        LPBAM_OK, "pin reset queue build");
+  CHECK(ADV_LPBAM_Q_SetCircularMode(&lpbam_section.Pin[0], LPBAM_GPIO_WRITEPIN_FULLQ_DATA_NODE, &queue) == LPBAM_OK,
+        "circular mode");
+
+  CHECK(LPBAM_REPLAY_Run(&queue, &memory, ITERATIONS, static_results, &iterations, &circular) == 0, "static replay");
+  (void)memcpy(static_section, &lpbam_section, sizeof(lpbam_section));
+
+  CHECK(ADV_LPBAM_Q_ConvertQ(LPBAM_DMA_DYNAMIC_Q, &queue) == LPBAM_OK, "dynamic conversion");
+  CHECK(LPBAM_REPLAY_Run(&queue, &memory, ITERATIONS, results, &iterations, &circular) == 0, "dynamic replay");
+  Report("dynamic_queue", iterations, NULL);
+
+  for (idx = 0U; idx < ITERATIONS; idx++)
+  {
+    CHECK((results[idx].Nodes == 4U) && (static_results[idx].Nodes == 4U), "iteration %u : %u items",
+          (unsigned int)idx, (unsigned int)results[idx].Nodes);
+    CHECK(results[idx].Transfers == static_results[idx].Transfers, "iteration %u : transfers", (unsigned int)idx);
+    CHECK(CheckWrites(&results[idx], static_results[idx].Writes, static_results[idx].WriteNumber) != 0U,
+          "iteration %u : register writes differ from the static queue", (unsigned int)idx);
+    CHECK(memcmp(results[idx].RequestWaits, static_results[idx].RequestWaits, sizeof(results[idx].RequestWaits)) == 0,
+          "iteration %u : request waits", (unsigned int)idx);
+    CHECK(results[idx].Words < static_results[idx].Words, "iteration %u : %u words loaded, %u in the static queue",
+          (unsigned int)idx, (unsigned int)results[idx].Words, (unsigned int)static_results[idx].Words);
+  }
+
+  /* Back to static : the nodes are restored */
+  CHECK(ADV_LPBAM_Q_ConvertQ(LPBAM_DMA_STATIC_Q, &queue) == LPBAM_OK, "static conversion");
+  CHECK(memcmp(static_section, &lpbam_section, sizeof(lpbam_section)) == 0, "static nodes restored");
+}
+
+/* Steps of a scenario on one LPTIM instance, from the second step on with MergeConfig enabled */
+static void BuildPwmScenario(PwmStep_t const *pSteps, uint32_t StepNumber, LPBAM_SCENARIO_Step_t *pScenarioSteps,
+                             LPBAM_SCENARIO_Desc_t *pScenario)
+{
+  uint32_t idx;
+
+  (void)memset(pScenarioSteps, 0, StepNumber * sizeof(LPBAM_SCENARIO_Step_t));
+  for (idx = 0U; idx < StepNumber; idx++)
+  {
+    pScenarioSteps[idx].StepType       = LPBAM_SCENARIO_STEP_QUEUE;
+    pScenarioSteps[idx].pBuildFunc     = BuildPwmStep;
+    pScenarioSteps[idx].pContext       = &pSteps[idx];
+    pScenarioSteps[idx].pDescriptor    = &lpbam_section.Pwm[idx];
+    pScenarioSteps[idx].DescriptorSize = sizeof(lpbam_section.Pwm[idx]);
+    pScenarioSteps[idx].MergeConfig    = (idx != 0U) ? ENABLE : DISABLE;
+  }
+  (void)memset(pScenario, 0, sizeof(*pScenario));
+  pScenario->pSteps     = pScenarioSteps;
+  pScenario->StepNumber = StepNumber;
+}
+
+/* Two PWM steps on the same instance : the second pulse node writes again the same value and is merged */
+static void ScenarioMerge(void)
+{
+  static const PwmStep_t steps_ctx[2] =
+  {
+    {LPTIM1, {100U, ENABLE, 50U, ENABLE, 0U, DISABLE}},
+    {LPTIM1, {200U, ENABLE, 50U, ENABLE, 0U, DISABLE}},
+  };
+  LPBAM_SCENARIO_Step_t steps[2];
+  LPBAM_SCENARIO_Desc_t scenario;
+  LPBAM_SCENARIO_Report_t report;
+  const LPBAM_REPLAY_Write_t expected[] =
+  {
+    {(uint32_t)(uintptr_t)&LPTIM1->ARR, 100U}, {(uint32_t)(uintptr_t)&LPTIM1->CCR1, 50U},
+    {(uint32_t)(uintptr_t)&LPTIM1->ARR, 200U}
+  };
+  uint32_t iterations;
+  uint32_t circular;
+
+  (void)printf("scenario_merge\n");
+  ResetQueue();
+
+  BuildPwmScenario(steps_ctx, 2U, steps, &scenario);
+
+  CHECK(ADV_LPBAM_SCENARIO_SetQ(&scenario, &queue, &report) == LPBAM_OK, "scenario build");
+  CHECK((report.MergedNodeNumber == 1U) && (report.NodeNumber == 3U), "%u merged nodes, %u nodes",
+        (unsigned int)report.MergedNodeNumber, (unsigned int)report.NodeNumber);
+  CHECK(LPBAM_REPLAY_Run(&queue, &memory, ITERATIONS, results, &iterations, &circular) == 0, "replay");
+  Report("scenario_merge", iterations, NULL);
+  CHECK((iterations == 1U) && (CheckWrites(&results[0], expected, 3U) != 0U), "ARR / CCR1 writes");
+  CHECK(results[0].RequestWaits[LPDMA1_REQUEST_LPTIM1_UE] == 2U, "%u LPTIM1 UE request waits",
+        (unsigned int)results[0].RequestWaits[LPDMA1_REQUEST_LPTIM1_UE]);
+}
+
+/* A pre-loop step writes CCR1 = 50, the loop writes CCR1 = 50 then CCR1 = LastPulse : the loop CCR1 = 50 node is
+   reached again after the CCR1 = LastPulse node and is only merged when both values are equal */
+static void ScenarioMergeWrap(uint32_t LastPulse)
+{
+  const PwmStep_t steps_ctx[3] =
+  {
+    {LPTIM1, {100U, ENABLE, 50U, ENABLE, 0U, DISABLE}},
+    {LPTIM1, {100U, ENABLE, 50U, ENABLE, 0U, DISABLE}},
+    {LPTIM1, {100U, ENABLE, LastPulse, ENABLE, 0U, DISABLE}},
+  };
+  const LPBAM_REPLAY_Write_t expected_kept[] =
+  {
+    {(uint32_t)(uintptr_t)&LPTIM1->ARR, 100U}, {(uint32_t)(uintptr_t)&LPTIM1->CCR1, 50U},
+    {(uint32_t)(uintptr_t)&LPTIM1->ARR, 100U}, {(uint32_t)(uintptr_t)&LPTIM1->CCR1, LastPulse}
+  };
+  const LPBAM_REPLAY_Write_t expected_merged[] =
+  {
+    {(uint32_t)(uintptr_t)&LPTIM1->ARR, 100U}, {(uint32_t)(uintptr_t)&LPTIM1->ARR, 100U}
+  };
+  uint32_t merged = (LastPulse == 50U) ? 2U : 0U;
+  LPBAM_SCENARIO_Step_t steps[3];
+  LPBAM_SCENARIO_Desc_t scenario;
+  LPBAM_SCENARIO_Report_t report;
+  uint32_t iterations;
+  uint32_t circular;
+  uint32_t idx;
+
+  (void)printf("scenario_merge_wrap (last pulse %u)\n", (unsigned int)LastPulse);
+  ResetQueue();
+
+  BuildPwmScenario(steps_ctx, 3U, steps, &scenario);
+  scenario.CircularMode = ENABLE;
+  scenario.CircularStep = 1U;
+  scenario.CircularNode = LPBAM_LPTIM_PWM_FULLQ_CONFIG_NODE;
+
+  CHECK(ADV_LPBAM_SCENARIO_SetQ(&scenario, &queue, &report) == LPBAM_OK, "scenario build");
+  CHECK((report.MergedNodeNumber == merged) && (report.NodeNumber == (6U - merged)), "%u merged nodes, %u nodes",
+        (unsigned int)report.MergedNodeNumber, (unsigned int)report.NodeNumber);
+  CHECK(LPBAM_REPLAY_Run(&queue, &memory, ITERATIONS, results, &iterations, &circular) == 0, "replay");
+  CHECK((iterations == ITERATIONS) && (circular == 1U), "%u iterations, circular %u", (unsigned int)iterations,
+        (unsigned int)circular);
+  Report("scenario_merge_wrap", iterations, NULL);
+
+  /* Each loop applies the same CCR1 sequence as the first one */
+  for (idx = 1U; idx < iterations; idx++)
+  {
+    if (merged == 0U)
+    {
+      CHECK(CheckWrites(&results[idx], expected_kept, 4U) != 0U, "loop %u : ARR / CCR1 writes", (unsigned int)idx);
+    }
+    else
+    {
+      CHECK(CheckWrites(&results[idx], expected_merged, 2U) != 0U, "loop %u : ARR writes", (unsigned int)idx);
+    }
+    CHECK(results[idx].RequestWaits[LPDMA1_REQUEST_LPTIM1_UE] == 2U, "loop %u : %u LPTIM1 UE request waits",
+          (unsigned int)idx, (unsigned int)results[idx].RequestWaits[LPDMA1_REQUEST_LPTIM1_UE]);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  if ((argc > 1) && (strcmp(argv[1], "-v") == 0))
+  {
+    verbose = 1U;
+  }
+
+  ScenarioPwmCircular();
+  ScenarioGpioTriggered();
+  ScenarioDynamicQueue();
+  ScenarioMerge();
+  ScenarioMergeWrap(80U);
+  ScenarioMergeWrap(50U);
+
+  if (failures != 0U)
+  {
+    (void)printf("%u check(s) failed\n", (unsigned int)failures);
+    return 1;
+  }
+
+  (void)printf("all scenarios passed\n");
+  return 0;
+}
@@ -0,0 +1,401 @@
+/**
+  ******************************************************************************
+  * @file    lpbam_replay.c
+  * @author  MCD Application Team
+  * @brief   In-process replay of a DMA linked-list queue built by the LPBAM
+  *          utility. The channel is modelled as in lpbam_queue_sim.py :
+  *          - the head item is loaded with all its registers, each next item
+  *            with the registers selected by the update bits of the CLLR,
+  *          - BNDT bytes are transferred from CSAR to CDAR by single
+  *            transfers of the source data width,
+  *          - an item with LA = 0 ends the queue, an item linking to an
+  *            already executed item starts a new iteration.
+  *          The transfers access the host memory directly : the accessed
+  *          addresses must be in the peripheral register map or in the
+  *          memory regions given by the caller.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "lpbam_replay.h"
+
+/* Channel registers, in the order the channel loads them */
+enum
+{
+  REG_CTR1, REG_CTR2, REG_CBR1, REG_CSAR, REG_CDAR, REG_CTR3, REG_CBR2, REG_CLLR, REG_NUMBER
+};
+
+static const uint32_t cllr_update[REG_NUMBER] =
+{
+  DMA_CLLR_UT1, DMA_CLLR_UT2, DMA_CLLR_UB1, DMA_CLLR_USA, DMA_CLLR_UDA, DMA_CLLR_UT3, DMA_CLLR_UB2, DMA_CLLR_ULL
+};
+
+static LPBAM_REPLAY_Memory_t const *replay_memory;
+
+static uint32_t InRegion(uint32_t Address, uint32_t Size, void const *pBase, uint32_t RegionSize)
+{
+  uint32_t base = (uint32_t)(uintptr_t)pBase;
+
+  return ((Address >= base) && ((Address + Size) <= (base + RegionSize))) ? 1U : 0U;
+}
+
+static uint32_t IsRegister(uint32_t Address, uint32_t Size)
+{
+  return InRegion(Address, Size, &host_periph, sizeof(host_periph));
+}
+
+static uint32_t IsAccessible(uint32_t Address, uint32_t Size)
+{
+  uint32_t idx;
+
+  if (IsRegister(Address, Size) != 0U)
+  {
+    return 1U;
+  }
+
+  for (idx = 0U; idx < replay_memory->RegionNumber; idx++)
+  {
+    if (InRegion(Address, Size, replay_memory->Regions[idx].pBase, replay_memory->Regions[idx].Size) != 0U)
+    {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
+
+static uint32_t ReadMemory(uint32_t Address, uint32_t Size)
+{
+  uint32_t value = 0U;
+
+  (void)memcpy(&value, (void const *)(uintptr_t)Address, Size);
+
+  return value;
+}
+
+static void WriteMemory(uint32_t Address, uint32_t Size, uint32_t Value)
+{
+  (void)memcpy((void *)(uintptr_t)Address, &Value, Size);
+}
+
+void LPBAM_REPLAY_DefaultModel(LPBAM_REPLAY_Model_t *pModel)
+{
+  (void)memset(pModel, 0, sizeof(*pModel));
+  pModel->ClockMHz       = 16.0;
+  pModel->LoadCycles     = 4.0;
+  pModel->TransferCycles = 8.0;
+  pModel->WakeupUs       = 50.0;
+  pModel->Stop2uA        = 4.0;
+  pModel->DmauA          = 150.0;
+  pModel->RunuA          = 3000.0;
+}
+
+char const *LPBAM_REPLAY_RegisterName(uint32_t Address)
+{
+  static const struct
+  {
+    void const *pBase;
+    uint32_t   Size;
+    char const *pName;
+  } periph[] =
+  {
+    {&host_periph.Gpdma1Channel[0], sizeof(host_periph.Gpdma1Channel), "GPDMA1"},
+    {&host_periph.Lpdma1Channel[0], sizeof(host_periph.Lpdma1Channel), "LPDMA1"},
+    {&host_periph.GpioA,             sizeof(host_periph.GpioA),          "GPIOA"},
+    {&host_periph.Lpgpio1,           sizeof(host_periph.Lpgpio1),        "LPGPIO1"},
+    {&host_periph.Lptim1,            sizeof(host_periph.Lptim1),         "LPTIM1"},
+    {&host_periph.Lptim3,            sizeof(host_periph.Lptim3),         "LPTIM3"},
+  };
+  static char name[32];
+  uint32_t offset;
+  uint32_t idx;
+
+  for (idx = 0U; idx < (sizeof(periph) / sizeof(periph[0])); idx++)
+  {
+    if (InRegion(Address, 1U, periph[idx].pBase, periph[idx].Size) != 0U)
+    {
+      offset = Address - (uint32_t)(uintptr_t)periph[idx].pBase;
+      if (idx < 2U)
+      {
+        (void)snprintf(name, sizeof(name), "%s_CH%u+0x%02X", periph[idx].pName,
+                       (unsigned int)(offset / sizeof(DMA_Channel_TypeDef)),
+                       (unsigned int)(offset % sizeof(DMA_Channel_TypeDef)));
+      }
+      else
+      {
+        (void)snprintf(name, sizeof(name), "%s+0x%02X", periph[idx].pName, (unsigned int)offset);
+      }
+      return name;
+    }
+  }
+
+  (void)snprintf(name, sizeof(name), "0x%08X", (unsigned int)Address);
+
+  return name;
+}
+
+static uint32_t LoadItem(uint32_t Address, uint32_t Updates, uint32_t *pRegs)
+{
+  uint32_t loaded = 0U;
+  uint32_t reg;
+
+  for (reg = 0U; reg < REG_NUMBER; reg++)
+  {
+    if ((Updates & cllr_update[reg]) != 0U)
+    {
+      pRegs[reg] = ReadMemory(Address + (loaded * 4U), 4U);
+      loaded++;
+    }
+  }
+
+  return loaded;
+}
+
+static int TransferItem(uint32_t *pRegs, LPBAM_REPLAY_Iteration_t *pIt)
+{
+  uint32_t ctr1      = pRegs[REG_CTR1];
+  uint32_t ctr2      = pRegs[REG_CTR2];
+  uint32_t bndt      = pRegs[REG_CBR1] & DMA_CBR1_BNDT;
+  uint32_t repeat    = ((pRegs[REG_CBR1] & DMA_CBR1_BRC) >> DMA_CBR1_BRC_Pos) + 1U;
+  uint32_t src_width = 1UL << (ctr1 & DMA_CTR1_SDW_LOG2);
+  uint32_t dst_width = 1UL << ((ctr1 & DMA_CTR1_DDW_LOG2) >> DMA_CTR1_DDW_LOG2_Pos);
+  uint32_t trigpol   = ctr2 & DMA_CTR2_TRIGPOL;
+  uint32_t trigm     = ctr2 & DMA_CTR2_TRIGM;
+  uint32_t trigsel   = (ctr2 & DMA_CTR2_TRIGSEL) >> DMA_CTR2_TRIGSEL_Pos;
+  uint32_t reqsel    = ctr2 & DMA_CTR2_REQSEL;
+  uint32_t tcem      = ctr2 & DMA_CTR2_TCEM;
+  uint32_t value;
+  uint32_t block;
+  uint32_t single;
+
+  /* Block and repeated block triggers are awaited before the item transfers */
+  if ((trigpol != DMA_TRIG_POLARITY_MASKED) &&
+      ((trigm == DMA_TRIGM_BLOCK_TRANSFER) || (trigm == DMA_TRIGM_REPEATED_BLOCK_TRANSFER)))
+  {
+    pIt->TriggerWaits[trigsel]++;
+  }
+
+  if (bndt == 0U)
+  {
+    return 0;
+  }
+
+  for (block = 0U; block < repeat; block++)
+  {
+    for (single = 0U; single < (bndt / src_width); single++)
+    {
+      if ((trigpol != DMA_TRIG_POLARITY_MASKED) && (trigm == DMA_TRIGM_SINGLE_BURST_TRANSFER))
+      {
+        pIt->TriggerWaits[trigsel]++;
+      }
+      if ((ctr2 & DMA_CTR2_SWREQ) == 0U)
+      {
+        pIt->RequestWaits[reqsel]++;
+      }
+
+      if ((IsAccessible(pRegs[REG_CSAR], src_width) == 0U) || (IsAccessible(pRegs[REG_CDAR], dst_width) == 0U))
+      {
+        (void)fprintf(stderr, "replay: transfer 0x%08X -> 0x%08X outside of the given memory\n",
+                      (unsigned int)pRegs[REG_CSAR], (unsigned int)pRegs[REG_CDAR]);
+        return -1;
+      }
+
+      /* Right aligned, left truncated or zero padded */
+      value = ReadMemory(pRegs[REG_CSAR], src_width);
+      if (dst_width < 4U)
+      {
+        value &= (1UL << (dst_width * 8U)) - 1U;
+      }
+      WriteMemory(pRegs[REG_CDAR], dst_width, value);
+
+      if (IsRegister(pRegs[REG_CDAR], dst_width) != 0U)
+      {
+        if (pIt->WriteNumber < LPBAM_REPLAY_MAX_WRITES)
+        {
+          pIt->Writes[pIt->WriteNumber].Address = pRegs[REG_CDAR] & ~3U;
+          pIt->Writes[pIt->WriteNumber].Value   = ReadMemory(pRegs[REG_CDAR] & ~3U, 4U);
+        }
+        pIt->WriteNumber++;
+      }
+
+      pIt->Transfers++;
+      pIt->Bytes += src_width;
+      if ((ctr1 & DMA_CTR1_SINC) != 0U)
+      {
+        pRegs[REG_CSAR] += src_width;
+      }
+      if ((ctr1 & DMA_CTR1_DINC) != 0U)
+      {
+        pRegs[REG_CDAR] += dst_width;
+      }
+    }
+  }
+
+  pRegs[REG_CBR1] &= ~DMA_CBR1_BNDT;
+  if (tcem == DMA_TCEM_BLOCK_TRANSFER)
+  {
+    pIt->TcEvents += repeat;
+  }
+  else if (tcem != DMA_TCEM_LAST_LL_ITEM_TRANSFER)
+  {
+    pIt->TcEvents++;
+  }
+  else
+  {
+    /* Counted at the end of the queue */
+  }
+
+  return 0;
+}
+
+int LPBAM_REPLAY_Run(DMA_QListTypeDef const *pQueue, LPBAM_REPLAY_Memory_t const *pMemory, uint32_t Iterations,
+                     LPBAM_REPLAY_Iteration_t *pResults, uint32_t *pIterationNumber, uint32_t *pCircular)
+{
+  static uint32_t visited[LPBAM_REPLAY_MAX_NODES];
+  uint32_t regs[REG_NUMBER] = {0};
+  LPBAM_REPLAY_Iteration_t *p_it = pResults;
+  uint32_t visited_number = 0U;
+  uint32_t iteration = 0U;
+  uint32_t address;
+  uint32_t updates;
+  uint32_t base;
+  uint32_t ctr2;
+  uint32_t idx;
+
+  *pIterationNumber = 0U;
+  *pCircular        = 0U;
+  if ((pQueue->Head == NULL) || (Iterations == 0U))
+  {
+    return -1;
+  }
+
+  replay_memory = pMemory;
+  (void)memset(pResults, 0, Iterations * sizeof(*pResults));
+
+  /* The channel starts by loading the head item with all its registers */
+  address = (uint32_t)(uintptr_t)pQueue->Head;
+  base    = address & DMA_CLBAR_LBA;
+  updates = DMA_CLLR_UT1 | DMA_CLLR_UT2 | DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_UDA | DMA_CLLR_ULL;
+  if ((pQueue->Head->NodeInfo & DMA_CHANNEL_TYPE_2D_ADDR) != 0U)
+  {
+    updates |= DMA_CLLR_UT3 | DMA_CLLR_UB2;
+  }
+
+  for (;;)
+  {
+    /* Linking back to an executed item : the queue is circular, start a new iteration */
+    for (idx = 0U; idx < visited_number; idx++)
+    {
+      if (visited[idx] == address)
+      {
+        break;
+      }
+    }
+    if (idx < visited_number)
+    {
+      *pCircular = 1U;
+      iteration++;
+      if (iteration == Iterations)
+      {
+        break;
+      }
+      p_it++;
+      visited_number = 0U;
+    }
+
+    if (visited_number == LPBAM_REPLAY_MAX_NODES)
+    {
+      (void)fprintf(stderr, "replay: more than %u items executed without iteration end\n",
+                    (unsigned int)LPBAM_REPLAY_MAX_NODES);
+      return -1;
+    }
+    if (IsAccessible(address, 4U * REG_NUMBER) == 0U)
+    {
+      (void)fprintf(stderr, "replay: item 0x%08X outside of the given memory\n", (unsigned int)address);
+      return -1;
+    }
+    visited[visited_number] = address;
+    visited_number++;
+
+    p_it->Nodes++;
+    p_it->Words += LoadItem(address, updates, regs);
+    if (TransferItem(regs, p_it) != 0)
+    {
+      return -1;
+    }
+
+    /* Link transfer triggers are awaited before loading the next item */
+    ctr2 = regs[REG_CTR2];
+    if (((ctr2 & DMA_CTR2_TRIGPOL) != DMA_TRIG_POLARITY_MASKED) &&
+        ((ctr2 & DMA_CTR2_TRIGM) == DMA_TRIGM_LLI_LINK_TRANSFER))
+    {
+      p_it->TriggerWaits[(ctr2 & DMA_CTR2_TRIGSEL) >> DMA_CTR2_TRIGSEL_Pos]++;
+    }
+
+    if ((regs[REG_CLLR] & DMA_CLLR_LA) == 0U)
+    {
+      if ((ctr2 & DMA_CTR2_TCEM) == DMA_TCEM_LAST_LL_ITEM_TRANSFER)
+      {
+        p_it->TcEvents++;
+      }
+      iteration++;
+      break;
+    }
+
+    address = base | (regs[REG_CLLR] & DMA_CLLR_LA);
+    updates = regs[REG_CLLR] & ~DMA_CLLR_LA;
+  }
+
+  *pIterationNumber = iteration;
+
+  return 0;
+}
+
+void LPBAM_REPLAY_Estimate(LPBAM_REPLAY_Iteration_t const *pIteration, LPBAM_REPLAY_Model_t const *pModel,
+                           LPBAM_REPLAY_Estimate_t *pEstimate)
+{
+  double active_cycles = ((double)pIteration->Words * pModel->LoadCycles) +
+                         ((double)pIteration->Transfers * pModel->TransferCycles);
+  uint32_t sel;
+
+  pEstimate->ActiveUs = active_cycles / pModel->ClockMHz;
+  pEstimate->WaitUs   = 0.0;
+  for (sel = 0U; sel < LPBAM_REPLAY_TRIGGERS; sel++)
+  {
+    pEstimate->WaitUs += pModel->TriggerPeriodUs[sel] * (double)pIteration->TriggerWaits[sel];
+  }
+  for (sel = 0U; sel < LPBAM_REPLAY_REQUESTS; sel++)
+  {
+    pEstimate->WaitUs += pModel->RequestPeriodUs[sel] * (double)pIteration->RequestWaits[sel];
+  }
+
+  pEstimate->CpuWakeups  = (pModel->TcWakeup != 0U) ? pIteration->TcEvents : 0U;
+  pEstimate->CpuRunUs    = (double)pEstimate->CpuWakeups * pModel->WakeupUs;
+  pEstimate->IterationUs = pEstimate->ActiveUs + pEstimate->WaitUs + pEstimate->CpuRunUs;
+  pEstimate->Stop2Us     = pEstimate->IterationUs - pEstimate->ActiveUs - pEstimate->CpuRunUs;
+  if (pEstimate->Stop2Us < 0.0)
+  {
+    pEstimate->Stop2Us = 0.0;
+  }
+
+  pEstimate->Stop2Ratio = 0.0;
+  pEstimate->AverageuA  = 0.0;
+  if (pEstimate->IterationUs > 0.0)
+  {
+    pEstimate->Stop2Ratio = pEstimate->Stop2Us / pEstimate->IterationUs;
+    pEstimate->AverageuA  = ((pEstimate->Stop2Us * pModel->Stop2uA) +
+                             (pEstimate->ActiveUs * (pModel->Stop2uA + pModel->DmauA)) +
+                             (pEstimate->CpuRunUs * pModel->RunuA)) / pEstimate->IterationUs;
+  }
+}
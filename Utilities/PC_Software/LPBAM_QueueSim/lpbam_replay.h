@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file    lpbam_replay.h
+  * @author  MCD Application Team
+  * @brief   In-process replay of a DMA linked-list queue built by the LPBAM
+  *          utility, same model as lpbam_queue_sim.py
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef LPBAM_REPLAY_H
+#define LPBAM_REPLAY_H
+
+#include "stm32u5xx_hal.h"
+
+#define LPBAM_REPLAY_MAX_WRITES     64U     /* Peripheral register writes recorded per iteration */
+#define LPBAM_REPLAY_MAX_NODES      256U    /* Items executed per iteration                       */
+#define LPBAM_REPLAY_TRIGGERS       64U     /* CTR2 TRIGSEL values                                */
+#define LPBAM_REPLAY_REQUESTS       128U    /* CTR2 REQSEL values                                 */
+#define LPBAM_REPLAY_MAX_REGIONS    8U
+
+typedef struct
+{
+  uint32_t Address;
+  uint32_t Value;
+} LPBAM_REPLAY_Write_t;
+
+/* One pass of a linear queue, one loop of a circular queue */
+typedef struct
+{
+  uint32_t Nodes;                                  /* Executed items                          */
+  uint32_t Words;                                  /* Loaded item registers                   */
+  uint32_t Transfers;                              /* Single transfers                        */
+  uint32_t Bytes;
+  uint32_t TcEvents;                               /* Transfer complete events                */
+  uint32_t TriggerWaits[LPBAM_REPLAY_TRIGGERS];
+  uint32_t RequestWaits[LPBAM_REPLAY_REQUESTS];
+  uint32_t WriteNumber;                            /* Peripheral register writes, may exceed
+                                                      LPBAM_REPLAY_MAX_WRITES                 */
+  LPBAM_REPLAY_Write_t Writes[LPBAM_REPLAY_MAX_WRITES];
+} LPBAM_REPLAY_Iteration_t;
+
+/* Memory the queue may access besides the peripheral register map */
+typedef struct
+{
+  uint32_t RegionNumber;
+  struct
+  {
+    void const *pBase;
+    uint32_t   Size;
+  } Regions[LPBAM_REPLAY_MAX_REGIONS];
+} LPBAM_REPLAY_Memory_t;
+
+/* Timing and current model, the defaults are the ones of lpbam_queue_sim.py */
+typedef struct
+{
+  double   ClockMHz;                               /* DMA clock in Stop 2 (HSI16)             */
+  double   LoadCycles;                             /* Cycles per loaded item register         */
+  double   TransferCycles;                         /* Cycles per single transfer              */
+  double   WakeupUs;                               /* CPU run time per wakeup                 */
+  double   Stop2uA;
+  double   DmauA;                                  /* Additional current when the DMA runs    */
+  double   RunuA;
+  uint32_t TcWakeup;                               /* The TC interrupt wakes up the CPU       */
+  double   TriggerPeriodUs[LPBAM_REPLAY_TRIGGERS]; /* Time between two events, 0 if unknown   */
+  double   RequestPeriodUs[LPBAM_REPLAY_REQUESTS];
+} LPBAM_REPLAY_Model_t;
+
+typedef struct
+{
+  double   ActiveUs;
+  double   WaitUs;
+  uint32_t CpuWakeups;
+  double   CpuRunUs;
+  double   IterationUs;
+  double   Stop2Us;
+  double   Stop2Ratio;
+  double   AverageuA;
+} LPBAM_REPLAY_Estimate_t;
+
+void LPBAM_REPLAY_DefaultModel(LPBAM_REPLAY_Model_t *pModel);
+int  LPBAM_REPLAY_Run(DMA_QListTypeDef const *pQueue, LPBAM_REPLAY_Memory_t const *pMemory, uint32_t Iterations,
+                      LPBAM_REPLAY_Iteration_t *pResults, uint32_t *pIterationNumber, uint32_t *pCircular);
+void LPBAM_REPLAY_Estimate(LPBAM_REPLAY_Iteration_t const *pIteration, LPBAM_REPLAY_Model_t const *pModel,
+                           LPBAM_REPLAY_Estimate_t *pEstimate);
+char const *LPBAM_REPLAY_RegisterName(uint32_t Address);
+
+#endif /* LPBAM_REPLAY_H */
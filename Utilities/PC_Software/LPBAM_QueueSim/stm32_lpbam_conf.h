@@ -0,0 +1,41 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_lpbam_conf.h
+  * @author  MCD Application Team
+  * @brief   lpbam configuration file of the host build : the modules exercised by the reference scenarios.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_LPBAM_CONF_H
+#define STM32_LPBAM_CONF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes --------------------------------------------------------------------------------------------------------- */
+#include "stm32u5xx_hal.h"
+
+/* ############################################## Module Selection ################################################## */
+#define LPBAM_COMMON_MODULE_ENABLED
+#define LPBAM_DMA_MODULE_ENABLED
+#define LPBAM_GPIO_MODULE_ENABLED
+#define LPBAM_LPTIM_MODULE_ENABLED
+#define LPBAM_SCENARIO_MODULE_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_LPBAM_CONF_H */
@@ -0,0 +1,420 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the device and HAL definitions used by the LPBAM
+  *          utility : the GPDMA / LPDMA linked-list node format, the
+  *          HAL_DMAEx_List_* services (lpbam_hal_host.c) and a mocked
+  *          register map of the peripherals reachable by the LPBAM
+  *          sub-system (GPDMA1, LPDMA1, GPIOA, LPGPIO1, LPTIM1, LPTIM3)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_HAL_H
+#define STM32U5xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Status and common definitions ---------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  DISABLE = 0U,
+  ENABLE = !DISABLE
+} FunctionalState;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+#define __IO                        volatile
+#define SET_BIT(REG, BIT)           ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)         ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)          ((REG) & (BIT))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)  ((REG) = (((REG) & (~(CLEARMASK))) | (SETMASK)))
+
+/* Peripheral registers ------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t SECCFGR;
+  __IO uint32_t PRIVCFGR;
+  __IO uint32_t RCFGLOCKR;
+  __IO uint32_t MISR;
+  __IO uint32_t SMISR;
+} DMA_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CLBAR;          /* 0x00 */
+  uint32_t      RESERVED1[2];
+  __IO uint32_t CFCR;           /* 0x0C */
+  __IO uint32_t CSR;            /* 0x10 */
+  __IO uint32_t CCR;            /* 0x14 */
+  uint32_t      RESERVED2[10];
+  __IO uint32_t CTR1;           /* 0x40 */
+  __IO uint32_t CTR2;           /* 0x44 */
+  __IO uint32_t CBR1;           /* 0x48 */
+  __IO uint32_t CSAR;           /* 0x4C */
+  __IO uint32_t CDAR;           /* 0x50 */
+  __IO uint32_t CTR3;           /* 0x54 */
+  __IO uint32_t CBR2;           /* 0x58 */
+  uint32_t      RESERVED3[8];
+  __IO uint32_t CLLR;           /* 0x7C */
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t MODER;
+  __IO uint32_t OTYPER;
+  __IO uint32_t OSPEEDR;
+  __IO uint32_t PUPDR;
+  __IO uint32_t IDR;            /* 0x10 */
+  __IO uint32_t ODR;            /* 0x14 */
+  __IO uint32_t BSRR;           /* 0x18 */
+  __IO uint32_t LCKR;
+  __IO uint32_t AFR[2];
+  __IO uint32_t BRR;
+  __IO uint32_t HSLVR;
+  __IO uint32_t SECCFGR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t ISR;            /* 0x00 */
+  __IO uint32_t ICR;            /* 0x04 */
+  __IO uint32_t DIER;           /* 0x08 */
+  __IO uint32_t CFGR;           /* 0x0C */
+  __IO uint32_t CR;             /* 0x10 */
+  __IO uint32_t CCR1;           /* 0x14 */
+  __IO uint32_t ARR;            /* 0x18 */
+  __IO uint32_t CNT;            /* 0x1C */
+  uint32_t      RESERVED0;
+  __IO uint32_t CFGR2;          /* 0x24 */
+  __IO uint32_t RCR;            /* 0x28 */
+  __IO uint32_t CCMR1;          /* 0x2C */
+  uint32_t      RESERVED1;
+  __IO uint32_t CCR2;           /* 0x34 */
+} LPTIM_TypeDef;
+
+/* Mocked register map : the peripherals are host variables, the queue nodes reference their 32-bit addresses */
+#define HOST_DMA_CHANNELS           16U
+#define HOST_LPDMA_CHANNELS         4U
+
+typedef struct
+{
+  DMA_TypeDef         Gpdma1;
+  DMA_Channel_TypeDef Gpdma1Channel[HOST_DMA_CHANNELS];
+  DMA_TypeDef         Lpdma1;
+  DMA_Channel_TypeDef Lpdma1Channel[HOST_LPDMA_CHANNELS];
+  GPIO_TypeDef        GpioA;
+  GPIO_TypeDef        Lpgpio1;
+  LPTIM_TypeDef       Lptim1;
+  LPTIM_TypeDef       Lptim3;
+} Host_Periph_TypeDef;
+
+extern Host_Periph_TypeDef host_periph;
+
+#define GPDMA1                      (&host_periph.Gpdma1)
+#define GPDMA1_Channel0             (&host_periph.Gpdma1Channel[0])
+#define GPDMA1_Channel1             (&host_periph.Gpdma1Channel[1])
+#define LPDMA1                      (&host_periph.Lpdma1)
+#define LPDMA1_Channel0             (&host_periph.Lpdma1Channel[0])
+#define LPDMA1_Channel1             (&host_periph.Lpdma1Channel[1])
+#define LPDMA1_Channel2             (&host_periph.Lpdma1Channel[2])
+#define LPDMA1_Channel3             (&host_periph.Lpdma1Channel[3])
+#define GPIOA                       (&host_periph.GpioA)
+#define LPGPIO1                     (&host_periph.Lpgpio1)
+#define LPTIM1                      (&host_periph.Lptim1)
+#define LPTIM3                      (&host_periph.Lptim3)
+
+#define IS_DMA_ALL_INSTANCE(INSTANCE) \
+  ((((DMA_Channel_TypeDef *)(INSTANCE) >= &host_periph.Gpdma1Channel[0]) &&                       \
+    ((DMA_Channel_TypeDef *)(INSTANCE) < &host_periph.Gpdma1Channel[HOST_DMA_CHANNELS]) &&        \
+    ((((uintptr_t)(INSTANCE) - (uintptr_t)GPDMA1_Channel0) % sizeof(DMA_Channel_TypeDef)) == 0U)) || \
+   (((DMA_Channel_TypeDef *)(INSTANCE) >= &host_periph.Lpdma1Channel[0]) &&                       \
+    ((DMA_Channel_TypeDef *)(INSTANCE) < &host_periph.Lpdma1Channel[HOST_LPDMA_CHANNELS]) &&      \
+    ((((uintptr_t)(INSTANCE) - (uintptr_t)LPDMA1_Channel0) % sizeof(DMA_Channel_TypeDef)) == 0U)))
+#define IS_GPIO_ALL_INSTANCE(INSTANCE)  ((INSTANCE) == GPIOA)
+#define IS_LPTIM_INSTANCE(INSTANCE)     (((INSTANCE) == LPTIM1) || ((INSTANCE) == LPTIM3))
+
+/* GPDMA / LPDMA channel register bits ---------------------------------------*/
+#define DMA_CLBAR_LBA               0xFFFF0000U
+
+#define DMA_CFCR_TCF                (1UL << 8)
+#define DMA_CFCR_HTF                (1UL << 9)
+#define DMA_CFCR_DTEF               (1UL << 10)
+#define DMA_CFCR_ULEF               (1UL << 11)
+#define DMA_CFCR_USEF               (1UL << 12)
+#define DMA_CFCR_SUSPF              (1UL << 13)
+#define DMA_CFCR_TOF                (1UL << 14)
+
+#define DMA_CCR_EN                  (1UL << 0)
+#define DMA_CCR_RESET               (1UL << 1)
+#define DMA_CCR_SUSP                (1UL << 2)
+#define DMA_CCR_TCIE_Pos            8U
+#define DMA_CCR_TCIE                (1UL << 8)
+#define DMA_CCR_HTIE                (1UL << 9)
+#define DMA_CCR_DTEIE               (1UL << 10)
+#define DMA_CCR_ULEIE               (1UL << 11)
+#define DMA_CCR_USEIE               (1UL << 12)
+#define DMA_CCR_SUSPIE              (1UL << 13)
+#define DMA_CCR_TOIE                (1UL << 14)
+#define DMA_CCR_PRIO                (3UL << 22)
+
+#define DMA_CTR1_SDW_LOG2_Pos       0U
+#define DMA_CTR1_SDW_LOG2           (3UL << 0)
+#define DMA_CTR1_SDW_LOG2_0         (1UL << 0)
+#define DMA_CTR1_SDW_LOG2_1         (1UL << 1)
+#define DMA_CTR1_SINC               (1UL << 3)
+#define DMA_CTR1_SBL_1_Pos          4U
+#define DMA_CTR1_SBL_1              (0x3FUL << 4)
+#define DMA_CTR1_PAM                (3UL << 11)
+#define DMA_CTR1_SBX                (1UL << 13)
+#define DMA_CTR1_SAP                (1UL << 14)
+#define DMA_CTR1_SSEC               (1UL << 15)
+#define DMA_CTR1_DDW_LOG2_Pos       16U
+#define DMA_CTR1_DDW_LOG2           (3UL << 16)
+#define DMA_CTR1_DDW_LOG2_0         (1UL << 16)
+#define DMA_CTR1_DDW_LOG2_1         (1UL << 17)
+#define DMA_CTR1_DINC               (1UL << 19)
+#define DMA_CTR1_DBL_1_Pos          20U
+#define DMA_CTR1_DBL_1              (0x3FUL << 20)
+#define DMA_CTR1_DBX                (1UL << 26)
+#define DMA_CTR1_DHX                (1UL << 27)
+#define DMA_CTR1_DAP                (1UL << 30)
+#define DMA_CTR1_DSEC               (1UL << 31)
+
+#define DMA_CTR2_REQSEL             (0x7FUL << 0)
+#define DMA_CTR2_SWREQ              (1UL << 9)
+#define DMA_CTR2_DREQ               (1UL << 10)
+#define DMA_CTR2_BREQ               (1UL << 11)
+#define DMA_CTR2_TRIGM_Pos          14U
+#define DMA_CTR2_TRIGM              (3UL << 14)
+#define DMA_CTR2_TRIGM_0            (1UL << 14)
+#define DMA_CTR2_TRIGM_1            (1UL << 15)
+#define DMA_CTR2_TRIGSEL_Pos        16U
+#define DMA_CTR2_TRIGSEL            (0x3FUL << 16)
+#define DMA_CTR2_TRIGPOL            (3UL << 24)
+#define DMA_CTR2_TRIGPOL_0          (1UL << 24)
+#define DMA_CTR2_TRIGPOL_1          (1UL << 25)
+#define DMA_CTR2_TCEM               (3UL << 30)
+#define DMA_CTR2_TCEM_0             (1UL << 30)
+#define DMA_CTR2_TCEM_1             (1UL << 31)
+
+#define DMA_CBR1_BNDT               0x0000FFFFU
+#define DMA_CBR1_BRC_Pos            16U
+#define DMA_CBR1_BRC                (0x7FFUL << 16)
+
+#define DMA_CLLR_LA                 0x0000FFFCU
+#define DMA_CLLR_ULL                (1UL << 16)
+#define DMA_CLLR_UB2                (1UL << 25)
+#define DMA_CLLR_UT3                (1UL << 26)
+#define DMA_CLLR_UDA                (1UL << 27)
+#define DMA_CLLR_USA                (1UL << 28)
+#define DMA_CLLR_UB1                (1UL << 29)
+#define DMA_CLLR_UT2                (1UL << 30)
+#define DMA_CLLR_UT1                (1UL << 31)
+
+/* LPDMA1 requests used by the LPBAM utility */
+#define LPDMA1_REQUEST_SPI3_RX      0U
+#define LPDMA1_REQUEST_SPI3_TX      1U
+#define LPDMA1_REQUEST_LPUART1_RX   2U
+#define LPDMA1_REQUEST_LPUART1_TX   3U
+#define LPDMA1_REQUEST_I2C3_RX      4U
+#define LPDMA1_REQUEST_I2C3_TX      5U
+#define LPDMA1_REQUEST_I2C3_EVC     6U
+#define LPDMA1_REQUEST_ADC4         7U
+#define LPDMA1_REQUEST_DAC1_CH1     8U
+#define LPDMA1_REQUEST_DAC1_CH2     9U
+#define LPDMA1_REQUEST_LPTIM1_IC1   10U
+#define LPDMA1_REQUEST_LPTIM1_IC2   11U
+#define LPDMA1_REQUEST_LPTIM1_UE    12U
+#define LPDMA1_REQUEST_LPTIM3_IC1   13U
+#define LPDMA1_REQUEST_LPTIM3_IC2   14U
+#define LPDMA1_REQUEST_LPTIM3_UE    15U
+
+/* LPTIM register bits -------------------------------------------------------*/
+#define LPTIM_ISR_UE                (1UL << 7)
+#define LPTIM_DIER_UEIE             (1UL << 7)
+#define LPTIM_DIER_CC1DE            (1UL << 16)
+#define LPTIM_DIER_UEDE             (1UL << 23)
+#define LPTIM_DIER_CC2DE            (1UL << 25)
+#define LPTIM_CR_ENABLE             (1UL << 0)
+#define LPTIM_CR_SNGSTRT            (1UL << 1)
+#define LPTIM_CR_CNTSTRT            (1UL << 2)
+#define LPTIM_CCMR1_CC1E            (1UL << 1)
+#define LPTIM_CCMR1_CC2E            (1UL << 17)
+#define LPTIM_IT_CC1O               (1UL << 12)
+#define LPTIM_IT_CC2O               (1UL << 13)
+
+/* DMA HAL definitions -------------------------------------------------------*/
+#define DMA_CHANNEL_TYPE_LINEAR_ADDR    0x0001U
+#define DMA_CHANNEL_TYPE_2D_ADDR        0x0002U
+#define DMA_CHANNEL_TYPE_LPDMA          0x0010U
+#define DMA_CHANNEL_TYPE_GPDMA          0x0020U
+#define DMA_GPDMA_LINEAR_NODE           (DMA_CHANNEL_TYPE_GPDMA | DMA_CHANNEL_TYPE_LINEAR_ADDR)
+#define DMA_GPDMA_2D_NODE               (DMA_CHANNEL_TYPE_GPDMA | DMA_CHANNEL_TYPE_2D_ADDR)
+#define DMA_LPDMA_LINEAR_NODE           (DMA_CHANNEL_TYPE_LPDMA | DMA_CHANNEL_TYPE_LINEAR_ADDR)
+
+#define NODE_CLLR_IDX                   0x0700U
+#define NODE_CLLR_IDX_POS               8U
+#define NODE_CLLR_2D_DEFAULT_OFFSET     7U
+#define NODE_CLLR_LINEAR_DEFAULT_OFFSET 5U
+
+#define DMA_REQUEST_SW                  DMA_CTR2_SWREQ
+#define DMA_BREQ_SINGLE_BURST           0x00000000U
+#define DMA_PERIPH_TO_MEMORY            0x00000000U
+#define DMA_MEMORY_TO_PERIPH            DMA_CTR2_DREQ
+#define DMA_MEMORY_TO_MEMORY            DMA_CTR2_SWREQ
+#define DMA_SINC_FIXED                  0x00000000U
+#define DMA_SINC_INCREMENTED            DMA_CTR1_SINC
+#define DMA_DINC_FIXED                  0x00000000U
+#define DMA_DINC_INCREMENTED            DMA_CTR1_DINC
+#define DMA_SRC_DATAWIDTH_BYTE          0x00000000U
+#define DMA_SRC_DATAWIDTH_HALFWORD      DMA_CTR1_SDW_LOG2_0
+#define DMA_SRC_DATAWIDTH_WORD          DMA_CTR1_SDW_LOG2_1
+#define DMA_DEST_DATAWIDTH_BYTE         0x00000000U
+#define DMA_DEST_DATAWIDTH_HALFWORD     DMA_CTR1_DDW_LOG2_0
+#define DMA_DEST_DATAWIDTH_WORD         DMA_CTR1_DDW_LOG2_1
+#define DMA_HIGH_PRIORITY               DMA_CCR_PRIO
+#define DMA_NORMAL                      0x00000000U
+#define DMA_SRC_ALLOCATED_PORT0         0x00000000U
+#define DMA_DEST_ALLOCATED_PORT1        DMA_CTR1_DAP
+#define DMA_EXCHANGE_NONE               0x00000000U
+#define DMA_DATA_RIGHTALIGN_ZEROPADDED  0x00000000U
+#define DMA_TCEM_BLOCK_TRANSFER         0x00000000U
+#define DMA_TCEM_REPEATED_BLOCK_TRANSFER DMA_CTR2_TCEM_0
+#define DMA_TCEM_EACH_LL_ITEM_TRANSFER  DMA_CTR2_TCEM_1
+#define DMA_TCEM_LAST_LL_ITEM_TRANSFER  DMA_CTR2_TCEM
+#define DMA_TRIG_POLARITY_MASKED        0x00000000U
+#define DMA_TRIG_POLARITY_RISING        DMA_CTR2_TRIGPOL_0
+#define DMA_TRIG_POLARITY_FALLING       DMA_CTR2_TRIGPOL_1
+#define DMA_TRIGM_BLOCK_TRANSFER        0x00000000U
+#define DMA_TRIGM_REPEATED_BLOCK_TRANSFER DMA_CTR2_TRIGM_0
+#define DMA_TRIGM_LLI_LINK_TRANSFER     DMA_CTR2_TRIGM_1
+#define DMA_TRIGM_SINGLE_BURST_TRANSFER DMA_CTR2_TRIGM
+#define DMA_CHANNEL_SRC_SEC             DMA_CTR1_SSEC
+#define DMA_CHANNEL_DEST_SEC            DMA_CTR1_DSEC
+#define DMA_CHANNEL_ATTR_SEC_SRC_MASK   0x10U
+#define DMA_CHANNEL_ATTR_SEC_DEST_MASK  0x20U
+
+#define DMA_IT_TC                       DMA_CCR_TCIE
+#define DMA_IT_HT                       DMA_CCR_HTIE
+#define DMA_IT_DTE                      DMA_CCR_DTEIE
+#define DMA_IT_ULE                      DMA_CCR_ULEIE
+#define DMA_IT_USE                      DMA_CCR_USEIE
+
+typedef struct
+{
+  uint32_t Request;
+  uint32_t BlkHWRequest;
+  uint32_t Direction;
+  uint32_t SrcInc;
+  uint32_t DestInc;
+  uint32_t SrcDataWidth;
+  uint32_t DestDataWidth;
+  uint32_t Priority;
+  uint32_t SrcBurstLength;
+  uint32_t DestBurstLength;
+  uint32_t TransferAllocatedPort;
+  uint32_t TransferEventMode;
+  uint32_t Mode;
+} DMA_InitTypeDef;
+
+typedef struct
+{
+  uint32_t DataExchange;
+  uint32_t DataAlignment;
+} DMA_DataHandlingConfTypeDef;
+
+typedef struct
+{
+  uint32_t TriggerMode;
+  uint32_t TriggerPolarity;
+  uint32_t TriggerSelection;
+} DMA_TriggerConfTypeDef;
+
+typedef struct
+{
+  uint32_t RepeatCount;
+  int32_t  SrcAddrOffset;
+  int32_t  DestAddrOffset;
+  int32_t  BlkSrcAddrOffset;
+  int32_t  BlkDestAddrOffset;
+} DMA_RepeatBlockConfTypeDef;
+
+typedef struct
+{
+  uint32_t                    NodeType;
+  DMA_InitTypeDef             Init;
+  DMA_DataHandlingConfTypeDef DataHandlingConfig;
+  DMA_TriggerConfTypeDef      TriggerConfig;
+  DMA_RepeatBlockConfTypeDef  RepeatBlockConfig;
+  uint32_t                    SrcAddress;
+  uint32_t                    DstAddress;
+  uint32_t                    DataSize;
+} DMA_NodeConfTypeDef;
+
+/* Linked-list item as loaded by the channel : CTR1, CTR2, CBR1, CSAR, CDAR, (CTR3, CBR2,) CLLR */
+typedef struct
+{
+  uint32_t LinkRegisters[8U];
+  uint32_t NodeInfo;
+} DMA_NodeTypeDef;
+
+#define QUEUE_TYPE_STATIC               0U
+#define QUEUE_TYPE_DYNAMIC              1U
+
+typedef struct
+{
+  DMA_NodeTypeDef *Head;
+  DMA_NodeTypeDef *FirstCircularNode;
+  uint32_t        NodeNumber;
+  uint32_t        State;
+  uint32_t        ErrorCode;
+  uint32_t        Type;
+} DMA_QListTypeDef;
+
+typedef struct
+{
+  DMA_Channel_TypeDef *Instance;
+  DMA_QListTypeDef    *LinkedListQueue;
+} DMA_HandleTypeDef;
+
+#define __HAL_DMA_ENABLE_IT(__HANDLE__, __INTERRUPT__)  ((__HANDLE__)->Instance->CCR |= (__INTERRUPT__))
+
+HAL_StatusTypeDef HAL_DMAEx_List_BuildNode(DMA_NodeConfTypeDef const *const pNodeConfig,
+                                           DMA_NodeTypeDef *const pNode);
+HAL_StatusTypeDef HAL_DMAEx_List_GetNodeConfig(DMA_NodeConfTypeDef *const pNodeConfig,
+                                               DMA_NodeTypeDef const *const pNode);
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pPrevNode,
+                                            DMA_NodeTypeDef *const pNewNode);
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pNewNode);
+HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pNode);
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularModeConfig(DMA_QListTypeDef *const pQList,
+                                                       DMA_NodeTypeDef *const pFirstCircularNode);
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularMode(DMA_QListTypeDef *const pQList);
+HAL_StatusTypeDef HAL_DMAEx_List_ConvertQToDynamic(DMA_QListTypeDef *const pQList);
+HAL_StatusTypeDef HAL_DMAEx_List_ConvertQToStatic(DMA_QListTypeDef *const pQList);
+
+#endif /* STM32U5xx_HAL_H */
@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file    net_conf.h
+  * @author  MCD Application Team
+  * @brief   Network library configuration of the loopback benchmark (host build)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef NET_CONF_H
+#define NET_CONF_H
+
+/* Single-threaded host process on the loopback network interface. */
+#define NET_USE_POSIX_OS
+
+#define NET_PERF_SOCKET_STATS
+#define NET_USE_MEM_POOL
+#define NET_MAX_SOCKETS_NBR            8
+
+/* NET_MBEDTLS_HOST_SUPPORT is defined by the Makefile when MBEDTLS_DIR is given. */
+#define NET_MBEDTLS_DEBUG_LEVEL        0
+
+#include "net_conf_template.h"
+
+#endif /* NET_CONF_H */
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    openbl_dfu.py
+#  @author  MCD Application Team
+#  @brief   DfuSe download host and download throughput model for the OpenBootloader USB DFU interface
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2023 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+DfuSe host working like dfu-util, and model of the OpenBootloader DFU media (ux_device_dfu_media.c) to compare the
+download throughput of its two paths :
+ - legacy       : each block is programmed before dfuDNLOAD_IDLE, dfuDNBUSY is reported with a fixed bwPollTimeout
+                  (DFU_MEDIA_PROGRAM_TIME, 500 ms truncated to 8 bits : 244 ms),
+ - write-behind : DFU_MEDIA_WRITE_BEHIND = 1, blocks are programmed while the next ones are received,
+                  dfuDNBUSY only when the DFU_MEDIA_BUFFER_NUMBER buffers are used or while a special command waits
+                  for the pending blocks, bwPollTimeout computed from the pending FLASH operations.
+
+Two host behaviours are modelled :
+ - sequential : pages erased, address pointer set once, then consecutive block numbers (STM32CubeProgrammer),
+ - dfu-util   : for each block, erase of the pages it enters, set address pointer, then block number 2.
+
+Usage: python openbl_dfu.py download FILE [--address ADDRESS] [--per-block-address] [--leave]
+       python openbl_dfu.py bench [--size SIZE] [--buffers N] [--qw-us US] [--erase-ms MS]
+"""
+
+import argparse
+import sys
+import time
+
+DFU_DNLOAD = 1
+DFU_GETSTATUS = 3
+DFU_CLRSTATUS = 4
+DFU_ABORT = 6
+
+STATE_DNBUSY = 4
+STATE_ERROR = 10
+
+DFU_CMD_SETADDRESSPOINTER = 0x21
+DFU_CMD_ERASE = 0x41
+
+FLASH_START = 0x08000000
+PAGE_SIZE = 8192
+QUADWORD = 16
+
+# Firmware bwPollTimeout estimates (ux_device_dfu_media.c)
+LEGACY_POLL_MS = 500 & 0xFF
+EST_PAGE_ERASE_US = 3400
+EST_QUADWORD_US = 120
+
+# USB control transfer model : per request latency (ms) and data stage time (us per byte)
+USB_SPEEDS = {
+    "fs": (1.0, 1.25),
+    "hs": (0.25, 0.20),
+}
+
+
+class DfuError(Exception):
+    pass
+
+
+def poll_ms(time_us):
+    return min(max((time_us + 999) // 1000, 1), 0xFFFFFF)
+
+
+def program_us(length, quadword_us):
+    return (length + QUADWORD - 1) // QUADWORD * quadword_us
+
+
+class MediaModel:
+    """DFU media of the target : FIFO of blocks and commands processed by usbx_dfu_download_thread_entry."""
+
+    def __init__(self, write_behind, buffers, xfer_size, quadword_us, erase_us):
+        self.write_behind = write_behind
+        self.buffers = buffers
+        self.xfer_size = xfer_size
+        self.quadword_us = quadword_us
+        self.erase_us = erase_us
+        self.busy_until = 0.0
+        self.items = []                      # (end time in ms, is command, is erase)
+
+    def write(self, now, command, erase, length):
+        if erase:
+            duration = self.erase_us
+        elif command:
+            duration = 10.0
+        else:
+            duration = program_us(length, self.quadword_us)
+        self.busy_until = max(self.busy_until, now) + duration / 1000.0
+        self.items.append((self.busy_until, command, erase))
+
+    def status(self, now):
+        """(busy, bwPollTimeout in ms) answered to DFU_GETSTATUS at time now."""
+        self.items = [item for item in self.items if item[0] > now]
+        if not self.write_behind:
+            return (True, LEGACY_POLL_MS) if self.items else (False, 0)
+        commands = sum(1 for item in self.items if item[1])
+        if commands:
+            erases = sum(1 for item in self.items if item[2])
+            blocks = len(self.items) - commands
+            return True, poll_ms(erases * EST_PAGE_ERASE_US + blocks * program_us(self.xfer_size, EST_QUADWORD_US))
+        if len(self.items) >= self.buffers:
+            return True, poll_ms(program_us(self.xfer_size, EST_QUADWORD_US))
+        return False, 0
+
+
+class ModelHost:
+    """dfu-util like host talking to MediaModel, the time is simulated."""
+
+    def __init__(self, media, speed):
+        self.media = media
+        self.latency, self.byte_time = USB_SPEEDS[speed]
+        self.now = 0.0
+        self.polls = 0
+
+    def dnload(self, command, erase, data):
+        self.now += self.latency + len(data) * self.byte_time / 1000.0
+        self.media.write(self.now, command, erase, len(data))
+        while True:
+            self.now += self.latency
+            busy, timeout = self.media.status(self.now)
+            if not busy:
+                return
+            self.polls += 1
+            self.now += timeout
+
+
+def download_plan(size, xfer_size, address, per_block_address):
+    """DfuSe request sequence : ('erase' | 'address', address) and ('data', length)."""
+    plan = []
+    erased = set()
+    first_page = (address - FLASH_START) // PAGE_SIZE
+    last_page = (address + size - 1 - FLASH_START) // PAGE_SIZE
+    if not per_block_address:
+        plan += [("erase", FLASH_START + page * PAGE_SIZE) for page in range(first_page, last_page + 1)]
+        plan.append(("address", address))
+    for offset in range(0, size, xfer_size):
+        length = min(xfer_size, size - offset)
+        if per_block_address:
+            start = (address + offset - FLASH_START) // PAGE_SIZE
+            end = (address + offset + length - 1 - FLASH_START) // PAGE_SIZE
+            for page in range(start, end + 1):
+                if page not in erased:
+                    erased.add(page)
+                    plan.append(("erase", FLASH_START + page * PAGE_SIZE))
+            plan.append(("address", address + offset))
+        plan.append(("data", length))
+    return plan
+
+
+def bench(size, buffers, quadword_us, erase_us):
+    print("%u bytes image, %u write-behind buffers, FLASH %.0f us per quad-word, %.1f ms per page erase"
+          % (size, buffers, quadword_us, erase_us / 1000.0))
+    print("  %-4s %-11s %-6s %-13s %7s %9s %11s %7s" % ("usb", "host", "xfer", "path", "buffers", "time (s)",
+                                                         "bytes/s", "polls"))
+    for speed in ("fs", "hs"):
+        for per_block_address in (False, True):
+            for xfer_size in (1024, 2048, 4096):
+                plan = download_plan(size, xfer_size, FLASH_START + 0x20000, per_block_address)
+                for path, write_behind, number in (("legacy", False, 1), ("write-behind", True, 1),
+                                                   ("write-behind", True, buffers)):
+                    host = ModelHost(MediaModel(write_behind, number, xfer_size, quadword_us, erase_us), speed)
+                    for kind, value in plan:
+                        if kind == "data":
+                            host.dnload(False, False, bytes(value))
+                        else:
+                            host.dnload(True, kind == "erase", bytes(5))
+                    # The leave request waits for the pending blocks (DFU_Jump)
+                    elapsed = max(host.now, host.media.busy_until) / 1000.0
+                    print("  %-4s %-11s %-6u %-13s %7s %9.3f %11.0f %7u"
+                          % (speed, "dfu-util" if per_block_address else "sequential", xfer_size, path,
+                             number if write_behind else "-", elapsed, size / elapsed, host.polls))
+
+
+class UsbDfu:
+    """DfuSe requests on the DFU interface of the target, with pyusb."""
+
+    def __init__(self, vid, pid):
+        try:
+            import usb.core
+        except ImportError:
+            raise DfuError("pyusb is required by the download command")
+        self.device = usb.core.find(idVendor=vid, idProduct=pid)
+        if self.device is None:
+            raise DfuError("no DFU device %04x:%04x" % (vid, pid))
+        config = self.device.get_active_configuration()
+        self.interface = None
+        self.xfer_size = 1024
+        for interface in config:
+            if interface.bInterfaceClass == 0xFE and interface.bInterfaceSubClass == 0x01:
+                if self.interface is None:
+                    self.interface = interface.bInterfaceNumber
+                    self.device.set_interface_altsetting(interface=self.interface,
+                                                         alternate_setting=interface.bAlternateSetting)
+                extra = bytes(interface.extra_descriptors)
+                if len(extra) >= 7 and extra[1] == 0x21:
+                    self.xfer_size = extra[5] | (extra[6] << 8)
+        if self.interface is None:
+            raise DfuError("no DFU interface")
+        self.polls = 0
+
+    def status(self):
+        data = self.device.ctrl_transfer(0xA1, DFU_GETSTATUS, 0, self.interface, 6)
+        return data[0], data[1] | (data[2] << 8) | (data[3] << 16), data[4]
+
+    def abort(self):
+        self.device.ctrl_transfer(0x21, DFU_ABORT, 0, self.interface, None)
+
+    def dnload(self, block, data):
+        self.device.ctrl_transfer(0x21, DFU_DNLOAD, block, self.interface, data)
+        while True:
+            status, timeout, state = self.status()
+            if state == STATE_ERROR or status != 0:
+                self.device.ctrl_transfer(0x21, DFU_CLRSTATUS, 0, self.interface, None)
+                raise DfuError("block %u : status %u" % (block, status))
+            if state != STATE_DNBUSY:
+                return
+            self.polls += 1
+            time.sleep(timeout / 1000.0)
+
+    def command(self, command, address):
+        self.dnload(0, bytes([command]) + address.to_bytes(4, "little"))
+
+
+def download(dfu, data, address, per_block_address, leave):
+    xfer_size = dfu.xfer_size
+    plan = download_plan(len(data), xfer_size, address, per_block_address)
+    start = time.monotonic()
+    block = 2
+    offset = 0
+    for kind, value in plan:
+        if kind == "erase":
+            dfu.command(DFU_CMD_ERASE, value)
+        elif kind == "address":
+            dfu.command(DFU_CMD_SETADDRESSPOINTER, value)
+            block = 2
+        else:
+            dfu.dnload(block, data[offset:offset + value])
+            offset += value
+            block += 1
+    if leave:
+        dfu.command(DFU_CMD_SETADDRESSPOINTER, address)
+        dfu.device.ctrl_transfer(0x21, DFU_DNLOAD, 0, dfu.interface, None)
+        try:
+            dfu.status()
+        except Exception:
+            pass
+    else:
+        dfu.abort()
+    return time.monotonic() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description="OpenBootloader DfuSe download and throughput model")
+    commands = parser.add_subparsers(dest="command")
+    cmd = commands.add_parser("download", help="download FILE to the target FLASH (pyusb)")
+    cmd.add_argument("file", help="binary image")
+    cmd.add_argument("--address", type=lambda x: int(x, 0), default=0x08020000, help="default 0x08020000")
+    cmd.add_argument("--vid", type=lambda x: int(x, 0), default=0x0483, help="default 0x0483")
+    cmd.add_argument("--pid", type=lambda x: int(x, 0), default=0xDF11, help="default 0xDF11")
+    cmd.add_argument("--per-block-address", action="store_true",
+                     help="set the address pointer before each block, as dfu-util")
+    cmd.add_argument("--leave", action="store_true", help="leave DFU mode and jump to the address")
+    cmd = commands.add_parser("bench", help="compare the legacy and write-behind paths on the model")
+    cmd.add_argument("--size", type=int, default=256 * 1024, help="image size, default 262144")
+    cmd.add_argument("--buffers", type=int, default=3, help="DFU_MEDIA_BUFFER_NUMBER, default 3")
+    cmd.add_argument("--qw-us", type=float, default=90.0, help="actual quad-word programming time, default 90")
+    cmd.add_argument("--erase-ms", type=float, default=1.5, help="actual page erase time, default 1.5")
+    args = parser.parse_args()
+    if args.command is None:
+        parser.error("a command is required")
+
+    try:
+        if args.command == "bench":
+            bench(args.size, args.buffers, args.qw_us, args.erase_ms * 1000.0)
+        else:
+            with open(args.file, "rb") as f:
+                data = f.read()
+            dfu = UsbDfu(args.vid, args.pid)
+            elapsed = download(dfu, data, args.address, args.per_block_address, args.leave)
+            print("%s : %u bytes in %.2f s (%.0f bytes/s), wTransferSize %u, %u dfuDNBUSY polls"
+                  % (args.file, len(data), elapsed, len(data) / elapsed, dfu.xfer_size, dfu.polls))
+    except (OSError, ValueError, DfuError) as error:
+        print("error : %s" % error, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file    Driver_Flash.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the CMSIS flash driver used by delta_patch.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef DRIVER_FLASH_H_
+#define DRIVER_FLASH_H_
+
+#include <stdint.h>
+
+#define ARM_DRIVER_OK            0
+#define ARM_DRIVER_ERROR        -1
+
+typedef struct
+{
+  int32_t (*ProgramData)(uint32_t addr, const void *data, uint32_t cnt);
+} ARM_DRIVER_FLASH;
+
+#endif /* DRIVER_FLASH_H_ */
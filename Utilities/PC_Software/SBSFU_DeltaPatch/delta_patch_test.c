@@ -0,0 +1,422 @@
+/**
+  ******************************************************************************
+  * @file    delta_patch_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the delta patch module of the SBSFU loader and
+  *          application (delta_patch.c) with a flash stub : generated patches
+  *          are applied packet by packet, then truncated and corrupted
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stm32u5xx_hal.h"
+#include "Driver_Flash.h"
+#include "delta_patch.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_SOURCE_OFFSET      0x00010000U  /* active slot offset in flash */
+#define TEST_TARGET_OFFSET      0x00100000U  /* download slot offset in flash */
+#define TEST_TARGET_MARGIN      0x1000U      /* download slot bytes after the new image */
+#define TEST_MIN_WRITE_SIZE     16U          /* flash program unit (quad-word) */
+#define TEST_YMODEM_PACKET      1024U
+
+#define TEST_CUT_NUMBER         256U         /* truncated patches, besides the first 64 lengths */
+#define TEST_CORRUPT_NUMBER     512U         /* corrupted patches, besides the header bytes */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t *data;
+  size_t   size;
+} test_file_t;
+
+/* Private variables ---------------------------------------------------------*/
+uint8_t *host_flash;                 /* non secure flash alias, holding the active slot only */
+
+static uint8_t *test_target;         /* download slot */
+static uint32_t test_target_size;
+static uint32_t test_violations;     /* programming out of the download slot, unaligned or on programmed bytes */
+static uint32_t test_program_calls;
+static uint32_t test_program_fail;   /* ProgramData call failing, 0 for none */
+static uint32_t test_failures;
+static uint32_t test_seed;
+
+/* Private functions ---------------------------------------------------------*/
+static int32_t test_program_data(uint32_t addr, const void *data, uint32_t cnt)
+{
+  uint32_t i;
+
+  test_program_calls++;
+  if (test_program_calls == test_program_fail)
+  {
+    return ARM_DRIVER_ERROR;
+  }
+  if ((addr < TEST_TARGET_OFFSET) || ((addr - TEST_TARGET_OFFSET) > test_target_size)
+      || (cnt > (test_target_size - (addr - TEST_TARGET_OFFSET)))
+      || ((addr % TEST_MIN_WRITE_SIZE) != 0U) || ((cnt % TEST_MIN_WRITE_SIZE) != 0U))
+  {
+    test_violations++;
+    return ARM_DRIVER_ERROR;
+  }
+  for (i = 0U; i < cnt; i++)
+  {
+    if (test_target[addr - TEST_TARGET_OFFSET + i] != 0xFFU)
+    {
+      test_violations++;
+      return ARM_DRIVER_ERROR;
+    }
+    test_target[addr - TEST_TARGET_OFFSET + i] = ((const uint8_t *)data)[i];
+  }
+  return ARM_DRIVER_OK;
+}
+
+ARM_DRIVER_FLASH Driver_FLASH0 = {test_program_data};
+
+static uint32_t test_random(void)
+{
+  test_seed = (test_seed * 1103515245U) + 12345U;
+  return test_seed >> 8;
+}
+
+static int test_read(const char *path, test_file_t *p_file)
+{
+  FILE *fp = fopen(path, "rb");
+  long size;
+
+  if ((fp == NULL) || (fseek(fp, 0, SEEK_END) != 0) || ((size = ftell(fp)) < 0) || (fseek(fp, 0, SEEK_SET) != 0))
+  {
+    fprintf(stderr, "cannot read %s\n", path);
+    return -1;
+  }
+  p_file->size = (size_t)size;
+  p_file->data = malloc(p_file->size + 1U);
+  if ((p_file->data == NULL) || (fread(p_file->data, 1U, p_file->size, fp) != p_file->size))
+  {
+    fprintf(stderr, "cannot read %s\n", path);
+    fclose(fp);
+    return -1;
+  }
+  fclose(fp);
+  return 0;
+}
+
+static int test_write(const char *path, const uint8_t *data, size_t size)
+{
+  FILE *fp = fopen(path, "wb");
+
+  if ((fp == NULL) || (fwrite(data, 1U, size, fp) != size) || (fclose(fp) != 0))
+  {
+    fprintf(stderr, "cannot write %s\n", path);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Apply a patch as the firmware update does : DELTA_IsPatch on the first packet, DELTA_Process on each
+  *         packet until an error, then DELTA_Finalize
+  * @param  packet packet size, 0 for random sizes from 1 to TEST_YMODEM_PACKET
+  */
+static DELTA_StatusTypeDef test_apply(const uint8_t *patch, size_t size, uint32_t source_max, uint32_t packet,
+                                      uint32_t *p_target_size)
+{
+  DELTA_StatusTypeDef status = DELTA_OK;
+  size_t pos = 0U;
+  size_t length;
+
+  memset(test_target, 0xFF, test_target_size);
+  test_violations = 0U;
+  test_program_calls = 0U;
+  *p_target_size = 0U;
+
+  if (DELTA_IsPatch(patch, (uint32_t)((size < TEST_YMODEM_PACKET) ? size : TEST_YMODEM_PACKET)) == 0U)
+  {
+    return DELTA_ERROR_FORMAT;
+  }
+  DELTA_Init(TEST_SOURCE_OFFSET, source_max, TEST_TARGET_OFFSET, test_target_size - TEST_MIN_WRITE_SIZE,
+             TEST_MIN_WRITE_SIZE);
+  while ((pos < size) && (status == DELTA_OK))
+  {
+    length = (packet != 0U) ? packet : (1U + (test_random() % TEST_YMODEM_PACKET));
+    length = (length < (size - pos)) ? length : (size - pos);
+    status = DELTA_Process(&patch[pos], (uint32_t)length);
+    pos += length;
+  }
+  return (status == DELTA_OK) ? DELTA_Finalize(p_target_size) : status;
+}
+
+static void test_fail(const char *name, const char *detail, size_t value, DELTA_StatusTypeDef status)
+{
+  if (test_failures < 20U)
+  {
+    printf("  %s : %s %zu (status %d, %u programming violations)\n", name, detail, value, (int)status,
+           test_violations);
+  }
+  test_failures++;
+}
+
+/**
+  * @brief  Generate a source and a target image : identical, firmware like update, unrelated or shorter target
+  */
+static int test_generate(uint32_t seed, uint32_t size, const char *old_path, const char *new_path)
+{
+  uint8_t *old_image = malloc(size + 1U);
+  uint8_t *new_image = malloc((2U * size) + 4096U);
+  uint32_t new_size = 0U;
+  uint32_t pos = 0U;
+  uint32_t length;
+  uint32_t i;
+  int ret;
+
+  test_seed = seed;
+  for (i = 0U; i < size; i++)
+  {
+    /* instruction like content : repeated words with a few random bytes */
+    old_image[i] = ((i % 16U) < 12U) ? (uint8_t)((i / 64U) ^ (i % 4U)) : (uint8_t)test_random();
+  }
+
+  switch (seed % 4U)
+  {
+    case 0U:
+      memcpy(new_image, old_image, size);
+      new_size = size;
+      break;
+
+    case 1U:
+      while (pos < size)
+      {
+        length = 1U + (test_random() % 2048U);
+        length = (length < (size - pos)) ? length : (size - pos);
+        switch (test_random() % 4U)
+        {
+          case 0U:
+            /* unchanged block */
+            memcpy(&new_image[new_size], &old_image[pos], length);
+            new_size += length;
+            break;
+          case 1U:
+            /* addresses moved by the link : words incremented */
+            for (i = 0U; i < length; i++)
+            {
+              new_image[new_size + i] = (uint8_t)(old_image[pos + i] + (((i % 4U) == 0U) ? 0x20U : 0U));
+            }
+            new_size += length;
+            break;
+          case 2U:
+            /* new code inserted before the block */
+            for (i = 0U; i < (length / 4U); i++)
+            {
+              new_image[new_size++] = (uint8_t)test_random();
+            }
+            memcpy(&new_image[new_size], &old_image[pos], length);
+            new_size += length;
+            break;
+          default:
+            /* block removed */
+            break;
+        }
+        pos += length;
+      }
+      for (i = 0U; i < 100U; i++)
+      {
+        new_image[new_size++] = (uint8_t)test_random();
+      }
+      break;
+
+    case 2U:
+      for (i = 0U; i < size; i++)
+      {
+        new_image[new_size++] = (uint8_t)test_random();
+      }
+      break;
+
+    default:
+      new_size = (size / 2U) + 1U;
+      memcpy(new_image, old_image, new_size);
+      for (i = 0U; i < new_size; i += 97U)
+      {
+        new_image[i] ^= 0x5AU;
+      }
+      break;
+  }
+
+  ret = ((test_write(old_path, old_image, size) == 0) && (test_write(new_path, new_image, new_size) == 0)) ? 0 : 1;
+  free(old_image);
+  free(new_image);
+  return ret;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  static const uint32_t packets[] = {TEST_YMODEM_PACKET, 128U, 1U, 0U};
+  test_file_t old_file;
+  test_file_t new_file;
+  test_file_t patch_file;
+  uint8_t *patch;
+  uint32_t source_max;
+  uint32_t target_size;
+  DELTA_StatusTypeDef status;
+  size_t cut;
+  size_t pos;
+  size_t count;
+  size_t i;
+
+  if ((argc == 6) && (strcmp(argv[1], "gen") == 0))
+  {
+    return test_generate((uint32_t)strtoul(argv[2], NULL, 0), (uint32_t)strtoul(argv[3], NULL, 0), argv[4], argv[5]);
+  }
+  if (argc != 4)
+  {
+    fprintf(stderr, "usage: %s OLD NEW PATCH\n       %s gen SEED SIZE OLD NEW\n", argv[0], argv[0]);
+    return 2;
+  }
+  if ((test_read(argv[1], &old_file) != 0) || (test_read(argv[2], &new_file) != 0)
+      || (test_read(argv[3], &patch_file) != 0) || (old_file.size == 0U))
+  {
+    return 2;
+  }
+
+  /* the active slot ends with the source image : a read past it is reported by the address sanitizer */
+  source_max = (uint32_t)old_file.size;
+  host_flash = malloc(TEST_SOURCE_OFFSET + old_file.size);
+  test_target_size = (((uint32_t)new_file.size + TEST_MIN_WRITE_SIZE - 1U) & ~(TEST_MIN_WRITE_SIZE - 1U))
+                     + TEST_TARGET_MARGIN;
+  test_target = malloc(test_target_size);
+  patch = malloc(patch_file.size + 1U);
+  if ((host_flash == NULL) || (test_target == NULL) || (patch == NULL))
+  {
+    fprintf(stderr, "no memory\n");
+    return 2;
+  }
+  memset(host_flash, 0xFF, TEST_SOURCE_OFFSET);
+  memcpy(&host_flash[TEST_SOURCE_OFFSET], old_file.data, old_file.size);
+  test_seed = 1U;
+
+  printf("%s : %zu bytes, %zu bytes source, %zu bytes target\n", argv[3], patch_file.size, old_file.size,
+         new_file.size);
+
+  /* complete patch, Ymodem packets, small packets, byte per byte and random packets */
+  for (i = 0U; i < (sizeof(packets) / sizeof(packets[0])); i++)
+  {
+    status = test_apply(patch_file.data, patch_file.size, source_max, packets[i], &target_size);
+    if ((status != DELTA_OK) || (target_size != new_file.size) || (test_violations != 0U)
+        || (memcmp(test_target, new_file.data, new_file.size) != 0))
+    {
+      test_fail("apply", "packet size", packets[i], status);
+    }
+    for (pos = new_file.size; pos < test_target_size; pos++)
+    {
+      if ((test_target[pos] != 0xFFU) && (pos >= ((new_file.size + TEST_MIN_WRITE_SIZE - 1U)
+                                                  & ~(size_t)(TEST_MIN_WRITE_SIZE - 1U))))
+      {
+        test_fail("apply", "programmed after the image at", pos, status);
+        break;
+      }
+    }
+  }
+  printf("  apply     : packets of 1024, 128, 1 and random bytes\n");
+
+  /* truncated patches are never accepted */
+  for (i = 0U, count = 1U; i < (64U + TEST_CUT_NUMBER); i++)
+  {
+    cut = (i < 64U) ? i : (((i - 64U) * patch_file.size) / TEST_CUT_NUMBER);
+    if ((cut >= patch_file.size) || ((i >= 64U) && (cut < 64U)))
+    {
+      continue;
+    }
+    count++;
+    status = test_apply(patch_file.data, cut, source_max, 0U, &target_size);
+    if ((status == DELTA_OK) || (test_violations != 0U))
+    {
+      test_fail("truncated", "length", cut, status);
+    }
+  }
+  status = test_apply(patch_file.data, patch_file.size - 1U, source_max, TEST_YMODEM_PACKET, &target_size);
+  if ((status == DELTA_OK) || (test_violations != 0U))
+  {
+    test_fail("truncated", "length", patch_file.size - 1U, status);
+  }
+  printf("  truncated : %zu lengths\n", count);
+
+  /* a corrupted patch is rejected, or rebuilds the same image, without programming out of the image */
+  for (i = 0U; i < (DELTA_HEADER_SIZE + TEST_CORRUPT_NUMBER); i++)
+  {
+    pos = (i < DELTA_HEADER_SIZE) ? i : ((test_random() % patch_file.size));
+    if (pos >= patch_file.size)
+    {
+      continue;
+    }
+    memcpy(patch, patch_file.data, patch_file.size);
+    patch[pos] ^= (uint8_t)(1U + (test_random() % 255U));
+    status = test_apply(patch, patch_file.size, source_max, 0U, &target_size);
+    if ((test_violations != 0U)
+        || ((status == DELTA_OK)
+            && ((target_size != new_file.size) || (memcmp(test_target, new_file.data, new_file.size) != 0))))
+    {
+      test_fail("corrupted", "offset", pos, status);
+    }
+  }
+  printf("  corrupted : %u patches\n", DELTA_HEADER_SIZE + TEST_CORRUPT_NUMBER);
+
+  /* bytes after the end of the target image */
+  memcpy(patch, patch_file.data, patch_file.size);
+  patch[patch_file.size] = 0U;
+  status = test_apply(patch, patch_file.size + 1U, source_max, TEST_YMODEM_PACKET, &target_size);
+  if (status != DELTA_ERROR_FORMAT)
+  {
+    test_fail("trailing", "byte, length", patch_file.size + 1U, status);
+  }
+
+  /* active slot holding another image */
+  host_flash[TEST_SOURCE_OFFSET + (old_file.size / 2U)] ^= 0x01U;
+  status = test_apply(patch_file.data, patch_file.size, source_max, TEST_YMODEM_PACKET, &target_size);
+  host_flash[TEST_SOURCE_OFFSET + (old_file.size / 2U)] ^= 0x01U;
+  if (status != DELTA_ERROR_SOURCE)
+  {
+    test_fail("source", "byte changed at", old_file.size / 2U, status);
+  }
+
+  /* source image larger than the active slot */
+  status = test_apply(patch_file.data, patch_file.size, source_max - 1U, TEST_YMODEM_PACKET, &target_size);
+  if (status != DELTA_ERROR_SIZE)
+  {
+    test_fail("size", "active slot size", source_max - 1U, status);
+  }
+
+  /* flash programming errors */
+  for (test_program_fail = 1U; test_program_fail <= 2U; test_program_fail++)
+  {
+    status = test_apply(patch_file.data, patch_file.size, source_max, TEST_YMODEM_PACKET, &target_size);
+    if ((status != DELTA_ERROR_FLASH) && (test_program_calls >= test_program_fail))
+    {
+      test_fail("flash", "error at call", test_program_fail, status);
+    }
+  }
+  test_program_fail = 0U;
+  printf("  rejected  : trailing byte, other source image, active slot too small, flash errors\n");
+
+  printf("%s\n", (test_failures == 0U) ? "PASSED" : "FAILED");
+
+  free(host_flash);
+  free(test_target);
+  free(patch);
+  free(old_file.data);
+  free(new_file.data);
+  free(patch_file.data);
+  return (test_failures == 0U) ? 0 : 1;
+}
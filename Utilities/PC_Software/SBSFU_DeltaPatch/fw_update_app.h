@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    fw_update_app.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the firmware update configuration used by
+  *          delta_patch.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef FW_UPDATE_APP_H
+#define FW_UPDATE_APP_H
+
+#define FW_UPDATE_DELTA_PATCH      1U
+
+#endif /* FW_UPDATE_APP_H */
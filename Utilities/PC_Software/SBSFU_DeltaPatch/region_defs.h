@@ -0,0 +1,24 @@
+/**
+  ******************************************************************************
+  * @file    region_defs.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the flash driver name used by delta_patch.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __REGION_DEFS_H__
+#define __REGION_DEFS_H__
+
+#define LOADER_FLASH_DEV_NAME    Driver_FLASH0
+
+#endif /* __REGION_DEFS_H__ */
@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    sbsfu_delta_patch.py
+#  @author  MCD Application Team
+#  @brief   SBSFU delta patch generator, builds the patch applied by the loader and the application firmware update
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+The patch rebuilds a new image from the image installed in the active (primary) slot. It is sent over Ymodem in
+place of the new image, the target writes the rebuilt image in the download (secondary) slot, MCUboot then checks
+and installs it as any downloaded image (see delta_patch.h in SBSFU_Loader and SBSFU_Appli).
+
+The patch is bsdiff like, without compression so that it is applied on the fly with a bounded RAM:
+ - header : magic "DLT1", source size, source CRC32, target size, target CRC32 (little endian 32-bit words),
+ - records : diff length, extra length, source seek (LEB128 varints, zigzag encoded seek), then the diff tokens
+   (copy length, add length, add bytes) rebuilding diff length bytes from the source, then the extra bytes.
+The target rejects a patch whose source CRC differs from the active slot content, and checks the target CRC before
+the installation is requested.
+
+Usage: python sbsfu_delta_patch.py diff OLD NEW PATCH [--no-check]
+       python sbsfu_delta_patch.py apply OLD PATCH NEW
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = 0x31544C44              # "DLT1", DELTA_MAGIC
+HEADER = struct.Struct("<5I")   # DELTA_HEADER_SIZE
+BLOCK = 8                       # bytes hashed to find a match in the source image
+MIN_SCORE = 16                  # matching bytes (net of mismatches) needed to use a source region
+STOP_SCORE = 32                 # net mismatches ending the extension of a match
+ZERO_RUN = 4                    # zero add bytes ending an add token
+
+
+class PatchError(Exception):
+    pass
+
+
+def varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def zigzag(value):
+    return ((value << 1) ^ (value >> 31)) & 0xFFFFFFFF
+
+
+def extend(old, new, o, n):
+    """Forward extension of a match, the length maximizing 2 * equal bytes - length is kept (bsdiff)."""
+    limit = min(len(old) - o, len(new) - n)
+    best_len = best_score = score = 0
+    i = 0
+    while i < limit:
+        score += 1 if old[o + i] == new[n + i] else -1
+        i += 1
+        if score > best_score:
+            best_score, best_len = score, i
+        elif best_score - score > STOP_SCORE:
+            break
+    return best_len, best_score
+
+
+def find_matches(old, new):
+    """Approximate matches (old start, new start, length), ordered and not overlapping in the new image."""
+    index = {}
+    for i in range(len(old) - BLOCK, -1, -1):
+        index[old[i:i + BLOCK]] = i
+    matches = []
+    offset = 0
+    scan = 0
+    while scan + BLOCK <= len(new):
+        key = new[scan:scan + BLOCK]
+        candidates = []
+        # The code moved by the same offset as the previous match is tried first
+        if 0 <= scan + offset and old[scan + offset:scan + offset + BLOCK] == key:
+            candidates.append(scan + offset)
+        found = index.get(key)
+        if found is not None and found not in candidates:
+            candidates.append(found)
+        best = None
+        for o in candidates:
+            length, score = extend(old, new, o, scan)
+            if score >= MIN_SCORE and (best is None or score > best[2]):
+                best = (o, length, score)
+        if best is None:
+            scan += 1
+            continue
+        matches.append((best[0], scan, best[1]))
+        offset = best[0] - scan
+        scan += best[1]
+    return matches
+
+
+def encode_diff(old, new, o, n, length):
+    """Diff tokens : copy length, add length, add bytes."""
+    add = bytes((new[n + j] - old[o + j]) & 0xFF for j in range(length))
+    out = bytearray()
+    i = 0
+    while i < length:
+        j = i
+        while j < length and add[j] == 0:
+            j += 1
+        k = j
+        while k < length:
+            if add[k] != 0:
+                k += 1
+                continue
+            z = k
+            while z < length and add[z] == 0:
+                z += 1
+            if z - k >= ZERO_RUN or z == length:
+                break
+            k = z
+        out += varint(j - i) + varint(k - j) + add[j:k]
+        i = k
+    return bytes(out)
+
+
+def diff(old, new):
+    matches = find_matches(old, new)
+    # record : old start, diff length, extra start, extra length
+    records = []
+    if not matches or matches[0][0] != 0 or matches[0][1] != 0:
+        records.append((0, 0, 0, matches[0][1] if matches else len(new)))
+    for k, (o, n, length) in enumerate(matches):
+        end = matches[k + 1][1] if k + 1 < len(matches) else len(new)
+        records.append((o, length, n + length, end - n - length))
+
+    patch = bytearray(HEADER.pack(MAGIC, len(old), zlib.crc32(old), len(new), zlib.crc32(new)))
+    for k, (o, length, e, extra) in enumerate(records):
+        seek = records[k + 1][0] - (o + length) if k + 1 < len(records) else 0
+        patch += varint(length) + varint(extra) + varint(zigzag(seek))
+        patch += encode_diff(old, new, o, e - length, length)
+        patch += new[e:e + extra]
+    return bytes(patch)
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def bytes(self, size):
+        if self.pos + size > len(self.data):
+            raise PatchError("truncated patch")
+        value = self.data[self.pos:self.pos + size]
+        self.pos += size
+        return value
+
+    def varint(self):
+        value = shift = 0
+        while True:
+            if shift > 28:
+                raise PatchError("varint too long")
+            byte = self.bytes(1)[0]
+            value |= (byte & 0x7F) << shift
+            if not byte & 0x80:
+                return value & 0xFFFFFFFF
+            shift += 7
+
+
+def apply(old, patch):
+    """Reference patch application, with the checks done by the target."""
+    reader = Reader(patch)
+    magic, source_size, source_crc, target_size, target_crc = HEADER.unpack(reader.bytes(HEADER.size))
+    if magic != MAGIC:
+        raise PatchError("not a delta patch")
+    if source_size > len(old) or zlib.crc32(old[:source_size]) != source_crc:
+        raise PatchError("patch not generated from this source image")
+    source = old[:source_size]
+    out = bytearray()
+    pos = 0
+
+    def read_source(size):
+        nonlocal pos
+        if pos < 0 or pos + size > source_size:
+            raise PatchError("source position out of the source image")
+        pos += size
+        return source[pos - size:pos]
+
+    while len(out) < target_size:
+        diff_len, extra_len = reader.varint(), reader.varint()
+        seek = reader.varint()
+        seek = (seek >> 1) ^ -(seek & 1)
+        if diff_len + extra_len > target_size - len(out):
+            raise PatchError("record larger than the target image")
+        while diff_len:
+            copy = reader.varint()
+            if copy > diff_len:
+                raise PatchError("copy token larger than the diff")
+            diff_len -= copy
+            out += read_source(copy)
+            add = reader.varint()
+            if add > diff_len:
+                raise PatchError("add token larger than the diff")
+            diff_len -= add
+            out += bytes((s + a) & 0xFF for s, a in zip(read_source(add), reader.bytes(add)))
+        out += reader.bytes(extra_len)
+        pos += seek
+    if reader.pos != len(patch):
+        raise PatchError("data after the end of the target image")
+    if zlib.crc32(out) != target_crc:
+        raise PatchError("target image CRC mismatch")
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SBSFU delta patch generator")
+    commands = parser.add_subparsers(dest="command")
+    cmd = commands.add_parser("diff", help="build the patch rebuilding NEW from OLD")
+    cmd.add_argument("old", help="image installed in the active slot")
+    cmd.add_argument("new", help="new image, as it would be downloaded")
+    cmd.add_argument("patch", help="patch file to send with Ymodem")
+    cmd.add_argument("--no-check", action="store_true", help="do not apply the patch to check it")
+    cmd = commands.add_parser("apply", help="rebuild NEW from OLD and PATCH")
+    cmd.add_argument("old", help="image installed in the active slot")
+    cmd.add_argument("patch", help="patch file")
+    cmd.add_argument("new", help="rebuilt image")
+    args = parser.parse_args()
+    if args.command is None:
+        parser.error("a command is required")
+
+    try:
+        with open(args.old, "rb") as f:
+            old = f.read()
+        if args.command == "diff":
+            with open(args.new, "rb") as f:
+                new = f.read()
+            patch = diff(old, new)
+            if not args.no_check and apply(old, patch) != new:
+                raise PatchError("patch check failed")
+            with open(args.patch, "wb") as f:
+                f.write(patch)
+            print("%s : %u bytes, %u bytes image (%.1f %%)" % (args.patch, len(patch), len(new),
+                                                              100.0 * len(patch) / max(len(new), 1)))
+        else:
+            with open(args.patch, "rb") as f:
+                patch = f.read()
+            new = apply(old, patch)
+            with open(args.new, "wb") as f:
+                f.write(new)
+            print("%s : %u bytes" % (args.new, len(new)))
+    except (OSError, PatchError) as error:
+        print("error : %s" % error, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
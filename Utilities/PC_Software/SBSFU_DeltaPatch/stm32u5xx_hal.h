@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the HAL definitions used by delta_patch.c : the
+  *          non secure flash alias is the flash array of delta_patch_test.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_HAL_H
+#define STM32U5xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+extern uint8_t *host_flash;
+#define FLASH_BASE_NS            ((uintptr_t)host_flash)
+
+#endif /* STM32U5xx_HAL_H */
@@ -0,0 +1,429 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    sbsfu_ecdsa_ref.py
+#  @author  MCD Application Team
+#  @brief   ECDSA P-256 host reference of the SBSFU_Boot image signature verification
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+Pure Python reference of the ECDSA P-256 verification done by SBSFU_Boot with the PKA (ecdsa_alt.c), used to check
+signed images and test vectors on the host without the target.
+
+ - verify   : checks the ECDSA256 signature of an MCUboot image (SHA256 of the header, the image and the protected
+              TLV area) with a root public key (keys.c array, PEM public or private key).
+ - selftest : cross-checks the fixed-base comb against the double-and-add, signs and verifies random digests,
+              rejects corrupted signatures and checks that the keys of keys.c are on the curve.
+ - bench    : counts the field multiplications of u1.G + u2.Q with the double-and-add (Shamir) and with comb tables
+              for G and for a fixed root key, and gives the flash size of the tables.
+
+Usage: python sbsfu_ecdsa_ref.py verify IMAGE --key KEY [--key KEY ...]
+       python sbsfu_ecdsa_ref.py selftest [--keys keys.c] [--count COUNT]
+       python sbsfu_ecdsa_ref.py bench [--comb-width WIDTH]
+"""
+
+import argparse
+import base64
+import hashlib
+import os
+import re
+import struct
+import sys
+
+# NIST P-256 (secp256r1)
+P = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+A = P - 3
+B = 0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B
+N = 0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+G = (0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5)
+BITS = 256
+
+# MCUboot image format
+IMAGE_MAGIC = 0x96F3B83D
+IMAGE_TLV_INFO_MAGIC = 0x6907
+IMAGE_TLV_PROT_INFO_MAGIC = 0x6908
+IMAGE_TLV_KEYHASH = 0x01
+IMAGE_TLV_SHA256 = 0x10
+IMAGE_TLV_ECDSA256 = 0x22
+
+
+class EcdsaError(Exception):
+    pass
+
+
+class Field:
+    """Modular arithmetic of the curve prime, counting the multiplications (squares included)."""
+
+    mul_count = 0
+
+    @classmethod
+    def mul(cls, a, b):
+        cls.mul_count += 1
+        return a * b % P
+
+
+def inv(a, m):
+    return pow(a, m - 2, m)
+
+
+# Points are in Jacobian coordinates (X, Y, Z), None is the point at infinity
+def jacobian(point):
+    return None if point is None else (point[0], point[1], 1)
+
+
+def affine(point):
+    if point is None:
+        return None
+    x, y, z = point
+    zi = inv(z, P)
+    zi2 = zi * zi % P
+    return x * zi2 % P, y * zi2 * zi % P
+
+
+def double(p1):
+    if p1 is None or p1[1] == 0:
+        return None
+    mul = Field.mul
+    x, y, z = p1
+    yy = mul(y, y)
+    zz = mul(z, z)
+    s = 4 * mul(x, yy) % P
+    m = 3 * mul(x - zz, x + zz) % P
+    x3 = (mul(m, m) - 2 * s) % P
+    y3 = (mul(m, s - x3) - 8 * mul(yy, yy)) % P
+    z3 = 2 * mul(y, z) % P
+    return x3, y3, z3
+
+
+def add(p1, p2):
+    """Jacobian + affine (mixed) addition when p2[2] == 1, Jacobian + Jacobian otherwise."""
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    mul = Field.mul
+    x1, y1, z1 = p1
+    x2, y2, z2 = p2
+    z1z1 = mul(z1, z1)
+    u2 = mul(x2, z1z1)
+    s2 = mul(y2, mul(z1, z1z1))
+    if z2 == 1:
+        u1, s1 = x1, y1
+    else:
+        z2z2 = mul(z2, z2)
+        u1 = mul(x1, z2z2)
+        s1 = mul(y1, mul(z2, z2z2))
+    h = (u2 - u1) % P
+    r = (s2 - s1) % P
+    if h == 0:
+        return double(p1) if r == 0 else None
+    hh = mul(h, h)
+    hhh = mul(h, hh)
+    v = mul(u1, hh)
+    x3 = (mul(r, r) - hhh - 2 * v) % P
+    y3 = (mul(r, v - x3) - mul(s1, hhh)) % P
+    z3 = mul(z1, h) if z2 == 1 else mul(mul(z1, h), z2)
+    return x3, y3, z3
+
+
+def on_curve(point):
+    x, y = point
+    return 0 <= x < P and 0 <= y < P and (y * y - x * x * x - A * x - B) % P == 0
+
+
+def scalar_mult(k, point):
+    """Left to right double-and-add."""
+    result = None
+    base = jacobian(point)
+    for i in range(k.bit_length() - 1, -1, -1):
+        result = double(result)
+        if (k >> i) & 1:
+            result = add(result, base)
+    return result
+
+
+def shamir_mult(k1, point1, k2, point2):
+    """k1.point1 + k2.point2 with a single doubling chain (Straus-Shamir)."""
+    p1 = jacobian(point1)
+    p2 = jacobian(point2)
+    p12 = jacobian(affine(add(p1, p2)))
+    result = None
+    for i in range(max(k1.bit_length(), k2.bit_length()) - 1, -1, -1):
+        result = double(result)
+        bits = ((k1 >> i) & 1) | (((k2 >> i) & 1) << 1)
+        if bits:
+            result = add(result, (None, p1, p2, p12)[bits])
+    return result
+
+
+class Comb:
+    """Fixed-base comb (Lim-Lee) of width w : 2^w - 1 affine points computed once, for instance stored in flash."""
+
+    def __init__(self, point, width):
+        self.width = width
+        self.d = (BITS + width - 1) // width
+        rows = [jacobian(point)]
+        for _ in range(width - 1):
+            row = rows[-1]
+            for _ in range(self.d):
+                row = double(row)
+            rows.append(jacobian(affine(row)))
+        self.table = [None] * (1 << width)
+        for index in range(1, 1 << width):
+            acc = None
+            for j in range(width):
+                if (index >> j) & 1:
+                    acc = add(acc, rows[j])
+            self.table[index] = jacobian(affine(acc))
+
+    def flash_size(self):
+        return ((1 << self.width) - 1) * 2 * (BITS // 8)
+
+    def index(self, k, i):
+        index = 0
+        for j in range(self.width):
+            index |= ((k >> (j * self.d + i)) & 1) << j
+        return index
+
+    def mult(self, k, other=None, k_other=0):
+        """k.point, + k_other.point_other when other is a comb of the same width (the doubling chain is shared)."""
+        result = None
+        for i in range(self.d - 1, -1, -1):
+            result = double(result)
+            index = self.index(k, i)
+            if index:
+                result = add(result, self.table[index])
+            if other is not None:
+                index = other.index(k_other, i)
+                if index:
+                    result = add(result, other.table[index])
+        return result
+
+
+def verify_digest(digest, signature, public_key, comb_g=None, comb_q=None):
+    """ECDSA verification, same checks as mbedtls_ecdsa_verify / HAL_PKA_ECDSAVerif."""
+    r, s = signature
+    if not (0 < r < N and 0 < s < N):
+        return False
+    if public_key is None or not on_curve(public_key):
+        return False
+    e = int.from_bytes(digest[:BITS // 8], "big")
+    w = inv(s, N)
+    u1 = e * w % N
+    u2 = r * w % N
+    if comb_g is not None and comb_q is not None:
+        point = comb_g.mult(u1, comb_q, u2)
+    elif comb_g is not None:
+        point = add(comb_g.mult(u1), scalar_mult(u2, public_key))
+    else:
+        point = shamir_mult(u1, G, u2, public_key)
+    point = affine(point)
+    return point is not None and point[0] % N == r
+
+
+def sign_digest(digest, private_key, nonce):
+    e = int.from_bytes(digest[:BITS // 8], "big")
+    r = affine(scalar_mult(nonce, G))[0] % N
+    s = inv(nonce, N) * (e + r * private_key) % N
+    if r == 0 or s == 0:
+        raise EcdsaError("invalid nonce")
+    return r, s
+
+
+# ASN.1 DER, just what is needed for the keys and the signatures
+def der_read(data, offset, expected=None):
+    tag = data[offset]
+    length = data[offset + 1]
+    offset += 2
+    if length & 0x80:
+        count = length & 0x7F
+        length = int.from_bytes(data[offset:offset + count], "big")
+        offset += count
+    if expected is not None and tag != expected:
+        raise EcdsaError("DER tag 0x%02x expected, 0x%02x found" % (expected, tag))
+    if offset + length > len(data):
+        raise EcdsaError("DER length out of range")
+    return tag, data[offset:offset + length], offset + length
+
+
+def der_signature(data):
+    _, body, _ = der_read(data, 0, 0x30)
+    _, r, offset = der_read(body, 0, 0x02)
+    _, s, _ = der_read(body, offset, 0x02)
+    return int.from_bytes(r, "big"), int.from_bytes(s, "big")
+
+
+def der_public_key(der):
+    """Public point of a SubjectPublicKeyInfo, a PKCS#8 or a SEC1 private key, computed from the scalar if absent."""
+    match = re.search(b"\x03\x42\x00\x04(.{64})", der, re.S)
+    if match:
+        point = match.group(1)
+        return int.from_bytes(point[:32], "big"), int.from_bytes(point[32:], "big")
+    match = re.search(b"\x02\x01\x01\x04\x20(.{32})", der, re.S)
+    if match:
+        return affine(scalar_mult(int.from_bytes(match.group(1), "big"), G))
+    raise EcdsaError("no P-256 key found")
+
+
+def pem_der(text):
+    match = re.search(r"-----BEGIN [A-Z ]+-----(.*?)-----END", text, re.S)
+    if not match:
+        raise EcdsaError("no PEM block found")
+    return base64.b64decode("".join(match.group(1).split()))
+
+
+def c_arrays(text):
+    """Byte arrays of a C file such as SBSFU_Boot/Src/keys.c : {name: bytes}."""
+    arrays = {}
+    for name, body in re.findall(r"unsigned\s+char\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}", text, re.S):
+        arrays[name] = bytes(int(value, 0) for value in re.findall(r"0x[0-9a-fA-F]+|\d+", body))
+    return arrays
+
+
+def load_keys(path):
+    """[(name, public point)] of a PEM file or of the ecdsa_pub_key arrays of a C file."""
+    with open(path, "r") as f:
+        text = f.read()
+    if "-----BEGIN" in text:
+        return [(os.path.basename(path), der_public_key(pem_der(text)))]
+    keys = [(name, der_public_key(der)) for name, der in c_arrays(text).items() if name.startswith("ecdsa_pub_key")]
+    if not keys:
+        raise EcdsaError("%s : no ecdsa_pub_key array found" % path)
+    return keys
+
+
+def image_signature(image):
+    """(digest, signature, key hash) of an MCUboot image, the digest covering header, image and protected TLVs."""
+    if len(image) < 32:
+        raise EcdsaError("image too small")
+    magic, _, hdr_size, protect_tlv_size, img_size = struct.unpack_from("<IIHHI", image, 0)
+    if magic != IMAGE_MAGIC:
+        raise EcdsaError("bad image magic 0x%08x" % magic)
+    offset = hdr_size + img_size
+    if offset + protect_tlv_size + 4 > len(image):
+        raise EcdsaError("image truncated")
+    digest = hashlib.sha256(image[:offset + protect_tlv_size]).digest()
+    offset += protect_tlv_size
+    tlv_magic, tlv_total = struct.unpack_from("<HH", image, offset)
+    if tlv_magic != IMAGE_TLV_INFO_MAGIC:
+        raise EcdsaError("bad TLV area magic 0x%04x" % tlv_magic)
+    end = offset + tlv_total
+    offset += 4
+    signature = key_hash = None
+    while offset + 4 <= end:
+        tlv_type, tlv_len = struct.unpack_from("<HH", image, offset)
+        value = image[offset + 4:offset + 4 + tlv_len]
+        if tlv_type == IMAGE_TLV_SHA256 and value != digest:
+            raise EcdsaError("SHA256 TLV does not match the image")
+        elif tlv_type == IMAGE_TLV_KEYHASH:
+            key_hash = value
+        elif tlv_type == IMAGE_TLV_ECDSA256:
+            signature = der_signature(value)
+        offset += 4 + tlv_len
+    if signature is None:
+        raise EcdsaError("no ECDSA256 TLV")
+    return digest, signature, key_hash
+
+
+def cmd_verify(args):
+    with open(args.image, "rb") as f:
+        image = f.read()
+    digest, signature, _ = image_signature(image)
+    print("%s : SHA256 %s" % (args.image, digest.hex()))
+    valid = False
+    for path in args.key:
+        for name, key in load_keys(path):
+            result = verify_digest(digest, signature, key)
+            print("  %-24s : %s" % (name, "signature valid" if result else "no match"))
+            valid = valid or result
+    return 0 if valid else 1
+
+
+def cmd_selftest(args):
+    rng = os.urandom
+    failures = 0
+    comb = Comb(G, 4)
+    for _ in range(args.count):
+        k = int.from_bytes(rng(32), "big") % N
+        if affine(comb.mult(k)) != affine(scalar_mult(k, G)):
+            failures += 1
+    print("comb / double-and-add   : %u scalars, %u mismatches" % (args.count, failures))
+
+    errors = 0
+    for _ in range(args.count):
+        d = int.from_bytes(rng(32), "big") % (N - 1) + 1
+        q = affine(scalar_mult(d, G))
+        comb_q = Comb(q, 4)
+        digest = hashlib.sha256(rng(64)).digest()
+        r, s = sign_digest(digest, d, int.from_bytes(rng(32), "big") % (N - 1) + 1)
+        results = (verify_digest(digest, (r, s), q), verify_digest(digest, (r, s), q, comb),
+                   verify_digest(digest, (r, s), q, comb, comb_q))
+        rejects = (verify_digest(digest, (r, (s + 1) % N), q, comb, comb_q),
+                   verify_digest(bytes([digest[0] ^ 1]) + digest[1:], (r, s), q),
+                   verify_digest(digest, (0, s), q), verify_digest(digest, (r, s), (q[0], (q[1] + 1) % P)))
+        if not all(results) or any(rejects):
+            errors += 1
+    print("sign / verify           : %u signatures, %u errors" % (args.count, errors))
+    failures += errors
+
+    if args.keys:
+        for name, key in load_keys(args.keys):
+            valid = on_curve(key)
+            print("%-24s: %s" % (name, "on curve" if valid else "NOT on curve"))
+            failures += 0 if valid else 1
+    return 0 if failures == 0 else 1
+
+
+def cmd_bench(args):
+    d = int.from_bytes(os.urandom(32), "big") % (N - 1) + 1
+    q = affine(scalar_mult(d, G))
+    digest = hashlib.sha256(b"SBSFU").digest()
+    signature = sign_digest(digest, d, int.from_bytes(os.urandom(32), "big") % (N - 1) + 1)
+    comb_g = Comb(G, args.comb_width)
+    comb_q = Comb(q, args.comb_width)
+    print("u1.G + u2.Q, field multiplications (squares included) :")
+    for label, tables in (("double-and-add (Shamir)", (None, None)), ("comb G", (comb_g, None)),
+                          ("comb G + comb Q", (comb_g, comb_q))):
+        Field.mul_count = 0
+        if not verify_digest(digest, signature, q, *tables):
+            raise EcdsaError("reference verification failed")
+        flash = sum(table.flash_size() for table in tables if table is not None)
+        print("  %-24s : %6u, %6u bytes of tables" % (label, Field.mul_count, flash))
+    print("HAL_PKA_ECDSAVerif takes the whole verification as one PKA operation : the tables cannot be loaded in the")
+    print("PKA, a comb only speeds up a software (mbedtls) verification.")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SBSFU ECDSA P-256 host reference")
+    commands = parser.add_subparsers(dest="command")
+    cmd = commands.add_parser("verify", help="verify the signature of an MCUboot image")
+    cmd.add_argument("image", help="signed image, e.g. tfm_s_app_sign.bin")
+    cmd.add_argument("--key", action="append", required=True, help="keys.c, or PEM public / private key")
+    cmd = commands.add_parser("selftest", help="cross-check the reference implementations")
+    cmd.add_argument("--keys", help="keys.c or PEM file whose keys are checked on the curve")
+    cmd.add_argument("--count", type=int, default=20, help="number of random vectors, default 20")
+    cmd = commands.add_parser("bench", help="count the field multiplications of a verification")
+    cmd.add_argument("--comb-width", type=int, default=4, help="comb width, default 4")
+    args = parser.parse_args()
+    if args.command is None:
+        parser.error("a command is required")
+
+    try:
+        return {"verify": cmd_verify, "selftest": cmd_selftest, "bench": cmd_bench}[args.command](args)
+    except (OSError, ValueError, IndexError, struct.error, EcdsaError) as error:
+        print("error : %s" % error, file=sys.stderr)
+        return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
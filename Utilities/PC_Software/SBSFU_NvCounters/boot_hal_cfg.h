@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    boot_hal_cfg.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the SBSFU_Boot configuration used by
+  *          bl2_nv_services.c : MCUBOOT_IMAGE_NUMBER is set by the Makefile
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef BOOT_HAL_CFG_H
+#define BOOT_HAL_CFG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef MCUBOOT_IMAGE_NUMBER
+#define MCUBOOT_IMAGE_NUMBER          4
+#endif /* MCUBOOT_IMAGE_NUMBER */
+
+#endif /* BOOT_HAL_CFG_H */
@@ -0,0 +1,23 @@
+/**
+  ******************************************************************************
+  * @file    boot_status.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the bootutil header included by
+  *          bl2_nv_services.c, nothing is used
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef BOOT_STATUS_H
+#define BOOT_STATUS_H
+
+#endif /* BOOT_STATUS_H */
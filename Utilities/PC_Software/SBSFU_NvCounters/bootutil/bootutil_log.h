@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * @file    bootutil_log.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the bootutil log macros used by
+  *          bl2_nv_services.c : the messages are not printed
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef BOOTUTIL_LOG_H
+#define BOOTUTIL_LOG_H
+
+#define BOOT_LOG_ERR(...)             do {} while (0)
+#define BOOT_LOG_INF(...)             do {} while (0)
+
+#endif /* BOOTUTIL_LOG_H */
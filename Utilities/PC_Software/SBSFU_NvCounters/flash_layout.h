@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * @file    flash_layout.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the flash layout used by bl2_nv_services.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef FLASH_LAYOUT_H
+#define FLASH_LAYOUT_H
+
+#define FLASH_DEV_NAME                Driver_FLASH0
+#define BL2_NV_COUNTERS_AREA_ADDR     (0x00010000U)
+#define BL2_NV_COUNTERS_AREA_SIZE     (0x2000U)
+
+#endif /* FLASH_LAYOUT_H */
@@ -0,0 +1,565 @@
+/**
+  ******************************************************************************
+  * @file    nvcnt_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the SBSFU_Boot NV counters (bl2_nv_services.c) with a
+  *          flash stub : counter updates, power down at each programmed
+  *          quad-word, tampered NV area and full NV area
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "boot_hal_cfg.h"
+#include "platform/include/plat_nv_counters.h"
+#include "bl2_nv_services.h"
+#include "Driver_Flash.h"
+#include "flash_layout.h"
+#include "stm32u5xx_ll_crc.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_QUAD_WORD          16U
+#define TEST_QUAD_WORDS         (BL2_NV_COUNTERS_AREA_SIZE / TEST_QUAD_WORD)
+#define TEST_NB_COUNTERS        NVCNT_MAX_BATCH
+#define TEST_HISTORY_MAX        20U          /* single updates before an interrupted batch */
+#define TEST_RUNS               8U           /* runs of each tear mode, batch size and interrupted element */
+#define TEST_NO_CUT             0xFFFFFFFFU
+
+/* Private typedef -----------------------------------------------------------*/
+/* Content of the quad-word whose programming is interrupted */
+typedef enum
+{
+  TEST_TEAR_ERASED = 0,                      /* left erased */
+  TEST_TEAR_RANDOM,                          /* random data, wrong CRC */
+  TEST_TEAR_ECC,                             /* double ECC error : read as zero by Flash_ReadData */
+  TEST_TEAR_NB
+} test_tear_t;
+
+/* Private variables ---------------------------------------------------------*/
+CRC_TypeDef host_crc;
+
+static const char *const test_tear_name[TEST_TEAR_NB] = {"erased", "random", "ecc"};
+static uint8_t test_flash[BL2_NV_COUNTERS_AREA_SIZE];
+static uint8_t test_ecc[TEST_QUAD_WORDS];    /* quad-words with a double ECC error */
+static uint32_t test_reads;
+static uint32_t test_violations;             /* programming out of the area, unaligned or on programmed bytes */
+static uint32_t test_cut = TEST_NO_CUT;      /* quad-words programmed before the power down */
+static test_tear_t test_tear;
+static uint32_t test_failures;
+static uint32_t test_seed = 1U;
+
+/* Private functions ---------------------------------------------------------*/
+static int32_t test_read_data(uint32_t addr, void *data, uint32_t cnt)
+{
+  uint32_t offset = addr - BL2_NV_COUNTERS_AREA_ADDR;
+  uint32_t i;
+
+  test_reads++;
+  if ((addr < BL2_NV_COUNTERS_AREA_ADDR) || (offset > BL2_NV_COUNTERS_AREA_SIZE)
+      || (cnt > (BL2_NV_COUNTERS_AREA_SIZE - offset)))
+  {
+    return ARM_DRIVER_ERROR;
+  }
+  memcpy(data, &test_flash[offset], cnt);
+  /* as Flash_ReadData, OK with data = 0 on a double ECC error */
+  for (i = offset / TEST_QUAD_WORD; i < ((offset + cnt + TEST_QUAD_WORD - 1U) / TEST_QUAD_WORD); i++)
+  {
+    if (test_ecc[i] != 0U)
+    {
+      memset(data, 0, cnt);
+    }
+  }
+  return ARM_DRIVER_OK;
+}
+
+static uint32_t test_random(void)
+{
+  test_seed = (test_seed * 1103515245U) + 12345U;
+  return test_seed >> 8;
+}
+
+static int32_t test_program_data(uint32_t addr, const void *data, uint32_t cnt)
+{
+  uint32_t offset = addr - BL2_NV_COUNTERS_AREA_ADDR;
+  uint32_t i;
+  uint32_t j;
+
+  if ((addr < BL2_NV_COUNTERS_AREA_ADDR) || (offset > BL2_NV_COUNTERS_AREA_SIZE)
+      || (cnt > (BL2_NV_COUNTERS_AREA_SIZE - offset)) || ((offset % TEST_QUAD_WORD) != 0U)
+      || ((cnt % TEST_QUAD_WORD) != 0U))
+  {
+    test_violations++;
+    return ARM_DRIVER_ERROR;
+  }
+  for (i = 0U; i < cnt; i += TEST_QUAD_WORD)
+  {
+    for (j = 0U; j < TEST_QUAD_WORD; j++)
+    {
+      if (test_flash[offset + i + j] != 0xFFU)
+      {
+        test_violations++;
+        return ARM_DRIVER_ERROR;
+      }
+    }
+    if (test_cut == 0U)
+    {
+      /* power down during the programming of this quad-word */
+      test_cut = TEST_NO_CUT;
+      for (j = 0U; (test_tear != TEST_TEAR_ERASED) && (j < TEST_QUAD_WORD); j++)
+      {
+        test_flash[offset + i + j] = (uint8_t)(1U + (test_random() % 254U));
+      }
+      test_ecc[(offset + i) / TEST_QUAD_WORD] = (test_tear == TEST_TEAR_ECC) ? 1U : 0U;
+      return ARM_DRIVER_ERROR;
+    }
+    if (test_cut != TEST_NO_CUT)
+    {
+      test_cut--;
+    }
+    memcpy(&test_flash[offset + i], (const uint8_t *)data + i, TEST_QUAD_WORD);
+  }
+  return ARM_DRIVER_OK;
+}
+
+ARM_DRIVER_FLASH Driver_FLASH0 = {test_read_data, test_program_data};
+
+void HAL_Delay(uint32_t Delay)
+{
+  (void)Delay;
+}
+
+static void test_fail(const char *name, const char *detail, uint32_t value)
+{
+  if (test_failures < 20U)
+  {
+    printf("  %s : %s %u (%u programming violations)\n", name, detail, value, test_violations);
+  }
+  test_failures++;
+}
+
+static void test_erase(void)
+{
+  memset(test_flash, 0xFF, sizeof(test_flash));
+  memset(test_ecc, 0, sizeof(test_ecc));
+  test_cut = TEST_NO_CUT;
+}
+
+/**
+  * @brief  Read all the counters, false if one is missing
+  */
+static bool test_read_all(uint32_t *p_value)
+{
+  uint32_t i;
+
+  for (i = 0U; i < TEST_NB_COUNTERS; i++)
+  {
+    if (plat_read_nv_counter((enum nv_counter_t)(PLAT_NV_COUNTER_3 + i), sizeof(p_value[i]),
+                             (uint8_t *)&p_value[i]) != HAL_OK)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+  * @brief  Restart : initialization, then comparison of the counters with the expected values
+  */
+static bool test_restart_check(const uint32_t *p_expected)
+{
+  uint32_t value[TEST_NB_COUNTERS];
+
+  return (plat_init_nv_counter() == HAL_OK) && test_read_all(value)
+         && (memcmp(value, p_expected, sizeof(value)) == 0);
+}
+
+/**
+  * @brief  Offset of the last programmed quad-word of the NV area
+  */
+static uint32_t test_last_programmed(void)
+{
+  uint32_t offset = BL2_NV_COUNTERS_AREA_SIZE;
+  uint32_t j;
+
+  while (offset > 0U)
+  {
+    offset -= TEST_QUAD_WORD;
+    for (j = 0U; j < TEST_QUAD_WORD; j++)
+    {
+      if (test_flash[offset + j] != 0xFFU)
+      {
+        return offset;
+      }
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Counter element as written by bl2_nv_services.c
+  */
+static void test_element(uint16_t id, uint32_t data, uint8_t *p_quad_word)
+{
+  uint64_t value;
+
+  LL_CRC_ResetCRCCalculationUnit(CRC);
+  LL_CRC_SetPolynomialCoef(CRC, 0x8005U);
+  LL_CRC_FeedData32(CRC, data);
+  LL_CRC_FeedData16(CRC, id);
+  value = ((uint64_t)data << 32) | ((uint64_t)LL_CRC_ReadData16(CRC) << 16) | id;
+  memcpy(p_quad_word, &value, sizeof(value));
+  memcpy(&p_quad_word[sizeof(value)], &value, sizeof(value));
+}
+
+/**
+  * @brief  Counter updates without power down
+  */
+static void test_updates(void)
+{
+  enum nv_counter_t ids[TEST_NB_COUNTERS];
+  uint32_t data[TEST_NB_COUNTERS];
+  uint32_t expected[TEST_NB_COUNTERS] = {0U};
+  uint32_t value[TEST_NB_COUNTERS];
+  uint32_t updated = 1U;
+  uint32_t i;
+
+  test_erase();
+  if (!test_restart_check(expected) || (test_last_programmed() != (TEST_NB_COUNTERS * TEST_QUAD_WORD)))
+  {
+    test_fail("updates", "first boot initialization, counters", TEST_NB_COUNTERS);
+  }
+  if (!test_restart_check(expected))
+  {
+    test_fail("updates", "second initialization, counters", TEST_NB_COUNTERS);
+  }
+
+  /* single update, unchanged value, decrease */
+  if ((plat_set_nv_counter(PLAT_NV_COUNTER_3, 5U, &updated) != HAL_OK) || (updated != 0U))
+  {
+    test_fail("updates", "single update of counter", PLAT_NV_COUNTER_3);
+  }
+  expected[0] = 5U;
+  i = test_last_programmed();
+  if ((plat_set_nv_counter(PLAT_NV_COUNTER_3, 5U, &updated) != HAL_OK) || (test_last_programmed() != i))
+  {
+    test_fail("updates", "unchanged value written, counter", PLAT_NV_COUNTER_3);
+  }
+  if (plat_set_nv_counter(PLAT_NV_COUNTER_3, 4U, &updated) != HAL_ERROR)
+  {
+    test_fail("updates", "decrease accepted, counter", PLAT_NV_COUNTER_3);
+  }
+
+  /* batch update of all the counters, read without flash access */
+  for (i = 0U; i < TEST_NB_COUNTERS; i++)
+  {
+    ids[i] = (enum nv_counter_t)(PLAT_NV_COUNTER_3 + TEST_NB_COUNTERS - 1U - i);
+    data[i] = 10U + i;
+    expected[TEST_NB_COUNTERS - 1U - i] = data[i];
+  }
+  if (plat_set_nv_counters(ids, data, TEST_NB_COUNTERS, &updated) != HAL_OK)
+  {
+    test_fail("updates", "batch update, counters", TEST_NB_COUNTERS);
+  }
+  test_reads = 0U;
+  if (!test_read_all(value) || (memcmp(value, expected, sizeof(value)) != 0) || (test_reads != 0U))
+  {
+    test_fail("updates", "read after a batch update, flash reads", test_reads);
+  }
+  if (!test_restart_check(expected))
+  {
+    test_fail("updates", "batch update after restart, counters", TEST_NB_COUNTERS);
+  }
+
+  /* rejected batches : counter present twice, too many counters */
+  i = test_last_programmed();
+  if (TEST_NB_COUNTERS >= 2U)
+  {
+    ids[1] = ids[0];
+    data[0] = 100U;
+    data[1] = 101U;
+    if ((plat_set_nv_counters(ids, data, 2U, &updated) != HAL_ERROR) || (test_last_programmed() != i))
+    {
+      test_fail("updates", "counter present twice in a batch accepted, counter", ids[0]);
+    }
+  }
+  if (plat_set_nv_counters(ids, data, TEST_NB_COUNTERS + 1U, &updated) != HAL_ERROR)
+  {
+    test_fail("updates", "batch of too many counters accepted, counters", TEST_NB_COUNTERS + 1U);
+  }
+  if (!test_restart_check(expected) || (test_violations != 0U))
+  {
+    test_fail("updates", "rejected batch written, counters", TEST_NB_COUNTERS);
+  }
+  printf("  updates   : single, unchanged, decrease, batch, counter twice in a batch\n");
+}
+
+/**
+  * @brief  Batch update interrupted at each quad-word, restart, then update redone : a second power down may
+  *         interrupt the redone update
+  */
+static void test_power_down(void)
+{
+  enum nv_counter_t ids[TEST_NB_COUNTERS];
+  uint32_t data[TEST_NB_COUNTERS];
+  uint32_t expected[TEST_NB_COUNTERS];
+  uint32_t written[TEST_NB_COUNTERS];        /* batch elements : index in ids of the counters to update */
+  uint32_t nb_written;
+  uint32_t ack;                              /* acknowledge element programmed before the counters */
+  uint32_t zeroed;                           /* zeroed element ending the log */
+  uint32_t updated;
+  uint32_t count = 0U;
+  uint32_t tear;
+  uint32_t size;
+  uint32_t cut;
+  uint32_t run;
+  uint32_t step;
+  uint32_t i;
+  uint32_t j;
+
+  for (tear = 0U; tear < TEST_TEAR_NB; tear++)
+  {
+    for (size = 1U; size <= TEST_NB_COUNTERS; size++)
+    {
+      for (cut = 0U; cut <= size; cut++)
+      {
+        for (run = 0U; run < TEST_RUNS; run++)
+        {
+          test_erase();
+          zeroed = 0U;
+          if ((plat_init_nv_counter() != HAL_OK) || !test_read_all(expected))
+          {
+            test_fail("power down", "initialization, tear mode", tear);
+            continue;
+          }
+          /* history : single updates */
+          for (step = test_random() % TEST_HISTORY_MAX; step > 0U; step--)
+          {
+            i = test_random() % TEST_NB_COUNTERS;
+            expected[i] += 1U + (test_random() % 3U);
+            (void)plat_set_nv_counter((enum nv_counter_t)(PLAT_NV_COUNTER_3 + i), expected[i], &updated);
+          }
+          /* interrupted batch, then redone batches with a random power down until one completes */
+          for (j = 0U; j < TEST_NB_COUNTERS; j++)
+          {
+            ids[j] = (enum nv_counter_t)(PLAT_NV_COUNTER_3 + j);
+          }
+          for (j = 0U; j < size; j++)
+          {
+            i = j + (test_random() % (TEST_NB_COUNTERS - j));
+            step = ids[j];
+            ids[j] = ids[i];
+            ids[i] = (enum nv_counter_t)step;
+            data[j] = expected[ids[j] - PLAT_NV_COUNTER_3] + 1U + (test_random() % 4U);
+          }
+          test_tear = (test_tear_t)tear;
+          test_cut = cut;
+          for (step = 0U; step < 4U; step++)
+          {
+            ack = (zeroed != 0U) ? 1U : 0U;
+            for (j = 0U, nb_written = 0U; j < size; j++)
+            {
+              if (expected[ids[j] - PLAT_NV_COUNTER_3] != data[j])
+              {
+                written[nb_written] = j;
+                nb_written++;
+              }
+            }
+            if (test_cut == TEST_NO_CUT)
+            {
+              if (plat_set_nv_counters(ids, data, size, &updated) != HAL_OK)
+              {
+                test_fail("power down", "update redone, batch size", size);
+              }
+              for (j = 0U; j < size; j++)
+              {
+                expected[ids[j] - PLAT_NV_COUNTER_3] = data[j];
+              }
+              break;
+            }
+            /* the counters programmed before the interrupted quad-word have their new value */
+            j = test_cut;
+            if ((plat_set_nv_counters(ids, data, size, &updated) == HAL_OK) || (nb_written == 0U))
+            {
+              /* power down after the batch */
+              j = nb_written + ack;
+            }
+            test_cut = TEST_NO_CUT;
+            for (i = ack; (i < j) && (i < (nb_written + ack)); i++)
+            {
+              expected[ids[written[i - ack]] - PLAT_NV_COUNTER_3] = data[written[i - ack]];
+            }
+            if (j >= (nb_written + ack))
+            {
+              zeroed = 0U;
+            }
+            else if (j >= ack)
+            {
+              zeroed = (tear == TEST_TEAR_ECC) ? 1U : 0U;
+            }
+            else
+            {
+              /* acknowledge element interrupted : the zeroed element is still to be acknowledged */
+            }
+            if (!test_restart_check(expected))
+            {
+              test_fail("power down, restart", test_tear_name[tear], size);
+              break;
+            }
+            /* the next update may be interrupted too, the acknowledge element included */
+            test_cut = ((test_random() % 2U) == 0U) ? (test_random() % (size + 1U)) : TEST_NO_CUT;
+          }
+          if (!test_restart_check(expected) || (test_violations != 0U))
+          {
+            test_fail("power down, update redone", test_tear_name[tear], size);
+          }
+          count++;
+        }
+      }
+    }
+  }
+  printf("  power     : %u batch updates of 1 to %u counters interrupted at each quad-word, erased, random and "
+         "double ECC error quad-word\n", count, TEST_NB_COUNTERS);
+}
+
+/**
+  * @brief  Zeroed or forged elements followed by valid elements are rejected
+  */
+static void test_tamper(void)
+{
+  uint32_t expected[TEST_NB_COUNTERS] = {0U};
+  uint32_t updated;
+  uint32_t offset;
+  uint32_t last;
+  uint32_t i;
+
+  /* a zeroed element ending the log is an interrupted programming : previous value */
+  test_erase();
+  (void)plat_init_nv_counter();
+  for (i = 1U; i <= 3U; i++)
+  {
+    (void)plat_set_nv_counter(PLAT_NV_COUNTER_3, i, &updated);
+  }
+  last = test_last_programmed();
+  memset(&test_flash[last], 0, TEST_QUAD_WORD);
+  expected[0] = 2U;
+  if (!test_restart_check(expected))
+  {
+    test_fail("tamper", "zeroed last element rejected, offset", last);
+  }
+
+  /* a zeroed element followed by a counter element : tampered area */
+  for (offset = TEST_QUAD_WORD; offset < last; offset += TEST_QUAD_WORD)
+  {
+    test_erase();
+    (void)plat_init_nv_counter();
+    for (i = 1U; i <= 3U; i++)
+    {
+      (void)plat_set_nv_counter(PLAT_NV_COUNTER_3, i, &updated);
+    }
+    memset(&test_flash[offset], 0, TEST_QUAD_WORD);
+    if (plat_init_nv_counter() != HAL_ERROR)
+    {
+      test_fail("tamper", "zeroed element accepted, offset", offset);
+    }
+  }
+
+  /* acknowledge element of another offset, or without zeroed element */
+  for (i = 0U; i < 3U; i++)
+  {
+    test_erase();
+    (void)plat_init_nv_counter();
+    offset = test_last_programmed() + TEST_QUAD_WORD;
+    if (i < 2U)
+    {
+      memset(&test_flash[offset], 0, TEST_QUAD_WORD);
+      offset += TEST_QUAD_WORD;
+    }
+    test_element(0x544EU, (i == 0U) ? (offset - TEST_QUAD_WORD) : (offset - (2U * TEST_QUAD_WORD)),
+                 &test_flash[offset]);
+    if ((plat_init_nv_counter() == HAL_OK) != (i == 0U))
+    {
+      test_fail("tamper", "acknowledge element, case", i);
+    }
+  }
+
+  /* counter history not increasing */
+  test_erase();
+  (void)plat_init_nv_counter();
+  test_element(PLAT_NV_COUNTER_3, 0U, &test_flash[test_last_programmed() + TEST_QUAD_WORD]);
+  if (plat_init_nv_counter() != HAL_ERROR)
+  {
+    test_fail("tamper", "history not increasing accepted, counter", PLAT_NV_COUNTER_3);
+  }
+  printf("  tamper    : zeroed elements, acknowledge elements, counter history\n");
+}
+
+/**
+  * @brief  Updates until the NV area is full, with an acknowledge element to write
+  */
+static void test_full(void)
+{
+  uint32_t expected[TEST_NB_COUNTERS] = {0U};
+  uint32_t updated;
+  uint32_t count = 0U;
+
+  test_erase();
+  (void)plat_init_nv_counter();
+  while (plat_set_nv_counter(PLAT_NV_COUNTER_3, expected[0] + 1U, &updated) == HAL_OK)
+  {
+    expected[0]++;
+    count++;
+    if (count == (TEST_QUAD_WORDS / 2U))
+    {
+      /* power down on a double ECC error quad-word */
+      test_tear = TEST_TEAR_ECC;
+      test_cut = 0U;
+      (void)plat_set_nv_counter(PLAT_NV_COUNTER_3, expected[0] + 1U, &updated);
+      if (!test_restart_check(expected))
+      {
+        test_fail("full", "restart after power down, counter", expected[0]);
+      }
+    }
+  }
+  /* header, initial values, acknowledge and interrupted elements */
+  if ((count != (TEST_QUAD_WORDS - 1U - TEST_NB_COUNTERS - 2U)) || !test_restart_check(expected)
+      || (test_violations != 0U))
+  {
+    test_fail("full", "updates before the area is full", count);
+  }
+  printf("  full      : %u updates\n", count);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1)
+  {
+    test_seed = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+
+  printf("bl2_nv_services.c : %u counters, NV area of %u bytes\n", TEST_NB_COUNTERS, BL2_NV_COUNTERS_AREA_SIZE);
+  test_updates();
+  test_power_down();
+  test_tamper();
+  test_full();
+
+  if (test_failures != 0U)
+  {
+    printf("FAILED : %u checks\n", test_failures);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
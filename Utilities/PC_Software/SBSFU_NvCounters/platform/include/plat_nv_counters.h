@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file    plat_nv_counters.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the platform NV counters interface : the BL2
+  *          counters follow the TF-M counters, one per image
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef PLAT_NV_COUNTERS_H
+#define PLAT_NV_COUNTERS_H
+
+#include <stdint.h>
+#include "stm32u5xx_hal.h"
+
+enum nv_counter_t
+{
+  PLAT_NV_COUNTER_0 = 0,
+  PLAT_NV_COUNTER_1,
+  PLAT_NV_COUNTER_2,
+  PLAT_NV_COUNTER_3,
+  PLAT_NV_COUNTER_4,
+  PLAT_NV_COUNTER_5,
+  PLAT_NV_COUNTER_6,
+  PLAT_NV_COUNTER_MAX = PLAT_NV_COUNTER_3 + MCUBOOT_IMAGE_NUMBER
+};
+
+HAL_StatusTypeDef plat_init_nv_counter(void);
+HAL_StatusTypeDef plat_read_nv_counter(enum nv_counter_t CounterId, uint32_t size, uint8_t *val);
+HAL_StatusTypeDef plat_set_nv_counter(enum nv_counter_t CounterId, uint32_t Data, uint32_t *Updated);
+
+#endif /* PLAT_NV_COUNTERS_H */
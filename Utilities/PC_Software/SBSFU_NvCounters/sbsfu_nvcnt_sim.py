@@ -0,0 +1,405 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    sbsfu_nvcnt_sim.py
+#  @author  MCD Application Team
+#  @brief   Flash model of the SBSFU_Boot NV counters area : power down tests and access latency
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+Model of the NV counters area of SBSFU_Boot/Src/bl2_nv_services.c : a header element followed by a log of counter
+elements, one flash quad-word (16 bytes) each : counter id (16 bits), CRC-16 (16 bits), value (32 bits), then a copy.
+
+Two implementations are modelled, counting the flash accesses :
+ - scan  : counter read scanning the whole area from its end (previous implementation),
+ - index : RAM index built at initialization, counter read without flash access, several counters written in one
+           program operation (plat_set_nv_counters).
+
+A zeroed element (value read on a double ECC error) is skipped when no valid element follows it, the next write
+appending first an acknowledge element holding its offset; a zeroed element followed by another valid element is a
+tampered area.
+
+The powerfail command interrupts a batch update at each programmed quad-word, with the interrupted quad-word erased,
+holding random data or reading as a double ECC error (zero), then restarts and checks the counters : a rejected NV
+area is a failure. It also checks that a zeroed element followed by a counter element is rejected.
+
+Usage: python sbsfu_nvcnt_sim.py powerfail [--counters N] [--seed SEED]
+       python sbsfu_nvcnt_sim.py latency [--counters N] [--read-ns NS] [--program-us US] [--call-us US]
+"""
+
+import argparse
+import random
+import struct
+import sys
+
+AREA_SIZE = 0x2000
+ELEMENT_SIZE = 16
+HEADER_SIZE = ELEMENT_SIZE
+MAX_ELEMENTS = (AREA_SIZE - HEADER_SIZE) // ELEMENT_SIZE
+ERASED = 0xFFFFFFFFFFFFFFFF
+HEADER_ID = 0x4855
+HEADER_VALUE = 0xaaddeecc
+TORN_ID = 0x544E            # acknowledge of zeroed elements, data : offset of the first one
+FIRST_ID = 3                # PLAT_NV_COUNTER_3
+
+
+class PowerDown(Exception):
+    pass
+
+
+class NvError(Exception):
+    pass
+
+
+def crc16(data, counter_id):
+    """CRC unit configured by ConfigureCrc : polynomial 0x8005, 16 bits, 32-bit data then 16-bit id."""
+    crc = 0xFFFF
+    for value, bits in ((data, 32), (counter_id, 16)):
+        for i in range(bits - 1, -1, -1):
+            bit = ((crc >> 15) ^ (value >> i)) & 1
+            crc = (crc << 1) & 0xFFFF
+            if bit:
+                crc ^= 0x8005
+    return crc
+
+
+def element(counter_id, data):
+    value = (data << 32) | (crc16(data, counter_id) << 16) | counter_id
+    return struct.pack("<QQ", value, value)
+
+
+class Flash:
+    """NV area, quad-word programming, optional power down after a number of programmed quad-words."""
+
+    def __init__(self):
+        self.data = bytearray(b"\xff" * AREA_SIZE)
+        self.ecc = set()
+        self.reads = 0
+        self.programs = 0
+        self.calls = 0
+        self.cut = None
+        self.tear = "erased"
+        self.rng = random.Random(0)
+
+    def read(self, offset):
+        """One quad-word, as Flash_ReadData : zero on double ECC error."""
+        self.reads += 1
+        if offset in self.ecc:
+            return 0, 0
+        return struct.unpack_from("<QQ", self.data, offset)
+
+    def program(self, offset, payload):
+        self.calls += 1
+        for i in range(0, len(payload), ELEMENT_SIZE):
+            if self.data[offset + i:offset + i + ELEMENT_SIZE] != b"\xff" * ELEMENT_SIZE:
+                raise NvError("programming of a non erased quad-word at 0x%x" % (offset + i))
+            if self.cut == 0:
+                if self.tear == "random":
+                    self.data[offset + i:offset + i + ELEMENT_SIZE] = bytes(self.rng.randrange(1, 255)
+                                                                            for _ in range(ELEMENT_SIZE))
+                elif self.tear == "ecc":
+                    self.data[offset + i:offset + i + ELEMENT_SIZE] = b"\x00" * ELEMENT_SIZE
+                    self.ecc.add(offset + i)
+                raise PowerDown()
+            if self.cut is not None:
+                self.cut -= 1
+            self.data[offset + i:offset + i + ELEMENT_SIZE] = payload[i:i + ELEMENT_SIZE]
+            self.programs += 1
+
+    def counters(self):
+        reads, programs, calls = self.reads, self.programs, self.calls
+        self.reads = self.programs = self.calls = 0
+        return reads, programs, calls
+
+
+def decode(value, counters):
+    """(id, data) of a valid counter or acknowledge element, None if skipped; NvError on a zeroed element."""
+    if value == 0:
+        raise NvError("zeroed element")
+    counter_id = value & 0xFFFF
+    data = value >> 32
+    if (not FIRST_ID <= counter_id < FIRST_ID + counters and counter_id != TORN_ID) \
+            or crc16(data, counter_id) != (value >> 16) & 0xFFFF:
+        return None
+    return counter_id, data
+
+
+class NvCounters:
+    """Common part : format, header, log append."""
+
+    def __init__(self, flash, counters):
+        self.flash = flash
+        self.counters = counters
+        self.next_write = HEADER_SIZE
+        self.nb_written = 0
+        self.torn = None
+
+    def format(self):
+        self.flash.program(0, element(HEADER_ID, HEADER_VALUE))
+        self.next_write, self.nb_written, self.torn = HEADER_SIZE, 0, None
+        self.write([(FIRST_ID + i, 0) for i in range(self.counters)])
+
+    def check_header(self):
+        value, _ = self.flash.read(0)
+        if value == ERASED:
+            # First boot : whole area erased
+            for offset in range(0, AREA_SIZE, ELEMENT_SIZE):
+                if self.flash.read(offset)[0] != ERASED:
+                    raise NvError("header missing")
+            self.format()
+            value, _ = self.flash.read(0)
+        if value != struct.unpack("<Q", element(HEADER_ID, HEADER_VALUE)[:8])[0]:
+            raise NvError("wrong header")
+
+    def write(self, updates):
+        if self.torn is not None:
+            # acknowledge of the zeroed elements ending the log, in the same program operation
+            updates = [(TORN_ID, self.torn)] + list(updates)
+        if self.nb_written + len(updates) > MAX_ELEMENTS:
+            raise NvError("area full")
+        self.flash.program(self.next_write, b"".join(element(i, d) for i, d in updates))
+        self.next_write += len(updates) * ELEMENT_SIZE
+        self.nb_written += len(updates)
+        self.torn = None
+
+
+class ScanNvCounters(NvCounters):
+    """Previous implementation : each read scans the area from its end, one counter per program operation."""
+
+    def init(self):
+        # VerifyPageFullyErased walked the whole area at each initialization
+        for offset in range(0, AREA_SIZE, ELEMENT_SIZE):
+            self.flash.read(offset)
+        self.check_header()
+        for counter_id in range(FIRST_ID, FIRST_ID + self.counters):
+            self.read(counter_id)
+        self.next_write, self.nb_written = HEADER_SIZE, 0
+        for offset in range(HEADER_SIZE, AREA_SIZE, ELEMENT_SIZE):
+            first, second = self.flash.read(offset)
+            if first == ERASED or second == ERASED:
+                break
+            self.next_write += ELEMENT_SIZE
+            self.nb_written += 1
+
+    def read(self, counter_id):
+        found = None
+        for offset in range(AREA_SIZE - ELEMENT_SIZE, HEADER_SIZE - 1, -ELEMENT_SIZE):
+            value, _ = self.flash.read(offset)
+            if value == ERASED:
+                continue
+            entry = decode(value, self.counters)
+            if entry is None or entry[0] != counter_id:
+                continue
+            if found is None:
+                found = entry[1]
+                previous = found
+            elif entry[1] >= previous:
+                raise NvError("counter %u history not increasing" % counter_id)
+            else:
+                previous = entry[1]
+        if found is None:
+            raise NvError("counter %u not found" % counter_id)
+        return found
+
+    def set(self, updates):
+        for counter_id, data in updates:
+            current = self.read(counter_id)
+            if data < current:
+                raise NvError("counter %u decrease" % counter_id)
+            if data != current:
+                self.write([(counter_id, data)])
+
+
+class IndexNvCounters(NvCounters):
+    """RAM index built once, batched updates."""
+
+    def init(self):
+        self.check_header()
+        self.index = {}
+        self.next_write, self.nb_written, self.torn = HEADER_SIZE, 0, None
+        for offset in range(HEADER_SIZE, AREA_SIZE, ELEMENT_SIZE):
+            first, second = self.flash.read(offset)
+            if first == ERASED and second == ERASED:
+                break
+            self.next_write += ELEMENT_SIZE
+            self.nb_written += 1
+            if first == 0:
+                # interrupted programming if no valid element follows, checked by the next valid element
+                if self.torn is None:
+                    self.torn = offset
+                continue
+            entry = decode(first, self.counters)
+            if entry is None:
+                continue
+            if self.torn is not None or entry[0] == TORN_ID:
+                if entry != (TORN_ID, self.torn):
+                    raise NvError("zeroed element at 0x%x not acknowledged" % (self.torn or 0))
+                self.torn = None
+                continue
+            if entry[0] in self.index and entry[1] <= self.index[entry[0]]:
+                raise NvError("counter %u history not increasing" % entry[0])
+            self.index[entry[0]] = entry[1]
+
+    def read(self, counter_id):
+        if counter_id not in self.index:
+            raise NvError("counter %u not found" % counter_id)
+        return self.index[counter_id]
+
+    def set(self, updates):
+        if len(set(i for i, _ in updates)) != len(updates):
+            raise NvError("counter written twice in a batch")
+        pending = []
+        for counter_id, data in updates:
+            current = self.read(counter_id)
+            if data < current:
+                raise NvError("counter %u decrease" % counter_id)
+            if data != current:
+                pending.append((counter_id, data))
+        if pending:
+            self.write(pending)
+            self.index.update(pending)
+
+
+def powerfail(args):
+    rng = random.Random(args.seed)
+    results = {}
+    failures = 0
+    for tear in ("erased", "random", "ecc"):
+        for size in range(1, args.counters + 1):
+            for cut in range(size):
+                flash = Flash()
+                flash.tear = tear
+                flash.rng = rng
+                nv = IndexNvCounters(flash, args.counters)
+                nv.init()
+                # some history before the interrupted update
+                for step in range(rng.randrange(0, 20)):
+                    counter_id = FIRST_ID + rng.randrange(args.counters)
+                    nv.set([(counter_id, nv.read(counter_id) + 1)])
+                before = {i: nv.read(i) for i in range(FIRST_ID, FIRST_ID + args.counters)}
+                ids = rng.sample(range(FIRST_ID, FIRST_ID + args.counters), size)
+                updates = [(i, before[i] + rng.randrange(1, 5)) for i in ids]
+                flash.cut = cut
+                try:
+                    nv.set(updates)
+                    raise NvError("power down not reached")
+                except PowerDown:
+                    pass
+                flash.cut = None
+                # restart
+                nv = IndexNvCounters(flash, args.counters)
+                try:
+                    nv.init()
+                except NvError as error:
+                    outcome = "FAILED : rejected (%s)" % error
+                    failures += 1
+                else:
+                    after = {i: nv.read(i) for i in before}
+                    expected = dict(before)
+                    expected.update(updates[:cut])
+                    if after != expected:
+                        outcome = "FAILED : counters %s, expected %s" % (after, expected)
+                        failures += 1
+                    else:
+                        # the update is redone, then checked again after a restart
+                        nv.set(updates)
+                        nv = IndexNvCounters(flash, args.counters)
+                        nv.init()
+                        expected.update(updates)
+                        if {i: nv.read(i) for i in before} != expected:
+                            outcome = "FAILED : update not applied after restart"
+                            failures += 1
+                        else:
+                            outcome = "previous or new value, update redone"
+                results.setdefault((tear, outcome), 0)
+                results[(tear, outcome)] += 1
+    print("Power down during a batch update of 1 to %u counters, at each programmed quad-word :" % args.counters)
+    for (tear, outcome), count in sorted(results.items()):
+        print("  interrupted quad-word %-7s : %3u cases, %s" % (tear, count, outcome))
+
+    # a zeroed element followed by a counter element is a tampered area
+    rejected = 0
+    for offset in range(HEADER_SIZE, HEADER_SIZE + 8 * ELEMENT_SIZE, ELEMENT_SIZE):
+        flash = Flash()
+        nv = IndexNvCounters(flash, args.counters)
+        nv.init()
+        for step in range(8):
+            nv.set([(FIRST_ID, step + 1)])
+        flash.data[offset:offset + ELEMENT_SIZE] = b"\x00" * ELEMENT_SIZE
+        try:
+            IndexNvCounters(flash, args.counters).init()
+        except NvError:
+            rejected += 1
+    print("Zeroed element followed by a counter element : %u/8 rejected" % rejected)
+    if rejected != 8:
+        failures += 1
+    return 1 if failures else 0
+
+
+def latency(args):
+    def cost(counts):
+        reads, programs, calls = counts
+        return reads * args.read_ns / 1000.0 + programs * args.program_us + calls * args.call_us
+
+    ids = list(range(FIRST_ID, FIRST_ID + args.counters))
+    print("%u counters, %u ns per quad-word read, %.0f us per quad-word program, %.0f us per program operation"
+          % (args.counters, args.read_ns, args.program_us, args.call_us))
+    print("  %-8s %-6s %12s %12s %16s %16s" % ("log fill", "", "init (us)", "read (us)", "update 1 (us)",
+                                               "update %u (us)" % args.counters))
+    for fill in (0, MAX_ELEMENTS // 4, MAX_ELEMENTS // 2, MAX_ELEMENTS - 2 * args.counters):
+        for name, cls in (("scan", ScanNvCounters), ("index", IndexNvCounters)):
+            flash = Flash()
+            nv = cls(flash, args.counters)
+            nv.init()
+            for step in range(max(0, fill - args.counters)):
+                counter_id = ids[step % len(ids)]
+                nv.set([(counter_id, nv.read(counter_id) + 1)])
+            flash.counters()
+            nv = cls(flash, args.counters)
+            nv.init()
+            init = cost(flash.counters())
+            nv.read(ids[0])
+            read = cost(flash.counters())
+            nv.set([(ids[0], nv.read(ids[0]) + 1)])
+            single = cost(flash.counters())
+            nv.set([(i, nv.read(i) + 1) for i in ids])
+            batch = cost(flash.counters())
+            print("  %-8s %-6s %12.1f %12.1f %16.1f %16.1f" % ("%u/%u" % (nv.nb_written, MAX_ELEMENTS), name,
+                                                               init, read, single, batch))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SBSFU NV counters area model")
+    commands = parser.add_subparsers(dest="command")
+    cmd = commands.add_parser("powerfail", help="interrupt batch updates at each quad-word and check the restart")
+    cmd.add_argument("--counters", type=int, default=4, help="number of counters (MCUBOOT_IMAGE_NUMBER), default 4")
+    cmd.add_argument("--seed", type=int, default=1, help="random seed, default 1")
+    cmd = commands.add_parser("latency", help="compare the counter access time of the two implementations")
+    cmd.add_argument("--counters", type=int, default=4, help="number of counters (MCUBOOT_IMAGE_NUMBER), default 4")
+    cmd.add_argument("--read-ns", type=float, default=100.0, help="read time of a quad-word, default 100 ns")
+    cmd.add_argument("--program-us", type=float, default=120.0, help="programming time of a quad-word, default 120")
+    cmd.add_argument("--call-us", type=float, default=10.0, help="overhead of a program operation, default 10")
+    args = parser.parse_args()
+    if args.command is None:
+        parser.error("a command is required")
+    if not 1 <= args.counters <= 4:
+        parser.error("--counters must be 1 to 4")
+
+    try:
+        return powerfail(args) if args.command == "powerfail" else latency(args)
+    except NvError as error:
+        print("error : %s" % error, file=sys.stderr)
+        return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,37 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the HAL definitions used by bl2_nv_services.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_HAL_H
+#define STM32U5xx_HAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+#define __IO                          volatile
+
+void HAL_Delay(uint32_t Delay);
+
+#endif /* STM32U5xx_HAL_H */
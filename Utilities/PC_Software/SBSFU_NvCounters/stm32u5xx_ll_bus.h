@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_ll_bus.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the LL bus functions used by bl2_nv_services.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_LL_BUS_H
+#define STM32U5xx_LL_BUS_H
+
+#include <stdint.h>
+
+#define LL_AHB1_GRP1_PERIPH_CRC       (1UL << 12)
+
+static inline void LL_AHB1_GRP1_EnableClock(uint32_t Periphs)
+{
+  (void)Periphs;
+}
+
+#endif /* STM32U5xx_LL_BUS_H */
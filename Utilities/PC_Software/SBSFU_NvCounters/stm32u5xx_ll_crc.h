@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_ll_crc.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the LL CRC functions used by bl2_nv_services.c :
+  *          16-bit CRC, polynomial set by LL_CRC_SetPolynomialCoef, 0xFFFF
+  *          initial value, no inversion
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_LL_CRC_H
+#define STM32U5xx_LL_CRC_H
+
+#include <stdint.h>
+
+typedef struct
+{
+  uint32_t POL;
+  uint32_t DR;
+} CRC_TypeDef;
+
+extern CRC_TypeDef host_crc;
+
+#define CRC                           (&host_crc)
+#define LL_CRC_POLYLENGTH_16B         (1UL << 3)
+
+static inline void LL_CRC_SetPolynomialCoef(CRC_TypeDef *CRCx, uint32_t PolynomCoef)
+{
+  CRCx->POL = PolynomCoef;
+}
+
+static inline void LL_CRC_SetPolynomialSize(CRC_TypeDef *CRCx, uint32_t PolySize)
+{
+  (void)CRCx;
+  (void)PolySize;
+}
+
+static inline void LL_CRC_ResetCRCCalculationUnit(CRC_TypeDef *CRCx)
+{
+  CRCx->DR = 0xFFFFU;
+}
+
+static inline void host_crc_feed(CRC_TypeDef *CRCx, uint32_t InData, uint32_t Bits)
+{
+  uint32_t i;
+
+  for (i = Bits; i > 0U; i--)
+  {
+    if ((((CRCx->DR >> 15) ^ (InData >> (i - 1U))) & 1U) != 0U)
+    {
+      CRCx->DR = ((CRCx->DR << 1) ^ CRCx->POL) & 0xFFFFU;
+    }
+    else
+    {
+      CRCx->DR = (CRCx->DR << 1) & 0xFFFFU;
+    }
+  }
+}
+
+static inline void LL_CRC_FeedData32(CRC_TypeDef *CRCx, uint32_t InData)
+{
+  host_crc_feed(CRCx, InData, 32U);
+}
+
+static inline void LL_CRC_FeedData16(CRC_TypeDef *CRCx, uint16_t InData)
+{
+  host_crc_feed(CRCx, InData, 16U);
+}
+
+static inline uint16_t LL_CRC_ReadData16(CRC_TypeDef *CRCx)
+{
+  return (uint16_t)CRCx->DR;
+}
+
+#endif /* STM32U5xx_LL_CRC_H */
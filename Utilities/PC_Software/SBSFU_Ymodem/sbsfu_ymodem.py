@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+# ######################################################################################################################
+#  @file    sbsfu_ymodem.py
+#  @author  MCD Application Team
+#  @brief   Ymodem-1K / Ymodem-G sender and transfer benchmark for the SBSFU loader and application firmware update
+# ######################################################################################################################
+#  @attention
+#
+#  Copyright (c) 2021 STMicroelectronics.
+#  All rights reserved.
+#
+#  This software is licensed under terms that can be found in the LICENSE file
+#  in the root directory of this software component.
+#  If no LICENSE file comes with this software, it is provided AS-IS.
+#
+# ######################################################################################################################
+"""
+The sender follows the request of the receiver : 'C' starts a Ymodem-1K transfer (each packet is acknowledged),
+'G' starts a Ymodem-G transfer (packets are streamed, any error aborts the transfer).
+
+The benchmark runs the sender and a model of the target receiver on the two ends of a pseudo terminal. The sender is
+throttled to the baud rate, the receiver stores the incoming bytes in a circular buffer (COM_UART_RX_BUFFER_SIZE) and
+spends FLASH_MS programming each 1K packet. Three receivers are compared :
+ - ack   : packet acknowledged once programmed (COM_UART_RX_DMA = 0),
+ - early : packet acknowledged before it is programmed (COM_UART_RX_DMA = 1),
+ - g     : Ymodem-G streaming (COM_UART_RX_DMA = 1, YMODEM_G_STREAMING = 1).
+
+Usage: python sbsfu_ymodem.py send PORT FILE [--baud BAUD]
+       python sbsfu_ymodem.py bench FILE [--baud BAUD] [--flash-ms FLASH_MS] [--buffer SIZE]
+"""
+
+import argparse
+import binascii
+import os
+import select
+import sys
+import termios
+import threading
+import time
+import tty
+
+SOH = 0x01
+STX = 0x02
+EOT = 0x04
+ACK = 0x06
+NAK = 0x15
+CA = 0x18
+CRC16 = 0x43        # 'C'
+YMODEM_G = 0x47     # 'G'
+
+PACKET_SIZE = 128
+PACKET_1K_SIZE = 1024
+MAX_ERRORS = 5
+TIMEOUT = 10.0      # seconds, answer of the receiver
+
+
+class YmodemError(Exception):
+    pass
+
+
+def packet(number, data, size):
+    data = data.ljust(size, b"\x1a" if number else b"\x00")
+    crc = binascii.crc_hqx(data, 0)
+    return bytes([SOH if size == PACKET_SIZE else STX, number & 0xFF, 0xFF - (number & 0xFF)]) + data + \
+        bytes([crc >> 8, crc & 0xFF])
+
+
+class Line:
+    """Raw file descriptor, written at most at the baud rate (10 bits per byte)."""
+
+    def __init__(self, fd, baud=0):
+        self.fd = fd
+        self.byte_time = 10.0 / baud if baud else 0.0
+        self.next_time = 0.0
+
+    def write(self, data):
+        for i in range(0, len(data), 64):
+            chunk = data[i:i + 64]
+            if self.byte_time:
+                now = time.monotonic()
+                self.next_time = max(self.next_time, now)
+                if self.next_time > now:
+                    time.sleep(self.next_time - now)
+                self.next_time += len(chunk) * self.byte_time
+            os.write(self.fd, chunk)
+
+    def read_byte(self, timeout):
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            return None
+        data = os.read(self.fd, 1)
+        return data[0] if data else None
+
+    def pending(self):
+        ready, _, _ = select.select([self.fd], [], [], 0)
+        return bool(ready)
+
+
+def send(line, name, data, log=print):
+    """Ymodem-1K / Ymodem-G transfer of one file, returns the protocol used."""
+
+    def wait(expected):
+        while True:
+            byte = line.read_byte(TIMEOUT)
+            if byte is None:
+                raise YmodemError("receiver timeout")
+            if byte == CA:
+                raise YmodemError("transfer cancelled by the receiver")
+            if byte in expected:
+                return byte
+
+    def transfer(number, payload, size, streaming):
+        for _ in range(MAX_ERRORS):
+            line.write(packet(number, payload, size))
+            if streaming:
+                return
+            # The SBSFU receiver requests the packet again with its start character
+            if wait((ACK, NAK, CRC16)) == ACK:
+                return
+        raise YmodemError("packet %u not acknowledged" % number)
+
+    start = wait((CRC16, YMODEM_G))
+    streaming = start == YMODEM_G
+    log("receiver requests %s" % ("Ymodem-G" if streaming else "Ymodem-1K"))
+
+    header = os.path.basename(name).encode() + b"\x00" + str(len(data)).encode() + b" "
+    transfer(0, header, PACKET_SIZE, streaming)
+    wait((start,))
+    for number, offset in enumerate(range(0, len(data), PACKET_1K_SIZE), 1):
+        transfer(number, data[offset:offset + PACKET_1K_SIZE], PACKET_1K_SIZE, streaming)
+        # A Ymodem-G receiver only answers to cancel the transfer
+        if streaming and line.pending() and line.read_byte(0) == CA:
+            raise YmodemError("transfer cancelled by the receiver")
+
+    line.write(bytes([EOT]))
+    if wait((ACK, NAK)) == NAK:
+        line.write(bytes([EOT]))
+        wait((ACK,))
+    wait((CRC16, YMODEM_G))
+    transfer(0, b"", PACKET_SIZE, False)
+    return "Ymodem-G" if streaming else "Ymodem-1K"
+
+
+def open_port(port, baud):
+    fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+    tty.setraw(fd)
+    attr = termios.tcgetattr(fd)
+    speed = getattr(termios, "B%u" % baud)
+    attr[4] = attr[5] = speed
+    termios.tcsetattr(fd, termios.TCSANOW, attr)
+    termios.tcflush(fd, termios.TCIOFLUSH)
+    return fd
+
+
+class Receiver(threading.Thread):
+    """Model of the target receiver : circular reception buffer filled by the 'DMA', flash programming time."""
+
+    def __init__(self, fd, mode, flash_time, buffer_size):
+        super().__init__(daemon=True)
+        self.line = Line(fd)
+        self.mode = mode
+        self.flash_time = flash_time
+        self.buffer_size = buffer_size
+        self.buffer = bytearray()
+        self.lock = threading.Condition()
+        self.overrun = False
+        self.received = b""
+        self.error = None
+        self.running = True
+        self.dma = threading.Thread(target=self.dma_loop, daemon=True)
+
+    def dma_loop(self):
+        while self.running:
+            ready, _, _ = select.select([self.line.fd], [], [], 0.05)
+            if not ready:
+                continue
+            try:
+                data = os.read(self.line.fd, 4096)
+            except OSError:
+                return
+            with self.lock:
+                if len(self.buffer) + len(data) > self.buffer_size:
+                    self.overrun = True
+                self.buffer += data
+                self.lock.notify()
+
+    def read(self, size, timeout=1.0):
+        deadline = time.monotonic() + timeout
+        with self.lock:
+            while len(self.buffer) < size:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    raise YmodemError("receiver timeout")
+                self.lock.wait(remaining)
+            data = bytes(self.buffer[:size])
+            del self.buffer[:size]
+            return data
+
+    def packet(self):
+        start = self.read(1, TIMEOUT)[0]
+        if start == EOT:
+            return None
+        if start not in (SOH, STX):
+            raise YmodemError("unexpected byte 0x%02x" % start)
+        size = PACKET_SIZE if start == SOH else PACKET_1K_SIZE
+        body = self.read(size + 4)
+        if body[0] != 0xFF - body[1] or binascii.crc_hqx(body[2:size + 2], 0) != (body[-2] << 8) | body[-1]:
+            raise YmodemError("corrupted packet")
+        return body[0], body[2:size + 2]
+
+    def put(self, byte):
+        os.write(self.line.fd, bytes([byte]))
+
+    def run(self):
+        self.dma.start()
+        streaming = self.mode == "g"
+        start = YMODEM_G if streaming else CRC16
+        try:
+            self.put(start)
+            _, header = self.packet()
+            name, size = header.split(b"\x00")[0:2]
+            size = int(size.split(b" ")[0])
+            if not streaming:
+                self.put(ACK)
+            self.put(start)
+            data = bytearray()
+            number = 1
+            while True:
+                pkt = self.packet()
+                if pkt is None:
+                    if not streaming:
+                        self.put(NAK)
+                        if self.read(1, TIMEOUT)[0] != EOT:
+                            raise YmodemError("EOT expected")
+                    self.put(ACK)
+                    break
+                if pkt[0] != number & 0xFF:
+                    raise YmodemError("packet %u missing" % number)
+                if self.mode == "early":
+                    self.put(ACK)
+                time.sleep(self.flash_time)
+                if self.overrun:
+                    raise YmodemError("reception buffer overrun while programming packet %u" % number)
+                if self.mode == "ack":
+                    self.put(ACK)
+                data += pkt[1]
+                number += 1
+            self.put(start)
+            if self.packet()[1][0] != 0:
+                raise YmodemError("end of session expected")
+            self.put(ACK)
+            self.received = bytes(data[:size])
+        except YmodemError as error:
+            self.error = error
+            self.put(CA)
+            self.put(CA)
+        finally:
+            self.running = False
+
+
+def bench(name, data, baud, flash_time, buffer_size):
+    print("%s : %u bytes, %u bauds, %.1f ms flash programming per 1K packet, %u bytes reception buffer"
+          % (name, len(data), baud, flash_time * 1000.0, buffer_size))
+    line_rate = baud / 10.0
+    for mode in ("ack", "early", "g"):
+        master, slave = os.openpty()
+        tty.setraw(master)
+        tty.setraw(slave)
+        receiver = Receiver(master, mode, flash_time, buffer_size)
+        start = time.monotonic()
+        receiver.start()
+        try:
+            send(Line(slave, baud), name, data, log=lambda message: None)
+        except YmodemError as error:
+            receiver.error = receiver.error or error
+        receiver.join(TIMEOUT)
+        elapsed = time.monotonic() - start
+        os.close(slave)
+        os.close(master)
+        if receiver.error is not None:
+            print("  %-6s : failed, %s" % (mode, receiver.error))
+        elif receiver.received != data:
+            print("  %-6s : failed, received file differs" % mode)
+        else:
+            rate = len(data) / elapsed
+            print("  %-6s : %6.2f s, %8.0f bytes/s, %5.1f %% of the line rate" % (mode, elapsed, rate,
+                                                                                100.0 * rate / line_rate))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="SBSFU Ymodem sender and transfer benchmark")
+    commands = parser.add_subparsers(dest="command")
+    cmd = commands.add_parser("send", help="send FILE to the target connected to PORT")
+    cmd.add_argument("port", help="serial port, e.g. /dev/ttyACM0")
+    cmd.add_argument("file", help="image to download")
+    cmd.add_argument("--baud", type=int, default=115200, help="COM_UART_BAUDRATE, default 115200")
+    cmd = commands.add_parser("bench", help="compare the receivers on a pseudo terminal")
+    cmd.add_argument("file", help="image to transfer")
+    cmd.add_argument("--baud", type=int, default=115200, help="simulated baud rate, default 115200")
+    cmd.add_argument("--flash-ms", type=float, default=40.0, help="programming time of a 1K packet, default 40")
+    cmd.add_argument("--buffer", type=int, default=2048, help="COM_UART_RX_BUFFER_SIZE, default 2048")
+    args = parser.parse_args()
+    if args.command is None:
+        parser.error("a command is required")
+
+    try:
+        with open(args.file, "rb") as f:
+            data = f.read()
+        if args.command == "send":
+            fd = open_port(args.port, args.baud)
+            try:
+                start = time.monotonic()
+                protocol = send(Line(fd), args.file, data)
+                elapsed = time.monotonic() - start
+            finally:
+                os.close(fd)
+            print("%s : %u bytes sent with %s in %.2f s (%.0f bytes/s)" % (args.file, len(data), protocol, elapsed,
+                                                                          len(data) / elapsed))
+        else:
+            bench(args.file, data, args.baud, args.flash_ms / 1000.0, args.buffer)
+    except (OSError, ValueError, YmodemError) as error:
+        print("error : %s" % error, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
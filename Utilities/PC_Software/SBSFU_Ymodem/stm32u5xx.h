@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the device header included by com.h and
+  *          common.h : the definitions are in the host stm32u5xx_hal.h
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_H
+#define STM32U5xx_H
+
+#include "stm32u5xx_hal.h"
+
+#endif /* STM32U5xx_H */
@@ -0,0 +1,266 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the HAL definitions used by com.c, ymodem.c and
+  *          common.c : the UART, the GPDMA channel and the CRC unit are
+  *          emulated by ymodem_test.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_HAL_H
+#define STM32U5xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/* Status and peripheral registers -------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct
+{
+  volatile uint32_t CR3;
+  volatile uint32_t RDR;
+} USART_TypeDef;
+
+typedef struct
+{
+  uint32_t dummy;
+} GPIO_TypeDef, CRC_TypeDef, DMA_Channel_TypeDef;
+
+extern USART_TypeDef       host_usart1;
+extern GPIO_TypeDef        host_gpioa;
+extern CRC_TypeDef         host_crc;
+extern DMA_Channel_TypeDef host_gpdma1_channel0;
+
+#define USART1                      (&host_usart1)
+#define GPIOA                       (&host_gpioa)
+#define CRC                         (&host_crc)
+#define GPDMA1_Channel0             (&host_gpdma1_channel0)
+#define GPDMA1_REQUEST_USART1_RX    25U
+#define USART_CR3_DMAR              (1UL << 6)
+
+#define __weak                      __attribute__((weak))
+#define SET_BIT(REG, BIT)           ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)         ((REG) &= ~(BIT))
+
+/* Clocks and GPIO -----------------------------------------------------------*/
+#define __HAL_RCC_USART1_CLK_ENABLE()   do {} while (0)
+#define __HAL_RCC_USART1_CLK_DISABLE()  do {} while (0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE()    do {} while (0)
+#define __HAL_RCC_GPIOA_CLK_DISABLE()   do {} while (0)
+#define __HAL_RCC_GPDMA1_CLK_ENABLE()   do {} while (0)
+#define __HAL_RCC_CRC_CLK_ENABLE()      do {} while (0)
+
+#define GPIO_PIN_9                  (1UL << 9)
+#define GPIO_PIN_10                 (1UL << 10)
+#define GPIO_AF7_USART1             7U
+#define GPIO_MODE_AF_PP             2U
+#define GPIO_NOPULL                 0U
+#define GPIO_SPEED_FREQ_HIGH        2U
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin);
+uint32_t HAL_GetTick(void);
+
+/* UART ----------------------------------------------------------------------*/
+#define UART_WORDLENGTH_8B                      0U
+#define UART_STOPBITS_1                         0U
+#define UART_PARITY_NONE                        0U
+#define UART_HWCONTROL_NONE                     0U
+#define UART_MODE_RX                            4U
+#define UART_MODE_TX                            8U
+#define UART_ADVFEATURE_RXOVERRUNDISABLE_INIT   0x10U
+#define UART_ADVFEATURE_OVERRUN_DISABLE         0x1000U
+#define UART_FIFOMODE_ENABLE                    0x20000000U
+
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+} UART_InitTypeDef;
+
+typedef struct
+{
+  uint32_t AdvFeatureInit;
+  uint32_t OverrunDisable;
+} UART_AdvFeatureInitTypeDef;
+
+typedef struct
+{
+  USART_TypeDef              *Instance;
+  UART_InitTypeDef           Init;
+  UART_AdvFeatureInitTypeDef AdvancedInit;
+  uint32_t                   FifoMode;
+} UART_HandleTypeDef;
+
+/* Drops the bytes received and not read yet, as the RXFRQ request of the USART */
+#define __HAL_UART_FLUSH_DRREGISTER(__HANDLE__)  host_uart_flush(__HANDLE__)
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+void HAL_UART_MspInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+void host_uart_flush(UART_HandleTypeDef *huart);
+
+/* CRC -----------------------------------------------------------------------*/
+#define DEFAULT_POLYNOMIAL_DISABLE          1U
+#define DEFAULT_INIT_VALUE_DISABLE          1U
+#define CRC_POLYLENGTH_16B                  16U
+#define CRC_INPUTDATA_INVERSION_NONE        0U
+#define CRC_OUTPUTDATA_INVERSION_DISABLE    0U
+#define CRC_INPUTDATA_FORMAT_BYTES          1U
+
+typedef struct
+{
+  uint8_t  DefaultPolynomialUse;
+  uint8_t  DefaultInitValueUse;
+  uint32_t GeneratingPolynomial;
+  uint32_t CRCLength;
+  uint32_t InitValue;
+  uint32_t InputDataInversionMode;
+  uint32_t OutputDataInversionMode;
+} CRC_InitTypeDef;
+
+typedef struct
+{
+  CRC_TypeDef     *Instance;
+  CRC_InitTypeDef Init;
+  uint32_t        InputDataFormat;
+  uint32_t        Value;              /* CRC unit data register */
+} CRC_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+/* GPDMA linked-list ---------------------------------------------------------*/
+#define DMA_GPDMA_LINEAR_NODE               1U
+#define DMA_BREQ_SINGLE_BURST               0U
+#define DMA_PERIPH_TO_MEMORY                0U
+#define DMA_SINC_FIXED                      0U
+#define DMA_DINC_INCREMENTED                1U
+#define DMA_SRC_DATAWIDTH_BYTE              0U
+#define DMA_DEST_DATAWIDTH_BYTE             0U
+#define DMA_HIGH_PRIORITY                   3U
+#define DMA_TCEM_BLOCK_TRANSFER             0U
+#define DMA_TCEM_LAST_LL_ITEM_TRANSFER      3U
+#define DMA_SRC_ALLOCATED_PORT0             0U
+#define DMA_DEST_ALLOCATED_PORT1            2U
+#define DMA_LINK_ALLOCATED_PORT1            1U
+#define DMA_EXCHANGE_NONE                   0U
+#define DMA_DATA_RIGHTALIGN_ZEROPADDED      0U
+#define DMA_TRIG_POLARITY_MASKED            0U
+#define DMA_LSM_FULL_EXECUTION              0U
+#define DMA_LINKEDLIST_CIRCULAR             1U
+
+typedef struct
+{
+  uint32_t Request;
+  uint32_t BlkHWRequest;
+  uint32_t Direction;
+  uint32_t SrcInc;
+  uint32_t DestInc;
+  uint32_t SrcDataWidth;
+  uint32_t DestDataWidth;
+  uint32_t Priority;
+  uint32_t SrcBurstLength;
+  uint32_t DestBurstLength;
+  uint32_t TransferAllocatedPort;
+  uint32_t TransferEventMode;
+} DMA_InitTypeDef;
+
+typedef struct
+{
+  uint32_t DataExchange;
+  uint32_t DataAlignment;
+} DMA_DataHandlingConfTypeDef;
+
+typedef struct
+{
+  uint32_t TriggerPolarity;
+} DMA_TriggerConfTypeDef;
+
+typedef struct
+{
+  uint32_t                    NodeType;
+  DMA_InitTypeDef             Init;
+  DMA_DataHandlingConfTypeDef DataHandlingConfig;
+  DMA_TriggerConfTypeDef      TriggerConfig;
+  uint32_t                    SrcAddress;
+  uint32_t                    DstAddress;
+  uint32_t                    DataSize;
+} DMA_NodeConfTypeDef;
+
+typedef struct
+{
+  uint32_t DstAddress;
+  uint32_t DataSize;
+} DMA_NodeTypeDef;
+
+typedef struct
+{
+  DMA_NodeTypeDef *Head;
+  uint32_t        NodeNumber;
+  uint32_t        Circular;
+} DMA_QListTypeDef;
+
+typedef struct
+{
+  uint32_t Priority;
+  uint32_t LinkStepMode;
+  uint32_t LinkAllocatedPort;
+  uint32_t TransferEventMode;
+  uint32_t LinkedListMode;
+} DMA_InitLinkedListTypeDef;
+
+typedef struct
+{
+  DMA_Channel_TypeDef       *Instance;
+  DMA_InitLinkedListTypeDef InitLinkedList;
+  DMA_QListTypeDef          *LinkedListQueue;
+} DMA_HandleTypeDef;
+
+/* Remaining data of the node in progress, as the BR1 register of the channel */
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)   host_dma_counter(__HANDLE__)
+
+HAL_StatusTypeDef HAL_DMAEx_List_BuildNode(DMA_NodeConfTypeDef const *const pNodeConfig, DMA_NodeTypeDef *const pNode);
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pNewNode);
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularMode(DMA_QListTypeDef *const pQList);
+HAL_StatusTypeDef HAL_DMAEx_List_Init(DMA_HandleTypeDef *const hdma);
+HAL_StatusTypeDef HAL_DMAEx_List_LinkQ(DMA_HandleTypeDef *const hdma, DMA_QListTypeDef *const pQList);
+HAL_StatusTypeDef HAL_DMAEx_List_Start(DMA_HandleTypeDef *const hdma);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *const hdma);
+uint32_t host_dma_counter(DMA_HandleTypeDef *const hdma);
+
+#endif /* STM32U5xx_HAL_H */
@@ -0,0 +1,637 @@
+/**
+  ******************************************************************************
+  * @file    ymodem_test.c
+  * @author  MCD Application Team
+  * @brief   Host test of the Ymodem receiver of the SBSFU loader and
+  *          application (ymodem.c, com.c) against sbsfu_ymodem.py over a
+  *          pseudo terminal, with an emulated UART, GPDMA and CRC unit
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <pty.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#undef CR3  /* termios.h carriage return delay, not the USART register */
+#include "stm32u5xx_hal.h"
+#include "com.h"
+#include "ymodem.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_FLASH_DESTINATION  0x08100000U  /* download slot address given to Ymodem_Receive */
+#define TEST_DEFAULT_SIZE       20000U
+#define TEST_DEFAULT_BAUD       115200U
+#define TEST_DEFAULT_FLASH_MS   40U
+#define TEST_RX_FIFO_SIZE       65536U       /* bytes received and not read, without GPDMA */
+#define TEST_LINK_CHUNK         16U          /* bytes delivered at once by the emulated line */
+#define TEST_SENDER_TIMEOUT     20           /* seconds, sender still running after Ymodem_Receive */
+#define TEST_WATCHDOG           300U         /* seconds, whole test */
+#define TEST_ABORT_DELAY        (3U * DOWNLOAD_TIMEOUT) /* ms, receiver still running after the sender end */
+
+/* first data byte of the second 1K packet : header packet (133 bytes), first 1K packet (1029 bytes), packet
+   header (3 bytes) */
+#define TEST_CORRUPT_OFFSET     (133U + 1029U + 3U + 100U)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char        *name;
+  uint32_t          max_size;        /* download slot size, 0 for the image size */
+  int32_t           corrupt_offset;  /* stream byte corrupted once on the line, -1 for none */
+  uint32_t          fail_packet;     /* data packet failing to program, 0 for none */
+  COM_StatusTypeDef expected;        /* result of Ymodem_Receive */
+  int               sender_ok;       /* expected exit status of the sender : 1 success, 0 error */
+} test_scenario_t;
+
+/* Private variables ---------------------------------------------------------*/
+USART_TypeDef       host_usart1;
+GPIO_TypeDef        host_gpioa;
+CRC_TypeDef         host_crc;
+DMA_Channel_TypeDef host_gpdma1_channel0;
+uint32_t            TestNumber;
+
+static pthread_mutex_t test_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  test_cond = PTHREAD_COND_INITIALIZER;
+static int             test_fd = -1;        /* pseudo terminal master : target side of the line */
+static volatile int    test_link_run;
+static pid_t           test_sender;         /* sender process, reaped by the line thread */
+static volatile int    test_sender_done;
+static int             test_sender_status;
+static uint64_t        test_byte_ns;        /* transmission time of one byte on the line */
+static uint64_t        test_start_ns;
+
+static uint8_t         test_rx_fifo[TEST_RX_FIFO_SIZE];
+static uint32_t        test_rx_head;
+static uint32_t        test_rx_tail;
+
+static uint8_t         *test_dma_dst;       /* circular buffer written by the emulated GPDMA channel */
+static uint32_t        test_dma_size;
+static uint32_t        test_dma_pos;        /* bytes written since the channel start */
+static int             test_dma_run;
+
+static int32_t         test_corrupt_offset;
+static uint64_t        test_delivered;      /* bytes delivered to the UART since the scenario start */
+static uint64_t        test_first_ns;       /* delivery of the first byte */
+
+static uint8_t         *test_image;         /* download slot */
+static uint32_t        test_programmed;
+static uint32_t        test_fail_packet;
+static uint32_t        test_packets;
+static uint32_t        test_flash_ns;       /* programming time of a 1K packet */
+static uint32_t        test_violations;     /* packet programmed out of order or out of the slot */
+static uint32_t        test_slot_size;
+static uint64_t        test_last_ns;        /* end of the last programming */
+
+/* Private functions ---------------------------------------------------------*/
+static uint64_t test_now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static void test_sleep_until(uint64_t deadline)
+{
+  struct timespec ts;
+
+  ts.tv_sec = (time_t)(deadline / 1000000000ULL);
+  ts.tv_nsec = (long)(deadline % 1000000000ULL);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+  {
+  }
+}
+
+/**
+  * @brief  Deliver bytes received on the line : written by the GPDMA channel in its circular buffer when the USART
+  *         DMA request is enabled, or kept in the USART reception path until read by HAL_UART_Receive
+  */
+static void test_deliver(uint8_t *p_data, uint32_t size)
+{
+  uint32_t i;
+
+  pthread_mutex_lock(&test_lock);
+  for (i = 0U; i < size; i++)
+  {
+    if ((test_corrupt_offset >= 0) && (test_delivered == (uint64_t)test_corrupt_offset))
+    {
+      p_data[i] ^= 0x55U;
+    }
+    if (test_delivered++ == 0U)
+    {
+      test_first_ns = test_now_ns();
+    }
+#if (COM_UART_RX_DMA == 1U)
+    /* The channel overwrites the bytes not read yet, as the hardware */
+    if ((test_dma_run != 0) && ((host_usart1.CR3 & USART_CR3_DMAR) != 0U))
+    {
+      test_dma_dst[test_dma_pos % test_dma_size] = p_data[i];
+      __atomic_store_n(&test_dma_pos, test_dma_pos + 1U, __ATOMIC_RELEASE);
+    }
+#else
+    if ((test_rx_head - test_rx_tail) < TEST_RX_FIFO_SIZE)
+    {
+      test_rx_fifo[test_rx_head++ % TEST_RX_FIFO_SIZE] = p_data[i];
+    }
+#endif /* (COM_UART_RX_DMA == 1U) */
+  }
+  pthread_cond_broadcast(&test_cond);
+  pthread_mutex_unlock(&test_lock);
+}
+
+/**
+  * @brief  Emulated line : the bytes written by the sender are delivered at the baud rate
+  */
+static void *test_link(void *arg)
+{
+  uint8_t data[4096];
+  uint64_t next_ns = 0U;
+  struct pollfd pfd;
+  ssize_t length;
+  ssize_t offset;
+  uint32_t chunk;
+  uint64_t done_ns = 0U;
+  uint8_t abort_char = ABORT1;
+
+  (void)arg;
+  pfd.fd = test_fd;
+  pfd.events = POLLIN;
+  while (test_link_run != 0)
+  {
+    if ((test_sender_done == 0) && (waitpid(test_sender, &test_sender_status, WNOHANG) == test_sender))
+    {
+      done_ns = test_now_ns();
+      test_sender_done = 1;
+    }
+    /* A receiver still waiting once the sender gave up is aborted by the user, as from the terminal */
+    if ((test_sender_done != 0) && ((test_now_ns() - done_ns) > (TEST_ABORT_DELAY * 1000000ULL)))
+    {
+      test_deliver(&abort_char, 1U);
+      done_ns = test_now_ns();
+    }
+    if (poll(&pfd, 1, 5) <= 0)
+    {
+      continue;
+    }
+    length = read(test_fd, data, sizeof(data));
+    if (length <= 0)
+    {
+      usleep(1000);
+      continue;
+    }
+    for (offset = 0; offset < length; offset += (ssize_t)chunk)
+    {
+      chunk = ((length - offset) < (ssize_t)TEST_LINK_CHUNK) ? (uint32_t)(length - offset) : TEST_LINK_CHUNK;
+      next_ns = ((next_ns > test_now_ns()) ? next_ns : test_now_ns()) + (chunk * test_byte_ns);
+      test_sleep_until(next_ns);
+      test_deliver(&data[offset], chunk);
+    }
+  }
+  return NULL;
+}
+
+static void test_watchdog(int sig)
+{
+  static const char message[] = "ymodem_test : watchdog expired\n";
+
+  (void)sig;
+  (void)write(STDERR_FILENO, message, sizeof(message) - 1U);
+  _exit(2);
+}
+
+/* Emulated HAL --------------------------------------------------------------*/
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)((test_now_ns() - test_start_ns) / 1000000ULL);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  (void)GPIOx;
+  (void)GPIO_Init;
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+  (void)GPIOx;
+  (void)GPIO_Pin;
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+  HAL_UART_MspInit(huart);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  ssize_t written;
+  uint16_t sent = 0U;
+
+  (void)huart;
+  (void)Timeout;
+  while (sent < Size)
+  {
+    written = write(test_fd, &pData[sent], Size - sent);
+    if (written <= 0)
+    {
+      return HAL_ERROR;
+    }
+    sent += (uint16_t)written;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint16_t received = 0U;
+  struct timespec ts;
+
+  (void)huart;
+  pthread_mutex_lock(&test_lock);
+  while (received < Size)
+  {
+    if (test_rx_head != test_rx_tail)
+    {
+      pData[received++] = test_rx_fifo[test_rx_tail++ % TEST_RX_FIFO_SIZE];
+    }
+    else if ((HAL_GetTick() - tickstart) > Timeout)
+    {
+      /* The bytes already read are lost, as with the HAL */
+      pthread_mutex_unlock(&test_lock);
+      return HAL_TIMEOUT;
+    }
+    else
+    {
+      clock_gettime(CLOCK_REALTIME, &ts);
+      ts.tv_nsec += 1000000L;
+      if (ts.tv_nsec >= 1000000000L)
+      {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+      }
+      (void)pthread_cond_timedwait(&test_cond, &test_lock, &ts);
+    }
+  }
+  pthread_mutex_unlock(&test_lock);
+  return HAL_OK;
+}
+
+void host_uart_flush(UART_HandleTypeDef *huart)
+{
+  (void)huart;
+  pthread_mutex_lock(&test_lock);
+  test_rx_tail = test_rx_head;
+  pthread_mutex_unlock(&test_lock);
+}
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  /* Only the configuration of the Ymodem CRC16 is emulated */
+  if ((hcrc->Init.DefaultPolynomialUse != DEFAULT_POLYNOMIAL_DISABLE) || (hcrc->Init.CRCLength != CRC_POLYLENGTH_16B)
+      || (hcrc->Init.DefaultInitValueUse != DEFAULT_INIT_VALUE_DISABLE)
+      || (hcrc->Init.InputDataInversionMode != CRC_INPUTDATA_INVERSION_NONE)
+      || (hcrc->Init.OutputDataInversionMode != CRC_OUTPUTDATA_INVERSION_DISABLE)
+      || (hcrc->InputDataFormat != CRC_INPUTDATA_FORMAT_BYTES))
+  {
+    return HAL_ERROR;
+  }
+  hcrc->Value = hcrc->Init.InitValue;
+  return HAL_OK;
+}
+
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  const uint8_t *p_data = (const uint8_t *)pBuffer;
+  uint32_t crc = hcrc->Value;
+  uint32_t i;
+  uint32_t bit;
+
+  for (i = 0U; i < BufferLength; i++)
+  {
+    crc ^= (uint32_t)p_data[i] << 8;
+    for (bit = 0U; bit < 8U; bit++)
+    {
+      crc = ((crc & 0x8000U) != 0U) ? ((crc << 1) ^ hcrc->Init.GeneratingPolynomial) : (crc << 1);
+    }
+    crc &= 0xFFFFU;
+  }
+  hcrc->Value = crc;
+  return crc;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  hcrc->Value = hcrc->Init.InitValue;
+  return HAL_CRC_Accumulate(hcrc, pBuffer, BufferLength);
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_BuildNode(DMA_NodeConfTypeDef const *const pNodeConfig, DMA_NodeTypeDef *const pNode)
+{
+  if ((pNodeConfig->Init.Direction != DMA_PERIPH_TO_MEMORY) || (pNodeConfig->Init.DestInc != DMA_DINC_INCREMENTED)
+      || (pNodeConfig->SrcAddress != (uint32_t)(uintptr_t)&host_usart1.RDR) || (pNodeConfig->DataSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+  pNode->DstAddress = pNodeConfig->DstAddress;
+  pNode->DataSize = pNodeConfig->DataSize;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList, DMA_NodeTypeDef *const pNewNode)
+{
+  if (pQList->Head != NULL)
+  {
+    return HAL_ERROR;
+  }
+  pQList->Head = pNewNode;
+  pQList->NodeNumber = 1U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_SetCircularMode(DMA_QListTypeDef *const pQList)
+{
+  pQList->Circular = 1U;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_Init(DMA_HandleTypeDef *const hdma)
+{
+  return (hdma->InitLinkedList.LinkedListMode == DMA_LINKEDLIST_CIRCULAR) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_LinkQ(DMA_HandleTypeDef *const hdma, DMA_QListTypeDef *const pQList)
+{
+  hdma->LinkedListQueue = pQList;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_List_Start(DMA_HandleTypeDef *const hdma)
+{
+  if ((hdma->LinkedListQueue == NULL) || (hdma->LinkedListQueue->Circular == 0U))
+  {
+    return HAL_ERROR;
+  }
+  pthread_mutex_lock(&test_lock);
+  test_dma_dst = (uint8_t *)(uintptr_t)hdma->LinkedListQueue->Head->DstAddress;
+  test_dma_size = hdma->LinkedListQueue->Head->DataSize;
+  test_dma_pos = 0U;
+  test_dma_run = 1;
+  pthread_mutex_unlock(&test_lock);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *const hdma)
+{
+  (void)hdma;
+  pthread_mutex_lock(&test_lock);
+  test_dma_run = 0;
+  pthread_mutex_unlock(&test_lock);
+  return HAL_OK;
+}
+
+uint32_t host_dma_counter(DMA_HandleTypeDef *const hdma)
+{
+  (void)hdma;
+  /* The receiver polls the counter : the core is given to the line and the sender, as the GPDMA runs aside */
+  (void)sched_yield();
+  return test_dma_size - (__atomic_load_n(&test_dma_pos, __ATOMIC_ACQUIRE) % test_dma_size);
+}
+
+/* Ymodem callbacks ----------------------------------------------------------*/
+HAL_StatusTypeDef Ymodem_HeaderPktRxCpltCallback(uint32_t uFlashDestination, uint32_t uFileSize)
+{
+  if ((uFlashDestination != TEST_FLASH_DESTINATION) || (uFileSize > test_slot_size))
+  {
+    test_violations++;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef Ymodem_DataPktRxCpltCallback(uint8_t *pData, uint32_t uFlashDestination, uint32_t uSize)
+{
+  /* Programming time proportional to the packet size */
+  test_sleep_until(test_now_ns() + (((uint64_t)test_flash_ns * uSize) / PACKET_1K_SIZE));
+  test_last_ns = test_now_ns();
+
+  if (++test_packets == test_fail_packet)
+  {
+    return HAL_ERROR;
+  }
+  if ((uFlashDestination != (TEST_FLASH_DESTINATION + test_programmed))
+      || ((test_programmed + uSize) > (test_slot_size + PACKET_1K_SIZE)))
+  {
+    test_violations++;
+    return HAL_ERROR;
+  }
+  memcpy(&test_image[test_programmed], pData, uSize);
+  test_programmed += uSize;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Transfer of the image by the sender to Ymodem_Receive
+  * @retval 1 if the scenario passed
+  */
+static int test_run(const test_scenario_t *p_scenario, const char *p_file, const uint8_t *p_data, uint32_t size)
+{
+  char slave_name[64];
+  struct termios attr;
+  pthread_t link;
+  COM_StatusTypeDef result;
+  uint32_t received_size;
+  const char *p_python;
+  int slave;
+  int sender_ok;
+  int image_ok;
+  int passed;
+  uint32_t waited;
+
+  if (openpty(&test_fd, &slave, slave_name, NULL, NULL) != 0)
+  {
+    perror("openpty");
+    return 0;
+  }
+  (void)tcgetattr(test_fd, &attr);
+  cfmakeraw(&attr);
+  (void)tcsetattr(test_fd, TCSANOW, &attr);
+
+  test_sender_done = 0;
+  test_sender_status = 0;
+  test_sender = fork();
+  if (test_sender == 0)
+  {
+    /* Sender, its messages only shown for the nominal transfers */
+    int null_fd = open("/dev/null", O_WRONLY);
+
+    close(test_fd);
+    close(slave);
+    if (p_scenario->sender_ok == 0)
+    {
+      (void)dup2(null_fd, STDERR_FILENO);
+    }
+    (void)dup2(null_fd, STDOUT_FILENO);
+    p_python = getenv("PYTHON");
+    p_python = (p_python != NULL) ? p_python : "python3";
+    execlp(p_python, p_python, "sbsfu_ymodem.py", "send", slave_name, p_file, (char *)NULL);
+    perror(p_python);
+    _exit(127);
+  }
+
+  /* Scenario state */
+  test_slot_size = (p_scenario->max_size != 0U) ? p_scenario->max_size : size;
+  test_image = calloc(1U, test_slot_size + PACKET_1K_SIZE);
+  test_programmed = 0U;
+  test_packets = 0U;
+  test_fail_packet = p_scenario->fail_packet;
+  test_violations = 0U;
+  test_corrupt_offset = p_scenario->corrupt_offset;
+  test_delivered = 0U;
+  test_first_ns = 0U;
+  test_last_ns = 0U;
+  test_rx_head = 0U;
+  test_rx_tail = 0U;
+  test_link_run = 1;
+  (void)pthread_create(&link, NULL, test_link, NULL);
+
+  /* Target, as FW_UPDATE_Download() */
+  received_size = test_slot_size;
+  Ymodem_Init();
+  result = Ymodem_Receive(&received_size, TEST_FLASH_DESTINATION);
+
+  /* The sender ends once it got the answer of its last packet */
+  for (waited = 0U; (test_sender_done == 0) && (waited < (TEST_SENDER_TIMEOUT * 10U)); waited++)
+  {
+    usleep(100000);
+  }
+  if (test_sender_done == 0)
+  {
+    kill(test_sender, SIGKILL);
+    while (test_sender_done == 0)
+    {
+      usleep(1000);
+    }
+  }
+  test_link_run = 0;
+  (void)pthread_join(link, NULL);
+  close(slave);
+  close(test_fd);
+  test_fd = -1;
+
+  sender_ok = WIFEXITED(test_sender_status) && (WEXITSTATUS(test_sender_status) == 0);
+  image_ok = (result != COM_OK)
+             || ((received_size == size) && (test_programmed >= size) && (memcmp(test_image, p_data, size) == 0));
+  passed = (result == p_scenario->expected) && (sender_ok == p_scenario->sender_ok) && image_ok
+           && (test_violations == 0U);
+
+  printf("  %-12s : result %u, sender %s", p_scenario->name, result, sender_ok ? "ok" : "error");
+  if ((result == COM_OK) && (test_last_ns > test_first_ns))
+  {
+    printf(", %.2f s, %.0f bytes/s", (double)(test_last_ns - test_first_ns) / 1e9,
+           (double)size * 1e9 / (double)(test_last_ns - test_first_ns));
+  }
+  printf(" : %s\n", passed ? "ok" : "FAILED");
+  if (!image_ok)
+  {
+    printf("    received image differs (%u bytes programmed)\n", test_programmed);
+  }
+  if (test_violations != 0U)
+  {
+    printf("    %u packets programmed out of order or out of the slot\n", test_violations);
+  }
+
+  free(test_image);
+  return passed;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  const uint32_t size = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : TEST_DEFAULT_SIZE;
+  const uint32_t baud = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : TEST_DEFAULT_BAUD;
+  const uint32_t flash_ms = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : TEST_DEFAULT_FLASH_MS;
+  const test_scenario_t scenarios[] =
+  {
+    {"nominal",     0U,           -1,                          0U, COM_OK,    1},
+#if (YMODEM_G_STREAMING == 1U)
+    {"line error",  0U,           (int32_t)TEST_CORRUPT_OFFSET, 0U, COM_ERROR, 0},
+#else
+    {"line error",  0U,           (int32_t)TEST_CORRUPT_OFFSET, 0U, COM_OK,    1},
+#endif /* (YMODEM_G_STREAMING == 1U) */
+    {"flash error", 0U,           -1,                          3U, COM_ERROR, 0},
+    {"too large",   size - 1U,    -1,                          0U, COM_ABORT, 0},
+  };
+  char file[] = "/tmp/ymodem_test_XXXXXX";
+  uint8_t *p_data;
+  uint32_t failures = 0U;
+  uint32_t i;
+  int fd;
+
+  if ((size < (3U * PACKET_1K_SIZE)) || (baud == 0U))
+  {
+    fprintf(stderr, "usage: %s [SIZE [BAUD [FLASH_MS]]], SIZE of 3 KB at least\n", argv[0]);
+    return 2;
+  }
+
+  signal(SIGALRM, test_watchdog);
+  alarm(TEST_WATCHDOG);
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  test_start_ns = test_now_ns();
+  test_byte_ns = 10000000000ULL / baud;
+  test_flash_ns = flash_ms * 1000000U;
+
+  /* Image to download */
+  p_data = malloc(size);
+  srand(size);
+  for (i = 0U; i < size; i++)
+  {
+    p_data[i] = (uint8_t)rand();
+  }
+  fd = mkstemp(file);
+  if ((fd < 0) || (write(fd, p_data, size) != (ssize_t)size))
+  {
+    perror(file);
+    return 2;
+  }
+  close(fd);
+
+  printf("Ymodem receiver, COM_UART_RX_DMA %u, YMODEM_G_STREAMING %u : %u bytes, %u bauds, %u ms per 1K packet\n",
+         COM_UART_RX_DMA, YMODEM_G_STREAMING, size, baud, flash_ms);
+  if (COM_Init() != HAL_OK)
+  {
+    printf("COM_Init failed\n");
+    return 1;
+  }
+  for (i = 0U; (i < (sizeof(scenarios) / sizeof(scenarios[0]))); i++)
+  {
+    failures += (test_run(&scenarios[i], file, p_data, size) != 0) ? 0U : 1U;
+  }
+
+  unlink(file);
+  free(p_data);
+  printf("%s\n", (failures == 0U) ? "PASSED" : "FAILED");
+  return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    tracer_emb_conf.h
+  * @author  MCD Application Team
+  * @brief   Embedded tracer configuration of the stress test (host build)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2022 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TRACER_EMB_CONF_H
+#define TRACER_EMB_CONF_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Host stand-ins of the CMSIS definitions used by the tracer ----------------*/
+#define __IO                     volatile
+#define __weak                   __attribute__((weak))
+
+/* The exclusive accesses are emulated on the host : the lock-free mode builds as for a Cortex-M33 */
+#define __ARM_ARCH_8M_MAIN__     1
+
+/* Interrupt masking and exclusive accesses, emulated by tracer_emb_stress.c :
+   - PRIMASK is a global lock owned by one thread at a time, the masked time being measured,
+   - LDREX/STREX are a per-thread exclusive monitor cleared by any successful store-exclusive */
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t priMask);
+void     __disable_irq(void);
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+void     __CLREX(void);
+void     __DMB(void);
+
+/* -----------------------------------------------------------------------------
+      Definitions for TRACE feature
+-------------------------------------------------------------------------------*/
+#define TRACER_EMB_DMA_MODE                          1UL
+#define TRACER_EMB_IT_MODE                           0UL
+
+/* TRACER_EMB_BUFFER_SIZE, TRACER_EMB_LOCKFREE_MODE and TRACER_EMB_RECORD_NUMBER are set by the Makefile, the
+   record headers default to the value derived from TRACER_EMB_BUFFER_SIZE by tracer_emb.c */
+#ifndef TRACER_EMB_BUFFER_SIZE
+#define TRACER_EMB_BUFFER_SIZE                       1024UL
+#endif /* TRACER_EMB_BUFFER_SIZE */
+#ifndef TRACER_EMB_LOCKFREE_MODE
+#define TRACER_EMB_LOCKFREE_MODE                     0UL
+#endif /* TRACER_EMB_LOCKFREE_MODE */
+
+#endif /* TRACER_EMB_CONF_H */
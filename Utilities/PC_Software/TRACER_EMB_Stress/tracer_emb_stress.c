@@ -0,0 +1,696 @@
+/**
+  ******************************************************************************
+  * @file    tracer_emb_stress.c
+  * @author  MCD Application Team
+  * @brief   Stress test of the embedded tracer buffer management, comparing the
+  *          interrupt masking mode and the lock-free mode (host build)
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2022 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "tracer_emb.h"
+#include "tracer_emb_hw.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define STRESS_DEFAULT_RECORDS      20000U
+#define STRESS_DEFAULT_PRODUCERS    4U
+#define STRESS_MAX_PRODUCERS        8U
+#define STRESS_MAX_RECORDS          65535U
+
+/* Record : magic, writer identifier, length, sequence number (2 bytes), then a payload depending on all of them.
+   The writers identifiers are the producer number for TRACER_EMB_Add and the producer number plus
+   STRESS_MAX_PRODUCERS for the record added while a TRACER_EMB_AllocateBufer record is being written */
+#define STRESS_RECORD_MAGIC         0xA5U
+#define STRESS_HEADER_SIZE          5U
+#define STRESS_MIN_LENGTH           STRESS_HEADER_SIZE
+#define STRESS_MAX_LENGTH           24U
+#define STRESS_WRITERS              (2U * STRESS_MAX_PRODUCERS)
+
+/* One TRACER_EMB_AllocateBufer record every STRESS_LOCKED_PERIOD records */
+#define STRESS_LOCKED_PERIOD        4U
+
+/* In the second run, the threads give the core away every STRESS_PREEMPT_PERIOD barriers, store-exclusives and
+   interrupt unmasking, and at any instruction on a periodic timer signal, as an interrupt preempting the writer
+   inside the tracer */
+#define STRESS_PREEMPT_PERIOD       7U
+#define STRESS_PREEMPT_TIMER_US     20
+
+/* TRACER_EMB_Add latency histogram */
+#define STRESS_HISTO_STEP_NS        25U
+#define STRESS_HISTO_SIZE           4000U
+
+#define STRESS_DRAIN_TIMEOUT_NS     5000000000ULL
+#define STRESS_WATCHDOG_S           60
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t id;
+  uint32_t records;
+  uint32_t produced;
+  uint64_t add_count;
+  uint64_t add_total_ns;
+  uint64_t add_max_ns;
+  uint32_t histo[STRESS_HISTO_SIZE + 1U];
+} stress_producer_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t stress_overflow[] = {0x5AU, 'O', 'V', 'F'};
+
+/* DMA emulation */
+static const uint8_t *volatile stress_dma_data;
+static volatile uint32_t stress_dma_size;
+static volatile uint32_t stress_dma_pending;
+static volatile uint32_t stress_dma_stop;
+static volatile uint32_t stress_dma_errors;
+static uint32_t stress_byte_ns;
+static uint8_t *stress_output;
+static size_t stress_output_size;
+static volatile size_t stress_output_len;
+static volatile uint64_t stress_output_end_ns;
+
+/* PRIMASK emulation, the masked sections being timed in the second run only */
+static uint32_t stress_masked_timing;
+static volatile uint32_t stress_irq_owned;
+static __thread uint32_t stress_primask;
+static __thread uint64_t stress_masked_start;
+static uint64_t stress_masked_count;
+static uint64_t stress_masked_total_ns;
+static uint64_t stress_masked_max_ns;
+
+static uint32_t stress_preempt_enabled;
+static __thread uint32_t stress_preempt_count;
+
+/* LDREX/STREX emulation */
+static volatile uint32_t stress_excl_lock;
+static volatile uint32_t stress_excl_generation;
+static __thread volatile uint32_t *stress_excl_addr;
+static __thread uint32_t stress_excl_tag;
+
+/* Private functions ---------------------------------------------------------*/
+static uint64_t stress_now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static void stress_max(uint64_t *p_max, uint64_t value)
+{
+  uint64_t current = __atomic_load_n(p_max, __ATOMIC_RELAXED);
+
+  while ((value > current)
+         && !__atomic_compare_exchange_n(p_max, &current, value, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+  {
+  }
+}
+
+static void stress_preempt(void)
+{
+  stress_preempt_count++;
+  if ((stress_preempt_enabled != 0U) && ((stress_preempt_count % STRESS_PREEMPT_PERIOD) == 0U))
+  {
+    (void)sched_yield();
+  }
+}
+
+static void stress_signal(int sig)
+{
+  (void)sig;
+  (void)sched_yield();
+}
+
+static void *stress_watchdog(void *arg)
+{
+  struct timespec delay = {STRESS_WATCHDOG_S, 0};
+
+  (void)arg;
+  while (nanosleep(&delay, &delay) != 0)
+  {
+    /* interrupted by the preemption timer */
+  }
+  printf("timeout\nFAILED\n");
+  fflush(stdout);
+  _exit(1);
+}
+
+static void stress_preempt_timer(long period_us)
+{
+  struct itimerval timer = {{0, period_us}, {0, period_us}};
+
+  (void)setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+static uint8_t stress_payload(uint32_t writer, uint32_t sequence, uint32_t index)
+{
+  return (uint8_t)((writer * 31U) + (sequence * 7U) + index);
+}
+
+static uint32_t stress_build(uint8_t *p_record, uint32_t writer, uint32_t sequence)
+{
+  uint32_t length = STRESS_MIN_LENGTH + ((sequence * 5U) % (STRESS_MAX_LENGTH - STRESS_MIN_LENGTH + 1U));
+  uint32_t index;
+
+  p_record[0] = STRESS_RECORD_MAGIC;
+  p_record[1] = (uint8_t)writer;
+  p_record[2] = (uint8_t)length;
+  p_record[3] = (uint8_t)sequence;
+  p_record[4] = (uint8_t)(sequence >> 8);
+  for (index = STRESS_HEADER_SIZE; index < length; index++)
+  {
+    p_record[index] = stress_payload(writer, sequence, index);
+  }
+  return length;
+}
+
+/**
+  * @brief  Interrupt masking : one thread at a time owns PRIMASK, the other ones wait as the interrupts of an MCU
+  */
+uint32_t __get_PRIMASK(void)
+{
+  return stress_primask;
+}
+
+void __disable_irq(void)
+{
+  if (stress_primask == 0U)
+  {
+    while (__atomic_exchange_n(&stress_irq_owned, 1U, __ATOMIC_ACQUIRE) != 0U)
+    {
+      (void)sched_yield();
+    }
+    stress_primask = 1U;
+    stress_masked_start = (stress_masked_timing != 0U) ? stress_now_ns() : 0U;
+  }
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+  uint64_t elapsed;
+
+  if (priMask != 0U)
+  {
+    __disable_irq();
+  }
+  else if (stress_primask != 0U)
+  {
+    elapsed = (stress_masked_timing != 0U) ? (stress_now_ns() - stress_masked_start) : 0U;
+    (void)__atomic_fetch_add(&stress_masked_count, 1U, __ATOMIC_RELAXED);
+    (void)__atomic_fetch_add(&stress_masked_total_ns, elapsed, __ATOMIC_RELAXED);
+    stress_max(&stress_masked_max_ns, elapsed);
+    stress_primask = 0U;
+    __atomic_store_n(&stress_irq_owned, 0U, __ATOMIC_RELEASE);
+    stress_preempt();
+  }
+  else
+  {
+    /* interrupts already enabled */
+  }
+}
+
+/**
+  * @brief  Exclusive accesses : a store-exclusive fails if any store-exclusive succeeded since the load-exclusive,
+  *         as the local monitor of a core is cleared by the exception entries and returns
+  */
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  stress_excl_tag = __atomic_load_n(&stress_excl_generation, __ATOMIC_SEQ_CST);
+  stress_excl_addr = addr;
+  return __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+}
+
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  uint32_t status = 1U;
+
+  if (stress_excl_addr == addr)
+  {
+    while (__atomic_exchange_n(&stress_excl_lock, 1U, __ATOMIC_ACQUIRE) != 0U)
+    {
+      (void)sched_yield();
+    }
+    if (stress_excl_generation == stress_excl_tag)
+    {
+      __atomic_store_n(addr, value, __ATOMIC_SEQ_CST);
+      __atomic_store_n(&stress_excl_generation, stress_excl_tag + 1U, __ATOMIC_SEQ_CST);
+      status = 0U;
+    }
+    __atomic_store_n(&stress_excl_lock, 0U, __ATOMIC_RELEASE);
+  }
+  stress_excl_addr = NULL;
+  if (status == 0U)
+  {
+    stress_preempt();
+  }
+  return status;
+}
+
+void __CLREX(void)
+{
+  stress_excl_addr = NULL;
+}
+
+void __DMB(void)
+{
+  stress_preempt();
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**
+  * @brief  Trace bus : the DMA thread copies the transfers to the output then calls the transfer complete callback
+  */
+void HW_TRACER_EMB_Init(void)
+{
+}
+
+void HW_TRACER_EMB_DeInit(void)
+{
+}
+
+void HW_TRACER_EMB_RegisterRxCallback(void (*callbackRX)(uint8_t, uint8_t))
+{
+  (void)callbackRX;
+}
+
+void HW_TRACER_EMB_IRQHandlerDMA(void)
+{
+}
+
+void HW_TRACER_EMB_IRQHandlerUSART(void)
+{
+}
+
+void HW_TRACER_EMB_StartRX(void)
+{
+}
+
+uint8_t HW_TRACER_EMB_ReadData(void)
+{
+  return 0U;
+}
+
+void HW_TRACER_EMB_SendData(const uint8_t *data, uint32_t size)
+{
+  if (__atomic_load_n(&stress_dma_pending, __ATOMIC_SEQ_CST) != 0U)
+  {
+    /* two transfers at the same time */
+    (void)__atomic_fetch_add(&stress_dma_errors, 1U, __ATOMIC_RELAXED);
+    return;
+  }
+  if ((stress_output_len + size) > stress_output_size)
+  {
+    (void)__atomic_fetch_add(&stress_dma_errors, 1U, __ATOMIC_RELAXED);
+    return;
+  }
+
+  /* the data are read when the transfer starts : a record not completed yet is detected by the output parsing */
+  memcpy(&stress_output[stress_output_len], data, size);
+  stress_dma_data = data;
+  stress_dma_size = size;
+  __atomic_store_n(&stress_dma_pending, 1U, __ATOMIC_SEQ_CST);
+}
+
+static void *stress_dma(void *arg)
+{
+  uint64_t start;
+
+  (void)arg;
+  while ((__atomic_load_n(&stress_dma_stop, __ATOMIC_SEQ_CST) == 0U)
+         || (__atomic_load_n(&stress_dma_pending, __ATOMIC_SEQ_CST) != 0U))
+  {
+    if (__atomic_load_n(&stress_dma_pending, __ATOMIC_SEQ_CST) == 0U)
+    {
+      (void)sched_yield();
+      continue;
+    }
+
+    /* transfer time of the link */
+    start = stress_now_ns();
+    while ((stress_now_ns() - start) < ((uint64_t)stress_dma_size * stress_byte_ns))
+    {
+    }
+
+    /* and the data must not be overwritten before the end of the transfer */
+    if (memcmp(&stress_output[stress_output_len], (const void *)stress_dma_data, stress_dma_size) != 0)
+    {
+      if (stress_dma_errors == 0U)
+      {
+        printf("data modified during the transfer at offset %zu\n", stress_output_len);
+      }
+      (void)__atomic_fetch_add(&stress_dma_errors, 1U, __ATOMIC_RELAXED);
+    }
+    stress_output_len += stress_dma_size;
+
+    stress_output_end_ns = stress_now_ns();
+    __atomic_store_n(&stress_dma_pending, 0U, __ATOMIC_SEQ_CST);
+    TRACER_EMB_CALLBACK_TX();
+  }
+  return NULL;
+}
+
+/**
+  * @brief  Producer : records added with TRACER_EMB_Add, and records written through TRACER_EMB_Lock,
+  *         TRACER_EMB_AllocateBufer, TRACER_EMB_WriteData and TRACER_EMB_UnLock with a TRACER_EMB_Add record
+  *         in the middle, as a trace of an interrupt preempting the writer
+  */
+static void *stress_producer(void *arg)
+{
+  stress_producer_t *p_producer = (stress_producer_t *)arg;
+  const uint32_t nested = p_producer->id + STRESS_MAX_PRODUCERS;
+  uint8_t record[STRESS_MAX_LENGTH];
+  uint8_t nested_record[STRESS_MAX_LENGTH];
+  uint32_t nested_sequence = 0U;
+  uint32_t sequence;
+  uint32_t length;
+  uint32_t index;
+  uint64_t start;
+  uint64_t elapsed;
+  int32_t pos;
+
+  for (sequence = 0U; sequence < p_producer->records; sequence++)
+  {
+    length = stress_build(record, p_producer->id, sequence);
+
+    if ((sequence % STRESS_LOCKED_PERIOD) == 0U)
+    {
+      TRACER_EMB_Lock();
+      pos = TRACER_EMB_AllocateBufer(length);
+      for (index = 0U; (pos != -1) && (index < (length / 2U)); index++)
+      {
+        TRACER_EMB_WriteData((uint16_t)((uint32_t)pos + index), record[index]);
+      }
+
+      TRACER_EMB_Add(nested_record, stress_build(nested_record, nested, nested_sequence));
+      nested_sequence++;
+      if (stress_preempt_enabled != 0U)
+      {
+        (void)sched_yield();
+      }
+
+      for (index = length / 2U; (pos != -1) && (index < length); index++)
+      {
+        TRACER_EMB_WriteData((uint16_t)((uint32_t)pos + index), record[index]);
+      }
+      TRACER_EMB_UnLock();
+      TRACER_EMB_SendData();
+      p_producer->produced += 2U;
+    }
+    else
+    {
+      start = stress_now_ns();
+      TRACER_EMB_Add(record, length);
+      elapsed = stress_now_ns() - start;
+
+      p_producer->add_count++;
+      p_producer->add_total_ns += elapsed;
+      p_producer->add_max_ns = (elapsed > p_producer->add_max_ns) ? elapsed : p_producer->add_max_ns;
+      p_producer->histo[(elapsed / STRESS_HISTO_STEP_NS < STRESS_HISTO_SIZE) ?
+                        (elapsed / STRESS_HISTO_STEP_NS) : STRESS_HISTO_SIZE]++;
+      p_producer->produced++;
+    }
+
+    /* more interleavings of the producers on a single core host */
+    if ((sequence % 64U) == 63U)
+    {
+      (void)sched_yield();
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief  Parse the output : every byte belongs to an intact record or to an overflow message, and the records
+  *         of a writer are received in the order they were written
+  * @retval number of corrupted or out of order records
+  */
+static uint32_t stress_parse(uint64_t *p_records, uint64_t *p_overflows)
+{
+  int32_t last_sequence[STRESS_WRITERS];
+  const uint8_t *p_record;
+  uint32_t writer;
+  uint32_t length;
+  uint32_t sequence;
+  uint32_t index;
+  size_t pos = 0U;
+
+  for (index = 0U; index < STRESS_WRITERS; index++)
+  {
+    last_sequence[index] = -1;
+  }
+
+  while (pos < stress_output_len)
+  {
+    p_record = &stress_output[pos];
+    if (((stress_output_len - pos) >= sizeof(stress_overflow))
+        && (memcmp(p_record, stress_overflow, sizeof(stress_overflow)) == 0))
+    {
+      (*p_overflows)++;
+      pos += sizeof(stress_overflow);
+      continue;
+    }
+
+    if (((stress_output_len - pos) < STRESS_HEADER_SIZE) || (p_record[0] != STRESS_RECORD_MAGIC))
+    {
+      printf("corrupted output at offset %zu\n", pos);
+      return 1U;
+    }
+    writer = p_record[1];
+    length = p_record[2];
+    sequence = (uint32_t)p_record[3] | ((uint32_t)p_record[4] << 8);
+    if ((writer >= STRESS_WRITERS) || (length < STRESS_MIN_LENGTH) || (length > STRESS_MAX_LENGTH)
+        || ((stress_output_len - pos) < length) || ((int32_t)sequence <= last_sequence[writer]))
+    {
+      printf("bad record header at offset %zu (writer %u, length %u, sequence %u)\n", pos, writer, length, sequence);
+      return 1U;
+    }
+    for (index = STRESS_HEADER_SIZE; index < length; index++)
+    {
+      if (p_record[index] != stress_payload(writer, sequence, index))
+      {
+        printf("corrupted record at offset %zu (writer %u, sequence %u)\n", pos, writer, sequence);
+        return 1U;
+      }
+    }
+    last_sequence[writer] = (int32_t)sequence;
+    (*p_records)++;
+    pos += length;
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Run the producers until they have all added their records, then send the records left in the buffer
+  * @retval number of errors
+  */
+static uint32_t stress_run(stress_producer_t *p_producers, uint32_t producer_nb, uint32_t records, uint32_t verbose)
+{
+  pthread_t threads[STRESS_MAX_PRODUCERS];
+  pthread_t dma_thread;
+  const struct timespec drain_delay = {0, 1000000};
+  uint64_t produced = 0U;
+  uint64_t received = 0U;
+  uint64_t overflows = 0U;
+  uint64_t add_count = 0U;
+  uint64_t add_total_ns = 0U;
+  uint64_t add_max_ns = 0U;
+  uint64_t add_p99_ns = 0U;
+  uint64_t histo_sum = 0U;
+  uint64_t start;
+  uint64_t produce_ns;
+  uint64_t drain_start;
+  size_t last_len;
+  uint32_t dropped;
+  uint32_t errors;
+  uint32_t index;
+  uint32_t bucket;
+
+  (void)memset(p_producers, 0, producer_nb * sizeof(stress_producer_t));
+  stress_output_len = 0U;
+  stress_dma_stop = 0U;
+  stress_dma_errors = 0U;
+  stress_masked_count = 0U;
+  stress_masked_total_ns = 0U;
+  stress_masked_max_ns = 0U;
+
+  TRACER_EMB_Init();
+  (void)TRACER_EMB_EnableOverFlow(stress_overflow, (uint8_t)sizeof(stress_overflow));
+
+  (void)pthread_create(&dma_thread, NULL, stress_dma, NULL);
+  if (stress_preempt_enabled != 0U)
+  {
+    stress_preempt_timer(STRESS_PREEMPT_TIMER_US);
+  }
+  start = stress_now_ns();
+  for (index = 0U; index < producer_nb; index++)
+  {
+    p_producers[index].id = index;
+    p_producers[index].records = records;
+    (void)pthread_create(&threads[index], NULL, stress_producer, &p_producers[index]);
+  }
+  for (index = 0U; index < producer_nb; index++)
+  {
+    (void)pthread_join(threads[index], NULL);
+    produced += p_producers[index].produced;
+  }
+  produce_ns = stress_now_ns() - start;
+  stress_preempt_timer(0);
+
+  /* the committed records are all sent once the output stops growing without transfer in progress */
+  drain_start = stress_now_ns();
+  do
+  {
+    last_len = stress_output_len;
+    TRACER_EMB_SendData();
+    (void)nanosleep(&drain_delay, NULL);
+  } while (((last_len != stress_output_len) || (__atomic_load_n(&stress_dma_pending, __ATOMIC_SEQ_CST) != 0U))
+           && ((stress_now_ns() - drain_start) < STRESS_DRAIN_TIMEOUT_NS));
+  __atomic_store_n(&stress_dma_stop, 1U, __ATOMIC_SEQ_CST);
+  (void)pthread_join(dma_thread, NULL);
+
+  errors = stress_parse(&received, &overflows);
+  dropped = TRACER_EMB_GetDropCounter();
+  if (stress_dma_errors != 0U)
+  {
+    printf("%u transfers failed : started while the DMA was busy, past the output or modified\n", stress_dma_errors);
+    errors++;
+  }
+  if ((received + dropped) != produced)
+  {
+    printf("records lost : %llu received + %u dropped != %llu produced\n", (unsigned long long)received, dropped,
+           (unsigned long long)produced);
+    errors++;
+  }
+
+  if (verbose == 0U)
+  {
+    return errors;
+  }
+
+  for (index = 0U; index < producer_nb; index++)
+  {
+    add_count += p_producers[index].add_count;
+    add_total_ns += p_producers[index].add_total_ns;
+    add_max_ns = (p_producers[index].add_max_ns > add_max_ns) ? p_producers[index].add_max_ns : add_max_ns;
+  }
+  for (bucket = 0U; (bucket <= STRESS_HISTO_SIZE) && (histo_sum < ((add_count * 99U) / 100U)); bucket++)
+  {
+    for (index = 0U; index < producer_nb; index++)
+    {
+      histo_sum += p_producers[index].histo[bucket];
+    }
+    add_p99_ns = (uint64_t)(bucket + 1U) * STRESS_HISTO_STEP_NS;
+  }
+
+  printf("records           : %llu produced, %llu received, %u dropped, %llu overflow messages\n",
+         (unsigned long long)produced, (unsigned long long)received, dropped, (unsigned long long)overflows);
+  printf("producers         : %.2f Mrecords/s\n", (double)produced * 1000.0 / (double)produce_ns);
+  printf("link              : %.2f Mrecords/s, %.2f MB/s\n",
+         (double)received * 1000.0 / (double)(stress_output_end_ns - start),
+         (double)stress_output_len * 1000.0 / (double)(stress_output_end_ns - start));
+  if (add_p99_ns > ((uint64_t)STRESS_HISTO_SIZE * STRESS_HISTO_STEP_NS))
+  {
+    printf("TRACER_EMB_Add    : avg %.0f ns, p99 > %u ns, max %llu ns\n", (double)add_total_ns / (double)add_count,
+           STRESS_HISTO_SIZE * STRESS_HISTO_STEP_NS, (unsigned long long)add_max_ns);
+  }
+  else
+  {
+    printf("TRACER_EMB_Add    : avg %.0f ns, p99 %llu ns, max %llu ns\n",
+           (add_count != 0U) ? ((double)add_total_ns / (double)add_count) : 0.0, (unsigned long long)add_p99_ns,
+           (unsigned long long)add_max_ns);
+  }
+  return errors;
+}
+
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+/* Record headers of the lock-free mode : the build setting or the default of tracer_emb.c, one header per 8 bytes of
+   buffer, power of 2 between 8 and 128 */
+static unsigned long stress_record_number(void)
+{
+#if defined(TRACER_EMB_RECORD_NUMBER)
+  return TRACER_EMB_RECORD_NUMBER;
+#else
+  unsigned long number = 128UL;
+
+  while ((number > 8UL) && ((number * 8UL) > TRACER_EMB_BUFFER_SIZE))
+  {
+    number /= 2UL;
+  }
+  return number;
+#endif /* TRACER_EMB_RECORD_NUMBER */
+}
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  static stress_producer_t producers[STRESS_MAX_PRODUCERS];
+  pthread_t watchdog_thread;
+  const uint32_t records = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : STRESS_DEFAULT_RECORDS;
+  const uint32_t producer_nb = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : STRESS_DEFAULT_PRODUCERS;
+  uint32_t errors;
+
+  stress_byte_ns = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : 0U;
+  if ((records == 0U) || (records > STRESS_MAX_RECORDS) || (producer_nb == 0U) || (producer_nb > STRESS_MAX_PRODUCERS))
+  {
+    fprintf(stderr, "usage: %s [RECORDS (1-%u) [PRODUCERS (1-%u) [BYTE_NS]]]\n", argv[0], STRESS_MAX_RECORDS,
+            STRESS_MAX_PRODUCERS);
+    return 2;
+  }
+
+  (void)signal(SIGALRM, stress_signal);
+  (void)pthread_create(&watchdog_thread, NULL, stress_watchdog, NULL);
+
+  stress_output_size = (size_t)records * producer_nb * 2U * (STRESS_MAX_LENGTH + sizeof(stress_overflow));
+  stress_output = malloc(stress_output_size);
+  if (stress_output == NULL)
+  {
+    fprintf(stderr, "no memory for the output\n");
+    return 2;
+  }
+
+  printf("TRACER_EMB stress, %s, %u producers x %u records, buffer %lu bytes",
+         (TRACER_EMB_LOCKFREE_MODE == 1UL) ? "lock-free mode" : "interrupt masking mode", producer_nb, records,
+         (unsigned long)TRACER_EMB_BUFFER_SIZE);
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  printf(", %lu record headers", stress_record_number());
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
+  printf(", link %u ns/byte\n", stress_byte_ns);
+
+  /* first run : throughput and latency, without the time stamps of the masked sections */
+  stress_masked_timing = 0U;
+  stress_preempt_enabled = 0U;
+  errors = stress_run(producers, producer_nb, records, 1U);
+
+  /* second run : masked sections timed, writers preempted inside the tracer */
+  stress_masked_timing = 1U;
+  stress_preempt_enabled = 1U;
+  errors += stress_run(producers, producer_nb, records, 0U);
+  printf("interrupts masked : %llu sections, total %.1f us, max %llu ns\n", (unsigned long long)stress_masked_count,
+         (double)stress_masked_total_ns / 1000.0, (unsigned long long)stress_masked_max_ns);
+
+  printf("%s\n", (errors == 0U) ? "PASSED" : "FAILED");
+
+  free(stress_output);
+  return (errors == 0U) ? 0 : 1;
+}
@@ -63,6 +63,20 @@ typedef enum
   * @}
   */
 
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+/** @defgroup TRACER_EMB_Private_TypeDef EMB TRACER Private typedef
+  * @{
+  */
+typedef struct
+{
+  __IO uint16_t End;              /* write position following the record */
+  __IO uint8_t Status;            /* TRACER_RECORD_xxx value */
+} TRACER_RecordTypedef_t;
+/**
+  * @}
+  */
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
+
 /** @defgroup TRACER_EMB_Private_TypeDef EMB TRACER Private typedef
   * @{
   */
@@ -76,7 +90,14 @@ typedef struct
   const uint8_t *OverFlow_Data;
   uint8_t OverFlow_Size;
   uint8_t discontinue;
-  TRACER_OverFlowTypedef OverFlow_Status;
+  __IO uint32_t OverFlow_Status;  /* TRACER_OverFlowTypedef value */
+  __IO uint32_t Drop_Counter;     /* number of traces dropped for lack of space */
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  __IO uint32_t State;            /* number of writers in progress, record write index and write position */
+  __IO uint32_t TxBusy;           /* 1 when a transfer is owned by a context */
+  uint32_t RecordRead;            /* index of the first record not sent */
+  uint32_t RecordSent;            /* number of records completed by the transfer in progress */
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
   uint8_t PtrDataTx[TRACER_EMB_BUFFER_SIZE];
 } TRACER_ContextTypedef_t;
 /**
@@ -84,6 +105,53 @@ typedef struct
   */
 
 /* Private define ------------------------------------------------------------*/
+#if !defined(TRACER_EMB_LOCKFREE_MODE)
+#define TRACER_EMB_LOCKFREE_MODE 0UL
+#endif /* TRACER_EMB_LOCKFREE_MODE */
+
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+#if !defined(__ARM_ARCH_7M__) && !defined(__ARM_ARCH_7EM__) \
+ && !defined(__ARM_ARCH_8M_BASE__) && !defined(__ARM_ARCH_8M_MAIN__) && !defined(__ARM_ARCH_8_1M_MAIN__)
+#error "TRACER_EMB_LOCKFREE_MODE requires a core supporting the LDREX/STREX instructions"
+#endif /* __ARM_ARCH_xx__ */
+#if TRACER_EMB_BUFFER_SIZE > 65536UL
+#error "TRACER_EMB_LOCKFREE_MODE requires a TRACER_EMB_BUFFER_SIZE lower than or equal to 65536"
+#endif /* TRACER_EMB_BUFFER_SIZE */
+
+/* One record header per 8 bytes of buffer by default : the headers are not exhausted before the bytes */
+#if !defined(TRACER_EMB_RECORD_NUMBER)
+#if TRACER_EMB_BUFFER_SIZE >= 1024UL
+#define TRACER_EMB_RECORD_NUMBER 128UL
+#elif TRACER_EMB_BUFFER_SIZE >= 512UL
+#define TRACER_EMB_RECORD_NUMBER 64UL
+#elif TRACER_EMB_BUFFER_SIZE >= 256UL
+#define TRACER_EMB_RECORD_NUMBER 32UL
+#elif TRACER_EMB_BUFFER_SIZE >= 128UL
+#define TRACER_EMB_RECORD_NUMBER 16UL
+#else
+#define TRACER_EMB_RECORD_NUMBER 8UL
+#endif /* TRACER_EMB_BUFFER_SIZE */
+#endif /* TRACER_EMB_RECORD_NUMBER */
+#if (TRACER_EMB_RECORD_NUMBER < 2UL) || (TRACER_EMB_RECORD_NUMBER > 128UL) \
+ || ((TRACER_EMB_RECORD_NUMBER & (TRACER_EMB_RECORD_NUMBER - 1UL)) != 0UL)
+#error "TRACER_EMB_RECORD_NUMBER must be a power of 2 between 2 and 128"
+#endif /* TRACER_EMB_RECORD_NUMBER */
+
+/* The state word holds the write position (bits 0-15), the index of the next record header (bits 16-23) and the
+   number of writers between TRACER_EMB_Lock and TRACER_EMB_UnLock (bits 24-31) : the bytes and the header of a
+   record are reserved together */
+#define TRACER_STATE_WRITE_MASK         0x0000FFFFUL
+#define TRACER_STATE_RECORD_POS         16U
+#define TRACER_STATE_RECORD_MASK        0x00FF0000UL
+#define TRACER_STATE_LOCK_POS           24U
+#define TRACER_STATE_LOCK_UNIT          (1UL << TRACER_STATE_LOCK_POS)
+
+/* Record header status : a record is sent once committed, the records being sent in the reservation order */
+#define TRACER_RECORD_FREE              0U  /* header not reserved, or record not written yet */
+#define TRACER_RECORD_COMMITTED         1U  /* record written by TRACER_EMB_Add */
+#define TRACER_RECORD_LOCKED            2U  /* record reserved by TRACER_EMB_AllocateBufer, committed when no writer is
+                                               between TRACER_EMB_Lock and TRACER_EMB_UnLock */
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 
 /* Private macro -------------------------------------------------------------*/
 /** @defgroup TRACER_EMB_Private_Macros TRACE Private Macros
@@ -102,6 +170,14 @@ typedef struct
 
 #define TRACER_LEAVE_CRITICAL_SECTION() __set_PRIMASK(primask)
 
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+#define TRACER_STATE_WRITE(_STATE_)     ((_STATE_) & TRACER_STATE_WRITE_MASK)
+#define TRACER_STATE_RECORD(_STATE_)    (((_STATE_) & TRACER_STATE_RECORD_MASK) >> TRACER_STATE_RECORD_POS)
+#define TRACER_STATE_LOCKED(_STATE_)    ((_STATE_) >> TRACER_STATE_LOCK_POS)
+
+#define TRACER_RECORD(_INDEX_)          TracerRecords[(_INDEX_) % TRACER_EMB_RECORD_NUMBER]
+#define TRACER_RECORD_NEXT(_INDEX_)     (((_INDEX_) + 1UL) & 0xFFUL)
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 
 
 /**
@@ -117,6 +193,15 @@ uint32_t TRACER_CallbackRX(uint8_t character, uint8_t error);
 /* Function prototypes -----------------------------------------------*/
 uint8_t TRACER_EMB_ReadData(void);
 
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+static uint32_t TRACER_AtomicAdd(__IO uint32_t *Ptr, uint32_t Value);
+static uint32_t TRACER_CompareAndSwap(__IO uint32_t *Ptr, uint32_t Expected, uint32_t Value);
+static int32_t TRACER_Reserve(uint32_t Size, uint8_t Status, uint32_t *Record);
+static uint32_t TRACER_IsRecordReady(uint32_t State, uint32_t Record);
+static uint32_t TRACER_IsDataReady(void);
+static uint32_t TRACER_StartTransfer(void);
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
+
 /**
   * @}
   */
@@ -126,6 +211,9 @@ uint8_t TRACER_EMB_ReadData(void);
   * @{
   */
 static TRACER_ContextTypedef_t TracerContext;
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+static TRACER_RecordTypedef_t TracerRecords[TRACER_EMB_RECORD_NUMBER];
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 /**
   * @}
   */
@@ -145,6 +233,9 @@ void TRACER_EMB_Init(void)
 {
   /* initialize the Ptr for Read/Write */
   (void)memset(&TracerContext, 0, sizeof(TRACER_ContextTypedef_t));
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  (void)memset(TracerRecords, 0, sizeof(TracerRecords));
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 
   /* Initialize trace BUS */
   HW_TRACER_EMB_Init();
@@ -158,7 +249,23 @@ void TRACER_EMB_Add(uint8_t *Ptr, uint32_t Size)
   int32_t _writepos;
   uint8_t *data_to_write = Ptr;
   uint32_t index;
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  uint32_t _record;
+
+  /* the record is committed by its header, without blocking the records of the other writers */
+  _writepos = TRACER_Reserve(Size, TRACER_RECORD_FREE, &_record);
+  if (_writepos != -1)
+  {
+    for (index = 0U; index < Size; index++)
+    {
+      TRACER_WRITE_DATA(_writepos, data_to_write[index]);
+    }
 
+    /* data written before the commit must be visible to the transfer */
+    __DMB();
+    TRACER_RECORD(_record).Status = TRACER_RECORD_COMMITTED;
+  }
+#else
   /* Data processing */
   TRACER_EMB_Lock();
   _writepos = TRACER_EMB_AllocateBufer(Size);
@@ -173,6 +280,7 @@ void TRACER_EMB_Add(uint8_t *Ptr, uint32_t Size)
     }
   }
   TRACER_EMB_UnLock();
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 
   /* Tx processing */
   TRACER_EMB_SendData();
@@ -216,6 +324,16 @@ int32_t TRACER_EMB_EnableOverFlow(const uint8_t *Data, uint8_t Size)
   return -1;
 }
 
+/**
+  * @brief  Get the number of traces dropped because the buffer was full
+  * @param  None.
+  * @retval number of dropped traces since the tracer initialization
+  */
+uint32_t TRACER_EMB_GetDropCounter(void)
+{
+  return TracerContext.Drop_Counter;
+}
+
 /**
   * @brief  Tracer read data
   * @param  None.
@@ -242,14 +360,51 @@ uint8_t TRACER_EMB_ReadData()
   */
 void TRACER_EMB_CALLBACK_TX(void)
 {
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  /* The transfer is owned by this context until TxBusy is released */
+  TracerContext.PtrTx_Read = (TracerContext.PtrTx_Read + TracerContext.SizeSent) % TRACER_EMB_BUFFER_SIZE;
+
+  /* free the headers of the records sent, before they can be reserved again */
+  while (TracerContext.RecordSent != 0U)
+  {
+    TRACER_RECORD(TracerContext.RecordRead).Status = TRACER_RECORD_FREE;
+    __DMB();
+    TracerContext.RecordRead = TRACER_RECORD_NEXT(TracerContext.RecordRead);
+    TracerContext.RecordSent--;
+  }
+
+  if ((TracerContext.OverFlow_Data != NULL) && (TracerContext.discontinue == 0U)
+      && (TRACER_CompareAndSwap(&TracerContext.OverFlow_Status, (uint32_t)TRACER_OVERFLOW_DETECTED,
+                                (uint32_t)TRACER_OVERFLOW_SENT) == 1U))
+  {
+    /* the overflow string is not part of the buffer */
+    TracerContext.SizeSent = 0U;
+    HW_TRACER_EMB_SendData(TracerContext.OverFlow_Data, TracerContext.OverFlow_Size);
+  }
+  else if (TRACER_StartTransfer() == 0U)
+  {
+    TRACER_EMB_LowPowerSendDataComplete();
+    __DMB();
+    TracerContext.TxBusy = 0U;
+
+    /* data committed since the check are sent by the first context owning the transfer */
+    TRACER_EMB_SendData();
+  }
+  else
+  {
+    /* next span is being sent */
+  }
+#else
   TRACER_DEF_CRITICAL_SECTION();
   TRACER_ENTER_CRITICAL_SECTION();
   TracerContext.PtrTx_Read = (TracerContext.PtrTx_Read + TracerContext.SizeSent) % TRACER_EMB_BUFFER_SIZE;
 
-  if ((TracerContext.OverFlow_Data != NULL) && (TracerContext.OverFlow_Status == TRACER_OVERFLOW_DETECTED)
+  if ((TracerContext.OverFlow_Data != NULL) && (TracerContext.OverFlow_Status == (uint32_t)TRACER_OVERFLOW_DETECTED)
       && (TracerContext.discontinue == 0U))
   {
-    TracerContext.OverFlow_Status = TRACER_OVERFLOW_SENT;
+    TracerContext.OverFlow_Status = (uint32_t)TRACER_OVERFLOW_SENT;
+    /* the overflow string is not part of the buffer */
+    TracerContext.SizeSent = 0U;
     TRACER_LEAVE_CRITICAL_SECTION();
     HW_TRACER_EMB_SendData(TracerContext.OverFlow_Data, TracerContext.OverFlow_Size);
   }
@@ -260,6 +415,7 @@ void TRACER_EMB_CALLBACK_TX(void)
     TRACER_EMB_UnLock();
     TRACER_EMB_SendData();
   }
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 }
 
 /**
@@ -269,10 +425,14 @@ void TRACER_EMB_CALLBACK_TX(void)
   */
 void TRACER_EMB_Lock(void)
 {
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  (void)TRACER_AtomicAdd(&TracerContext.State, TRACER_STATE_LOCK_UNIT);
+#else
   TRACER_DEF_CRITICAL_SECTION();
   TRACER_ENTER_CRITICAL_SECTION();
   TracerContext.Counter++;
   TRACER_LEAVE_CRITICAL_SECTION();
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 }
 
 /**
@@ -282,10 +442,16 @@ void TRACER_EMB_Lock(void)
   */
 void TRACER_EMB_UnLock(void)
 {
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  /* data written before the unlock must be visible to the transfer */
+  __DMB();
+  (void)TRACER_AtomicAdd(&TracerContext.State, (uint32_t)(-(int32_t)TRACER_STATE_LOCK_UNIT));
+#else
   TRACER_DEF_CRITICAL_SECTION();
   TRACER_ENTER_CRITICAL_SECTION();
   TracerContext.Counter--;
   TRACER_LEAVE_CRITICAL_SECTION();
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 }
 
 /**
@@ -296,6 +462,23 @@ void TRACER_EMB_UnLock(void)
   */
 void TRACER_EMB_SendData(void)
 {
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  /* only the context setting TxBusy starts a transfer, the other ones return immediately */
+  while (TRACER_CompareAndSwap(&TracerContext.TxBusy, 0U, 1U) == 1U)
+  {
+    if (TRACER_StartTransfer() == 1U)
+    {
+      break;
+    }
+    TracerContext.TxBusy = 0U;
+
+    /* a writer may have committed its data while the transfer was owned by this context */
+    if (TRACER_IsDataReady() == 0U)
+    {
+      break;
+    }
+  }
+#else
   uint32_t _begin;
   uint32_t _end;
 
@@ -344,6 +527,7 @@ void TRACER_EMB_SendData(void)
   }
 
   TRACER_LEAVE_CRITICAL_SECTION();
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 }
 
 /**
@@ -353,6 +537,18 @@ void TRACER_EMB_SendData(void)
   */
 int32_t TRACER_EMB_AllocateBufer(uint32_t Size)
 {
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+  uint32_t _record;
+
+  if (Size == 0U)
+  {
+    /* no record to reserve */
+    return (int32_t)TRACER_STATE_WRITE(TracerContext.State);
+  }
+
+  /* the record is committed when the writers in progress have all called TRACER_EMB_UnLock */
+  return TRACER_Reserve(Size, TRACER_RECORD_LOCKED, &_record);
+#else
   uint32_t _freesize;
   int32_t _pos = -1;
 
@@ -380,22 +576,223 @@ int32_t TRACER_EMB_AllocateBufer(uint32_t Size)
   {
     _pos = (int32_t)TracerContext.PtrTx_Write;
     TracerContext.PtrTx_Write = (TracerContext.PtrTx_Write + Size) % TRACER_EMB_BUFFER_SIZE;
-    if (TRACER_OVERFLOW_SENT == TracerContext.OverFlow_Status)
+    if ((uint32_t)TRACER_OVERFLOW_SENT == TracerContext.OverFlow_Status)
     {
-      TracerContext.OverFlow_Status = TRACER_OVERFLOW_NONE;
+      TracerContext.OverFlow_Status = (uint32_t)TRACER_OVERFLOW_NONE;
     }
   }
   else
   {
-    if (TRACER_OVERFLOW_NONE == TracerContext.OverFlow_Status)
+    TracerContext.Drop_Counter++;
+    if ((uint32_t)TRACER_OVERFLOW_NONE == TracerContext.OverFlow_Status)
     {
-      TracerContext.OverFlow_Status = TRACER_OVERFLOW_DETECTED;
+      TracerContext.OverFlow_Status = (uint32_t)TRACER_OVERFLOW_DETECTED;
     }
   }
 
   TRACER_LEAVE_CRITICAL_SECTION();
   return _pos;
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
+}
+
+#if TRACER_EMB_LOCKFREE_MODE == 1UL
+/**
+  * @brief  Add a value to a word with exclusive accesses
+  * @param  Ptr pointer on the word
+  * @param  Value value to add
+  * @retval new value of the word
+  */
+static uint32_t TRACER_AtomicAdd(__IO uint32_t *Ptr, uint32_t Value)
+{
+  uint32_t _value;
+
+  do
+  {
+    _value = __LDREXW(Ptr) + Value;
+  } while (__STREXW(_value, Ptr) != 0U);
+
+  return _value;
+}
+
+/**
+  * @brief  Replace the value of a word if it is equal to the expected one, with exclusive accesses
+  * @param  Ptr pointer on the word
+  * @param  Expected expected value of the word
+  * @param  Value new value of the word
+  * @retval 1 if the word has been updated, 0 otherwise
+  */
+static uint32_t TRACER_CompareAndSwap(__IO uint32_t *Ptr, uint32_t Expected, uint32_t Value)
+{
+  do
+  {
+    if (__LDREXW(Ptr) != Expected)
+    {
+      __CLREX();
+      return 0U;
+    }
+  } while (__STREXW(Value, Ptr) != 0U);
+
+  return 1U;
+}
+
+/**
+  * @brief  Reserve the bytes and the header of a record
+  * @param  Size size of the record
+  * @param  Status header status set at the reservation
+  * @param  Record index of the record header
+  * @retval write position inside the buffer, -1 if no space available or Size is 0.
+  */
+static int32_t TRACER_Reserve(uint32_t Size, uint8_t Status, uint32_t *Record)
+{
+  uint32_t _state;
+  uint32_t _write;
+  uint32_t _read;
+  uint32_t _record;
+  uint32_t _freesize;
+  int32_t _pos;
+
+  do
+  {
+    _pos = -1;
+    _state = __LDREXW(&TracerContext.State);
+    _write = TRACER_STATE_WRITE(_state);
+    _record = TRACER_STATE_RECORD(_state);
+    _read = TracerContext.PtrTx_Read;
+
+    if (_write >= _read)
+    {
+      _freesize = TRACER_EMB_BUFFER_SIZE - _write + _read;
+    }
+    else
+    {
+      _freesize = _read - _write;
+    }
+
+    if ((_freesize <= Size) || (Size == 0U)
+        || (((_record - TracerContext.RecordRead) & 0xFFUL) >= TRACER_EMB_RECORD_NUMBER))
+    {
+      __CLREX();
+      break;
+    }
+    _pos = (int32_t)_write;
+  } while (__STREXW((_state & ~(TRACER_STATE_WRITE_MASK | TRACER_STATE_RECORD_MASK))
+                    | (TRACER_RECORD_NEXT(_record) << TRACER_STATE_RECORD_POS)
+                    | ((_write + Size) % TRACER_EMB_BUFFER_SIZE), &TracerContext.State) != 0U);
+
+  if (_pos != -1)
+  {
+    /* the header status is TRACER_RECORD_FREE until then : the record is not sent before being completed */
+    TRACER_RECORD(_record).End = (uint16_t)((_write + Size) % TRACER_EMB_BUFFER_SIZE);
+    TRACER_RECORD(_record).Status = Status;
+    *Record = _record;
+
+    (void)TRACER_CompareAndSwap(&TracerContext.OverFlow_Status, (uint32_t)TRACER_OVERFLOW_SENT,
+                                (uint32_t)TRACER_OVERFLOW_NONE);
+  }
+  else if (Size != 0U)
+  {
+    (void)TRACER_AtomicAdd(&TracerContext.Drop_Counter, 1U);
+    (void)TRACER_CompareAndSwap(&TracerContext.OverFlow_Status, (uint32_t)TRACER_OVERFLOW_NONE,
+                                (uint32_t)TRACER_OVERFLOW_DETECTED);
+  }
+  else
+  {
+    /* empty record, nothing to send */
+  }
+  return _pos;
+}
+
+/**
+  * @brief  Check if a record is committed
+  * @param  State state word read before the record header
+  * @param  Record index of the record header
+  * @retval 1 if the record can be sent, 0 otherwise
+  */
+static uint32_t TRACER_IsRecordReady(uint32_t State, uint32_t Record)
+{
+  uint8_t _status = TRACER_RECORD(Record).Status;
+
+  return ((_status == TRACER_RECORD_COMMITTED)
+          || ((_status == TRACER_RECORD_LOCKED) && (TRACER_STATE_LOCKED(State) == 0U))) ? 1U : 0U;
+}
+
+/**
+  * @brief  Check if committed data are waiting to be sent
+  * @param  None.
+  * @retval 1 if data can be sent, 0 otherwise
+  */
+static uint32_t TRACER_IsDataReady(void)
+{
+  uint32_t _state = TracerContext.State;
+
+  __DMB();
+  return ((TRACER_STATE_RECORD(_state) != TracerContext.RecordRead)
+          && (TRACER_IsRecordReady(_state, TracerContext.RecordRead) == 1U)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Start the transfer of the committed records, the caller must own the transfer (TxBusy set)
+  * @param  None.
+  * @retval 1 if a transfer has been started, 0 otherwise
+  */
+static uint32_t TRACER_StartTransfer(void)
+{
+  uint32_t _state;
+  uint32_t _record;
+  uint32_t _begin;
+  uint32_t _end;
+  uint32_t _wrapped = 0U;
+
+  /* the record headers are read after the state word : a record reserved before a state without writer in
+     progress is complete */
+  _state = TracerContext.State;
+  __DMB();
+  _begin = TracerContext.PtrTx_Read;
+  _end = _begin;
+  _record = TracerContext.RecordRead;
+  TracerContext.RecordSent = 0U;
+
+  /* the contiguous span ends with the last committed record, the following records waiting for the next transfer */
+  while ((_record != TRACER_STATE_RECORD(_state)) && (TRACER_IsRecordReady(_state, _record) == 1U))
+  {
+    _end = TRACER_RECORD(_record).End;
+    if (_wrapped == 0U)
+    {
+      if (_end > _begin)
+      {
+        TracerContext.RecordSent++;
+      }
+      else
+      {
+        /* the record ends at the buffer end, or is completed by the transfer following the wrap */
+        TracerContext.RecordSent += (_end == 0U) ? 1U : 0U;
+        _wrapped = 1U;
+      }
+    }
+    _record = TRACER_RECORD_NEXT(_record);
+  }
+
+  if (_begin == _end)
+  {
+    return 0U;
+  }
+
+  if (_end > _begin)
+  {
+    TracerContext.SizeSent = _end - _begin;
+    TracerContext.discontinue = 0;
+  }
+  else  /* _begin > _end */
+  {
+    TracerContext.SizeSent = TRACER_EMB_BUFFER_SIZE - _begin;
+    TracerContext.discontinue = 1;
+  }
+  TRACER_EMB_LowPowerSendData();
+
+  HW_TRACER_EMB_SendData((const uint8_t *)(&(TracerContext.PtrDataTx[_begin])), TracerContext.SizeSent);
+  return 1U;
 }
+#endif /* TRACER_EMB_LOCKFREE_MODE == 1UL */
 
 __weak void TRACER_EMB_LowPowerInit(void)
 {
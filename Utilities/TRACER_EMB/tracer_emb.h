@@ -104,6 +104,12 @@ int32_t TRACER_EMB_AllocateBufer(uint32_t Size);
   */
 int32_t TRACER_EMB_EnableOverFlow(const uint8_t *Data, uint8_t Size);
 
+/**
+  * @brief  Get the number of traces dropped because the buffer was full
+  * @retval number of dropped traces since the tracer initialization
+  */
+uint32_t TRACER_EMB_GetDropCounter(void);
+
 
 void TRACER_EMB_CALLBACK_TX(void);
 
@@ -51,6 +51,16 @@ extern "C" {
 
 #define TRACER_EMB_BUFFER_SIZE                       1024UL
 
+/* Set to 1UL to manage the trace buffer with LDREX/STREX exclusive accesses instead of disabling the interrupts.
+   Requires a core implementing the exclusive accesses (not available on Cortex-M0/M0+) and a buffer size
+   lower than or equal to 65536 bytes */
+#define TRACER_EMB_LOCKFREE_MODE                     0UL
+
+/* Number of record headers of the lock-free mode (power of 2 between 2 and 128) : a trace is dropped when all the
+   records are waiting to be sent. Each record is sent once written, without waiting for the other writers.
+   When not defined, one header per 8 bytes of TRACER_EMB_BUFFER_SIZE, at most 128 */
+/* #define TRACER_EMB_RECORD_NUMBER                  128UL */
+
 /* -----------------------------------------------------------------------------
       Definitions for TRACE Hw information
 -------------------------------------------------------------------------------*/
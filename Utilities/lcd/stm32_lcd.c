@@ -65,6 +65,24 @@
          UTIL_LCD_FillCircle()
          UTIL_LCD_FillPolygon()
          UTIL_LCD_FillEllipse()
+
+   - With UTIL_LCD_BATCH_ENABLE set to 1 (stm32_lcd.h), a frame can be drawn between UTIL_LCD_BeginBatch()
+     and UTIL_LCD_EndBatch(): the pixels, lines and rectangles are queued, the ones of the same color that
+     are adjacent are coalesced into rectangles, and the queue is sent to the board driver as a few
+     FillRect/DrawHLine/DrawVLine calls. UTIL_LCD_GetDirtyRects() then gives the areas drawn in the frame.
+         UTIL_LCD_BeginBatch()
+         UTIL_LCD_EndBatch()
+         UTIL_LCD_GetDirtyRects()
+
+   - With UTIL_LCD_AA_FONT_ENABLE set to 1 (stm32_lcd.h), the text can be displayed with an anti-aliased
+     proportional font generated by Utilities/PC_Software/LCD_FontConv, the characters being expanded once
+     in the LCD pixel format in a glyph cache, then copied with one FillRGBRect per character:
+         UTIL_LCD_SetAAFont()
+         UTIL_LCD_GetAAFont()
+         UTIL_LCD_GetAAStringWidth()
+         UTIL_LCD_DisplayAAChar()
+         UTIL_LCD_DisplayAAStringAt()
+         UTIL_LCD_ClearGlyphCache()
 ------------------------------------------------------------------------------*/
 
 /* Includes ------------------------------------------------------------------*/
@@ -106,6 +124,14 @@
                                      (((((Color & 0xFF00U) >> 8) >>2) & 0x3FU) << 5) |\
                                      (((((Color & 0xFF0000U) >> 16) >>3) & 0x1FU) << 11))
 
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+#define BATCH_PIXEL_DEPTH      8U     /* Queued rectangles checked to coalesce a pixel */
+#define BATCH_FILL_MIN_AREA    16U    /* Smaller rectangles are drawn pixel per pixel, cheaper than a fill */
+#define CHAR_BUFFER_ROWS       24U    /* Character rows sent at once to the driver */
+#else
+#define CHAR_BUFFER_ROWS       1U
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
 #define CONVERTRGB5652ARGB8888(Color)(((((((Color >> 11) & 0x1FU) * 527) + 23) >> 6) << 16) |\
                                      ((((((Color >> 5) & 0x3FU) * 259) + 33) >> 6) << 8) |\
                                      ((((Color & 0x1FU) * 527) + 23) >> 6) | 0xFF000000)
@@ -127,6 +153,36 @@ typedef struct
   uint32_t y3;
 }Triangle_Positions_t;
 
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+typedef struct
+{
+  UTIL_LCD_Rect_t Area;
+  uint32_t        Color; /* Color in the LCD pixel format */
+}Batch_Rect_t;
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+typedef struct
+{
+  const uint8_t *pData;    /* Next RLE byte */
+  uint32_t       Count;    /* Pixels left in the current run */
+  uint32_t       Coverage; /* Coverage of the current pixel */
+  uint32_t       Literal;  /* 1 when the coverages of the run follow in the data */
+  uint32_t       Nibble;   /* 1 when the next literal coverage is the low nibble */
+}Rle_Decoder_t;
+
+typedef struct
+{
+  const sFONT_AA *pFont;
+  uint32_t        Code;
+  uint32_t        TextColor;
+  uint32_t        BackColor;
+  uint32_t        PixelFormat;
+  uint32_t        Offset;   /* Offset of the character cell in GlyphCachePool, in words */
+  uint32_t        Size;     /* Size of the character cell, in words */
+}Glyph_Cache_Entry_t;
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
+
 /**
   * @}
   */
@@ -141,6 +197,49 @@ typedef struct
 static UTIL_LCD_Ctx_t DrawProp[UTIL_LCD_MAX_LAYERS_NBR];
 static LCD_UTILS_Drv_t FuncDriver;
 
+/**
+  * @brief  Character rows buffer, in the LCD pixel format
+  */
+static uint32_t CharBuffer[24U * CHAR_BUFFER_ROWS];
+
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+/**
+  * @brief  Drawing batch and dirty rectangles
+  */
+static uint32_t BatchActive;
+static uint32_t BatchCount;
+static Batch_Rect_t BatchQueue[UTIL_LCD_BATCH_SIZE];
+static uint32_t DirtyCount;
+static UTIL_LCD_Rect_t DirtyRects[UTIL_LCD_DIRTY_RECT_NBR + 1U];
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+/**
+  * @brief  Anti-aliased text colors for the 16 coverage values, in the LCD pixel format
+  */
+static uint32_t AAPalette[16];
+static uint32_t AAPaletteTextColor;
+static uint32_t AAPaletteBackColor;
+static uint32_t AAPalettePixelFormat = 0xFFFFFFFFU;
+
+/**
+  * @brief  Character row buffer, for the characters not cached
+  */
+static uint32_t AALine[UTIL_LCD_AA_FONT_MAX_WIDTH];
+
+#if (UTIL_LCD_GLYPH_CACHE_SIZE > 0U)
+/**
+  * @brief  Glyph cache: expanded character cells allocated one after the other in the pool used as a ring,
+  *         the entries being kept in the allocation order (GlyphCacheFirst is the oldest one)
+  */
+static uint32_t GlyphCachePool[UTIL_LCD_GLYPH_CACHE_SIZE / 4U];
+static Glyph_Cache_Entry_t GlyphCache[UTIL_LCD_GLYPH_CACHE_NBR];
+static uint32_t GlyphCacheFirst;
+static uint32_t GlyphCacheCount;
+static uint32_t GlyphCacheHead;     /* Offset of the next cell in GlyphCachePool, in words */
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
+
 /**
   * @}
   */
@@ -150,6 +249,31 @@ static LCD_UTILS_Drv_t FuncDriver;
   */
 static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData);
 static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color);
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+static uint32_t ConvertColor(uint32_t Color);
+static uint32_t ClipRect(UTIL_LCD_Rect_t *pRect);
+static uint32_t RectArea(const UTIL_LCD_Rect_t *pRect);
+static uint32_t RectOverlap(const UTIL_LCD_Rect_t *pRect1, const UTIL_LCD_Rect_t *pRect2);
+static uint32_t RectMergeable(const UTIL_LCD_Rect_t *pRect1, const UTIL_LCD_Rect_t *pRect2);
+static void RectUnion(UTIL_LCD_Rect_t *pRect, const UTIL_LCD_Rect_t *pAdd);
+static uint32_t BatchDraw(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color, uint32_t Depth);
+static void BatchFlush(void);
+static void DirtyAdd(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+static void DirtyMerge(uint32_t Index);
+static void DirtyReduce(void);
+#endif /* UTIL_LCD_BATCH_ENABLE */
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+static const sGLYPH_AA *AAFontGlyph(const sFONT_AA *pFont, uint32_t Code);
+static void AAFontPalette(void);
+static void AAFontDecoderInit(Rle_Decoder_t *pDecoder, const sFONT_AA *pFont, const sGLYPH_AA *pGlyph);
+static uint32_t AAFontDecode(Rle_Decoder_t *pDecoder);
+static void AAFontExpand(const sGLYPH_AA *pGlyph, Rle_Decoder_t *pDecoder, uint32_t Row, uint32_t Rows,
+                         uint32_t Width, uint32_t *pDest);
+#if (UTIL_LCD_GLYPH_CACHE_SIZE > 0U)
+static uint32_t *GlyphCacheGet(const sFONT_AA *pFont, uint32_t Code, const sGLYPH_AA *pGlyph);
+static uint32_t GlyphCacheAlloc(uint32_t Size);
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
 /**
   * @}
   */
@@ -189,6 +313,9 @@ void UTIL_LCD_SetFuncDriver(const LCD_UTILS_Drv_t *pDrv)
   */
 void UTIL_LCD_SetLayer(uint32_t Layer)
 {
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  BatchFlush();
+#endif /* UTIL_LCD_BATCH_ENABLE */
   if(FuncDriver.SetLayer != NULL)
   {
     if(FuncDriver.SetLayer(DrawProp->LcdDevice, Layer) == 0)
@@ -204,6 +331,9 @@ void UTIL_LCD_SetLayer(uint32_t Layer)
   */
 void UTIL_LCD_SetDevice(uint32_t Device)
 {
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  BatchFlush();
+#endif /* UTIL_LCD_BATCH_ENABLE */
   DrawProp->LcdDevice = Device;
   FuncDriver.GetXSize(Device, &DrawProp->LcdXsize);
   FuncDriver.GetYSize(Device, &DrawProp->LcdYsize);
@@ -272,6 +402,10 @@ sFONT *UTIL_LCD_GetFont(void)
   */
 void UTIL_LCD_FillRGBRect(uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
 {
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  BatchFlush();
+  DirtyAdd(Xpos, Ypos, Width, Height);
+#endif /* UTIL_LCD_BATCH_ENABLE */
   /* Write RGB rectangle data */
   FuncDriver.FillRGBRect(DrawProp->LcdDevice, Xpos, Ypos, pData, Width, Height);
 }
@@ -285,14 +419,19 @@ void UTIL_LCD_FillRGBRect(uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t
   */
 void UTIL_LCD_DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
-  /* Write line */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  if(BatchDraw(Xpos, Ypos, Length, 1U, Color, UTIL_LCD_BATCH_SIZE) == 0U)
+#endif /* UTIL_LCD_BATCH_ENABLE */
   {
-    FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
-  }
-  else
-  {
-    FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
+    /* Write line */
+    if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+    {
+      FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
+    }
+    else
+    {
+      FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
+    }
   }
 }
 
@@ -305,14 +444,19 @@ void UTIL_LCD_DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t
   */
 void UTIL_LCD_DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
-  /* Write line */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  if(BatchDraw(Xpos, Ypos, 1U, Length, Color, UTIL_LCD_BATCH_SIZE) == 0U)
+#endif /* UTIL_LCD_BATCH_ENABLE */
   {
-    FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
-  }
-  else
-  {
-    FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
+    /* Write line */
+    if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+    {
+      FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
+    }
+    else
+    {
+      FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
+    }
   }
 }
 
@@ -324,6 +468,9 @@ void UTIL_LCD_DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t
   */
 void UTIL_LCD_GetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t *Color)
 {
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  BatchFlush();
+#endif /* UTIL_LCD_BATCH_ENABLE */
   /* Get Pixel */
   FuncDriver.GetPixel(DrawProp->LcdDevice, Xpos, Ypos, Color);
   if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
@@ -340,14 +487,19 @@ void UTIL_LCD_GetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t *Color)
   */
 void UTIL_LCD_SetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Color)
 {
-  /* Set Pixel */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
-  {
-    FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, CONVERTARGB88882RGB565(Color));
-  }
-  else
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  if(BatchDraw(Xpos, Ypos, 1U, 1U, Color, BATCH_PIXEL_DEPTH) == 0U)
+#endif /* UTIL_LCD_BATCH_ENABLE */
   {
-    FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, Color);
+    /* Set Pixel */
+    if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+    {
+      FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, CONVERTARGB88882RGB565(Color));
+    }
+    else
+    {
+      FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, Color);
+    }
   }
 }
 
@@ -711,6 +863,16 @@ void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
   */
 void UTIL_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pData)
 {
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  uint32_t width, height;
+
+  BatchFlush();
+
+  /* Get the bitmap size from the BMP header */
+  width  = pData[18] + ((uint32_t)pData[19] << 8) + ((uint32_t)pData[20] << 16) + ((uint32_t)pData[21] << 24);
+  height = pData[22] + ((uint32_t)pData[23] << 8) + ((uint32_t)pData[24] << 16) + ((uint32_t)pData[25] << 24);
+  DirtyAdd(Xpos, Ypos, width, height);
+#endif /* UTIL_LCD_BATCH_ENABLE */
   FuncDriver.DrawBitmap(DrawProp->LcdDevice, Xpos, Ypos, pData);
 }
 
@@ -724,14 +886,19 @@ void UTIL_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pData)
   */
 void UTIL_LCD_FillRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
 {
-  /* Fill the rectangle */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
-  {
-    FuncDriver.FillRect(DrawProp->LcdDevice, Xpos, Ypos, Width, Height, CONVERTARGB88882RGB565(Color));
-  }
-  else
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+  if(BatchDraw(Xpos, Ypos, Width, Height, Color, UTIL_LCD_BATCH_SIZE) == 0U)
+#endif /* UTIL_LCD_BATCH_ENABLE */
   {
-    FuncDriver.FillRect(DrawProp->LcdDevice, Xpos, Ypos, Width, Height, Color);
+    /* Fill the rectangle */
+    if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+    {
+      FuncDriver.FillRect(DrawProp->LcdDevice, Xpos, Ypos, Width, Height, CONVERTARGB88882RGB565(Color));
+    }
+    else
+    {
+      FuncDriver.FillRect(DrawProp->LcdDevice, Xpos, Ypos, Width, Height, Color);
+    }
   }
 }
 
@@ -861,6 +1028,8 @@ void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
     positions.y3 = y_center;
     FillTriangle(&positions, Color);
 
+#if (UTIL_LCD_BATCH_ENABLE == 0U)
+    /* Fill the gaps left by the lines drawn from the first vertex */
     positions.x2 = x_center;
     positions.y2 = y_center;
     positions.x3 = X2;
@@ -874,6 +1043,7 @@ void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
     positions.x3 = X;
     positions.y3 = Y;
     FillTriangle(&positions, Color);
+#endif /* UTIL_LCD_BATCH_ENABLE */
   }
 
     positions.x1 = x_first;
@@ -884,6 +1054,7 @@ void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
     positions.y3 = y_center;
     FillTriangle(&positions, Color);
 
+#if (UTIL_LCD_BATCH_ENABLE == 0U)
     positions.x2 = x_center;
     positions.y2 = y_center;
     positions.x3 = X2;
@@ -897,6 +1068,7 @@ void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
     positions.x3 = x_first;
     positions.y3 = y_first;
     FillTriangle(&positions, Color);
+#endif /* UTIL_LCD_BATCH_ENABLE */
 }
 
 /**
@@ -933,6 +1105,238 @@ void UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
   while (y_pos <= 0);
 }
 
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+/**
+  * @brief  Starts a drawing batch: the pixels, lines and rectangles drawn are queued and coalesced
+  *         until UTIL_LCD_EndBatch(). Reading a pixel, drawing RGB data or a bitmap, and changing the
+  *         layer or the device send the queue to the driver first.
+  */
+void UTIL_LCD_BeginBatch(void)
+{
+  BatchActive = 1U;
+}
+
+/**
+  * @brief  Sends the queued drawings to the driver and ends the drawing batch.
+  */
+void UTIL_LCD_EndBatch(void)
+{
+  BatchFlush();
+  BatchActive = 0U;
+}
+
+/**
+  * @brief  Gets the areas drawn since the previous call, on all the layers.
+  * @param  pRects    Array receiving the dirty rectangles
+  * @param  MaxCount  Size of the array, the dirty rectangles are merged to fit in it
+  * @retval Number of dirty rectangles
+  */
+uint32_t UTIL_LCD_GetDirtyRects(UTIL_LCD_Rect_t *pRects, uint32_t MaxCount)
+{
+  uint32_t index;
+  uint32_t count;
+
+  /* The queued drawings are part of the dirty areas */
+  BatchFlush();
+
+  while((DirtyCount > MaxCount) && (DirtyCount > 1U))
+  {
+    DirtyReduce();
+  }
+
+  count = (MaxCount == 0U) ? 0U : DirtyCount;
+  for(index = 0U; index < count; index++)
+  {
+    pRects[index] = DirtyRects[index];
+  }
+  DirtyCount = 0U;
+
+  return count;
+}
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+/**
+  * @brief  Sets the LCD anti-aliased text font.
+  * @param  pFont  Layer anti-aliased font to be used
+  */
+void UTIL_LCD_SetAAFont(const sFONT_AA *pFont)
+{
+  DrawProp[DrawProp->LcdLayer].pAAFont = pFont;
+}
+
+/**
+  * @brief  Gets the LCD anti-aliased text font.
+  * @retval Used layer anti-aliased font
+  */
+const sFONT_AA *UTIL_LCD_GetAAFont(void)
+{
+  return DrawProp[DrawProp->LcdLayer].pAAFont;
+}
+
+/**
+  * @brief  Gets the width of a text displayed with the anti-aliased font.
+  * @param  Text  Pointer to the string
+  * @retval Text width in pixels
+  */
+uint32_t UTIL_LCD_GetAAStringWidth(uint8_t *Text)
+{
+  const sFONT_AA *pfont = DrawProp[DrawProp->LcdLayer].pAAFont;
+  const sGLYPH_AA *pglyph;
+  uint8_t *ptr = Text;
+  uint32_t width = 0U;
+
+  if(pfont != NULL)
+  {
+    while(*ptr != 0U)
+    {
+      pglyph = AAFontGlyph(pfont, *ptr);
+      if(pglyph != NULL)
+      {
+        width += pglyph->Advance;
+      }
+      ptr++;
+    }
+  }
+
+  return width;
+}
+
+/**
+  * @brief  Displays one character with the anti-aliased font in currently active layer.
+  * @param  Xpos   Start column address
+  * @param  Ypos   Line where to display the character cell
+  * @param  Ascii  Character code
+  * @retval Character cell width, 0 if the character is not in the font
+  */
+uint32_t UTIL_LCD_DisplayAAChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii)
+{
+  const sFONT_AA *pfont = DrawProp[DrawProp->LcdLayer].pAAFont;
+  const sGLYPH_AA *pglyph = NULL;
+  Rle_Decoder_t decoder;
+  uint32_t row, width;
+#if (UTIL_LCD_GLYPH_CACHE_SIZE > 0U)
+  uint32_t *pcell;
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+
+  if(pfont != NULL)
+  {
+    pglyph = AAFontGlyph(pfont, Ascii);
+  }
+
+  if(pglyph != NULL)
+  {
+    AAFontPalette();
+
+#if (UTIL_LCD_GLYPH_CACHE_SIZE > 0U)
+    pcell = GlyphCacheGet(pfont, Ascii, pglyph);
+    if(pcell != NULL)
+    {
+      UTIL_LCD_FillRGBRect(Xpos, Ypos, (uint8_t *)pcell, pglyph->Advance, pfont->Height);
+    }
+    else
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+    {
+      /* Expand and send the character cell row by row */
+      width = (pglyph->Advance < UTIL_LCD_AA_FONT_MAX_WIDTH) ? pglyph->Advance : UTIL_LCD_AA_FONT_MAX_WIDTH;
+      AAFontDecoderInit(&decoder, pfont, pglyph);
+      for(row = 0U; row < pfont->Height; row++)
+      {
+        AAFontExpand(pglyph, &decoder, row, 1U, width, AALine);
+        UTIL_LCD_FillRGBRect(Xpos, Ypos + row, (uint8_t *)AALine, width, 1U);
+      }
+    }
+  }
+
+  return (pglyph != NULL) ? pglyph->Advance : 0U;
+}
+
+/**
+  * @brief  Displays characters with the anti-aliased font in currently active layer.
+  * @param  Xpos X position (in pixel)
+  * @param  Ypos Y position (in pixel)
+  * @param  Text Pointer to string to display on LCD
+  * @param  Mode Display mode
+  *          This parameter can be one of the following values:
+  *            @arg  CENTER_MODE
+  *            @arg  RIGHT_MODE
+  *            @arg  LEFT_MODE
+  */
+void UTIL_LCD_DisplayAAStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode)
+{
+  const sFONT_AA *pfont = DrawProp[DrawProp->LcdLayer].pAAFont;
+  const sGLYPH_AA *pglyph;
+  uint32_t refcolumn, size;
+  uint32_t full = 0U;
+  uint8_t *ptr = Text;
+
+  if(pfont != NULL)
+  {
+    size = UTIL_LCD_GetAAStringWidth(Text);
+    if(size > DrawProp->LcdXsize)
+    {
+      size = DrawProp->LcdXsize;
+    }
+
+    switch (Mode)
+    {
+    case CENTER_MODE:
+      {
+        refcolumn = Xpos + ((DrawProp->LcdXsize - size) / 2U);
+        break;
+      }
+    case RIGHT_MODE:
+      {
+        refcolumn = DrawProp->LcdXsize - size - Xpos;
+        break;
+      }
+    case LEFT_MODE:
+    default:
+      {
+        refcolumn = Xpos;
+        break;
+      }
+    }
+
+    /* Check that the Start column is located in the screen */
+    if(refcolumn >= DrawProp->LcdXsize)
+    {
+      refcolumn = 0U;
+    }
+
+    /* Send the string character by character while it fits on the line */
+    while((*ptr != 0U) && (full == 0U))
+    {
+      pglyph = AAFontGlyph(pfont, *ptr);
+      if(pglyph != NULL)
+      {
+        if((refcolumn + pglyph->Advance) > DrawProp->LcdXsize)
+        {
+          full = 1U;
+        }
+        else
+        {
+          refcolumn += UTIL_LCD_DisplayAAChar(refcolumn, Ypos, *ptr);
+        }
+      }
+      ptr++;
+    }
+  }
+}
+
+/**
+  * @brief  Empties the glyph cache, to be called when the data of a font displayed is modified.
+  */
+void UTIL_LCD_ClearGlyphCache(void)
+{
+#if (UTIL_LCD_GLYPH_CACHE_SIZE > 0U)
+  GlyphCacheFirst = 0U;
+  GlyphCacheCount = 0U;
+  GlyphCacheHead = 0U;
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+}
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
+
 /**
   * @brief  Draws a character on LCD.
   * @param  Xpos  Line where to display the character shape
@@ -945,11 +1349,12 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
   uint32_t height, width;
   uint8_t  *pchar;
   uint32_t line;
+  uint32_t rows = 0;
 
   height = DrawProp[DrawProp->LcdLayer].pFont->Height;
   width  = DrawProp[DrawProp->LcdLayer].pFont->Width;
-  uint16_t rgb565[24];
-  uint32_t argb8888[24];
+  uint16_t *rgb565 = (uint16_t *)CharBuffer;
+  uint32_t *argb8888 = CharBuffer;
 
   offset =  8 *((width + 7)/8) -  width ;
 
@@ -980,14 +1385,13 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
       {
         if(line & (1 << (width- j + offset- 1)))
         {
-          rgb565[j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].TextColor);
+          rgb565[(rows * width) + j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].TextColor);
         }
         else
         {
-          rgb565[j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
+          rgb565[(rows * width) + j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
         }
       }
-      UTIL_LCD_FillRGBRect(Xpos,  Ypos++, (uint8_t*)&rgb565[0], width, 1);
     }
     else
     {
@@ -995,14 +1399,22 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
       {
         if(line & (1 << (width- j + offset- 1)))
         {
-          argb8888[j] = DrawProp[DrawProp->LcdLayer].TextColor;
+          argb8888[(rows * width) + j] = DrawProp[DrawProp->LcdLayer].TextColor;
         }
         else
         {
-          argb8888[j] = DrawProp[DrawProp->LcdLayer].BackColor;
+          argb8888[(rows * width) + j] = DrawProp[DrawProp->LcdLayer].BackColor;
         }
       }
-      UTIL_LCD_FillRGBRect(Xpos,  Ypos++, (uint8_t*)&argb8888[0], width, 1);
+    }
+
+    /* Send the buffered rows at once */
+    rows++;
+    if((rows == CHAR_BUFFER_ROWS) || (i == (height - 1U)))
+    {
+      UTIL_LCD_FillRGBRect(Xpos, Ypos, (uint8_t *)CharBuffer, width, rows);
+      Ypos += rows;
+      rows = 0;
     }
   }
 }
@@ -1012,6 +1424,78 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
   * @param  Positions  pointer to riangle coordinates
   * @param  Color      Draw color
   */
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color)
+{
+  int32_t x[3], y[3], tmp;
+  int32_t y_line, x_start, x_end;
+  uint32_t i, j;
+
+  x[0] = (int16_t)Positions->x1;
+  y[0] = (int16_t)Positions->y1;
+  x[1] = (int16_t)Positions->x2;
+  y[1] = (int16_t)Positions->y2;
+  x[2] = (int16_t)Positions->x3;
+  y[2] = (int16_t)Positions->y3;
+
+  /* Sort the vertices by increasing y */
+  for(i = 0U; i < 2U; i++)
+  {
+    for(j = 0U; j < (2U - i); j++)
+    {
+      if(y[j] > y[j + 1U])
+      {
+        tmp = y[j];
+        y[j] = y[j + 1U];
+        y[j + 1U] = tmp;
+        tmp = x[j];
+        x[j] = x[j + 1U];
+        x[j + 1U] = tmp;
+      }
+    }
+  }
+
+  /* Draw one horizontal line per row, between the long edge and the two short ones */
+  for(y_line = y[0]; y_line <= y[2]; y_line++)
+  {
+    if(y[2] == y[0])
+    {
+      x_start = (x[0] < x[1]) ? x[0] : x[1];
+      x_start = (x_start < x[2]) ? x_start : x[2];
+      x_end = (x[0] > x[1]) ? x[0] : x[1];
+      x_end = (x_end > x[2]) ? x_end : x[2];
+    }
+    else
+    {
+      x_start = x[0] + (((x[2] - x[0]) * (y_line - y[0])) / (y[2] - y[0]));
+      if(y_line < y[1])
+      {
+        x_end = x[0] + (((x[1] - x[0]) * (y_line - y[0])) / (y[1] - y[0]));
+      }
+      else if(y[2] != y[1])
+      {
+        x_end = x[1] + (((x[2] - x[1]) * (y_line - y[1])) / (y[2] - y[1]));
+      }
+      else
+      {
+        x_end = x[1];
+      }
+      if(x_start > x_end)
+      {
+        tmp = x_start;
+        x_start = x_end;
+        x_end = tmp;
+      }
+    }
+
+    if((y_line >= 0) && (x_end >= 0))
+    {
+      x_start = (x_start < 0) ? 0 : x_start;
+      UTIL_LCD_DrawHLine((uint32_t)x_start, (uint32_t)y_line, (uint32_t)(x_end - x_start + 1), Color);
+    }
+  }
+}
+#else
 static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color)
 {
   int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
@@ -1083,6 +1567,661 @@ static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color)
     y += yinc2;                 /* Change the y as appropriate */
   }
 }
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+/**
+  * @brief  Converts an ARGB8888 color to the LCD pixel format.
+  * @param  Color  ARGB8888 color
+  * @retval Color in the LCD pixel format
+  */
+static uint32_t ConvertColor(uint32_t Color)
+{
+  uint32_t color = Color;
+
+  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+  {
+    color = CONVERTARGB88882RGB565(Color);
+  }
+
+  return color;
+}
+
+/**
+  * @brief  Clips a rectangle to the LCD area.
+  * @param  pRect  Rectangle to clip
+  * @retval 1 if the clipped rectangle is not empty, 0 otherwise
+  */
+static uint32_t ClipRect(UTIL_LCD_Rect_t *pRect)
+{
+  uint32_t ret = 0U;
+
+  if((pRect->X < DrawProp->LcdXsize) && (pRect->Y < DrawProp->LcdYsize) && (pRect->Width != 0U) && (pRect->Height != 0U))
+  {
+    if(pRect->Width > (DrawProp->LcdXsize - pRect->X))
+    {
+      pRect->Width = DrawProp->LcdXsize - pRect->X;
+    }
+    if(pRect->Height > (DrawProp->LcdYsize - pRect->Y))
+    {
+      pRect->Height = DrawProp->LcdYsize - pRect->Y;
+    }
+    ret = 1U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Gets the area of a rectangle.
+  * @param  pRect  Rectangle
+  * @retval Number of pixels of the rectangle
+  */
+static uint32_t RectArea(const UTIL_LCD_Rect_t *pRect)
+{
+  return pRect->Width * pRect->Height;
+}
+
+/**
+  * @brief  Checks if two rectangles overlap.
+  * @param  pRect1  First rectangle
+  * @param  pRect2  Second rectangle
+  * @retval 1 if the rectangles have common pixels, 0 otherwise
+  */
+static uint32_t RectOverlap(const UTIL_LCD_Rect_t *pRect1, const UTIL_LCD_Rect_t *pRect2)
+{
+  uint32_t ret = 0U;
+
+  if((pRect1->X < (pRect2->X + pRect2->Width)) && (pRect2->X < (pRect1->X + pRect1->Width)) &&
+     (pRect1->Y < (pRect2->Y + pRect2->Height)) && (pRect2->Y < (pRect1->Y + pRect1->Height)))
+  {
+    ret = 1U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Checks if the union of two rectangles is a rectangle: one contains the other, or they have
+  *         the same columns and adjacent rows, or the same rows and adjacent columns.
+  * @param  pRect1  First rectangle
+  * @param  pRect2  Second rectangle
+  * @retval 1 if the rectangles can be merged, 0 otherwise
+  */
+static uint32_t RectMergeable(const UTIL_LCD_Rect_t *pRect1, const UTIL_LCD_Rect_t *pRect2)
+{
+  uint32_t ret = 0U;
+  UTIL_LCD_Rect_t rect = *pRect1;
+
+  RectUnion(&rect, pRect2);
+  if((RectArea(&rect) == RectArea(pRect1)) || (RectArea(&rect) == RectArea(pRect2)))
+  {
+    /* One rectangle contains the other */
+    ret = 1U;
+  }
+  else if((pRect1->X == pRect2->X) && (pRect1->Width == pRect2->Width))
+  {
+    ret = ((pRect1->Y <= (pRect2->Y + pRect2->Height)) && (pRect2->Y <= (pRect1->Y + pRect1->Height))) ? 1U : 0U;
+  }
+  else if((pRect1->Y == pRect2->Y) && (pRect1->Height == pRect2->Height))
+  {
+    ret = ((pRect1->X <= (pRect2->X + pRect2->Width)) && (pRect2->X <= (pRect1->X + pRect1->Width))) ? 1U : 0U;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Extends a rectangle to the bounding box of itself and another one.
+  * @param  pRect  Rectangle to extend
+  * @param  pAdd   Rectangle to add
+  */
+static void RectUnion(UTIL_LCD_Rect_t *pRect, const UTIL_LCD_Rect_t *pAdd)
+{
+  uint32_t x_end, y_end;
+
+  x_end = ((pRect->X + pRect->Width) > (pAdd->X + pAdd->Width)) ? (pRect->X + pRect->Width) : (pAdd->X + pAdd->Width);
+  y_end = ((pRect->Y + pRect->Height) > (pAdd->Y + pAdd->Height)) ? (pRect->Y + pRect->Height) : (pAdd->Y + pAdd->Height);
+  pRect->X = (pRect->X < pAdd->X) ? pRect->X : pAdd->X;
+  pRect->Y = (pRect->Y < pAdd->Y) ? pRect->Y : pAdd->Y;
+  pRect->Width = x_end - pRect->X;
+  pRect->Height = y_end - pRect->Y;
+}
+
+/**
+  * @brief  Queues a drawing when a batch is in progress, otherwise adds its area to the dirty rectangles.
+  *         The drawing is coalesced with a queued one of the same color when their union is a rectangle,
+  *         provided it does not overlap a drawing of another color queued after it.
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @param  Width   Drawing width
+  * @param  Height  Drawing height
+  * @param  Color   ARGB8888 color
+  * @param  Depth   Number of queued drawings checked for coalescing
+  * @retval 1 if the drawing is queued (or fully out of the LCD), 0 if it has to be sent to the driver
+  */
+static uint32_t BatchDraw(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color, uint32_t Depth)
+{
+  UTIL_LCD_Rect_t rect;
+  Batch_Rect_t *pqueued;
+  uint32_t color;
+  uint32_t index = BatchCount;
+  uint32_t depth = Depth;
+  uint32_t merged = 0U;
+  uint32_t ret = 0U;
+
+  if(BatchActive == 0U)
+  {
+    DirtyAdd(Xpos, Ypos, Width, Height);
+  }
+  else
+  {
+    ret = 1U;
+    rect.X = Xpos;
+    rect.Y = Ypos;
+    rect.Width = Width;
+    rect.Height = Height;
+    if(ClipRect(&rect) != 0U)
+    {
+      color = ConvertColor(Color);
+      while((index > 0U) && (depth > 0U))
+      {
+        index--;
+        depth--;
+        pqueued = &BatchQueue[index];
+        if(pqueued->Color == color)
+        {
+          if(RectMergeable(&pqueued->Area, &rect) != 0U)
+          {
+            RectUnion(&pqueued->Area, &rect);
+            merged = 1U;
+            depth = 0U;
+          }
+        }
+        else if(RectOverlap(&pqueued->Area, &rect) != 0U)
+        {
+          /* The drawing cannot be moved before this one */
+          depth = 0U;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+
+      if(merged == 0U)
+      {
+        if(BatchCount == UTIL_LCD_BATCH_SIZE)
+        {
+          BatchFlush();
+        }
+        BatchQueue[BatchCount].Area = rect;
+        BatchQueue[BatchCount].Color = color;
+        BatchCount++;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Sends the queued drawings to the driver, in the queue order.
+  */
+static void BatchFlush(void)
+{
+  uint32_t index, x, y;
+  const Batch_Rect_t *pqueued;
+
+  for(index = 0U; index < BatchCount; index++)
+  {
+    pqueued = &BatchQueue[index];
+    if(RectArea(&pqueued->Area) < BATCH_FILL_MIN_AREA)
+    {
+      for(y = pqueued->Area.Y; y < (pqueued->Area.Y + pqueued->Area.Height); y++)
+      {
+        for(x = pqueued->Area.X; x < (pqueued->Area.X + pqueued->Area.Width); x++)
+        {
+          FuncDriver.SetPixel(DrawProp->LcdDevice, x, y, pqueued->Color);
+        }
+      }
+    }
+    else if(pqueued->Area.Height == 1U)
+    {
+      FuncDriver.DrawHLine(DrawProp->LcdDevice, pqueued->Area.X, pqueued->Area.Y, pqueued->Area.Width, pqueued->Color);
+    }
+    else if(pqueued->Area.Width == 1U)
+    {
+      FuncDriver.DrawVLine(DrawProp->LcdDevice, pqueued->Area.X, pqueued->Area.Y, pqueued->Area.Height, pqueued->Color);
+    }
+    else
+    {
+      FuncDriver.FillRect(DrawProp->LcdDevice, pqueued->Area.X, pqueued->Area.Y, pqueued->Area.Width,
+                          pqueued->Area.Height, pqueued->Color);
+    }
+    DirtyAdd(pqueued->Area.X, pqueued->Area.Y, pqueued->Area.Width, pqueued->Area.Height);
+  }
+  BatchCount = 0U;
+}
+
+/**
+  * @brief  Adds an area to the dirty rectangles. The area is merged with the dirty rectangle growing
+  *         the least when this growth does not exceed its own size, otherwise it is added as a new
+  *         dirty rectangle, the two closest ones being merged when all the rectangles are used.
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @param  Width   Area width
+  * @param  Height  Area height
+  */
+static void DirtyAdd(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
+{
+  UTIL_LCD_Rect_t rect, merged;
+  uint32_t index, growth;
+  uint32_t best = 0U;
+  uint32_t best_growth = 0xFFFFFFFFU;
+
+  rect.X = Xpos;
+  rect.Y = Ypos;
+  rect.Width = Width;
+  rect.Height = Height;
+  if(ClipRect(&rect) != 0U)
+  {
+    for(index = 0U; index < DirtyCount; index++)
+    {
+      merged = DirtyRects[index];
+      RectUnion(&merged, &rect);
+      growth = RectArea(&merged) - RectArea(&DirtyRects[index]);
+      if(growth < best_growth)
+      {
+        best_growth = growth;
+        best = index;
+      }
+    }
+
+    if(best_growth > RectArea(&rect))
+    {
+      DirtyRects[DirtyCount] = rect;
+      DirtyCount++;
+      if(DirtyCount > UTIL_LCD_DIRTY_RECT_NBR)
+      {
+        DirtyReduce();
+      }
+    }
+    else if(best_growth != 0U)
+    {
+      RectUnion(&DirtyRects[best], &rect);
+      DirtyMerge(best);
+    }
+    else
+    {
+      /* The area is already dirty */
+    }
+  }
+}
+
+/**
+  * @brief  Merges the two dirty rectangles whose bounding box adds the fewest pixels to them.
+  */
+static void DirtyReduce(void)
+{
+  UTIL_LCD_Rect_t merged;
+  uint32_t i, j, cost, area;
+  uint32_t best_i = 0U;
+  uint32_t best_j = 1U;
+  uint32_t best_cost = 0xFFFFFFFFU;
+
+  for(i = 0U; i < DirtyCount; i++)
+  {
+    for(j = i + 1U; j < DirtyCount; j++)
+    {
+      merged = DirtyRects[i];
+      RectUnion(&merged, &DirtyRects[j]);
+      area = RectArea(&DirtyRects[i]) + RectArea(&DirtyRects[j]);
+      cost = (RectArea(&merged) > area) ? (RectArea(&merged) - area) : 0U;
+      if(cost < best_cost)
+      {
+        best_cost = cost;
+        best_i = i;
+        best_j = j;
+      }
+    }
+  }
+
+  RectUnion(&DirtyRects[best_i], &DirtyRects[best_j]);
+  DirtyCount--;
+  DirtyRects[best_j] = DirtyRects[DirtyCount];
+  DirtyMerge(best_i);
+}
+
+/**
+  * @brief  Merges the dirty rectangles overlapping an extended one into it.
+  * @param  Index  Index of the extended dirty rectangle
+  */
+static void DirtyMerge(uint32_t Index)
+{
+  uint32_t index = 0U;
+  uint32_t current = Index;
+
+  while(index < DirtyCount)
+  {
+    if((index != current) && (RectOverlap(&DirtyRects[index], &DirtyRects[current]) != 0U))
+    {
+      RectUnion(&DirtyRects[current], &DirtyRects[index]);
+      DirtyCount--;
+      DirtyRects[index] = DirtyRects[DirtyCount];
+      if(current == DirtyCount)
+      {
+        current = index;
+      }
+      /* Check again all the rectangles against the extended one */
+      index = 0U;
+    }
+    else
+    {
+      index++;
+    }
+  }
+}
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+/**
+  * @brief  Gets the glyph of a character in an anti-aliased font.
+  * @param  pFont  Anti-aliased font
+  * @param  Code   Character code
+  * @retval Glyph of the character, NULL if the character is not in the font
+  */
+static const sGLYPH_AA *AAFontGlyph(const sFONT_AA *pFont, uint32_t Code)
+{
+  const sGLYPH_AA *pglyph = NULL;
+
+  if((Code >= pFont->FirstChar) && (Code < ((uint32_t)pFont->FirstChar + pFont->CharCount)))
+  {
+    pglyph = &pFont->Glyphs[Code - pFont->FirstChar];
+  }
+
+  return pglyph;
+}
+
+/**
+  * @brief  Updates the anti-aliased text colors when the text or background color or the pixel format
+  *         changed: each coverage value gives the text color blended over the background color.
+  */
+static void AAFontPalette(void)
+{
+  uint32_t text_color = DrawProp[DrawProp->LcdLayer].TextColor;
+  uint32_t back_color = DrawProp[DrawProp->LcdLayer].BackColor;
+  uint32_t coverage, shift, color;
+
+  if((text_color != AAPaletteTextColor) || (back_color != AAPaletteBackColor) ||
+     (DrawProp->LcdPixelFormat != AAPalettePixelFormat))
+  {
+    for(coverage = 0U; coverage < 16U; coverage++)
+    {
+      color = 0U;
+      for(shift = 0U; shift < 32U; shift += 8U)
+      {
+        color |= (((((text_color >> shift) & 0xFFU) * coverage) + (((back_color >> shift) & 0xFFU) * (15U - coverage))
+                   + 7U) / 15U) << shift;
+      }
+      if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+      {
+        color = CONVERTARGB88882RGB565(color);
+      }
+      AAPalette[coverage] = color;
+    }
+    AAPaletteTextColor = text_color;
+    AAPaletteBackColor = back_color;
+    AAPalettePixelFormat = DrawProp->LcdPixelFormat;
+  }
+}
+
+/**
+  * @brief  Starts the RLE decoding of a glyph, at the first row inside the character cell.
+  * @param  pDecoder  RLE decoder
+  * @param  pFont     Anti-aliased font
+  * @param  pGlyph    Glyph to decode
+  */
+static void AAFontDecoderInit(Rle_Decoder_t *pDecoder, const sFONT_AA *pFont, const sGLYPH_AA *pGlyph)
+{
+  uint32_t skip;
+
+  pDecoder->pData = &pFont->Data[pGlyph->Offset];
+  pDecoder->Count = 0U;
+  pDecoder->Coverage = 0U;
+  pDecoder->Literal = 0U;
+  pDecoder->Nibble = 0U;
+
+  /* Skip the rows above the character cell */
+  if(pGlyph->OffsetY < 0)
+  {
+    for(skip = (uint32_t)(-pGlyph->OffsetY) * pGlyph->Width; skip > 0U; skip--)
+    {
+      (void)AAFontDecode(pDecoder);
+    }
+  }
+}
+
+/**
+  * @brief  Decodes the coverage of the next pixel of a glyph.
+  * @param  pDecoder  RLE decoder
+  * @retval Pixel coverage, 0 to 15
+  */
+static uint32_t AAFontDecode(Rle_Decoder_t *pDecoder)
+{
+  uint32_t code;
+
+  if(pDecoder->Count == 0U)
+  {
+    code = *pDecoder->pData;
+    pDecoder->pData++;
+    pDecoder->Count = (code & 0x3FU) + 1U;
+    pDecoder->Literal = ((code & 0xC0U) == 0x80U) ? 1U : 0U;
+    pDecoder->Coverage = ((code & 0xC0U) == 0x40U) ? 15U : 0U;
+  }
+
+  if(pDecoder->Literal != 0U)
+  {
+    if(pDecoder->Nibble == 0U)
+    {
+      pDecoder->Coverage = (uint32_t)*pDecoder->pData >> 4;
+    }
+    else
+    {
+      pDecoder->Coverage = (uint32_t)*pDecoder->pData & 0xFU;
+      pDecoder->pData++;
+    }
+    pDecoder->Nibble ^= 1U;
+  }
+
+  pDecoder->Count--;
+  if((pDecoder->Count == 0U) && (pDecoder->Nibble != 0U))
+  {
+    /* Odd number of literal pixels: skip the unused low nibble */
+    pDecoder->pData++;
+    pDecoder->Nibble = 0U;
+  }
+
+  return pDecoder->Coverage;
+}
+
+/**
+  * @brief  Expands rows of an anti-aliased character cell in the LCD pixel format.
+  * @param  pGlyph    Glyph of the character
+  * @param  pDecoder  RLE decoder of the glyph, at the first row to expand
+  * @param  Row       First character cell row to expand
+  * @param  Rows      Number of rows to expand
+  * @param  Width     Number of pixels expanded per row, up to the character cell width
+  * @param  pDest     Destination buffer
+  */
+static void AAFontExpand(const sGLYPH_AA *pGlyph, Rle_Decoder_t *pDecoder, uint32_t Row, uint32_t Rows,
+                         uint32_t Width, uint32_t *pDest)
+{
+  uint16_t *pdest565 = (uint16_t *)pDest;
+  uint32_t rgb565 = (DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565) ? 1U : 0U;
+  uint32_t index = 0U;
+  uint32_t x, y, coverage;
+  int32_t glyph_row, cell_x;
+
+  for(y = Row; y < (Row + Rows); y++)
+  {
+    /* Background */
+    for(x = 0U; x < Width; x++)
+    {
+      if(rgb565 != 0U)
+      {
+        pdest565[index + x] = (uint16_t)AAPalette[0];
+      }
+      else
+      {
+        pDest[index + x] = AAPalette[0];
+      }
+    }
+
+    /* Glyph row, clipped to the character cell */
+    glyph_row = (int32_t)y - pGlyph->OffsetY;
+    if((glyph_row >= 0) && (glyph_row < (int32_t)pGlyph->Height))
+    {
+      for(x = 0U; x < pGlyph->Width; x++)
+      {
+        coverage = AAFontDecode(pDecoder);
+        cell_x = pGlyph->OffsetX + (int32_t)x;
+        if((coverage != 0U) && (cell_x >= 0) && (cell_x < (int32_t)Width))
+        {
+          if(rgb565 != 0U)
+          {
+            pdest565[index + (uint32_t)cell_x] = (uint16_t)AAPalette[coverage];
+          }
+          else
+          {
+            pDest[index + (uint32_t)cell_x] = AAPalette[coverage];
+          }
+        }
+      }
+    }
+    index += Width;
+  }
+}
+
+#if (UTIL_LCD_GLYPH_CACHE_SIZE > 0U)
+/**
+  * @brief  Gets a character cell expanded in the LCD pixel format with the current colors from the glyph
+  *         cache, expanding it in the cache if needed, the oldest cells being evicted.
+  * @param  pFont   Anti-aliased font
+  * @param  Code    Character code
+  * @param  pGlyph  Glyph of the character
+  * @retval Character cell, NULL if it does not fit in the cache
+  */
+static uint32_t *GlyphCacheGet(const sFONT_AA *pFont, uint32_t Code, const sGLYPH_AA *pGlyph)
+{
+  Glyph_Cache_Entry_t *pentry = NULL;
+  Rle_Decoder_t decoder;
+  uint32_t index, size, offset;
+
+  for(index = 0U; (index < GlyphCacheCount) && (pentry == NULL); index++)
+  {
+    pentry = &GlyphCache[(GlyphCacheFirst + index) % UTIL_LCD_GLYPH_CACHE_NBR];
+    if((pentry->pFont != pFont) || (pentry->Code != Code) || (pentry->TextColor != AAPaletteTextColor) ||
+       (pentry->BackColor != AAPaletteBackColor) || (pentry->PixelFormat != AAPalettePixelFormat))
+    {
+      pentry = NULL;
+    }
+  }
+
+  if(pentry == NULL)
+  {
+    /* Character cell size in words */
+    size = (uint32_t)pGlyph->Advance * pFont->Height;
+    size = (AAPalettePixelFormat == LCD_PIXEL_FORMAT_RGB565) ? ((size + 1U) / 2U) : size;
+    if(size > (UTIL_LCD_GLYPH_CACHE_SIZE / 4U))
+    {
+      return NULL;
+    }
+
+    /* Allocated first: the eviction may restart the ring */
+    offset = GlyphCacheAlloc(size);
+    pentry = &GlyphCache[(GlyphCacheFirst + GlyphCacheCount) % UTIL_LCD_GLYPH_CACHE_NBR];
+    pentry->Offset = offset;
+    pentry->pFont = pFont;
+    pentry->Code = Code;
+    pentry->TextColor = AAPaletteTextColor;
+    pentry->BackColor = AAPaletteBackColor;
+    pentry->PixelFormat = AAPalettePixelFormat;
+    pentry->Size = size;
+    GlyphCacheCount++;
+
+    AAFontDecoderInit(&decoder, pFont, pGlyph);
+    AAFontExpand(pGlyph, &decoder, 0U, pFont->Height, pGlyph->Advance, &GlyphCachePool[pentry->Offset]);
+  }
+
+  return &GlyphCachePool[pentry->Offset];
+}
+
+/**
+  * @brief  Allocates a character cell at the ring head, or at the pool start when it does not fit before the
+  *         pool end, the oldest cells being evicted until the cell is free and an entry is available.
+  *         No cell is moved.
+  * @param  Size  Character cell size in words, at most the pool size
+  * @retval Offset of the character cell in GlyphCachePool, in words
+  */
+static uint32_t GlyphCacheAlloc(uint32_t Size)
+{
+  uint32_t tail, offset = 0U;
+  uint32_t found = 0U;
+
+  while(found == 0U)
+  {
+    if(GlyphCacheCount == 0U)
+    {
+      /* Empty cache: the cell starts the ring again */
+      GlyphCacheFirst = 0U;
+      GlyphCacheHead = 0U;
+      found = 1U;
+    }
+    else
+    {
+      tail = GlyphCache[GlyphCacheFirst].Offset;
+      if(GlyphCacheCount < UTIL_LCD_GLYPH_CACHE_NBR)
+      {
+        if(GlyphCacheHead > tail)
+        {
+          /* Free words after the head, then before the oldest cell */
+          if(((UTIL_LCD_GLYPH_CACHE_SIZE / 4U) - GlyphCacheHead) >= Size)
+          {
+            offset = GlyphCacheHead;
+            found = 1U;
+          }
+          else if(tail >= Size)
+          {
+            found = 1U;
+          }
+        }
+        else if((tail - GlyphCacheHead) >= Size)
+        {
+          /* Free words between the head and the oldest cell */
+          offset = GlyphCacheHead;
+          found = 1U;
+        }
+      }
+
+      if(found == 0U)
+      {
+        GlyphCacheFirst = (GlyphCacheFirst + 1U) % UTIL_LCD_GLYPH_CACHE_NBR;
+        GlyphCacheCount--;
+      }
+    }
+  }
+
+  GlyphCacheHead = offset + Size;
+
+  return offset;
+}
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
 
 /**
   * @}
@@ -97,6 +97,49 @@
   */
 #define UTIL_LCD_DEFAULT_FONT        Font24
 
+/**
+  * @brief LCD Utility drawing batch configuration
+  *        When UTIL_LCD_BATCH_ENABLE is set to 1, the pixels, lines and rectangles drawn between
+  *        UTIL_LCD_BeginBatch() and UTIL_LCD_EndBatch() are queued and coalesced into rectangles, sent to the
+  *        board driver FillRect/DrawHLine/DrawVLine (DMA2D fills on the boards having a DMA2D) when the queue
+  *        is full or at UTIL_LCD_EndBatch(). The areas drawn are gathered in dirty rectangles returned by
+  *        UTIL_LCD_GetDirtyRects() to refresh or copy only these areas at the end of a frame.
+  */
+#ifndef UTIL_LCD_BATCH_ENABLE
+#define UTIL_LCD_BATCH_ENABLE        0U
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#ifndef UTIL_LCD_BATCH_SIZE
+#define UTIL_LCD_BATCH_SIZE          32U  /* Number of rectangles queued before being sent to the driver */
+#endif /* UTIL_LCD_BATCH_SIZE */
+
+#ifndef UTIL_LCD_DIRTY_RECT_NBR
+#define UTIL_LCD_DIRTY_RECT_NBR      8U   /* Number of dirty rectangles */
+#endif /* UTIL_LCD_DIRTY_RECT_NBR */
+
+/**
+  * @brief LCD Utility anti-aliased fonts configuration
+  *        When UTIL_LCD_AA_FONT_ENABLE is set to 1, the text can be displayed with the RLE-compressed 4-bpp
+  *        proportional fonts (sFONT_AA) set by UTIL_LCD_SetAAFont(). The character cells are expanded in the
+  *        LCD pixel format, blending the text color over the background color, and kept in a glyph cache of
+  *        UTIL_LCD_GLYPH_CACHE_SIZE bytes: a cached character is displayed with one FillRGBRect.
+  */
+#ifndef UTIL_LCD_AA_FONT_ENABLE
+#define UTIL_LCD_AA_FONT_ENABLE      0U
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
+
+#ifndef UTIL_LCD_GLYPH_CACHE_SIZE
+#define UTIL_LCD_GLYPH_CACHE_SIZE    8192U /* Glyph cache size in bytes, 0 to disable the cache */
+#endif /* UTIL_LCD_GLYPH_CACHE_SIZE */
+
+#ifndef UTIL_LCD_GLYPH_CACHE_NBR
+#define UTIL_LCD_GLYPH_CACHE_NBR     48U   /* Maximum number of cached characters */
+#endif /* UTIL_LCD_GLYPH_CACHE_NBR */
+
+#ifndef UTIL_LCD_AA_FONT_MAX_WIDTH
+#define UTIL_LCD_AA_FONT_MAX_WIDTH   64U   /* Maximum character cell width, for the characters not cached */
+#endif /* UTIL_LCD_AA_FONT_MAX_WIDTH */
+
 /**
   * @}
   */
@@ -126,6 +169,9 @@ typedef struct
   uint32_t  LcdXsize;
   uint32_t  LcdYsize;
   uint32_t  LcdPixelFormat;
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+  const sFONT_AA *pAAFont; /*!< Specifies the anti-aliased font used for the text */
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
 } UTIL_LCD_Ctx_t;
 
 /**
@@ -142,6 +188,17 @@ typedef struct
   */
 typedef Point * pPoint;
 
+/**
+  * @brief  LCD Utility rectangle definition
+  */
+typedef struct
+{
+  uint32_t X;      /*!< X position of the top left corner */
+  uint32_t Y;      /*!< Y position of the top left corner */
+  uint32_t Width;  /*!< Rectangle width */
+  uint32_t Height; /*!< Rectangle height */
+} UTIL_LCD_Rect_t;
+
 /**
   * @brief  LCD Utility drawing Line alignment mode definitions
   */
@@ -192,6 +249,21 @@ void     UTIL_LCD_FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint
 void     UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color);
 void     UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t Color);
 
+#if (UTIL_LCD_BATCH_ENABLE == 1U)
+void     UTIL_LCD_BeginBatch(void);
+void     UTIL_LCD_EndBatch(void);
+uint32_t UTIL_LCD_GetDirtyRects(UTIL_LCD_Rect_t *pRects, uint32_t MaxCount);
+#endif /* UTIL_LCD_BATCH_ENABLE */
+
+#if (UTIL_LCD_AA_FONT_ENABLE == 1U)
+void     UTIL_LCD_SetAAFont(const sFONT_AA *pFont);
+const sFONT_AA *UTIL_LCD_GetAAFont(void);
+uint32_t UTIL_LCD_GetAAStringWidth(uint8_t *Text);
+uint32_t UTIL_LCD_DisplayAAChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii);
+void     UTIL_LCD_DisplayAAStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+void     UTIL_LCD_ClearGlyphCache(void);
+#endif /* UTIL_LCD_AA_FONT_ENABLE */
+
 /**
   * @}
   */
@@ -2365,6 +2365,85 @@ LPBAM_Status_t LPBAM_VREFBUF_FillStructInfo(LPBAM_VREFBUF_ConfNode_t const *cons
   return LPBAM_OK;
 }
 #endif /* LPBAM_VREFBUF_MODULE_ENABLED */
+
+
+#if defined (LPBAM_SCENARIO_MODULE_ENABLED)
+/**
+  * @brief  Check whether a register write has an effect other than storing the written value : a write that clears
+  *         flags (write 1 to clear registers), starts a conversion, a counter or a transfer, or a register updated by
+  *         hardware. Writing again the same value to such a register is not redundant.
+  * @param  RegAddr      : [IN]  Specifies the register address.
+  * @retval Action       : [OUT] 1 for flag clear, start and hardware updated registers, 0 otherwise.
+  */
+uint32_t LPBAM_IsActionRegister(uint32_t RegAddr)
+{
+#if defined (LPBAM_ADC_MODULE_ENABLED)
+  /* ADC ISR flags clear, ADC CR conversion start and stop */
+  if (IS_ADC_ALL_INSTANCE((ADC_TypeDef *)(RegAddr - LPBAM_ADC_CLEARFLAG_OFFSET)) ||
+      IS_ADC_ALL_INSTANCE((ADC_TypeDef *)(RegAddr - LPBAM_ADC_STATE_OFFSET)))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_ADC_MODULE_ENABLED */
+
+#if defined (LPBAM_DMA_MODULE_ENABLED)
+  /* DMA CFCR flags clear, DMA CCR channel enable, DMA CBR1 and CLLR updated during the transfers */
+  if (IS_DMA_ALL_INSTANCE((DMA_Channel_TypeDef *)(RegAddr - LPBAM_DMA_CLEARFLAG_OFFSET))        ||
+      IS_DMA_ALL_INSTANCE((DMA_Channel_TypeDef *)(RegAddr - LPBAM_DMA_CONFIG_OFFSET))           ||
+      IS_DMA_ALL_INSTANCE((DMA_Channel_TypeDef *)(RegAddr - LPBAM_DMA_CLEARDATASIZE_OFFSET))    ||
+      IS_DMA_ALL_INSTANCE((DMA_Channel_TypeDef *)(RegAddr - LPBAM_DMA_QUEUE_OFFSETADDRESS_OFFSET)))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_DMA_MODULE_ENABLED */
+
+#if defined (LPBAM_GPIO_MODULE_ENABLED)
+  /* GPIO and LPGPIO BSRR pins set and reset */
+  if (IS_GPIO_ALL_INSTANCE((GPIO_TypeDef *)(RegAddr - LPBAM_GPIO_WRITEPIN_OFFSET)) ||
+      ((GPIO_TypeDef *)(RegAddr - LPBAM_GPIO_WRITEPIN_OFFSET) == LPGPIO1))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_GPIO_MODULE_ENABLED */
+
+#if defined (LPBAM_I2C_MODULE_ENABLED)
+  /* I2C CR2 start and stop generation */
+  if (IS_I2C_ALL_INSTANCE((I2C_TypeDef *)(RegAddr - LPBAM_I2C_CONFIG_TRANSACTION_OFFSET)))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_I2C_MODULE_ENABLED */
+
+#if defined (LPBAM_LPTIM_MODULE_ENABLED)
+  /* LPTIM ICR flags clear, LPTIM CR counter start */
+  if (IS_LPTIM_INSTANCE((LPTIM_TypeDef *)(RegAddr - LPBAM_LPTIM_CLEARFLAG_OFFSET)) ||
+      IS_LPTIM_INSTANCE((LPTIM_TypeDef *)(RegAddr - LPBAM_LPTIM_CONFIG_OFFSET)))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_LPTIM_MODULE_ENABLED */
+
+#if defined (LPBAM_SPI_MODULE_ENABLED)
+  /* SPI IFCR flags clear, SPI CR1 transfer start */
+  if (IS_SPI_ALL_INSTANCE((SPI_TypeDef *)(RegAddr - LPBAM_SPI_CLEARFLAG_OFFSET)) ||
+      IS_SPI_ALL_INSTANCE((SPI_TypeDef *)(RegAddr - LPBAM_SPI_START_OFFSET)))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_SPI_MODULE_ENABLED */
+
+#if defined (LPBAM_UART_MODULE_ENABLED)
+  /* UART ICR flags clear */
+  if (IS_UART_INSTANCE((USART_TypeDef *)(RegAddr - LPBAM_UART_CLEARFLAG_OFFSET)) ||
+      IS_LPUART_INSTANCE((USART_TypeDef *)(RegAddr - LPBAM_UART_CLEARFLAG_OFFSET)))
+  {
+    return 1U;
+  }
+#endif /* LPBAM_UART_MODULE_ENABLED */
+
+  return 0U;
+}
+#endif /* LPBAM_SCENARIO_MODULE_ENABLED */
 /**
   * @}
   */
@@ -391,6 +391,16 @@ LPBAM_Status_t LPBAM_VREFBUF_FillStructInfo(LPBAM_VREFBUF_ConfNode_t const *cons
                                             LPBAM_InfoDesc_t         *const pDescInfo);
 #endif /* defined (LPBAM_VREFBUF_MODULE_ENABLED) */
 
+
+#if defined (LPBAM_SCENARIO_MODULE_ENABLED)
+/**
+  * @brief  Check whether a register write has an effect other than storing the written value.
+  * @param  RegAddr      : [IN]  Specifies the register address.
+  * @retval Action       : [OUT] 1 for flag clear, start and hardware updated registers, 0 otherwise.
+  */
+uint32_t LPBAM_IsActionRegister(uint32_t RegAddr);
+#endif /* defined (LPBAM_SCENARIO_MODULE_ENABLED) */
+
 /**
   * @}
   */
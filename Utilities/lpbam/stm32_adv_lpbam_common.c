@@ -68,6 +68,8 @@
           (+) Set a circular mode to a built linked-list queue.
               Check LPBAM_Q_Config_Node_Selection and LPBAM_Q_Data_Node_Selection to have the exhaustive list of APIs
               that supports this capability.
+          (+) Set a ping-pong mode to a built linked-list queue data transfer.
+              Check LPBAM_Q_Data_Node_Selection to have the exhaustive list of APIs that supports this capability.
           (+) Convert a built linked-list queue to static or dynamic format.
 
     *** Functional description ***
@@ -100,6 +102,16 @@
           (+) First circular item in the input queue can be one of parameters in LPBAM_Q_Config_Node_Selection and
               LPBAM_Q_Data_Node_Selection sections.
 
+    [..]
+      The common module allows to stream data continuously through a buffer split in two halves (ping-pong) :
+          (+) The data node of an advanced API transfers the first half and a second node, built from it, transfers the
+              second half. The two data nodes are executed in an infinite loop.
+          (+) A transfer complete event is generated at the end of each half, so that the CPU is woken up to process
+              one half while the DMA fills (or empties) the other one.
+          (+) A data configuration can be applied to both halves to reduce the stored data (i.e. only the low byte of
+              each ADC conversion or SPI frame), thus increasing the number of data per half and reducing the number
+              of CPU wake-ups for a given buffer size.
+
     [..]
       The common module allows to convert a linked-list queue in static or dynamic format.
           (+) When converted to static format, all queue operation are allowed. Executing static queues is not optimal
@@ -158,6 +170,20 @@
       API items that can be the first circular item are listed on LPBAM_Q_Config_Node_Selection and
       LPBAM_Q_Data_Node_Selection sections.
 
+    [..]
+      Use ADV_LPBAM_Q_SetPingPongMode() API to stream the data transfer of an advanced API linked-list queue through a
+      ping-pong buffer. The data node of the advanced API must be the last node of the queue and its buffer must be
+      two times the transfer size (Size field of the advanced API data configuration is the half size).
+      The ping-pong configuration parameters are :
+          (+) pPongNode   : Specifies the node transferring the second half of the buffer.
+          (+) pDataConfig : Specifies the data configuration applied to both halves (NULL to keep the default one).
+      The transfer event mode of both data nodes is set to LPBAM_DMA_TCEM_BLOCK_TRANSFER and the queue is circularized
+      from the first data node. The DMA channel transfer complete interrupt must be enabled to wake up the CPU at each
+      half. The peripheral shall generate DMA requests continuously (i.e. DMAContinuousRequests enabled for ADC).
+      SPI data nodes are supported in slave mode only : the SPI queues write the transfer size (TSIZE) of one half, at
+      the end of which an SPI master stops generating the clock. ADV_LPBAM_Q_SetPingPongMode() returns LPBAM_ERROR
+      when the SPI instance is configured in master mode.
+
     [..]
       Use ADV_LPBAM_Q_ConvertQ() API to convert a built linked-list queue to dynamic format when the whole queue is
       built in order to reduce time execution and consuption.
@@ -185,6 +211,10 @@
     [..]
       Call ADV_LPBAM_Q_SetCircularMode() after calling all scenario APIs to circularize the input linked-list queue.
 
+    [..]
+      Call ADV_LPBAM_Q_SetPingPongMode() instead of ADV_LPBAM_Q_SetCircularMode() after calling the advanced API
+      building the streamed data transfer.
+
     [..]
       Call ADV_LPBAM_Q_ConvertQ() after calling all scenario APIs to convert the input linked-list queue to static or
       dynamic format.
@@ -206,6 +236,7 @@
 
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "stm32_lpbam.h"
+#include "stm32_ll_lpbam.h"
 
 #ifdef LPBAM_COMMON_MODULE_ENABLED
 
@@ -398,6 +429,128 @@ LPBAM_Status_t ADV_LPBAM_Q_SetCircularMode(void             const *const pDescri
   return LPBAM_OK;
 }
 
+/**
+  * @brief  Set LPBAM ping-pong mode to the data node of a linked-list queue according to configured parameters in the
+  *         LPBAM_COMMON_PingPongAdvConf_t.
+  * @param  pPingPongConfig : [IN]  Pointer to a LPBAM_COMMON_PingPongAdvConf_t structure that contains the ping-pong
+  *                                 configuration.
+  * @param  DataNode        : [IN]  Specifies the data node transferring the first half of the buffer.
+  *                                 This parameter can be a value of @ref LPBAM_Q_Data_Node_Selection.
+  * @param  pDescriptor     : [IN]  Pointer to all available LPBAM descriptors used in advanced layer.
+  * @param  pQueue          : [OUT] Pointer to a DMA_QListTypeDef structure that contains DMA linked-list queue
+  *                                 information.
+  * @note   SPI data nodes are supported in slave mode only.
+  * @retval LPBAM Status    : [OUT] Value from LPBAM_Status_t enumeration.
+  */
+LPBAM_Status_t ADV_LPBAM_Q_SetPingPongMode(LPBAM_COMMON_PingPongAdvConf_t const *const pPingPongConfig,
+                                           uint32_t                       DataNode,
+                                           void                           const *const pDescriptor,
+                                           DMA_QListTypeDef               *const pQueue)
+{
+  DMA_NodeConfTypeDef dma_node_conf;
+  DMA_NodeTypeDef     *p_ping_node;
+  uint32_t node_addr = ((uint32_t)pDescriptor);
+  uint32_t src_width;
+  uint32_t dest_width;
+#if defined (LPBAM_SPI_MODULE_ENABLED)
+  SPI_TypeDef const *p_spi;
+#endif /* defined (LPBAM_SPI_MODULE_ENABLED) */
+
+  /* Calculate data node address */
+  node_addr  += (DataNode * sizeof(DMA_NodeTypeDef));
+  p_ping_node = (DMA_NodeTypeDef *)node_addr;
+
+  /* The data node shall be the last node of the queue */
+  if ((p_ping_node->LinkRegisters[(p_ping_node->NodeInfo & NODE_CLLR_IDX) >> NODE_CLLR_IDX_POS] & DMA_CLLR_LA) != 0U)
+  {
+    return LPBAM_ERROR;
+  }
+
+#if defined (LPBAM_SPI_MODULE_ENABLED)
+  /* An SPI master stops at the end of the TSIZE data written by the queue (first half) and is not restarted */
+  if (HAL_DMAEx_List_GetNodeConfig(&dma_node_conf, p_ping_node) != HAL_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  if (IS_SPI_ALL_INSTANCE((SPI_TypeDef *)(dma_node_conf.DstAddress - LPBAM_SPI_TRANSMIT_DATA_OFFSET)))
+  {
+    p_spi = (SPI_TypeDef *)(dma_node_conf.DstAddress - LPBAM_SPI_TRANSMIT_DATA_OFFSET);
+  }
+  else if (IS_SPI_ALL_INSTANCE((SPI_TypeDef *)(dma_node_conf.SrcAddress - LPBAM_SPI_RECEIVE_DATA_OFFSET)))
+  {
+    p_spi = (SPI_TypeDef *)(dma_node_conf.SrcAddress - LPBAM_SPI_RECEIVE_DATA_OFFSET);
+  }
+  else
+  {
+    p_spi = NULL;
+  }
+
+  if ((p_spi != NULL) && ((p_spi->CFG2 & SPI_CFG2_MASTER) != 0U))
+  {
+    return LPBAM_ERROR;
+  }
+#endif /* defined (LPBAM_SPI_MODULE_ENABLED) */
+
+  /* Apply data configuration before duplicating the data node */
+  if (pPingPongConfig->pDataConfig != NULL)
+  {
+    if (ADV_LPBAM_Q_SetDataConfig(pPingPongConfig->pDataConfig, DataNode, pDescriptor) != LPBAM_OK)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+
+  /* Generate a transfer complete event at the end of each half */
+  if (ADV_LPBAM_Q_SetTransferEventGeneration(LPBAM_DMA_TCEM_BLOCK_TRANSFER, DataNode, pDescriptor) != LPBAM_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Get data node configuration */
+  if (HAL_DMAEx_List_GetNodeConfig(&dma_node_conf, p_ping_node) != HAL_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* The data size is expressed in source bytes : compute the half buffer size on the incremented side */
+  src_width  = 1UL << ((dma_node_conf.Init.SrcDataWidth & DMA_CTR1_SDW_LOG2) >> DMA_CTR1_SDW_LOG2_Pos);
+  dest_width = 1UL << ((dma_node_conf.Init.DestDataWidth & DMA_CTR1_DDW_LOG2) >> DMA_CTR1_DDW_LOG2_Pos);
+
+  if (dma_node_conf.Init.DestInc == DMA_DINC_INCREMENTED)
+  {
+    dma_node_conf.DstAddress += (dma_node_conf.DataSize / src_width) * dest_width;
+  }
+  else if (dma_node_conf.Init.SrcInc == DMA_SINC_INCREMENTED)
+  {
+    dma_node_conf.SrcAddress += dma_node_conf.DataSize;
+  }
+  else
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Build second half data node */
+  if (HAL_DMAEx_List_BuildNode(&dma_node_conf, pPingPongConfig->pPongNode) != HAL_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Connect second half data node after the first half one */
+  if (HAL_DMAEx_List_InsertNode(pQueue, p_ping_node, pPingPongConfig->pPongNode) != HAL_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Loop on the two data nodes */
+  if (HAL_DMAEx_List_SetCircularModeConfig(pQueue, p_ping_node) != HAL_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  return LPBAM_OK;
+}
+
 /**
   * @brief  Convert linked-list queue according to selected type.
   * @param  Type         : [IN]  Specifies whether the queue type is static or dynamic.
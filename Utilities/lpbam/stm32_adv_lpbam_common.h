@@ -90,6 +90,21 @@ typedef struct
   LPBAM_DMA_TriggerConfTypeDef TriggerConfig; /*!< Specifies the transfer trigger parameters. */
 
 } LPBAM_COMMON_TrigAdvConf_t;
+
+/**
+  * @brief LPBAM COMMON Ping-Pong Configuration Structure definition.
+  */
+typedef struct
+{
+  DMA_NodeTypeDef                  *pPongNode;   /*!< Specifies the node transferring the second half of the
+                                                      buffer. It shall be placed in a memory accessible by the DMA.   */
+
+  LPBAM_COMMON_DataAdvConf_t const *pDataConfig; /*!< Specifies the data configuration applied to both halves, i.e.
+                                                      a destination data width narrower than the source data width
+                                                      to store only the useful part of each data.
+                                                      NULL to keep the data node configuration.                       */
+
+} LPBAM_COMMON_PingPongAdvConf_t;
 /**
   * @}
   */
@@ -376,12 +391,14 @@ typedef struct
                                                             ADV_LPBAM_ADC_Conversion_SetDataQ()
                                                             This define can be used as a parameter for :
                                                                       + ADV_LPBAM_Q_SetCircularMode()
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_ADC_CONVERSION_FULLQ_DATA_NODE   (0x0DU) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_ADC_Conversion_SetFullQ()
                                                             This define can be used as a parameter for :
                                                                       + ADV_LPBAM_Q_SetCircularMode()
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 /* COMP data nodes defines */
 #define LPBAM_COMP_OUTPUTLEVEL_FULLQ_DATA_NODE (0x00U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_COMP_OutputLevel_SetFullQ()
@@ -466,57 +483,69 @@ typedef struct
 #define LPBAM_SPI_TX_DATAQ_DATA_NODE           (0x05U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_SPI_Tx_SetDataQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_TX_FULLQ_DATA_NODE           (0x09U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_SPI_Tx_SetFullQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_RX_DATAQ_DATA_NODE           (0x05U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_SPI_Rx_SetDataQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_RX_FULLQ_DATA_NODE           (0x09U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_SPI_Rx_SetFullQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_TXRX_DATAQ_TXDATA_NODE       (0x05U) /*!< Specifies the data nodes of the queues built by
                                                             ADV_LPBAM_SPI_TxRx_SetDataQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_TXRX_DATAQ_RXDATA_NODE       (0x00U) /*!< Specifies the data nodes of the queues built by
                                                             ADV_LPBAM_SPI_TxRx_SetDataQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_TXRX_FULLQ_TXDATA_NODE       (0x09U) /*!< Specifies the data nodes of the queues built by
                                                             ADV_LPBAM_SPI_TxRx_SetFullQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_SPI_TXRX_FULLQ_RXDATA_NODE       (0x00U) /*!< Specifies the data nodes of the queues built by
                                                             ADV_LPBAM_SPI_TxRx_SetFullQ()
                                                             This define can be used as a parameter for :
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 
 /* UART data nodes defines */
 #define LPBAM_UART_TX_DATAQ_DATA_NODE          (0x00U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_UART_Transmit_SetDataQ()
                                                             This define can be used as a parameter for :
                                                                       + ADV_LPBAM_Q_SetCircularMode()
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_UART_TX_FULLQ_DATA_NODE          (0x04U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_UART_Transmit_SetFullQ()
                                                             This define can be used as a parameter for :
                                                                       + ADV_LPBAM_Q_SetCircularMode()
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_UART_RX_DATAQ_DATA_NODE          (0x00U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_UART_Receive_SetDataQ()
                                                             This define can be used as a parameter for :
                                                                       + ADV_LPBAM_Q_SetCircularMode()
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 #define LPBAM_UART_RX_FULLQ_DATA_NODE          (0x02U) /*!< Specifies the data node of the queue built by
                                                             ADV_LPBAM_UART_Receive_SetFullQ()
                                                             This define can be used as a parameter for :
                                                                       + ADV_LPBAM_Q_SetCircularMode()
-                                                                      + ADV_LPBAM_Q_SetDataConfig()        */
+                                                                      + ADV_LPBAM_Q_SetDataConfig()
+                                                                      + ADV_LPBAM_Q_SetPingPongMode()      */
 /**
   * @}
   */
@@ -682,6 +711,13 @@ LPBAM_Status_t ADV_LPBAM_Q_SetTriggerConfig(LPBAM_COMMON_TrigAdvConf_t const *co
 LPBAM_Status_t ADV_LPBAM_Q_SetCircularMode(void             const *const pDescriptor,
                                            uint32_t         NodeLevel,
                                            DMA_QListTypeDef *const pQueue);
+/**
+  * @brief ADV_LPBAM_Q_SetPingPongMode.
+  */
+LPBAM_Status_t ADV_LPBAM_Q_SetPingPongMode(LPBAM_COMMON_PingPongAdvConf_t const *const pPingPongConfig,
+                                           uint32_t                       DataNode,
+                                           void                           const *const pDescriptor,
+                                           DMA_QListTypeDef               *const pQueue);
 /**
   * @brief ADV_LPBAM_Q_ConvertQ.
   */
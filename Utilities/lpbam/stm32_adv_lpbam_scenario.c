@@ -0,0 +1,749 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_adv_lpbam_scenario.c
+  * @author  MCD Application Team
+  * @brief   This file provides the advanced LPBAM layer for scenario description.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  @verbatim
+  ======================================================================================================================
+                                 ############### How to use this driver ###############
+  ======================================================================================================================
+    [..]
+      It is recommended to read the LPBAM_Utility_GettingStarted.html document, available at the root of LPBAM utility
+      folder, prior to any LPBAM application development start.
+
+    *** Driver description ***
+    ==========================
+    [..]
+      This section provide description of the driver files content (refer to LPBAM_Utility_GettingStarted.html document
+      for more information)
+
+    [..]
+      It is composed of 2 files :
+          (+) stm32_adv_lpbam_scenario.c file
+              (++) This file provides the implementation of the advanced LPBAM SCENARIO functions.
+          (+) stm32_adv_lpbam_scenario.h file
+              (++) This file is the header file of stm32_adv_lpbam_scenario.c. It provides advanced LPBAM SCENARIO
+                   functions prototypes and the declaration of their needed exported types and structures.
+
+    [..]
+      This module relies on the COMMON module : LPBAM_COMMON_MODULE_ENABLED must be defined with
+      LPBAM_SCENARIO_MODULE_ENABLED in the stm32_lpbam_conf.h file.
+
+    *** Driver functions model ***
+    ==============================
+    [..]
+      This section precises this module supported advanced functions model (refer to LPBAM_Utility_GettingStarted.html
+      document for function model definition).
+
+    [..]
+      This driver provides 2 model of APIs :
+          (+) ADV_LPBAM_SCENARIO_Check() : check a scenario description without building any node.
+          (+) ADV_LPBAM_SCENARIO_SetQ()  : build the linked-list queue described by a scenario.
+
+    *** Driver features ***
+    =======================
+    [..]
+      This section describes this LPBAM module supported features.
+
+    [..]
+      This driver provides services covering the LPBAM management of the following features :
+          (+) Describe a linked-list queue as a constant table of steps instead of a sequence of advanced API calls.
+          (+) Check the trigger and event ordering of the steps before building the queue.
+          (+) Build the queue, apply the steps trigger, data and transfer event configuration and set circular mode.
+          (+) Remove the configuration nodes that write again a register value already written by a previous step.
+          (+) Report the exact number of linked nodes and the memory used by the scenario.
+
+    *** Functional description ***
+    ==============================
+    [..]
+      This section describes the features covered by this LPBAM module.
+
+    [..]
+      A scenario is an ordered table of LPBAM_SCENARIO_Step_t that describes one DMA channel linked-list queue. Each
+      step is either :
+          (+) a LPBAM_SCENARIO_STEP_QUEUE step : the nodes are built by one advanced API
+              (ADV_LPBAM_{Module}_{Mode}_Set{Full/Config/Data}Q()) called through the step pBuildFunc with the step
+              descriptor.
+          (+) a LPBAM_SCENARIO_STEP_TRANSFER step : one node is built from the DMA_NodeConfTypeDef pointed by pContext
+              into the DMA_NodeTypeDef pointed by pDescriptor (memory to memory copy, timer cadenced transfer...).
+      The step trigger, data configuration and transfer event generation are applied as done by the COMMON module
+      ADV_LPBAM_Q_SetTriggerConfig(), ADV_LPBAM_Q_SetDataConfig() and ADV_LPBAM_Q_SetTransferEventGeneration() APIs.
+
+    [..]
+      The trigger and event ordering is described by user defined event bit masks :
+          (+) ExternalEvents : events generated outside of the queue (timers, EXTI lines, other DMA channels).
+          (+) Events         : events generated by the step transfer event.
+          (+) WaitEvents     : events awaited by the step trigger.
+      A step can only wait for external events or events generated by the previous steps of the queue. Waiting for an
+      event generated by a following step, or never generated, blocks the channel at the first queue execution.
+
+    [..]
+      Configuration nodes copy a descriptor register value to a peripheral register. When two steps configure the same
+      peripheral (i.e. chaining full queues on the same instance), the second step configuration nodes write again the
+      values already written by the first one. When MergeConfig is enabled for a step, its configuration nodes writing
+      the same value than the last node writing the same register are removed from the queue, except :
+          (+) the nodes with a trigger or waiting for a peripheral request.
+          (+) the step trigger, data, transfer event and first circular nodes.
+          (+) the nodes writing a flag clear register (ADC ISR, DMA CFCR, LPTIM ICR, SPI IFCR, UART ICR), a start
+              register (ADC CR, DMA CCR, I2C CR2, LPTIM CR, SPI CR1, GPIO BSRR) or a DMA channel register updated
+              during the transfers (CBR1, CLLR).
+      In circular mode, a node of the loop without previous writer in the loop is reached again after the last writer
+      of the loop : it is removed only when this last writer also writes the same value.
+      MergeConfig must not be enabled for a step configuring other registers that are modified by hardware between the
+      two steps.
+
+    *** Driver APIs description ***
+    ===============================
+    [..]
+      This section provides LPBAM module exhaustive APIs description without considering application user call sequence.
+      For user call sequence information, please refer to 'Driver user sequence' section below.
+
+    [..]
+      Use ADV_LPBAM_SCENARIO_Check() API to check a scenario description. The following checks are performed :
+          (+) The step number is between 1 and LPBAM_SCENARIO_MAX_STEPS.
+          (+) Each step has a descriptor and a build function or a transfer node configuration.
+          (+) Each triggered step awaits at least one event and each step awaiting an event is triggered.
+          (+) Each awaited event is external or generated by a previous step.
+          (+) Each step generating an event has its transfer event generation configured.
+          (+) The trigger, data, transfer event and first circular node levels are in the step descriptor.
+      The ErrorStep field of LPBAM_SCENARIO_Report_t reports the step in error and the DescriptorSize field reports the
+      memory reserved by the step descriptors.
+
+    [..]
+      Use ADV_LPBAM_SCENARIO_SetQ() API to build the linked-list queue of a scenario. The scenario is checked, the
+      steps are built in the table order, the redundant configuration nodes are removed and the circular mode is set.
+      The NodeNumber, MergedNodeNumber, NodeSize and StepNodeNumber fields of LPBAM_SCENARIO_Report_t report the linked
+      nodes. Any descriptor node beyond StepNodeNumber is not used by the scenario.
+
+    *** Driver user sequence ***
+    ============================
+    [..]
+      This section provides the steps to follow to build a linked-list queue from a scenario description.
+
+    [..]
+      Use the following sequence :
+          (+) Declare the step descriptors in a memory section accessible by the DMA in low power mode.
+          (+) Write one build function per LPBAM_SCENARIO_STEP_QUEUE step calling the advanced API.
+          (+) Describe the steps in a LPBAM_SCENARIO_Step_t table and the scenario in a LPBAM_SCENARIO_Desc_t.
+          (+) Call ADV_LPBAM_SCENARIO_SetQ() with an empty queue.
+          (+) Link the queue to the DMA channel and start it as for any queue built with the advanced APIs.
+
+    *** Driver status description ***
+    =================================
+    [..]
+      This section provides reported LPBAM module status.
+
+    [..]
+      This advanced module reports any detected issue.
+          (+) returned values are :
+              (++) LPBAM_OK when no error is detected.
+              (++) LPBAM_ERROR when any error is detected.
+
+    @endverbatim
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_lpbam.h"
+#include "stm32_ll_lpbam.h"
+
+#ifdef LPBAM_SCENARIO_MODULE_ENABLED
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+#define LPBAM_SCENARIO_NODE_ADDR(DESC, LEVEL) ((uint32_t)(DESC) + ((LEVEL) * sizeof(DMA_NodeTypeDef)))
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static LPBAM_Status_t LPBAM_SCENARIO_CheckStep(LPBAM_SCENARIO_Desc_t const *const pScenario,
+                                               uint32_t              Step,
+                                               uint32_t              AvailableEvents);
+static LPBAM_Status_t LPBAM_SCENARIO_BuildStep(LPBAM_SCENARIO_Step_t const *const pStep,
+                                               DMA_QListTypeDef      *const pQueue);
+static LPBAM_Status_t LPBAM_SCENARIO_MergeConfigNodes(LPBAM_SCENARIO_Desc_t   const *const pScenario,
+                                                      DMA_QListTypeDef        *const pQueue,
+                                                      LPBAM_SCENARIO_Report_t *const pReport);
+static uint32_t LPBAM_SCENARIO_IsRedundantNode(LPBAM_SCENARIO_Desc_t const *const pScenario,
+                                               uint32_t              Step,
+                                               DMA_NodeTypeDef       const *const pNode,
+                                               DMA_QListTypeDef      const *const pQueue);
+static uint32_t LPBAM_SCENARIO_GetWrittenValue(DMA_NodeConfTypeDef const *const pNodeConf);
+static uint32_t LPBAM_SCENARIO_IsSameValue(uint32_t WriterSrc,
+                                           uint32_t NodeSrc,
+                                           uint32_t Size);
+static DMA_NodeTypeDef *LPBAM_SCENARIO_GetNextNode(DMA_QListTypeDef const *const pQueue,
+                                                   DMA_NodeTypeDef  const *const pNode);
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+
+/** @addtogroup LPBAM_Utilities_Driver
+  * @{
+  */
+
+/** @addtogroup SCENARIO_Advanced SCENARIO_Advanced
+  * @brief    SCENARIO Advanced LPBAM module driver
+  * @{
+  */
+
+/** @addtogroup LPBAM_SCENARIO_Advanced_Exported_Functions LPBAM SCENARIO Advanced Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Check the scenario description according to parameters in the LPBAM_SCENARIO_Desc_t.
+  * @param  pScenario    : [IN]  Pointer to a LPBAM_SCENARIO_Desc_t structure that contains the scenario description.
+  * @param  pReport      : [OUT] Pointer to a LPBAM_SCENARIO_Report_t structure that reports the step in error and the
+  *                              descriptors memory.
+  * @retval LPBAM Status : [OUT] Value from LPBAM_Status_t enumeration.
+  */
+LPBAM_Status_t ADV_LPBAM_SCENARIO_Check(LPBAM_SCENARIO_Desc_t   const *const pScenario,
+                                        LPBAM_SCENARIO_Report_t *const pReport)
+{
+  uint32_t available_events;
+  uint32_t step;
+
+  /* Reset report */
+  pReport->NodeNumber       = 0U;
+  pReport->MergedNodeNumber = 0U;
+  pReport->NodeSize         = 0U;
+  pReport->DescriptorSize   = 0U;
+  pReport->ErrorStep        = LPBAM_SCENARIO_NO_STEP;
+  for (step = 0U; step < LPBAM_SCENARIO_MAX_STEPS; step++)
+  {
+    pReport->StepNodeNumber[step] = 0U;
+  }
+
+  /* Check steps table */
+  if ((pScenario->pSteps == NULL) || (pScenario->StepNumber == 0U) ||
+      (pScenario->StepNumber > LPBAM_SCENARIO_MAX_STEPS))
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Check first circular step */
+  if ((pScenario->CircularMode == ENABLE) && (pScenario->CircularStep >= pScenario->StepNumber))
+  {
+    pReport->ErrorStep = pScenario->CircularStep;
+
+    return LPBAM_ERROR;
+  }
+
+  /* Check steps in the queue execution order : only external events and events of previous steps can be awaited */
+  available_events = pScenario->ExternalEvents;
+  for (step = 0U; step < pScenario->StepNumber; step++)
+  {
+    if (LPBAM_SCENARIO_CheckStep(pScenario, step, available_events) != LPBAM_OK)
+    {
+      pReport->ErrorStep = step;
+
+      return LPBAM_ERROR;
+    }
+
+    available_events        |= pScenario->pSteps[step].Events;
+    pReport->DescriptorSize += pScenario->pSteps[step].DescriptorSize;
+  }
+
+  return LPBAM_OK;
+}
+
+/**
+  * @brief  Build DMA linked-list queue according to parameters in the LPBAM_SCENARIO_Desc_t.
+  * @param  pScenario    : [IN]  Pointer to a LPBAM_SCENARIO_Desc_t structure that contains the scenario description.
+  * @param  pQueue       : [OUT] Pointer to a DMA_QListTypeDef structure that contains DMA linked-list queue
+  *                              information.
+  * @param  pReport      : [OUT] Pointer to a LPBAM_SCENARIO_Report_t structure that reports the linked nodes and the
+  *                              step in error.
+  * @retval LPBAM Status : [OUT] Value from LPBAM_Status_t enumeration.
+  */
+LPBAM_Status_t ADV_LPBAM_SCENARIO_SetQ(LPBAM_SCENARIO_Desc_t   const *const pScenario,
+                                       DMA_QListTypeDef        *const pQueue,
+                                       LPBAM_SCENARIO_Report_t *const pReport)
+{
+  LPBAM_SCENARIO_Step_t const *p_step;
+  uint32_t node_number;
+  uint32_t step;
+
+  /* Check scenario description */
+  if (ADV_LPBAM_SCENARIO_Check(pScenario, pReport) != LPBAM_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /*
+   *               ######## Build steps ########
+   */
+  for (step = 0U; step < pScenario->StepNumber; step++)
+  {
+    p_step      = &pScenario->pSteps[step];
+    node_number = pQueue->NodeNumber;
+
+    /* Build step nodes and apply step trigger, data and transfer event configuration */
+    if (LPBAM_SCENARIO_BuildStep(p_step, pQueue) != LPBAM_OK)
+    {
+      pReport->ErrorStep = step;
+
+      return LPBAM_ERROR;
+    }
+
+    /* Count the nodes linked by the step */
+    pReport->StepNodeNumber[step] = pQueue->NodeNumber - node_number;
+  }
+
+  /*
+   *               ######## Merge redundant configuration nodes ########
+   */
+  if (LPBAM_SCENARIO_MergeConfigNodes(pScenario, pQueue, pReport) != LPBAM_OK)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /*
+   *               ######## Set circular mode ########
+   */
+  if (pScenario->CircularMode == ENABLE)
+  {
+    if (ADV_LPBAM_Q_SetCircularMode(pScenario->pSteps[pScenario->CircularStep].pDescriptor, pScenario->CircularNode,
+                                    pQueue) != LPBAM_OK)
+    {
+      pReport->ErrorStep = pScenario->CircularStep;
+
+      return LPBAM_ERROR;
+    }
+  }
+
+  /* Report linked nodes memory */
+  pReport->NodeNumber = pQueue->NodeNumber;
+  pReport->NodeSize   = pQueue->NodeNumber * sizeof(DMA_NodeTypeDef);
+
+  return LPBAM_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Check one step of the scenario description.
+  * @param  pScenario       : [IN]  Pointer to a LPBAM_SCENARIO_Desc_t structure that contains the scenario
+  *                                 description.
+  * @param  Step            : [IN]  Specifies the step to be checked.
+  * @param  AvailableEvents : [IN]  Specifies the events generated before the step execution.
+  * @retval LPBAM Status    : [OUT] Value from LPBAM_Status_t enumeration.
+  */
+static LPBAM_Status_t LPBAM_SCENARIO_CheckStep(LPBAM_SCENARIO_Desc_t const *const pScenario,
+                                               uint32_t              Step,
+                                               uint32_t              AvailableEvents)
+{
+  LPBAM_SCENARIO_Step_t const *p_step = &pScenario->pSteps[Step];
+  uint32_t node_max = p_step->DescriptorSize / sizeof(DMA_NodeTypeDef);
+
+  /* Check step descriptor */
+  if ((p_step->pDescriptor == NULL) || (node_max == 0U))
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Check step build information */
+  if (p_step->StepType == LPBAM_SCENARIO_STEP_QUEUE)
+  {
+    if (p_step->pBuildFunc == NULL)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+  else if (p_step->StepType == LPBAM_SCENARIO_STEP_TRANSFER)
+  {
+    if (p_step->pContext == NULL)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+  else
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* A triggered step awaits at least one event and a step awaiting an event is triggered */
+  if ((p_step->pTrigConfig == NULL) != (p_step->WaitEvents == 0U))
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Awaited events are generated outside of the queue or by a previous step */
+  if ((p_step->WaitEvents & ~AvailableEvents) != 0U)
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Generated events are produced by the step transfer event */
+  if ((p_step->Events != 0U) && (p_step->UpdateTransferEvent != ENABLE))
+  {
+    return LPBAM_ERROR;
+  }
+
+  /* Check node levels */
+  if ((p_step->pTrigConfig != NULL) && (p_step->TriggerNode >= node_max))
+  {
+    return LPBAM_ERROR;
+  }
+
+  if ((p_step->pDataConfig != NULL) && (p_step->DataNode >= node_max))
+  {
+    return LPBAM_ERROR;
+  }
+
+  if ((p_step->UpdateTransferEvent == ENABLE) && (p_step->TransferEventNode >= node_max))
+  {
+    return LPBAM_ERROR;
+  }
+
+  if ((pScenario->CircularMode == ENABLE) && (pScenario->CircularStep == Step) &&
+      (pScenario->CircularNode >= node_max))
+  {
+    return LPBAM_ERROR;
+  }
+
+  return LPBAM_OK;
+}
+
+/**
+  * @brief  Build one step of the scenario and apply its trigger, data and transfer event configuration.
+  * @param  pStep        : [IN]  Pointer to a LPBAM_SCENARIO_Step_t structure that contains the step description.
+  * @param  pQueue       : [OUT] Pointer to a DMA_QListTypeDef structure that contains DMA linked-list queue
+  *                              information.
+  * @retval LPBAM Status : [OUT] Value from LPBAM_Status_t enumeration.
+  */
+static LPBAM_Status_t LPBAM_SCENARIO_BuildStep(LPBAM_SCENARIO_Step_t const *const pStep,
+                                               DMA_QListTypeDef      *const pQueue)
+{
+  /* Build step nodes */
+  if (pStep->StepType == LPBAM_SCENARIO_STEP_QUEUE)
+  {
+    if (pStep->pBuildFunc(pStep->pContext, pStep->pDescriptor, pQueue) != LPBAM_OK)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+  else
+  {
+    /* Build transfer node */
+    if (HAL_DMAEx_List_BuildNode((DMA_NodeConfTypeDef const *)pStep->pContext,
+                                 (DMA_NodeTypeDef *)pStep->pDescriptor) != HAL_OK)
+    {
+      return LPBAM_ERROR;
+    }
+
+    /* Connect transfer node to DMA Queue */
+    if (HAL_DMAEx_List_InsertNode_Tail(pQueue, (DMA_NodeTypeDef *)pStep->pDescriptor) != HAL_OK)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+
+  /* Set step trigger */
+  if (pStep->pTrigConfig != NULL)
+  {
+    if (ADV_LPBAM_Q_SetTriggerConfig(pStep->pTrigConfig, pStep->TriggerNode, pStep->pDescriptor) != LPBAM_OK)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+
+  /* Set step data configuration */
+  if (pStep->pDataConfig != NULL)
+  {
+    if (ADV_LPBAM_Q_SetDataConfig(pStep->pDataConfig, pStep->DataNode, pStep->pDescriptor) != LPBAM_OK)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+
+  /* Set step transfer event generation */
+  if (pStep->UpdateTransferEvent == ENABLE)
+  {
+    if (ADV_LPBAM_Q_SetTransferEventGeneration(pStep->TransferEvent, pStep->TransferEventNode,
+                                               pStep->pDescriptor) != LPBAM_OK)
+    {
+      return LPBAM_ERROR;
+    }
+  }
+
+  return LPBAM_OK;
+}
+
+/**
+  * @brief  Remove the redundant configuration nodes of the steps with MergeConfig enabled.
+  * @param  pScenario    : [IN]  Pointer to a LPBAM_SCENARIO_Desc_t structure that contains the scenario description.
+  * @param  pQueue       : [OUT] Pointer to a DMA_QListTypeDef structure that contains DMA linked-list queue
+  *                              information.
+  * @param  pReport      : [OUT] Pointer to a LPBAM_SCENARIO_Report_t structure that reports the linked nodes.
+  * @retval LPBAM Status : [OUT] Value from LPBAM_Status_t enumeration.
+  */
+static LPBAM_Status_t LPBAM_SCENARIO_MergeConfigNodes(LPBAM_SCENARIO_Desc_t   const *const pScenario,
+                                                      DMA_QListTypeDef        *const pQueue,
+                                                      LPBAM_SCENARIO_Report_t *const pReport)
+{
+  DMA_NodeTypeDef *p_node = pQueue->Head;
+  DMA_NodeTypeDef *p_next;
+  uint32_t node_number;
+  uint32_t step;
+  uint32_t node;
+
+  /* Nodes are linked in the steps order : walk the queue step by step */
+  for (step = 0U; step < pScenario->StepNumber; step++)
+  {
+    node_number = pReport->StepNodeNumber[step];
+
+    for (node = 0U; node < node_number; node++)
+    {
+      /* Get next node before unlinking the current one */
+      p_next = LPBAM_SCENARIO_GetNextNode(pQueue, p_node);
+
+      if ((pScenario->pSteps[step].MergeConfig == ENABLE) &&
+          (LPBAM_SCENARIO_IsRedundantNode(pScenario, step, p_node, pQueue) != 0U))
+      {
+        if (HAL_DMAEx_List_RemoveNode(pQueue, p_node) != HAL_OK)
+        {
+          pReport->ErrorStep = step;
+
+          return LPBAM_ERROR;
+        }
+
+        pReport->StepNodeNumber[step]--;
+        pReport->MergedNodeNumber++;
+      }
+
+      p_node = p_next;
+    }
+  }
+
+  return LPBAM_OK;
+}
+
+/**
+  * @brief  Check whether a step node writes again the value written by the last node writing the same register.
+  *         In a circular queue, a loop node without previous writer in the loop is also written at each loop by the
+  *         last writer of the loop : both values are compared.
+  * @param  pScenario : [IN]  Pointer to a LPBAM_SCENARIO_Desc_t structure that contains the scenario description.
+  * @param  Step      : [IN]  Specifies the step of the node.
+  * @param  pNode     : [IN]  Pointer to a DMA_NodeTypeDef structure that contains the node to be checked.
+  * @param  pQueue    : [IN]  Pointer to a DMA_QListTypeDef structure that contains DMA linked-list queue
+  *                           information.
+  * @retval Redundant : [OUT] 1 when the node can be removed from the queue, 0 otherwise.
+  */
+static uint32_t LPBAM_SCENARIO_IsRedundantNode(LPBAM_SCENARIO_Desc_t const *const pScenario,
+                                               uint32_t              Step,
+                                               DMA_NodeTypeDef       const *const pNode,
+                                               DMA_QListTypeDef      const *const pQueue)
+{
+  LPBAM_SCENARIO_Step_t const *p_step = &pScenario->pSteps[Step];
+  DMA_NodeConfTypeDef node_conf;
+  DMA_NodeConfTypeDef prev_conf;
+  DMA_NodeTypeDef const *p_prev = pQueue->Head;
+  uint32_t desc_addr = (uint32_t)p_step->pDescriptor;
+  uint32_t node_addr = (uint32_t)pNode;
+  uint32_t loop_addr = 0U;
+  uint32_t in_loop      = 0U;
+  uint32_t node_seen    = 0U;
+  uint32_t node_in_loop = 0U;
+  uint32_t writer_src       = 0U;
+  uint32_t writer_size      = 0U;
+  uint32_t writer_in_loop   = 0U;
+  uint32_t wrap_writer_src  = 0U;
+  uint32_t wrap_writer_size = 0U;
+  uint32_t wrap_writer      = 0U;
+
+  if (HAL_DMAEx_List_GetNodeConfig(&node_conf, (DMA_NodeTypeDef *)pNode) != HAL_OK)
+  {
+    return 0U;
+  }
+
+  /* Configuration nodes copy one register value of the step descriptor */
+  if ((node_conf.SrcAddress < desc_addr) || (node_conf.SrcAddress >= (desc_addr + p_step->DescriptorSize)) ||
+      (LPBAM_SCENARIO_GetWrittenValue(&node_conf) == 0U))
+  {
+    return 0U;
+  }
+
+  /* Triggered nodes and nodes waiting for a peripheral request synchronize the queue and are kept */
+  if ((node_conf.TriggerConfig.TriggerPolarity != DMA_TRIG_POLARITY_MASKED) ||
+      (node_conf.Init.Direction != DMA_MEMORY_TO_MEMORY))
+  {
+    return 0U;
+  }
+
+  /* Writes clearing flags, starting the peripheral or restoring a register updated by hardware are kept */
+  if (LPBAM_IsActionRegister(node_conf.DstAddress) != 0U)
+  {
+    return 0U;
+  }
+
+  /* Nodes customized by the scenario are kept */
+  if (((p_step->pTrigConfig != NULL) && (node_addr == LPBAM_SCENARIO_NODE_ADDR(desc_addr, p_step->TriggerNode))) ||
+      ((p_step->pDataConfig != NULL) && (node_addr == LPBAM_SCENARIO_NODE_ADDR(desc_addr, p_step->DataNode))) ||
+      ((p_step->UpdateTransferEvent == ENABLE) &&
+       (node_addr == LPBAM_SCENARIO_NODE_ADDR(desc_addr, p_step->TransferEventNode))) ||
+      ((pScenario->CircularMode == ENABLE) && (pScenario->CircularStep == Step) &&
+       (node_addr == LPBAM_SCENARIO_NODE_ADDR(desc_addr, pScenario->CircularNode))))
+  {
+    return 0U;
+  }
+
+  /* The loop runs from the first circular node to the last node of the queue */
+  if (pScenario->CircularMode == ENABLE)
+  {
+    loop_addr = LPBAM_SCENARIO_NODE_ADDR(pScenario->pSteps[pScenario->CircularStep].pDescriptor,
+                                         pScenario->CircularNode);
+  }
+
+  /* Find the last node writing the same register before the node and, in the loop, the last one after the node */
+  while (p_prev != NULL)
+  {
+    if ((uint32_t)p_prev == loop_addr)
+    {
+      in_loop = 1U;
+    }
+
+    if (p_prev == pNode)
+    {
+      node_seen    = 1U;
+      node_in_loop = in_loop;
+    }
+    else
+    {
+      if (HAL_DMAEx_List_GetNodeConfig(&prev_conf, (DMA_NodeTypeDef *)p_prev) != HAL_OK)
+      {
+        return 0U;
+      }
+
+      if (prev_conf.DstAddress == node_conf.DstAddress)
+      {
+        if (node_seen == 0U)
+        {
+          writer_src     = LPBAM_SCENARIO_GetWrittenValue(&prev_conf);
+          writer_size    = prev_conf.DataSize;
+          writer_in_loop = in_loop;
+        }
+        else
+        {
+          wrap_writer_src  = LPBAM_SCENARIO_GetWrittenValue(&prev_conf);
+          wrap_writer_size = prev_conf.DataSize;
+          wrap_writer      = 1U;
+        }
+      }
+    }
+
+    p_prev = LPBAM_SCENARIO_GetNextNode(pQueue, p_prev);
+  }
+
+  /* The register is written for the first time or by a data transfer */
+  if (LPBAM_SCENARIO_IsSameValue(writer_src, node_conf.SrcAddress,
+                                 ((writer_size == node_conf.DataSize) ? node_conf.DataSize : 0U)) == 0U)
+  {
+    return 0U;
+  }
+
+  /* From the second loop, a loop node without previous writer in the loop follows the last writer of the loop */
+  if ((node_in_loop != 0U) && (writer_in_loop == 0U) && (wrap_writer != 0U))
+  {
+    if (LPBAM_SCENARIO_IsSameValue(wrap_writer_src, node_conf.SrcAddress,
+                                   ((wrap_writer_size == node_conf.DataSize) ? node_conf.DataSize : 0U)) == 0U)
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Get the written value of a node writing a single data.
+  * @param  pNodeConf : [IN]  Pointer to a DMA_NodeConfTypeDef structure that contains the node configuration.
+  * @retval SrcAddr   : [OUT] Address of the written value, 0 for a data transfer.
+  */
+static uint32_t LPBAM_SCENARIO_GetWrittenValue(DMA_NodeConfTypeDef const *const pNodeConf)
+{
+  uint32_t src_width = 1UL << ((pNodeConf->Init.SrcDataWidth & DMA_CTR1_SDW_LOG2) >> DMA_CTR1_SDW_LOG2_Pos);
+
+  /* A single data, or the same source data written several times */
+  if ((pNodeConf->DataSize > sizeof(uint32_t)) ||
+      ((pNodeConf->Init.SrcInc != DMA_SINC_FIXED) && (pNodeConf->DataSize != src_width)))
+  {
+    return 0U;
+  }
+
+  return pNodeConf->SrcAddress;
+}
+
+/**
+  * @brief  Compare the values written by two nodes.
+  * @param  WriterSrc : [IN]  Specifies the address of the value written by the previous writer, 0 for none.
+  * @param  NodeSrc   : [IN]  Specifies the address of the value written by the node.
+  * @param  Size      : [IN]  Specifies the written size in bytes, 0 when both sizes differ.
+  * @retval Same      : [OUT] 1 when both values are equal, 0 otherwise.
+  */
+static uint32_t LPBAM_SCENARIO_IsSameValue(uint32_t WriterSrc,
+                                           uint32_t NodeSrc,
+                                           uint32_t Size)
+{
+  uint32_t idx;
+
+  if ((WriterSrc == 0U) || (Size == 0U))
+  {
+    return 0U;
+  }
+
+  for (idx = 0U; idx < Size; idx++)
+  {
+    if (((uint8_t const *)WriterSrc)[idx] != ((uint8_t const *)NodeSrc)[idx])
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Get the node linked after a node of a queue.
+  * @param  pQueue  : [IN]  Pointer to a DMA_QListTypeDef structure that contains DMA linked-list queue information.
+  * @param  pNode   : [IN]  Pointer to a DMA_NodeTypeDef structure that contains the current node.
+  * @retval pNext   : [OUT] Pointer to the next node, NULL for the last node.
+  */
+static DMA_NodeTypeDef *LPBAM_SCENARIO_GetNextNode(DMA_QListTypeDef const *const pQueue,
+                                                   DMA_NodeTypeDef  const *const pNode)
+{
+  uint32_t cllr = pNode->LinkRegisters[(pNode->NodeInfo & NODE_CLLR_IDX) >> NODE_CLLR_IDX_POS];
+
+  if ((cllr & DMA_CLLR_LA) == 0U)
+  {
+    return NULL;
+  }
+
+  /* Linked nodes share the queue head base address */
+  return (DMA_NodeTypeDef *)(((uint32_t)pQueue->Head & DMA_CLBAR_LBA) | (cllr & DMA_CLLR_LA));
+}
+
+#endif /* LPBAM_SCENARIO_MODULE_ENABLED */
@@ -0,0 +1,244 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32_adv_lpbam_scenario.h
+  * @author  MCD Application Team
+  * @brief   header for the stm32_adv_lpbam_scenario.c file
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32_ADV_LPBAM_SCENARIO_H
+#define STM32_ADV_LPBAM_SCENARIO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32_lpbam_common.h"
+
+/** @addtogroup LPBAM_Utilities_Driver
+  * @{
+  */
+
+/** @defgroup SCENARIO_Advanced SCENARIO_Advanced
+  * @brief    SCENARIO Advanced LPBAM module driver
+  * @{
+  */
+
+/** @defgroup LPBAM_SCENARIO_Advanced_Exported_Constants LPBAM SCENARIO Advanced Exported Constants
+  * @brief    LPBAM SCENARIO Advanced Exported Constants
+  * @{
+  */
+
+/** @defgroup LPBAM_SCENARIO_Max_Steps LPBAM SCENARIO Max Steps
+  * @brief    Maximum number of steps of a scenario. Can be overridden in the stm32_lpbam_conf.h file.
+  * @{
+  */
+#ifndef LPBAM_SCENARIO_MAX_STEPS
+#define LPBAM_SCENARIO_MAX_STEPS (16U) /*!< Maximum number of steps of a scenario */
+#endif /* LPBAM_SCENARIO_MAX_STEPS */
+/**
+  * @}
+  */
+
+/** @defgroup LPBAM_SCENARIO_Step_Type LPBAM SCENARIO Step Type
+  * @brief    LPBAM SCENARIO Step Type
+  * @{
+  */
+#define LPBAM_SCENARIO_STEP_QUEUE    (0x00U) /*!< Step built by an advanced API called through pBuildFunc          */
+#define LPBAM_SCENARIO_STEP_TRANSFER (0x01U) /*!< Step built as one DMA node from the DMA_NodeConfTypeDef pContext */
+/**
+  * @}
+  */
+
+/** @defgroup LPBAM_SCENARIO_No_Step LPBAM SCENARIO No Step
+  * @brief    LPBAM SCENARIO No Step
+  * @{
+  */
+#define LPBAM_SCENARIO_NO_STEP (0xFFFFFFFFU) /*!< No step reported in LPBAM_SCENARIO_Report_t ErrorStep field */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup LPBAM_SCENARIO_Advanced_Exported_Types LPBAM SCENARIO Advanced Exported Types
+  * @brief    LPBAM SCENARIO Advanced Exported Types
+  * @{
+  */
+
+/**
+  * @brief LPBAM SCENARIO build function definition.
+  *        The function appends the step nodes to pQueue by calling one ADV_LPBAM_{Module}_{Mode}_SetFullQ(),
+  *        ADV_LPBAM_{Module}_{Mode}_SetConfigQ() or ADV_LPBAM_{Module}_{Mode}_SetDataQ() API with pDescriptor.
+  */
+typedef LPBAM_Status_t (*LPBAM_SCENARIO_BuildFunc_t)(void             const *const pContext,
+                                                     void             *const pDescriptor,
+                                                     DMA_QListTypeDef *const pQueue);
+
+/**
+  * @brief LPBAM SCENARIO Step Structure definition.
+  */
+typedef struct
+{
+  uint32_t                         StepType;          /*!< Specifies the step type.
+                                                           This parameter can be a value of
+                                                           @ref LPBAM_SCENARIO_Step_Type                             */
+
+  LPBAM_SCENARIO_BuildFunc_t       pBuildFunc;        /*!< Specifies the function building the step nodes.
+                                                           Used only for LPBAM_SCENARIO_STEP_QUEUE steps             */
+
+  void                             const *pContext;   /*!< Specifies the step build context.
+                                                           For LPBAM_SCENARIO_STEP_QUEUE steps, it is passed as is to
+                                                           pBuildFunc.
+                                                           For LPBAM_SCENARIO_STEP_TRANSFER steps, it points to the
+                                                           DMA_NodeConfTypeDef of the transfer node                  */
+
+  void                             *pDescriptor;      /*!< Specifies the step descriptor.
+                                                           For LPBAM_SCENARIO_STEP_TRANSFER steps, it points to a
+                                                           DMA_NodeTypeDef                                           */
+
+  uint32_t                         DescriptorSize;    /*!< Specifies the step descriptor size in bytes :
+                                                           sizeof(*pDescriptor)                                      */
+
+  LPBAM_COMMON_TrigAdvConf_t const *pTrigConfig;      /*!< Specifies the step trigger configuration.
+                                                           NULL when the step is not triggered                       */
+
+  uint32_t                         TriggerNode;       /*!< Specifies the node level of the step trigger.
+                                                           This parameter can be a value of
+                                                           @ref LPBAM_Q_Config_Node_Selection or
+                                                           @ref LPBAM_Q_Data_Node_Selection                          */
+
+  LPBAM_COMMON_DataAdvConf_t const *pDataConfig;      /*!< Specifies the step data node configuration.
+                                                           NULL when the step data node is kept as built             */
+
+  uint32_t                         DataNode;          /*!< Specifies the node level of the step data configuration.
+                                                           This parameter can be a value of
+                                                           @ref LPBAM_Q_Data_Node_Selection                          */
+
+  LPBAM_FunctionalState            UpdateTransferEvent; /*!< Specifies whether the step transfer event mode is to be
+                                                             updated or not.
+                                                             This parameter can be ENABLE or DISABLE                 */
+
+  uint32_t                         TransferEvent;     /*!< Specifies the step transfer event mode.
+                                                           This parameter can be a value of
+                                                           @ref LPBAM_DMA_Transfer_Event_Mode                        */
+
+  uint32_t                         TransferEventNode; /*!< Specifies the node level of the step transfer event.
+                                                           This parameter can be a value of
+                                                           @ref LPBAM_Q_LastNode_Selection                           */
+
+  uint32_t                         WaitEvents;        /*!< Specifies the scenario events awaited by the step trigger.
+                                                           This parameter is a user defined bit mask, 0 when the step
+                                                           is not triggered                                          */
+
+  uint32_t                         Events;            /*!< Specifies the scenario events generated by the step
+                                                           transfer event.
+                                                           This parameter is a user defined bit mask, 0 when the step
+                                                           does not generate any event awaited by the scenario       */
+
+  LPBAM_FunctionalState            MergeConfig;       /*!< Specifies whether the step configuration nodes already
+                                                           applied by a previous step can be removed from the queue.
+                                                           This parameter can be ENABLE or DISABLE.
+                                                           Flag clear and start register writes are always kept.
+                                                           Enable it only for steps whose other configured registers
+                                                           are not modified by hardware between the two steps        */
+
+} LPBAM_SCENARIO_Step_t;
+
+/**
+  * @brief LPBAM SCENARIO Description Structure definition.
+  */
+typedef struct
+{
+  LPBAM_SCENARIO_Step_t const *pSteps;       /*!< Specifies the scenario steps table, in queue execution order        */
+
+  uint32_t                    StepNumber;    /*!< Specifies the number of steps in the table.
+                                                  This parameter can be a value between 1 and LPBAM_SCENARIO_MAX_STEPS */
+
+  uint32_t                    ExternalEvents; /*!< Specifies the scenario events generated outside of the queue (other
+                                                   DMA channels, timers, EXTI lines...)                               */
+
+  LPBAM_FunctionalState       CircularMode;  /*!< Specifies whether the queue is circular or not.
+                                                  This parameter can be ENABLE or DISABLE                             */
+
+  uint32_t                    CircularStep;  /*!< Specifies the step of the first circular node                       */
+
+  uint32_t                    CircularNode;  /*!< Specifies the node level of the first circular node in the step.
+                                                  This parameter can be a value of
+                                                  @ref LPBAM_Q_Config_Node_Selection or
+                                                  @ref LPBAM_Q_Data_Node_Selection                                    */
+
+} LPBAM_SCENARIO_Desc_t;
+
+/**
+  * @brief LPBAM SCENARIO Report Structure definition.
+  */
+typedef struct
+{
+  uint32_t NodeNumber;                           /*!< Reports the number of nodes linked in the queue                 */
+
+  uint32_t MergedNodeNumber;                     /*!< Reports the number of configuration nodes removed from the queue */
+
+  uint32_t NodeSize;                             /*!< Reports the memory used by the linked nodes in bytes            */
+
+  uint32_t DescriptorSize;                       /*!< Reports the memory reserved by the step descriptors in bytes    */
+
+  uint32_t StepNodeNumber[LPBAM_SCENARIO_MAX_STEPS]; /*!< Reports the number of nodes linked by each step             */
+
+  uint32_t ErrorStep;                            /*!< Reports the step in error.
+                                                      LPBAM_SCENARIO_NO_STEP when no step is in error                 */
+
+} LPBAM_SCENARIO_Report_t;
+
+/**
+  * @}
+  */
+
+/* Exported functions ------------------------------------------------------------------------------------------------*/
+/** @defgroup LPBAM_SCENARIO_Advanced_Exported_Functions LPBAM SCENARIO Advanced Exported Functions
+  * @brief    LPBAM SCENARIO Advanced Exported Functions
+  * @{
+  */
+
+/**
+  * @brief ADV_LPBAM_SCENARIO_Check.
+  */
+LPBAM_Status_t ADV_LPBAM_SCENARIO_Check(LPBAM_SCENARIO_Desc_t   const *const pScenario,
+                                        LPBAM_SCENARIO_Report_t *const pReport);
+/**
+  * @brief ADV_LPBAM_SCENARIO_SetQ.
+  */
+LPBAM_Status_t ADV_LPBAM_SCENARIO_SetQ(LPBAM_SCENARIO_Desc_t   const *const pScenario,
+                                       DMA_QListTypeDef        *const pQueue,
+                                       LPBAM_SCENARIO_Report_t *const pReport);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32_ADV_LPBAM_SCENARIO_H */
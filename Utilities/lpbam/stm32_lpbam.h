@@ -87,6 +87,10 @@ extern "C" {
 #include "stm32_lpbam_vrefbuf.h"
 #endif /* LPBAM_VREFBUF_MODULE_ENABLED */
 
+#ifdef LPBAM_SCENARIO_MODULE_ENABLED
+#include "stm32_adv_lpbam_scenario.h"
+#endif /* LPBAM_SCENARIO_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -50,6 +50,7 @@ extern "C" {
 /* #define LPBAM_SPI_MODULE_ENABLED     */
 /* #define LPBAM_UART_MODULE_ENABLED    */
 /* #define LPBAM_VREFBUF_MODULE_ENABLED */
+/* #define LPBAM_SCENARIO_MODULE_ENABLED */
 
 #ifdef __cplusplus
 }